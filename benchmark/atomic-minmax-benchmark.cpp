@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Floating point atomicMin and atomicMax on the gpu, with the integer atomic
+// fast paths of the gpu atomic policies against the CAS loop they replace.
+// The argument is the number of addresses the threads update, so 1 is the
+// most contended; the values alternate in sign to use both integer atomics.
+//
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N (1 << 22)
+
+#if defined(RAJA_ENABLE_CUDA)
+using exec_policy = RAJA::cuda_exec<256>;
+using atomic_policy = RAJA::cuda_atomic;
+
+template <typename T>
+RAJA_DEVICE RAJA_INLINE void cas_min(T* acc, T value)
+{
+  RAJA::detail::cuda_atomic_CAS_oper(acc, [=] __device__(T a) {
+    return value < a ? value : a;
+  });
+}
+
+static void device_sync() { cudaDeviceSynchronize(); }
+#elif defined(RAJA_ENABLE_HIP)
+using exec_policy = RAJA::hip_exec<256>;
+using atomic_policy = RAJA::hip_atomic;
+
+template <typename T>
+RAJA_DEVICE RAJA_INLINE void cas_min(T* acc, T value)
+{
+  RAJA::detail::hip_atomic_CAS_oper(acc, [=] __device__(T a) {
+    return value < a ? value : a;
+  });
+}
+
+static void device_sync() { hipDeviceSynchronize(); }
+#endif
+
+template <typename T>
+static T* make_mins(int num_addresses)
+{
+  T* mins = nullptr;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaMallocManaged(&mins, num_addresses * sizeof(T));
+#elif defined(RAJA_ENABLE_HIP)
+  hipMallocManaged(&mins, num_addresses * sizeof(T));
+#endif
+  for (int i = 0; i < num_addresses; ++i) {
+    mins[i] = T(1.0e30);
+  }
+  return mins;
+}
+
+template <typename T>
+static void free_mins(T* mins)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  cudaFree(mins);
+#elif defined(RAJA_ENABLE_HIP)
+  hipFree(mins);
+#endif
+}
+
+template <typename T>
+static void benchmark_atomic_min(benchmark::State& state)
+{
+  const int num_addresses = static_cast<int>(state.range(0));
+  T* mins = make_mins<T>(num_addresses);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<exec_policy>(RAJA::RangeSegment(0, N),
+                              [=] RAJA_DEVICE(int i) {
+      const T value = T((i * 7919) % 1000) * ((i & 1) ? T(-1) : T(1));
+      RAJA::atomicMin<atomic_policy>(&mins[i % num_addresses], value);
+    });
+    device_sync();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+  free_mins(mins);
+}
+
+template <typename T>
+static void benchmark_cas_min(benchmark::State& state)
+{
+  const int num_addresses = static_cast<int>(state.range(0));
+  T* mins = make_mins<T>(num_addresses);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<exec_policy>(RAJA::RangeSegment(0, N),
+                              [=] RAJA_DEVICE(int i) {
+      const T value = T((i * 7919) % 1000) * ((i & 1) ? T(-1) : T(1));
+      cas_min(&mins[i % num_addresses], value);
+    });
+    device_sync();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+  free_mins(mins);
+}
+
+static void address_counts(benchmark::internal::Benchmark* b)
+{
+  for (int a = 1; a <= (1 << 16); a *= 32) {
+    b->Arg(a);
+  }
+}
+
+BENCHMARK_TEMPLATE(benchmark_atomic_min, float)->Apply(address_counts);
+BENCHMARK_TEMPLATE(benchmark_cas_min, float)->Apply(address_counts);
+BENCHMARK_TEMPLATE(benchmark_atomic_min, double)->Apply(address_counts);
+BENCHMARK_TEMPLATE(benchmark_cas_min, double)->Apply(address_counts);
+
+BENCHMARK_MAIN();
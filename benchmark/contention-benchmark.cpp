@@ -0,0 +1,351 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Strong scaling of reducers and atomics under contention.
+//
+// The OpenMP benchmarks sweep the number of threads and the gpu benchmarks
+// the number of blocks of a launch whose threads stride over the same N
+// iterations. Each loop does a ReduceSum, a ReduceMinLoc, an atomicAdd to 1
+// or to K addresses, or a histogram where most values fall in one bin. The
+// efficiency counter is the time with one worker divided by the time with w
+// workers times w, so 1 is perfect scaling; it is only reported when the
+// run with one worker was done first, as it is without a filter.
+//
+
+#include <chrono>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#define N (1 << 22)
+#define NUM_BINS 256
+
+using clock_type = std::chrono::steady_clock;
+
+static double value_of(int i)
+{
+  return static_cast<double>((i * 7919) % 1000) - 500.0;
+}
+
+// nine in ten values in bin 0, the others spread over all bins
+static int bin_of(int i)
+{
+  const unsigned h = static_cast<unsigned>(i) * 2654435761u;
+  return (h >> 8) % 10 != 0 ? 0 : static_cast<int>(h % NUM_BINS);
+}
+
+// the time per iteration with one worker is kept by each benchmark in base
+static void report_scaling(benchmark::State& state,
+                           double& base,
+                           clock_type::duration elapsed)
+{
+  const int workers = static_cast<int>(state.range(0));
+  const double t =
+      std::chrono::duration<double>(elapsed).count() / state.iterations();
+  if (workers == 1) {
+    base = t;
+  }
+  state.counters["workers"] = workers;
+  if (base > 0.0) {
+    state.counters["efficiency"] = base / (t * workers);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+using omp_exec = RAJA::omp_parallel_for_exec;
+
+template <typename REDUCE_POL>
+static void benchmark_omp_reduce_sum(benchmark::State& state)
+{
+  static double base = 0.0;
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  std::vector<double> vec(N);
+  for (int i = 0; i < N; ++i) vec[i] = value_of(i);
+  const double* data = vec.data();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<REDUCE_POL, double> sum(0.0);
+    RAJA::forall<omp_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                           [=](int i) { sum += data[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  report_scaling(state, base, clock_type::now() - start);
+}
+
+template <typename REDUCE_POL>
+static void benchmark_omp_reduce_minloc(benchmark::State& state)
+{
+  static double base = 0.0;
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  std::vector<double> vec(N);
+  for (int i = 0; i < N; ++i) vec[i] = value_of(i);
+  const double* data = vec.data();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<REDUCE_POL, double> minloc(1.0e30, -1);
+    RAJA::forall<omp_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                           [=](int i) { minloc.minloc(data[i], i); });
+    benchmark::DoNotOptimize(minloc.getLoc());
+  }
+  report_scaling(state, base, clock_type::now() - start);
+}
+
+template <int K>
+static void benchmark_omp_atomic_add(benchmark::State& state)
+{
+  static double base = 0.0;
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  std::vector<int> vec(K, 0);
+  int* counts = vec.data();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    RAJA::forall<omp_exec>(RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+      RAJA::atomicAdd<RAJA::omp_atomic>(&counts[i % K], 1);
+    });
+    benchmark::DoNotOptimize(counts);
+  }
+  report_scaling(state, base, clock_type::now() - start);
+}
+
+static void benchmark_omp_histogram_atomic(benchmark::State& state)
+{
+  static double base = 0.0;
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  std::vector<int> in(N);
+  for (int i = 0; i < N; ++i) in[i] = bin_of(i);
+  std::vector<int> vec(NUM_BINS, 0);
+  const int* bins_of = in.data();
+  int* bins = vec.data();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    RAJA::forall<omp_exec>(RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+      RAJA::atomicAdd<RAJA::omp_atomic>(&bins[bins_of[i]], 1);
+    });
+    benchmark::DoNotOptimize(bins);
+  }
+  report_scaling(state, base, clock_type::now() - start);
+}
+
+static void benchmark_omp_histogram(benchmark::State& state)
+{
+  static double base = 0.0;
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  std::vector<int> in(N);
+  for (int i = 0; i < N; ++i) in[i] = bin_of(i);
+  std::vector<int> vec(NUM_BINS, 0);
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    RAJA::histogram<omp_exec>(RAJA::make_span(in.data(), N), vec.data(),
+                              NUM_BINS, [](int b) { return b; });
+    benchmark::DoNotOptimize(vec.data());
+  }
+  report_scaling(state, base, clock_type::now() - start);
+}
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int t = 1; t < max_threads; t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(max_threads);
+  b->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(benchmark_omp_reduce_sum, RAJA::omp_reduce)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE(benchmark_omp_reduce_sum, RAJA::omp_reduce_ordered)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE(benchmark_omp_reduce_minloc, RAJA::omp_reduce)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE(benchmark_omp_reduce_minloc, RAJA::omp_reduce_ordered)
+    ->Apply(thread_counts);
+BENCHMARK_TEMPLATE(benchmark_omp_atomic_add, 1)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(benchmark_omp_atomic_add, 64)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(benchmark_omp_atomic_add, 4096)->Apply(thread_counts);
+BENCHMARK(benchmark_omp_histogram_atomic)->Apply(thread_counts);
+BENCHMARK(benchmark_omp_histogram)->Apply(thread_counts);
+#endif
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+#define BLOCK_SIZE 256
+
+#if defined(RAJA_ENABLE_CUDA)
+using reduce_policy = RAJA::cuda_reduce;
+using atomic_policy = RAJA::cuda_atomic;
+using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::cuda_launch_t<false>>;
+using teams_policy = RAJA::expt::LoopPolicy<RAJA::cuda_block_x_direct>;
+using threads_policy = RAJA::expt::LoopPolicy<RAJA::cuda_thread_x_direct>;
+
+template <typename T>
+static T* make_array(int n)
+{
+  T* ptr = nullptr;
+  cudaErrchk(cudaMallocManaged(&ptr, n * sizeof(T)));
+  return ptr;
+}
+
+template <typename T>
+static void free_array(T* ptr)
+{
+  cudaErrchk(cudaFree(ptr));
+}
+
+static void device_sync() { cudaErrchk(cudaDeviceSynchronize()); }
+#elif defined(RAJA_ENABLE_HIP)
+using reduce_policy = RAJA::hip_reduce;
+using atomic_policy = RAJA::hip_atomic;
+using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::hip_launch_t<false>>;
+using teams_policy = RAJA::expt::LoopPolicy<RAJA::hip_block_x_direct>;
+using threads_policy = RAJA::expt::LoopPolicy<RAJA::hip_thread_x_direct>;
+
+template <typename T>
+static T* make_array(int n)
+{
+  T* ptr = nullptr;
+  hipErrchk(hipMallocManaged(&ptr, n * sizeof(T)));
+  return ptr;
+}
+
+template <typename T>
+static void free_array(T* ptr)
+{
+  hipErrchk(hipFree(ptr));
+}
+
+static void device_sync() { hipErrchk(hipDeviceSynchronize()); }
+#endif
+
+//
+// Runs body(i) for the N iterations on num_blocks blocks, each thread
+// striding over the iterations by the number of threads of the grid.
+//
+template <typename BODY>
+static void strided_launch(int num_blocks, BODY const& body)
+{
+  RAJA::expt::launch<launch_policy>(
+      RAJA::expt::Grid(RAJA::expt::Teams(num_blocks),
+                       RAJA::expt::Threads(BLOCK_SIZE)),
+      [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+        RAJA::expt::loop<teams_policy>(
+            ctx, RAJA::TypedRangeSegment<int>(0, num_blocks), [&](int b) {
+              RAJA::expt::loop<threads_policy>(
+                  ctx, RAJA::TypedRangeSegment<int>(0, BLOCK_SIZE), [&](int t) {
+                    for (int i = b * BLOCK_SIZE + t; i < N;
+                         i += num_blocks * BLOCK_SIZE) {
+                      body(i);
+                    }
+                  });
+            });
+      });
+}
+
+static void benchmark_gpu_reduce_sum(benchmark::State& state)
+{
+  static double base = 0.0;
+  const int num_blocks = static_cast<int>(state.range(0));
+  double* data = make_array<double>(N);
+  for (int i = 0; i < N; ++i) data[i] = value_of(i);
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+    strided_launch(num_blocks,
+                   [=] RAJA_DEVICE(int i) { sum += data[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  report_scaling(state, base, clock_type::now() - start);
+  free_array(data);
+}
+
+static void benchmark_gpu_reduce_minloc(benchmark::State& state)
+{
+  static double base = 0.0;
+  const int num_blocks = static_cast<int>(state.range(0));
+  double* data = make_array<double>(N);
+  for (int i = 0; i < N; ++i) data[i] = value_of(i);
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<reduce_policy, double> minloc(1.0e30, -1);
+    strided_launch(num_blocks,
+                   [=] RAJA_DEVICE(int i) { minloc.minloc(data[i], i); });
+    benchmark::DoNotOptimize(minloc.getLoc());
+  }
+  report_scaling(state, base, clock_type::now() - start);
+  free_array(data);
+}
+
+template <int K>
+static void benchmark_gpu_atomic_add(benchmark::State& state)
+{
+  static double base = 0.0;
+  const int num_blocks = static_cast<int>(state.range(0));
+  int* counts = make_array<int>(K);
+  for (int k = 0; k < K; ++k) counts[k] = 0;
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    strided_launch(num_blocks, [=] RAJA_DEVICE(int i) {
+      RAJA::atomicAdd<atomic_policy>(&counts[i % K], 1);
+    });
+    device_sync();
+  }
+  report_scaling(state, base, clock_type::now() - start);
+  free_array(counts);
+}
+
+static void benchmark_gpu_histogram_atomic(benchmark::State& state)
+{
+  static double base = 0.0;
+  const int num_blocks = static_cast<int>(state.range(0));
+  int* bins_of = make_array<int>(N);
+  for (int i = 0; i < N; ++i) bins_of[i] = bin_of(i);
+  int* bins = make_array<int>(NUM_BINS);
+  for (int b = 0; b < NUM_BINS; ++b) bins[b] = 0;
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    strided_launch(num_blocks, [=] RAJA_DEVICE(int i) {
+      RAJA::atomicAdd<atomic_policy>(&bins[bins_of[i]], 1);
+    });
+    device_sync();
+  }
+  report_scaling(state, base, clock_type::now() - start);
+  free_array(bins);
+  free_array(bins_of);
+}
+
+static void block_counts(benchmark::internal::Benchmark* b)
+{
+  for (int blocks = 1; blocks <= N / BLOCK_SIZE; blocks *= 4) {
+    b->Arg(blocks);
+  }
+  b->UseRealTime();
+}
+
+BENCHMARK(benchmark_gpu_reduce_sum)->Apply(block_counts);
+BENCHMARK(benchmark_gpu_reduce_minloc)->Apply(block_counts);
+BENCHMARK_TEMPLATE(benchmark_gpu_atomic_add, 1)->Apply(block_counts);
+BENCHMARK_TEMPLATE(benchmark_gpu_atomic_add, 64)->Apply(block_counts);
+BENCHMARK_TEMPLATE(benchmark_gpu_atomic_add, 4096)->Apply(block_counts);
+BENCHMARK(benchmark_gpu_histogram_atomic)->Apply(block_counts);
+#endif
+
+BENCHMARK_MAIN();
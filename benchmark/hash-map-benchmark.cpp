@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Insert and find throughput of ConcurrentHashMap, on the gpu when one is
+// enabled and with OpenMP otherwise.  The argument is the number of unique
+// keys among the N inserted, so small arguments have many threads inserting
+// the same keys and large ones fill the map to its maximum load factor.
+//
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N (1 << 22)
+
+#if defined(RAJA_ENABLE_CUDA)
+using exec_policy = RAJA::cuda_exec<256>;
+using atomic_policy = RAJA::cuda_atomic;
+using mempool_type = RAJA::cuda::device_mempool_type;
+
+static void device_sync() { cudaDeviceSynchronize(); }
+#elif defined(RAJA_ENABLE_HIP)
+using exec_policy = RAJA::hip_exec<256>;
+using atomic_policy = RAJA::hip_atomic;
+using mempool_type = RAJA::hip::device_mempool_type;
+
+static void device_sync() { hipDeviceSynchronize(); }
+#else
+using exec_policy = RAJA::omp_parallel_for_exec;
+using atomic_policy = RAJA::omp_atomic;
+using mempool_type =
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+
+static void device_sync() {}
+#endif
+
+using map_type = RAJA::ConcurrentHashMap<long long,
+                                         int,
+                                         exec_policy,
+                                         atomic_policy,
+                                         mempool_type>;
+
+static void benchmark_insert(benchmark::State& state)
+{
+  const long long num_unique = state.range(0);
+  map_type map(static_cast<size_t>(num_unique / map_type::max_load_factor));
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    map.clear();
+    device_sync();
+    state.ResumeTiming();
+
+    auto view = map.view();
+    RAJA::forall<exec_policy>(RAJA::RangeSegment(0, N),
+                              [=] RAJA_HOST_DEVICE(int i) {
+      view.insert((i * 7919LL) % num_unique, i);
+    });
+    device_sync();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+static void benchmark_insert_or_add(benchmark::State& state)
+{
+  const long long num_unique = state.range(0);
+  map_type map(static_cast<size_t>(num_unique / map_type::max_load_factor));
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    map.clear();
+    device_sync();
+    state.ResumeTiming();
+
+    auto view = map.view();
+    RAJA::forall<exec_policy>(RAJA::RangeSegment(0, N),
+                              [=] RAJA_HOST_DEVICE(int i) {
+      view.insert_or_add((i * 7919LL) % num_unique, 1);
+    });
+    device_sync();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+static void benchmark_find(benchmark::State& state)
+{
+  const long long num_unique = state.range(0);
+  map_type map(static_cast<size_t>(num_unique / map_type::max_load_factor));
+
+  auto view = map.view();
+  RAJA::forall<exec_policy>(RAJA::TypedRangeSegment<long long>(0, num_unique),
+                            [=] RAJA_HOST_DEVICE(long long k) {
+    view.insert(k, 1);
+  });
+  device_sync();
+
+  int* found = nullptr;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaMalloc(&found, N * sizeof(int));
+#elif defined(RAJA_ENABLE_HIP)
+  hipMalloc(&found, N * sizeof(int));
+#else
+  found = new int[N];
+#endif
+
+  while (state.KeepRunning()) {
+    RAJA::forall<exec_policy>(RAJA::RangeSegment(0, N),
+                              [=] RAJA_HOST_DEVICE(int i) {
+      found[i] = view.contains((i * 7919LL) % (2 * num_unique)) ? 1 : 0;
+    });
+    device_sync();
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+
+#if defined(RAJA_ENABLE_CUDA)
+  cudaFree(found);
+#elif defined(RAJA_ENABLE_HIP)
+  hipFree(found);
+#else
+  delete[] found;
+#endif
+}
+
+static void unique_key_counts(benchmark::internal::Benchmark* b)
+{
+  for (int k = 1; k <= (1 << 22); k *= 32) {
+    b->Arg(k);
+  }
+}
+
+BENCHMARK(benchmark_insert)->Apply(unique_key_counts);
+BENCHMARK(benchmark_insert_or_add)->Apply(unique_key_counts);
+BENCHMARK(benchmark_find)->Apply(unique_key_counts);
+
+BENCHMARK_MAIN();
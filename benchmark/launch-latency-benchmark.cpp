@@ -0,0 +1,282 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Launch latency of the gpu policies with empty loop bodies.
+//
+// The host variants time only the call that issues the launch and wait
+// for the device outside of the timed region, so they give the host cost
+// per launch. The latency variants time the call and the wait, so they
+// give the end-to-end latency of a launch. The argument is the number of
+// iterations, 1 for a single thread. The reducer variants include the
+// construction, the get and the destruction of a ReduceSum. Compare all
+// with the raw kernel launch.
+//
+
+#include <chrono>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+using async_exec = RAJA::cuda_exec_async<256>;
+using sync_exec = RAJA::cuda_exec<256>;
+using reduce_policy = RAJA::cuda_reduce;
+
+using kernel_policy = RAJA::KernelPolicy<
+    RAJA::statement::CudaKernelAsync<
+      RAJA::statement::Tile<0, RAJA::tile_fixed<256>, RAJA::cuda_block_x_loop,
+        RAJA::statement::For<0, RAJA::cuda_thread_x_direct,
+          RAJA::statement::Lambda<0>>>>>;
+
+using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::cuda_launch_t<true>>;
+using teams_policy = RAJA::expt::LoopPolicy<RAJA::cuda_block_x_direct>;
+using threads_policy = RAJA::expt::LoopPolicy<RAJA::cuda_thread_x_direct>;
+
+using workgroup_policy = RAJA::WorkGroupPolicy<
+    RAJA::cuda_work_async<256>,
+    RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+    RAJA::constant_stride_array_of_objects>;
+
+// the bounds check of the RAJA loops around an empty body
+__global__ void raw_kernel(int n)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < n) {
+  }
+}
+
+static void raw_launch(int n) { raw_kernel<<<(n + 255) / 256, 256>>>(n); }
+
+static void device_sync() { cudaErrchk(cudaDeviceSynchronize()); }
+
+template <typename T>
+struct pinned_allocator
+{
+  using value_type = T;
+
+  pinned_allocator() = default;
+
+  template <typename U>
+  constexpr pinned_allocator(pinned_allocator<U> const&) noexcept
+  { }
+
+  value_type* allocate(size_t num)
+  {
+    value_type* ptr = nullptr;
+    cudaErrchk(cudaMallocHost((void**)&ptr, num * sizeof(value_type)));
+    return ptr;
+  }
+
+  void deallocate(value_type* ptr, size_t) noexcept
+  {
+    cudaErrchk(cudaFreeHost(ptr));
+  }
+};
+#elif defined(RAJA_ENABLE_HIP)
+using async_exec = RAJA::hip_exec_async<256>;
+using sync_exec = RAJA::hip_exec<256>;
+using reduce_policy = RAJA::hip_reduce;
+
+using kernel_policy = RAJA::KernelPolicy<
+    RAJA::statement::HipKernelAsync<
+      RAJA::statement::Tile<0, RAJA::tile_fixed<256>, RAJA::hip_block_x_loop,
+        RAJA::statement::For<0, RAJA::hip_thread_x_direct,
+          RAJA::statement::Lambda<0>>>>>;
+
+using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::hip_launch_t<true>>;
+using teams_policy = RAJA::expt::LoopPolicy<RAJA::hip_block_x_direct>;
+using threads_policy = RAJA::expt::LoopPolicy<RAJA::hip_thread_x_direct>;
+
+using workgroup_policy = RAJA::WorkGroupPolicy<
+    RAJA::hip_work_async<256>,
+    RAJA::unordered_hip_loop_y_block_iter_x_threadblock_average,
+    RAJA::constant_stride_array_of_objects>;
+
+// the bounds check of the RAJA loops around an empty body
+__global__ void raw_kernel(int n)
+{
+  const int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < n) {
+  }
+}
+
+static void raw_launch(int n)
+{
+  hipLaunchKernelGGL(raw_kernel, dim3((n + 255) / 256), dim3(256), 0, 0, n);
+}
+
+static void device_sync() { hipErrchk(hipDeviceSynchronize()); }
+
+template <typename T>
+struct pinned_allocator
+{
+  using value_type = T;
+
+  pinned_allocator() = default;
+
+  template <typename U>
+  constexpr pinned_allocator(pinned_allocator<U> const&) noexcept
+  { }
+
+  value_type* allocate(size_t num)
+  {
+    value_type* ptr = nullptr;
+    hipErrchk(hipHostMalloc((void**)&ptr, num * sizeof(value_type)));
+    return ptr;
+  }
+
+  void deallocate(value_type* ptr, size_t) noexcept
+  {
+    hipErrchk(hipHostFree(ptr));
+  }
+};
+#endif
+
+template <typename T, typename U>
+bool operator==(pinned_allocator<T> const&, pinned_allocator<U> const&)
+{
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(pinned_allocator<T> const& lhs, pinned_allocator<U> const& rhs)
+{
+  return !(lhs == rhs);
+}
+
+using workpool = RAJA::WorkPool<workgroup_policy, int, RAJA::xargs<>,
+                                pinned_allocator<char>>;
+using workgroup = RAJA::WorkGroup<workgroup_policy, int, RAJA::xargs<>,
+                                  pinned_allocator<char>>;
+using worksite = RAJA::WorkSite<workgroup_policy, int, RAJA::xargs<>,
+                                pinned_allocator<char>>;
+
+//
+// Launches with empty bodies, each a functor taking the number of
+// iterations.
+//
+struct raw_op {
+  void operator()(int n) const { raw_launch(n); }
+};
+
+struct forall_async_op {
+  void operator()(int n) const
+  {
+    RAJA::forall<async_exec>(RAJA::TypedRangeSegment<int>(0, n),
+                             [=] RAJA_DEVICE(int) {});
+  }
+};
+
+// waits in the forall, so the host time includes the wait
+struct forall_sync_op {
+  void operator()(int n) const
+  {
+    RAJA::forall<sync_exec>(RAJA::TypedRangeSegment<int>(0, n),
+                            [=] RAJA_DEVICE(int) {});
+  }
+};
+
+struct kernel_op {
+  void operator()(int n) const
+  {
+    RAJA::kernel<kernel_policy>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, n)),
+        [=] RAJA_DEVICE(int) {});
+  }
+};
+
+struct launch_op {
+  void operator()(int n) const
+  {
+    const int num_teams = (n + 255) / 256;
+    RAJA::expt::launch<launch_policy>(
+        RAJA::expt::Grid(RAJA::expt::Teams(num_teams),
+                         RAJA::expt::Threads(256)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+          RAJA::expt::loop<teams_policy>(
+              ctx, RAJA::TypedRangeSegment<int>(0, num_teams), [&](int) {
+                RAJA::expt::loop<threads_policy>(
+                    ctx, RAJA::TypedRangeSegment<int>(0, 256), [&](int) {});
+              });
+        });
+  }
+};
+
+// enqueue, instantiate and run a group of LOOPS loops
+template <int LOOPS>
+struct workgroup_op {
+  void operator()(int n) const
+  {
+    for (int l = 0; l < LOOPS; ++l) {
+      pool.enqueue(RAJA::TypedRangeSegment<int>(0, n), [=] RAJA_DEVICE(int) {});
+    }
+    workgroup group = pool.instantiate();
+    worksite site = group.run();
+  }
+
+  mutable workpool pool{pinned_allocator<char>{}};
+};
+
+// construct a ReduceSum, reduce nothing into it, get it and destroy it
+struct reducer_op {
+  void operator()(int n) const
+  {
+    RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+    RAJA::forall<async_exec>(RAJA::TypedRangeSegment<int>(0, n),
+                             [=] RAJA_DEVICE(int) { sum += 0.0; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+};
+
+template <typename OP>
+static void benchmark_host(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  OP op;
+  op(n);
+  device_sync();
+
+  while (state.KeepRunning()) {
+    const auto start = std::chrono::steady_clock::now();
+    op(n);
+    const auto stop = std::chrono::steady_clock::now();
+    device_sync();
+    state.SetIterationTime(std::chrono::duration<double>(stop - start).count());
+  }
+}
+
+template <typename OP>
+static void benchmark_latency(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  OP op;
+  op(n);
+  device_sync();
+
+  while (state.KeepRunning()) {
+    op(n);
+    device_sync();
+  }
+}
+
+#define LATENCY_BENCHMARKS(op)                                   \
+  BENCHMARK_TEMPLATE(benchmark_host, op)                         \
+      ->Arg(1)->Arg(1 << 16)->UseManualTime();                   \
+  BENCHMARK_TEMPLATE(benchmark_latency, op)                      \
+      ->Arg(1)->Arg(1 << 16)->UseRealTime();
+
+LATENCY_BENCHMARKS(raw_op)
+LATENCY_BENCHMARKS(forall_async_op)
+LATENCY_BENCHMARKS(forall_sync_op)
+LATENCY_BENCHMARKS(kernel_op)
+LATENCY_BENCHMARKS(launch_op)
+LATENCY_BENCHMARKS(workgroup_op<1>)
+LATENCY_BENCHMARKS(workgroup_op<16>)
+LATENCY_BENCHMARKS(reducer_op)
+
+BENCHMARK_MAIN();
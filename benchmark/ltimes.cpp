@@ -23,6 +23,9 @@
 #define VARIANT_RAJA_VECTOR          1
 #define VARIANT_RAJA_MATRIX          1
 #define VARIANT_RAJA_SEQ_SHMEM       1
+#define VARIANT_RAJA_TEAMS_SHMEM     1
+#define VARIANT_RAJA_TEAMS_MATRIX    1
+#define VARIANT_RAJA_LAYOUT_SWEEP    1
 
 #if defined(RAJA_ENABLE_OPENMP)
 #define VARIANT_RAJA_OPENMP          1
@@ -33,11 +36,15 @@
 #define VARIANT_CUDA_TEAMS           1
 #define VARIANT_CUDA_TEAMS_MATRIX    1
 #define VARIANT_CUDA_KERNEL_SHMEM    1
+#define VARIANT_CUDA_TEAMS_SHMEM     1
+#define VARIANT_CUDA_LAYOUT_SWEEP    1
 #endif
 
 #if defined(RAJA_ENABLE_HIP)
 #define RAJA_HIP_KERNEL              1
 #define RAJA_HIP_KERNEL_SHMEM        1
+#define RAJA_HIP_TEAMS_SHMEM         1
+#define RAJA_HIP_LAYOUT_SWEEP        1
 #endif
 
 
@@ -49,10 +56,14 @@ extern "C" {
               double *, int * ldc);
 }
 
+#include <algorithm>
+#include <array>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <cmath>
+#include <string>
 #include <vector>
 
 #include "RAJA/RAJA.hpp"
@@ -86,6 +97,13 @@ extern "C" {
  *    - Use of 'RAJA::kernel' abstractions for nested loops, including
  *      loop-level ordering changes, use of GPU shared memory, other
  *      RAJA 'statement' concepts
+ *    - Use of 'RAJA::launch' with shared memory tiling and tensor
+ *      MatrixRegisters, and sweeps over the layouts of psi and phi
+ *
+ *  Each variant reports its achieved GFLOPS/sec and GB/sec, and how close
+ *  it comes to a roofline of the peak flop rate and memory bandwidth
+ *  measured on its back-end. All results are written to a JSON file, given
+ *  as the first argument or ltimes.json by default.
  *
  *  Note that calls to the checkResult() method after each variant is run
  *  are turned off so the example code runs much faster. If you want 
@@ -122,11 +140,288 @@ void checkResult(PHIVIEW_T& phi, LVIEW_T& L, PSIVIEW_T& psi,
                  const int num_z);
 
 
+//
+// Peak flop rate and memory bandwidth measured on one back-end, the
+// roofline the variants that run there are compared to
+//
+struct Roofline {
+  std::string name;
+  double gflops;
+  double bandwidth;
+};
+
+//
+// Achieved rates of one variant, and the rate the roofline allows at the
+// arithmetic intensity of LTimes
+//
+struct LTimesResult {
+  std::string variant;
+  std::string layout;
+  std::string roofline;
+  double seconds;
+  double gflops;
+  double bandwidth;
+  double roofline_gflops;
+};
+
+//
+// Collects the results of the variants, prints how close each one is to
+// its roofline, and writes them all to a JSON file at the end
+//
+struct LTimesReport {
+  double flops;  // flops of all iterations of one variant
+  double bytes;  // bytes of all iterations, each array moved once
+  std::vector<Roofline> rooflines;
+  std::vector<LTimesResult> results;
+
+  void add(const char* variant, const std::string& layout,
+           const Roofline& roof, double t)
+  {
+    LTimesResult r;
+    r.variant = variant;
+    r.layout = layout;
+    r.roofline = roof.name;
+    r.seconds = t;
+    r.gflops = flops / t / 1.0e9;
+    r.bandwidth = bytes / t / 1.0e9;
+    r.roofline_gflops = std::min(roof.gflops, flops / bytes * roof.bandwidth);
+
+    std::cout << "  achieved GB/sec: " << r.bandwidth << ", "
+              << 100.0 * r.gflops / r.roofline_gflops << "% of the "
+              << roof.name << " roofline (" << r.roofline_gflops
+              << " GFLOPS/sec)" << std::endl;
+
+    results.push_back(r);
+  }
+
+  void write(const char* path, int num_m, int num_d, int num_g, int num_z,
+             int num_iter) const
+  {
+    std::ofstream out(path);
+    out << "{\n";
+    out << "  \"num_m\": " << num_m << ", \"num_d\": " << num_d
+        << ", \"num_g\": " << num_g << ", \"num_z\": " << num_z
+        << ", \"num_iter\": " << num_iter << ",\n";
+    out << "  \"flops\": " << flops << ", \"bytes\": " << bytes << ",\n";
+
+    out << "  \"rooflines\": [\n";
+    for (size_t i = 0; i < rooflines.size(); ++i) {
+      const Roofline& roof = rooflines[i];
+      out << "    {\"name\": \"" << roof.name << "\", \"gflops\": "
+          << roof.gflops << ", \"bandwidth_gbs\": " << roof.bandwidth << "}"
+          << (i + 1 < rooflines.size() ? "," : "") << "\n";
+    }
+    out << "  ],\n";
+
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+      const LTimesResult& r = results[i];
+      out << "    {\"variant\": \"" << r.variant << "\", \"layout\": \""
+          << r.layout << "\", \"roofline\": \"" << r.roofline
+          << "\", \"seconds\": " << r.seconds << ", \"gflops\": " << r.gflops
+          << ", \"bandwidth_gbs\": " << r.bandwidth
+          << ", \"roofline_gflops\": " << r.roofline_gflops
+          << ", \"fraction_of_roofline\": " << r.gflops / r.roofline_gflops
+          << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+
+    std::cout << "\n Results written to " << path << "\n";
+  }
+};
+
+//
+// Measures the roofline of EXEC_POL with arrays a, b and c of n values in
+// its memory space: the bandwidth of the best of several triads, and the
+// flop rate of the best of several runs of independent chains of
+// multiply-adds held in registers. EXEC_POL must be synchronous.
+//
+template <typename EXEC_POL>
+Roofline measureRoofline(const char* name, double* a, double* b, double* c,
+                         int n)
+{
+  constexpr int num_reps = 5;
+  constexpr int num_chains = 8;
+  constexpr int chain_length = 256;
+
+  RAJA::TypedRangeSegment<int> seg(0, n);
+
+  RAJA::forall<EXEC_POL>(seg, [=] RAJA_HOST_DEVICE (int i) {
+    a[i] = 0.0;
+    b[i] = 1.0;
+    c[i] = 2.0;
+  });
+
+  double bandwidth = 0.0;
+  for (int rep = 0; rep < num_reps; ++rep) {
+    RAJA::Timer timer;
+    timer.start();
+    RAJA::forall<EXEC_POL>(seg, [=] RAJA_HOST_DEVICE (int i) {
+      a[i] = b[i] + 0.5 * c[i];
+    });
+    timer.stop();
+    bandwidth = std::max(bandwidth,
+                         3.0 * sizeof(double) * n / timer.elapsed() / 1.0e9);
+  }
+
+  double gflops = 0.0;
+  for (int rep = 0; rep < num_reps; ++rep) {
+    RAJA::Timer timer;
+    timer.start();
+    RAJA::forall<EXEC_POL>(seg, [=] RAJA_HOST_DEVICE (int i) {
+      double v[num_chains];
+      for (int k = 0; k < num_chains; ++k) {
+        v[k] = b[i] + k;
+      }
+      for (int f = 0; f < chain_length; ++f) {
+        for (int k = 0; k < num_chains; ++k) {
+          v[k] = v[k] * 0.999 + 0.001;
+        }
+      }
+      double sum = 0.0;
+      for (int k = 0; k < num_chains; ++k) {
+        sum += v[k];
+      }
+      a[i] = sum;
+    });
+    timer.stop();
+    gflops = std::max(gflops, 2.0 * num_chains * chain_length * n /
+                                  timer.elapsed() / 1.0e9);
+  }
+
+  std::cout << "  " << name << " roofline: " << gflops << " GFLOPS/sec, "
+            << bandwidth << " GB/sec" << std::endl;
+
+  return Roofline{name, gflops, bandwidth};
+}
+
+//
+// The name of a permutation of the (d or m, g, z) dimensions of psi and
+// phi, listed from the slowest to the fastest one
+//
+std::string permutationName(const std::array<RAJA::idx_t, 3>& perm)
+{
+  const char dims[] = {'d', 'g', 'z'};
+  std::string name;
+  for (RAJA::idx_t p : perm) {
+    name += dims[p];
+  }
+  return name;
+}
+
+//
+// LTimes with RAJA::launch, each thread accumulating one phi(m, g, z).
+// Used to sweep over the layouts of psi and phi.
+//
+template <typename LAUNCH_POL, typename POL_G, typename POL_Z, typename POL_M,
+          typename LVIEW_T, typename PSIVIEW_T, typename PHIVIEW_T>
+void ltimesLaunch(RAJA::ExecPlace place, const RAJA::Grid& grid,
+                  LVIEW_T L, PSIVIEW_T psi, PHIVIEW_T phi,
+                  const int num_m, const int num_d,
+                  const int num_g, const int num_z)
+{
+  RAJA::launch<LAUNCH_POL>(place, grid,
+      [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx)
+  {
+    RAJA::loop<POL_G>(ctx, RAJA::TypedRangeSegment<IG>(0, num_g), [&](IG g){
+      RAJA::loop<POL_Z>(ctx, RAJA::TypedRangeSegment<IZ>(0, num_z), [&](IZ z){
+        RAJA::loop<POL_M>(ctx, RAJA::TypedRangeSegment<IM>(0, num_m), [&](IM m){
+
+          double acc = phi(m, g, z);
+          for (ID d(0); d < num_d; ++d) {
+            acc += L(m, d) * psi(d, g, z);
+          }
+          phi(m, g, z) = acc;
+
+        });
+      });
+    });
+  });
+}
+
+//
+// LTimes with RAJA::launch and shared memory tiling. Each team stages all
+// of L in shared memory once, then loops over tiles of ltimes_tile_z zones
+// of a group, staging psi for the tile before the threads of the team
+// accumulate phi for it. POL_TY and POL_TX are the thread loops of the
+// team, POL_G and POL_TZ the team loops over groups and tiles of zones.
+//
+constexpr int ltimes_tile_z = 32;
+
+template <typename LAUNCH_POL, typename POL_G, typename POL_TZ,
+          typename POL_TY, typename POL_TX,
+          typename LVIEW_T, typename PSIVIEW_T, typename PHIVIEW_T>
+void ltimesLaunchShmem(RAJA::ExecPlace place, const int num_teams_z,
+                       LVIEW_T L, PSIVIEW_T psi, PHIVIEW_T phi,
+                       const int num_m, const int num_d,
+                       const int num_g, const int num_z)
+{
+  const size_t shmem =
+      sizeof(double) * (num_m * num_d + num_d * ltimes_tile_z);
+
+  RAJA::launch<LAUNCH_POL>(place,
+      RAJA::Grid(RAJA::Teams(num_g, num_teams_z),
+                 RAJA::Threads(ltimes_tile_z, 8),
+                 RAJA::DynamicMem(shmem)),
+      [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx)
+  {
+    using LShView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+    using PsiShView = TypedView<double, Layout<2, int, 1>, ID, IZ>;
+
+    LShView L_sh(ctx.getSharedMemory<double>(num_m * num_d), num_m, num_d);
+    PsiShView psi_sh(ctx.getSharedMemory<double>(num_d * ltimes_tile_z),
+                     num_d, ltimes_tile_z);
+
+    RAJA::loop<POL_TY>(ctx, RAJA::TypedRangeSegment<IM>(0, num_m), [&](IM m){
+      RAJA::loop<POL_TX>(ctx, RAJA::TypedRangeSegment<ID>(0, num_d), [&](ID d){
+        L_sh(m, d) = L(m, d);
+      });
+    });
+
+    RAJA::loop<POL_G>(ctx, RAJA::TypedRangeSegment<IG>(0, num_g), [&](IG g){
+      RAJA::tile<POL_TZ>(ctx, ltimes_tile_z, RAJA::TypedRangeSegment<int>(0, num_z),
+          [&](RAJA::TypedRangeSegment<int> tz){
+
+        const int z0 = *tz.begin();
+        const int len = static_cast<int>(tz.size());
+
+        // the tile before is done with psi_sh, and L_sh is loaded
+        ctx.teamSync();
+
+        RAJA::loop<POL_TY>(ctx, RAJA::TypedRangeSegment<ID>(0, num_d), [&](ID d){
+          RAJA::loop<POL_TX>(ctx, RAJA::TypedRangeSegment<IZ>(0, len), [&](IZ zl){
+            psi_sh(d, zl) = psi(d, g, IZ(z0 + *zl));
+          });
+        });
+
+        ctx.teamSync();
+
+        RAJA::loop<POL_TY>(ctx, RAJA::TypedRangeSegment<IM>(0, num_m), [&](IM m){
+          RAJA::loop<POL_TX>(ctx, RAJA::TypedRangeSegment<IZ>(0, len), [&](IZ zl){
+
+            const IZ z(z0 + *zl);
+            double acc = phi(m, g, z);
+            for (ID d(0); d < num_d; ++d) {
+              acc += L_sh(m, d) * psi_sh(d, zl);
+            }
+            phi(m, g, z) = acc;
+
+          });
+        });
+      });
+    });
+  });
+}
 
-int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
+
+
+int main(int argc, char **argv)
 {
   std::cout << "\n\nRAJA LTIMES example...\n\n";
 
+  const char* json_path = argc > 1 ? argv[1] : "ltimes.json";
+
 //----------------------------------------------------------------------------//
 // Define array dimensions, allocate arrays, define Layouts and Views, etc.
   // Note: rand()/RAND_MAX is always zero, but forces the compiler to not
@@ -148,7 +443,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
 
 
-  double total_flops = 2.0*num_g*num_z*num_d*num_m*num_iter*1000.0;
+  double total_flops = 2.0*num_g*num_z*num_d*num_m*num_iter;
 
   std::cout << "num_m = " << num_m << ", num_g = " << num_g <<
                ", num_d = " << num_d << ", num_z = " << num_z << "\n\n";
@@ -178,6 +473,64 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   // Note phi_data will be set to zero before each variant is run.
 
 
+//----------------------------------------------------------------------------//
+// Measure the rooflines of the back-ends the variants run on
+
+  LTimesReport report;
+  report.flops = total_flops;
+  report.bytes = sizeof(double) * (L_size + psi_size + 2.0*phi_size) * num_iter;
+
+  std::cout << "\n Measuring rooflines...\n";
+
+  const int roof_n = 1 << 24;
+
+  Roofline host_roof;
+#if defined(RAJA_ENABLE_OPENMP)
+  Roofline omp_roof;
+#endif
+  {
+    std::vector<double> a(roof_n), b(roof_n), c(roof_n);
+    host_roof = measureRoofline<RAJA::loop_exec>(
+        "host", a.data(), b.data(), c.data(), roof_n);
+    report.rooflines.push_back(host_roof);
+#if defined(RAJA_ENABLE_OPENMP)
+    omp_roof = measureRoofline<RAJA::omp_parallel_for_exec>(
+        "openmp", a.data(), b.data(), c.data(), roof_n);
+    report.rooflines.push_back(omp_roof);
+#endif
+  }
+
+#if defined(RAJA_ENABLE_CUDA)
+  Roofline cuda_roof;
+  {
+    double *a, *b, *c;
+    cudaErrchk( cudaMalloc( (void**)&a, roof_n * sizeof(double) ) );
+    cudaErrchk( cudaMalloc( (void**)&b, roof_n * sizeof(double) ) );
+    cudaErrchk( cudaMalloc( (void**)&c, roof_n * sizeof(double) ) );
+    cuda_roof = measureRoofline<RAJA::cuda_exec<256>>("cuda", a, b, c, roof_n);
+    report.rooflines.push_back(cuda_roof);
+    cudaErrchk( cudaFree( a ) );
+    cudaErrchk( cudaFree( b ) );
+    cudaErrchk( cudaFree( c ) );
+  }
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+  Roofline hip_roof;
+  {
+    double *a, *b, *c;
+    hipErrchk( hipMalloc( (void**)&a, roof_n * sizeof(double) ) );
+    hipErrchk( hipMalloc( (void**)&b, roof_n * sizeof(double) ) );
+    hipErrchk( hipMalloc( (void**)&c, roof_n * sizeof(double) ) );
+    hip_roof = measureRoofline<RAJA::hip_exec<256>>("hip", a, b, c, roof_n);
+    report.rooflines.push_back(hip_roof);
+    hipErrchk( hipFree( a ) );
+    hipErrchk( hipFree( b ) );
+    hipErrchk( hipFree( c ) );
+  }
+#endif
+
+
 //----------------------------------------------------------------------------//
 
 #if VARIANT_C
@@ -217,6 +570,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  C-version of LTimes run time (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("c", "gzd", host_roof, t);
 
 }
 #endif
@@ -273,6 +627,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  C-version of LTimes run time (with Views) (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("c_views", permutationName(psi_perm), host_roof, t);
 
 
 #if defined(DEBUG_LTIMES)
@@ -346,6 +701,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA sequential version of LTimes run time (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_seq", permutationName(psi_perm), host_roof, t);
 
 
 #if defined(DEBUG_LTIMES)
@@ -419,6 +775,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA sequential ARGS version of LTimes run time (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_seq_args", permutationName(psi_perm), host_roof, t);
 
 
 #if defined(DEBUG_LTIMES)
@@ -493,6 +850,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA Teams sequential version of LTimes run time (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_teams_seq", permutationName(psi_perm), host_roof, t);
 
 
 #if defined(DEBUG_LTIMES)
@@ -578,6 +936,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA vectorized version of LTimes run time (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_vector", permutationName(psi_perm), host_roof, t);
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
   RAJA::tensor_stats::printVectorStats();
@@ -673,6 +1032,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA column-major matrix version of LTimes run time (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_matrix_col", permutationName(psi_perm), host_roof, t);
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
   RAJA::tensor_stats::printVectorStats();
@@ -761,6 +1121,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA row-major matrix version of LTimes run time (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_matrix_row", permutationName(psi_perm), host_roof, t);
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
   RAJA::tensor_stats::printVectorStats();
@@ -973,6 +1334,70 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA sequential shmem version of LTimes run time (sec.): "
             << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_seq_shmem", permutationName(psi_perm), host_roof, t);
+
+
+#if defined(DEBUG_LTIMES)
+  checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+#endif
+}
+#endif
+
+
+//----------------------------------------------------------------------------//
+
+#if VARIANT_RAJA_TEAMS_SHMEM
+{
+  std::cout << "\n Running RAJA Teams sequential shmem version of LTimes...\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+
+  // psi(d, g, z) : 2 -> z is stride-1 dimension
+  using PsiView = TypedView<double, Layout<3, int, 2>, ID, IG, IZ>;
+
+  // phi(m, g, z) : 2 -> z is stride-1 dimension
+  using PhiView = TypedView<double, Layout<3, int, 2>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{0, 1}};
+  LView L(L_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  std::array<RAJA::idx_t, 3> psi_perm {{0, 1, 2}};
+  PsiView psi(psi_data,
+              RAJA::make_permuted_layout({{num_d, num_g, num_z}}, psi_perm));
+
+  std::array<RAJA::idx_t, 3> phi_perm {{0, 1, 2}};
+  PhiView phi(phi_data,
+              RAJA::make_permuted_layout({{num_m, num_g, num_z}}, phi_perm));
+
+
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec>;
+  using pol_tz = RAJA::LoopPolicy<RAJA::loop_exec>;
+  using pol_ty = RAJA::LoopPolicy<RAJA::loop_exec>;
+  using pol_tx = RAJA::LoopPolicy<RAJA::loop_exec>;
+
+
+  RAJA::Timer timer;
+  timer.start();
+
+  for (int iter = 0;iter < num_iter;++ iter){
+    ltimesLaunchShmem<pol_launch, pol_g, pol_tz, pol_ty, pol_tx>(
+        RAJA::HOST, 1, L, psi, phi, num_m, num_d, num_g, num_z);
+  }
+
+  timer.stop();
+  double t = timer.elapsed();
+  double gflop_rate = total_flops / t / 1.0e9;
+  std::cout << "  RAJA Teams sequential shmem version of LTimes run time (sec.): "
+            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_teams_seq_shmem", permutationName(psi_perm), host_roof, t);
 
 
 #if defined(DEBUG_LTIMES)
@@ -983,6 +1408,68 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
 //----------------------------------------------------------------------------//
 
+#if VARIANT_RAJA_LAYOUT_SWEEP
+{
+  std::cout << "\n Running RAJA Teams sequential layout sweep of LTimes...\n";
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+
+  // psi(d, g, z) and phi(m, g, z) have no fixed stride-1 dimension, so
+  // every permutation of the sweep can be used
+  using PsiView = TypedView<double, Layout<3, int>, ID, IG, IZ>;
+  using PhiView = TypedView<double, Layout<3, int>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{0, 1}};
+  LView L(L_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  const std::array<RAJA::idx_t, 3> sweep_perms[] = {
+      {{0, 1, 2}}, {{0, 2, 1}}, {{1, 0, 2}},
+      {{1, 2, 0}}, {{2, 0, 1}}, {{2, 1, 0}}};
+
+
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec>;
+  using pol_z = RAJA::LoopPolicy<RAJA::loop_exec>;
+  using pol_m = RAJA::LoopPolicy<RAJA::loop_exec>;
+
+  for (const auto& perm : sweep_perms) {
+
+    std::memset(phi_data, 0, phi_size * sizeof(double));
+
+    PsiView psi(psi_data,
+                RAJA::make_permuted_layout({{num_d, num_g, num_z}}, perm));
+    PhiView phi(phi_data,
+                RAJA::make_permuted_layout({{num_m, num_g, num_z}}, perm));
+
+    RAJA::Timer timer;
+    timer.start();
+
+    for (int iter = 0;iter < num_iter;++ iter){
+      ltimesLaunch<pol_launch, pol_g, pol_z, pol_m>(
+          RAJA::HOST, RAJA::Grid(), L, psi, phi, num_m, num_d, num_g, num_z);
+    }
+
+    timer.stop();
+    double t = timer.elapsed();
+    double gflop_rate = total_flops / t / 1.0e9;
+    std::cout << "  layout " << permutationName(perm) << " run time (sec.): "
+              << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+    report.add("raja_teams_seq_sweep", permutationName(perm), host_roof, t);
+
+
+#if defined(DEBUG_LTIMES)
+    checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+#endif
+  }
+}
+#endif
+
+//----------------------------------------------------------------------------//
 
 #if defined(RAJA_ENABLE_OPENMP) && (VARIANT_RAJA_OPENMP)
 {
@@ -1064,6 +1551,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA OpenMP version of LTimes run time (sec.): "
             << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_openmp", permutationName(psi_perm), omp_roof, t);
 
 
 #if defined(DEBUG_LTIMES)
@@ -1155,6 +1643,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA CUDA version of LTimes run time (sec.): "
             << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("cuda_kernel", permutationName(psi_perm), cuda_roof, t);
 
 
   cudaErrchk( cudaMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
@@ -1272,6 +1761,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA CUDA Teams version of LTimes run time (sec.): "
             << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("cuda_teams", permutationName(psi_perm), cuda_roof, t);
 
 
   cudaErrchk( cudaMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
@@ -1302,45 +1792,21 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 #endif
 
 
-#if VARIANT_CUDA_TEAMS_MATRIX
+#if VARIANT_RAJA_TEAMS_MATRIX
 {
-  std::cout << "\n Running RAJA CUDA Teams+Matrix version of LTimes...\n";
+  std::cout << "\n Running RAJA Teams+Matrix sequential version of LTimes...\n";
 
   std::memset(phi_data, 0, phi_size * sizeof(double));
 
-  double* dL_data   = nullptr;
-  double* dpsi_data = nullptr;
-  double* dphi_data = nullptr;
-
-  cudaErrchk( cudaMalloc( (void**)&dL_data, L_size * sizeof(double) ) );
-  cudaErrchk( cudaMemcpy( dL_data, L_data, L_size * sizeof(double),
-                          cudaMemcpyHostToDevice ) );
-  cudaErrchk( cudaMalloc( (void**)&dpsi_data, psi_size * sizeof(double) ) );
-  cudaErrchk( cudaMemcpy( dpsi_data, psi_data, psi_size * sizeof(double),
-                          cudaMemcpyHostToDevice ) );
-  cudaErrchk( cudaMalloc( (void**)&dphi_data, phi_size * sizeof(double) ) );
-  cudaErrchk( cudaMemcpy( dphi_data, phi_data, phi_size * sizeof(double),
-                          cudaMemcpyHostToDevice ) );
-
-
   using matrix_layout = RowMajorLayout;
 
-  using L_matrix_host_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
-  using L_matrix_device_t = RAJA::RectMatrixRegister<double, matrix_layout, 8, 4, RAJA::cuda_warp_register>;
-  using L_matrix_hd_t = RAJA::LaunchPolicy<L_matrix_host_t, L_matrix_device_t>;
-
-  using phi_matrix_host_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
-  using phi_matrix_device_t = RAJA::RectMatrixRegister<double, matrix_layout, 8, 8, RAJA::cuda_warp_register>;
-  using phi_matrix_hd_t = RAJA::LaunchPolicy<L_matrix_host_t, phi_matrix_device_t>;
-
-  using psi_matrix_host_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
-  using psi_matrix_device_t = RAJA::RectMatrixRegister<double, matrix_layout, 4, 8, RAJA::cuda_warp_register>;
-  using psi_matrix_hd_t = RAJA::LaunchPolicy<L_matrix_host_t, psi_matrix_device_t>;
-
+  using L_matrix_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
+  using psi_matrix_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
+  using phi_matrix_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
 
-  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t, RAJA::cuda_launch_t<true , 1024> >;
-  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec, cuda_block_x_direct>;
-  using pol_z = RAJA::LoopPolicy<RAJA::loop_exec, cuda_thread_y_loop>;
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec>;
+  using pol_z = RAJA::LoopPolicy<RAJA::loop_exec>;
 
 
   //
@@ -1356,50 +1822,33 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   using PhiView = TypedView<double, Layout<3, int, 0>, IM, IG, IZ>;
 
   std::array<RAJA::idx_t, 2> L_perm {{1, 0}};
-  LView L(dL_data,
+  LView L(L_data,
           RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
 
   std::array<RAJA::idx_t, 3> psi_perm {{1, 2, 0}};
-  PsiView psi(dpsi_data,
+  PsiView psi(psi_data,
               RAJA::make_permuted_layout({{num_d, num_g, num_z}}, psi_perm));
 
   std::array<RAJA::idx_t, 3> phi_perm {{1, 2, 0}};
-  PhiView phi(dphi_data,
+  PhiView phi(phi_data,
               RAJA::make_permuted_layout({{num_m, num_g, num_z}}, phi_perm));
 
 
   RAJA::Timer timer;
-  cudaErrchk( cudaDeviceSynchronize() );
   timer.start();
 
-  auto seg_g = RAJA::TypedRangeSegment<IG>(0, num_g);
-  auto seg_z = RAJA::TypedRangeSegment<IZ>(0, num_z);
-  auto seg_m = RAJA::TypedRangeSegment<IM>(0, num_m);
-  auto seg_d = RAJA::TypedRangeSegment<ID>(0, num_d);
-
-  printf("num_iter=%d\n", (int)num_iter);
   for (int iter = 0;iter < num_iter;++ iter){
-    RAJA::launch<pol_launch>(
-        RAJA::DEVICE,
-        RAJA::Grid(RAJA::Teams(num_g, 1, 1),
-                              RAJA::Threads(32, 32, 1)),
-        [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx)
-    {
-
+    RAJA::launch<pol_launch>(RAJA::HOST, RAJA::Grid(), [=](RAJA::LaunchContext ctx){
 
-      using L_matrix_t = RAJA_GET_POLICY(L_matrix_hd_t);
       using L_RowM = RAJA::RowIndex<IM, L_matrix_t>;
       using L_ColD = RAJA::ColIndex<ID, L_matrix_t>;
 
-      using psi_matrix_t = RAJA_GET_POLICY(psi_matrix_hd_t);
       using psi_RowD = RAJA::RowIndex<ID, psi_matrix_t>;
       using psi_ColZ = RAJA::ColIndex<IZ, psi_matrix_t>;
 
-      using phi_matrix_t = RAJA_GET_POLICY(phi_matrix_hd_t);
       using phi_RowM = RAJA::RowIndex<IM, phi_matrix_t>;
       using phi_ColZ = RAJA::ColIndex<IZ, phi_matrix_t>;
 
-
       RAJA::loop<pol_g>(ctx, RAJA::TypedRangeSegment<IG>(0, num_g), [&](IG g){
 
         RAJA::tile<pol_z>(ctx, 32, RAJA::TypedRangeSegment<int>(0, num_z), [&](RAJA::TypedRangeSegment<int> tzi){
@@ -1412,16 +1861,146 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
         });
       });
 
-    });
-
-  }
-  cudaErrchk( cudaDeviceSynchronize() );
+    }); // launch
+  } // iter
+
+  timer.stop();
+  double t = timer.elapsed();
+  double gflop_rate = total_flops / t / 1.0e9;
+  std::cout << "  RAJA Teams+Matrix sequential version of LTimes run time (sec.): "
+            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("raja_teams_matrix", permutationName(psi_perm), host_roof, t);
+
+
+#if defined(DEBUG_LTIMES)
+  checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+#endif
+}
+#endif
+
+//----------------------------------------------------------------------------//
+
+#if VARIANT_CUDA_TEAMS_MATRIX
+{
+  std::cout << "\n Running RAJA CUDA Teams+Matrix version of LTimes...\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  double* dL_data   = nullptr;
+  double* dpsi_data = nullptr;
+  double* dphi_data = nullptr;
+
+  cudaErrchk( cudaMalloc( (void**)&dL_data, L_size * sizeof(double) ) );
+  cudaErrchk( cudaMemcpy( dL_data, L_data, L_size * sizeof(double),
+                          cudaMemcpyHostToDevice ) );
+  cudaErrchk( cudaMalloc( (void**)&dpsi_data, psi_size * sizeof(double) ) );
+  cudaErrchk( cudaMemcpy( dpsi_data, psi_data, psi_size * sizeof(double),
+                          cudaMemcpyHostToDevice ) );
+  cudaErrchk( cudaMalloc( (void**)&dphi_data, phi_size * sizeof(double) ) );
+  cudaErrchk( cudaMemcpy( dphi_data, phi_data, phi_size * sizeof(double),
+                          cudaMemcpyHostToDevice ) );
+
+
+  using matrix_layout = RowMajorLayout;
+
+  using L_matrix_host_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
+  using L_matrix_device_t = RAJA::RectMatrixRegister<double, matrix_layout, 8, 4, RAJA::cuda_warp_register>;
+  using L_matrix_hd_t = RAJA::LaunchPolicy<L_matrix_host_t, L_matrix_device_t>;
+
+  using phi_matrix_host_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
+  using phi_matrix_device_t = RAJA::RectMatrixRegister<double, matrix_layout, 8, 8, RAJA::cuda_warp_register>;
+  using phi_matrix_hd_t = RAJA::LaunchPolicy<L_matrix_host_t, phi_matrix_device_t>;
+
+  using psi_matrix_host_t = RAJA::SquareMatrixRegister<double, matrix_layout>;
+  using psi_matrix_device_t = RAJA::RectMatrixRegister<double, matrix_layout, 4, 8, RAJA::cuda_warp_register>;
+  using psi_matrix_hd_t = RAJA::LaunchPolicy<L_matrix_host_t, psi_matrix_device_t>;
+
+
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t, RAJA::cuda_launch_t<true , 1024> >;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec, cuda_block_x_direct>;
+  using pol_z = RAJA::LoopPolicy<RAJA::loop_exec, cuda_thread_y_loop>;
+
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 0>, IM, ID>;
+
+  // psi(d, g, z) : 2 -> z is stride-1 dimension
+  using PsiView = TypedView<double, Layout<3, int, 0>, ID, IG, IZ>;
+
+  // phi(m, g, z) : 2 -> z is stride-1 dimension
+  using PhiView = TypedView<double, Layout<3, int, 0>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{1, 0}};
+  LView L(dL_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  std::array<RAJA::idx_t, 3> psi_perm {{1, 2, 0}};
+  PsiView psi(dpsi_data,
+              RAJA::make_permuted_layout({{num_d, num_g, num_z}}, psi_perm));
+
+  std::array<RAJA::idx_t, 3> phi_perm {{1, 2, 0}};
+  PhiView phi(dphi_data,
+              RAJA::make_permuted_layout({{num_m, num_g, num_z}}, phi_perm));
+
+
+  RAJA::Timer timer;
+  cudaErrchk( cudaDeviceSynchronize() );
+  timer.start();
+
+  auto seg_g = RAJA::TypedRangeSegment<IG>(0, num_g);
+  auto seg_z = RAJA::TypedRangeSegment<IZ>(0, num_z);
+  auto seg_m = RAJA::TypedRangeSegment<IM>(0, num_m);
+  auto seg_d = RAJA::TypedRangeSegment<ID>(0, num_d);
+
+  printf("num_iter=%d\n", (int)num_iter);
+  for (int iter = 0;iter < num_iter;++ iter){
+    RAJA::launch<pol_launch>(
+        RAJA::DEVICE,
+        RAJA::Grid(RAJA::Teams(num_g, 1, 1),
+                              RAJA::Threads(32, 32, 1)),
+        [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx)
+    {
+
+
+      using L_matrix_t = RAJA_GET_POLICY(L_matrix_hd_t);
+      using L_RowM = RAJA::RowIndex<IM, L_matrix_t>;
+      using L_ColD = RAJA::ColIndex<ID, L_matrix_t>;
+
+      using psi_matrix_t = RAJA_GET_POLICY(psi_matrix_hd_t);
+      using psi_RowD = RAJA::RowIndex<ID, psi_matrix_t>;
+      using psi_ColZ = RAJA::ColIndex<IZ, psi_matrix_t>;
+
+      using phi_matrix_t = RAJA_GET_POLICY(phi_matrix_hd_t);
+      using phi_RowM = RAJA::RowIndex<IM, phi_matrix_t>;
+      using phi_ColZ = RAJA::ColIndex<IZ, phi_matrix_t>;
+
+
+      RAJA::loop<pol_g>(ctx, RAJA::TypedRangeSegment<IG>(0, num_g), [&](IG g){
+
+        RAJA::tile<pol_z>(ctx, 32, RAJA::TypedRangeSegment<int>(0, num_z), [&](RAJA::TypedRangeSegment<int> tzi){
+
+          RAJA::TypedRangeSegment<IZ> tz(*tzi.begin(), *tzi.end());
+
+          phi(phi_RowM::all(), g, phi_ColZ(tz)) +=
+              L(L_RowM::all(), L_ColD::all()) * psi(psi_RowD::all(), g, psi_ColZ(tz));
+
+        });
+      });
+
+    });
+
+  }
+  cudaErrchk( cudaDeviceSynchronize() );
 
   timer.stop();
   double t = timer.elapsed();
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA CUDA Teams+Matrix version of LTimes run time (sec.): "
             << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("cuda_teams_matrix", permutationName(psi_perm), cuda_roof, t);
 
 
   cudaErrchk( cudaMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
@@ -1662,6 +2241,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA CUDA + shmem version of LTimes run time (sec.): "
             << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("cuda_kernel_shmem", permutationName(psi_perm), cuda_roof, t);
 
 
 
@@ -1686,6 +2266,189 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
 //----------------------------------------------------------------------------//
 
+#if VARIANT_CUDA_TEAMS_SHMEM
+{
+  std::cout << "\n Running RAJA CUDA Teams + shmem version of LTimes...\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  double* dL_data   = nullptr;
+  double* dpsi_data = nullptr;
+  double* dphi_data = nullptr;
+
+  cudaErrchk( cudaMalloc( (void**)&dL_data, L_size * sizeof(double) ) );
+  cudaErrchk( cudaMemcpy( dL_data, L_data, L_size * sizeof(double),
+                          cudaMemcpyHostToDevice ) );
+  cudaErrchk( cudaMalloc( (void**)&dpsi_data, psi_size * sizeof(double) ) );
+  cudaErrchk( cudaMemcpy( dpsi_data, psi_data, psi_size * sizeof(double),
+                          cudaMemcpyHostToDevice ) );
+  cudaErrchk( cudaMalloc( (void**)&dphi_data, phi_size * sizeof(double) ) );
+  cudaErrchk( cudaMemcpy( dphi_data, phi_data, phi_size * sizeof(double),
+                          cudaMemcpyHostToDevice ) );
+
+
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t, RAJA::cuda_launch_t<true, 256> >;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec, cuda_block_x_direct>;
+  using pol_tz = RAJA::LoopPolicy<RAJA::loop_exec, cuda_block_y_loop>;
+  using pol_ty = RAJA::LoopPolicy<RAJA::loop_exec, cuda_thread_y_loop>;
+  using pol_tx = RAJA::LoopPolicy<RAJA::loop_exec, cuda_thread_x_loop>;
+
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+
+  // psi(d, g, z) : 2 -> z is stride-1 dimension
+  using PsiView = TypedView<double, Layout<3, int, 2>, ID, IG, IZ>;
+
+  // phi(m, g, z) : 2 -> z is stride-1 dimension
+  using PhiView = TypedView<double, Layout<3, int, 2>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{0, 1}};
+  LView L(dL_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  std::array<RAJA::idx_t, 3> psi_perm {{0, 1, 2}};
+  PsiView psi(dpsi_data,
+              RAJA::make_permuted_layout({{num_d, num_g, num_z}}, psi_perm));
+
+  std::array<RAJA::idx_t, 3> phi_perm {{0, 1, 2}};
+  PhiView phi(dphi_data,
+              RAJA::make_permuted_layout({{num_m, num_g, num_z}}, phi_perm));
+
+
+  RAJA::Timer timer;
+  cudaErrchk( cudaDeviceSynchronize() );
+  timer.start();
+
+  for (int iter = 0;iter < num_iter;++ iter){
+    ltimesLaunchShmem<pol_launch, pol_g, pol_tz, pol_ty, pol_tx>(
+        RAJA::DEVICE, 256, L, psi, phi, num_m, num_d, num_g, num_z);
+  }
+  cudaErrchk( cudaDeviceSynchronize() );
+
+  timer.stop();
+  double t = timer.elapsed();
+  double gflop_rate = total_flops / t / 1.0e9;
+  std::cout << "  RAJA CUDA Teams + shmem version of LTimes run time (sec.): "
+            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("cuda_teams_shmem", permutationName(psi_perm), cuda_roof, t);
+
+
+  cudaErrchk( cudaMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
+                          cudaMemcpyDeviceToHost ) );
+
+  cudaErrchk( cudaFree( dL_data ) );
+  cudaErrchk( cudaFree( dpsi_data ) );
+  cudaErrchk( cudaFree( dphi_data ) );
+
+  // Reset data in Views to CPU data
+  L.set_data(L_data);
+  psi.set_data(psi_data);
+  phi.set_data(phi_data);
+
+#if defined(DEBUG_LTIMES)
+  checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+#endif
+}
+#endif
+
+//----------------------------------------------------------------------------//
+
+#if VARIANT_CUDA_LAYOUT_SWEEP
+{
+  std::cout << "\n Running RAJA CUDA Teams layout sweep of LTimes...\n";
+
+  double* dL_data   = nullptr;
+  double* dpsi_data = nullptr;
+  double* dphi_data = nullptr;
+
+  cudaErrchk( cudaMalloc( (void**)&dL_data, L_size * sizeof(double) ) );
+  cudaErrchk( cudaMemcpy( dL_data, L_data, L_size * sizeof(double),
+                          cudaMemcpyHostToDevice ) );
+  cudaErrchk( cudaMalloc( (void**)&dpsi_data, psi_size * sizeof(double) ) );
+  cudaErrchk( cudaMemcpy( dpsi_data, psi_data, psi_size * sizeof(double),
+                          cudaMemcpyHostToDevice ) );
+  cudaErrchk( cudaMalloc( (void**)&dphi_data, phi_size * sizeof(double) ) );
+
+
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t, RAJA::cuda_launch_t<true, 512> >;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec, cuda_block_x_loop>;
+  using pol_z = RAJA::LoopPolicy<RAJA::loop_exec, cuda_thread_y_loop>;
+  using pol_m = RAJA::LoopPolicy<RAJA::loop_exec, cuda_thread_x_loop>;
+
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+
+  // psi(d, g, z) and phi(m, g, z) have no fixed stride-1 dimension, so
+  // every permutation of the sweep can be used
+  using PsiView = TypedView<double, Layout<3, int>, ID, IG, IZ>;
+  using PhiView = TypedView<double, Layout<3, int>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{0, 1}};
+  LView L(dL_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  const std::array<RAJA::idx_t, 3> sweep_perms[] = {
+      {{0, 1, 2}}, {{0, 2, 1}}, {{1, 0, 2}},
+      {{1, 2, 0}}, {{2, 0, 1}}, {{2, 1, 0}}};
+
+  for (const auto& perm : sweep_perms) {
+
+    cudaErrchk( cudaMemset( dphi_data, 0, phi_size * sizeof(double) ) );
+
+    PsiView psi(dpsi_data,
+                RAJA::make_permuted_layout({{num_d, num_g, num_z}}, perm));
+    PhiView phi(dphi_data,
+                RAJA::make_permuted_layout({{num_m, num_g, num_z}}, perm));
+
+    RAJA::Timer timer;
+    cudaErrchk( cudaDeviceSynchronize() );
+    timer.start();
+
+    for (int iter = 0;iter < num_iter;++ iter){
+      ltimesLaunch<pol_launch, pol_g, pol_z, pol_m>(
+          RAJA::DEVICE,
+          RAJA::Grid(RAJA::Teams(160, 1, 1), RAJA::Threads(8, 64, 1)),
+          L, psi, phi, num_m, num_d, num_g, num_z);
+    }
+    cudaErrchk( cudaDeviceSynchronize() );
+
+    timer.stop();
+    double t = timer.elapsed();
+    double gflop_rate = total_flops / t / 1.0e9;
+    std::cout << "  layout " << permutationName(perm) << " run time (sec.): "
+              << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+    report.add("cuda_teams_sweep", permutationName(perm), cuda_roof, t);
+
+
+#if defined(DEBUG_LTIMES)
+    cudaErrchk( cudaMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
+                            cudaMemcpyDeviceToHost ) );
+
+    // Check with the CPU data in the same layout
+    L.set_data(L_data);
+    psi.set_data(psi_data);
+    phi.set_data(phi_data);
+    checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+    L.set_data(dL_data);
+#endif
+  }
+
+  cudaErrchk( cudaFree( dL_data ) );
+  cudaErrchk( cudaFree( dpsi_data ) );
+  cudaErrchk( cudaFree( dphi_data ) );
+}
+#endif
+
+//----------------------------------------------------------------------------//
+
 #if RAJA_HIP_KERNEL
 {
   std::cout << "\n Running RAJA HIP version of LTimes...\n";
@@ -1767,6 +2530,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA HIP version of LTimes run time (sec.): "
             << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("hip_kernel", permutationName(psi_perm), hip_roof, t);
 
   hipErrchk( hipMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
                           hipMemcpyDeviceToHost ) );
@@ -2006,6 +2770,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   double gflop_rate = total_flops / t / 1.0e9;
   std::cout << "  RAJA HIP + shmem version of LTimes run time (sec.): "
             << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("hip_kernel_shmem", permutationName(psi_perm), hip_roof, t);
 
 
 
@@ -2030,6 +2795,191 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
 //----------------------------------------------------------------------------//
 
+#if RAJA_HIP_TEAMS_SHMEM
+{
+  std::cout << "\n Running RAJA HIP Teams + shmem version of LTimes...\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  double* dL_data   = nullptr;
+  double* dpsi_data = nullptr;
+  double* dphi_data = nullptr;
+
+  hipErrchk( hipMalloc( (void**)&dL_data, L_size * sizeof(double) ) );
+  hipErrchk( hipMemcpy( dL_data, L_data, L_size * sizeof(double),
+                          hipMemcpyHostToDevice ) );
+  hipErrchk( hipMalloc( (void**)&dpsi_data, psi_size * sizeof(double) ) );
+  hipErrchk( hipMemcpy( dpsi_data, psi_data, psi_size * sizeof(double),
+                          hipMemcpyHostToDevice ) );
+  hipErrchk( hipMalloc( (void**)&dphi_data, phi_size * sizeof(double) ) );
+  hipErrchk( hipMemcpy( dphi_data, phi_data, phi_size * sizeof(double),
+                          hipMemcpyHostToDevice ) );
+
+
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t, RAJA::hip_launch_t<true, 256> >;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec, hip_block_x_direct>;
+  using pol_tz = RAJA::LoopPolicy<RAJA::loop_exec, hip_block_y_loop>;
+  using pol_ty = RAJA::LoopPolicy<RAJA::loop_exec, hip_thread_y_loop>;
+  using pol_tx = RAJA::LoopPolicy<RAJA::loop_exec, hip_thread_x_loop>;
+
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+
+  // psi(d, g, z) : 2 -> z is stride-1 dimension
+  using PsiView = TypedView<double, Layout<3, int, 2>, ID, IG, IZ>;
+
+  // phi(m, g, z) : 2 -> z is stride-1 dimension
+  using PhiView = TypedView<double, Layout<3, int, 2>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{0, 1}};
+  LView L(dL_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  std::array<RAJA::idx_t, 3> psi_perm {{0, 1, 2}};
+  PsiView psi(dpsi_data,
+              RAJA::make_permuted_layout({{num_d, num_g, num_z}}, psi_perm));
+
+  std::array<RAJA::idx_t, 3> phi_perm {{0, 1, 2}};
+  PhiView phi(dphi_data,
+              RAJA::make_permuted_layout({{num_m, num_g, num_z}}, phi_perm));
+
+
+  RAJA::Timer timer;
+  hipErrchk( hipDeviceSynchronize() );
+  timer.start();
+
+  for (int iter = 0;iter < num_iter;++ iter){
+    ltimesLaunchShmem<pol_launch, pol_g, pol_tz, pol_ty, pol_tx>(
+        RAJA::DEVICE, 256, L, psi, phi, num_m, num_d, num_g, num_z);
+  }
+  hipErrchk( hipDeviceSynchronize() );
+
+  timer.stop();
+  double t = timer.elapsed();
+  double gflop_rate = total_flops / t / 1.0e9;
+  std::cout << "  RAJA HIP Teams + shmem version of LTimes run time (sec.): "
+            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  report.add("hip_teams_shmem", permutationName(psi_perm), hip_roof, t);
+
+
+  hipErrchk( hipMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
+                          hipMemcpyDeviceToHost ) );
+
+  hipErrchk( hipFree( dL_data ) );
+  hipErrchk( hipFree( dpsi_data ) );
+  hipErrchk( hipFree( dphi_data ) );
+
+  // Reset data in Views to CPU data
+  L.set_data(L_data);
+  psi.set_data(psi_data);
+  phi.set_data(phi_data);
+
+#if defined(DEBUG_LTIMES)
+  checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+#endif
+}
+#endif
+
+//----------------------------------------------------------------------------//
+
+#if RAJA_HIP_LAYOUT_SWEEP
+{
+  std::cout << "\n Running RAJA HIP Teams layout sweep of LTimes...\n";
+
+  double* dL_data   = nullptr;
+  double* dpsi_data = nullptr;
+  double* dphi_data = nullptr;
+
+  hipErrchk( hipMalloc( (void**)&dL_data, L_size * sizeof(double) ) );
+  hipErrchk( hipMemcpy( dL_data, L_data, L_size * sizeof(double),
+                          hipMemcpyHostToDevice ) );
+  hipErrchk( hipMalloc( (void**)&dpsi_data, psi_size * sizeof(double) ) );
+  hipErrchk( hipMemcpy( dpsi_data, psi_data, psi_size * sizeof(double),
+                          hipMemcpyHostToDevice ) );
+  hipErrchk( hipMalloc( (void**)&dphi_data, phi_size * sizeof(double) ) );
+
+
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t, RAJA::hip_launch_t<true, 512> >;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec, hip_block_x_loop>;
+  using pol_z = RAJA::LoopPolicy<RAJA::loop_exec, hip_thread_y_loop>;
+  using pol_m = RAJA::LoopPolicy<RAJA::loop_exec, hip_thread_x_loop>;
+
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+
+  // psi(d, g, z) and phi(m, g, z) have no fixed stride-1 dimension, so
+  // every permutation of the sweep can be used
+  using PsiView = TypedView<double, Layout<3, int>, ID, IG, IZ>;
+  using PhiView = TypedView<double, Layout<3, int>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{0, 1}};
+  LView L(dL_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  const std::array<RAJA::idx_t, 3> sweep_perms[] = {
+      {{0, 1, 2}}, {{0, 2, 1}}, {{1, 0, 2}},
+      {{1, 2, 0}}, {{2, 0, 1}}, {{2, 1, 0}}};
+
+  for (const auto& perm : sweep_perms) {
+
+    hipErrchk( hipMemset( dphi_data, 0, phi_size * sizeof(double) ) );
+
+    PsiView psi(dpsi_data,
+                RAJA::make_permuted_layout({{num_d, num_g, num_z}}, perm));
+    PhiView phi(dphi_data,
+                RAJA::make_permuted_layout({{num_m, num_g, num_z}}, perm));
+
+    RAJA::Timer timer;
+    hipErrchk( hipDeviceSynchronize() );
+    timer.start();
+
+    for (int iter = 0;iter < num_iter;++ iter){
+      ltimesLaunch<pol_launch, pol_g, pol_z, pol_m>(
+          RAJA::DEVICE,
+          RAJA::Grid(RAJA::Teams(160, 1, 1), RAJA::Threads(8, 64, 1)),
+          L, psi, phi, num_m, num_d, num_g, num_z);
+    }
+    hipErrchk( hipDeviceSynchronize() );
+
+    timer.stop();
+    double t = timer.elapsed();
+    double gflop_rate = total_flops / t / 1.0e9;
+    std::cout << "  layout " << permutationName(perm) << " run time (sec.): "
+              << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+    report.add("hip_teams_sweep", permutationName(perm), hip_roof, t);
+
+
+#if defined(DEBUG_LTIMES)
+    hipErrchk( hipMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
+                            hipMemcpyDeviceToHost ) );
+
+    // Check with the CPU data in the same layout
+    L.set_data(L_data);
+    psi.set_data(psi_data);
+    phi.set_data(phi_data);
+    checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+    L.set_data(dL_data);
+#endif
+  }
+
+  hipErrchk( hipFree( dL_data ) );
+  hipErrchk( hipFree( dpsi_data ) );
+  hipErrchk( hipFree( dphi_data ) );
+}
+#endif
+
+//----------------------------------------------------------------------------//
+
+  report.write(json_path, num_m, num_d, num_g, num_z, num_iter);
+
   std::cout << "\n DONE!...\n";
 
   return 0;
@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Scaling of OpenMP reductions with the number of threads.
+//
+// Each loop uses several reducers captured by the same lambda. The raw
+// variants show the cost of per-thread partials that share cache lines
+// (packed) against partials on separate cache lines (padded), which is the
+// layout used by omp_reduce and omp_reduce_ordered. Run with
+// --benchmark_counters_tabular=true and compare times across thread counts.
+//
+
+#include <omp.h>
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N (1 << 18)
+
+static std::vector<double> make_data()
+{
+  std::vector<double> data(N);
+  for (int i = 0; i < N; i++) {
+    data[i] = static_cast<double>((i * 7919) % 1000) - 500.0;
+  }
+  return data;
+}
+
+template <typename REDUCE_POL>
+static void benchmark_raja_reducers(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  std::vector<double> vec = make_data();
+  const double* data = vec.data();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<REDUCE_POL, double> sum(0.0);
+    RAJA::ReduceMin<REDUCE_POL, double> min(1.0e30);
+    RAJA::ReduceMax<REDUCE_POL, double> max(-1.0e30);
+    RAJA::ReduceMinLoc<REDUCE_POL, double> minloc(1.0e30, -1);
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+          sum += data[i];
+          min.min(data[i]);
+          max.max(data[i]);
+          minloc.minloc(data[i], i);
+        });
+
+    benchmark::DoNotOptimize(sum.get());
+    benchmark::DoNotOptimize(min.get());
+    benchmark::DoNotOptimize(max.get());
+    benchmark::DoNotOptimize(minloc.getLoc());
+  }
+  state.counters["threads"] = static_cast<double>(state.range(0));
+}
+
+//
+// Per-thread partials of several reductions stored in one array indexed by
+// thread, updated in the loop. Stride 1 packs the partials of neighboring
+// threads into the same cache line.
+//
+template <int STRIDE>
+static void benchmark_raw_partials(benchmark::State& state)
+{
+  const int nthreads = static_cast<int>(state.range(0));
+  omp_set_num_threads(nthreads);
+  std::vector<double> vec = make_data();
+  const double* data = vec.data();
+
+  const int num_reducers = 4;
+  std::vector<double> partials(nthreads * num_reducers * STRIDE);
+
+  while (state.KeepRunning()) {
+#pragma omp parallel
+    {
+      const int tid = omp_get_thread_num();
+      double* mine = &partials[tid * num_reducers * STRIDE];
+      for (int r = 0; r < num_reducers; ++r) {
+        mine[r * STRIDE] = 0.0;
+      }
+#pragma omp for
+      for (int i = 0; i < N; ++i) {
+        mine[0] += data[i];
+        mine[STRIDE] = RAJA_MIN(mine[STRIDE], data[i]);
+        mine[2 * STRIDE] = RAJA_MAX(mine[2 * STRIDE], data[i]);
+        mine[3 * STRIDE] += 1.0;
+      }
+    }
+    benchmark::DoNotOptimize(partials.data());
+  }
+  state.counters["threads"] = static_cast<double>(nthreads);
+}
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int t = 1; t < max_threads; t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(max_threads);
+}
+
+BENCHMARK_TEMPLATE(benchmark_raja_reducers, RAJA::omp_reduce)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_raja_reducers, RAJA::omp_reduce_ordered)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_raw_partials, 1)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_raw_partials, RAJA::DATA_ALIGN / sizeof(double))
+    ->Apply(thread_counts)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,540 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Overhead of RAJA against the same kernels written directly with each
+// programming model: STREAM triad, daxpy, a 7-point stencil, a dot product
+// and a transpose.
+//
+// Every kernel is registered twice for each back-end, e.g.
+// benchmark_triad<omp_backend, raw> and benchmark_triad<omp_backend, raja>.
+// The raw variants use a plain loop, an OpenMP parallel for, or a minimal
+// CUDA, HIP or SYCL kernel with the same loop body; the RAJA variants use
+// forall, Views and reducers. Size 1 measures the launch latency and the
+// largest size, RAJA_BENCHMARK_MAX_SIZE or 2^24, the bandwidth. After the
+// usual output a table gives the overhead of each RAJA variant in percent of
+// its raw variant; --benchmark_out=<file>.json also writes the runs as JSON.
+//
+
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using Index = RAJA::Index_type;
+
+// variants of each kernel
+struct raw {};
+struct raja {};
+
+struct seq_backend {
+  using policy = RAJA::seq_exec;
+  using reduce_policy = RAJA::seq_reduce;
+
+  template <typename T>
+  static T* allocate(Index n) { return new T[n]; }
+
+  template <typename T>
+  static void deallocate(T* ptr) { delete[] ptr; }
+
+  template <typename BODY>
+  static void raw_for(Index n, BODY body)
+  {
+    for (Index i = 0; i < n; ++i) {
+      body(i);
+    }
+  }
+
+  template <typename BODY>
+  static double raw_sum(Index n, BODY body)
+  {
+    double sum = 0.0;
+    for (Index i = 0; i < n; ++i) {
+      sum += body(i);
+    }
+    return sum;
+  }
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+struct omp_backend {
+  using policy = RAJA::omp_parallel_for_exec;
+  using reduce_policy = RAJA::omp_reduce;
+
+  template <typename T>
+  static T* allocate(Index n) { return new T[n]; }
+
+  template <typename T>
+  static void deallocate(T* ptr) { delete[] ptr; }
+
+  template <typename BODY>
+  static void raw_for(Index n, BODY body)
+  {
+#pragma omp parallel for
+    for (Index i = 0; i < n; ++i) {
+      body(i);
+    }
+  }
+
+  template <typename BODY>
+  static double raw_sum(Index n, BODY body)
+  {
+    double sum = 0.0;
+#pragma omp parallel for reduction(+:sum)
+    for (Index i = 0; i < n; ++i) {
+      sum += body(i);
+    }
+    return sum;
+  }
+};
+#endif
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+constexpr int raw_block_size = 256;
+
+template <typename BODY>
+__global__ void raw_for_kernel(Index n, BODY body)
+{
+  const Index i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < n) {
+    body(i);
+  }
+}
+
+// block tree reduction, one atomicAdd per block
+template <typename BODY>
+__global__ void raw_sum_kernel(Index n, BODY body, double* sum)
+{
+  __shared__ double partial[raw_block_size];
+  const Index i = blockIdx.x * blockDim.x + threadIdx.x;
+  partial[threadIdx.x] = i < n ? body(i) : 0.0;
+  __syncthreads();
+  for (int s = raw_block_size / 2; s > 0; s /= 2) {
+    if (static_cast<int>(threadIdx.x) < s) {
+      partial[threadIdx.x] += partial[threadIdx.x + s];
+    }
+    __syncthreads();
+  }
+  if (threadIdx.x == 0) {
+    atomicAdd(sum, partial[0]);
+  }
+}
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+struct cuda_backend {
+  using policy = RAJA::cuda_exec<raw_block_size>;
+  using reduce_policy = RAJA::cuda_reduce;
+
+  template <typename T>
+  static T* allocate(Index n)
+  {
+    T* ptr = nullptr;
+    cudaErrchk(cudaMalloc((void**)&ptr, n * sizeof(T)));
+    return ptr;
+  }
+
+  template <typename T>
+  static void deallocate(T* ptr) { cudaErrchk(cudaFree(ptr)); }
+
+  template <typename BODY>
+  static void raw_for(Index n, BODY body)
+  {
+    const Index blocks = (n + raw_block_size - 1) / raw_block_size;
+    raw_for_kernel<<<blocks, raw_block_size>>>(n, body);
+    cudaErrchk(cudaGetLastError());
+    cudaErrchk(cudaDeviceSynchronize());
+  }
+
+  template <typename BODY>
+  static double raw_sum(Index n, BODY body)
+  {
+    static double* sum = allocate<double>(1);
+    const Index blocks = (n + raw_block_size - 1) / raw_block_size;
+    cudaErrchk(cudaMemsetAsync(sum, 0, sizeof(double)));
+    raw_sum_kernel<<<blocks, raw_block_size>>>(n, body, sum);
+    cudaErrchk(cudaGetLastError());
+    double result;
+    cudaErrchk(cudaMemcpy(&result, sum, sizeof(double), cudaMemcpyDeviceToHost));
+    return result;
+  }
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+struct hip_backend {
+  using policy = RAJA::hip_exec<raw_block_size>;
+  using reduce_policy = RAJA::hip_reduce;
+
+  template <typename T>
+  static T* allocate(Index n)
+  {
+    T* ptr = nullptr;
+    hipErrchk(hipMalloc((void**)&ptr, n * sizeof(T)));
+    return ptr;
+  }
+
+  template <typename T>
+  static void deallocate(T* ptr) { hipErrchk(hipFree(ptr)); }
+
+  template <typename BODY>
+  static void raw_for(Index n, BODY body)
+  {
+    const Index blocks = (n + raw_block_size - 1) / raw_block_size;
+    hipLaunchKernelGGL(raw_for_kernel<BODY>, dim3(blocks), dim3(raw_block_size),
+                       0, 0, n, body);
+    hipErrchk(hipGetLastError());
+    hipErrchk(hipDeviceSynchronize());
+  }
+
+  template <typename BODY>
+  static double raw_sum(Index n, BODY body)
+  {
+    static double* sum = allocate<double>(1);
+    const Index blocks = (n + raw_block_size - 1) / raw_block_size;
+    hipErrchk(hipMemsetAsync(sum, 0, sizeof(double)));
+    hipLaunchKernelGGL(raw_sum_kernel<BODY>, dim3(blocks), dim3(raw_block_size),
+                       0, 0, n, body, sum);
+    hipErrchk(hipGetLastError());
+    double result;
+    hipErrchk(hipMemcpy(&result, sum, sizeof(double), hipMemcpyDeviceToHost));
+    return result;
+  }
+};
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+struct sycl_backend {
+  using policy = RAJA::sycl_exec<256, false>;
+  using reduce_policy = RAJA::sycl_reduce;
+
+  static cl::sycl::queue& queue()
+  {
+    static cl::sycl::queue* q = RAJA::resources::Sycl::get_default().get_queue();
+    return *q;
+  }
+
+  template <typename T>
+  static T* allocate(Index n) { return cl::sycl::malloc_device<T>(n, queue()); }
+
+  template <typename T>
+  static void deallocate(T* ptr) { cl::sycl::free(ptr, queue()); }
+
+  template <typename BODY>
+  static void raw_for(Index n, BODY body)
+  {
+    queue().parallel_for(cl::sycl::range<1>(n), [=](cl::sycl::id<1> i) {
+      body(i[0]);
+    }).wait();
+  }
+
+  template <typename BODY>
+  static double raw_sum(Index n, BODY body)
+  {
+    static double* sum = cl::sycl::malloc_shared<double>(1, queue());
+    *sum = 0.0;
+    queue().parallel_for(cl::sycl::range<1>(n),
+                         cl::sycl::reduction(sum, cl::sycl::plus<double>()),
+                         [=](cl::sycl::id<1> i, auto& s) { s += body(i[0]); })
+        .wait();
+    return *sum;
+  }
+};
+#endif
+
+template <typename BACKEND, typename BODY>
+static void run_for(raw, Index n, BODY const& body)
+{
+  BACKEND::raw_for(n, body);
+}
+
+template <typename BACKEND, typename BODY>
+static void run_for(raja, Index n, BODY const& body)
+{
+  RAJA::forall<typename BACKEND::policy>(RAJA::TypedRangeSegment<Index>(0, n),
+                                         body);
+}
+
+// array of n doubles in the memory of the back-end, filled with value
+template <typename BACKEND>
+struct array
+{
+  array(Index n, double value) : data(BACKEND::template allocate<double>(n))
+  {
+    double* d = data;
+    BACKEND::raw_for(n, [=] RAJA_HOST_DEVICE(Index i) { d[i] = value; });
+  }
+
+  ~array() { BACKEND::deallocate(data); }
+
+  array(array const&) = delete;
+  array& operator=(array const&) = delete;
+
+  double* data;
+};
+
+static Index max_size()
+{
+  const char* env = std::getenv("RAJA_BENCHMARK_MAX_SIZE");
+  const Index size = env ? std::atol(env) : 0;
+  return size > 0 ? size : (Index(1) << 24);
+}
+
+// root of n rounded down to a power of two, for the 2d and 3d kernels
+static Index side(Index n, int dims)
+{
+  Index s = 1;
+  while (true) {
+    Index v = 1;
+    for (int d = 0; d < dims; ++d) {
+      v *= 2 * s;
+    }
+    if (v > n) return s;
+    s *= 2;
+  }
+}
+
+template <typename BACKEND, typename VARIANT>
+static void benchmark_triad(benchmark::State& state)
+{
+  const Index n = state.range(0);
+  array<BACKEND> a(n, 0.0), b(n, 1.0), c(n, 2.0);
+  double* ad = a.data;
+  double* bd = b.data;
+  double* cd = c.data;
+  const double scalar = 3.0;
+
+  while (state.KeepRunning()) {
+    run_for<BACKEND>(VARIANT{}, n, [=] RAJA_HOST_DEVICE(Index i) {
+      ad[i] = bd[i] + scalar * cd[i];
+    });
+  }
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+}
+
+template <typename BACKEND, typename VARIANT>
+static void benchmark_daxpy(benchmark::State& state)
+{
+  const Index n = state.range(0);
+  array<BACKEND> x(n, 1.0), y(n, 2.0);
+  double* xd = x.data;
+  double* yd = y.data;
+  const double alpha = 3.0;
+
+  while (state.KeepRunning()) {
+    run_for<BACKEND>(VARIANT{}, n, [=] RAJA_HOST_DEVICE(Index i) {
+      yd[i] += alpha * xd[i];
+    });
+  }
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+}
+
+template <typename BACKEND>
+static void stencil(raw, Index m, const double* in, double* out)
+{
+  BACKEND::raw_for(m * m * m, [=] RAJA_HOST_DEVICE(Index c) {
+    const Index k = c / (m * m), j = (c / m) % m, i = c % m;
+    if (k > 0 && k < m - 1 && j > 0 && j < m - 1 && i > 0 && i < m - 1) {
+      out[c] = 0.4 * in[c] +
+               0.1 * (in[c - 1] + in[c + 1] + in[c - m] + in[c + m] +
+                      in[c - m * m] + in[c + m * m]);
+    }
+  });
+}
+
+template <typename BACKEND>
+static void stencil(raja, Index m, const double* in, double* out)
+{
+  using view_3d = RAJA::View<const double, RAJA::Layout<3, Index>>;
+  view_3d inv(in, m, m, m);
+  RAJA::View<double, RAJA::Layout<3, Index>> outv(out, m, m, m);
+  RAJA::forall<typename BACKEND::policy>(
+      RAJA::TypedRangeSegment<Index>(0, m * m * m),
+      [=] RAJA_HOST_DEVICE(Index c) {
+        const Index k = c / (m * m), j = (c / m) % m, i = c % m;
+        if (k > 0 && k < m - 1 && j > 0 && j < m - 1 && i > 0 && i < m - 1) {
+          outv(k, j, i) = 0.4 * inv(k, j, i) +
+                          0.1 * (inv(k, j, i - 1) + inv(k, j, i + 1) +
+                                 inv(k, j - 1, i) + inv(k, j + 1, i) +
+                                 inv(k - 1, j, i) + inv(k + 1, j, i));
+        }
+      });
+}
+
+template <typename BACKEND, typename VARIANT>
+static void benchmark_stencil(benchmark::State& state)
+{
+  const Index m = side(state.range(0), 3);
+  const Index n = m * m * m;
+  array<BACKEND> in(n, 1.0), out(n, 0.0);
+
+  while (state.KeepRunning()) {
+    stencil<BACKEND>(VARIANT{}, m, in.data, out.data);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(double));
+}
+
+template <typename BACKEND>
+static double dot(raw, Index n, const double* x, const double* y)
+{
+  return BACKEND::raw_sum(n, [=] RAJA_HOST_DEVICE(Index i) {
+    return x[i] * y[i];
+  });
+}
+
+template <typename BACKEND>
+static double dot(raja, Index n, const double* x, const double* y)
+{
+  RAJA::ReduceSum<typename BACKEND::reduce_policy, double> sum(0.0);
+  RAJA::forall<typename BACKEND::policy>(
+      RAJA::TypedRangeSegment<Index>(0, n),
+      [=] RAJA_HOST_DEVICE(Index i) { sum += x[i] * y[i]; });
+  return sum.get();
+}
+
+template <typename BACKEND, typename VARIANT>
+static void benchmark_dot(benchmark::State& state)
+{
+  const Index n = state.range(0);
+  array<BACKEND> x(n, 1.0), y(n, 2.0);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(dot<BACKEND>(VARIANT{}, n, x.data, y.data));
+  }
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(double));
+}
+
+template <typename BACKEND>
+static void transpose(raw, Index m, const double* in, double* out)
+{
+  BACKEND::raw_for(m * m, [=] RAJA_HOST_DEVICE(Index c) {
+    const Index i = c / m, j = c % m;
+    out[j * m + i] = in[i * m + j];
+  });
+}
+
+template <typename BACKEND>
+static void transpose(raja, Index m, const double* in, double* out)
+{
+  RAJA::View<const double, RAJA::Layout<2, Index>> inv(in, m, m);
+  RAJA::View<double, RAJA::Layout<2, Index>> outv(out, m, m);
+  RAJA::forall<typename BACKEND::policy>(
+      RAJA::TypedRangeSegment<Index>(0, m * m),
+      [=] RAJA_HOST_DEVICE(Index c) {
+        const Index i = c / m, j = c % m;
+        outv(j, i) = inv(i, j);
+      });
+}
+
+template <typename BACKEND, typename VARIANT>
+static void benchmark_transpose(benchmark::State& state)
+{
+  const Index m = side(state.range(0), 2);
+  const Index n = m * m;
+  array<BACKEND> in(n, 1.0), out(n, 0.0);
+
+  while (state.KeepRunning()) {
+    transpose<BACKEND>(VARIANT{}, m, in.data, out.data);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(double));
+}
+
+// size 1 for the launch latency up to the bandwidth bound sizes
+static void sizes(benchmark::internal::Benchmark* b)
+{
+  b->Arg(1);
+  for (Index n = 1 << 10; n <= max_size(); n *= 64) {
+    b->Arg(n);
+  }
+}
+
+//
+// Console output followed by the overhead of every RAJA run over the raw
+// run of the same kernel, back-end and size.
+//
+class OverheadReporter : public benchmark::ConsoleReporter
+{
+public:
+  void ReportRuns(const std::vector<Run>& reports) override
+  {
+    benchmark::ConsoleReporter::ReportRuns(reports);
+    for (Run const& run : reports) {
+      if (!run.error_occurred) {
+        m_times[run.benchmark_name()] = run.GetAdjustedRealTime();
+      }
+    }
+  }
+
+  void Finalize() override
+  {
+    benchmark::ConsoleReporter::Finalize();
+
+    const std::string raja_tag(", raja>");
+    const std::string raw_tag(", raw>");
+    std::ostream& out = GetOutputStream();
+    out << "\n" << std::left << std::setw(60) << "RAJA run"
+        << std::right << std::setw(12) << "overhead %" << "\n";
+    for (auto const& entry : m_times) {
+      const std::string& name = entry.first;
+      const size_t pos = name.find(raja_tag);
+      if (pos == std::string::npos) continue;
+
+      std::string raw_name(name);
+      raw_name.replace(pos, raja_tag.size(), raw_tag);
+      auto raw_run = m_times.find(raw_name);
+      if (raw_run == m_times.end() || raw_run->second <= 0.0) continue;
+
+      out << std::left << std::setw(60) << name << std::right
+          << std::setw(12) << std::fixed << std::setprecision(1)
+          << 100.0 * (entry.second - raw_run->second) / raw_run->second
+          << "\n";
+    }
+  }
+
+private:
+  std::map<std::string, double> m_times;
+};
+
+#define OVERHEAD_BENCHMARKS(backend)                                   \
+  BENCHMARK_TEMPLATE(benchmark_triad, backend, raw)->Apply(sizes);     \
+  BENCHMARK_TEMPLATE(benchmark_triad, backend, raja)->Apply(sizes);    \
+  BENCHMARK_TEMPLATE(benchmark_daxpy, backend, raw)->Apply(sizes);     \
+  BENCHMARK_TEMPLATE(benchmark_daxpy, backend, raja)->Apply(sizes);    \
+  BENCHMARK_TEMPLATE(benchmark_stencil, backend, raw)->Apply(sizes);   \
+  BENCHMARK_TEMPLATE(benchmark_stencil, backend, raja)->Apply(sizes);  \
+  BENCHMARK_TEMPLATE(benchmark_dot, backend, raw)->Apply(sizes);       \
+  BENCHMARK_TEMPLATE(benchmark_dot, backend, raja)->Apply(sizes);      \
+  BENCHMARK_TEMPLATE(benchmark_transpose, backend, raw)->Apply(sizes); \
+  BENCHMARK_TEMPLATE(benchmark_transpose, backend, raja)->Apply(sizes);
+
+OVERHEAD_BENCHMARKS(seq_backend)
+#if defined(RAJA_ENABLE_OPENMP)
+OVERHEAD_BENCHMARKS(omp_backend)
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+OVERHEAD_BENCHMARKS(cuda_backend)
+#endif
+#if defined(RAJA_ENABLE_HIP)
+OVERHEAD_BENCHMARKS(hip_backend)
+#endif
+#if defined(RAJA_ENABLE_SYCL)
+OVERHEAD_BENCHMARKS(sycl_backend)
+#endif
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+  OverheadReporter reporter;
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+  return 0;
+}
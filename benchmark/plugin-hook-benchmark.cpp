@@ -0,0 +1,61 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Overhead of the plugin hooks per launch of a tiny sequential loop.
+//
+// No plugin is registered, so the hooks return after the inline
+// plugins_active check. The walk variant sets the flag by hand so every
+// hook walks the empty PluginRegistry, which is what each launch paid
+// before the check. Compare both with the raw loop, and build with
+// RAJA_ENABLE_PLUGIN_HOOKS off to see the loops without hooks.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 4
+
+static void benchmark_raw_loop(benchmark::State& state)
+{
+  std::vector<double> vec(N, 1.0);
+  double* data = vec.data();
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < N; ++i) {
+      data[i] *= 1.0000001;
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+template <bool WALK_REGISTRY>
+static void benchmark_raja_forall(benchmark::State& state)
+{
+  std::vector<double> vec(N, 1.0);
+  double* data = vec.data();
+
+  const bool registered = RAJA::util::plugins_registered;
+  RAJA::util::plugins_registered = registered || WALK_REGISTRY;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+      data[i] *= 1.0000001;
+    });
+    benchmark::DoNotOptimize(data);
+  }
+
+  RAJA::util::plugins_registered = registered;
+}
+
+BENCHMARK(benchmark_raw_loop);
+BENCHMARK_TEMPLATE(benchmark_raja_forall, false);
+BENCHMARK_TEMPLATE(benchmark_raja_forall, true);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Scans and sorts. The sorts refill their keys with a forall before each
+// sort, so their times include one streaming pass over the keys, which is
+// small next to the sort itself.
+//
+
+#include "backends.hpp"
+
+template <typename BACKEND>
+static void benchmark_inclusive_scan(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  backend_array<BACKEND, int> in(n, [] RAJA_HOST_DEVICE(size_t i) {
+    return static_cast<int>(i % 7);
+  });
+  backend_array<BACKEND, int> out(n, [] RAJA_HOST_DEVICE(size_t) { return 0; });
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<typename BACKEND::forall_policy>(
+        RAJA::make_span(in.data, n), RAJA::make_span(out.data, n));
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, 2 * sizeof(int));
+}
+
+template <typename BACKEND>
+static void benchmark_exclusive_scan_inplace(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  // the scans accumulate over the iterations, so the values wrap around
+  backend_array<BACKEND, unsigned> data(n, [] RAJA_HOST_DEVICE(size_t i) {
+    return static_cast<unsigned>(i % 7);
+  });
+
+  while (state.KeepRunning()) {
+    RAJA::exclusive_scan_inplace<typename BACKEND::forall_policy>(
+        RAJA::make_span(data.data, n));
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, 2 * sizeof(unsigned));
+}
+
+// keys in a scattered order, as an int hash of the index
+static RAJA_HOST_DEVICE int scattered_key(size_t i)
+{
+  return static_cast<int>((i * 2654435761u) & 0x7fffffff);
+}
+
+template <typename BACKEND>
+static void benchmark_sort(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  backend_array<BACKEND, int> keys(n, [] RAJA_HOST_DEVICE(size_t i) {
+    return scattered_key(i);
+  });
+
+  while (state.KeepRunning()) {
+    keys.fill([] RAJA_HOST_DEVICE(size_t i) { return scattered_key(i); });
+    RAJA::sort<typename BACKEND::forall_policy>(RAJA::make_span(keys.data, n));
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, sizeof(int));
+}
+
+template <typename BACKEND>
+static void benchmark_sort_pairs(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  backend_array<BACKEND, int> keys(n, [] RAJA_HOST_DEVICE(size_t i) {
+    return scattered_key(i);
+  });
+  backend_array<BACKEND, double> values(n, [] RAJA_HOST_DEVICE(size_t i) {
+    return static_cast<double>(i);
+  });
+
+  while (state.KeepRunning()) {
+    keys.fill([] RAJA_HOST_DEVICE(size_t i) { return scattered_key(i); });
+    RAJA::sort_pairs<typename BACKEND::forall_policy>(
+        RAJA::make_span(keys.data, n), RAJA::make_span(values.data, n));
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, sizeof(int) + sizeof(double));
+}
+
+RAJA_SUITE_BACKENDS(benchmark_inclusive_scan, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_exclusive_scan_inplace, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_sort, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_sort_pairs, suite_sizes);
@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Atomic updates under contention. The second argument is the number of
+// addresses the n updates go to, so 1 is the most contended; neighbouring
+// iterations update different addresses, as in a histogram.
+//
+
+#include "backends.hpp"
+
+template <typename BACKEND, typename T>
+static void benchmark_atomic_add(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  const size_t num_addresses = state.range(1);
+  backend_array<BACKEND, T> sums(num_addresses, [] RAJA_HOST_DEVICE(size_t) {
+    return T(0);
+  });
+  T* s = sums.data;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename BACKEND::forall_policy>(
+        RAJA::TypedRangeSegment<size_t>(0, n),
+        [=] RAJA_HOST_DEVICE(size_t i) {
+          RAJA::atomicAdd<typename BACKEND::atomic_policy>(
+              &s[i % num_addresses], T(1));
+        });
+    BACKEND::synchronize();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename BACKEND, typename T>
+static void benchmark_atomic_max(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  const size_t num_addresses = state.range(1);
+  backend_array<BACKEND, T> maxs(num_addresses, [] RAJA_HOST_DEVICE(size_t) {
+    return T(0);
+  });
+  T* m = maxs.data;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename BACKEND::forall_policy>(
+        RAJA::TypedRangeSegment<size_t>(0, n),
+        [=] RAJA_HOST_DEVICE(size_t i) {
+          RAJA::atomicMax<typename BACKEND::atomic_policy>(
+              &m[i % num_addresses], T((i * 7919) % 1000));
+        });
+    BACKEND::synchronize();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void contention_args(benchmark::internal::Benchmark* b)
+{
+  for (long n = 1 << 14; n <= suite_max_size(); n *= 16) {
+    for (long a = 1; a <= n; a *= 64) {
+      b->Args({n, a});
+    }
+  }
+}
+
+#define RAJA_SUITE_ATOMIC(func, backend)                              \
+  BENCHMARK_TEMPLATE(func, backend, int)->Apply(contention_args);     \
+  BENCHMARK_TEMPLATE(func, backend, double)->Apply(contention_args);
+
+RAJA_SUITE_ATOMIC(benchmark_atomic_add, seq_backend)
+RAJA_SUITE_ATOMIC(benchmark_atomic_max, seq_backend)
+#if defined(RAJA_ENABLE_OPENMP)
+RAJA_SUITE_ATOMIC(benchmark_atomic_add, omp_backend)
+RAJA_SUITE_ATOMIC(benchmark_atomic_max, omp_backend)
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+RAJA_SUITE_ATOMIC(benchmark_atomic_add, cuda_backend)
+RAJA_SUITE_ATOMIC(benchmark_atomic_max, cuda_backend)
+#endif
+#if defined(RAJA_ENABLE_HIP)
+RAJA_SUITE_ATOMIC(benchmark_atomic_add, hip_backend)
+RAJA_SUITE_ATOMIC(benchmark_atomic_max, hip_backend)
+#endif
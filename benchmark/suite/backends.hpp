@@ -0,0 +1,320 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Back-ends of the benchmark suite.
+//
+// Each back-end gathers the policies one benchmark needs for every pattern,
+// so a benchmark is written once as a template on the back-end and
+// registered for every enabled back-end with RAJA_SUITE_BACKENDS, or the
+// host back-ends only with RAJA_SUITE_HOST_BACKENDS. The back-end is part of
+// the benchmark name, e.g. benchmark_forall_range<omp_backend>/65536, so the
+// JSON output of two commits can be matched by name.
+//
+
+#ifndef RAJA_BENCHMARK_SUITE_BACKENDS_HPP
+#define RAJA_BENCHMARK_SUITE_BACKENDS_HPP
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+struct seq_backend {
+  using resource = RAJA::resources::Host;
+
+  using forall_policy = RAJA::seq_exec;
+  using reduce_policy = RAJA::seq_reduce;
+  using atomic_policy = RAJA::seq_atomic;
+
+  using kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  using tiled_kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::Tile<1, RAJA::tile_fixed<32>, RAJA::seq_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<32>, RAJA::seq_exec,
+          RAJA::statement::For<1, RAJA::seq_exec,
+            RAJA::statement::For<0, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>>>>>>;
+
+  using hyperplane_kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::Hyperplane<0, RAJA::seq_exec, RAJA::ArgList<1>,
+                                  RAJA::seq_exec,
+        RAJA::statement::Lambda<0>>>;
+
+  using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>;
+  using teams_policy = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+  using threads_policy = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<RAJA::loop_work,
+                                                 RAJA::ordered,
+                                                 RAJA::ragged_array_of_objects>;
+  template <typename T>
+  using workgroup_allocator = std::allocator<T>;
+
+  static void synchronize() {}
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+struct omp_backend {
+  using resource = RAJA::resources::Host;
+
+  using forall_policy = RAJA::omp_parallel_for_exec;
+  using reduce_policy = RAJA::omp_reduce;
+  using atomic_policy = RAJA::omp_atomic;
+
+  using kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                RAJA::ArgList<1, 0>,
+        RAJA::statement::Lambda<0>>>;
+
+  using tiled_kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::Tile<1, RAJA::tile_fixed<32>, RAJA::omp_parallel_for_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<32>, RAJA::seq_exec,
+          RAJA::statement::For<1, RAJA::seq_exec,
+            RAJA::statement::For<0, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>>>>>>;
+
+  using hyperplane_kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::Hyperplane<0, RAJA::seq_exec, RAJA::ArgList<1>,
+                                  RAJA::omp_parallel_for_exec,
+        RAJA::statement::Lambda<0>>>;
+
+  using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>;
+  using teams_policy = RAJA::expt::LoopPolicy<RAJA::omp_for_exec>;
+  using threads_policy = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<RAJA::omp_work,
+                                                 RAJA::ordered,
+                                                 RAJA::ragged_array_of_objects>;
+  template <typename T>
+  using workgroup_allocator = std::allocator<T>;
+
+  static void synchronize() {}
+};
+#endif
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+// WorkGroup storage is written on the host and read by the device
+template <typename T>
+struct pinned_allocator
+{
+  using value_type = T;
+
+  pinned_allocator() = default;
+
+  template <typename U>
+  constexpr pinned_allocator(pinned_allocator<U> const&) noexcept
+  { }
+
+  value_type* allocate(size_t num)
+  {
+    value_type* ptr = nullptr;
+#if defined(RAJA_ENABLE_CUDA)
+    cudaErrchk(cudaMallocHost((void**)&ptr, num * sizeof(value_type)));
+#elif defined(RAJA_ENABLE_HIP)
+    hipErrchk(hipHostMalloc((void**)&ptr, num * sizeof(value_type)));
+#endif
+    if (!ptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  void deallocate(value_type* ptr, size_t) noexcept
+  {
+#if defined(RAJA_ENABLE_CUDA)
+    cudaErrchk(cudaFreeHost(ptr));
+#elif defined(RAJA_ENABLE_HIP)
+    hipErrchk(hipHostFree(ptr));
+#endif
+  }
+};
+
+template <typename T, typename U>
+bool operator==(pinned_allocator<T> const&, pinned_allocator<U> const&)
+{
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(pinned_allocator<T> const& lhs, pinned_allocator<U> const& rhs)
+{
+  return !(lhs == rhs);
+}
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+struct cuda_backend {
+  using resource = RAJA::resources::Cuda;
+
+  using forall_policy = RAJA::cuda_exec<256>;
+  using reduce_policy = RAJA::cuda_reduce;
+  using atomic_policy = RAJA::cuda_atomic;
+
+  using kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::CudaKernel<
+        RAJA::statement::For<1, RAJA::cuda_block_x_loop,
+          RAJA::statement::For<0, RAJA::cuda_thread_x_loop,
+            RAJA::statement::Lambda<0>>>>>;
+
+  using tiled_kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::CudaKernel<
+        RAJA::statement::Tile<1, RAJA::tile_fixed<16>, RAJA::cuda_block_y_direct,
+          RAJA::statement::Tile<0, RAJA::tile_fixed<16>, RAJA::cuda_block_x_direct,
+            RAJA::statement::For<1, RAJA::cuda_thread_y_direct,
+              RAJA::statement::For<0, RAJA::cuda_thread_x_direct,
+                RAJA::statement::Lambda<0>>>>>>>;
+
+  using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::cuda_launch_t<false>>;
+  using teams_policy = RAJA::expt::LoopPolicy<RAJA::cuda_block_x_loop>;
+  using threads_policy = RAJA::expt::LoopPolicy<RAJA::cuda_thread_x_loop>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+      RAJA::cuda_work_async<256>,
+      RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+      RAJA::constant_stride_array_of_objects>;
+  template <typename T>
+  using workgroup_allocator = pinned_allocator<T>;
+
+  static void synchronize() { RAJA::synchronize<RAJA::cuda_synchronize>(); }
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+struct hip_backend {
+  using resource = RAJA::resources::Hip;
+
+  using forall_policy = RAJA::hip_exec<256>;
+  using reduce_policy = RAJA::hip_reduce;
+  using atomic_policy = RAJA::hip_atomic;
+
+  using kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::HipKernel<
+        RAJA::statement::For<1, RAJA::hip_block_x_loop,
+          RAJA::statement::For<0, RAJA::hip_thread_x_loop,
+            RAJA::statement::Lambda<0>>>>>;
+
+  using tiled_kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::HipKernel<
+        RAJA::statement::Tile<1, RAJA::tile_fixed<16>, RAJA::hip_block_y_direct,
+          RAJA::statement::Tile<0, RAJA::tile_fixed<16>, RAJA::hip_block_x_direct,
+            RAJA::statement::For<1, RAJA::hip_thread_y_direct,
+              RAJA::statement::For<0, RAJA::hip_thread_x_direct,
+                RAJA::statement::Lambda<0>>>>>>>;
+
+  using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::hip_launch_t<false>>;
+  using teams_policy = RAJA::expt::LoopPolicy<RAJA::hip_block_x_loop>;
+  using threads_policy = RAJA::expt::LoopPolicy<RAJA::hip_thread_x_loop>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+      RAJA::hip_work_async<256>,
+      RAJA::unordered_hip_loop_y_block_iter_x_threadblock_average,
+      RAJA::constant_stride_array_of_objects>;
+  template <typename T>
+  using workgroup_allocator = pinned_allocator<T>;
+
+  static void synchronize() { RAJA::synchronize<RAJA::hip_synchronize>(); }
+};
+#endif
+
+//
+// Array of n values in the memory of a back-end, filled on the back-end
+// with f(i).
+//
+template <typename BACKEND, typename T>
+struct backend_array
+{
+  template <typename FILL>
+  backend_array(size_t n, FILL&& f)
+    : res(BACKEND::resource::get_default()),
+      data(res.template allocate<T>(n)),
+      size(n)
+  {
+    fill(std::forward<FILL>(f));
+  }
+
+  ~backend_array() { res.deallocate(data); }
+
+  backend_array(backend_array const&) = delete;
+  backend_array& operator=(backend_array const&) = delete;
+
+  template <typename FILL>
+  void fill(FILL&& f)
+  {
+    T* d = data;
+    RAJA::forall<typename BACKEND::forall_policy>(
+        RAJA::TypedRangeSegment<size_t>(0, size),
+        [=] RAJA_HOST_DEVICE(size_t i) { d[i] = f(i); });
+    BACKEND::synchronize();
+  }
+
+  typename BACKEND::resource res;
+  T* data;
+  size_t size;
+};
+
+//
+// Problem sizes from 2^10 to RAJA_BENCHMARK_MAX_SIZE, 2^22 by default, in
+// steps of 16.
+//
+inline long suite_max_size()
+{
+  const char* env = std::getenv("RAJA_BENCHMARK_MAX_SIZE");
+  const long size = env ? std::atol(env) : 0;
+  return size > 0 ? size : (1l << 22);
+}
+
+inline void suite_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(16)->Range(1 << 10, suite_max_size());
+}
+
+// set the counters every benchmark reports, per element of the problem
+inline void suite_counters(benchmark::State& state,
+                           size_t n,
+                           size_t bytes_per_element)
+{
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * bytes_per_element);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+#define RAJA_SUITE_IF_OPENMP(...) __VA_ARGS__
+#else
+#define RAJA_SUITE_IF_OPENMP(...)
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+#define RAJA_SUITE_IF_CUDA(...) __VA_ARGS__
+#else
+#define RAJA_SUITE_IF_CUDA(...)
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#define RAJA_SUITE_IF_HIP(...) __VA_ARGS__
+#else
+#define RAJA_SUITE_IF_HIP(...)
+#endif
+
+// the static_assert takes the semicolon after the macro
+#define RAJA_SUITE_HOST_BACKENDS(func, args)                               \
+  BENCHMARK_TEMPLATE(func, seq_backend)->Apply(args);                      \
+  RAJA_SUITE_IF_OPENMP(BENCHMARK_TEMPLATE(func, omp_backend)->Apply(args);) \
+  static_assert(true, "")
+
+#define RAJA_SUITE_BACKENDS(func, args)                                    \
+  RAJA_SUITE_HOST_BACKENDS(func, args);                                    \
+  RAJA_SUITE_IF_CUDA(BENCHMARK_TEMPLATE(func, cuda_backend)->Apply(args);) \
+  RAJA_SUITE_IF_HIP(BENCHMARK_TEMPLATE(func, hip_backend)->Apply(args);)   \
+  static_assert(true, "")
+
+#endif
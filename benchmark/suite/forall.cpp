@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// daxpy with forall over a RangeSegment, a ListSegment and a TypedIndexSet
+// of a range and a list. The list visits the whole array in a scattered
+// order, so each element is still read and written once.
+//
+
+#include <vector>
+
+#include "backends.hpp"
+
+using list_segment = RAJA::TypedListSegment<RAJA::Index_type>;
+
+// the indices i * 7919 mod n, a permutation of [0, n) for n a power of two
+static std::vector<RAJA::Index_type> scattered_indices(RAJA::Index_type begin,
+                                                       RAJA::Index_type end)
+{
+  const RAJA::Index_type len = end - begin;
+  std::vector<RAJA::Index_type> indices(len);
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    indices[i] = begin + (i * 7919) % len;
+  }
+  return indices;
+}
+
+template <typename BACKEND>
+static void benchmark_forall_range(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  backend_array<BACKEND, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<BACKEND, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+  double* xd = x.data;
+  double* yd = y.data;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename BACKEND::forall_policy>(
+        RAJA::TypedRangeSegment<RAJA::Index_type>(0, n),
+        [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { yd[i] += 3.0 * xd[i]; });
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, 3 * sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_forall_list(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  backend_array<BACKEND, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<BACKEND, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+  double* xd = x.data;
+  double* yd = y.data;
+
+  std::vector<RAJA::Index_type> indices = scattered_indices(0, n);
+  list_segment list(indices.data(), n, x.res);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename BACKEND::forall_policy>(
+        list,
+        [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { yd[i] += 3.0 * xd[i]; });
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, 3 * sizeof(double) + sizeof(RAJA::Index_type));
+}
+
+template <typename BACKEND>
+static void benchmark_forall_indexset(benchmark::State& state)
+{
+  const size_t n = state.range(0);
+  backend_array<BACKEND, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<BACKEND, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+  double* xd = x.data;
+  double* yd = y.data;
+
+  std::vector<RAJA::Index_type> indices = scattered_indices(n / 2, n);
+  RAJA::TypedIndexSet<RAJA::RangeSegment, list_segment> iset;
+  iset.push_back(RAJA::RangeSegment(0, n / 2));
+  iset.push_back(list_segment(indices.data(), indices.size(), x.res));
+
+  using iset_policy =
+      RAJA::ExecPolicy<RAJA::seq_segit, typename BACKEND::forall_policy>;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<iset_policy>(
+        iset,
+        [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { yd[i] += 3.0 * xd[i]; });
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, 3 * sizeof(double));
+}
+
+RAJA_SUITE_BACKENDS(benchmark_forall_range, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_forall_list, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_forall_indexset, suite_sizes);
@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Kernel nests over a square of the problem size: a matrix transpose with
+// the plain nest of the back-end, which is a Collapse for OpenMP, and with
+// 2d tiles, and a wavefront with a RAW dependence on both neighbours run as
+// a Hyperplane on the host back-ends.
+//
+
+#include "backends.hpp"
+
+using view_2d = RAJA::View<double, RAJA::Layout<2, RAJA::Index_type>>;
+
+// side of the square, the problem sizes are even powers of two
+static RAJA::Index_type square_side(size_t n)
+{
+  RAJA::Index_type side = 1;
+  while (static_cast<size_t>(side * side) < n) {
+    side *= 2;
+  }
+  return side;
+}
+
+template <typename BACKEND, typename KERNEL_POLICY>
+static void run_transpose(benchmark::State& state)
+{
+  const RAJA::Index_type side = square_side(state.range(0));
+  const size_t n = side * side;
+  backend_array<BACKEND, double> a(n, [] RAJA_HOST_DEVICE(size_t i) {
+    return static_cast<double>(i);
+  });
+  backend_array<BACKEND, double> b(n, [] RAJA_HOST_DEVICE(size_t) { return 0.0; });
+  view_2d av(a.data, side, side);
+  view_2d bv(b.data, side, side);
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KERNEL_POLICY>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<RAJA::Index_type>(0, side),
+                         RAJA::TypedRangeSegment<RAJA::Index_type>(0, side)),
+        [=] RAJA_HOST_DEVICE(RAJA::Index_type i, RAJA::Index_type j) {
+          bv(i, j) = av(j, i);
+        });
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, 2 * sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_kernel_nested(benchmark::State& state)
+{
+  run_transpose<BACKEND, typename BACKEND::kernel_policy>(state);
+}
+
+template <typename BACKEND>
+static void benchmark_kernel_tiled(benchmark::State& state)
+{
+  run_transpose<BACKEND, typename BACKEND::tiled_kernel_policy>(state);
+}
+
+template <typename BACKEND>
+static void benchmark_kernel_hyperplane(benchmark::State& state)
+{
+  const RAJA::Index_type side = square_side(state.range(0));
+  const size_t n = side * side;
+  backend_array<BACKEND, double> a(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  view_2d av(a.data, side, side);
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<typename BACKEND::hyperplane_kernel_policy>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<RAJA::Index_type>(1, side),
+                         RAJA::TypedRangeSegment<RAJA::Index_type>(1, side)),
+        [=](RAJA::Index_type i, RAJA::Index_type j) {
+          av(i, j) = 0.5 * (av(i - 1, j) + av(i, j - 1));
+        });
+  }
+  suite_counters(state, n, sizeof(double));
+}
+
+RAJA_SUITE_BACKENDS(benchmark_kernel_nested, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_kernel_tiled, suite_sizes);
+RAJA_SUITE_HOST_BACKENDS(benchmark_kernel_hyperplane, suite_sizes);
@@ -0,0 +1,51 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// daxpy as a RAJA Teams launch of teams of 256 threads, for the overhead of
+// launch and of the team and thread loops against forall.
+//
+
+#include "backends.hpp"
+
+template <typename BACKEND>
+static void benchmark_launch_teams(benchmark::State& state)
+{
+  constexpr RAJA::Index_type team_size = 256;
+  const RAJA::Index_type n = state.range(0);
+  const RAJA::Index_type num_teams = (n + team_size - 1) / team_size;
+  backend_array<BACKEND, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<BACKEND, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+  double* xd = x.data;
+  double* yd = y.data;
+
+  using teams_policy = typename BACKEND::teams_policy;
+  using threads_policy = typename BACKEND::threads_policy;
+
+  while (state.KeepRunning()) {
+    RAJA::expt::launch<typename BACKEND::launch_policy>(
+        RAJA::expt::Grid(RAJA::expt::Teams(num_teams),
+                         RAJA::expt::Threads(team_size)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+          RAJA::expt::loop<teams_policy>(
+              ctx, RAJA::TypedRangeSegment<RAJA::Index_type>(0, num_teams),
+              [&](RAJA::Index_type t) {
+                RAJA::expt::loop<threads_policy>(
+                    ctx, RAJA::TypedRangeSegment<RAJA::Index_type>(0, team_size),
+                    [&](RAJA::Index_type j) {
+                      const RAJA::Index_type i = t * team_size + j;
+                      if (i < n) {
+                        yd[i] += 3.0 * xd[i];
+                      }
+                    });
+              });
+        });
+    BACKEND::synchronize();
+  }
+  suite_counters(state, n, 3 * sizeof(double));
+}
+
+RAJA_SUITE_BACKENDS(benchmark_launch_teams, suite_sizes);
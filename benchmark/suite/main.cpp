@@ -0,0 +1,17 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Benchmark suite covering the RAJA patterns on every enabled back-end, see
+// backends.hpp. Select benchmarks with --benchmark_filter, e.g.
+// --benchmark_filter='omp_backend' for one back-end, and write results with
+// --benchmark_out=<file>.json --benchmark_out_format=json to compare two
+// builds with compare.py of Google Benchmark.
+//
+
+#include "benchmark/benchmark.h"
+
+BENCHMARK_MAIN();
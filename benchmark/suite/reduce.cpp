@@ -0,0 +1,239 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// One forall with one reducer for each reducer type, and the param
+// reductions of forall, over the same data. Compare each with
+// benchmark_reduce_sum, the cheapest reducer.
+//
+
+#include "backends.hpp"
+
+template <typename BACKEND>
+struct reduce_data
+{
+  explicit reduce_data(size_t n)
+    : values(n, [] RAJA_HOST_DEVICE(size_t i) {
+        return static_cast<double>((i * 7919) % 1000) - 500.0;
+      }),
+      bits(n, [] RAJA_HOST_DEVICE(size_t i) {
+        return static_cast<int>(i * 2654435761u);
+      }),
+      range(0, n)
+  {
+  }
+
+  backend_array<BACKEND, double> values;
+  backend_array<BACKEND, int> bits;
+  RAJA::TypedRangeSegment<RAJA::Index_type> range;
+};
+
+template <typename BACKEND>
+static void benchmark_reduce_sum(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<typename BACKEND::reduce_policy, double> sum(0.0);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { sum += data[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  suite_counters(state, d.range.size(), sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_min(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMin<typename BACKEND::reduce_policy, double> min(1.0e30);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { min.min(data[i]); });
+    benchmark::DoNotOptimize(min.get());
+  }
+  suite_counters(state, d.range.size(), sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_max(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMax<typename BACKEND::reduce_policy, double> max(-1.0e30);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { max.max(data[i]); });
+    benchmark::DoNotOptimize(max.get());
+  }
+  suite_counters(state, d.range.size(), sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_minloc(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<typename BACKEND::reduce_policy, double> minloc(1.0e30, -1);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) {
+          minloc.minloc(data[i], i);
+        });
+    benchmark::DoNotOptimize(minloc.getLoc());
+  }
+  suite_counters(state, d.range.size(), sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_maxloc(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMaxLoc<typename BACKEND::reduce_policy, double> maxloc(-1.0e30, -1);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) {
+          maxloc.maxloc(data[i], i);
+        });
+    benchmark::DoNotOptimize(maxloc.getLoc());
+  }
+  suite_counters(state, d.range.size(), sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_bitor(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const int* data = d.bits.data;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceBitOr<typename BACKEND::reduce_policy, int> bits(0);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { bits |= data[i]; });
+    benchmark::DoNotOptimize(bits.get());
+  }
+  suite_counters(state, d.range.size(), sizeof(int));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_bitand(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const int* data = d.bits.data;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceBitAnd<typename BACKEND::reduce_policy, int> bits(~0);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { bits &= data[i]; });
+    benchmark::DoNotOptimize(bits.get());
+  }
+  suite_counters(state, d.range.size(), sizeof(int));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_multi(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+
+  using values = RAJA::reduce::multi_value<RAJA::reduce::sum<double>,
+                                           RAJA::reduce::min<double>,
+                                           RAJA::reduce::max<double>>;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMulti<typename BACKEND::reduce_policy, values> stats(
+        values(0.0, 1.0e30, -1.0e30));
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) {
+          stats.reduce(data[i], data[i], data[i]);
+        });
+    benchmark::DoNotOptimize(stats.template get<0>());
+  }
+  suite_counters(state, d.range.size(), sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_sum_array(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+  const int* bits = d.bits.data;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSumArray<typename BACKEND::reduce_policy, double, 16> sums(0.0);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) {
+          sums.add(bits[i] & 15, data[i]);
+        });
+    benchmark::DoNotOptimize(sums.get(0));
+  }
+  suite_counters(state, d.range.size(), sizeof(double) + sizeof(int));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_reproducible_sum(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+
+  using reduce_policy =
+      RAJA::reproducible_reduce<typename BACKEND::reduce_policy>;
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range, [=] RAJA_HOST_DEVICE(RAJA::Index_type i) { sum += data[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  suite_counters(state, d.range.size(), sizeof(double));
+}
+
+template <typename BACKEND>
+static void benchmark_reduce_param(benchmark::State& state)
+{
+  reduce_data<BACKEND> d(state.range(0));
+  const double* data = d.values.data;
+
+  while (state.KeepRunning()) {
+    double sum = 0.0;
+    double min = 1.0e30;
+    double max = -1.0e30;
+    RAJA::forall<typename BACKEND::forall_policy>(
+        d.range,
+        RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+        RAJA::expt::Reduce<RAJA::operators::minimum>(&min),
+        RAJA::expt::Reduce<RAJA::operators::maximum>(&max),
+        [=] RAJA_HOST_DEVICE(RAJA::Index_type i, double& s, double& mn,
+                             double& mx) {
+          s += data[i];
+          mn = RAJA_MIN(data[i], mn);
+          mx = RAJA_MAX(data[i], mx);
+        });
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(min);
+    benchmark::DoNotOptimize(max);
+  }
+  suite_counters(state, d.range.size(), sizeof(double));
+}
+
+RAJA_SUITE_BACKENDS(benchmark_reduce_sum, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_min, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_max, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_minloc, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_maxloc, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_bitor, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_bitand, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_multi, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_sum_array, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_reproducible_sum, suite_sizes);
+RAJA_SUITE_BACKENDS(benchmark_reduce_param, suite_sizes);
@@ -0,0 +1,90 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Tensor registers on the host: daxpy and a dot product with the default
+// VectorRegister against the scalar forms, which the compiler may or may
+// not vectorize. The problem sizes are multiples of the register width, so
+// only full registers are used.
+//
+
+#include "backends.hpp"
+
+using vector_t = RAJA::VectorRegister<double>;
+using vector_index = RAJA::VectorIndex<int, vector_t>;
+using view_1d = RAJA::View<double, RAJA::Layout<1, int>>;
+
+static void benchmark_tensor_axpy_scalar(benchmark::State& state)
+{
+  const int n = state.range(0);
+  backend_array<seq_backend, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<seq_backend, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+  view_1d xv(x.data, n);
+  view_1d yv(y.data, n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::loop_exec>(RAJA::TypedRangeSegment<int>(0, n),
+                                  [=](int i) { yv(i) += 3.0 * xv(i); });
+    benchmark::DoNotOptimize(y.data);
+  }
+  suite_counters(state, n, 3 * sizeof(double));
+}
+
+static void benchmark_tensor_axpy_register(benchmark::State& state)
+{
+  const int n = state.range(0);
+  backend_array<seq_backend, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<seq_backend, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+  view_1d xv(x.data, n);
+  view_1d yv(y.data, n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::vector_exec<vector_t>>(
+        RAJA::TypedRangeSegment<int>(0, n),
+        [=](vector_index i) { yv(i) += 3.0 * xv(i); });
+    benchmark::DoNotOptimize(y.data);
+  }
+  suite_counters(state, n, 3 * sizeof(double));
+}
+
+static void benchmark_tensor_dot_scalar(benchmark::State& state)
+{
+  const int n = state.range(0);
+  backend_array<seq_backend, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<seq_backend, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+  const double* xd = x.data;
+  const double* yd = y.data;
+
+  while (state.KeepRunning()) {
+    double dot = 0.0;
+    for (int i = 0; i < n; ++i) {
+      dot += xd[i] * yd[i];
+    }
+    benchmark::DoNotOptimize(dot);
+  }
+  suite_counters(state, n, 2 * sizeof(double));
+}
+
+static void benchmark_tensor_dot_register(benchmark::State& state)
+{
+  const int n = state.range(0);
+  backend_array<seq_backend, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<seq_backend, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+  view_1d xv(x.data, n);
+  view_1d yv(y.data, n);
+
+  auto all = vector_index::range(0, n);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(xv(all).dot(yv(all)));
+  }
+  suite_counters(state, n, 2 * sizeof(double));
+}
+
+BENCHMARK(benchmark_tensor_axpy_scalar)->Apply(suite_sizes);
+BENCHMARK(benchmark_tensor_axpy_register)->Apply(suite_sizes);
+BENCHMARK(benchmark_tensor_dot_scalar)->Apply(suite_sizes);
+BENCHMARK(benchmark_tensor_dot_register)->Apply(suite_sizes);
@@ -0,0 +1,58 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// daxpy split in many short loops run as one WorkGroup, as in a halo
+// exchange. The second argument is the number of loops; each iteration
+// enqueues, instantiates and runs the group, so the time includes the cost
+// of the WorkPool as well as the fused run.
+//
+
+#include "backends.hpp"
+
+template <typename BACKEND>
+static void benchmark_workgroup(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const RAJA::Index_type num_loops = state.range(1);
+  const RAJA::Index_type len = n / num_loops;
+  backend_array<BACKEND, double> x(n, [] RAJA_HOST_DEVICE(size_t) { return 1.0; });
+  backend_array<BACKEND, double> y(n, [] RAJA_HOST_DEVICE(size_t) { return 2.0; });
+
+  using policy = typename BACKEND::workgroup_policy;
+  using allocator = typename BACKEND::template workgroup_allocator<char>;
+  using workpool = RAJA::WorkPool<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+  using workgroup = RAJA::WorkGroup<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+  using worksite = RAJA::WorkSite<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+
+  workpool pool(allocator{});
+
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type l = 0; l < num_loops; ++l) {
+      double* xd = x.data + l * len;
+      double* yd = y.data + l * len;
+      pool.enqueue(RAJA::TypedRangeSegment<RAJA::Index_type>(0, len),
+                   [=] RAJA_HOST_DEVICE(RAJA::Index_type i) {
+                     yd[i] += 3.0 * xd[i];
+                   });
+    }
+    workgroup group = pool.instantiate();
+    worksite site = group.run();
+    BACKEND::synchronize();
+  }
+  suite_counters(state, num_loops * len, 3 * sizeof(double));
+}
+
+static void workgroup_args(benchmark::internal::Benchmark* b)
+{
+  for (long n = 1 << 14; n <= suite_max_size(); n *= 16) {
+    for (long loops : {16, 256}) {
+      b->Args({n, loops});
+    }
+  }
+}
+
+RAJA_SUITE_BACKENDS(benchmark_workgroup, workgroup_args);
@@ -0,0 +1,738 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Tensor register kernels against plain loops and BLAS, on a roofline.
+//
+// Daxpy, dot, a small GEMM, batched 3x3 and 8x8 GEMMs and a gather are run
+// with each register policy the file is compiled for (scalar, avx, avx2 and
+// avx512 on the host, cuda_warp and hip_wave on gpus), with loops the
+// compiler may vectorize, and with BLAS on the host when CMake found one.
+//
+// The roofline benchmarks run first and measure the bandwidth of a STREAM
+// triad and the FMA throughput of each register; the best of them is the
+// roofline of the target. Every kernel reports its GFLOP/s and GB/s, and
+// the fraction of the roofline it attains at its arithmetic intensity,
+// which needs both roofline benchmarks to have run.
+//
+
+#include <algorithm>
+#include <chrono>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_BENCHMARK_HAVE_BLAS)
+extern "C" {
+void daxpy_(const int* n, const double* a, const double* x, const int* incx,
+            double* y, const int* incy);
+double ddot_(const int* n, const double* x, const int* incx,
+             const double* y, const int* incy);
+void dgemm_(const char* transa, const char* transb,
+            const int* m, const int* n, const int* k,
+            const double* alpha, const double* a, const int* lda,
+            const double* b, const int* ldb,
+            const double* beta, double* c, const int* ldc);
+}
+#endif
+
+using clock_type = std::chrono::steady_clock;
+
+using view_1d = RAJA::View<double, RAJA::Layout<1, int>>;
+using view_2d = RAJA::View<double, RAJA::Layout<2, int>>;
+
+//
+// Targets run groups of work, each on one thread on the host and on one
+// warp or wavefront on gpus, so one group drives one register.
+//
+struct host_target {
+  using loop_policy = RAJA::loop_exec;
+  using reduce_policy = RAJA::seq_reduce;
+
+  template <typename REG>
+  using matrix_type =
+      RAJA::SquareMatrixRegister<double, RAJA::RowMajorLayout, REG>;
+
+  static constexpr int probe_groups = 1;
+
+  template <typename T>
+  static T* allocate(size_t n)
+  {
+    return new T[n];
+  }
+
+  template <typename T>
+  static void deallocate(T* ptr)
+  {
+    delete[] ptr;
+  }
+
+  static void synchronize() {}
+
+  template <typename BODY>
+  static void exec_groups(int num_groups, BODY const& body)
+  {
+    for (int g = 0; g < num_groups; ++g) {
+      body(g);
+    }
+  }
+};
+
+#if defined(RAJA_ENABLE_CUDA)
+struct cuda_target {
+  using loop_policy = RAJA::cuda_exec_async<256>;
+  using reduce_policy = RAJA::cuda_reduce;
+
+  template <typename REG>
+  using matrix_type =
+      RAJA::RectMatrixRegister<double, RAJA::RowMajorLayout, 8, 8, REG>;
+
+  static constexpr int lanes = 32;
+  static constexpr int probe_groups = 1 << 16;
+
+  template <typename T>
+  static T* allocate(size_t n)
+  {
+    T* ptr = nullptr;
+    cudaErrchk(cudaMallocManaged(&ptr, n * sizeof(T)));
+    return ptr;
+  }
+
+  template <typename T>
+  static void deallocate(T* ptr)
+  {
+    cudaErrchk(cudaFree(ptr));
+  }
+
+  static void synchronize() { cudaErrchk(cudaDeviceSynchronize()); }
+
+  template <typename BODY>
+  static void exec_groups(int num_groups, BODY const& body)
+  {
+    RAJA::forall<RAJA::cuda_exec_async<lanes>>(
+        RAJA::TypedRangeSegment<int>(0, num_groups * lanes),
+        [=] RAJA_DEVICE(int t) { body(t / lanes); });
+  }
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+struct hip_target {
+  using loop_policy = RAJA::hip_exec_async<256>;
+  using reduce_policy = RAJA::hip_reduce;
+
+  template <typename REG>
+  using matrix_type =
+      RAJA::RectMatrixRegister<double, RAJA::RowMajorLayout, 8, 8, REG>;
+
+  static constexpr int lanes = 64;
+  static constexpr int probe_groups = 1 << 16;
+
+  template <typename T>
+  static T* allocate(size_t n)
+  {
+    T* ptr = nullptr;
+    hipErrchk(hipMallocManaged(&ptr, n * sizeof(T)));
+    return ptr;
+  }
+
+  template <typename T>
+  static void deallocate(T* ptr)
+  {
+    hipErrchk(hipFree(ptr));
+  }
+
+  static void synchronize() { hipErrchk(hipDeviceSynchronize()); }
+
+  template <typename BODY>
+  static void exec_groups(int num_groups, BODY const& body)
+  {
+    RAJA::forall<RAJA::hip_exec_async<lanes>>(
+        RAJA::TypedRangeSegment<int>(0, num_groups * lanes),
+        [=] RAJA_DEVICE(int t) { body(t / lanes); });
+  }
+};
+#endif
+
+template <typename TARGET>
+static double target_sum(double* values, int n)
+{
+  RAJA::ReduceSum<typename TARGET::reduce_policy, double> sum(0.0);
+  RAJA::forall<typename TARGET::loop_policy>(
+      RAJA::TypedRangeSegment<int>(0, n),
+      [=] RAJA_HOST_DEVICE(int i) { sum += values[i]; });
+  return sum.get();
+}
+
+//
+// The roofline of each target, the best bandwidth and FMA throughput seen
+// by the roofline benchmarks.
+//
+template <typename TARGET>
+struct roofline {
+  static double flops;
+  static double bytes;
+};
+
+template <typename TARGET>
+double roofline<TARGET>::flops = 0.0;
+
+template <typename TARGET>
+double roofline<TARGET>::bytes = 0.0;
+
+template <typename TARGET>
+static void report_roofline(benchmark::State& state,
+                            clock_type::duration elapsed,
+                            double flops_per_iter,
+                            double bytes_per_iter)
+{
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  const double flops = flops_per_iter * state.iterations() / seconds;
+  const double bytes = bytes_per_iter * state.iterations() / seconds;
+
+  state.counters["GFLOP/s"] = flops / 1.0e9;
+  state.counters["GB/s"] = bytes / 1.0e9;
+  state.counters["flop/byte"] = flops_per_iter / bytes_per_iter;
+  if (roofline<TARGET>::flops > 0.0 && roofline<TARGET>::bytes > 0.0) {
+    state.counters["roofline"] = std::max(flops / roofline<TARGET>::flops,
+                                          bytes / roofline<TARGET>::bytes);
+  }
+}
+
+template <typename TARGET>
+static void benchmark_roofline_bandwidth(benchmark::State& state)
+{
+  const int n = 1 << 24;
+  double* a = TARGET::template allocate<double>(n);
+  double* b = TARGET::template allocate<double>(n);
+  double* c = TARGET::template allocate<double>(n);
+  for (int i = 0; i < n; ++i) {
+    a[i] = 0.0;
+    b[i] = 1.0;
+    c[i] = 2.0;
+  }
+
+  auto triad = [=]() {
+    RAJA::forall<typename TARGET::loop_policy>(
+        RAJA::TypedRangeSegment<int>(0, n),
+        [=] RAJA_HOST_DEVICE(int i) { a[i] = b[i] + 3.0 * c[i]; });
+    TARGET::synchronize();
+  };
+  triad();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    triad();
+  }
+  const double seconds =
+      std::chrono::duration<double>(clock_type::now() - start).count();
+  const double bytes = 24.0 * n * state.iterations() / seconds;
+  roofline<TARGET>::bytes = std::max(roofline<TARGET>::bytes, bytes);
+  state.counters["GB/s"] = bytes / 1.0e9;
+
+  TARGET::deallocate(c);
+  TARGET::deallocate(b);
+  TARGET::deallocate(a);
+}
+
+// independent chains of FMAs, enough of them to hide the FMA latency
+template <typename TARGET, typename REG>
+static void benchmark_roofline_flops(benchmark::State& state)
+{
+  using register_t = RAJA::Register<double, REG>;
+  constexpr int chains = 8;
+  constexpr int reps = 1 << 12;
+  const int groups = TARGET::probe_groups;
+  const int width = register_t::s_num_elem;
+  double* out = TARGET::template allocate<double>(groups * width);
+
+  auto fmas = [=]() {
+    TARGET::exec_groups(groups, [=] RAJA_HOST_DEVICE(int g) {
+      register_t acc[chains];
+      for (int c = 0; c < chains; ++c) {
+        acc[c] = register_t(1.0 + c);
+      }
+      const register_t scale(0.999);
+      const register_t shift(0.001);
+      for (int r = 0; r < reps; ++r) {
+        for (int c = 0; c < chains; ++c) {
+          acc[c] = acc[c].multiply_add(scale, shift);
+        }
+      }
+      register_t sum(0.0);
+      for (int c = 0; c < chains; ++c) {
+        sum = sum + acc[c];
+      }
+      sum.store_packed(out + g * width);
+    });
+    TARGET::synchronize();
+  };
+  fmas();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    fmas();
+  }
+  const double seconds =
+      std::chrono::duration<double>(clock_type::now() - start).count();
+  const double flops =
+      2.0 * width * chains * reps * groups * state.iterations() / seconds;
+  roofline<TARGET>::flops = std::max(roofline<TARGET>::flops, flops);
+  state.counters["GFLOP/s"] = flops / 1.0e9;
+
+  TARGET::deallocate(out);
+}
+
+//
+// Implementations of the kernels. All matrices are row major and the
+// batched matrices are in the layout the implementation asks for.
+//
+template <typename TARGET>
+struct loop_impl {
+  using target = TARGET;
+  using loop_policy = typename TARGET::loop_policy;
+  using index_type = int;
+
+  template <int M>
+  static size_t batch_size(int num_batch)
+  {
+    return static_cast<size_t>(num_batch) * M * M;
+  }
+
+  static void daxpy(int n, double a, double* x, double* y)
+  {
+    RAJA::forall<loop_policy>(RAJA::TypedRangeSegment<int>(0, n),
+                              [=] RAJA_HOST_DEVICE(int i) { y[i] += a * x[i]; });
+  }
+
+  static double dot(int n, double* x, double* y, double*)
+  {
+    RAJA::ReduceSum<typename TARGET::reduce_policy, double> dot(0.0);
+    RAJA::forall<loop_policy>(RAJA::TypedRangeSegment<int>(0, n),
+                              [=] RAJA_HOST_DEVICE(int i) { dot += x[i] * y[i]; });
+    return dot.get();
+  }
+
+  // one row of C for each iteration, in the order that vectorizes over j
+  static void gemm(int n, double* A, double* B, double* C)
+  {
+    RAJA::forall<loop_policy>(
+        RAJA::TypedRangeSegment<int>(0, n), [=] RAJA_HOST_DEVICE(int i) {
+          for (int j = 0; j < n; ++j) {
+            C[i * n + j] = 0.0;
+          }
+          for (int k = 0; k < n; ++k) {
+            const double a = A[i * n + k];
+            for (int j = 0; j < n; ++j) {
+              C[i * n + j] += a * B[k * n + j];
+            }
+          }
+        });
+  }
+
+  template <int M>
+  static void batched_gemm(int num_batch, double* A, double* B, double* C)
+  {
+    RAJA::forall<loop_policy>(
+        RAJA::TypedRangeSegment<int>(0, num_batch),
+        [=] RAJA_HOST_DEVICE(int b) {
+          const double* a = A + b * M * M;
+          const double* bm = B + b * M * M;
+          double* c = C + b * M * M;
+          for (int i = 0; i < M; ++i) {
+            for (int j = 0; j < M; ++j) {
+              double sum = 0.0;
+              for (int k = 0; k < M; ++k) {
+                sum += a[i * M + k] * bm[k * M + j];
+              }
+              c[i * M + j] = sum;
+            }
+          }
+        });
+  }
+
+  static void gather(int n, double* x, index_type* idx, double* y)
+  {
+    RAJA::forall<loop_policy>(RAJA::TypedRangeSegment<int>(0, n),
+                              [=] RAJA_HOST_DEVICE(int i) { y[i] = x[idx[i]]; });
+  }
+};
+
+template <typename TARGET, typename REG>
+struct tensor_impl {
+  using target = TARGET;
+  using vector_t = RAJA::VectorRegister<double, REG>;
+  using vector_index = RAJA::VectorIndex<int, vector_t>;
+  using register_t = RAJA::Register<double, REG>;
+  using int_vector_t = typename register_t::int_vector_type;
+  using index_type = typename int_vector_t::element_type;
+  using matrix_t = typename TARGET::template matrix_type<REG>;
+
+  template <int M>
+  using batch_t = RAJA::BatchMatrix<double, M, M, REG>;
+
+  // elements of a vector kernel done by one group
+  static constexpr int chunk = 1024;
+
+  template <int M>
+  static size_t batch_size(int num_batch)
+  {
+    return batch_t<M>::layout_type::size(num_batch);
+  }
+
+  static void daxpy(int n, double a, double* x, double* y)
+  {
+    view_1d xv(x, n);
+    view_1d yv(y, n);
+    TARGET::exec_groups(n / chunk, [=] RAJA_HOST_DEVICE(int g) {
+      auto i = vector_index::range(g * chunk, (g + 1) * chunk);
+      yv(i) += a * xv(i);
+    });
+  }
+
+  static double dot(int n, double* x, double* y, double* partials)
+  {
+    view_1d xv(x, n);
+    view_1d yv(y, n);
+    TARGET::exec_groups(n / chunk, [=] RAJA_HOST_DEVICE(int g) {
+      auto i = vector_index::range(g * chunk, (g + 1) * chunk);
+      partials[g] = xv(i).dot(yv(i));
+    });
+    return target_sum<TARGET>(partials, n / chunk);
+  }
+
+  static void gemm(int n, double* A, double* B, double* C)
+  {
+    using A_matrix_t = matrix_t;
+    using B_matrix_t = typename matrix_t::transpose_type;
+    using C_matrix_t = typename matrix_t::product_type;
+
+    view_2d Av(A, n, n);
+    view_2d Bv(B, n, n);
+    view_2d Cv(C, n, n);
+    TARGET::exec_groups(1, [=] RAJA_HOST_DEVICE(int) {
+      auto A_rows = RAJA::RowIndex<int, A_matrix_t>::range(0, n);
+      auto A_cols = RAJA::ColIndex<int, A_matrix_t>::range(0, n);
+      auto B_rows = RAJA::RowIndex<int, B_matrix_t>::range(0, n);
+      auto B_cols = RAJA::ColIndex<int, B_matrix_t>::range(0, n);
+      auto C_rows = RAJA::RowIndex<int, C_matrix_t>::range(0, n);
+      auto C_cols = RAJA::ColIndex<int, C_matrix_t>::range(0, n);
+
+      Cv(C_rows, C_cols) = Av(A_rows, A_cols) * Bv(B_rows, B_cols);
+    });
+  }
+
+  template <int M>
+  static void batched_gemm(int num_batch, double* A, double* B, double* C)
+  {
+    using layout_t = typename batch_t<M>::layout_type;
+    TARGET::exec_groups(layout_t::num_groups(num_batch),
+                        [=] RAJA_HOST_DEVICE(int g) {
+      batch_t<M> a;
+      batch_t<M> b;
+      a.load_group(A, g, num_batch);
+      b.load_group(B, g, num_batch);
+      (a * b).store_group(C, g, num_batch);
+    });
+  }
+
+  static void gather(int n, double* x, index_type* idx, double* y)
+  {
+    TARGET::exec_groups(n / chunk, [=] RAJA_HOST_DEVICE(int g) {
+      for (int i = g * chunk; i < (g + 1) * chunk;
+           i += register_t::s_num_elem) {
+        int_vector_t offsets;
+        offsets.load_packed(idx + i);
+        register_t v;
+        v.gather(x, offsets);
+        v.store_packed(y + i);
+      }
+    });
+  }
+};
+
+#if defined(RAJA_BENCHMARK_HAVE_BLAS)
+// BLAS is column major, so C = A B is done as C^T = B^T A^T
+struct blas_impl {
+  using target = host_target;
+  using index_type = int;
+
+  template <int M>
+  static size_t batch_size(int num_batch)
+  {
+    return static_cast<size_t>(num_batch) * M * M;
+  }
+
+  static void daxpy(int n, double a, double* x, double* y)
+  {
+    const int inc = 1;
+    daxpy_(&n, &a, x, &inc, y, &inc);
+  }
+
+  static double dot(int n, double* x, double* y, double*)
+  {
+    const int inc = 1;
+    return ddot_(&n, x, &inc, y, &inc);
+  }
+
+  static void gemm(int n, double* A, double* B, double* C)
+  {
+    const double one = 1.0;
+    const double zero = 0.0;
+    dgemm_("N", "N", &n, &n, &n, &one, B, &n, A, &n, &zero, C, &n);
+  }
+
+  // a dgemm for each matrix, as the batched interfaces are not portable
+  template <int M>
+  static void batched_gemm(int num_batch, double* A, double* B, double* C)
+  {
+    const int m = M;
+    const double one = 1.0;
+    const double zero = 0.0;
+    for (int b = 0; b < num_batch; ++b) {
+      dgemm_("N", "N", &m, &m, &m, &one, B + b * M * M, &m, A + b * M * M, &m,
+             &zero, C + b * M * M, &m);
+    }
+  }
+};
+#endif
+
+//
+// The kernels, each timed with the target synchronized after every
+// iteration.
+//
+template <typename IMPL>
+static void benchmark_daxpy(benchmark::State& state)
+{
+  using target = typename IMPL::target;
+  const int n = static_cast<int>(state.range(0));
+  double* x = target::template allocate<double>(n);
+  double* y = target::template allocate<double>(n);
+  for (int i = 0; i < n; ++i) {
+    x[i] = 1.0;
+    y[i] = 2.0;
+  }
+  IMPL::daxpy(n, 1.0e-3, x, y);
+  target::synchronize();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    IMPL::daxpy(n, 1.0e-3, x, y);
+    target::synchronize();
+  }
+  report_roofline<target>(state, clock_type::now() - start, 2.0 * n, 24.0 * n);
+
+  target::deallocate(y);
+  target::deallocate(x);
+}
+
+template <typename IMPL>
+static void benchmark_dot(benchmark::State& state)
+{
+  using target = typename IMPL::target;
+  const int n = static_cast<int>(state.range(0));
+  double* x = target::template allocate<double>(n);
+  double* y = target::template allocate<double>(n);
+  double* partials = target::template allocate<double>(n / 1024);
+  for (int i = 0; i < n; ++i) {
+    x[i] = 1.0;
+    y[i] = 2.0;
+  }
+  benchmark::DoNotOptimize(IMPL::dot(n, x, y, partials));
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(IMPL::dot(n, x, y, partials));
+  }
+  report_roofline<target>(state, clock_type::now() - start, 2.0 * n, 16.0 * n);
+
+  target::deallocate(partials);
+  target::deallocate(y);
+  target::deallocate(x);
+}
+
+template <typename IMPL>
+static void benchmark_gemm(benchmark::State& state)
+{
+  using target = typename IMPL::target;
+  const int n = static_cast<int>(state.range(0));
+  double* A = target::template allocate<double>(n * n);
+  double* B = target::template allocate<double>(n * n);
+  double* C = target::template allocate<double>(n * n);
+  for (int i = 0; i < n * n; ++i) {
+    A[i] = 1.0;
+    B[i] = 2.0;
+    C[i] = 0.0;
+  }
+  IMPL::gemm(n, A, B, C);
+  target::synchronize();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    IMPL::gemm(n, A, B, C);
+    target::synchronize();
+  }
+  report_roofline<target>(state, clock_type::now() - start,
+                          2.0 * n * n * n, 24.0 * n * n);
+
+  target::deallocate(C);
+  target::deallocate(B);
+  target::deallocate(A);
+}
+
+template <typename IMPL, int M>
+static void benchmark_batched_gemm(benchmark::State& state)
+{
+  using target = typename IMPL::target;
+  const int num_batch = static_cast<int>(state.range(0));
+  const size_t size = IMPL::template batch_size<M>(num_batch);
+  double* A = target::template allocate<double>(size);
+  double* B = target::template allocate<double>(size);
+  double* C = target::template allocate<double>(size);
+  for (size_t i = 0; i < size; ++i) {
+    A[i] = 1.0;
+    B[i] = 2.0;
+    C[i] = 0.0;
+  }
+  IMPL::template batched_gemm<M>(num_batch, A, B, C);
+  target::synchronize();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    IMPL::template batched_gemm<M>(num_batch, A, B, C);
+    target::synchronize();
+  }
+  report_roofline<target>(state, clock_type::now() - start,
+                          2.0 * M * M * M * num_batch,
+                          24.0 * M * M * num_batch);
+
+  target::deallocate(C);
+  target::deallocate(B);
+  target::deallocate(A);
+}
+
+// y = x[idx] with the indices scattered over all of x
+template <typename IMPL>
+static void benchmark_gather(benchmark::State& state)
+{
+  using target = typename IMPL::target;
+  using index_type = typename IMPL::index_type;
+  const int n = static_cast<int>(state.range(0));
+  double* x = target::template allocate<double>(n);
+  double* y = target::template allocate<double>(n);
+  index_type* idx = target::template allocate<index_type>(n);
+  for (int i = 0; i < n; ++i) {
+    x[i] = 1.0;
+    y[i] = 0.0;
+    idx[i] = static_cast<index_type>((static_cast<size_t>(i) * 2654435761u) % n);
+  }
+  IMPL::gather(n, x, idx, y);
+  target::synchronize();
+
+  const auto start = clock_type::now();
+  while (state.KeepRunning()) {
+    IMPL::gather(n, x, idx, y);
+    target::synchronize();
+  }
+  report_roofline<target>(state, clock_type::now() - start, 0.0,
+                          (16.0 + sizeof(index_type)) * n);
+
+  target::deallocate(idx);
+  target::deallocate(y);
+  target::deallocate(x);
+}
+
+static void vector_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(16)->Range(1 << 14, 1 << 24)->UseRealTime();
+}
+
+static void gemm_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(2)->Range(16, 256)->UseRealTime();
+}
+
+static void batch_sizes(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(8)->Range(1 << 10, 1 << 16)->UseRealTime();
+}
+
+#define TENSOR_KERNEL_BENCHMARKS(impl)                                   \
+  BENCHMARK_TEMPLATE(benchmark_daxpy, impl)->Apply(vector_sizes);        \
+  BENCHMARK_TEMPLATE(benchmark_dot, impl)->Apply(vector_sizes);          \
+  BENCHMARK_TEMPLATE(benchmark_gemm, impl)->Apply(gemm_sizes);           \
+  BENCHMARK_TEMPLATE(benchmark_batched_gemm, impl, 3)->Apply(batch_sizes); \
+  BENCHMARK_TEMPLATE(benchmark_batched_gemm, impl, 8)->Apply(batch_sizes); \
+  BENCHMARK_TEMPLATE(benchmark_gather, impl)->Apply(vector_sizes);
+
+// the roofline benchmarks are registered first so they also run first
+BENCHMARK_TEMPLATE(benchmark_roofline_bandwidth, host_target)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_roofline_flops, host_target, RAJA::scalar_register)
+    ->UseRealTime();
+#if defined(__AVX__)
+BENCHMARK_TEMPLATE(benchmark_roofline_flops, host_target, RAJA::avx_register)
+    ->UseRealTime();
+#endif
+#if defined(__AVX2__)
+BENCHMARK_TEMPLATE(benchmark_roofline_flops, host_target, RAJA::avx2_register)
+    ->UseRealTime();
+#endif
+#if defined(__AVX512F__)
+BENCHMARK_TEMPLATE(benchmark_roofline_flops, host_target, RAJA::avx512_register)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+BENCHMARK_TEMPLATE(benchmark_roofline_bandwidth, cuda_target)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_roofline_flops, cuda_target, RAJA::cuda_warp_register)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_HIP)
+BENCHMARK_TEMPLATE(benchmark_roofline_bandwidth, hip_target)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_roofline_flops, hip_target, RAJA::hip_wave_register)
+    ->UseRealTime();
+#endif
+
+using host_loop = loop_impl<host_target>;
+using host_scalar = tensor_impl<host_target, RAJA::scalar_register>;
+TENSOR_KERNEL_BENCHMARKS(host_loop)
+TENSOR_KERNEL_BENCHMARKS(host_scalar)
+#if defined(__AVX__)
+using host_avx = tensor_impl<host_target, RAJA::avx_register>;
+TENSOR_KERNEL_BENCHMARKS(host_avx)
+#endif
+#if defined(__AVX2__)
+using host_avx2 = tensor_impl<host_target, RAJA::avx2_register>;
+TENSOR_KERNEL_BENCHMARKS(host_avx2)
+#endif
+#if defined(__AVX512F__)
+using host_avx512 = tensor_impl<host_target, RAJA::avx512_register>;
+TENSOR_KERNEL_BENCHMARKS(host_avx512)
+#endif
+#if defined(RAJA_BENCHMARK_HAVE_BLAS)
+// there is no dense gather in BLAS
+BENCHMARK_TEMPLATE(benchmark_daxpy, blas_impl)->Apply(vector_sizes);
+BENCHMARK_TEMPLATE(benchmark_dot, blas_impl)->Apply(vector_sizes);
+BENCHMARK_TEMPLATE(benchmark_gemm, blas_impl)->Apply(gemm_sizes);
+BENCHMARK_TEMPLATE(benchmark_batched_gemm, blas_impl, 3)->Apply(batch_sizes);
+BENCHMARK_TEMPLATE(benchmark_batched_gemm, blas_impl, 8)->Apply(batch_sizes);
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+using cuda_loop = loop_impl<cuda_target>;
+using cuda_warp = tensor_impl<cuda_target, RAJA::cuda_warp_register>;
+TENSOR_KERNEL_BENCHMARKS(cuda_loop)
+TENSOR_KERNEL_BENCHMARKS(cuda_warp)
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using hip_loop = loop_impl<hip_target>;
+using hip_wave = tensor_impl<hip_target, RAJA::hip_wave_register>;
+TENSOR_KERNEL_BENCHMARKS(hip_loop)
+TENSOR_KERNEL_BENCHMARKS(hip_wave)
+#endif
+
+BENCHMARK_MAIN();
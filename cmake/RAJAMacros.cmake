@@ -36,6 +36,10 @@ macro(raja_add_executable)
     list (APPEND arg_DEPENDS_ON tbb)
   endif ()
 
+  if (RAJA_ENABLE_MPI)
+    list (APPEND arg_DEPENDS_ON mpi)
+  endif ()
+
   if (${arg_TEST})
     set (_output_dir ${CMAKE_BINARY_DIR}/test)
   elseif (${arg_REPRODUCER})
@@ -147,7 +151,7 @@ endfunction()
 
 macro(raja_add_test)
   set(options )
-  set(singleValueArgs NAME)
+  set(singleValueArgs NAME NUM_MPI_TASKS)
   set(multiValueArgs SOURCES DEPENDS_ON)
 
   cmake_parse_arguments(arg
@@ -163,10 +167,17 @@ macro(raja_add_test)
     DEPENDS_ON ${arg_DEPENDS_ON}
     TEST On)
 
-  blt_add_test(
-    NAME ${arg_NAME}
-    #COMMAND ${TEST_DRIVER} $<TARGET_FILE:${arg_NAME}>)
-    COMMAND ${TEST_DRIVER} ${arg_NAME})
+  if (arg_NUM_MPI_TASKS)
+    blt_add_test(
+      NAME ${arg_NAME}
+      COMMAND ${TEST_DRIVER} ${arg_NAME}
+      NUM_MPI_TASKS ${arg_NUM_MPI_TASKS})
+  else ()
+    blt_add_test(
+      NAME ${arg_NAME}
+      #COMMAND ${TEST_DRIVER} $<TARGET_FILE:${arg_NAME}>)
+      COMMAND ${TEST_DRIVER} ${arg_NAME})
+  endif ()
 
   raja_set_failtest(${original_test_name})
 endmacro(raja_add_test)
@@ -189,7 +200,7 @@ endmacro(raja_add_reproducer)
 macro(raja_add_benchmark)
   set(options )
   set(singleValueArgs NAME)
-  set(multiValueArgs SOURCES DEPENDS_ON)
+  set(multiValueArgs SOURCES DEPENDS_ON ARGS)
 
   cmake_parse_arguments(arg
     "${options}" "${singleValueArgs}" "${multiValueArgs}" ${ARGN})
@@ -204,5 +215,5 @@ macro(raja_add_benchmark)
 
   blt_add_benchmark(
     NAME ${arg_NAME}
-    COMMAND ${TEST_DRIVER} ${arg_NAME})
+    COMMAND ${TEST_DRIVER} ${arg_NAME} ${arg_ARGS})
 endmacro(raja_add_benchmark)
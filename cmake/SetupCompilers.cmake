@@ -91,3 +91,4 @@ endif()
 set(RAJA_RANGE_ALIGN 4 CACHE STRING "")
 set(RAJA_RANGE_MIN_LENGTH 32 CACHE STRING "")
 set(RAJA_DATA_ALIGN 64 CACHE STRING "")
+set(RAJA_SCAN_TILE_BYTES 262144 CACHE STRING "")
@@ -14,6 +14,7 @@ cmake_dependent_option(RAJA_ENABLE_OPENMP "Build with OpenMP support" On "ENABLE
 cmake_dependent_option(RAJA_ENABLE_CUDA "Build with CUDA support" On "ENABLE_CUDA" Off)
 cmake_dependent_option(RAJA_ENABLE_HIP "Build with HIP support" On "ENABLE_HIP" Off)
 cmake_dependent_option(RAJA_ENABLE_CLANG_CUDA "Build with Clang CUDA support" On "ENABLE_CLANG_CUDA" Off)
+cmake_dependent_option(RAJA_ENABLE_MPI "Build with MPI support" On "ENABLE_MPI" Off)
 
 if (RAJA_ENABLE_CUDA)
    set(RAJA_ENABLE_EXTERNAL_CUB VersionDependent CACHE STRING "Build with external cub")
@@ -29,6 +29,17 @@ if (RAJA_ENABLE_TBB)
   endif()
 endif ()
 
+if (RAJA_ENABLE_SYCL)
+  find_package(oneDPL)
+  if (oneDPL_FOUND)
+    set(RAJA_ENABLE_ONEDPL On)
+    message(STATUS "oneDPL Enabled, SYCL scan and sort supported")
+  else()
+    set(RAJA_ENABLE_ONEDPL Off)
+    message(WARNING "oneDPL NOT FOUND, SYCL scan and sort not supported")
+  endif()
+endif ()
+
 if (RAJA_ENABLE_CUDA)
   if (RAJA_ENABLE_EXTERNAL_CUB STREQUAL "VersionDependent")
     if (CUDA_VERSION_STRING VERSION_GREATER_EQUAL "11.0")
@@ -104,6 +115,28 @@ if (RAJA_ENABLE_HIP AND RAJA_ENABLE_ROCTX)
                      LIBRARIES ${ROCTX_LIBRARIES})
 endif ()
 
+if (RAJA_ENABLE_ITT)
+  find_package(ITT)
+  if (ITT_FOUND)
+    blt_import_library(NAME ittnotify
+                       TREAT_INCLUDES_AS_SYSTEM ON
+                       INCLUDES ${ITT_INCLUDE_DIRS}
+                       LIBRARIES ${ITT_LIBRARY})
+  else()
+    message(FATAL_ERROR "ittnotify not found, ITT_DIR=${ITT_DIR}.")
+  endif()
+endif ()
+
+if (RAJA_ENABLE_CALIPER)
+  find_package(caliper REQUIRED)
+  message(STATUS "Using Caliper from ${caliper_DIR}")
+endif ()
+
+if (RAJA_ENABLE_ADIAK)
+  find_package(adiak REQUIRED)
+  message(STATUS "Using Adiak from ${adiak_DIR}")
+endif ()
+
 set(TPL_DEPS)
 blt_list_append(TO TPL_DEPS ELEMENTS cuda cuda_runtime IF RAJA_ENABLE_CUDA)
 blt_list_append(TO TPL_DEPS ELEMENTS nvtoolsext IF RAJA_ENABLE_NV_TOOLS_EXT)
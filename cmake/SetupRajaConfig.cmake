@@ -80,6 +80,8 @@ configure_package_config_file(
 
 install(FILES
   ${PROJECT_BINARY_DIR}/raja-config.cmake
+  ${PROJECT_SOURCE_DIR}/share/raja/cmake/RAJATensorDispatch.cmake
+  ${PROJECT_SOURCE_DIR}/share/raja/cmake/RAJATensorDispatchVariant.cpp.in
   DESTINATION lib/cmake/raja)
 
 write_basic_package_version_file(
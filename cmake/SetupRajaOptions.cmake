@@ -10,8 +10,12 @@ set(ENABLE_GTEST_DEATH_TESTS On CACHE BOOL "Enable tests asserting failure.")
 
 option(RAJA_ENABLE_NV_TOOLS_EXT "Build with NV_TOOLS_EXT support" Off)
 option(RAJA_ENABLE_ROCTX "Build with ENABLE_ROCTX support" Off)
+option(RAJA_ENABLE_ITT "Build the annotation plugin with ITT (VTune) support" Off)
+option(RAJA_ENABLE_CALIPER "Build the Caliper region plugin" Off)
+option(RAJA_ENABLE_ADIAK "Record RAJA run metadata with Adiak in the Caliper plugin" Off)
 
 option(RAJA_ENABLE_TBB "Build TBB support" Off)
+option(RAJA_ENABLE_STDPAR "Build support for the C++17 parallel algorithms of std::execution" Off)
 option(RAJA_ENABLE_TARGET_OPENMP "Build OpenMP on target device support" Off)
 option(RAJA_ENABLE_SYCL "Build SYCL support" Off)
 
@@ -24,10 +28,16 @@ option(RAJA_ENABLE_FORCEINLINE_RECURSIVE "Enable Forceinline recursive (only sup
 
 option(RAJA_DEPRECATED_TESTS "Test deprecated features" Off)
 option(RAJA_ENABLE_BOUNDS_CHECK "Enable bounds checking in RAJA::Views/Layouts" Off)
+option(RAJA_ENABLE_TENSOR_INSTANTIATIONS "Pre-instantiate the common tensor register types in the RAJA library" Off)
 option(RAJA_TEST_EXHAUSTIVE "Build RAJA exhaustive tests" Off)
 option(RAJA_TEST_OPENMP_TARGET_SUBSET "Build subset of RAJA OpenMP target tests when it is enabled" On)
 option(RAJA_ENABLE_RUNTIME_PLUGINS "Enable support for loading plugins at runtime" Off)
+option(RAJA_ENABLE_PLUGIN_HOOKS "Call the plugins before and after each loop, off removes the hooks" On)
+option(RAJA_ENABLE_TIMING_PLUGIN "Enable the plugin timing loops and kernels into RAJA_TIMING_FILE" Off)
+option(RAJA_ENABLE_COUNTER_PLUGIN "Enable the plugin counting the RAJA_COUNTERS hardware events of host loops" Off)
 option(RAJA_ENABLE_HIP_INDIRECT_FUNCTION_CALL "Enable use of device function pointers in hip backend" OFF)
+option(RAJA_ENABLE_MALLOC_ASYNC "Use cudaMallocAsync/hipMallocAsync for RAJA device memory pools" Off)
+option(RAJA_ENABLE_HIP_UNSAFE_FP_ATOMICS "Use native hip floating point atomics that only work on coarse grained memory" Off)
 
 option(RAJA_ENABLE_DESUL_ATOMICS "Enable support of desul atomics" Off)
 set(DESUL_ENABLE_TESTS Off CACHE BOOL "")
@@ -0,0 +1,35 @@
+###############################################################################
+# Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+# and other RAJA project contributors. See the RAJA/LICENSE file for details.
+#
+# SPDX-License-Identifier: (BSD-3-Clause)
+###############################################################################
+
+###############################################################################
+#
+# Setup the ITT API of VTune
+# This file defines:
+#  ITT_FOUND - If ittnotify was found
+#  ITT_INCLUDE_DIRS - The ittnotify include directories
+#  ITT_LIBRARY - The ittnotify library
+
+find_path( ITT_INCLUDE_DIRS ittnotify.h
+           HINTS ${ITT_DIR}/include ${VTUNE_PROFILER_DIR}/include
+                 $ENV{VTUNE_PROFILER_DIR}/include )
+
+find_library( ITT_LIBRARY NAMES ittnotify libittnotify
+              HINTS ${ITT_DIR}/lib64 ${ITT_DIR}/lib
+                    ${VTUNE_PROFILER_DIR}/lib64
+                    $ENV{VTUNE_PROFILER_DIR}/lib64 )
+
+include(FindPackageHandleStandardArgs)
+# handle the QUIETLY and REQUIRED arguments and set ITT_FOUND to TRUE
+# if all listed variables are TRUE
+find_package_handle_standard_args(ITT DEFAULT_MSG
+                                  ITT_INCLUDE_DIRS
+                                  ITT_LIBRARY )
+
+mark_as_advanced(
+  ITT_INCLUDE_DIRS
+  ITT_LIBRARY
+)
@@ -97,5 +97,36 @@ void deallocate(T *&ptr)
   }
 #endif
 
+#if defined(RAJA_ENABLE_OPENMP)
+  /*
+    Allocate host memory placed by parallel first touch with the same static
+    partitioning as omp_parallel_for_exec loops, so each thread's part of the
+    array is local to it. If placement is non-null it receives the thread and
+    NUMA node that touched each part of the array.
+  */
+  template <typename T>
+  T *allocate_first_touch(
+      RAJA::Index_type size,
+      std::vector<RAJA::omp::FirstTouchPlacement> *placement = nullptr)
+  {
+    RAJA::omp::FirstTouchAllocator alloc;
+    T *ptr = static_cast<T *>(alloc.malloc(sizeof(T) * size));
+    if (placement) {
+      *placement = alloc.placement();
+    }
+    return ptr;
+  }
+
+  template <typename T>
+  void deallocate_first_touch(T *&ptr)
+  {
+    if (ptr) {
+      RAJA::omp::FirstTouchAllocator alloc;
+      alloc.free(ptr);
+      ptr = nullptr;
+    }
+  }
+#endif
+
 };  // namespace memoryManager
 #endif
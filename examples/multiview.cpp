@@ -122,6 +122,18 @@ void docs_example()
 
   printf( "Comparison of 2D normal View with 2D MultiView that has the array-of-pointers index in the 2nd position of the () accessor:\n" );
   printf( "normalView( 1, 1 ) = %i, MView2( 1, 1, 0 ) = %i\n", t1, t2 );
+
+  // _multiview_example_fixed_start
+  // FixedMultiView holds its 2 pointers itself, copied from myarr.
+  RAJA::FixedMultiView< int, RAJA::Layout<1>, 2 > FMView(myarr, 4);
+
+  t1 = FMView( 0, 3 ); // accesses the 4th index of the 0th internal array a1, returns value of 8
+  t2 = FMView( 1, 2 ); // accesses 3rd index of the 1st internal array a2, returns value of 11
+  // _multiview_example_fixed_end
+
+  printf( "Comparison of default MultiView with a FixedMultiView of the same arrays:\n" );
+  printf( "MView( 0, 3 ) = %i, FMView( 0, 3 ) = %i\n", MView( 0, 3 ), t1 );
+  printf( "MView( 1, 2 ) = %i, FMView( 1, 2 ) = %i\n", MView( 1, 2 ), t2 );
 }
 
 int main()
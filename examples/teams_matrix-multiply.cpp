@@ -342,6 +342,43 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   checkResult<double>(Cview, N);
 //printResult<double>(Cview, N);
 
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n Running sequential mat-mult (RAJA-nested, register blocked)...\n";
+
+  std::memset(C, 0, N*N * sizeof(double));
+
+  //Each step of the row loop computes four consecutive rows of a column,
+  //so the four dot products are kept in registers while the rows of A
+  //and a column of B are read once for all four.
+
+  RAJA::expt::launch<launch_policy>(RAJA::expt::HOST,
+   RAJA::expt::Grid(RAJA::expt::Teams(NTeams,NTeams),
+                         RAJA::expt::Threads(THREAD_SZ,THREAD_SZ)),
+       [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+   RAJA::expt::loop<global_thread_y>(ctx, col_range, [&] (int col) {
+       RAJA::expt::tile_register<global_thread_x, 4>(ctx, row_range,
+         [&] (RAJA::expt::RegisterBlock<RAJA::Index_type, 4> const &rows) {
+
+          double dot[4] = {0.0, 0.0, 0.0, 0.0};
+          for (int k = 0; k < N; ++k) {
+            const double b = Bview(k, col);
+            rows.for_each([&] (int r, RAJA::Index_type row) {
+              dot[r] += Aview(row, k) * b;
+            });
+          }
+          rows.for_each([&] (int r, RAJA::Index_type row) {
+            Cview(row, col) = dot[r];
+          });
+      });
+    });
+
+  });
+
+  checkResult<double>(Cview, N);
+//printResult<double>(Cview, N);
+
 
 //----------------------------------------------------------------------------//
 
@@ -24,6 +24,7 @@
  *  RAJA features shown:
  *    - `forall` loop iteration template method
  *    - Atomic add
+ *    - Histogram
  *
  *  If CUDA is enabled, CUDA unified memory is used.
  */
@@ -140,6 +141,22 @@ int main(int RAJA_UNUSED_ARG(argc), char** RAJA_UNUSED_ARG(argv[]))
   // _rajacuda_atomicauto_histogram_end
 
   printBins(bins, M);
+
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n\nRunning RAJA CUDA histogram" << std::endl;
+  std::memset(bins, 0, M * sizeof(int));
+
+  // _rajacuda_histogram_start
+  RAJA::histogram< RAJA::cuda_exec<CUDA_BLOCK_SIZE> >(array_range, bins, M,
+    [=] RAJA_DEVICE(int i) {
+
+    return array[i];
+
+  });
+  // _rajacuda_histogram_end
+
+  printBins(bins, M);
   
 #endif
 
@@ -183,11 +183,17 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   // 1) Data type
   // 2) Index permutation
   // 3) Dimensions of the array
+  // 4) Padding of each dimension
+  //
+  // The tile is read by columns, and padding its rows by one entry puts
+  // the entries of a column in different shared memory banks.
   //
 
   // _mattranspose_localarray_start
   using TILE_MEM =
-    RAJA::LocalArray<int, RAJA::Perm<0, 1>, RAJA::SizeList<TILE_DIM, TILE_DIM>>;
+    RAJA::PaddedLocalArray<int, RAJA::Perm<0, 1>,
+                           RAJA::SizeList<TILE_DIM, TILE_DIM>,
+                           RAJA::SizeList<0, 1>>;
   TILE_MEM Tile_Array;
   // _mattranspose_localarray_end
 
@@ -66,10 +66,19 @@
 #include "RAJA/policy/simd.hpp"
 #include "RAJA/policy/tensor.hpp"
 
+//
+// Common tensor registers pre-instantiated in the RAJA library
+//
+#include "RAJA/pattern/tensor/TensorInstantiate.hpp"
+
 #if defined(RAJA_ENABLE_TBB)
 #include "RAJA/policy/tbb.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_STDPAR)
+#include "RAJA/policy/stdpar.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda.hpp"
 #endif
@@ -95,6 +104,12 @@
 #endif
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/BitMaskSegment.hpp"
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/DeltaListSegment.hpp"
+#include "RAJA/index/RunListSegment.hpp"
+#include "RAJA/index/StaticRangeSegment.hpp"
+#include "RAJA/index/RaggedSegment.hpp"
 
 //
 // Strongly typed index class
@@ -118,7 +133,14 @@
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
 #include "RAJA/util/PermutedLayout.hpp"
+#include "RAJA/util/PaddedLayout.hpp"
+#include "RAJA/util/AoSoALayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
+#include "RAJA/util/CheckedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/RestrictPtr.hpp"
+#include "RAJA/util/CompressedPtr.hpp"
+#include "RAJA/util/StreamingPtr.hpp"
 #include "RAJA/util/View.hpp"
 
 
@@ -136,11 +158,14 @@
 // Atomic operations support
 //
 #include "RAJA/pattern/atomic.hpp"
+#include "RAJA/util/ShardedCounter.hpp"
+#include "RAJA/util/ConcurrentHashMap.hpp"
 
 //
 // Shared memory view patterns
 //
 #include "RAJA/util/LocalArray.hpp"
+#include "RAJA/util/async_copy.hpp"
 
 //
 // Bit masking operators
@@ -157,6 +182,8 @@
 //
 #include "RAJA/policy/WorkGroup.hpp"
 #include "RAJA/pattern/WorkGroup.hpp"
+#include "RAJA/pattern/WorkGroup/PackPlan.hpp"
+#include "RAJA/pattern/distributed.hpp"
 
 //
 // Reduction objects
@@ -169,6 +196,32 @@
 //
 #include "RAJA/pattern/synchronize.hpp"
 
+//
+// Graph recording and replay
+//
+#include "RAJA/pattern/graph.hpp"
+
+//
+// Loops re-executed from snapshots when soft errors are detected
+//
+#include "RAJA/pattern/resilient.hpp"
+
+//
+// Deferred loops, fused and scheduled when flushed
+//
+#include "RAJA/pattern/deferred.hpp"
+
+//
+// Pools of resources to spread work over streams, and staging of host data
+//
+#include "RAJA/util/ResourcePool.hpp"
+#include "RAJA/util/StagingPipeline.hpp"
+
+//
+// Coroutine awaitables for the events of patterns and reducers
+//
+#include "RAJA/util/coroutine.hpp"
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -184,14 +237,19 @@
 
 #include "RAJA/index/IndexSetUtils.hpp"
 #include "RAJA/index/IndexSetBuilders.hpp"
+#include "RAJA/util/ColoredScatter.hpp"
 
 #include "RAJA/pattern/scan.hpp"
+#include "RAJA/pattern/compact.hpp"
 
-#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS) || \
+    defined(RAJA_ENABLE_TIMING_PLUGIN) || defined(RAJA_ENABLE_COUNTER_PLUGIN)
 #include "RAJA/util/PluginLinker.hpp"
 #endif
 
 #include "RAJA/pattern/sort.hpp"
+#include "RAJA/pattern/chunked_sort.hpp"
+#include "RAJA/pattern/histogram.hpp"
 
 namespace RAJA {
 namespace expt{}
@@ -0,0 +1,427 @@
+/*!
+ ******************************************************************************
+ *
+ * \file BitMaskSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA bit mask segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BitMaskSegment_HPP
+#define RAJA_BitMaskSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <climits>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Position of the lowest set bit of a non-zero word
+template <typename WordT>
+RAJA_HOST_DEVICE RAJA_INLINE int lowestSetBit(WordT word)
+{
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__CUDA_ARCH__) && \
+    !defined(__HIP_DEVICE_COMPILE__)
+  return (sizeof(WordT) <= sizeof(unsigned int))
+             ? __builtin_ctz(static_cast<unsigned int>(word))
+             : __builtin_ctzll(static_cast<unsigned long long>(word));
+#else
+  int bit = 0;
+  while (!(word & WordT(1))) {
+    word >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+/*!
+ * \brief Forward iterator over the indices of the set bits of a bit mask.
+ */
+template <typename StorageT, typename WordT>
+class BitMaskIterator
+{
+public:
+  using value_type = StorageT;
+  using difference_type = Index_type;
+  using pointer = value_type*;
+  using reference = value_type;
+  using iterator_category = std::forward_iterator_tag;
+
+  static constexpr Index_type word_bits = sizeof(WordT) * CHAR_BIT;
+
+  RAJA_HOST_DEVICE constexpr BitMaskIterator() = default;
+
+  RAJA_HOST_DEVICE BitMaskIterator(const WordT* words,
+                                   Index_type offset,
+                                   Index_type num_bits,
+                                   Index_type pos)
+      : m_words(words), m_offset(offset), m_num_bits(num_bits), m_pos(pos)
+  {
+    findSet();
+  }
+
+  RAJA_HOST_DEVICE value_type operator*() const
+  {
+    return static_cast<value_type>(m_offset + m_pos);
+  }
+
+  RAJA_HOST_DEVICE BitMaskIterator& operator++()
+  {
+    ++m_pos;
+    findSet();
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE BitMaskIterator operator++(int)
+  {
+    BitMaskIterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+
+  RAJA_HOST_DEVICE bool operator==(BitMaskIterator const& other) const
+  {
+    return m_pos == other.m_pos;
+  }
+
+  RAJA_HOST_DEVICE bool operator!=(BitMaskIterator const& other) const
+  {
+    return m_pos != other.m_pos;
+  }
+
+private:
+  // Move to the first set bit at or after m_pos, or to m_num_bits
+  RAJA_HOST_DEVICE void findSet()
+  {
+    while (m_pos < m_num_bits) {
+      const WordT word =
+          m_words[m_pos / word_bits] >> (m_pos % word_bits);
+      if (word) {
+        m_pos += lowestSetBit(word);
+        if (m_pos > m_num_bits) m_pos = m_num_bits;
+        return;
+      }
+      m_pos = (m_pos / word_bits + 1) * word_bits;
+    }
+    m_pos = m_num_bits;
+  }
+
+  const WordT* m_words = nullptr;
+  Index_type m_offset = 0;
+  Index_type m_num_bits = 0;
+  Index_type m_pos = 0;
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedBitMaskSegment
+ *
+ * \brief  Segment class representing the indices of the set bits of a bit
+ *         mask array.
+ *
+ * \tparam StorageT underlying data type for the segment indices
+ * \tparam WordT unsigned integer type of the words of the bit mask
+ *
+ * A TypedBitMaskSegment models an Iterable interface:
+ *
+ *  begin() -- returns a TypedBitMaskSegment::iterator
+ *  end() -- returns a TypedBitMaskSegment::iterator
+ *  size() -- returns the number of bits of the mask (RAJA::Index_type)
+ *
+ * Bit b of the mask, bit (b % bits per word) of word (b / bits per word),
+ * stands for the index offset + b. The segment does not own the mask, so
+ * the mask can be updated between loops without building a list segment,
+ * and must be in the memory space of the execution policy. Bits of the
+ * last word past the size of the mask are ignored.
+ *
+ * NOTE: TypedBitMaskSegment::iterator is a forward iterator over the set
+ *       bits. forall on a bit mask segment calls the loop body only for
+ *       the indices of set bits. Host policies iterate over the words of
+ *       the mask and skip words with no bit set, GPU policies map a thread
+ *       to each bit and test it; with 32 bit words the bits of a warp are
+ *       one word, so warps over empty words exit together. Bit mask
+ *       segments cannot be used with forall_Icount or in index sets.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * // bit i of active is set when zone i is active
+ * TypedBitMaskSegment<T> active_zones(active, 0, num_zones);
+ *
+ * forall<exec_pol>(active_zones, [=] (T i) {
+ *   // loop body -- use i as index value
+ * });
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT = Index_type, typename WordT = std::uint32_t>
+class TypedBitMaskSegment
+{
+  static_assert(std::is_unsigned<WordT>::value,
+                "TypedBitMaskSegment words must be an unsigned type");
+
+public:
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! The underlying iterator type
+  using iterator = detail::BitMaskIterator<StorageT, WordT>;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Index type with the strong typing removed
+  using StripStorageT = strip_index_type_t<StorageT>;
+
+  //! Type of the words of the bit mask
+  using word_type = WordT;
+
+  //! Number of bits per word
+  static constexpr Index_type word_bits = sizeof(WordT) * CHAR_BIT;
+
+  //@}
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a bit mask segment over a bit mask array.
+   *
+   * \param words pointer to the words of the bit mask, not copied
+   * \param offset index of bit 0 of the mask
+   * \param num_bits number of bits of the mask
+   */
+  RAJA_HOST_DEVICE constexpr TypedBitMaskSegment(const WordT* words,
+                                                 Index_type offset,
+                                                 Index_type num_bits)
+      : m_words(words),
+        m_offset(offset),
+        m_num_bits(num_bits > 0 ? num_bits : 0)
+  {
+  }
+
+  //! Disable compiler generated constructor
+  TypedBitMaskSegment() = delete;
+
+  //! Defaulted copy and move constructors
+  constexpr TypedBitMaskSegment(TypedBitMaskSegment const&) = default;
+  constexpr TypedBitMaskSegment(TypedBitMaskSegment&&) = default;
+
+  //! Defaulted copy and move assignment operators
+  RAJA_INLINE TypedBitMaskSegment& operator=(TypedBitMaskSegment const&) =
+      default;
+  RAJA_INLINE TypedBitMaskSegment& operator=(TypedBitMaskSegment&&) = default;
+
+  //! Defaulted destructor
+  RAJA_INLINE ~TypedBitMaskSegment() = default;
+
+  //@}
+
+  //@{
+  //!   @name Accessors
+
+  //! Get iterator to the first index of a set bit
+  RAJA_HOST_DEVICE iterator begin() const
+  {
+    return iterator(m_words, m_offset, m_num_bits, 0);
+  }
+
+  //! Get iterator to one past the last index of a set bit
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(m_words, m_offset, m_num_bits, m_num_bits);
+  }
+
+  //! Number of bits of the mask
+  RAJA_HOST_DEVICE Index_type size() const { return m_num_bits; }
+
+  //! Pointer to the words of the bit mask
+  RAJA_HOST_DEVICE const WordT* getWords() const { return m_words; }
+
+  //! Index of bit 0 of the mask
+  RAJA_HOST_DEVICE Index_type getOffset() const { return m_offset; }
+
+  //! Number of words of the bit mask
+  RAJA_HOST_DEVICE Index_type getNumWords() const
+  {
+    return (m_num_bits + word_bits - 1) / word_bits;
+  }
+
+  //! Word w of the bit mask without the bits past the size of the mask
+  RAJA_HOST_DEVICE WordT getWord(Index_type w) const
+  {
+    const Index_type tail = m_num_bits - w * word_bits;
+    const WordT word = m_words[w];
+    return (tail >= word_bits) ? word
+                               : word & ((WordT(1) << tail) - WordT(1));
+  }
+
+  //! True if the bit at position pos of the mask is set
+  RAJA_HOST_DEVICE bool test(Index_type pos) const
+  {
+    return (m_words[pos / word_bits] >> (pos % word_bits)) & WordT(1);
+  }
+
+  //! Number of set bits, the number of indices the segment runs
+  Index_type count() const
+  {
+    Index_type num = 0;
+    for (Index_type w = 0; w < getNumWords(); ++w) {
+      for (WordT word = getWord(w); word; word &= word - WordT(1)) {
+        ++num;
+      }
+    }
+    return num;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Comparisons and swap
+
+  //! Equality operator, true if the segments use the same mask and indices
+  RAJA_HOST_DEVICE bool operator==(TypedBitMaskSegment const& o) const
+  {
+    return m_words == o.m_words && m_offset == o.m_offset &&
+           m_num_bits == o.m_num_bits;
+  }
+
+  //! Inequality operator
+  RAJA_HOST_DEVICE bool operator!=(TypedBitMaskSegment const& o) const
+  {
+    return !(*this == o);
+  }
+
+  //! Swap this segment with another
+  RAJA_HOST_DEVICE void swap(TypedBitMaskSegment& other)
+  {
+    camp::safe_swap(m_words, other.m_words);
+    camp::safe_swap(m_offset, other.m_offset);
+    camp::safe_swap(m_num_bits, other.m_num_bits);
+  }
+
+  //@}
+
+private:
+  const WordT* m_words;
+  Index_type m_offset;
+  Index_type m_num_bits;
+};
+
+//! Alias for A TypedBitMaskSegment<Index_type>
+using BitMaskSegment = TypedBitMaskSegment<Index_type>;
+
+namespace detail
+{
+
+/*!
+ * \brief Loop body over the words of a bit mask segment that calls the
+ *        body for each set bit, used by host execution policies.
+ */
+template <typename StorageT, typename WordT, typename LoopBody>
+struct BitMaskWordBody {
+  TypedBitMaskSegment<StorageT, WordT> segment;
+  typename std::decay<LoopBody>::type body;
+
+  void operator()(Index_type w) const
+  {
+    const Index_type first = segment.getOffset() +
+                             w * TypedBitMaskSegment<StorageT, WordT>::word_bits;
+    for (WordT word = segment.getWord(w); word; word &= word - WordT(1)) {
+      body(static_cast<StorageT>(first + lowestSetBit(word)));
+    }
+  }
+};
+
+/*!
+ * \brief Loop body over the bits of a bit mask segment that calls the body
+ *        if the bit is set, used by device execution policies.
+ */
+template <typename StorageT, typename WordT, typename LoopBody>
+struct BitMaskBitBody {
+  TypedBitMaskSegment<StorageT, WordT> segment;
+  typename std::decay<LoopBody>::type body;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE void operator()(Index_type pos) const
+  {
+    if (segment.test(pos)) {
+      body(static_cast<StorageT>(segment.getOffset() + pos));
+    }
+  }
+};
+
+}  // namespace detail
+
+namespace type_traits
+{
+
+namespace detail
+{
+
+template <typename T>
+struct is_bit_mask_segment_impl : std::false_type {
+};
+
+template <typename StorageT, typename WordT>
+struct is_bit_mask_segment_impl<RAJA::TypedBitMaskSegment<StorageT, WordT>>
+    : std::true_type {
+};
+
+}  // namespace detail
+
+template <typename T>
+struct is_bit_mask_segment
+    : detail::is_bit_mask_segment_impl<typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedBitMaskSegment
+template <typename StorageT, typename WordT>
+RAJA_HOST_DEVICE RAJA_INLINE void swap(
+    RAJA::TypedBitMaskSegment<StorageT, WordT>& a,
+    RAJA::TypedBitMaskSegment<StorageT, WordT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,445 @@
+/*!
+ ******************************************************************************
+ *
+ * \file BoxSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA box segment class,
+ *         the indices of an N-dimensional box in a strided layout.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BoxSegment_HPP
+#define RAJA_BoxSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Maps a position in a box segment to its index.
+ *
+ * The last dimension is the fastest, position pos has coordinates c[d] in
+ * the box and index offset + sum(c[d] * strides[d]).
+ */
+template <size_t N, typename StorageT>
+struct BoxDecoder {
+  Index_type offset;
+  Index_type extents[N];
+  Index_type strides[N];
+
+  RAJA_HOST_DEVICE StorageT operator()(Index_type pos) const
+  {
+    Index_type idx = offset;
+    for (size_t d = N; d > 0; --d) {
+      idx += (pos % extents[d - 1]) * strides[d - 1];
+      pos /= extents[d - 1];
+    }
+    return static_cast<StorageT>(idx);
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedBoxSegment
+ *
+ * \brief  Segment class representing the indices of an N-dimensional box
+ *         in a strided layout.
+ *
+ * \tparam N number of dimensions of the box (required)
+ * \tparam StorageT underlying data type for the segment indices
+ *
+ * A TypedBoxSegment models an Iterable interface:
+ *
+ *  begin() -- returns a TypedBoxSegment::iterator
+ *  end() -- returns a TypedBoxSegment::iterator
+ *  size() -- returns size of the Segment iteration space (RAJA::Index_type)
+ *
+ * The box is described by the index of its first corner, and the extent
+ * and stride of each dimension. The last dimension is the fastest, so
+ * consecutive positions in the box are consecutive in memory when the last
+ * stride is 1 and GPU policies access memory coalesced. No index data is
+ * stored.
+ *
+ * NOTE: TypedBoxSegment::iterator is a RandomAccessIterator that computes
+ *       the index of each position. With host execution policies forall
+ *       runs each row of the last dimension as a TypedRangeSegment, or a
+ *       TypedRangeStrideSegment if the last stride is not 1, so the inner
+ *       loops vectorize.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * RAJA::Layout<3> layout(nx, ny, nz);
+ * TypedBoxSegment<3, T> box(layout, {{1, 1, 1}}, {{nx-1, ny-1, nz-1}});
+ *
+ * forall<exec_pol>(box, [=] (T i) {
+ *   // loop body -- use i as index value
+ * });
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <size_t N, typename StorageT = Index_type>
+class TypedBoxSegment
+{
+  static_assert(N > 0, "TypedBoxSegment needs at least one dimension");
+
+public:
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! The underlying iterator type
+  using iterator =
+      Iterators::transform_iterator<Iterators::numeric_iterator<Index_type>,
+                                    detail::BoxDecoder<N, StorageT>>;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Index type with the strong typing removed
+  using StripStorageT = strip_index_type_t<StorageT>;
+
+  //! Number of dimensions of the box
+  static constexpr size_t n_dims = N;
+
+  //@}
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a box segment from its first index and the extent and
+   *        stride of each dimension.
+   *
+   * \param offset index of the first corner of the box
+   * \param extents number of indices of the box in each dimension
+   * \param strides distance between indices in each dimension
+   *
+   * The last dimension is the fastest. A box with an extent that is not
+   * positive is empty.
+   */
+  TypedBoxSegment(Index_type offset,
+                  std::array<Index_type, N> const& extents,
+                  std::array<Index_type, N> const& strides)
+  {
+    m_decoder.offset = offset;
+    for (size_t d = 0; d < N; ++d) {
+      m_decoder.extents[d] = extents[d];
+      m_decoder.strides[d] = strides[d];
+    }
+    initSize();
+  }
+
+  /*!
+   * \brief Construct a box segment from a layout and the bounds of the box
+   *        in each dimension of the layout.
+   *
+   * \param layout layout of the indexed data, a RAJA::Layout or a layout
+   *        with a view-style operator() and strides
+   * \param lower first coordinate of the box in each dimension
+   * \param upper one past the last coordinate of the box in each dimension
+   *
+   * The index of each coordinate is given by the layout. The dimensions of
+   * the box are ordered by decreasing stride so the last dimension of the
+   * box has the smallest stride, also for permuted layouts.
+   */
+  template <typename Layout, typename = decltype(Layout::n_dims)>
+  TypedBoxSegment(Layout const& layout,
+                  std::array<Index_type, N> const& lower,
+                  std::array<Index_type, N> const& upper)
+  {
+    static_assert(Layout::n_dims == N,
+                  "Layout must have the dimensions of the box");
+    m_decoder.offset = static_cast<Index_type>(
+        layoutIndex(layout, lower, camp::make_idx_seq_t<N>{}));
+
+    size_t dims[N];
+    for (size_t d = 0; d < N; ++d) {
+      dims[d] = d;
+    }
+    // insertion sort of the dimensions by decreasing stride
+    for (size_t d = 1; d < N; ++d) {
+      const size_t dim = dims[d];
+      size_t pos = d;
+      while (pos > 0 && layout.strides[dims[pos - 1]] < layout.strides[dim]) {
+        dims[pos] = dims[pos - 1];
+        --pos;
+      }
+      dims[pos] = dim;
+    }
+
+    for (size_t d = 0; d < N; ++d) {
+      m_decoder.extents[d] = upper[dims[d]] - lower[dims[d]];
+      m_decoder.strides[d] = static_cast<Index_type>(layout.strides[dims[d]]);
+    }
+    initSize();
+  }
+
+  //! Disable compiler generated constructor
+  TypedBoxSegment() = delete;
+
+  //! Defaulted move constructor for box segment
+  TypedBoxSegment(TypedBoxSegment&&) = default;
+
+  //! Defaulted copy constructor for box segment
+  TypedBoxSegment(TypedBoxSegment const&) = default;
+
+  //! Defaulted copy assignment operator for box segment
+  TypedBoxSegment& operator=(TypedBoxSegment const&) = default;
+
+  //! Box segment destructor
+  ~TypedBoxSegment() = default;
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  RAJA_HOST_DEVICE iterator begin() const
+  {
+    return iterator(Iterators::numeric_iterator<Index_type>(0), m_decoder);
+  }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(Iterators::numeric_iterator<Index_type>(m_size),
+                    m_decoder);
+  }
+
+  /*!
+   * \brief Get size of this segment (number of indices)
+   */
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  /*!
+   * \brief Get index of the first corner of the box
+   */
+  RAJA_HOST_DEVICE Index_type getOffset() const { return m_decoder.offset; }
+
+  /*!
+   * \brief Get number of indices of the box in dimension d
+   */
+  RAJA_HOST_DEVICE Index_type getExtent(size_t d) const
+  {
+    return m_decoder.extents[d];
+  }
+
+  /*!
+   * \brief Get distance between indices of the box in dimension d
+   */
+  RAJA_HOST_DEVICE Index_type getStride(size_t d) const
+  {
+    return m_decoder.strides[d];
+  }
+
+  /*!
+   * \brief Get number of rows of the last dimension in this segment
+   */
+  RAJA_HOST_DEVICE Index_type getNumRuns() const
+  {
+    return m_size > 0 ? m_size / m_decoder.extents[N - 1] : 0;
+  }
+
+  /*!
+   * \brief Get a row of the last dimension of this segment as a range
+   *        stride segment
+   */
+  RAJA_HOST_DEVICE TypedRangeStrideSegment<StorageT> getRun(
+      Index_type run) const
+  {
+    const Index_type start = runStart(run);
+    const Index_type len = m_decoder.extents[N - 1];
+    const Index_type stride = m_decoder.strides[N - 1];
+    return TypedRangeStrideSegment<StorageT>(
+        static_cast<StripStorageT>(start),
+        static_cast<StripStorageT>(start + len * stride),
+        static_cast<typename TypedRangeStrideSegment<StorageT>::IndexType>(
+            stride));
+  }
+
+  /*!
+   * \brief True if the rows of the last dimension are contiguous, the last
+   *        stride is 1
+   */
+  RAJA_HOST_DEVICE bool hasContiguousRuns() const
+  {
+    return m_decoder.strides[N - 1] == 1;
+  }
+
+  /*!
+   * \brief Get a row of the last dimension of this segment as a range
+   *        segment, requires hasContiguousRuns()
+   */
+  RAJA_HOST_DEVICE TypedRangeSegment<StorageT> getContiguousRun(
+      Index_type run) const
+  {
+    const Index_type start = runStart(run);
+    return TypedRangeSegment<StorageT>(
+        static_cast<StripStorageT>(start),
+        static_cast<StripStorageT>(start + m_decoder.extents[N - 1]));
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if both segments have the same offset, extents, and
+   *         strides, or are both empty, else false
+   */
+  RAJA_HOST_DEVICE bool operator==(const TypedBoxSegment& other) const
+  {
+    if (m_size != other.m_size) return false;
+    if (m_size == 0) return true;
+    if (m_decoder.offset != other.m_decoder.offset) return false;
+    for (size_t d = 0; d < N; ++d) {
+      if (m_decoder.extents[d] != other.m_decoder.extents[d] ||
+          m_decoder.strides[d] != other.m_decoder.strides[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   *
+   * \return true if the segments are not equal, else false
+   */
+  RAJA_HOST_DEVICE bool operator!=(const TypedBoxSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  RAJA_HOST_DEVICE void swap(TypedBoxSegment& other)
+  {
+    camp::safe_swap(m_decoder, other.m_decoder);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+private:
+  template <typename Layout, camp::idx_t... Is>
+  static auto layoutIndex(Layout const& layout,
+                          std::array<Index_type, N> const& coords,
+                          camp::idx_seq<Is...>)
+      -> decltype(layout(coords[Is]...))
+  {
+    return layout(coords[Is]...);
+  }
+
+  RAJA_HOST_DEVICE void initSize()
+  {
+    m_size = 1;
+    for (size_t d = 0; d < N; ++d) {
+      if (m_decoder.extents[d] <= 0) {
+        m_size = 0;
+        break;
+      }
+      m_size *= m_decoder.extents[d];
+    }
+  }
+
+  //
+  // Index of the first index of a row of the last dimension
+  //
+  RAJA_HOST_DEVICE Index_type runStart(Index_type run) const
+  {
+    return stripIndexType(m_decoder(run * m_decoder.extents[N - 1]));
+  }
+
+  // Offset, extents, and strides of the box
+  detail::BoxDecoder<N, StorageT> m_decoder;
+
+  // Size of box segment
+  Index_type m_size = 0;
+};
+
+//! Alias for A TypedBoxSegment<N, Index_type>
+template <size_t N>
+using BoxSegment = TypedBoxSegment<N, Index_type>;
+
+namespace type_traits
+{
+
+namespace detail
+{
+
+template <typename T>
+struct is_box_segment_impl : std::false_type {
+};
+
+template <size_t N, typename StorageT>
+struct is_box_segment_impl<RAJA::TypedBoxSegment<N, StorageT>>
+    : std::true_type {
+};
+
+}  // namespace detail
+
+template <typename T>
+struct is_box_segment
+    : detail::is_box_segment_impl<typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedBoxSegment
+template <size_t N, typename StorageT>
+RAJA_HOST_DEVICE RAJA_INLINE void swap(RAJA::TypedBoxSegment<N, StorageT>& a,
+                                       RAJA::TypedBoxSegment<N, StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
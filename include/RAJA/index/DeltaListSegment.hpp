@@ -0,0 +1,425 @@
+/*!
+ ******************************************************************************
+ *
+ * \file DeltaListSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA delta encoded list
+ *         segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_DeltaListSegment_HPP
+#define RAJA_DeltaListSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! maps a position in a delta list segment to its index
+template <typename StorageT, typename DeltaT, Index_type BlockSize>
+struct DeltaListDecoder {
+  const StorageT* bases;
+  const DeltaT* deltas;
+
+  RAJA_HOST_DEVICE StorageT operator()(Index_type pos) const
+  {
+    return static_cast<StorageT>(bases[pos / BlockSize] + deltas[pos]);
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedDeltaListSegment
+ *
+ * \brief  Segment class representing an arbitrary collection of indices
+ *         stored as small deltas.
+ *
+ * \tparam StorageT underlying data type for the segment indices (required)
+ * \tparam DeltaT unsigned type of the stored deltas (optional)
+ *
+ * A TypedDeltaListSegment models an Iterable interface:
+ *
+ *  begin() -- returns a TypedDeltaListSegment::iterator
+ *  end() -- returns a TypedDeltaListSegment::iterator
+ *  size() -- returns size of the Segment iteration space (RAJA::Index_type)
+ *
+ * The indices are split into blocks of block_size consecutive entries, each
+ * block stores its smallest index and each index its delta from that, so
+ * an index takes sizeof(DeltaT) bytes instead of sizeof(StorageT). An index
+ * is decoded with one add, TypedDeltaListSegment::iterator is a
+ * RandomAccessIterator.
+ *
+ * The indices of each block must lie within the range of DeltaT of each
+ * other, which holds for lists that are sorted or local, check with
+ * canEncode(). The data are held in the memory space of the camp resource
+ * passed to the constructor.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * camp::resources::Resource resource{ camp resource type };
+ * TypedDeltaListSegment<T> deltaseg(indices, length, resource);
+ *
+ * forall<exec_pol>(deltaseg, [=] (T i) {
+ *   // loop body -- use i as index value
+ * });
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT, typename DeltaT = unsigned short>
+class TypedDeltaListSegment
+{
+  static_assert(std::is_unsigned<DeltaT>::value,
+                "TypedDeltaListSegment DeltaT requires unsigned type.");
+
+public:
+
+  //! Number of indices sharing a base
+  static constexpr Index_type block_size = 128;
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! The type of the stored deltas
+  using delta_type = DeltaT;
+
+  //! The underlying iterator type
+  using iterator = Iterators::transform_iterator<
+      Iterators::numeric_iterator<Index_type>,
+      detail::DeltaListDecoder<StorageT, DeltaT, block_size>>;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //@}
+
+  /*!
+   * \brief Check that the indices of each block are within the range of
+   *        DeltaT of each other
+   *
+   * The given array must live in host memory space.
+   */
+  static bool canEncode(const value_type* values, Index_type length)
+  {
+    for (Index_type b = 0; b < length; b += block_size) {
+      const Index_type b_end =
+          (length - b < block_size) ? length : b + block_size;
+      value_type lo = values[b];
+      value_type hi = values[b];
+      for (Index_type i = b + 1; i < b_end; ++i) {
+        if (values[i] < lo) lo = values[i];
+        if (hi < values[i]) hi = values[i];
+      }
+      if (static_cast<unsigned long long>(stripIndexType(hi) -
+                                          stripIndexType(lo)) >
+          static_cast<unsigned long long>(
+              std::numeric_limits<delta_type>::max())) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a delta list segment from given array with specified
+   *        length and use given camp resource to allocate its data.
+   *
+   * \param values array of indices defining iteration space of segment
+   * \param length number of indices
+   * \param resource camp resource defining memory space where data live
+   *
+   * The given array must live in host memory space and canEncode() must be
+   * true for it.
+   */
+  TypedDeltaListSegment(const value_type* values,
+                        Index_type length,
+                        camp::resources::Resource resource)
+    : m_resource(resource)
+  {
+    initIndexData(values, length);
+  }
+
+  /*!
+   * \brief Construct a delta list segment from given container of indices.
+   *
+   * \param container container of indices for segment
+   * \param resource camp resource defining memory space where data live
+   *
+   * The given container must provide methods begin(), end(), and size(),
+   * and its data must live in host memory space.
+   */
+  template <typename Container>
+  TypedDeltaListSegment(const Container& container,
+                        camp::resources::Resource resource)
+    : m_resource(resource)
+  {
+    std::vector<value_type> tmp(container.begin(), container.end());
+    initIndexData(tmp.data(), static_cast<Index_type>(tmp.size()));
+  }
+
+  //! Disable compiler generated constructor
+  TypedDeltaListSegment() = delete;
+
+  //! Copy constructor for delta list segment
+  TypedDeltaListSegment(const TypedDeltaListSegment& other)
+    : m_resource(other.m_resource), m_size(other.m_size)
+  {
+    if (m_size > 0) {
+      const Index_type num_blocks = numBlocks(m_size);
+      m_bases = m_resource.allocate<value_type>(num_blocks);
+      m_deltas = m_resource.allocate<delta_type>(m_size);
+      m_resource.memcpy(m_bases,
+                        other.m_bases,
+                        sizeof(value_type) * num_blocks);
+      m_resource.memcpy(m_deltas,
+                        other.m_deltas,
+                        sizeof(delta_type) * m_size);
+    }
+  }
+
+  //! Move constructor for delta list segment
+  TypedDeltaListSegment(TypedDeltaListSegment&& rhs)
+    : m_resource(rhs.m_resource),
+      m_bases(rhs.m_bases),
+      m_deltas(rhs.m_deltas),
+      m_size(rhs.m_size)
+  {
+    // leave the rhs empty so it's destructor won't have any side effects
+    rhs.m_bases = nullptr;
+    rhs.m_deltas = nullptr;
+    rhs.m_size = 0;
+  }
+
+  //! Delta list segment destructor
+  ~TypedDeltaListSegment()
+  {
+    if (m_bases != nullptr) {
+      m_resource.deallocate(m_bases);
+      m_resource.deallocate(m_deltas);
+    }
+  }
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  RAJA_HOST_DEVICE iterator begin() const
+  {
+    return iterator(Iterators::numeric_iterator<Index_type>(0), decoder());
+  }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(Iterators::numeric_iterator<Index_type>(m_size),
+                    decoder());
+  }
+
+  /*!
+   * \brief Get size of this segment (number of indices)
+   */
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment's indices to an array of values
+   *
+   * \param container pointer to array of values
+   * \param len number of values to compare
+   *
+   * \return true if segment size is same as given length value and values in
+   *         given array match segment index values, else false
+   *
+   * Method assumes values in given array and segment data both live in host
+   * memory space.
+   */
+  bool indicesEqual(const value_type* container, Index_type len) const
+  {
+    if (len != m_size) return false;
+    if (len > 0 && container == nullptr) return false;
+    const auto decode = decoder();
+    for (Index_type i = 0; i < m_size; ++i)
+      if (decode(i) != container[i]) return false;
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if both segments are the same size and indices match,
+   *         else false
+   *
+   * Method assumes data of both segments live in host memory space.
+   */
+  bool operator==(const TypedDeltaListSegment& other) const
+  {
+    if (m_size != other.m_size) return false;
+    const auto decode = decoder();
+    const auto other_decode = other.decoder();
+    for (Index_type i = 0; i < m_size; ++i)
+      if (decode(i) != other_decode(i)) return false;
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   *
+   * \return true if segments are not the same size or indices do not match,
+   *         else false
+   *
+   * Method assumes data of both segments live in host memory space.
+   */
+  bool operator!=(const TypedDeltaListSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  void swap(TypedDeltaListSegment& other)
+  {
+    camp::safe_swap(m_resource, other.m_resource);
+    camp::safe_swap(m_bases, other.m_bases);
+    camp::safe_swap(m_deltas, other.m_deltas);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+private:
+  static Index_type numBlocks(Index_type len)
+  {
+    return (len + block_size - 1) / block_size;
+  }
+
+  //
+  // Encode the indices on the host and copy them to the resource.
+  //
+  void initIndexData(const value_type* values, Index_type len)
+  {
+    if (len <= 0 || values == nullptr) {
+      return;
+    }
+    if (!canEncode(values, len)) {
+      RAJA_ABORT_OR_THROW(
+          "TypedDeltaListSegment indices do not fit the delta type");
+    }
+
+    camp::resources::Resource host_res{camp::resources::Host()};
+
+    const Index_type num_blocks = numBlocks(len);
+    value_type* bases = host_res.allocate<value_type>(num_blocks);
+    delta_type* deltas = host_res.allocate<delta_type>(len);
+
+    for (Index_type blk = 0; blk < num_blocks; ++blk) {
+      const Index_type b = blk * block_size;
+      const Index_type b_end = (len - b < block_size) ? len : b + block_size;
+      value_type lo = values[b];
+      for (Index_type i = b + 1; i < b_end; ++i) {
+        if (values[i] < lo) lo = values[i];
+      }
+      bases[blk] = lo;
+      for (Index_type i = b; i < b_end; ++i) {
+        deltas[i] = static_cast<delta_type>(stripIndexType(values[i]) -
+                                            stripIndexType(lo));
+      }
+    }
+
+    m_size = len;
+    m_bases = m_resource.allocate<value_type>(num_blocks);
+    m_deltas = m_resource.allocate<delta_type>(len);
+    m_resource.memcpy(m_bases, bases, sizeof(value_type) * num_blocks);
+    m_resource.memcpy(m_deltas, deltas, sizeof(delta_type) * len);
+
+    host_res.deallocate(bases);
+    host_res.deallocate(deltas);
+  }
+
+  RAJA_HOST_DEVICE
+  detail::DeltaListDecoder<StorageT, DeltaT, block_size> decoder() const
+  {
+    return detail::DeltaListDecoder<StorageT, DeltaT, block_size>{m_bases,
+                                                                  m_deltas};
+  }
+
+  // Copy of camp resource passed to ctor
+  camp::resources::Resource m_resource;
+
+  // Smallest index of each block
+  value_type* m_bases = nullptr;
+
+  // Delta of each index from the base of its block
+  delta_type* m_deltas = nullptr;
+
+  // Size of delta list segment
+  Index_type m_size = 0;
+};
+
+template <typename StorageT, typename DeltaT>
+constexpr Index_type TypedDeltaListSegment<StorageT, DeltaT>::block_size;
+
+//! Alias for A TypedDeltaListSegment<Index_type>
+using DeltaListSegment = TypedDeltaListSegment<Index_type>;
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedDeltaListSegment
+template <typename StorageT, typename DeltaT>
+RAJA_INLINE void swap(RAJA::TypedDeltaListSegment<StorageT, DeltaT>& a,
+                      RAJA::TypedDeltaListSegment<StorageT, DeltaT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
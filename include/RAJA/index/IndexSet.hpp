@@ -37,6 +37,14 @@ namespace RAJA
 enum PushEnd { PUSH_FRONT, PUSH_BACK };
 enum PushCopy { PUSH_COPY, PUSH_NOCOPY };
 
+///
+/// Vector holding the per-segment data of an IndexSet. The data of a few
+/// segments is stored inline, so IndexSets with a handful of segments do
+/// not allocate for it.
+///
+template <typename T>
+using IndexSetVec = RAJAVec<T, std::allocator<T>, 4>;
+
 template <typename... TALL>
 class TypedIndexSet;
 
@@ -509,37 +517,37 @@ public:
 
 protected:
   //! Returns the mapping of  segment_index -> segment_type
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentTypes()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentTypes()
   {
     return PARENT::getSegmentTypes();
   }
 
   //! Returns the mapping of  segment_index -> segment_type
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentTypes() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentTypes() const
   {
     return PARENT::getSegmentTypes();
   }
 
   //! Returns the mapping of  segment_index -> segment_offset
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentOffsets()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentOffsets()
   {
     return PARENT::getSegmentOffsets();
   }
 
   //! Returns the mapping of  segment_index -> segment_offset
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentOffsets() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentOffsets() const
   {
     return PARENT::getSegmentOffsets();
   }
 
   //! Returns the icount of segments
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentIcounts()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentIcounts()
   {
     return PARENT::getSegmentIcounts();
   }
 
   //! Returns the icount of segments
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentIcounts() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentIcounts() const
   {
     return PARENT::getSegmentIcounts();
   }
@@ -574,16 +582,16 @@ public:
 
 private:
   //! vector of TypedIndexSet data objects of type T0
-  RAJA::RAJAVec<T0 *> data;
+  RAJA::IndexSetVec<T0 *> data;
 
   //! vector indicating which segments are owned by the TypedIndexSet
-  RAJA::RAJAVec<Index_type> owner;
+  RAJA::IndexSetVec<Index_type> owner;
 
   //! vector holding user defined begin segment intervals
-  RAJA::RAJAVec<Index_type> m_seg_interval_begin;
+  RAJA::IndexSetVec<Index_type> m_seg_interval_begin;
 
   //! vector holding user defined end segment intervals
-  RAJA::RAJAVec<Index_type> m_seg_interval_end;
+  RAJA::IndexSetVec<Index_type> m_seg_interval_end;
 };
 
 
@@ -640,32 +648,32 @@ protected:
   {
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentTypes()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentTypes()
   {
     return segment_types;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentTypes() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentTypes() const
   {
     return segment_types;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentOffsets()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentOffsets()
   {
     return segment_offsets;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentOffsets() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentOffsets() const
   {
     return segment_offsets;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentIcounts()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentIcounts()
   {
     return segment_icounts;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentIcounts() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentIcounts() const
   {
     return segment_icounts;
   }
@@ -743,14 +751,14 @@ public:
 
 private:
   //! Vector of segment types:    seg_index -> seg_type
-  RAJA::RAJAVec<Index_type> segment_types;
+  RAJA::IndexSetVec<Index_type> segment_types;
 
   //! offsets into each segment vector:    seg_index -> seg_offset
   //! used as segment_data[seg_type][seg_offset]
-  RAJA::RAJAVec<Index_type> segment_offsets;
+  RAJA::IndexSetVec<Index_type> segment_offsets;
 
   //! the icount of each segment
-  RAJA::RAJAVec<Index_type> segment_icounts;
+  RAJA::IndexSetVec<Index_type> segment_icounts;
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
@@ -769,6 +777,20 @@ template <typename T>
 struct is_indexset_policy
     : ::RAJA::type_traits::SpecializationOf<RAJA::ExecPolicy, typename std::decay<T>::type> {
 };
+
+//! True for segment iteration policies that split the segments of an index
+//! set into chunks of similar length instead of iterating over segments
+template <typename T>
+struct is_balanced_segit_policy
+    : ::RAJA::pattern_is<T, ::RAJA::Pattern::balanced_segit> {
+};
+
+//! True for segment iteration policies that run each segment of an index
+//! set when the segments it depends on are done
+template <typename T>
+struct is_taskgraph_segit_policy
+    : ::RAJA::pattern_is<T, ::RAJA::Pattern::taskgraph> {
+};
 }  // namespace type_traits
 
 }  // namespace RAJA
@@ -61,6 +61,78 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
     RAJA::Index_type range_min_length,
     RAJA::Index_type range_align);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with Range segments for the runs of
+ *        consecutive indices in given array and List segments for the
+ *        indices between them.
+ *
+ *        Segments are added in the order of the input array. A run becomes
+ *        a range segment if it has at least range_min_length indices from
+ *        its first index that is a multiple of range_align, the indices of
+ *        the run before that go to the preceding list segment. Runs are
+ *        found in parallel when OpenMP is enabled.
+ *
+ *  \param iset reference to index set generated with range segments and
+ *         list segments. Method assumes index set is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *  \param indices_in pointer to start of input array of indices.
+ *  \param length size of input index array.
+ *  \param range_min_length min length of any range segment in index set
+ *  \param range_align "alignment" value for range segments in index set.
+ *         Starting index of each range segment will be a multiple of this
+ *         value, 1 for no alignment.
+ *
+ ******************************************************************************
+ */
+void RAJASHAREDDLL_API buildIndexSetRuns(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length,
+    RAJA::Index_type range_align = 1);
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with one segment per color of a graph
+ *        coloring of mesh elements, where two elements get different
+ *        colors when they share a node.
+ *
+ *        The elements of each segment can be executed in parallel without
+ *        conflicting updates to node data, the segments must be executed
+ *        one after the other, e.g. with a seq_segit policy. Elements of
+ *        each segment are in increasing order; a segment is a range segment
+ *        when they are contiguous and a list segment otherwise. Coloring
+ *        uses the Jones-Plassmann algorithm with reproducible priorities and
+ *        runs in parallel when OpenMP is enabled.
+ *
+ *  \param iset reference to index set generated. Method assumes index set
+ *         is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *  \param elem_node_offsets array of num_elems + 1 offsets in elem_nodes,
+ *         the nodes of element e are elem_nodes[elem_node_offsets[e]] to
+ *         elem_nodes[elem_node_offsets[e+1]-1].
+ *  \param elem_nodes node indices of the elements, in [0, num_nodes).
+ *  \param num_elems number of elements.
+ *  \param num_nodes number of nodes.
+ *
+ ******************************************************************************
+ */
+void RAJASHAREDDLL_API buildColorIndexSet(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const elem_node_offsets,
+    const RAJA::Index_type* const elem_nodes,
+    RAJA::Index_type num_elems,
+    RAJA::Index_type num_nodes);
+
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
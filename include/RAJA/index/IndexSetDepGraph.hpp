@@ -0,0 +1,313 @@
+/*!
+ ******************************************************************************
+ *
+ * \file IndexSetDepGraph.hpp
+ *
+ * \brief  Header file containing the definition of the segment dependency
+ *         graph of an index set and the method template that builds it
+ *         from the indices of the segments.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_IndexSetDepGraph_HPP
+#define RAJA_IndexSetDepGraph_HPP
+
+#include "RAJA/config.hpp"
+
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/index/IndexSet.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Dependencies between the segments of an index set.
+ *
+ *         A segment can run when all of its predecessors are done. The
+ *         successors of each segment are stored in compressed row form so
+ *         a finished segment can release them without searching.
+ *
+ ******************************************************************************
+ */
+class IndexSetDepGraph
+{
+public:
+  //! Graph with no segments
+  IndexSetDepGraph() = default;
+
+  //! Graph with num_segs segments and no dependencies
+  explicit IndexSetDepGraph(Index_type num_segs)
+      : m_num_preds(num_segs, 0), m_succ_offsets(num_segs + 1, 0)
+  {
+  }
+
+  /*!
+   * \brief Set the dependencies from the predecessors of each segment.
+   *
+   * The predecessors of segment s are preds[pred_offsets[s]] to
+   * preds[pred_offsets[s+1]-1], given without repetition.
+   */
+  void setPredecessors(Index_type num_segs,
+                       const Index_type* pred_offsets,
+                       const Index_type* preds)
+  {
+    m_num_preds.assign(num_segs, 0);
+    m_succ_offsets.assign(num_segs + 1, 0);
+
+    for (Index_type s = 0; s < num_segs; ++s) {
+      m_num_preds[s] = pred_offsets[s + 1] - pred_offsets[s];
+      for (Index_type k = pred_offsets[s]; k < pred_offsets[s + 1]; ++k) {
+        ++m_succ_offsets[preds[k] + 1];
+      }
+    }
+    for (Index_type s = 0; s < num_segs; ++s) {
+      m_succ_offsets[s + 1] += m_succ_offsets[s];
+    }
+
+    m_succs.resize(m_succ_offsets[num_segs]);
+    std::vector<Index_type> pos(m_succ_offsets.begin(),
+                                m_succ_offsets.end() - 1);
+    for (Index_type s = 0; s < num_segs; ++s) {
+      for (Index_type k = pred_offsets[s]; k < pred_offsets[s + 1]; ++k) {
+        m_succs[pos[preds[k]]++] = s;
+      }
+    }
+  }
+
+  //! Number of segments in the graph
+  Index_type getNumSegments() const
+  {
+    return static_cast<Index_type>(m_num_preds.size());
+  }
+
+  //! Number of segments that must finish before segment seg runs
+  Index_type getNumPredecessors(Index_type seg) const
+  {
+    return m_num_preds[seg];
+  }
+
+  //! Number of segments that wait for segment seg
+  Index_type getNumSuccessors(Index_type seg) const
+  {
+    return m_succ_offsets[seg + 1] - m_succ_offsets[seg];
+  }
+
+  //! Segments that wait for segment seg, getNumSuccessors(seg) values
+  const Index_type* getSuccessors(Index_type seg) const
+  {
+    return m_succs.data() + m_succ_offsets[seg];
+  }
+
+  //! Total number of dependencies
+  Index_type getNumDependencies() const
+  {
+    return static_cast<Index_type>(m_succs.size());
+  }
+
+private:
+  std::vector<Index_type> m_num_preds;
+  std::vector<Index_type> m_succ_offsets;
+  std::vector<Index_type> m_succs;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  An index set with the dependency graph of its segments, passed to
+ *         forall in place of the index set.
+ *
+ *         Holds references, the index set and the graph must outlive it.
+ *         Task graph segment iteration policies run each segment when its
+ *         predecessors are done, sequential segment iteration runs the
+ *         segments in order, which satisfies any graph built from it.
+ *
+ ******************************************************************************
+ */
+template <typename... SegmentTypes>
+class DepGraphIndexSet
+{
+public:
+  using index_set_type = TypedIndexSet<SegmentTypes...>;
+
+  DepGraphIndexSet(const index_set_type& iset, const IndexSetDepGraph& graph)
+      : m_iset(&iset), m_graph(&graph)
+  {
+  }
+
+  const index_set_type& getIndexSet() const { return *m_iset; }
+
+  const IndexSetDepGraph& getDepGraph() const { return *m_graph; }
+
+  size_t getLength() const { return m_iset->getLength(); }
+
+private:
+  const index_set_type* m_iset;
+  const IndexSetDepGraph* m_graph;
+};
+
+template <typename... SegmentTypes>
+RAJA_INLINE DepGraphIndexSet<SegmentTypes...> make_dep_graph_index_set(
+    const TypedIndexSet<SegmentTypes...>& iset,
+    const IndexSetDepGraph& graph)
+{
+  return DepGraphIndexSet<SegmentTypes...>(iset, graph);
+}
+
+namespace detail
+{
+
+//! Smallest and largest index of a segment
+struct SegmentIndexBounds {
+  template <typename SegmentType>
+  void operator()(const SegmentType& seg, Index_type& lo, Index_type& hi) const
+  {
+    for (auto it = seg.begin(); it != seg.end(); ++it) {
+      const Index_type i = static_cast<Index_type>(*it);
+      if (i < lo) lo = i;
+      if (i > hi) hi = i;
+    }
+  }
+};
+
+//! Adds the predecessors of segment seg and makes it the last segment of
+//! its indices
+struct SegmentDependencies {
+  Index_type seg;
+  Index_type min_index;
+  Index_type num_index;
+  const Index_type* offsets;
+  Index_type num_offsets;
+
+  template <typename SegmentType>
+  void operator()(const SegmentType& segment,
+                  std::vector<Index_type>& last_seg,
+                  std::vector<Index_type>& mark,
+                  std::vector<Index_type>& preds) const
+  {
+    auto add = [&](Index_type i) {
+      const Index_type p = i - min_index;
+      if (p < 0 || p >= num_index) return;
+      const Index_type other = last_seg[p];
+      if (other >= 0 && other != seg && mark[other] != seg) {
+        mark[other] = seg;
+        preds.push_back(other);
+      }
+    };
+
+    for (auto it = segment.begin(); it != segment.end(); ++it) {
+      const Index_type i = static_cast<Index_type>(*it);
+      add(i);
+      for (Index_type k = 0; k < num_offsets; ++k) {
+        add(i + offsets[k]);
+        add(i - offsets[k]);
+      }
+      last_seg[i - min_index] = seg;
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Build the dependency graph of the segments of an index set from
+ *         the indices they share.
+ *
+ *         Segment t depends on an earlier segment s when t has an index i
+ *         and s has an index i, i + o or i - o for an offset o in offsets,
+ *         e.g. the stencil offsets of a loop body that writes index i and
+ *         reads its neighbors. Running the segments in any order that
+ *         respects the graph gives the results of running them in index
+ *         set order.
+ *
+ *         Only the most recent segment with each index is a predecessor,
+ *         the earlier ones are reached through it, which keeps the graph
+ *         small for sweeps. Segment indices must be readable on the host,
+ *         and the method uses one Index_type per value between the
+ *         smallest and largest index of the index set.
+ *
+ *  \param graph dependency graph generated for the segments of iset.
+ *  \param iset index set to build the graph for.
+ *  \param offsets pointer to the index offsets between dependent indices.
+ *  \param num_offsets number of offsets, 0 for segments that depend on each
+ *         other only through common indices.
+ *
+ ******************************************************************************
+ */
+template <typename... SegmentTypes>
+void buildIndexSetDepGraph(IndexSetDepGraph& graph,
+                           const TypedIndexSet<SegmentTypes...>& iset,
+                           const Index_type* offsets = nullptr,
+                           Index_type num_offsets = 0)
+{
+  const Index_type num_segs = static_cast<Index_type>(iset.getNumSegments());
+
+  Index_type lo = 0;
+  Index_type hi = -1;
+  if (num_segs > 0 && iset.getLength() > 0) {
+    lo = std::numeric_limits<Index_type>::max();
+    hi = std::numeric_limits<Index_type>::min();
+    for (Index_type s = 0; s < num_segs; ++s) {
+      iset.segmentCall(s, detail::SegmentIndexBounds{}, lo, hi);
+    }
+  }
+
+  std::vector<Index_type> last_seg(hi - lo + 1, -1);
+  std::vector<Index_type> mark(num_segs, -1);
+
+  std::vector<Index_type> pred_offsets(1, 0);
+  std::vector<Index_type> preds;
+  pred_offsets.reserve(num_segs + 1);
+
+  for (Index_type s = 0; s < num_segs; ++s) {
+    iset.segmentCall(s,
+                     detail::SegmentDependencies{s, lo, hi - lo + 1,
+                                                 offsets, num_offsets},
+                     last_seg,
+                     mark,
+                     preds);
+    pred_offsets.push_back(static_cast<Index_type>(preds.size()));
+  }
+
+  graph.setPredecessors(num_segs, pred_offsets.data(), preds.data());
+}
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_dep_graph_index_set_impl : std::false_type {
+};
+
+template <typename... SegmentTypes>
+struct is_dep_graph_index_set_impl<DepGraphIndexSet<SegmentTypes...>>
+    : std::true_type {
+};
+
+//! True for an index set passed with its segment dependency graph
+template <typename T>
+struct is_dep_graph_index_set
+    : is_dep_graph_index_set_impl<typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
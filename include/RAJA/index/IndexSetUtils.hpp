@@ -21,6 +21,11 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include "RAJA/pattern/forall.hpp"
 
 #include "RAJA/policy/sequential.hpp"
@@ -122,6 +127,212 @@ RAJA_INLINE void getIndicesConditional(CONTAINER_T& con,
 
 //@}
 
+//@{
+//!   @name Methods to order points and segment indices along a
+//!   space-filling curve.
+//!
+//!   Points are given by DIM coordinates each, point i has coordinates
+//!   coords[i*DIM] to coords[i*DIM + DIM-1]. The bounding box of the points
+//!   is divided into 2^B cells per dimension, with B = 63 / DIM (at most
+//!   32), and the cells are ordered along the curve. Points in the same
+//!   cell are ordered by index. Consecutive points along the curve are
+//!   close in space, so loops over indices in curve order reuse cache
+//!   lines of data gathered from neighboring points.
+
+//! Space-filling curves for ordering points.
+enum class SpaceFillingCurve {
+  Morton,  //!< Z-order, interleaved coordinate bits
+  Hilbert  //!< Hilbert curve, consecutive cells share a face
+};
+
+namespace detail
+{
+
+/*!
+ * \brief Position along the curve of the cell with the given coordinates,
+ *        each with bits significant bits.
+ *
+ *        The Hilbert transform of the coordinates is Skilling's algorithm
+ *        (AIP Conf. Proc. 707, 2004), after which both curves interleave
+ *        the coordinate bits from the most significant one.
+ */
+template <int DIM>
+inline std::uint64_t curveKey(std::uint32_t (&x)[DIM],
+                              int bits,
+                              SpaceFillingCurve curve)
+{
+  if (curve == SpaceFillingCurve::Hilbert && bits > 0) {
+    const std::uint32_t m = std::uint32_t(1) << (bits - 1);
+
+    for (std::uint32_t q = m; q > 1; q >>= 1) {
+      const std::uint32_t p = q - 1;
+      for (int i = 0; i < DIM; ++i) {
+        if (x[i] & q) {
+          x[0] ^= p;
+        } else {
+          const std::uint32_t t = (x[0] ^ x[i]) & p;
+          x[0] ^= t;
+          x[i] ^= t;
+        }
+      }
+    }
+
+    for (int i = 1; i < DIM; ++i) {
+      x[i] ^= x[i - 1];
+    }
+    std::uint32_t t = 0;
+    for (std::uint32_t q = m; q > 1; q >>= 1) {
+      if (x[DIM - 1] & q) t ^= q - 1;
+    }
+    for (int i = 0; i < DIM; ++i) {
+      x[i] ^= t;
+    }
+  }
+
+  std::uint64_t key = 0;
+  for (int b = bits - 1; b >= 0; --b) {
+    for (int i = 0; i < DIM; ++i) {
+      key = (key << 1) | ((x[i] >> b) & 1u);
+    }
+  }
+  return key;
+}
+
+/*!
+ * \brief Curve keys of the points with the given indices, paired with the
+ *        position of each index.
+ */
+template <int DIM, typename COORD_T, typename INDEX_T>
+inline std::vector<std::pair<std::uint64_t, Index_type>> curveKeys(
+    const COORD_T* coords,
+    const INDEX_T* indices,
+    Index_type num_indices,
+    SpaceFillingCurve curve)
+{
+  static_assert(DIM >= 1 && DIM <= 63,
+                "Space-filling curves need 1 to 63 dimensions");
+
+  constexpr int bits = (63 / DIM < 32) ? 63 / DIM : 32;
+
+  double lo[DIM];
+  double hi[DIM];
+  for (int d = 0; d < DIM; ++d) {
+    lo[d] = 0.0;
+    hi[d] = 0.0;
+  }
+  for (Index_type k = 0; k < num_indices; ++k) {
+    const COORD_T* c = coords + static_cast<Index_type>(indices[k]) * DIM;
+    for (int d = 0; d < DIM; ++d) {
+      const double v = static_cast<double>(c[d]);
+      if (k == 0 || v < lo[d]) lo[d] = v;
+      if (k == 0 || v > hi[d]) hi[d] = v;
+    }
+  }
+
+  const double max_cell = static_cast<double>((std::uint64_t(1) << bits) - 1);
+  double scale[DIM];
+  for (int d = 0; d < DIM; ++d) {
+    scale[d] = (hi[d] > lo[d]) ? max_cell / (hi[d] - lo[d]) : 0.0;
+  }
+
+  std::vector<std::pair<std::uint64_t, Index_type>> keys(num_indices);
+  for (Index_type k = 0; k < num_indices; ++k) {
+    const COORD_T* c = coords + static_cast<Index_type>(indices[k]) * DIM;
+    std::uint32_t x[DIM];
+    for (int d = 0; d < DIM; ++d) {
+      const double v = (static_cast<double>(c[d]) - lo[d]) * scale[d];
+      x[d] = static_cast<std::uint32_t>(v < max_cell ? v : max_cell);
+    }
+    keys[k] = std::make_pair(curveKey<DIM>(x, bits, curve), k);
+  }
+
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Copy the indices 0 to num_points-1 of points in the order of
+ *         the given space-filling curve to given container.
+ *
+ *         The container holds the permutation new-to-old: con[k] is the
+ *         point at position k along the curve. Renumbering point data with
+ *         it, new_data[k] = data[con[k]], stores it in curve order.
+ *
+ ******************************************************************************
+ */
+template <int DIM, typename CONTAINER_T, typename COORD_T>
+RAJA_INLINE void getSpaceFillingCurveOrder(
+    CONTAINER_T& con,
+    const COORD_T* coords,
+    Index_type num_points,
+    SpaceFillingCurve curve = SpaceFillingCurve::Hilbert)
+{
+  std::vector<Index_type> points(num_points);
+  for (Index_type i = 0; i < num_points; ++i) {
+    points[i] = i;
+  }
+
+  auto keys = detail::curveKeys<DIM>(coords, points.data(), num_points, curve);
+
+  CONTAINER_T tcon;
+  for (auto const& key : keys) {
+    tcon.push_back(static_cast<typename CONTAINER_T::value_type>(key.second));
+  }
+  con = tcon;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Copy the indices of given list segment in the order of the given
+ *         space-filling curve to given container, and the positions of the
+ *         indices in the segment to given permutation container.
+ *
+ *         Index i of the segment is the point with coordinates
+ *         coords[i*DIM] to coords[i*DIM + DIM-1]. After the call,
+ *         con[k] == seg.begin()[perm[k]], so a list segment made from con
+ *         runs the indices along the curve and perm reorders data stored
+ *         by segment position the same way. Segment indices must be
+ *         readable on the host.
+ *
+ ******************************************************************************
+ */
+template <int DIM,
+          typename CONTAINER_T,
+          typename PERM_CONTAINER_T,
+          typename T,
+          typename COORD_T>
+RAJA_INLINE void getIndicesSpaceFillingCurveOrder(
+    CONTAINER_T& con,
+    PERM_CONTAINER_T& perm,
+    const TypedListSegment<T>& seg,
+    const COORD_T* coords,
+    SpaceFillingCurve curve = SpaceFillingCurve::Hilbert)
+{
+  const T* indices = seg.begin();
+  auto keys = detail::curveKeys<DIM>(coords,
+                                     indices,
+                                     static_cast<Index_type>(seg.size()),
+                                     curve);
+
+  CONTAINER_T tcon;
+  PERM_CONTAINER_T tperm;
+  for (auto const& key : keys) {
+    tcon.push_back(
+        static_cast<typename CONTAINER_T::value_type>(indices[key.second]));
+    tperm.push_back(
+        static_cast<typename PERM_CONTAINER_T::value_type>(key.second));
+  }
+  con = tcon;
+  perm = tperm;
+}
+
+//@}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
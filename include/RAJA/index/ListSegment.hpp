@@ -55,7 +55,14 @@ namespace RAJA
  *       memory space specified by the camp resource object and the values are
  *       copied from the input array to that. Ownership of the indices is 
  *       determined by an optional ownership enum value passed to the 
- *       constructor.
+ *       constructor. A segment that does not own its indices uses the array
+ *       as is, e.g. indices that already live in device or unified memory,
+ *       without allocating or copying.
+ *
+ *       The input array of an owning segment may be in host, device, or
+ *       unified memory; it is copied with the resource memcpy. By default
+ *       the constructor waits for the copy, with CopyAsync it returns once
+ *       the copy is enqueued on the resource.
  *
  * Usage:
  *
@@ -112,17 +119,24 @@ public:
    * \param length number of indices
    * \param resource camp resource defining memory space where index data live
    * \param owned optional enum value indicating whether segment owns indices (Owned or Unowned). Default is Owned.   
+   * \param copy optional enum value indicating whether the constructor waits for the copy of owned indices (CopySync or CopyAsync). Default is CopySync.
+   *
+   * If 'Unowned' is passed, the segment will not own its index data. In this
+   * case, the values must be in the memory space of the execution policies
+   * the segment is used with and caller must manage array lifetime properly.
    *
-   * If 'Unowned' is passed as last argument, the segment will not own its
-   * index data. In this case, caller must manage array lifetime properly.
+   * If 'CopyAsync' is passed, the values must not be changed or freed until
+   * the copy on the resource is done, and loops using the segment must run
+   * on the resource or after waiting on it.
    */
   TypedListSegment(const value_type* values,
                    Index_type length,
                    camp::resources::Resource resource,
-                   IndexOwnership owned = Owned)
+                   IndexOwnership owned = Owned,
+                   IndexCopy copy = CopySync)
     : m_resource(resource)
   {
-    initIndexData(values, length, owned);
+    initIndexData(values, length, owned, copy);
   }
 
   /*!
@@ -175,8 +189,7 @@ public:
     : m_resource(other.m_resource),
       m_owned(Unowned), m_data(nullptr), m_size(0)
   {
-    bool from_copy_ctor = true;
-    initIndexData(other.m_data, other.m_size, other.m_owned, from_copy_ctor);
+    initIndexData(other.m_data, other.m_size, other.m_owned, CopyAsync);
   }
 
   //! Move constructor for list segment
@@ -295,7 +308,7 @@ private:
   void initIndexData(const value_type* container,
                      Index_type len,
                      IndexOwnership container_own,
-                     bool from_copy_ctor = false)
+                     IndexCopy copy)
   {
 
     // empty list segment
@@ -311,26 +324,13 @@ private:
     m_owned = container_own;
     if (m_owned == Owned) {
 
-      if ( from_copy_ctor ) {
-
-        m_data = m_resource.allocate<value_type>(m_size);
-        m_resource.memcpy(m_data, container, sizeof(value_type) * m_size); 
-
-      } else {
-
-        camp::resources::Resource host_res{camp::resources::Host()};
-
-        value_type* tmp = host_res.allocate<value_type>(m_size);
-
-        for (Index_type i = 0; i < m_size; ++i) {
-          tmp[i] = container[i];
-        }
-
-        m_data = m_resource.allocate<value_type>(m_size);
-        m_resource.memcpy(m_data, tmp, sizeof(value_type) * m_size);
-
-        host_res.deallocate(tmp);
+      // memcpy copies from any memory space the resource can access, so
+      // device resident values are not read on the host
+      m_data = m_resource.allocate<value_type>(m_size);
+      m_resource.memcpy(m_data, container, sizeof(value_type) * m_size);
 
+      if ( copy == CopySync ) {
+        m_resource.wait();
       }
 
       return;
@@ -0,0 +1,212 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the definition of a ragged segment, the
+ *          index lists of the rows of a compressed sparse row graph.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_RaggedSegment_HPP
+#define RAJA_RaggedSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedRaggedSegment
+ *
+ * \brief  Segment class representing the indices of a compressed sparse row
+ *         (CSR) graph, such as the neighbors of each element of a mesh.
+ *
+ * \tparam StorageT underlying data type for the segment indices
+ * \tparam OffsetT data type of the row offsets
+ *
+ * Row r of the graph is the indices[k] for the positions k in
+ * [offsets[r], offsets[r+1]). The segment does not own the arrays, which
+ * must be in the memory space of the execution policy. The number of
+ * positions nnz is given on construction, so a segment of device arrays
+ * can be made and sized on the host.
+ *
+ * A TypedRaggedSegment models an Iterable interface over all positions:
+ *
+ *  begin() -- returns a pointer to indices[0]
+ *  end() -- returns a pointer to indices[nnz]
+ *  size() -- returns nnz
+ *
+ * row(r) is the range segment of the positions of row r, and
+ * partition_rows splits the rows into parts with about the same number of
+ * positions, so unbalanced rows can be spread evenly across threads.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * TypedRaggedSegment<int> nbrs(offsets, indices, num_elems, nnz);
+ *
+ * forall<exec_pol>(TypedRangeSegment<int>(0, num_elems), [=] (int e) {
+ *   for (int k : nbrs.row(e)) {
+ *     // nbrs[k] is a neighbor of e, and k its position in nnz arrays
+ *   }
+ * });
+ * \endverbatim
+ *
+ * In kernel, statement::ForRagged loops over the positions of one row.
+ *
+ ******************************************************************************
+ */
+template <typename StorageT = Index_type, typename OffsetT = StorageT>
+class TypedRaggedSegment
+{
+  static_assert(std::is_integral<OffsetT>::value,
+                "TypedRaggedSegment offsets must be integral");
+
+public:
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! The type of the row offsets
+  using offset_type = OffsetT;
+
+  //! The underlying iterator type
+  using iterator = StorageT const*;
+
+  //! The segment type of the positions of a row
+  using row_segment = TypedRangeSegment<OffsetT>;
+
+  TypedRaggedSegment() = default;
+
+  /*!
+   * \brief Construct a ragged segment over num_rows rows of a CSR graph
+   *
+   * \param offsets num_rows + 1 offsets, with offsets[num_rows] == nnz
+   * \param indices nnz indices
+   */
+  RAJA_HOST_DEVICE TypedRaggedSegment(OffsetT const* offsets,
+                                      StorageT const* indices,
+                                      Index_type num_rows,
+                                      Index_type nnz)
+      : m_offsets(offsets),
+        m_indices(indices),
+        m_num_rows(num_rows),
+        m_nnz(nnz)
+  {
+  }
+
+  //! Get an iterator to the index of position 0
+  RAJA_HOST_DEVICE iterator begin() const { return m_indices; }
+
+  //! Get an iterator to the end of the indices
+  RAJA_HOST_DEVICE iterator end() const { return m_indices + m_nnz; }
+
+  //! Get the number of positions of the graph
+  RAJA_HOST_DEVICE Index_type size() const { return m_nnz; }
+
+  RAJA_HOST_DEVICE Index_type num_rows() const { return m_num_rows; }
+
+  RAJA_HOST_DEVICE OffsetT const* offsets() const { return m_offsets; }
+
+  RAJA_HOST_DEVICE StorageT const* indices() const { return m_indices; }
+
+  //! Get the index at position k
+  RAJA_HOST_DEVICE StorageT operator[](OffsetT k) const
+  {
+    return m_indices[k];
+  }
+
+  //! Get the range of the positions of row r
+  template <typename RowT>
+  RAJA_HOST_DEVICE row_segment row(RowT r) const
+  {
+    return row_segment(m_offsets[r], m_offsets[r + 1]);
+  }
+
+  template <typename RowT>
+  RAJA_HOST_DEVICE OffsetT row_size(RowT r) const
+  {
+    return m_offsets[r + 1] - m_offsets[r];
+  }
+
+  /*!
+   * \brief Get the rows of part of num_parts parts with about the same
+   *        number of positions.
+   *
+   * Part p begins at the first row whose offset is at least p * nnz /
+   * num_parts, so the parts cover all rows in order, and a row longer than
+   * nnz / num_parts makes the parts after it empty. Each call is a binary
+   * search of the offsets.
+   */
+  RAJA_HOST_DEVICE TypedRangeSegment<Index_type> partition_rows(
+      Index_type part,
+      Index_type num_parts) const
+  {
+    return TypedRangeSegment<Index_type>(part_begin(part, num_parts),
+                                         part_begin(part + 1, num_parts));
+  }
+
+  RAJA_HOST_DEVICE bool operator==(TypedRaggedSegment const& o) const
+  {
+    return m_offsets == o.m_offsets && m_indices == o.m_indices &&
+           m_num_rows == o.m_num_rows && m_nnz == o.m_nnz;
+  }
+
+  RAJA_HOST_DEVICE bool operator!=(TypedRaggedSegment const& o) const
+  {
+    return !(*this == o);
+  }
+
+private:
+  // first row of part, the lower bound of its first position in offsets
+  RAJA_HOST_DEVICE Index_type part_begin(Index_type part,
+                                         Index_type num_parts) const
+  {
+    if (part <= 0) return 0;
+    if (part >= num_parts) return m_num_rows;
+
+    const Index_type target = static_cast<Index_type>(m_offsets[0]) +
+                              (m_nnz * part) / num_parts;
+    Index_type lo = 0;
+    Index_type hi = m_num_rows;
+    while (lo < hi) {
+      const Index_type mid = lo + (hi - lo) / 2;
+      if (static_cast<Index_type>(m_offsets[mid]) < target) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  OffsetT const* m_offsets = nullptr;
+  StorageT const* m_indices = nullptr;
+  Index_type m_num_rows = 0;
+  Index_type m_nnz = 0;
+};
+
+//! Alias for TypedRaggedSegment<Index_type>
+using RaggedSegment = TypedRaggedSegment<Index_type>;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,458 @@
+/*!
+ ******************************************************************************
+ *
+ * \file RunListSegment.hpp
+ *
+ * \brief  Header file containing definition of RAJA run-length encoded list
+ *         segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_RunListSegment_HPP
+#define RAJA_RunListSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Maps a position in a run list segment to its index.
+ *
+ * offsets[r] is the position of the first index of run r and
+ * offsets[num_runs] is the segment size, the run of a position is found by
+ * binary search over the offsets.
+ */
+template <typename StorageT>
+struct RunListDecoder {
+  const StorageT* starts;
+  const Index_type* offsets;
+  Index_type num_runs;
+
+  RAJA_HOST_DEVICE StorageT operator()(Index_type pos) const
+  {
+    Index_type lo = 0;
+    Index_type hi = num_runs - 1;
+    while (lo < hi) {
+      const Index_type mid = (lo + hi + 1) / 2;
+      if (offsets[mid] <= pos) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    return static_cast<StorageT>(starts[lo] + (pos - offsets[lo]));
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedRunListSegment
+ *
+ * \brief  Segment class representing a collection of indices stored as runs
+ *         of consecutive indices.
+ *
+ * \tparam StorageT underlying data type for the segment indices (required)
+ *
+ * A TypedRunListSegment models an Iterable interface:
+ *
+ *  begin() -- returns a TypedRunListSegment::iterator
+ *  end() -- returns a TypedRunListSegment::iterator
+ *  size() -- returns size of the Segment iteration space (RAJA::Index_type)
+ *
+ * Each run is stored as its first index and its position in the segment,
+ * so an index list made of long runs with a few gaps takes a few values per
+ * run instead of one per index. The runs are copied to the memory space of
+ * the camp resource passed to the constructor, and a host copy is kept.
+ *
+ * NOTE: TypedRunListSegment::iterator is a RandomAccessIterator that finds
+ *       the run of each position by binary search. With host execution
+ *       policies forall runs each run as a TypedRangeSegment instead, so the
+ *       loops over the runs are contiguous.
+ *
+ * Usage:
+ *
+ * \verbatim
+ * camp::resources::Resource resource{ camp resource type };
+ * TypedRunListSegment<T> runseg(indices, length, resource);
+ *
+ * forall<exec_pol>(runseg, [=] (T i) {
+ *   // loop body -- use i as index value
+ * });
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT>
+class TypedRunListSegment
+{
+public:
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! The underlying iterator type
+  using iterator =
+      Iterators::transform_iterator<Iterators::numeric_iterator<Index_type>,
+                                    detail::RunListDecoder<StorageT>>;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //@}
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a run list segment from an array of indices, runs of
+   *        consecutive indices are stored as one run.
+   *
+   * \param values array of indices defining iteration space of segment
+   * \param length number of indices
+   * \param resource camp resource defining memory space where run data live
+   *
+   * The given array must live in host memory space.
+   */
+  TypedRunListSegment(const value_type* values,
+                      Index_type length,
+                      camp::resources::Resource resource)
+    : m_resource(resource)
+  {
+    for (Index_type i = 0; i < length; ++i) {
+      if (i == 0 || values[i] != static_cast<value_type>(values[i - 1] + 1)) {
+        m_starts.push_back(values[i]);
+        m_offsets.push_back(i);
+      }
+    }
+    initRunData(length);
+  }
+
+  /*!
+   * \brief Construct a run list segment from arrays of run starts and
+   *        run lengths.
+   *
+   * \param starts first index of each run
+   * \param lengths number of indices in each run
+   * \param num_runs number of runs
+   * \param resource camp resource defining memory space where run data live
+   *
+   * The given arrays must live in host memory space, empty runs are
+   * dropped.
+   */
+  TypedRunListSegment(const value_type* starts,
+                      const Index_type* lengths,
+                      Index_type num_runs,
+                      camp::resources::Resource resource)
+    : m_resource(resource)
+  {
+    Index_type len = 0;
+    for (Index_type r = 0; r < num_runs; ++r) {
+      if (lengths[r] > 0) {
+        m_starts.push_back(starts[r]);
+        m_offsets.push_back(len);
+        len += lengths[r];
+      }
+    }
+    initRunData(len);
+  }
+
+  /*!
+   * \brief Construct a run list segment from given container of indices.
+   *
+   * \param container container of indices for segment
+   * \param resource camp resource defining memory space where run data live
+   *
+   * The given container must provide methods begin(), end(), and size(),
+   * and its data must live in host memory space.
+   */
+  template <typename Container>
+  TypedRunListSegment(const Container& container,
+                      camp::resources::Resource resource)
+    : m_resource(resource)
+  {
+    Index_type len = 0;
+    auto src = container.begin();
+    auto const end = container.end();
+    value_type prev{};
+    while (src != end) {
+      const value_type val = *src;
+      if (len == 0 || val != static_cast<value_type>(prev + 1)) {
+        m_starts.push_back(val);
+        m_offsets.push_back(len);
+      }
+      prev = val;
+      ++len;
+      ++src;
+    }
+    initRunData(len);
+  }
+
+  //! Disable compiler generated constructor
+  TypedRunListSegment() = delete;
+
+  //! Copy constructor for run list segment
+  TypedRunListSegment(const TypedRunListSegment& other)
+    : m_resource(other.m_resource),
+      m_starts(other.m_starts),
+      m_offsets(other.m_offsets)
+  {
+    initRunData(other.m_size);
+  }
+
+  //! Move constructor for run list segment
+  TypedRunListSegment(TypedRunListSegment&& rhs)
+    : m_resource(rhs.m_resource),
+      m_starts(std::move(rhs.m_starts)),
+      m_offsets(std::move(rhs.m_offsets)),
+      m_data_starts(rhs.m_data_starts),
+      m_data_offsets(rhs.m_data_offsets),
+      m_size(rhs.m_size),
+      m_runs(rhs.m_runs)
+  {
+    // leave the rhs empty so it's destructor won't have any side effects
+    rhs.m_data_starts = nullptr;
+    rhs.m_data_offsets = nullptr;
+    rhs.m_size = 0;
+    rhs.m_runs = 0;
+    rhs.m_starts.clear();
+    rhs.m_offsets.clear();
+  }
+
+  //! Run list segment destructor
+  ~TypedRunListSegment()
+  {
+    if (m_data_starts != nullptr) {
+      m_resource.deallocate(m_data_starts);
+      m_resource.deallocate(m_data_offsets);
+    }
+  }
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  RAJA_HOST_DEVICE iterator begin() const
+  {
+    return iterator(Iterators::numeric_iterator<Index_type>(0), decoder());
+  }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(Iterators::numeric_iterator<Index_type>(m_size),
+                    decoder());
+  }
+
+  /*!
+   * \brief Get size of this segment (number of indices)
+   */
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  /*!
+   * \brief Get number of runs in this segment
+   */
+  RAJA_HOST_DEVICE Index_type getNumRuns() const
+  {
+    return m_size > 0 ? static_cast<Index_type>(m_runs) : 0;
+  }
+
+  /*!
+   * \brief Get a run of this segment as a range segment, from the host copy
+   *        of the runs
+   */
+  TypedRangeSegment<StorageT> getRun(Index_type run) const
+  {
+    const value_type start = m_starts[run];
+    const Index_type len = m_offsets[run + 1] - m_offsets[run];
+    return TypedRangeSegment<StorageT>(
+        stripIndexType(start),
+        stripIndexType(static_cast<value_type>(start + len)));
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment's indices to an array of values
+   *
+   * \param container pointer to array of values
+   * \param len number of values to compare
+   *
+   * \return true if segment size is same as given length value and values in
+   *         given array match segment index values, else false
+   *
+   * Method assumes values in given array live in host memory space.
+   */
+  bool indicesEqual(const value_type* container, Index_type len) const
+  {
+    if (len != m_size) return false;
+    if (len > 0 && container == nullptr) return false;
+    for (Index_type run = 0; run < getNumRuns(); ++run) {
+      for (Index_type i = m_offsets[run]; i < m_offsets[run + 1]; ++i) {
+        if (container[i] !=
+            static_cast<value_type>(m_starts[run] + (i - m_offsets[run]))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if both segments have the same runs, else false
+   */
+  bool operator==(const TypedRunListSegment& other) const
+  {
+    return m_size == other.m_size &&
+           (m_size == 0 || (m_starts == other.m_starts &&
+                            m_offsets == other.m_offsets));
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   *
+   * \return true if the segments do not have the same runs, else false
+   */
+  bool operator!=(const TypedRunListSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  void swap(TypedRunListSegment& other)
+  {
+    camp::safe_swap(m_resource, other.m_resource);
+    m_starts.swap(other.m_starts);
+    m_offsets.swap(other.m_offsets);
+    camp::safe_swap(m_data_starts, other.m_data_starts);
+    camp::safe_swap(m_data_offsets, other.m_data_offsets);
+    camp::safe_swap(m_size, other.m_size);
+    camp::safe_swap(m_runs, other.m_runs);
+  }
+
+private:
+  //
+  // Finish the host copy of the runs and copy them to the resource.
+  //
+  void initRunData(Index_type len)
+  {
+    m_size = len;
+    m_runs = m_starts.size();
+    if (m_size <= 0) {
+      m_size = 0;
+      m_runs = 0;
+      return;
+    }
+    m_offsets.resize(m_runs);
+    m_offsets.push_back(m_size);
+
+    m_data_starts = m_resource.allocate<value_type>(m_runs);
+    m_data_offsets = m_resource.allocate<Index_type>(m_runs + 1);
+    m_resource.memcpy(m_data_starts,
+                      m_starts.data(),
+                      sizeof(value_type) * m_runs);
+    m_resource.memcpy(m_data_offsets,
+                      m_offsets.data(),
+                      sizeof(Index_type) * (m_runs + 1));
+  }
+
+  RAJA_HOST_DEVICE detail::RunListDecoder<StorageT> decoder() const
+  {
+    return detail::RunListDecoder<StorageT>{
+        m_data_starts, m_data_offsets, static_cast<Index_type>(m_runs)};
+  }
+
+  // Copy of camp resource passed to ctor
+  camp::resources::Resource m_resource;
+
+  // Host copy of the first index and position of each run, the offsets end
+  // with the segment size
+  std::vector<value_type> m_starts;
+  std::vector<Index_type> m_offsets;
+
+  // Run data in the memory space of the resource
+  value_type* m_data_starts = nullptr;
+  Index_type* m_data_offsets = nullptr;
+
+  // Size of run list segment
+  Index_type m_size = 0;
+
+  // Number of runs
+  size_t m_runs = 0;
+};
+
+//! Alias for A TypedRunListSegment<Index_type>
+using RunListSegment = TypedRunListSegment<Index_type>;
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_run_list_segment
+    : ::RAJA::type_traits::SpecializationOf<RAJA::TypedRunListSegment,
+                                            typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedRunListSegment
+template <typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedRunListSegment<StorageT>& a,
+                      RAJA::TypedRunListSegment<StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,144 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the definition of a range segment with
+ *          bounds known at compile time, whose loops are fully unrolled.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_StaticRangeSegment_HPP
+#define RAJA_StaticRangeSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedStaticRangeSegment
+ *
+ * \brief  Segment class representing the contiguous range [Begin, End) of
+ *         indices known at compile time
+ *
+ * It is an Iterable like TypedRangeSegment and may be used with any policy.
+ * Sequential loops over it, in forall, in the For statements of kernel and
+ * in the loops of launch, are fully unrolled; it is meant for small extents
+ * such as the 3 spatial dimensions or the 8 nodes of an element:
+ *
+ * \verbatim
+ * RAJA::forall<RAJA::seq_exec>(RAJA::static_range<0, 8>{}, [=] (int node) {
+ *   x[node] = ...;
+ * });
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT, StorageT Begin, StorageT End>
+struct TypedStaticRangeSegment {
+
+  static_assert(std::is_integral<StorageT>::value,
+                "TypedStaticRangeSegment Type must be integral.");
+  static_assert(Begin <= End,
+                "TypedStaticRangeSegment requires Begin <= End.");
+
+  //! The type for a difference in index values
+  using IndexType = typename std::make_signed<StorageT>::type;
+
+  //! The underlying iterator type
+  using iterator = Iterators::numeric_iterator<StorageT, IndexType>;
+
+  //! The underlying value type
+  using value_type = StorageT;
+
+  static constexpr StorageT first = Begin;
+
+  static constexpr IndexType length = static_cast<IndexType>(End - Begin);
+
+  RAJA_HOST_DEVICE constexpr TypedStaticRangeSegment() {}
+
+  RAJA_HOST_DEVICE RAJA_INLINE iterator begin() const { return iterator(Begin); }
+
+  RAJA_HOST_DEVICE RAJA_INLINE iterator end() const { return iterator(End); }
+
+  RAJA_HOST_DEVICE constexpr IndexType size() const { return length; }
+
+  RAJA_HOST_DEVICE constexpr bool operator==(TypedStaticRangeSegment const&) const
+  {
+    return true;
+  }
+
+  RAJA_HOST_DEVICE constexpr bool operator!=(TypedStaticRangeSegment const&) const
+  {
+    return false;
+  }
+};
+
+//! Alias for the compile time range [Begin, End) of Index_type
+template <Index_type Begin, Index_type End>
+using static_range = TypedStaticRangeSegment<Index_type, Begin, End>;
+
+namespace detail
+{
+
+template <typename T, T Begin, typename Body, camp::idx_t... Is>
+RAJA_HOST_DEVICE RAJA_INLINE void static_range_apply(Body&& body,
+                                                     camp::idx_seq<Is...>)
+{
+  // the order of a braced list is the order of the range
+  int unused[] = {0, (body(static_cast<T>(Begin + static_cast<T>(Is))), 0)...};
+  RAJA_UNUSED_VAR(unused);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Call body with each index of segment in order, in unrolled code
+ */
+template <typename T, T Begin, T End, typename Body>
+RAJA_HOST_DEVICE RAJA_INLINE void static_for_each(
+    TypedStaticRangeSegment<T, Begin, End> const&,
+    Body&& body)
+{
+  detail::static_range_apply<T, Begin>(
+      body,
+      camp::make_idx_seq_t<static_cast<camp::idx_t>(End - Begin)>{});
+}
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_static_range : std::false_type {
+};
+
+template <typename T, T Begin, T End>
+struct is_static_range<TypedStaticRangeSegment<T, Begin, End>>
+    : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
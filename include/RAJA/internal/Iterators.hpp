@@ -419,6 +419,170 @@ private:
 };
 
 
+/*!
+ * \brief Random access iterator whose values are a function applied to the
+ *        values of another iterator.
+ *
+ * The function is called every time a value is read, so algorithms can
+ * consume computed values without writing them to memory first.
+ */
+template <typename Iter, typename Func>
+class transform_iterator
+{
+public:
+  using base_reference = decltype(*std::declval<Iter const&>());
+  using value_type = typename std::decay<decltype(
+      std::declval<Func const&>()(std::declval<base_reference>()))>::type;
+  using difference_type =
+      typename std::iterator_traits<Iter>::difference_type;
+  using pointer = value_type*;
+  using reference = value_type;
+  using iterator_category = std::random_access_iterator_tag;
+
+  RAJA_HOST_DEVICE constexpr transform_iterator(Iter iter, Func func)
+      : m_iter(iter), m_func(func)
+  {
+  }
+
+  RAJA_HOST_DEVICE inline bool operator==(const transform_iterator& rhs) const
+  {
+    return m_iter == rhs.m_iter;
+  }
+  RAJA_HOST_DEVICE inline bool operator!=(const transform_iterator& rhs) const
+  {
+    return m_iter != rhs.m_iter;
+  }
+  RAJA_HOST_DEVICE inline bool operator>(const transform_iterator& rhs) const
+  {
+    return m_iter > rhs.m_iter;
+  }
+  RAJA_HOST_DEVICE inline bool operator<(const transform_iterator& rhs) const
+  {
+    return m_iter < rhs.m_iter;
+  }
+  RAJA_HOST_DEVICE inline bool operator>=(const transform_iterator& rhs) const
+  {
+    return m_iter >= rhs.m_iter;
+  }
+  RAJA_HOST_DEVICE inline bool operator<=(const transform_iterator& rhs) const
+  {
+    return m_iter <= rhs.m_iter;
+  }
+
+  RAJA_HOST_DEVICE inline transform_iterator& operator++()
+  {
+    ++m_iter;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator& operator--()
+  {
+    --m_iter;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator operator++(int)
+  {
+    transform_iterator tmp(*this);
+    ++m_iter;
+    return tmp;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator operator--(int)
+  {
+    transform_iterator tmp(*this);
+    --m_iter;
+    return tmp;
+  }
+
+  RAJA_HOST_DEVICE inline transform_iterator& operator+=(
+      const difference_type& rhs)
+  {
+    m_iter += rhs;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator& operator-=(
+      const difference_type& rhs)
+  {
+    m_iter -= rhs;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE inline difference_type operator-(
+      const transform_iterator& rhs) const
+  {
+    return m_iter - rhs.m_iter;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator operator+(
+      const difference_type& rhs) const
+  {
+    return transform_iterator(m_iter + rhs, m_func);
+  }
+  RAJA_HOST_DEVICE inline transform_iterator operator-(
+      const difference_type& rhs) const
+  {
+    return transform_iterator(m_iter - rhs, m_func);
+  }
+  RAJA_HOST_DEVICE friend inline transform_iterator operator+(
+      difference_type lhs,
+      const transform_iterator& rhs)
+  {
+    return rhs + lhs;
+  }
+
+  RAJA_HOST_DEVICE inline value_type operator*() const
+  {
+    return m_func(*m_iter);
+  }
+  RAJA_HOST_DEVICE inline value_type operator[](difference_type rhs) const
+  {
+    return m_func(m_iter[rhs]);
+  }
+
+private:
+  Iter m_iter;
+  Func m_func;
+};
+
+template <typename Iter, typename Func>
+RAJA_HOST_DEVICE constexpr transform_iterator<Iter, Func>
+make_transform_iterator(Iter iter, Func func)
+{
+  return transform_iterator<Iter, Func>(iter, func);
+}
+
+/*!
+ * True for numeric iterators with values wider than 32 bits, whose loops
+ * device back-ends may run with 32 bit indices when the range fits
+ */
+template <typename Iter>
+struct is_wide_numeric_iterator : std::false_type {
+};
+
+template <typename Type, typename DifferenceType, typename PointerType>
+struct is_wide_numeric_iterator<
+    numeric_iterator<Type, DifferenceType, PointerType>>
+    : std::integral_constant<
+          bool,
+          std::is_integral<strip_index_type_t<Type>>::value &&
+              (sizeof(strip_index_type_t<Type>) > sizeof(int))> {
+};
+
+//! true if the values [*begin, *begin + len) of a numeric iterator fit in int
+template <typename Iter, typename DifferenceType>
+RAJA_INLINE bool range_fits_int(Iter begin, DifferenceType len)
+{
+  using value_type =
+      strip_index_type_t<typename std::decay<decltype(*begin)>::type>;
+  constexpr long long int_min = std::numeric_limits<int>::min();
+  constexpr long long int_max = std::numeric_limits<int>::max();
+
+  const value_type first = stripIndexType(*begin);
+  if (first > static_cast<value_type>(int_max) ||
+      static_cast<long long>(len) > int_max) {
+    return false;
+  }
+  const long long lfirst = static_cast<long long>(first);
+  return lfirst >= int_min && lfirst + static_cast<long long>(len) <= int_max;
+}
+
 }  // namespace Iterators
 
 }  // namespace RAJA
@@ -21,8 +21,11 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
@@ -30,6 +33,34 @@
 namespace RAJA
 {
 
+namespace detail
+{
+
+//
+// Storage for the items of a RAJAVec kept inside the object, empty when
+// there are none so that it takes no space.
+//
+template <typename T, std::size_t InlineCapacity>
+struct RAJAVecInlineStorage {
+  T* inline_data() { return reinterpret_cast<T*>(&m_inline); }
+
+  const T* inline_data() const
+  {
+    return reinterpret_cast<const T*>(&m_inline);
+  }
+
+private:
+  typename std::aligned_storage<sizeof(T) * InlineCapacity, alignof(T)>::type
+      m_inline;
+};
+
+template <typename T>
+struct RAJAVecInlineStorage<T, 0> {
+  std::nullptr_t inline_data() const { return nullptr; }
+};
+
+}  // namespace detail
+
 /*!
  ******************************************************************************
  *
@@ -44,12 +75,20 @@ namespace RAJA
  *               Template type should support standard semantics for
  *               copy, swap, etc.
  *
+ *               Up to InlineCapacity items are stored inside the vector
+ *               object, without allocating, which makes short vectors such
+ *               as the segment lists of most IndexSets cheap to create.
+ *               Trivially copyable items are moved by copying their bytes
+ *               when the vector grows.
+ *
  *               Note that this class has no exception safety guarantees.
  *
  ******************************************************************************
  */
-template <typename T, typename Allocator = std::allocator<T> >
-class RAJAVec
+template <typename T,
+          typename Allocator = std::allocator<T>,
+          std::size_t InlineCapacity = 0>
+class RAJAVec : private detail::RAJAVecInlineStorage<T, InlineCapacity>
 {
   using allocator_traits_type = std::allocator_traits<Allocator>;
   using propagate_on_container_copy_assignment =
@@ -70,12 +109,20 @@ public:
   using iterator = value_type*;
   using const_iterator = const value_type*;
 
+  static_assert(InlineCapacity == 0 || std::is_same<pointer, T*>::value,
+                "RAJAVec inline storage requires an allocator using T*");
+
+  static constexpr size_type inline_capacity = InlineCapacity;
+
   ///
   /// Construct empty vector with given capacity.
   ///
   explicit RAJAVec(size_type init_cap = 0,
                    const allocator_type& a = allocator_type())
-      : m_data(nullptr), m_allocator(a), m_capacity(0), m_size(0)
+      : m_data(this->inline_data()),
+        m_allocator(a),
+        m_capacity(InlineCapacity),
+        m_size(0)
   {
     reserve(init_cap);
   }
@@ -84,9 +131,9 @@ public:
   /// Copy ctor for vector.
   ///
   RAJAVec(const RAJAVec& other)
-      : m_data(nullptr),
+      : m_data(this->inline_data()),
         m_allocator(allocator_traits_type::select_on_container_copy_construction(other.m_allocator)),
-        m_capacity(0),
+        m_capacity(InlineCapacity),
         m_size(0)
   {
     reserve(other.size());
@@ -97,14 +144,12 @@ public:
   /// Move ctor for vector.
   ///
   RAJAVec(RAJAVec&& other)
-      : m_data(other.m_data),
+      : m_data(this->inline_data()),
         m_allocator(std::move(other.m_allocator)),
-        m_capacity(other.m_capacity),
-        m_size(other.m_size)
+        m_capacity(InlineCapacity),
+        m_size(0)
   {
-    other.m_data = nullptr;
-    other.m_capacity = 0;
-    other.m_size = 0;
+    take_storage(other);
   }
 
   ///
@@ -340,14 +385,8 @@ private:
     clear();
     shrink_to_fit();
 
-    m_data = rhs.m_data;
     m_allocator = std::move(rhs.m_allocator);
-    m_capacity = rhs.m_capacity;
-    m_size = rhs.m_size;
-
-    rhs.m_data = nullptr;
-    rhs.m_capacity = 0;
-    rhs.m_size = 0;
+    take_storage(rhs);
   }
 
   ///
@@ -360,13 +399,7 @@ private:
       clear();
       shrink_to_fit();
 
-      m_data = rhs.m_data;
-      m_capacity = rhs.m_capacity;
-      m_size = rhs.m_size;
-
-      rhs.m_data = nullptr;
-      rhs.m_capacity = 0;
-      rhs.m_size = 0;
+      take_storage(rhs);
     } else {
       reserve(rhs.size());
       if (size() < rhs.size()) {
@@ -385,10 +418,8 @@ private:
   void swap_private(RAJAVec& other, std::true_type)
   {
     using std::swap;
-    swap(m_data,      other.m_data);
+    swap_storage(other);
     swap(m_allocator, other.m_allocator);
-    swap(m_capacity,  other.m_capacity);
-    swap(m_size,      other.m_size);
   }
 
   ///
@@ -396,10 +427,78 @@ private:
   ///
   void swap_private(RAJAVec& other, std::false_type)
   {
-    using std::swap;
-    swap(m_data,      other.m_data);
-    swap(m_capacity,  other.m_capacity);
-    swap(m_size,      other.m_size);
+    swap_storage(other);
+  }
+
+  ///
+  /// Whether the items are in the inline storage.
+  ///
+  bool is_inline() const
+  {
+    return InlineCapacity > 0 && m_data == this->inline_data();
+  }
+
+  //
+  // Swap the items of the two vectors, moving inline items.
+  //
+  void swap_storage(RAJAVec& other)
+  {
+    if (!is_inline() && !other.is_inline()) {
+      using std::swap;
+      swap(m_data,      other.m_data);
+      swap(m_capacity,  other.m_capacity);
+      swap(m_size,      other.m_size);
+    } else {
+      RAJAVec tmp(0, m_allocator);
+      tmp.take_storage(*this);
+      take_storage(other);
+      other.take_storage(tmp);
+    }
+  }
+
+  //
+  // Take the items of other, leaving it empty with its inline storage.
+  // NOTE: assumes this is empty and has no allocated storage
+  //
+  void take_storage(RAJAVec& other)
+  {
+    if (other.is_inline()) {
+      relocate_items(m_data, other.m_data, other.m_size);
+      m_size = other.m_size;
+    } else {
+      m_data = other.m_data;
+      m_capacity = other.m_capacity;
+      m_size = other.m_size;
+
+      other.m_data = other.inline_data();
+      other.m_capacity = InlineCapacity;
+    }
+    other.m_size = 0;
+  }
+
+  //
+  // Move count items from src to the uninitialized dst, destroying them in
+  // src.
+  //
+  void relocate_items(pointer dst, pointer src, size_type count)
+  {
+    relocate_items(dst, src, count, std::is_trivially_copyable<T>{});
+  }
+
+  void relocate_items(pointer dst, pointer src, size_type count, std::true_type)
+  {
+    if (count > 0) {
+      std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src),
+                  count * sizeof(T));
+    }
+  }
+
+  void relocate_items(pointer dst, pointer src, size_type count, std::false_type)
+  {
+    for (size_type i = 0; i < count; ++i) {
+      allocator_traits_type::construct(m_allocator, dst+i, std::move(src[i]));
+      allocator_traits_type::destroy(m_allocator, src+i);
+    }
   }
 
   //
@@ -535,22 +634,27 @@ private:
   }
 
   //
-  // Reallocate to change capacity to next_cap.
+  // Reallocate to change capacity to next_cap, or to the inline capacity
+  // if next_cap fits in it.
   // NOTE: assumes next_cap >= size()
   //
   void change_cap(size_type next_cap)
   {
-    pointer tdata = nullptr;
-    if (next_cap != 0) {
+    pointer tdata = this->inline_data();
+    if (next_cap <= InlineCapacity) {
+      if (is_inline()) {
+        return;
+      }
+      next_cap = InlineCapacity;
+    } else {
       tdata = allocator_traits_type::allocate(m_allocator, next_cap);
     }
 
     if (m_data) {
-      for (size_type i = 0; i < m_size; ++i) {
-        allocator_traits_type::construct(m_allocator, tdata+i, std::move(m_data[i]));
-        allocator_traits_type::destroy(m_allocator, m_data+i);
+      relocate_items(tdata, m_data, m_size);
+      if (!is_inline()) {
+        allocator_traits_type::deallocate(m_allocator, m_data, m_capacity);
       }
-      allocator_traits_type::deallocate(m_allocator, m_data, m_capacity);
     }
 
     m_data = tdata;
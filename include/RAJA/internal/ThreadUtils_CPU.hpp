@@ -21,6 +21,11 @@
 
 #include "RAJA/config.hpp"
 
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+
 #if defined(RAJA_ENABLE_OPENMP)
 #include <omp.h>
 #endif
@@ -47,6 +52,54 @@ int getMaxOMPThreadsCPU()
   return nthreads;
 }
 
+/*!
+*************************************************************************
+*
+* Return number of hardware threads of the node.
+*
+*************************************************************************
+*/
+RAJA_INLINE
+int getNumHardwareThreadsCPU()
+{
+  static const int nthreads = [] {
+    const unsigned n = std::thread::hardware_concurrency();
+    return n > 0 ? static_cast<int>(n) : 1;
+  }();
+  return nthreads;
+}
+
+/*!
+*************************************************************************
+*
+* Return number of physical cores of the node, counting the hardware
+* threads that share a core once. Where the topology is not known every
+* hardware thread is taken to be a core.
+*
+*************************************************************************
+*/
+RAJA_INLINE
+int getNumCoresCPU()
+{
+  static const int ncores = [] {
+    const int nthreads = getNumHardwareThreadsCPU();
+    std::set<std::string> cores;
+#if defined(__linux__)
+    for (int cpu = 0; cpu < nthreads; ++cpu) {
+      std::ifstream siblings("/sys/devices/system/cpu/cpu" +
+                             std::to_string(cpu) +
+                             "/topology/thread_siblings_list");
+      std::string list;
+      if (siblings >> list) {
+        cores.insert(list);
+      }
+    }
+#endif
+    return cores.empty() ? nthreads : static_cast<int>(cores.size());
+  }();
+  return ncores;
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -3,17 +3,16 @@
  *
  * \file
  *
- * \brief   Header file containing RAJA Fault Tolerance macros.
- *          RAJA Fault Tolerance only works when all the lambda
- *          functions passed to RAJA are in idempotent form,
- *          meaning there are no persistent variables in the
- *          lambda that have read-write semantics. In other words,
- *          persistent lambda function variables must be consistently
- *          used as read-only or write-only within the lambda scope.
+ * \brief   Header file containing the RAJA Fault Tolerance macros, which
+ *          are no longer used.
  *
- *          These macros are designed to cooperate with an external
- *          signal handler that sets a global variable, fault_type,
- *          when a fault occurs. fault_type must be initialized to zero.
+ *          They re-executed each launch while a global variable,
+ *          fault_type, set by an external signal handler was positive,
+ *          which serialized asynchronous loops and could not undo the writes
+ *          of a loop. Loops that must survive soft errors are run with
+ *          RAJA::expt::resilient_forall, in RAJA/pattern/resilient.hpp,
+ *          and a detected error is signalled with
+ *          RAJA::expt::soft_error_flag().
  *
  ******************************************************************************
  */
@@ -30,76 +29,13 @@
 
 #include "RAJA/config.hpp"
 
-#if defined(RAJA_ENABLE_FT)
-
-#if defined(RAJA_REPORT_FT)
-
-#include <stdio.h>
-#include "cycle.h"
-
-#define RAJA_FT_BEGIN                          \
-  extern volatile int fault_type;              \
-  bool repeat;                                 \
-  bool do_time = false;                        \
-  ticks start = 0, stop = 0;                   \
-  if (fault_type != 0) {                       \
-    printf("Uncaught fault %d\n", fault_type); \
-    fault_type = 0;                            \
-  }                                            \
-  do {                                         \
-    repeat = false;                            \
-    if (do_time) {                             \
-      start = getticks();                      \
-    }
-
-#define RAJA_FT_END                                                          \
-  if (do_time) {                                                             \
-    stop = getticks();                                                       \
-    printf("recoverable fault clock cycles = %16f\n", elapsed(stop, start)); \
-    do_time = false;                                                         \
-    fault_type = 0;                                                          \
-  }                                                                          \
-  if (fault_type < 0) {                                                      \
-    printf("Unrecoverable fault (restart penalty)\n");                       \
-    fault_type = 0;                                                          \
-  }                                                                          \
-  if (fault_type > 0) {                                                      \
-    /* invalidate cache */                                                   \
-    repeat = true;                                                           \
-    do_time = true;                                                          \
-  }                                                                          \
-  }                                                                          \
-  while (repeat == true)                                                     \
-    ;
-
-#else
-#define RAJA_FT_BEGIN             \
-  extern volatile int fault_type; \
-  bool repeat;                    \
-  if (fault_type == 0) {          \
-    do {                          \
-      repeat = false;
-
-#define RAJA_FT_END        \
-  if (fault_type > 0) {    \
-    /* invalidate cache */ \
-    repeat = true;         \
-    fault_type = 0;        \
-  }                        \
-  }                        \
-  while (repeat == true)   \
-    ;                      \
-  }                        \
-  else { fault_type = 0; /* ignore for the simulation */ }
-
-#endif  // RAJA_REPORT_FT
-
-#else
-
+//
+// The macros are kept so that code using them still builds, and do
+// nothing: loops are re-executed by RAJA::expt::resilient_forall, from a
+// snapshot of the arrays they write, rather than around each launch.
+//
 #define RAJA_FT_BEGIN
 
 #define RAJA_FT_END
 
-#endif  // RAJA_ENABLE_FT
-
 #endif  // closing endif for header file include guard
@@ -22,9 +22,13 @@
 
 #include "RAJA/pattern/WorkGroup/WorkStorage.hpp"
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
+#include "RAJA/pattern/WorkGroup/WorkNest.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/plugins.hpp"
+#include "RAJA/util/resource.hpp"
 
 namespace RAJA
 {
@@ -166,13 +170,19 @@ struct WorkGroup {
  * of a collection of loops it must not be destroyed before that collection
  * of loops has finished running.
  *
+ * The WorkSite holds an event recorded on the resource after the loops of
+ * the run, which may be queried or waited on, or used to make the run of
+ * another WorkGroup, possibly on another resource, wait for this one.
+ *
  * Usage example:
  *
  * \verbatim
 
    WorkSite<WorkGroup_policy, Index_type, xargs<>, Allocator> site = group.run();
 
-   site.synchronize();
+   auto other_site = other_group.run_after(site, other_resource);
+
+   other_site.synchronize();
 
  * \endverbatim
  *
@@ -193,12 +203,14 @@ struct WorkSite {
 template <typename EXEC_POLICY_T,
           typename ORDER_POLICY_T,
           typename STORAGE_POLICY_T,
+          typename DISPATCH_POLICY_T,
           typename INDEX_T,
           typename ... Args,
           typename ALLOCATOR_T>
 struct WorkPool<WorkGroupPolicy<EXEC_POLICY_T,
                                 ORDER_POLICY_T,
-                                STORAGE_POLICY_T>,
+                                STORAGE_POLICY_T,
+                                DISPATCH_POLICY_T>,
                 INDEX_T,
                 xargs<Args...>,
                 ALLOCATOR_T>
@@ -206,7 +218,9 @@ struct WorkPool<WorkGroupPolicy<EXEC_POLICY_T,
   using exec_policy = EXEC_POLICY_T;
   using order_policy = ORDER_POLICY_T;
   using storage_policy = STORAGE_POLICY_T;
-  using policy = WorkGroupPolicy<exec_policy, order_policy, storage_policy>;
+  using dispatch_policy = DISPATCH_POLICY_T;
+  using policy = WorkGroupPolicy<exec_policy, order_policy, storage_policy,
+                                 dispatch_policy>;
   using index_type = INDEX_T;
   using xarg_type = xargs<Args...>;
   using Allocator = ALLOCATOR_T;
@@ -218,7 +232,8 @@ private:
   using workrunner_type = detail::WorkRunner<
       exec_policy, order_policy, Allocator, index_type, Args...>;
   using storage_type = detail::WorkStorage<
-      storage_policy, Allocator, typename workrunner_type::vtable_type>;
+      storage_policy, Allocator,
+      typename detail::dispatch_vtable<dispatch_policy, workrunner_type>::type>;
 
   friend workgroup_type;
   friend worksite_type;
@@ -251,7 +266,41 @@ public:
     m_storage.reserve(num_loops, storage_bytes);
   }
 
-  template < typename segment_T, typename loop_T >
+  // largest number of loops enqueued before an instantiate or now
+  size_t peak_num_loops() const
+  {
+    return std::max(m_storage.size(), m_max_num_loops);
+  }
+
+  // largest number of bytes of loop storage used before an instantiate or now
+  size_t peak_storage_bytes() const
+  {
+    return std::max(m_storage.storage_size(), m_max_storage_bytes);
+  }
+
+  // number of times enqueuing a loop had to grow the storage past what was
+  // reserved, over the life of the pool
+  size_t num_reallocations() const
+  {
+    return m_num_reallocations + m_storage.num_reallocations();
+  }
+
+  // when enabled, the default, the first enqueue after an instantiate
+  // reserves the peak sizes so later instantiations of the same size do
+  // not grow the storage
+  void set_auto_reserve(bool auto_reserve)
+  {
+    m_auto_reserve = auto_reserve;
+  }
+
+  bool auto_reserve() const
+  {
+    return m_auto_reserve;
+  }
+
+  template < typename segment_T, typename loop_T,
+             typename = typename std::enable_if<
+                 !detail::is_segment_tuple<camp::decay<segment_T>>::value>::type >
   inline void enqueue(segment_T&& seg, loop_T&& loop_body)
   {
     {
@@ -259,12 +308,16 @@ public:
       using std::begin; using std::end;
       if (begin(seg) == end(seg)) return;
     }
-    if (m_storage.begin() == m_storage.end()) {
+    if (m_auto_reserve && m_storage.begin() == m_storage.end()) {
       // perform auto-reserve on reuse
       reserve(m_max_num_loops, m_max_storage_bytes);
     }
 
     util::PluginContext context{util::make_context<exec_policy>()};
+    context.pattern = util::KernelPattern::workgroup;
+    context.policy_name = typeid(exec_policy).name();
+    context.launch_site = typeid(camp::decay<loop_T>).name();
+    context.num_iterations = util::iteration_count(seg);
     util::callPreCapturePlugins(context);
 
     using RAJA::util::trigger_updates_before;
@@ -276,6 +329,33 @@ public:
     util::callPostCapturePlugins(context);
   }
 
+  // enqueue a nest of segments as one loop, the loop body is called with an
+  // index from each segment and the last segment is the fastest moving
+  template < typename ... segment_Ts, typename loop_T >
+  inline void enqueue(camp::tuple<segment_Ts...> const& segs, loop_T&& loop_body)
+  {
+    enqueue(segs, camp::make_idx_seq_t<sizeof...(segment_Ts)>{},
+            std::forward<loop_T>(loop_body));
+  }
+
+  // enqueue a nest of segments as one loop, ordered by a permutation such as
+  // RAJA::PERM_JI, outermost first
+  template < typename ... segment_Ts, camp::idx_t ... Perm, typename loop_T >
+  inline void enqueue(camp::tuple<segment_Ts...> const& segs,
+                      camp::idx_seq<Perm...>,
+                      loop_T&& loop_body)
+  {
+    using nest_body = detail::WorkNestBody<index_type,
+                                           camp::idx_seq<Perm...>,
+                                           camp::tuple<segment_Ts...>,
+                                           camp::decay<loop_T>>;
+
+    nest_body body(segs, loop_body);
+    const index_type len = static_cast<index_type>(body.size());
+
+    enqueue(TypedRangeSegment<index_type>(0, len), std::move(body));
+  }
+
   inline workgroup_type instantiate();
 
   void clear()
@@ -295,6 +375,8 @@ private:
   storage_type m_storage;
   size_t m_max_num_loops = 0;
   size_t m_max_storage_bytes = 0;
+  size_t m_num_reallocations = 0;
+  bool m_auto_reserve = true;
 
   workrunner_type m_runner;
 };
@@ -302,12 +384,14 @@ private:
 template <typename EXEC_POLICY_T,
           typename ORDER_POLICY_T,
           typename STORAGE_POLICY_T,
+          typename DISPATCH_POLICY_T,
           typename INDEX_T,
           typename ... Args,
           typename ALLOCATOR_T>
 struct WorkGroup<WorkGroupPolicy<EXEC_POLICY_T,
                                  ORDER_POLICY_T,
-                                 STORAGE_POLICY_T>,
+                                 STORAGE_POLICY_T,
+                                DISPATCH_POLICY_T>,
                  INDEX_T,
                  xargs<Args...>,
                  ALLOCATOR_T>
@@ -315,7 +399,9 @@ struct WorkGroup<WorkGroupPolicy<EXEC_POLICY_T,
   using exec_policy = EXEC_POLICY_T;
   using order_policy = ORDER_POLICY_T;
   using storage_policy = STORAGE_POLICY_T;
-  using policy = WorkGroupPolicy<exec_policy, order_policy, storage_policy>;
+  using dispatch_policy = DISPATCH_POLICY_T;
+  using policy = WorkGroupPolicy<exec_policy, order_policy, storage_policy,
+                                 dispatch_policy>;
   using index_type = INDEX_T;
   using xarg_type = xargs<Args...>;
   using Allocator = ALLOCATOR_T;
@@ -346,6 +432,15 @@ public:
     return run(r, std::move(args)...);
   }
 
+  // run on r once the run of site has finished, without blocking the host,
+  // site may be from a run of any WorkGroup on any resource
+  template < typename site_T >
+  worksite_type run_after(site_T& site, resource_type r, Args... args)
+  {
+    site.make_wait(r);
+    return run(r, std::move(args)...);
+  }
+
   void clear()
   {
     // storage is about to be destroyed
@@ -372,12 +467,14 @@ private:
 template <typename EXEC_POLICY_T,
           typename ORDER_POLICY_T,
           typename STORAGE_POLICY_T,
+          typename DISPATCH_POLICY_T,
           typename INDEX_T,
           typename ... Args,
           typename ALLOCATOR_T>
 struct WorkSite<WorkGroupPolicy<EXEC_POLICY_T,
                                 ORDER_POLICY_T,
-                                STORAGE_POLICY_T>,
+                                STORAGE_POLICY_T,
+                                DISPATCH_POLICY_T>,
                 INDEX_T,
                 xargs<Args...>,
                 ALLOCATOR_T>
@@ -385,7 +482,9 @@ struct WorkSite<WorkGroupPolicy<EXEC_POLICY_T,
   using exec_policy = EXEC_POLICY_T;
   using order_policy = ORDER_POLICY_T;
   using storage_policy = STORAGE_POLICY_T;
-  using policy = WorkGroupPolicy<exec_policy, order_policy, storage_policy>;
+  using dispatch_policy = DISPATCH_POLICY_T;
+  using policy = WorkGroupPolicy<exec_policy, order_policy, storage_policy,
+                                 dispatch_policy>;
   using index_type = INDEX_T;
   using xarg_type = xargs<Args...>;
   using Allocator = ALLOCATOR_T;
@@ -414,6 +513,31 @@ public:
     return m_resource;
   }
 
+  // event recorded on the resource after the loops of the run
+  resources::Event get_event() const
+  {
+    return m_event;
+  }
+
+  // check if the loops of the run have finished
+  bool query() const
+  {
+    return m_event.check();
+  }
+
+  // wait on the host for the loops of the run to finish
+  void synchronize() const
+  {
+    m_event.wait();
+  }
+
+  // make work enqueued on r from now on wait for the loops of the run
+  template < typename resource_T >
+  void make_wait(resource_T& r)
+  {
+    r.wait_for(&m_event);
+  }
+
   void clear()
   {
     // resources is about to be released
@@ -428,10 +552,12 @@ public:
 private:
   per_run_storage m_run_storage;
   resource_type m_resource;
+  resources::Event m_event;
 
   explicit WorkSite(resource_type r, per_run_storage&& run_storage)
     : m_run_storage(std::move(run_storage))
     , m_resource(r)
+    , m_event(m_resource.get_event_erased())
   { }
 };
 
@@ -439,17 +565,18 @@ private:
 template <typename EXEC_POLICY_T,
           typename ORDER_POLICY_T,
           typename STORAGE_POLICY_T,
+          typename DISPATCH_POLICY_T,
           typename INDEX_T,
           typename ... Args,
           typename ALLOCATOR_T>
 inline
 typename WorkPool<
-    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T>,
+    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T, DISPATCH_POLICY_T>,
     INDEX_T,
     xargs<Args...>,
     ALLOCATOR_T>::workgroup_type
 WorkPool<
-    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T>,
+    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T, DISPATCH_POLICY_T>,
     INDEX_T,
     xargs<Args...>,
     ALLOCATOR_T>::instantiate()
@@ -457,6 +584,7 @@ WorkPool<
   // update max sizes to auto-reserve on reuse
   m_max_num_loops = std::max(m_storage.size(), m_max_num_loops);
   m_max_storage_bytes = std::max(m_storage.storage_size(), m_max_storage_bytes);
+  m_num_reallocations += m_storage.num_reallocations();
 
   // move storage into workgroup
   return workgroup_type{std::move(m_storage), std::move(m_runner)};
@@ -465,27 +593,30 @@ WorkPool<
 template <typename EXEC_POLICY_T,
           typename ORDER_POLICY_T,
           typename STORAGE_POLICY_T,
+          typename DISPATCH_POLICY_T,
           typename INDEX_T,
           typename ... Args,
           typename ALLOCATOR_T>
 inline
 typename WorkGroup<
-    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T>,
+    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T, DISPATCH_POLICY_T>,
     INDEX_T,
     xargs<Args...>,
     ALLOCATOR_T>::worksite_type
 WorkGroup<
-    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T>,
+    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T, DISPATCH_POLICY_T>,
     INDEX_T,
     xargs<Args...>,
     ALLOCATOR_T>::run(typename WorkGroup<
-                          WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T>,
+                          WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T, DISPATCH_POLICY_T>,
                           INDEX_T,
                           xargs<Args...>,
                           ALLOCATOR_T>::resource_type r,
                       Args... args)
 {
   util::PluginContext context{util::make_context<EXEC_POLICY_T>()};
+  context.pattern = util::KernelPattern::workgroup;
+  context.policy_name = typeid(EXEC_POLICY_T).name();
   util::callPreLaunchPlugins(context);
 
   // move any per run storage into worksite
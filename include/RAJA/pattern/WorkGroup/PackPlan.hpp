@@ -0,0 +1,255 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA PackPlan, which packs and unpacks
+ *          message buffers with WorkGroups.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_WORKGROUP_PackPlan_HPP
+#define RAJA_PATTERN_WORKGROUP_PackPlan_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/WorkGroup.hpp"
+#include "RAJA/pattern/WorkGroup.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Loop body copying the values of var at the indices in list into buffer
+ */
+template < typename T, typename INDEX_T >
+struct PackPlanPack
+{
+  T* buffer;
+  const T* var;
+  const INDEX_T* list;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(INDEX_T i) const
+  {
+    buffer[i] = var[list[i]];
+  }
+};
+
+/*!
+ * Loop body copying the values in buffer into var at the indices in list
+ */
+template < typename T, typename INDEX_T >
+struct PackPlanUnpack
+{
+  const T* buffer;
+  T* var;
+  const INDEX_T* list;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(INDEX_T i) const
+  {
+    var[list[i]] = buffer[i];
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  PackPlan class template. Describes the layout of a set of messages
+ *         in one buffer and makes WorkGroups that pack and unpack them.
+ *
+ * Each message is a sequence of lists, each list giving the indices of the
+ * values of one variable that are sent, and the indices where the values
+ * received in their place are stored. The offsets of the messages and lists
+ * in the buffer are computed once, as they are added. The pack WorkGroup
+ * writes every list of every message straight into the buffer given to it,
+ * which may be a buffer registered with the communication library, and the
+ * unpack WorkGroup reads the same layout back out of a receive buffer.
+ * With an unordered device WorkGroup policy each of them is one launch.
+ *
+ * The index lists and variables must stay valid while the WorkGroups exist.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   PackPlan<WorkGroup_policy, double, int, Allocator> plan(Allocator{});
+
+   for (int l = 0; l < num_neighbors; ++l) {
+     plan.add_message();
+     for (int v = 0; v < num_vars; ++v) {
+       plan.add_list(vars[v], pack_lists[l], unpack_lists[l], lengths[l]);
+     }
+   }
+
+   // send and receive buffers of plan.buffer_size() values
+   auto pack_group   = plan.make_pack_group(send_buffer);
+   auto unpack_group = plan.make_unpack_group(recv_buffer);
+
+   auto pack_site = pack_group.run(r);
+   // send plan.message_size(l) values at send_buffer + plan.message_offset(l)
+   auto unpack_site = unpack_group.run(r);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template < typename WORKGROUP_POLICY_T,
+           typename T,
+           typename INDEX_T,
+           typename ALLOCATOR_T >
+class PackPlan
+{
+  static_assert(RAJA::pattern_is<WORKGROUP_POLICY_T, RAJA::Pattern::workgroup>::value,
+      "PackPlan: WORKGROUP_POLICY_T must be a workgroup policy");
+public:
+  using policy = WORKGROUP_POLICY_T;
+  using value_type = T;
+  using index_type = INDEX_T;
+  using Allocator = ALLOCATOR_T;
+
+  using workpool_type = WorkPool<policy, index_type, xargs<>, Allocator>;
+  using workgroup_type = WorkGroup<policy, index_type, xargs<>, Allocator>;
+  using worksite_type = WorkSite<policy, index_type, xargs<>, Allocator>;
+  using resource_type = typename workpool_type::resource_type;
+
+  explicit PackPlan(Allocator const& aloc)
+    : m_pack_pool(aloc)
+    , m_unpack_pool(aloc)
+  { }
+
+  PackPlan(PackPlan const&) = delete;
+  PackPlan& operator=(PackPlan const&) = delete;
+
+  PackPlan(PackPlan&&) = default;
+  PackPlan& operator=(PackPlan&&) = default;
+
+  // start a message, the lists added after this are part of it
+  void add_message()
+  {
+    m_message_offsets.push_back(m_buffer_size);
+  }
+
+  // add len values of var to the current message, packed from the indices
+  // in pack_list and unpacked to the indices in unpack_list
+  void add_list(T* var, const INDEX_T* pack_list, const INDEX_T* unpack_list,
+                INDEX_T len)
+  {
+    if (m_message_offsets.empty()) {
+      add_message();
+    }
+    m_lists.push_back(list_type{var, pack_list, unpack_list, len, m_buffer_size});
+    m_buffer_size += static_cast<size_t>(len);
+  }
+
+  // add len values of var to the current message, packed from and unpacked
+  // to the indices in list
+  void add_list(T* var, const INDEX_T* list, INDEX_T len)
+  {
+    add_list(var, list, list, len);
+  }
+
+  size_t num_messages() const
+  {
+    return m_message_offsets.size();
+  }
+
+  size_t num_lists() const
+  {
+    return m_lists.size();
+  }
+
+  // offset of message m in the buffer, in values
+  size_t message_offset(size_t m) const
+  {
+    return m_message_offsets[m];
+  }
+
+  // number of values in message m
+  size_t message_size(size_t m) const
+  {
+    return ((m + 1 < m_message_offsets.size()) ? m_message_offsets[m + 1]
+                                               : m_buffer_size) -
+           m_message_offsets[m];
+  }
+
+  // number of values in all the messages
+  size_t buffer_size() const
+  {
+    return m_buffer_size;
+  }
+
+  // make a WorkGroup that packs every message into buffer, which holds
+  // buffer_size() values
+  workgroup_type make_pack_group(T* buffer)
+  {
+    for (list_type const& list : m_lists) {
+      m_pack_pool.enqueue(TypedRangeSegment<INDEX_T>(0, list.len),
+          detail::PackPlanPack<T, INDEX_T>{buffer + list.offset,
+                                           list.var,
+                                           list.pack_list});
+    }
+    return m_pack_pool.instantiate();
+  }
+
+  // make a WorkGroup that unpacks every message from buffer, which holds
+  // buffer_size() values laid out as in make_pack_group
+  workgroup_type make_unpack_group(const T* buffer)
+  {
+    for (list_type const& list : m_lists) {
+      m_unpack_pool.enqueue(TypedRangeSegment<INDEX_T>(0, list.len),
+          detail::PackPlanUnpack<T, INDEX_T>{buffer + list.offset,
+                                             list.var,
+                                             list.unpack_list});
+    }
+    return m_unpack_pool.instantiate();
+  }
+
+  // forget the messages, the WorkGroups already made are not affected
+  void clear()
+  {
+    m_lists.clear();
+    m_message_offsets.clear();
+    m_buffer_size = 0;
+  }
+
+private:
+  struct list_type
+  {
+    T* var;
+    const INDEX_T* pack_list;
+    const INDEX_T* unpack_list;
+    INDEX_T len;
+    size_t offset;
+  };
+
+  std::vector<list_type> m_lists;
+  std::vector<size_t> m_message_offsets;
+  size_t m_buffer_size = 0;
+
+  workpool_type m_pack_pool;
+  workpool_type m_unpack_pool;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -113,6 +113,13 @@ struct Vtable {
   size_t size;
 };
 
+/*!
+ * Tag for work structs that call a known list of types with a switch over
+ * their index in Types, and use Vtable_T for everything else.
+ */
+template < typename Vtable_T, typename Types >
+struct DirectVtable;
+
 /*!
  * Populate and return a pointer to a Vtable object for the given policy.
  * NOTE: there is a function overload is in each policy/WorkGroup/Vtable.hpp
@@ -0,0 +1,130 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing the loop body used to enqueue a nest of
+ *          segments into a WorkPool as one loop.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_WORKGROUP_WorkNest_HPP
+#define RAJA_PATTERN_WORKGROUP_WorkNest_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/FastDivisor.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template < typename T >
+struct is_segment_tuple : std::false_type { };
+
+template < typename ... Segments >
+struct is_segment_tuple<camp::tuple<Segments...>> : std::true_type { };
+
+/*!
+ * Loop body for a nest of segments, called with one index into the
+ * flattened nest, that calls the loop body with an index from each segment.
+ *
+ * The permutation gives the order of the segments in the nest, outermost
+ * first, as in RAJA::PERM_*. The last segment in the nest is the fastest
+ * moving, so it maps to consecutive threads on the device.
+ */
+template < typename INDEX_T, typename Perm, typename Segments, typename LoopBody >
+struct WorkNestBody;
+
+template < typename INDEX_T,
+           camp::idx_t ... Perm,
+           typename ... Segments,
+           typename LoopBody >
+struct WorkNestBody<INDEX_T,
+                    camp::idx_seq<Perm...>,
+                    camp::tuple<Segments...>,
+                    LoopBody>
+{
+  static constexpr camp::idx_t num_segments = sizeof...(Segments);
+  static_assert(num_segments > 0,
+      "WorkNestBody: the nest needs at least one segment");
+  static_assert(sizeof...(Perm) == num_segments,
+      "WorkNestBody: the permutation must have one entry per segment");
+
+  using offset_type = strip_index_type_t<INDEX_T>;
+  using divisor_type = FastDivisor<offset_type>;
+
+  WorkNestBody(camp::tuple<Segments...> const& segments, LoopBody const& body)
+    : m_segments(segments)
+    , m_body(body)
+  {
+    const offset_type lengths[] = { static_cast<offset_type>(std::distance(
+        std::begin(camp::get<Perm>(m_segments)),
+        std::end(camp::get<Perm>(m_segments))))... };
+    m_size = 1;
+    for (camp::idx_t k = 0; k < num_segments; ++k) {
+      m_lengths[k] = divisor_type(lengths[k] > 0 ? lengths[k] : 1);
+      m_size *= lengths[k] > 0 ? lengths[k] : 0;
+    }
+  }
+
+  // number of iterations in the nest
+  offset_type size() const
+  {
+    return m_size;
+  }
+
+  template < typename ... Args >
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(INDEX_T i, Args... args) const
+  {
+    constexpr camp::idx_t perm[] = { Perm... };
+    offset_type offsets[num_segments];
+    offset_type rem = stripIndexType(i);
+    for (camp::idx_t k = num_segments - 1; k >= 0; --k) {
+      const offset_type quot = m_lengths[k].div(rem);
+      offsets[perm[k]] = rem - quot * m_lengths[k].divisor();
+      rem = quot;
+    }
+    call(camp::make_idx_seq_t<num_segments>{}, offsets, args...);
+  }
+
+private:
+  camp::tuple<Segments...> m_segments;
+  divisor_type m_lengths[num_segments];  // in loop nest order
+  offset_type m_size = 0;
+  LoopBody m_body;
+
+  template < camp::idx_t ... Is, typename ... Args >
+  RAJA_HOST_DEVICE RAJA_INLINE void call(camp::idx_seq<Is...>,
+                                         const offset_type* offsets,
+                                         Args... args) const
+  {
+    m_body(*(camp::get<Is>(m_segments).begin() + offsets[Is])..., args...);
+  }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
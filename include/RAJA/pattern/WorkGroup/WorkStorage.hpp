@@ -21,6 +21,7 @@
 #include "RAJA/config.hpp"
 
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <type_traits>
@@ -292,12 +293,17 @@ public:
   WorkStorage(WorkStorage&& rhs)
     : m_vec(std::move(rhs.m_vec))
     , m_aloc(std::move(rhs.m_aloc))
-  { }
+    , m_num_reallocations(rhs.m_num_reallocations)
+  {
+    rhs.m_num_reallocations = 0;
+  }
 
   WorkStorage& operator=(WorkStorage&& rhs)
   {
     if (this != &rhs) {
       move_assign_private(std::move(rhs), propagate_on_container_move_assignment{});
+      m_num_reallocations = rhs.m_num_reallocations;
+      rhs.m_num_reallocations = 0;
     }
     return *this;
   }
@@ -337,9 +343,18 @@ public:
     return storage_size_nbytes;
   }
 
+  // number of times storing a loop grew the storage past its reservation
+  size_type num_reallocations() const
+  {
+    return m_num_reallocations;
+  }
+
   template < typename holder, typename ... holder_ctor_args >
-  void emplace(const vtable_type* vtable, holder_ctor_args&&... ctor_args)
+  void emplace(const typename value_type::vtable_type* vtable, holder_ctor_args&&... ctor_args)
   {
+    if (m_vec.size() == m_vec.capacity()) {
+      ++m_num_reallocations;
+    }
     m_vec.emplace_back(create_value<holder>(
         vtable, std::forward<holder_ctor_args>(ctor_args)...));
   }
@@ -362,6 +377,7 @@ public:
 private:
   RAJAVec<pointer_and_size, typename allocator_traits_type::template rebind_alloc<pointer_and_size>> m_vec;
   allocator_type m_aloc;
+  size_type m_num_reallocations = 0;
 
   // move assignment if allocator propagates on move assignment
   void move_assign_private(WorkStorage&& rhs, std::true_type)
@@ -390,7 +406,7 @@ private:
 
   // allocate and construct value in storage
   template < typename holder, typename ... holder_ctor_args >
-  pointer_and_size create_value(const vtable_type* vtable,
+  pointer_and_size create_value(const typename value_type::vtable_type* vtable,
                                 holder_ctor_args&&... ctor_args)
   {
     const size_type value_size = sizeof(true_value_type<holder>);
@@ -523,16 +539,20 @@ public:
     , m_array_end(rhs.m_array_end)
     , m_array_cap(rhs.m_array_cap)
     , m_aloc(std::move(rhs.m_aloc))
+    , m_num_reallocations(rhs.m_num_reallocations)
   {
     rhs.m_array_begin = nullptr;
     rhs.m_array_end = nullptr;
     rhs.m_array_cap = nullptr;
+    rhs.m_num_reallocations = 0;
   }
 
   WorkStorage& operator=(WorkStorage&& rhs)
   {
     if (this != &rhs) {
       move_assign_private(std::move(rhs), propagate_on_container_move_assignment{});
+      m_num_reallocations = rhs.m_num_reallocations;
+      rhs.m_num_reallocations = 0;
     }
     return *this;
   }
@@ -561,15 +581,46 @@ public:
     return const_iterator(m_array_begin, m_offsets.end());
   }
 
+  // number of bytes in an image of the loops and their offsets
+  size_type image_size() const
+  {
+    return image_offsets_offset() + size() * sizeof(size_type);
+  }
+
+  // copy the loops and their offsets into image, an image_size() byte buffer
+  void write_image(char* image) const
+  {
+    std::memcpy(image, m_array_begin, storage_size());
+    std::memcpy(image + image_offsets_offset(), m_offsets.data(),
+                size() * sizeof(size_type));
+  }
+
+  // iterator to the first loop of an image, which may have been copied
+  // to another memory space
+  const_iterator image_begin(const char* image) const
+  {
+    return const_iterator(image, reinterpret_cast<const size_type*>(
+                                     image + image_offsets_offset()));
+  }
+
   // number of bytes used for storage of loops
   size_type storage_size() const
   {
     return m_array_end - m_array_begin;
   }
 
+  // number of times storing a loop grew the storage past its reservation
+  size_type num_reallocations() const
+  {
+    return m_num_reallocations;
+  }
+
   template < typename holder, typename ... holder_ctor_args >
-  void emplace(const vtable_type* vtable, holder_ctor_args&&... ctor_args)
+  void emplace(const typename value_type::vtable_type* vtable, holder_ctor_args&&... ctor_args)
   {
+    if (m_offsets.size() == m_offsets.capacity()) {
+      ++m_num_reallocations;
+    }
     size_type value_offset = storage_size();
     size_type value_size   = create_value<holder>(value_offset,
         vtable, std::forward<holder_ctor_args>(ctor_args)...);
@@ -600,6 +651,14 @@ private:
   char* m_array_end   = nullptr;
   char* m_array_cap   = nullptr;
   allocator_type m_aloc;
+  size_type m_num_reallocations = 0;
+
+  // offset of the loop offsets in an image, after the loops
+  size_type image_offsets_offset() const
+  {
+    return (storage_size() + alignof(size_type) - 1) /
+           alignof(size_type) * alignof(size_type);
+  }
 
   // move assignment if allocator propagates on move assignment
   void move_assign_private(WorkStorage&& rhs, std::true_type)
@@ -698,12 +757,13 @@ private:
   // and store the loop body
   template < typename holder, typename ... holder_ctor_args >
   size_type create_value(size_type value_offset,
-                         const vtable_type* vtable,
+                         const typename value_type::vtable_type* vtable,
                          holder_ctor_args&&... ctor_args)
   {
     const size_type value_size = sizeof(true_value_type<holder>);
 
     if (value_size > storage_unused()) {
+      ++m_num_reallocations;
       array_reserve(std::max(storage_size() + value_size, 2*storage_capacity()));
     }
 
@@ -826,17 +886,21 @@ public:
     , m_array_begin(rhs.m_array_begin)
     , m_array_end(rhs.m_array_end)
     , m_array_cap(rhs.m_array_cap)
+    , m_num_reallocations(rhs.m_num_reallocations)
   {
     // do not reset stride, leave it for reuse
     rhs.m_array_begin = nullptr;
     rhs.m_array_end   = nullptr;
     rhs.m_array_cap   = nullptr;
+    rhs.m_num_reallocations = 0;
   }
 
   WorkStorage& operator=(WorkStorage&& rhs)
   {
     if (this != &rhs) {
       move_assign_private(std::move(rhs), propagate_on_container_move_assignment{});
+      m_num_reallocations = rhs.m_num_reallocations;
+      rhs.m_num_reallocations = 0;
     }
     return *this;
   }
@@ -866,14 +930,39 @@ public:
     return const_iterator(m_array_end, m_stride);
   }
 
+  // number of bytes in an image of the loops
+  size_type image_size() const
+  {
+    return storage_size();
+  }
+
+  // copy the loops into image, an image_size() byte buffer
+  void write_image(char* image) const
+  {
+    std::memcpy(image, m_array_begin, storage_size());
+  }
+
+  // iterator to the first loop of an image, which may have been copied
+  // to another memory space
+  const_iterator image_begin(const char* image) const
+  {
+    return const_iterator(image, m_stride);
+  }
+
   // amount of storage in bytes used to store loops
   size_type storage_size() const
   {
     return m_array_end - m_array_begin;
   }
 
+  // number of times storing a loop grew the storage past its reservation
+  size_type num_reallocations() const
+  {
+    return m_num_reallocations;
+  }
+
   template < typename holder, typename ... holder_ctor_args >
-  void emplace(const vtable_type* vtable, holder_ctor_args&&... ctor_args)
+  void emplace(const typename value_type::vtable_type* vtable, holder_ctor_args&&... ctor_args)
   {
     create_value<holder>(vtable, std::forward<holder_ctor_args>(ctor_args)...);
     m_array_end += m_stride;
@@ -902,6 +991,7 @@ private:
   char* m_array_begin = nullptr;
   char* m_array_end   = nullptr;
   char* m_array_cap   = nullptr;
+  size_type m_num_reallocations = 0;
 
   // move assignment if allocator propagates on move assignment
   void move_assign_private(WorkStorage&& rhs, std::true_type)
@@ -1003,15 +1093,17 @@ private:
   // ensure there is enough storage to store the loop body
   // and construct the body in storage.
   template < typename holder, typename ... holder_ctor_args >
-  void create_value(const vtable_type* vtable,
+  void create_value(const typename value_type::vtable_type* vtable,
                     holder_ctor_args&&... ctor_args)
   {
     const size_type value_size = sizeof(true_value_type<holder>);
 
     if (value_size > storage_unused() && value_size <= m_stride) {
+      ++m_num_reallocations;
       array_reserve(std::max(storage_size() + m_stride, 2*storage_capacity()),
                     m_stride);
     } else if (value_size > m_stride) {
+      ++m_num_reallocations;
       array_reserve((size()+1)*value_size,
                     value_size);
     }
@@ -1041,6 +1133,49 @@ private:
   }
 };
 
+/*!
+ * Storage laid out like ragged_array_of_objects, that the device runners
+ * copy to device memory in one piece before they run its loops.
+ */
+template < typename ALLOCATOR_T, typename Vtable_T >
+class WorkStorage<RAJA::device_ragged_array_of_objects, ALLOCATOR_T, Vtable_T>
+  : public WorkStorage<RAJA::ragged_array_of_objects, ALLOCATOR_T, Vtable_T>
+{
+  using base = WorkStorage<RAJA::ragged_array_of_objects, ALLOCATOR_T, Vtable_T>;
+public:
+  using storage_policy = RAJA::device_ragged_array_of_objects;
+
+  using base::base;
+};
+
+/*!
+ * Storage laid out like constant_stride_array_of_objects, that the device
+ * runners copy to device memory in one piece before they run its loops.
+ */
+template < typename ALLOCATOR_T, typename Vtable_T >
+class WorkStorage<RAJA::device_constant_stride_array_of_objects, ALLOCATOR_T, Vtable_T>
+  : public WorkStorage<RAJA::constant_stride_array_of_objects, ALLOCATOR_T, Vtable_T>
+{
+  using base = WorkStorage<RAJA::constant_stride_array_of_objects, ALLOCATOR_T, Vtable_T>;
+public:
+  using storage_policy = RAJA::device_constant_stride_array_of_objects;
+
+  using base::base;
+};
+
+// storage whose loops are run from a device copy made with
+// write_image and image_begin
+template < typename STORAGE_POLICY_T >
+struct is_device_image_storage : std::false_type { };
+
+template < >
+struct is_device_image_storage<RAJA::device_ragged_array_of_objects>
+  : std::true_type { };
+
+template < >
+struct is_device_image_storage<RAJA::device_constant_stride_array_of_objects>
+  : std::true_type { };
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -22,6 +22,13 @@
 
 #include <utility>
 #include <cstddef>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/WorkGroup.hpp"
 
 #include "RAJA/pattern/WorkGroup/Vtable.hpp"
 
@@ -108,6 +115,133 @@ struct WorkStruct<size, Vtable<VtableID, CallArgs...>>
   typename std::aligned_storage<size, alignof(std::max_align_t)>::type obj;
 };
 
+/*!
+ * Index of T in a list of types, or the length of the list if T is not in it
+ */
+template < typename T, typename Types >
+struct type_index_of;
+///
+template < typename T >
+struct type_index_of<T, camp::list<>>
+  : std::integral_constant<camp::idx_t, 0> { };
+///
+template < typename T, typename ... Rest >
+struct type_index_of<T, camp::list<T, Rest...>>
+  : std::integral_constant<camp::idx_t, 0> { };
+///
+template < typename T, typename First, typename ... Rest >
+struct type_index_of<T, camp::list<First, Rest...>>
+  : std::integral_constant<camp::idx_t,
+                           1 + type_index_of<T, camp::list<Rest...>>::value> { };
+
+/*!
+ * Work struct that calls its object with a switch over the index of its
+ * type in Types, so the call operators of all of the types can be inlined.
+ * Moving and destroying still go through the vtable, on the host.
+ */
+template < size_t size, typename VtableID, typename ... CallArgs,
+           typename ... Types >
+struct WorkStruct<size, DirectVtable<Vtable<VtableID, CallArgs...>,
+                                     camp::list<Types...>>>
+{
+  using vtable_type = Vtable<VtableID, CallArgs...>;
+  using dispatch_vtable_type = DirectVtable<vtable_type, camp::list<Types...>>;
+
+  template < typename holder, typename ... holder_ctor_args >
+  static RAJA_INLINE
+  void construct(void* ptr, const vtable_type* vtable, holder_ctor_args&&... ctor_args)
+  {
+    using true_value_type = WorkStruct<sizeof(holder), dispatch_vtable_type>;
+    using value_type = WorkStruct<alignof(std::max_align_t), dispatch_vtable_type>;
+
+    static_assert(type_index_of<holder, camp::list<Types...>>::value <
+                  static_cast<camp::idx_t>(sizeof...(Types)),
+        "loop type must be one of the types of direct_dispatch");
+    static_assert(sizeof(holder) <= sizeof(true_value_type::obj),
+        "holder must fit in WorkStruct::obj");
+    static_assert(std::is_standard_layout<true_value_type>::value,
+        "WorkStruct must be a standard layout type");
+    static_assert(std::is_standard_layout<value_type>::value,
+        "GenericWorkStruct must be a standard layout type");
+    static_assert(offsetof(value_type, obj) == offsetof(true_value_type, obj),
+        "WorkStruct and GenericWorkStruct must have obj at the same offset");
+    static_assert(sizeof(value_type) <= sizeof(true_value_type),
+        "WorkStruct must not be smaller than GenericWorkStruct");
+
+    true_value_type* value_ptr = static_cast<true_value_type*>(ptr);
+
+    value_ptr->vtable = vtable;
+    value_ptr->type_index = type_index_of<holder, camp::list<Types...>>::value;
+    new(&value_ptr->obj) holder(std::forward<holder_ctor_args>(ctor_args)...);
+  }
+
+  // move construct in dst from the value in src and destroy the value in src
+  static RAJA_INLINE
+  void move_destroy(WorkStruct* value_dst,
+                    WorkStruct* value_src)
+  {
+    value_dst->vtable = value_src->vtable;
+    value_dst->type_index = value_src->type_index;
+    value_dst->vtable->move_construct_destroy_function_ptr(&value_dst->obj, &value_src->obj);
+  }
+
+  // destroy the value ptr
+  static RAJA_INLINE
+  void destroy(WorkStruct* value_ptr)
+  {
+    value_ptr->vtable->destroy_function_ptr(&value_ptr->obj);
+  }
+
+  // call the call operator of the value ptr with args
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  void call(const WorkStruct* value_ptr, CallArgs... args)
+  {
+    call_impl(value_ptr, camp::idx_t(0), camp::list<Types...>{}, args...);
+  }
+
+  const vtable_type* vtable;
+  camp::idx_t type_index;
+  typename std::aligned_storage<size, alignof(std::max_align_t)>::type obj;
+
+private:
+  RAJA_SUPPRESS_HD_WARN
+  template < typename T, typename ... Rest >
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  void call_impl(const WorkStruct* value_ptr, camp::idx_t index,
+                 camp::list<T, Rest...>, CallArgs... args)
+  {
+    if (value_ptr->type_index == index) {
+      const T* obj_as_T = static_cast<const T*>(static_cast<const void*>(&value_ptr->obj));
+      (*obj_as_T)(std::forward<CallArgs>(args)...);
+    } else {
+      call_impl(value_ptr, index + 1, camp::list<Rest...>{}, args...);
+    }
+  }
+  ///
+  static RAJA_HOST_DEVICE RAJA_INLINE
+  void call_impl(const WorkStruct*, camp::idx_t, camp::list<>, CallArgs...)
+  { }
+};
+
+/*!
+ * The vtable type given to work storage for a dispatch policy and runner
+ */
+template < typename DISPATCH_POLICY_T, typename WorkRunner_T >
+struct dispatch_vtable
+{
+  using type = typename WorkRunner_T::vtable_type;
+};
+///
+template < typename ... Segments, typename ... LoopBodies, typename WorkRunner_T >
+struct dispatch_vtable<RAJA::direct_dispatch<camp::list<Segments, LoopBodies>...>,
+                       WorkRunner_T>
+{
+  using type = DirectVtable<
+      typename WorkRunner_T::vtable_type,
+      camp::list<typename WorkRunner_T::template holder_type<
+          camp::decay<Segments>, camp::decay<LoopBodies>>...>>;
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
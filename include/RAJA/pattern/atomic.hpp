@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/policy/atomic_scope.hpp"
 #include "RAJA/policy/atomic_auto.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
 
@@ -60,6 +61,9 @@ namespace RAJA
  *
  *   seq_atomic        -- Non-atomic, does an unprotected (raw) operation
  *
+ *   scoped_atomic<AtomicPolicy, Scope, Order>
+ *                     -- AtomicPolicy with a memory scope and memory order
+ *
  *
  * Current supported data types include:
  *
@@ -75,6 +79,7 @@ namespace RAJA
  * The implementation code lives in:
  * RAJA/policy/atomic_auto.hpp     -- for auto_atomic
  * RAJA/policy/atomic_builtin.hpp  -- for builtin_atomic
+ * RAJA/policy/atomic_scope.hpp    -- for scoped_atomic
  * RAJA/policy/XXX/atomic.hpp      -- for omp_atomic, cuda_atomic, etc.
  *
  */
@@ -0,0 +1,237 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file declaring a sort of host arrays larger than
+ *          device memory, which sorts chunks on one or more resources and
+ *          merges them on the host.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_chunked_sort_HPP
+#define RAJA_pattern_chunked_sort_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/pattern/sort.hpp"
+#include "RAJA/pattern/teams.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/Span.hpp"
+#include "RAJA/util/StagingPipeline.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+/*!
+ * Chunks in flight on one resource, with the pinned and device buffers its
+ * chunks are staged through
+ */
+template <typename Res, typename T>
+struct SortChunkSlot {
+  explicit SortChunkSlot(Res r) : res(r) {}
+
+  Res res;
+  T* host = nullptr;
+  T* device = nullptr;
+  size_t begin = 0;
+  size_t len = 0;
+  bool busy = false;
+};
+
+/*!
+ * Merges the sorted runs of run_size values of runs[0, n) into out, with a
+ * heap of the runs ordered by their next value
+ */
+template <typename T, typename Compare>
+void merge_sorted_runs(T const* runs,
+                       size_t n,
+                       size_t run_size,
+                       T* out,
+                       Compare comp)
+{
+  const size_t num_runs = (n + run_size - 1) / run_size;
+  std::vector<size_t> next(num_runs);
+  std::vector<size_t> heap(num_runs);
+  for (size_t r = 0; r < num_runs; ++r) {
+    next[r] = r * run_size;
+    heap[r] = r;
+  }
+
+  // the top of the heap is the run with the smallest next value
+  auto later = [&](size_t a, size_t b) {
+    return comp(runs[next[b]], runs[next[a]]);
+  };
+  std::make_heap(heap.begin(), heap.end(), later);
+
+  for (size_t i = 0; i < n; ++i) {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    const size_t r = heap.back();
+    out[i] = runs[next[r]++];
+    if (next[r] == std::min(n, (r + 1) * run_size)) {
+      heap.pop_back();
+    } else {
+      std::push_heap(heap.begin(), heap.end(), later);
+    }
+  }
+}
+
+//! Copies the sorted chunk of slot back to data and frees the slot
+template <typename Res, typename T>
+void finish_sort_chunk(SortChunkSlot<Res, T>& slot, T* data)
+{
+  slot.res.wait();
+  std::memcpy(data + slot.begin, slot.host, slot.len * sizeof(T));
+  slot.busy = false;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Sorts host data larger than the memory of a device, by sorting
+ *        chunks of it on the resources and merging them on the host.
+ *
+ * data[0, n) is cut into chunks of chunk_size values, which are given to
+ * the resources round-robin. Each resource stages its chunk through a
+ * pinned host buffer into a device buffer of chunk_size values, sorts it
+ * with RAJA::sort<ExecPolicy> and copies it back, so while the host waits
+ * for one resource the others copy and sort. Resources on several devices
+ * sort on all of them, and two resources on different streams of a device,
+ * for example from a ResourcePool, overlap the copies of one chunk with the
+ * sort of the other:
+ *
+ *   RAJA::resources::ResourcePool<RAJA::resources::Cuda> pool(2, 0, device);
+ *   std::vector<RAJA::resources::Cuda> res{pool.get(), pool.get()};
+ *
+ *   RAJA::expt::chunked_sort<RAJA::cuda_exec<256>>(res, h_keys, h_out, n,
+ *                                                 size_t(1) << 28);
+ *
+ * The sorted chunks are left in data and merged into out, which holds n
+ * values and must not overlap data. A device sort needs scratch memory of
+ * the size of its input, so each resource needs about three times
+ * chunk_size values of device memory. The merge is a k-way heap merge on
+ * the host thread, which is O(n log k) for k chunks. Returns once out is
+ * sorted.
+ */
+template <typename ExecPolicy,
+          typename Res,
+          typename T,
+          typename Compare = operators::less<T>>
+concepts::enable_if_t<void, type_traits::is_execution_policy<ExecPolicy>>
+chunked_sort(std::vector<Res> const& resources,
+             T* data,
+             T* out,
+             size_t n,
+             size_t chunk_size,
+             Compare comp = Compare{})
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "chunked_sort values must be trivially copyable");
+
+  if (n == 0) return;
+
+  chunk_size = std::max<size_t>(1, std::min(chunk_size, n));
+
+  // without resources the chunks are sorted on the default one
+  std::vector<detail::SortChunkSlot<Res, T>> slots;
+  if (resources.empty()) {
+    slots.emplace_back(Res::get_default());
+  }
+  for (Res const& r : resources) {
+    slots.emplace_back(r);
+  }
+
+  for (auto& slot : slots) {
+    resources::Resource erased(slot.res);
+    detail::LaunchDeviceGuard<Res> guard(erased);
+    slot.host = static_cast<T*>(RAJA::detail::StagingHostMemory<Res>::allocate(
+        chunk_size * sizeof(T)));
+    slot.device = slot.res.template allocate<T>(chunk_size);
+  }
+
+  size_t s = 0;
+  for (size_t begin = 0; begin < n; begin += chunk_size) {
+    auto& slot = slots[s];
+    if (slot.busy) {
+      detail::finish_sort_chunk(slot, data);
+    }
+
+    slot.begin = begin;
+    slot.len = std::min(chunk_size, n - begin);
+    std::memcpy(slot.host, data + begin, slot.len * sizeof(T));
+
+    resources::Resource erased(slot.res);
+    detail::LaunchDeviceGuard<Res> guard(erased);
+    copy_async(slot.res, slot.device, slot.host, slot.len * sizeof(T));
+    RAJA::sort<ExecPolicy>(slot.res, RAJA::make_span(slot.device, slot.len),
+                           comp);
+    copy_async(slot.res, slot.host, slot.device, slot.len * sizeof(T));
+    slot.busy = true;
+
+    s = (s + 1) % slots.size();
+  }
+
+  for (auto& slot : slots) {
+    if (slot.busy) {
+      detail::finish_sort_chunk(slot, data);
+    }
+    resources::Resource erased(slot.res);
+    detail::LaunchDeviceGuard<Res> guard(erased);
+    slot.res.deallocate(slot.device);
+    RAJA::detail::StagingHostMemory<Res>::deallocate(slot.host);
+  }
+
+  if (n <= chunk_size) {
+    std::memcpy(out, data, n * sizeof(T));
+  } else {
+    detail::merge_sorted_runs(data, n, chunk_size, out, comp);
+  }
+}
+
+/*!
+ * \brief Sorts the host data[0, n) in place in chunks on the resources,
+ *        merging into a host temporary of n values.
+ */
+template <typename ExecPolicy,
+          typename Res,
+          typename T,
+          typename Compare = operators::less<T>>
+concepts::enable_if_t<void, type_traits::is_execution_policy<ExecPolicy>>
+chunked_sort(std::vector<Res> const& resources,
+             T* data,
+             size_t n,
+             size_t chunk_size,
+             Compare comp = Compare{})
+{
+  std::vector<T> out(n);
+  chunked_sort<ExecPolicy>(resources, data, out.data(), n, chunk_size, comp);
+  std::copy(out.begin(), out.end(), data);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
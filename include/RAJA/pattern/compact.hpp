@@ -0,0 +1,425 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/compact.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Run a compaction of [begin, begin + n) as an inclusive scan of its
+ *        (count, last) pairs.
+ */
+template <bool Partition,
+          typename ExecPolicy,
+          typename Res,
+          typename Iter,
+          typename OutIter,
+          typename RejectIter,
+          typename CountT,
+          typename Select>
+RAJA_INLINE resources::EventProxy<Res> compact(ExecPolicy&& p,
+                                               Res r,
+                                               Iter begin,
+                                               Index_type n,
+                                               OutIter out,
+                                               RejectIter rejected,
+                                               CountT* count,
+                                               Select select)
+{
+  if (n <= 0) {
+    r.memset(count, 0, sizeof(CountT));
+    return resources::EventProxy<Res>(r);
+  }
+  auto first = make_compact_input(begin, select);
+  return impl::scan::inclusive_adapted(
+      r,
+      std::forward<ExecPolicy>(p),
+      first,
+      first + n,
+      make_compact_output<Partition>(begin, out, rejected, count, n),
+      compact_op{});
+}
+
+}  // namespace detail
+
+inline namespace policy_by_value_interface
+{
+
+/*!
+******************************************************************************
+*
+* \brief  copy_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the selected values
+* \param[out] count number of selected values
+* \param[in] pred unary predicate selecting the values to copy
+*
+* The values of in for which pred is true are copied to the front of out in
+* their order in in. The count is written in the memory space of the
+* execution policy and is valid when the returned event completes. in and
+* out must not overlap.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename CountT,
+          typename Predicate>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+copy_if(ExecPolicy&& p,
+        Res r,
+        InContainer&& in,
+        OutContainer&& out,
+        CountT* count,
+        Predicate pred)
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+
+  return RAJA::detail::compact<false>(std::forward<ExecPolicy>(p),
+                                      r,
+                                      begin(in),
+                                      distance(begin(in), end(in)),
+                                      begin(out),
+                                      begin(out),
+                                      count,
+                                      RAJA::detail::select_if<Predicate>{pred});
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename CountT,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+copy_if(ExecPolicy&& p,
+        InContainer&& in,
+        OutContainer&& out,
+        CountT* count,
+        Predicate pred)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::copy_if(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      count,
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition_copy execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out_true Random-Access Container for the selected values
+* \param[out] out_false Random-Access Container for the rejected values
+* \param[out] count number of selected values
+* \param[in] pred unary predicate selecting the values
+*
+* The values of in for which pred is true are copied to out_true and the
+* others to out_false, both in their order in in. The count is written in
+* the memory space of the execution policy and is valid when the returned
+* event completes. The outputs must not overlap in.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename TrueContainer,
+          typename FalseContainer,
+          typename CountT,
+          typename Predicate>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<TrueContainer>,
+                      type_traits::is_range<FalseContainer>>
+partition_copy(ExecPolicy&& p,
+               Res r,
+               InContainer&& in,
+               TrueContainer&& out_true,
+               FalseContainer&& out_false,
+               CountT* count,
+               Predicate pred)
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<TrueContainer>::value,
+                "TrueContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<FalseContainer>::value,
+                "FalseContainer must model RandomAccessRange");
+
+  return RAJA::detail::compact<true>(std::forward<ExecPolicy>(p),
+                                     r,
+                                     begin(in),
+                                     distance(begin(in), end(in)),
+                                     begin(out_true),
+                                     begin(out_false),
+                                     count,
+                                     RAJA::detail::select_if<Predicate>{pred});
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename TrueContainer,
+          typename FalseContainer,
+          typename CountT,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<TrueContainer>,
+                      type_traits::is_range<FalseContainer>>
+partition_copy(ExecPolicy&& p,
+               InContainer&& in,
+               TrueContainer&& out_true,
+               FalseContainer&& out_false,
+               CountT* count,
+               Predicate pred)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partition_copy(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<TrueContainer>(out_true),
+      std::forward<FalseContainer>(out_false),
+      count,
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique_copy execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the unique values
+* \param[out] count number of unique values
+* \param[in] eq binary predicate comparing neighboring values
+*
+* The first value of each run of consecutive values of in that compare equal
+* is copied to the front of out. The count is written in the memory space of
+* the execution policy and is valid when the returned event completes. in
+* and out must not overlap.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename CountT,
+          typename Equal = operators::equal_to<RAJA::detail::ContainerVal<InContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+unique_copy(ExecPolicy&& p,
+            Res r,
+            InContainer&& in,
+            OutContainer&& out,
+            CountT* count,
+            Equal eq = Equal{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  static_assert(type_traits::is_binary_function<Equal, bool, T, T>::value,
+                "Equal must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+
+  return RAJA::detail::compact<false>(std::forward<ExecPolicy>(p),
+                                      r,
+                                      begin(in),
+                                      distance(begin(in), end(in)),
+                                      begin(out),
+                                      begin(out),
+                                      count,
+                                      RAJA::detail::select_unique<Equal>{eq});
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename CountT,
+          typename Equal = operators::equal_to<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+unique_copy(ExecPolicy&& p,
+            InContainer&& in,
+            OutContainer&& out,
+            CountT* count,
+            Equal eq = Equal{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique_copy(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      count,
+      eq);
+}
+
+}  // namespace policy_by_value_interface
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * copy_if
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+copy_if(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::copy_if<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+copy_if(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::copy_if(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * partition_copy
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+partition_copy(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partition_copy<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+partition_copy(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::partition_copy(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * unique_copy
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+unique_copy(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique_copy<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+unique_copy(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::unique_copy(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
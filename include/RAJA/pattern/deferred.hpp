@@ -0,0 +1,681 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file declaring a graph of deferred loops, which are
+ *          recorded with the arrays they access and fused, pruned and
+ *          scheduled when the graph is flushed.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_deferred_HPP
+#define RAJA_pattern_deferred_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/ResourcePool.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+//! How the iterations of a loop access an array
+enum class AccessPattern {
+  //! iteration i only accesses element i of the array
+  pointwise,
+  //! iterations may access any element of the array
+  any
+};
+
+/*!
+ * \brief The arrays a deferred loop reads and writes.
+ *
+ * Pointers and Views are declared with the number of values the loop may
+ * access. A loop that declares nothing is taken to access all memory, so
+ * it is never fused, dropped or run concurrently with other loops.
+ */
+class Access
+{
+public:
+  struct region {
+    const char* begin;
+    const char* end;
+    size_t elem_bytes;
+    bool write;
+    AccessPattern pattern;
+  };
+
+  Access() = default;
+
+  template <typename T>
+  Access& reads(const T* ptr,
+                size_t len,
+                AccessPattern pattern = AccessPattern::any)
+  {
+    return add(ptr, len, false, pattern);
+  }
+
+  template <typename T>
+  Access& writes(T* ptr,
+                 size_t len,
+                 AccessPattern pattern = AccessPattern::any)
+  {
+    return add(ptr, len, true, pattern);
+  }
+
+  //! Views are declared by their data and the size of their layout
+  template <typename ViewType>
+  auto reads(ViewType const& view,
+             AccessPattern pattern = AccessPattern::any)
+      -> decltype(view.get_data(), view.get_layout().size(), *this)
+  {
+    return add(view.get_data(), view.get_layout().size(), false, pattern);
+  }
+
+  template <typename ViewType>
+  auto writes(ViewType const& view,
+              AccessPattern pattern = AccessPattern::any)
+      -> decltype(view.get_data(), view.get_layout().size(), *this)
+  {
+    return add(view.get_data(), view.get_layout().size(), true, pattern);
+  }
+
+  //! true if nothing is declared, so the loop may access anything
+  bool unknown() const { return m_regions.empty(); }
+
+  std::vector<region> const& regions() const { return m_regions; }
+
+private:
+  std::vector<region> m_regions;
+
+  template <typename T>
+  Access& add(const T* ptr, size_t len, bool write, AccessPattern pattern)
+  {
+    const char* begin = reinterpret_cast<const char*>(ptr);
+    m_regions.push_back(
+        region{begin, begin + len * sizeof(T), sizeof(T), write, pattern});
+    return *this;
+  }
+};
+
+namespace detail
+{
+
+//! How a loop depends on a loop recorded before it
+enum class deferred_dependence {
+  none,
+  //! through arrays both access pointwise, so the loops may be fused
+  pointwise,
+  any
+};
+
+RAJA_INLINE bool deferred_overlap(Access::region const& a,
+                                  Access::region const& b)
+{
+  return a.begin < b.end && b.begin < a.end;
+}
+
+RAJA_INLINE deferred_dependence deferred_depends(Access const& earlier,
+                                                 Access const& later)
+{
+  if (earlier.unknown() || later.unknown()) {
+    return deferred_dependence::any;
+  }
+  deferred_dependence dep = deferred_dependence::none;
+  for (auto const& a : earlier.regions()) {
+    for (auto const& b : later.regions()) {
+      if (!(a.write || b.write) || !deferred_overlap(a, b)) {
+        continue;
+      }
+      if (a.pattern == AccessPattern::pointwise &&
+          b.pattern == AccessPattern::pointwise && a.begin == b.begin &&
+          a.elem_bytes == b.elem_bytes) {
+        dep = deferred_dependence::pointwise;
+      } else {
+        return deferred_dependence::any;
+      }
+    }
+  }
+  return dep;
+}
+
+//! A recorded loop, run on a resource of type Res
+template <typename Res>
+class deferred_node
+{
+public:
+  deferred_node(Access const& access, bool serial_host)
+      : m_access(access), m_serial_host(serial_host)
+  { }
+
+  virtual ~deferred_node() = default;
+
+  virtual void run(Res r) = 0;
+
+  //! loops with the same tag and bounds run one policy over one range
+  virtual const void* fusion_tag() const { return nullptr; }
+  virtual long long first() const { return 0; }
+  virtual long long last() const { return 0; }
+
+  //! run the loops of group, which all have the tag of this one, as one
+  virtual void run_fused(Res r, std::vector<deferred_node*> const& group)
+  {
+    for (auto* node : group) {
+      node->run(r);
+    }
+  }
+
+  Access const& access() const { return m_access; }
+
+  //! true for sequential, loop and simd policies
+  bool serial_host() const { return m_serial_host; }
+
+private:
+  Access m_access;
+  bool m_serial_host;
+};
+
+template <typename Res, typename ExecPol, typename Iterable, typename Body,
+          typename Enable = void>
+class deferred_forall_node : public deferred_node<Res>
+{
+public:
+  template <typename I, typename B>
+  deferred_forall_node(Access const& access, I&& iter, B&& body)
+      : deferred_node<Res>(access,
+                           RAJA::detail::is_serial_host_policy<ExecPol>::value),
+        m_iter(std::forward<I>(iter)),
+        m_body(std::forward<B>(body))
+  { }
+
+  void run(Res r) override { RAJA::forall<ExecPol>(r, m_iter, m_body); }
+
+private:
+  Iterable m_iter;
+  Body m_body;
+};
+
+//! Host loops over the same range with the same policy can be fused
+template <typename Res, typename ExecPol, typename StorageT, typename DiffT>
+class deferred_range_node : public deferred_node<Res>
+{
+public:
+  using segment_type = TypedRangeSegment<StorageT, DiffT>;
+  using value_type = typename segment_type::value_type;
+
+  deferred_range_node(Access const& access, segment_type const& seg)
+      : deferred_node<Res>(access,
+                           RAJA::detail::is_serial_host_policy<ExecPol>::value),
+        m_seg(seg)
+  { }
+
+  //! the loop body at index i
+  virtual void at(value_type i) = 0;
+
+  const void* fusion_tag() const override
+  {
+    static const char tag = 0;
+    return &tag;
+  }
+
+  long long first() const override
+  {
+    return static_cast<long long>(stripIndexType(*m_seg.begin()));
+  }
+
+  long long last() const override
+  {
+    return static_cast<long long>(stripIndexType(*m_seg.end()));
+  }
+
+  void run_fused(Res r,
+                 std::vector<deferred_node<Res>*> const& group) override
+  {
+    std::vector<deferred_range_node*> members;
+    members.reserve(group.size());
+    for (auto* node : group) {
+      members.push_back(static_cast<deferred_range_node*>(node));
+    }
+    deferred_range_node* const* list = members.data();
+    const size_t num = members.size();
+    RAJA::forall<ExecPol>(r, m_seg, [=](value_type i) {
+      for (size_t m = 0; m < num; ++m) {
+        list[m]->at(i);
+      }
+    });
+  }
+
+protected:
+  segment_type m_seg;
+};
+
+template <typename Res, typename ExecPol, typename StorageT, typename DiffT,
+          typename Body>
+class deferred_forall_node<
+    Res,
+    ExecPol,
+    TypedRangeSegment<StorageT, DiffT>,
+    Body,
+    typename std::enable_if<
+        platform_is<ExecPol, Platform::host>::value>::type>
+    : public deferred_range_node<Res, ExecPol, StorageT, DiffT>
+{
+  using base = deferred_range_node<Res, ExecPol, StorageT, DiffT>;
+
+public:
+  template <typename I, typename B>
+  deferred_forall_node(Access const& access, I&& iter, B&& body)
+      : base(access, std::forward<I>(iter)), m_body(std::forward<B>(body))
+  { }
+
+  void run(Res r) override { RAJA::forall<ExecPol>(r, base::m_seg, m_body); }
+
+  void at(typename base::value_type i) override { m_body(i); }
+
+private:
+  Body m_body;
+};
+
+//! Any other recorded work, such as a kernel
+template <typename Res, typename Func>
+class deferred_call_node : public deferred_node<Res>
+{
+public:
+  template <typename F>
+  deferred_call_node(Access const& access, F&& func)
+      : deferred_node<Res>(access, false), m_func(std::forward<F>(func))
+  { }
+
+  void run(Res r) override { m_func(r); }
+
+private:
+  Func m_func;
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Records loops without running them, and runs them when flushed,
+ *        after fusing, pruning and scheduling them by the arrays they
+ *        declare they access.
+ *
+ * \code
+ *
+ * RAJA::expt::DeferredGraph<RAJA::resources::Host> graph;
+ * auto pw = RAJA::expt::AccessPattern::pointwise;
+ *
+ * graph.temporary(tmp, n);
+ * graph.forall<RAJA::omp_parallel_for_exec>(range,
+ *     RAJA::expt::Access().reads(x, n, pw).writes(tmp, n, pw),
+ *     [=](int i) { tmp[i] = 2.0 * x[i]; });
+ * graph.forall<RAJA::omp_parallel_for_exec>(range,
+ *     RAJA::expt::Access().reads(tmp, n, pw).writes(y, n, pw),
+ *     [=](int i) { y[i] += tmp[i]; });
+ *
+ * graph.flush();  // one parallel loop
+ *
+ * \endcode
+ *
+ * When the graph is flushed:
+ *
+ * - loops whose writes are all to arrays declared temporary, that no later
+ *   loop reads, are dropped,
+ * - consecutive forall loops over the same TypedRangeSegment with the same
+ *   host policy are fused into one loop when they are independent or
+ *   depend on each other only through pointwise accesses of the same
+ *   arrays, and
+ * - the remaining loops are run as soon as the loops they depend on are
+ *   done. Host loops with sequential, loop or simd policies that are
+ *   independent of each other are run concurrently on OpenMP threads.
+ *   Loops on other resources are spread over the resources of a
+ *   ResourcePool, if the graph has one, with events between them.
+ *
+ * The declared accesses must include every array a loop writes. A fused
+ * loop calls each of its bodies through a virtual call per index, so only
+ * loops whose launch costs more than that are worth fusing. Loops not
+ * flushed are run when the graph is destroyed.
+ */
+template <typename Res>
+class DeferredGraph
+{
+public:
+  using resource_type = Res;
+  using node_type = detail::deferred_node<Res>;
+
+  //! what the last flush did
+  struct flush_stats {
+    size_t recorded = 0;
+    size_t dropped = 0;
+    size_t fused = 0;
+    size_t launched = 0;
+  };
+
+  explicit DeferredGraph(Res r = Res::get_default()) : m_res(r) {}
+
+  DeferredGraph(Res r, resources::ResourcePool<Res>& pool)
+      : m_res(r), m_pool(&pool)
+  { }
+
+  DeferredGraph(DeferredGraph const&) = delete;
+  DeferredGraph& operator=(DeferredGraph const&) = delete;
+
+  ~DeferredGraph() { flush(); }
+
+  Res get_resource() const { return m_res; }
+
+  //! number of loops recorded since the last flush
+  size_t size() const { return m_nodes.size(); }
+
+  flush_stats const& last_flush() const { return m_stats; }
+
+  //! the len values at ptr are not needed once the graph is flushed
+  template <typename T>
+  void temporary(T* ptr, size_t len)
+  {
+    m_temporaries.writes(ptr, len);
+  }
+
+  //! record RAJA::forall<ExecPol>(resource, iter, body)
+  template <typename ExecPol, typename Iterable, typename Body>
+  void forall(Iterable&& iter, Access const& access, Body&& body)
+  {
+    using node = detail::deferred_forall_node<Res,
+                                              ExecPol,
+                                              camp::decay<Iterable>,
+                                              camp::decay<Body>>;
+    m_nodes.emplace_back(new node(access,
+                                  std::forward<Iterable>(iter),
+                                  std::forward<Body>(body)));
+  }
+
+  //! record a loop that may access anything
+  template <typename ExecPol, typename Iterable, typename Body>
+  void forall(Iterable&& iter, Body&& body)
+  {
+    forall<ExecPol>(std::forward<Iterable>(iter),
+                    Access(),
+                    std::forward<Body>(body));
+  }
+
+  //! record RAJA::kernel_resource<KernelPol>(segments, resource, bodies...)
+  template <typename KernelPol, typename SegmentTuple, typename... Bodies>
+  void kernel(SegmentTuple&& segments,
+              Access const& access,
+              Bodies&&... bodies)
+  {
+    auto segs = segments;
+    auto func = [=](Res r) mutable {
+      RAJA::kernel_resource<KernelPol>(segs, r, bodies...);
+    };
+    using node = detail::deferred_call_node<Res, decltype(func)>;
+    m_nodes.emplace_back(new node(access, std::move(func)));
+  }
+
+  /*!
+   * Runs the loops recorded since the last flush. The returned proxy gives
+   * an event, on the resource of the graph, for all of them.
+   */
+  resources::EventProxy<Res> flush()
+  {
+    std::vector<std::unique_ptr<node_type>> nodes = std::move(m_nodes);
+    m_nodes.clear();
+    Access temporaries = std::move(m_temporaries);
+    m_temporaries = Access();
+
+    m_stats = flush_stats();
+    m_stats.recorded = nodes.size();
+
+    std::vector<std::vector<node_type*>> units =
+        fuse(nodes, live_nodes(nodes, temporaries));
+
+    std::vector<std::vector<size_t>> deps(units.size());
+    for (size_t u = 0; u < units.size(); ++u) {
+      for (size_t v = 0; v < u; ++v) {
+        if (depends(units[v], units[u])) {
+          deps[u].push_back(v);
+        }
+      }
+    }
+
+    run_units(units, deps, std::is_same<Res, resources::Host>{});
+
+    m_stats.launched = units.size();
+    return resources::EventProxy<Res>(m_res);
+  }
+
+private:
+  Res m_res;
+  resources::ResourcePool<Res>* m_pool = nullptr;
+  std::vector<std::unique_ptr<node_type>> m_nodes;
+  Access m_temporaries;
+  flush_stats m_stats;
+
+  static bool within(Access::region const& r, Access const& temporaries)
+  {
+    for (auto const& t : temporaries.regions()) {
+      if (t.begin <= r.begin && r.end <= t.end) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! false for the loops whose results are never read
+  std::vector<char> live_nodes(
+      std::vector<std::unique_ptr<node_type>> const& nodes,
+      Access const& temporaries)
+  {
+    std::vector<char> live(nodes.size(), 1);
+    std::vector<Access::region> later_reads;
+    bool all_read = false;
+
+    for (size_t n = nodes.size(); n-- > 0;) {
+      Access const& access = nodes[n]->access();
+      if (access.unknown()) {
+        all_read = true;
+        continue;
+      }
+
+      bool dead = !all_read;
+      bool writes = false;
+      for (auto const& r : access.regions()) {
+        if (!r.write) {
+          continue;
+        }
+        writes = true;
+        dead = dead && within(r, temporaries);
+        for (auto const& read : later_reads) {
+          dead = dead && !detail::deferred_overlap(r, read);
+        }
+      }
+
+      if (dead && writes) {
+        live[n] = 0;
+        ++m_stats.dropped;
+        continue;
+      }
+      for (auto const& r : access.regions()) {
+        if (!r.write) {
+          later_reads.push_back(r);
+        }
+      }
+    }
+    return live;
+  }
+
+  static bool fusable(std::vector<node_type*> const& unit,
+                      node_type const* node)
+  {
+    const void* tag = node->fusion_tag();
+    if (tag == nullptr || tag != unit.front()->fusion_tag() ||
+        node->first() != unit.front()->first() ||
+        node->last() != unit.front()->last()) {
+      return false;
+    }
+    for (auto* member : unit) {
+      if (detail::deferred_depends(member->access(), node->access()) ==
+          detail::deferred_dependence::any) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! the live loops in order, with consecutive fusable loops in one unit
+  std::vector<std::vector<node_type*>> fuse(
+      std::vector<std::unique_ptr<node_type>> const& nodes,
+      std::vector<char> const& live)
+  {
+    std::vector<std::vector<node_type*>> units;
+    for (size_t n = 0; n < nodes.size(); ++n) {
+      if (!live[n]) {
+        continue;
+      }
+      if (!units.empty() && fusable(units.back(), nodes[n].get())) {
+        units.back().push_back(nodes[n].get());
+        ++m_stats.fused;
+      } else {
+        units.push_back(std::vector<node_type*>{nodes[n].get()});
+      }
+    }
+    return units;
+  }
+
+  static bool depends(std::vector<node_type*> const& earlier,
+                      std::vector<node_type*> const& later)
+  {
+    for (auto* a : earlier) {
+      for (auto* b : later) {
+        if (detail::deferred_depends(a->access(), b->access()) !=
+            detail::deferred_dependence::none) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  static void run_unit(Res r, std::vector<node_type*> const& unit)
+  {
+    if (unit.size() == 1) {
+      unit.front()->run(r);
+    } else {
+      unit.front()->run_fused(r, unit);
+    }
+  }
+
+  //! host loops run by levels, the serial ones of a level concurrently
+  void run_units(std::vector<std::vector<node_type*>> const& units,
+                 std::vector<std::vector<size_t>> const& deps,
+                 std::true_type)
+  {
+    std::vector<size_t> level(units.size(), 0);
+    size_t num_levels = 0;
+    for (size_t u = 0; u < units.size(); ++u) {
+      for (size_t d : deps[u]) {
+        level[u] = std::max(level[u], level[d] + 1);
+      }
+      num_levels = std::max(num_levels, level[u] + 1);
+    }
+
+    std::vector<size_t> serial;
+    for (size_t l = 0; l < num_levels; ++l) {
+      serial.clear();
+      for (size_t u = 0; u < units.size(); ++u) {
+        if (level[u] != l) {
+          continue;
+        }
+        bool is_serial = true;
+        for (auto* node : units[u]) {
+          is_serial = is_serial && node->serial_host();
+        }
+        if (is_serial) {
+          serial.push_back(u);
+        } else {
+          run_unit(m_res, units[u]);
+        }
+      }
+
+      const int num_serial = static_cast<int>(serial.size());
+      Res r = m_res;
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1) if (num_serial > 1)
+#endif
+      for (int s = 0; s < num_serial; ++s) {
+        run_unit(r, units[serial[s]]);
+      }
+    }
+  }
+
+  //! loops run in order, spread over the resources of the pool if any
+  void run_units(std::vector<std::vector<node_type*>> const& units,
+                 std::vector<std::vector<size_t>> const& deps,
+                 std::false_type)
+  {
+    if (m_pool == nullptr) {
+      for (auto const& unit : units) {
+        run_unit(m_res, unit);
+      }
+      return;
+    }
+
+    resources::Event start = m_res.get_event_erased();
+    std::vector<Res> unit_res;
+    std::vector<resources::Event> done;
+    std::vector<char> has_dependents(units.size(), 0);
+    unit_res.reserve(units.size());
+    done.reserve(units.size());
+
+    for (size_t u = 0; u < units.size(); ++u) {
+      // a chain of dependent loops stays on one resource
+      Res r = deps[u].empty() ? m_pool->get() : unit_res[deps[u].front()];
+      if (deps[u].empty()) {
+        r.wait_for(&start);
+      }
+      for (size_t d = 0; d < deps[u].size(); ++d) {
+        has_dependents[deps[u][d]] = 1;
+        if (d > 0) {
+          r.wait_for(&done[deps[u][d]]);
+        }
+      }
+      run_unit(r, units[u]);
+      unit_res.push_back(r);
+      done.push_back(r.get_event_erased());
+    }
+
+    for (size_t u = 0; u < units.size(); ++u) {
+      if (!has_dependents[u]) {
+        m_res.wait_for(&done[u]);
+      }
+    }
+  }
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_deferred_HPP
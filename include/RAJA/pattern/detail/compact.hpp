@@ -0,0 +1,221 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the iterators and operator used to run stream
+ *          compactions through the scan back-ends.
+ *
+ *          A compaction scans (count, last) pairs, where count is the number
+ *          of selected values in a range of the input and last says if the
+ *          last value of the range is selected. The inclusive scan gives
+ *          each value its position in the output, so the output iterator
+ *          writes the selected values while the scan runs and no flags or
+ *          offsets are stored.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_compact_HPP
+#define RAJA_pattern_detail_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! value of a compaction, last is -1 for the empty range
+struct compact_value {
+  Index_type count;
+  int last;
+};
+
+//! operator of a compaction, adds the counts and keeps the right last flag
+struct compact_op {
+  using value_type = compact_value;
+
+  RAJA_HOST_DEVICE
+  value_type operator()(value_type const& lhs, value_type const& rhs) const
+  {
+    return value_type{lhs.count + rhs.count,
+                      rhs.last < 0 ? lhs.last : rhs.last};
+  }
+
+  RAJA_HOST_DEVICE
+  static constexpr value_type identity() { return value_type{0, -1}; }
+};
+
+//! selects the values for which pred is true
+template <typename Pred>
+struct select_if {
+  Pred pred;
+
+  template <typename Iter>
+  RAJA_HOST_DEVICE bool operator()(Iter in, Index_type i) const
+  {
+    return pred(in[i]);
+  }
+};
+
+//! selects the first value of each run of values that compare equal
+template <typename Equal>
+struct select_unique {
+  Equal eq;
+
+  template <typename Iter>
+  RAJA_HOST_DEVICE bool operator()(Iter in, Index_type i) const
+  {
+    return i == 0 || !eq(in[i - 1], in[i]);
+  }
+};
+
+/*!
+ * \brief Random access iterator over the (count, last) pairs of the values
+ *        of in, a value is counted if select(in, i) is true.
+ */
+template <typename Iter, typename Select>
+struct CompactInputIterator {
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = compact_value;
+  using difference_type = Index_type;
+  using pointer = void;
+  using reference = value_type;
+
+  Iter in;
+  Select select;
+  difference_type offset;
+
+  RAJA_HOST_DEVICE
+  value_type operator[](difference_type i) const
+  {
+    const int s = select(in, offset + i) ? 1 : 0;
+    return value_type{s, s};
+  }
+
+  RAJA_HOST_DEVICE
+  value_type operator*() const { return (*this)[0]; }
+
+  RAJA_HOST_DEVICE
+  CompactInputIterator& operator++()
+  {
+    ++offset;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  CompactInputIterator operator+(difference_type n) const
+  {
+    return CompactInputIterator{in, select, offset + n};
+  }
+
+  RAJA_HOST_DEVICE
+  difference_type operator-(CompactInputIterator const& rhs) const
+  {
+    return offset - rhs.offset;
+  }
+
+  RAJA_HOST_DEVICE
+  bool operator==(CompactInputIterator const& rhs) const
+  {
+    return offset == rhs.offset;
+  }
+
+  RAJA_HOST_DEVICE
+  bool operator!=(CompactInputIterator const& rhs) const
+  {
+    return offset != rhs.offset;
+  }
+};
+
+template <typename Iter, typename Select>
+RAJA_INLINE CompactInputIterator<Iter, Select> make_compact_input(
+    Iter in,
+    Select select)
+{
+  return CompactInputIterator<Iter, Select>{in, select, 0};
+}
+
+/*!
+ * \brief Output iterator writing the values of a compaction given the
+ *        inclusive scan of its pairs.
+ *
+ * Assigning to out[i] copies in[i] to its position in the output, rejected
+ * values go to the rejected output if Partition is true. The number of
+ * selected values is written to *count at the last position.
+ */
+template <bool Partition,
+          typename Iter,
+          typename OutIter,
+          typename RejectIter,
+          typename CountT>
+struct CompactOutputIterator {
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = compact_value;
+  using difference_type = Index_type;
+  using pointer = void;
+
+  struct reference {
+    CompactOutputIterator const& it;
+    difference_type i;
+
+    RAJA_HOST_DEVICE
+    reference const& operator=(value_type const& val) const
+    {
+      if (val.last > 0) {
+        it.out[val.count - 1] = it.in[i];
+      } else if (Partition) {
+        it.rejected[i - val.count] = it.in[i];
+      }
+      if (i + 1 == it.len) {
+        *it.count = static_cast<CountT>(val.count);
+      }
+      return *this;
+    }
+  };
+
+  Iter in;
+  OutIter out;
+  RejectIter rejected;
+  CountT* count;
+  difference_type len;
+
+  RAJA_HOST_DEVICE
+  reference operator[](difference_type i) const { return reference{*this, i}; }
+};
+
+template <bool Partition,
+          typename Iter,
+          typename OutIter,
+          typename RejectIter,
+          typename CountT>
+RAJA_INLINE CompactOutputIterator<Partition, Iter, OutIter, RejectIter, CountT>
+make_compact_output(Iter in,
+                    OutIter out,
+                    RejectIter rejected,
+                    CountT* count,
+                    Index_type len)
+{
+  return CompactOutputIterator<Partition, Iter, OutIter, RejectIter, CountT>{
+      in, out, rejected, count, len};
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,180 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Internal header for running several forall loop bodies as fused
+ *         loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_FUSE_HPP
+#define RAJA_PATTERN_DETAIL_FUSE_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Separates the loop bodies passed to forall_fused that must see
+ *        all iterations of the bodies before it.
+ */
+struct FuseBarrier {
+};
+
+namespace detail
+{
+
+/*!
+ * \brief Loop body running a group of loop bodies one after the other for
+ *        each index.
+ */
+template <typename... Bodies>
+struct FusedBodies {
+  camp::tuple<Bodies...> bodies;
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Args... args) const
+  {
+    call(camp::make_idx_seq_t<sizeof...(Bodies)>{}, args...);
+  }
+
+private:
+  template <camp::idx_t... Is, typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(camp::idx_seq<Is...>,
+                                         Args... args) const
+  {
+    int unused[] = {0, (camp::get<Is>(bodies)(args...), 0)...};
+    (void)unused;
+  }
+};
+
+/*!
+ * \brief Split the bodies into groups at each FuseBarrier, and pass the
+ *        groups to run.group and the barriers to run.barrier in order.
+ *
+ * Group holds the bodies of the group being collected.
+ */
+template <typename... Group>
+struct FuseGroups {
+
+  template <typename Runner>
+  static RAJA_INLINE void apply(Runner& run, Group const&... group)
+  {
+    run.group(FusedBodies<Group...>{camp::make_tuple(group...)});
+  }
+
+  template <typename Runner, typename... Rest>
+  static RAJA_INLINE void apply(Runner& run,
+                                Group const&... group,
+                                FuseBarrier const&,
+                                Rest&&... rest)
+  {
+    run.group(FusedBodies<Group...>{camp::make_tuple(group...)});
+    run.barrier();
+    FuseGroups<>::apply(run, std::forward<Rest>(rest)...);
+  }
+
+  template <typename Runner,
+            typename Body,
+            typename... Rest,
+            typename = typename std::enable_if<
+                !std::is_same<camp::decay<Body>, FuseBarrier>::value>::type>
+  static RAJA_INLINE void apply(Runner& run,
+                                Group const&... group,
+                                Body&& body,
+                                Rest&&... rest)
+  {
+    FuseGroups<Group..., camp::decay<Body>>::apply(
+        run, group..., body, std::forward<Rest>(rest)...);
+  }
+};
+
+/*!
+ * \brief Runs each group of fused bodies as one forall loop.
+ *
+ * Loops run by a resource complete in order, so no barrier is needed
+ * between them.
+ */
+template <typename Res, typename ExecPol, typename Iterable>
+struct ForallFuseRunner {
+  Res r;
+  ExecPol const& p;
+  Iterable const& iter;
+
+  template <typename... Bodies>
+  RAJA_INLINE void group(FusedBodies<Bodies...> const& bodies)
+  {
+    forall_impl(r, p, iter, bodies);
+  }
+
+  RAJA_INLINE void group(FusedBodies<> const&) {}
+
+  RAJA_INLINE void barrier() {}
+};
+
+/*!
+ * \brief Run fused loop bodies, one forall loop per group.
+ *
+ * Back-ends that can run several groups in one launch provide more
+ * specialized overloads.
+ */
+template <typename Res, typename ExecPol, typename Iterable, typename... Bodies>
+RAJA_INLINE resources::EventProxy<Res> forall_fused_impl(Res r,
+                                                         ExecPol const& p,
+                                                         Iterable&& iter,
+                                                         Bodies&&... bodies)
+{
+  ForallFuseRunner<Res, ExecPol, camp::decay<Iterable>> run{r, p, iter};
+  FuseGroups<>::apply(run, std::forward<Bodies>(bodies)...);
+  return resources::EventProxy<Res>(r);
+}
+
+/*!
+ * \brief Run fused loop bodies held in a tuple.
+ */
+template <typename Res,
+          typename ExecPol,
+          typename Iterable,
+          typename BodyTuple,
+          camp::idx_t... Is>
+RAJA_INLINE resources::EventProxy<Res> forall_fused_unpack(Res r,
+                                                           ExecPol const& p,
+                                                           Iterable&& iter,
+                                                           BodyTuple const& bodies,
+                                                           camp::idx_seq<Is...>)
+{
+  return forall_fused_impl(r,
+                           p,
+                           std::forward<Iterable>(iter),
+                           camp::get<Is>(bodies)...);
+}
+
+}  // namespace detail
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_FUSE_HPP */
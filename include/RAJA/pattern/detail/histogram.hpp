@@ -0,0 +1,46 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the helpers shared by the histogram back-ends.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_histogram_HPP
+#define RAJA_pattern_detail_histogram_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! the bin of value, or -1 if bin_of does not give one of the num_bins bins
+template <typename BinOp, typename T>
+RAJA_HOST_DEVICE RAJA_INLINE Index_type histogram_bin(BinOp const& bin_of,
+                                                      T&& value,
+                                                      Index_type num_bins)
+{
+  const Index_type bin = static_cast<Index_type>(bin_of(value));
+  return (bin >= 0 && bin < num_bins) ? bin : Index_type(-1);
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -18,6 +18,10 @@
 #ifndef RAJA_PATTERN_DETAIL_REDUCE_HPP
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/reduce.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -48,7 +52,8 @@
   RAJA_DECLARE_INDEX_REDUCER(MinLoc, POL, COMBINER)    \
   RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)    \
   RAJA_DECLARE_REDUCER(BitOr, POL, COMBINER)           \
-  RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)
+  RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)          \
+  RAJA_DECLARE_REDUCER(Multi, POL, COMBINER)
 
 namespace RAJA
 {
@@ -66,6 +71,7 @@ namespace detail
 template <typename T, template <typename...> class Op>
 struct op_adapter : private Op<T, T, T> {
   using operator_type = Op<T, T, T>;
+  using value_type = T;
   RAJA_HOST_DEVICE static constexpr T identity()
   {
     return operator_type::identity();
@@ -98,6 +104,158 @@ template <typename T>
 struct and_bit : detail::op_adapter<T, RAJA::operators::bit_and> {
 };
 
+/*!
+ * \brief Value of a fused reduction, one value per combiner.
+ *
+ * Used with multi as the value type of ReduceMulti so several reductions of
+ * different types and operations are combined together in one pass.
+ */
+template <typename... Combiners>
+struct multi_value {
+  static_assert(sizeof...(Combiners) > 0,
+                "multi_value requires at least one combiner");
+
+  using values_type = camp::tuple<typename Combiners::value_type...>;
+
+  template <camp::idx_t I>
+  using element_type = camp::tuple_element_t<I, values_type>;
+
+  values_type values;
+
+  RAJA_HOST_DEVICE constexpr multi_value() : values() {}
+
+  RAJA_HOST_DEVICE constexpr multi_value(
+      typename Combiners::value_type const&... vals)
+      : values(vals...)
+  {
+  }
+
+  //! get the Ith value
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE element_type<I>& get()
+  {
+    return camp::get<I>(values);
+  }
+
+  //! get the Ith value
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE const element_type<I>& get() const
+  {
+    return camp::get<I>(values);
+  }
+
+  RAJA_HOST_DEVICE bool operator==(multi_value const& rhs) const
+  {
+    return equal(rhs, camp::make_idx_seq_t<sizeof...(Combiners)>{});
+  }
+
+  RAJA_HOST_DEVICE bool operator!=(multi_value const& rhs) const
+  {
+    return !operator==(rhs);
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE bool equal(multi_value const& rhs,
+                              camp::idx_seq<Is...>) const
+  {
+    bool eq = true;
+    camp::sink((eq = eq && (camp::get<Is>(values) ==
+                            camp::get<Is>(rhs.values)))...);
+    return eq;
+  }
+};
+
+//! combiner of a multi_value, applies each combiner to its own value
+template <typename T>
+struct multi;
+
+template <typename... Combiners>
+struct multi<multi_value<Combiners...>> {
+  using value_type = multi_value<Combiners...>;
+
+  RAJA_HOST_DEVICE static constexpr value_type identity()
+  {
+    return value_type(Combiners::identity()...);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(value_type &val,
+                                               const value_type v) const
+  {
+    apply(val, v, camp::make_idx_seq_t<sizeof...(Combiners)>{});
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE RAJA_INLINE static void apply(value_type &val,
+                                                 const value_type &v,
+                                                 camp::idx_seq<Is...>)
+  {
+    camp::sink((Combiners{}(camp::get<Is>(val.values),
+                            camp::get<Is>(v.values)),
+                0)...);
+  }
+};
+
+/*!
+ * \brief Fixed size array of values reduced elementwise.
+ *
+ * Used as the value type of ReduceSumArray so a small array of bins is
+ * privatized per thread and combined with one elementwise pass.
+ */
+template <typename T, size_t N>
+struct array_value {
+  static_assert(N > 0, "array_value requires at least one element");
+
+  using element_type = T;
+  static constexpr size_t size = N;
+
+  T values[N];
+
+  RAJA_HOST_DEVICE constexpr array_value() : values{} {}
+
+  //! initialize every element to val
+  RAJA_HOST_DEVICE constexpr explicit array_value(T const& val) : values{}
+  {
+    for (size_t i = 0; i < N; ++i) {
+      values[i] = val;
+    }
+  }
+
+  RAJA_HOST_DEVICE T& operator[](size_t i) { return values[i]; }
+
+  RAJA_HOST_DEVICE const T& operator[](size_t i) const { return values[i]; }
+
+  RAJA_HOST_DEVICE array_value& operator+=(array_value const& rhs)
+  {
+    RAJA_SIMD
+    for (size_t i = 0; i < N; ++i) {
+      values[i] += rhs.values[i];
+    }
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE friend array_value operator+(array_value lhs,
+                                                array_value const& rhs)
+  {
+    lhs += rhs;
+    return lhs;
+  }
+
+  RAJA_HOST_DEVICE bool operator==(array_value const& rhs) const
+  {
+    for (size_t i = 0; i < N; ++i) {
+      if (!(values[i] == rhs.values[i])) return false;
+    }
+    return true;
+  }
+
+  RAJA_HOST_DEVICE bool operator!=(array_value const& rhs) const
+  {
+    return !operator==(rhs);
+  }
+};
+
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 #pragma omp end declare target
@@ -121,6 +279,16 @@ struct DefaultLoc<T, true>
   RAJA_HOST_DEVICE constexpr T value() const { return -1; }
 };
 
+//! tuple of indices, e.g. kernel loop indices, defaults each component
+template <typename... Ts>
+struct DefaultLoc<camp::tuple<Ts...>, false>
+{
+  RAJA_HOST_DEVICE constexpr camp::tuple<Ts...> value() const
+  {
+    return camp::tuple<Ts...>(DefaultLoc<Ts>().value()...);
+  }
+};
+
 template <typename T, typename IndexType, bool doing_min = true>
 class ValueLoc
 {
@@ -368,6 +536,16 @@ public:
     return *this;
   }
 
+  //! reducer function taking the components of a tuple IndexType,
+  //  e.g. the loop indices of a kernel
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  RAJA_HOST_DEVICE
+  const BaseReduceMinLoc &minloc(T rhs, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    this->combine(value_type(rhs, IndexType(i0, i1, is...)));
+    return *this;
+  }
+
   void reset(T init_val, IndexType init_idx=DefaultLoc<IndexType>().value(),
              T identity_ = reduce_type::identity())
   {
@@ -511,6 +689,16 @@ public:
     return *this;
   }
 
+  //! reducer function taking the components of a tuple IndexType,
+  //  e.g. the loop indices of a kernel
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  RAJA_HOST_DEVICE
+  const BaseReduceMaxLoc &maxloc(T rhs, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    this->combine(value_type(rhs, IndexType(i0, i1, is...)));
+    return *this;
+  }
+
   void reset(T init_val, IndexType init_idx=DefaultLoc<IndexType>().value(),
              T identity_ = reduce_type::identity())
   {
@@ -525,10 +713,91 @@ public:
   operator T() const { return Base::get(); }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Fused multi-value reducer class template.
+ *
+ *         T is a multi_value of the combiners to apply, for example
+ *         multi_value<sum<double>, min<double>, max<int>>.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceMulti : public BaseReduce<T, RAJA::reduce::multi, Combiner>
+{
+public:
+  using Base = BaseReduce<T, RAJA::reduce::multi, Combiner>;
+  using Base::Base;
+
+  //! reducer function; combines one value into each reduction, in order
+  template <typename... Args>
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE
+  const BaseReduceMulti &reduce(Args const &... args) const
+  {
+    this->combine(T(args...));
+    return *this;
+  }
+
+  //! Get the calculated Ith reduced value
+  template <camp::idx_t I>
+  typename T::template element_type<I> get() const
+  {
+    return Base::get().template get<I>();
+  }
+
+  //! Get all of the calculated reduced values
+  T get() const { return Base::get(); }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
 
+/*!
+ * \brief Generic array sum reducer, a ReduceSum of an array_value.
+ *
+ * Backends with a ReduceSum for arbitrary trivially copyable types get
+ * ReduceSumArray from this template. Each thread adds into its private copy
+ * of the array, and copies are combined elementwise once per thread or
+ * block.
+ */
+template <typename REDUCE_POLICY_T, typename T, size_t N>
+class ReduceSumArray
+    : public ReduceSum<REDUCE_POLICY_T, reduce::array_value<T, N>>
+{
+public:
+  using Base = ReduceSum<REDUCE_POLICY_T, reduce::array_value<T, N>>;
+  using value_type = reduce::array_value<T, N>;
+
+  ReduceSumArray() : Base(value_type(T(0))) {}
+
+  //! initialize every bin to init_val
+  explicit ReduceSumArray(T init_val) : Base(value_type(init_val)) {}
+
+  explicit ReduceSumArray(value_type const& init_vals) : Base(init_vals) {}
+
+  //! add val to bin in this thread's private array
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE
+  const ReduceSumArray& add(size_t bin, T val) const
+  {
+    this->local()[bin] += val;
+    return *this;
+  }
+
+  void reset(T init_val) { Base::reset(value_type(init_val)); }
+
+  void reset(value_type const& init_vals) { Base::reset(init_vals); }
+
+  //! Get the reduced values of all bins
+  value_type get() { return Base::get(); }
+
+  //! Get the reduced value of one bin
+  T get(size_t bin) { return Base::get()[bin]; }
+};
+
 }  // namespace RAJA
 
 #endif /* RAJA_PATTERN_DETAIL_REDUCE_HPP */
@@ -0,0 +1,213 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the iterators and operator used to run segmented
+ *          scans and reductions through the scan back-ends.
+ *
+ *          A segmented scan is a scan of (heads, value) pairs, where heads
+ *          counts the segment heads in a range of the input. Combining two
+ *          pairs restarts the value if the right range contains a head:
+ *
+ *             (h1, v1) + (h2, v2) = (h1 + h2, h2 > 0 ? v2 : v1 op v2)
+ *
+ *          This operator is associative, so the parallel scans of every
+ *          back-end compute all segments in one pass. The output iterators
+ *          turn the pairs back into values of the user's output.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_scan_HPP
+#define RAJA_pattern_detail_scan_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! value of a segmented scan with the number of segment heads it covers
+template <typename T>
+struct segmented_value {
+  Index_type heads;
+  T value;
+};
+
+//! operator of a segmented scan, restarts at segment heads
+template <typename BinFn, typename T>
+struct segmented_op {
+  using value_type = segmented_value<T>;
+
+  BinFn f;
+
+  RAJA_HOST_DEVICE
+  value_type operator()(value_type const& lhs, value_type const& rhs) const
+  {
+    return value_type{lhs.heads + rhs.heads,
+                      rhs.heads > 0 ? rhs.value : f(lhs.value, rhs.value)};
+  }
+
+  RAJA_HOST_DEVICE
+  static constexpr value_type identity()
+  {
+    return value_type{0, BinFn::identity()};
+  }
+};
+
+/*!
+ * \brief Random access iterator over (head, value) pairs of a segmented scan.
+ *
+ * A value starts a segment if its flag is not zero.
+ */
+template <typename T, typename Iter, typename FlagIter>
+struct SegmentedInputIterator {
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = segmented_value<T>;
+  using difference_type =
+      typename std::iterator_traits<Iter>::difference_type;
+  using pointer = void;
+  using reference = value_type;
+
+  Iter in;
+  FlagIter flags;
+
+  RAJA_HOST_DEVICE
+  value_type operator[](difference_type i) const
+  {
+    return value_type{flags[i] ? 1 : 0, static_cast<T>(in[i])};
+  }
+
+  RAJA_HOST_DEVICE
+  value_type operator*() const { return (*this)[0]; }
+
+  RAJA_HOST_DEVICE
+  SegmentedInputIterator& operator++()
+  {
+    ++in;
+    ++flags;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  SegmentedInputIterator operator+(difference_type n) const
+  {
+    return SegmentedInputIterator{in + n, flags + n};
+  }
+
+  RAJA_HOST_DEVICE
+  difference_type operator-(SegmentedInputIterator const& rhs) const
+  {
+    return in - rhs.in;
+  }
+
+  RAJA_HOST_DEVICE
+  bool operator==(SegmentedInputIterator const& rhs) const
+  {
+    return in == rhs.in;
+  }
+
+  RAJA_HOST_DEVICE
+  bool operator!=(SegmentedInputIterator const& rhs) const
+  {
+    return in != rhs.in;
+  }
+};
+
+template <typename T, typename Iter, typename FlagIter>
+RAJA_INLINE SegmentedInputIterator<T, Iter, FlagIter> make_segmented_input(
+    Iter in,
+    FlagIter flags)
+{
+  return SegmentedInputIterator<T, Iter, FlagIter>{in, flags};
+}
+
+//! what a segmented output iterator writes for each scanned pair
+enum struct segmented_output : int {
+  inclusive,  //!< the inclusive scan of the segment
+  exclusive,  //!< the exclusive scan of the segment, from an initial value
+  reduce      //!< one value per segment, at the end of the segment
+};
+
+/*!
+ * \brief Output iterator writing the pairs of a segmented scan as values.
+ *
+ * Assigning to out[i] writes the value for position i. The exclusive output
+ * must be given the exclusive scan of the pairs, the others the inclusive
+ * scan. The reduction writes segment s to out[s].
+ */
+template <segmented_output Output,
+          typename OutIter,
+          typename FlagIter,
+          typename BinFn,
+          typename T>
+struct SegmentedOutputIterator {
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = segmented_value<T>;
+  using difference_type = Index_type;
+  using pointer = void;
+
+  struct reference {
+    SegmentedOutputIterator const& it;
+    difference_type i;
+
+    RAJA_HOST_DEVICE
+    reference const& operator=(value_type const& val) const
+    {
+      if (Output == segmented_output::inclusive) {
+        it.out[i] = val.value;
+      } else if (Output == segmented_output::exclusive) {
+        it.out[i] = it.flags[i] ? it.init : it.f(it.init, val.value);
+      } else if (i + 1 == it.len || it.flags[i + 1]) {
+        it.out[val.heads - (it.flags[0] ? 1 : 0)] = val.value;
+      }
+      return *this;
+    }
+  };
+
+  OutIter out;
+  FlagIter flags;
+  BinFn f;
+  T init;
+  difference_type len;
+
+  RAJA_HOST_DEVICE
+  reference operator[](difference_type i) const { return reference{*this, i}; }
+};
+
+template <segmented_output Output,
+          typename OutIter,
+          typename FlagIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE SegmentedOutputIterator<Output, OutIter, FlagIter, BinFn, T>
+make_segmented_output(OutIter out,
+                      FlagIter flags,
+                      BinFn f,
+                      T init,
+                      Index_type len)
+{
+  return SegmentedOutputIterator<Output, OutIter, FlagIter, BinFn, T>{
+      out, flags, f, init, len};
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,353 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file declaring an MPI block partition of an index
+ *          space into interior and boundary index sets, and a forall that
+ *          overlaps the interior with the halo exchange.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_distributed_HPP
+#define RAJA_pattern_distributed_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_MPI)
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/WorkGroup/PackPlan.hpp"
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Block partition of the global index space [0, global_size) over
+ *        the ranks of an MPI communicator, with halo_width ghost values on
+ *        each side of the block of a rank.
+ *
+ * Rank p owns a block of consecutive global indices, the blocks differ in
+ * size by at most one. Each rank stores its block in a local array of
+ * local_size() values, the owned values at local indices
+ * [halo_width, halo_width + num_owned()) and the ghosts of the neighboring
+ * ranks before and after them:
+ *
+ *   | ghosts | boundary | interior | boundary | ghosts |
+ *
+ * The boundary values are the halo_width values at each end of the block,
+ * which the neighbors receive as their ghosts and whose stencils read the
+ * ghosts of this rank. interior(), boundary() and owned() are index sets of
+ * local indices, so
+ *
+ *   forall<ExecPolicy<seq_segit, exec_pol>>(part.interior(), body);
+ *
+ * runs the interior without waiting for any message. Every block must hold
+ * at least halo_width values.
+ */
+template <typename INDEX_T>
+class BlockPartition
+{
+  static_assert(std::is_integral<INDEX_T>::value,
+                "BlockPartition indices must be integral");
+
+public:
+  using index_type = INDEX_T;
+  using segment_type = TypedRangeSegment<INDEX_T>;
+  using index_set_type = TypedIndexSet<segment_type>;
+
+  BlockPartition(MPI_Comm comm, INDEX_T global_size, INDEX_T halo_width)
+      : m_comm(comm), m_global_size(global_size), m_halo(halo_width)
+  {
+    MPI_Comm_rank(comm, &m_rank);
+    MPI_Comm_size(comm, &m_size);
+
+    const INDEX_T base = global_size / m_size;
+    const INDEX_T extra = global_size % m_size;
+    const INDEX_T r = static_cast<INDEX_T>(m_rank);
+    m_begin = r * base + (r < extra ? r : extra);
+    m_owned = base + (r < extra ? 1 : 0);
+
+    if (m_owned < m_halo) {
+      throw std::runtime_error(
+          "RAJA::expt::BlockPartition blocks are smaller than the halo");
+    }
+
+    const INDEX_T h = m_halo;
+    const INDEX_T n = m_owned;
+    if (h == 0) {
+      m_interior.push_back(segment_type(0, n));
+    } else if (n >= 2 * h) {
+      m_interior.push_back(segment_type(2 * h, n));
+      m_boundary.push_back(segment_type(h, 2 * h));
+      m_boundary.push_back(segment_type(n, n + h));
+    } else {
+      m_boundary.push_back(segment_type(h, h + n));
+    }
+    m_owned_set.push_back(segment_type(h, h + n));
+  }
+
+  MPI_Comm comm() const { return m_comm; }
+
+  int rank() const { return m_rank; }
+
+  int size() const { return m_size; }
+
+  INDEX_T global_size() const { return m_global_size; }
+
+  INDEX_T halo_width() const { return m_halo; }
+
+  //! number of values owned by this rank
+  INDEX_T num_owned() const { return m_owned; }
+
+  //! number of values of the local array, owned values and ghosts
+  INDEX_T local_size() const { return m_owned + 2 * m_halo; }
+
+  //! first global index owned by this rank
+  INDEX_T global_begin() const { return m_begin; }
+
+  INDEX_T to_local(INDEX_T global) const { return global - m_begin + m_halo; }
+
+  INDEX_T to_global(INDEX_T local) const { return local - m_halo + m_begin; }
+
+  //! rank before this one, or MPI_PROC_NULL on the first rank
+  int lower_neighbor() const { return m_rank > 0 ? m_rank - 1 : MPI_PROC_NULL; }
+
+  //! rank after this one, or MPI_PROC_NULL on the last rank
+  int upper_neighbor() const
+  {
+    return m_rank + 1 < m_size ? m_rank + 1 : MPI_PROC_NULL;
+  }
+
+  //! owned values whose stencils read no ghosts
+  index_set_type const& interior() const { return m_interior; }
+
+  //! owned values sent to the neighbors, whose stencils read the ghosts
+  index_set_type const& boundary() const { return m_boundary; }
+
+  index_set_type const& owned() const { return m_owned_set; }
+
+private:
+  MPI_Comm m_comm;
+  int m_rank = 0;
+  int m_size = 1;
+  INDEX_T m_global_size;
+  INDEX_T m_halo;
+  INDEX_T m_begin = 0;
+  INDEX_T m_owned = 0;
+  index_set_type m_interior;
+  index_set_type m_boundary;
+  index_set_type m_owned_set;
+};
+
+/*!
+ * \brief Exchange of the ghosts of the variables of a BlockPartition with
+ *        the neighboring ranks, packed and unpacked by the WorkGroups of a
+ *        PackPlan.
+ *
+ * Each variable holds part.local_size() values in the memory of the
+ * resource of the WorkGroup policy. The buffers and index lists are
+ * allocated on that resource, so with a device policy the messages are
+ * sent from device memory and MPI must be GPU aware.
+ *
+ * start() packs the boundary values of every variable into one message per
+ * neighbor and posts the sends and receives, and finish() waits for them
+ * and unpacks the ghosts, so work between the two overlaps the messages:
+ *
+ * \code
+ *
+ * HaloExchange<workgroup_pol, double, int, Allocator> halo(part, {u, v},
+ *                                                         Allocator{});
+ *
+ * halo.start();
+ * forall<ExecPolicy<seq_segit, exec_pol>>(part.interior(), body);
+ * halo.finish();
+ * forall<ExecPolicy<seq_segit, exec_pol>>(part.boundary(), body);
+ *
+ * \endcode
+ *
+ * which is what halo_forall does.
+ */
+template <typename WORKGROUP_POLICY_T,
+          typename T,
+          typename INDEX_T,
+          typename ALLOCATOR_T>
+class HaloExchange
+{
+public:
+  using plan_type = PackPlan<WORKGROUP_POLICY_T, T, INDEX_T, ALLOCATOR_T>;
+  using workgroup_type = typename plan_type::workgroup_type;
+  using resource_type = typename plan_type::resource_type;
+  using partition_type = BlockPartition<INDEX_T>;
+
+  static constexpr int tag = 4207;
+
+  //! exchange the ghosts of vars, which hold part.local_size() values each
+  HaloExchange(partition_type const& part,
+               std::vector<T*> const& vars,
+               ALLOCATOR_T const& aloc,
+               resource_type res = resource_type::get_default())
+      : m_part(part),
+        m_res(res),
+        m_neighbors{part.lower_neighbor(), part.upper_neighbor()},
+        m_plan(aloc),
+        m_pack_group(build(vars)),
+        m_unpack_group(m_plan.make_unpack_group(m_recv))
+  {
+  }
+
+  HaloExchange(HaloExchange const&) = delete;
+  HaloExchange& operator=(HaloExchange const&) = delete;
+
+  ~HaloExchange()
+  {
+    if (m_send != nullptr) m_res.deallocate(m_send);
+    if (m_recv != nullptr) m_res.deallocate(m_recv);
+    if (m_lists != nullptr) m_res.deallocate(m_lists);
+  }
+
+  partition_type const& partition() const { return m_part; }
+
+  resource_type get_resource() const { return m_res; }
+
+  //! pack the boundary values and post the messages
+  void start()
+  {
+    m_pack_group.run(m_res);
+    m_res.wait();
+
+    for (int m = 0; m < 2; ++m) {
+      const int bytes = static_cast<int>(m_plan.message_size(m) * sizeof(T));
+      MPI_Irecv(m_recv + m_plan.message_offset(m), bytes, MPI_BYTE,
+                m_neighbors[m], tag, m_part.comm(), &m_requests[2 * m]);
+      MPI_Isend(m_send + m_plan.message_offset(m), bytes, MPI_BYTE,
+                m_neighbors[m], tag, m_part.comm(), &m_requests[2 * m + 1]);
+    }
+  }
+
+  //! wait for the messages and unpack the ghosts
+  void finish()
+  {
+    MPI_Waitall(4, m_requests, MPI_STATUSES_IGNORE);
+
+    m_unpack_group.run(m_res);
+    m_res.wait();
+  }
+
+private:
+  // lay out the messages and allocate the lists and buffers, returns the
+  // pack group
+  workgroup_type build(std::vector<T*> const& vars)
+  {
+    // lists per neighbor: the boundary values sent and the ghosts received
+    const INDEX_T h = m_part.halo_width();
+    const INDEX_T n = m_part.num_owned();
+    std::vector<INDEX_T> lists(4 * h);
+    for (INDEX_T i = 0; i < h; ++i) {
+      lists[i] = h + i;              // lower boundary
+      lists[h + i] = i;              // lower ghosts
+      lists[2 * h + i] = n + i;      // upper boundary
+      lists[3 * h + i] = n + h + i;  // upper ghosts
+    }
+    if (h > 0) {
+      m_lists = m_res.template allocate<INDEX_T>(lists.size());
+      m_res.memcpy(m_lists, lists.data(), sizeof(INDEX_T) * lists.size());
+    }
+
+    // message m goes to and comes from neighbor m with the same layout, and
+    // is empty without a neighbor so the ghosts there are left alone
+    for (int m = 0; m < 2; ++m) {
+      m_plan.add_message();
+      if (h > 0 && m_neighbors[m] != MPI_PROC_NULL) {
+        for (T* var : vars) {
+          m_plan.add_list(
+              var, m_lists + 2 * m * h, m_lists + (2 * m + 1) * h, h);
+        }
+      }
+    }
+
+    if (m_plan.buffer_size() > 0) {
+      m_send = m_res.template allocate<T>(m_plan.buffer_size());
+      m_recv = m_res.template allocate<T>(m_plan.buffer_size());
+    }
+    return m_plan.make_pack_group(m_send);
+  }
+
+  partition_type const& m_part;
+  resource_type m_res;
+  int m_neighbors[2];
+  INDEX_T* m_lists = nullptr;
+  T* m_send = nullptr;
+  T* m_recv = nullptr;
+  plan_type m_plan;
+  workgroup_type m_pack_group;
+  workgroup_type m_unpack_group;
+  MPI_Request m_requests[4];
+};
+
+template <typename WORKGROUP_POLICY_T,
+          typename T,
+          typename INDEX_T,
+          typename ALLOCATOR_T>
+constexpr int HaloExchange<WORKGROUP_POLICY_T, T, INDEX_T, ALLOCATOR_T>::tag;
+
+/*!
+ * \brief Runs body over the owned values of the partition of halo, with the
+ *        interior run while the ghosts are exchanged.
+ *
+ * The halo exchange is started, the interior is run, then the exchange is
+ * finished and the boundary is run, so only the boundary waits for the
+ * messages. With an asynchronous device policy the interior runs on the
+ * device while the host waits for MPI. body must not write the variables
+ * of halo, whose boundary values are being sent.
+ */
+template <typename ExecPol,
+          typename WORKGROUP_POLICY_T,
+          typename T,
+          typename INDEX_T,
+          typename ALLOCATOR_T,
+          typename Body>
+void halo_forall(
+    HaloExchange<WORKGROUP_POLICY_T, T, INDEX_T, ALLOCATOR_T>& halo,
+    Body&& body)
+{
+  using set_policy = ExecPolicy<seq_segit, ExecPol>;
+  auto r = resources::get_resource<ExecPol>::type::get_default();
+
+  halo.start();
+  RAJA::forall<set_policy>(r, halo.partition().interior(), body);
+  halo.finish();
+  RAJA::forall<set_policy>(r, halo.partition().boundary(), body);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_MPI guard
+
+#endif  // closing endif for header file include guard
@@ -63,20 +63,30 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/policy/MultiPolicy.hpp"
 
+#include "RAJA/index/BitMaskSegment.hpp"
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/DeltaListSegment.hpp"
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/IndexSetDepGraph.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/index/RunListSegment.hpp"
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/KernelName.hpp"
 #include "RAJA/util/Span.hpp"
+#include "RAJA/util/StreamingPtr.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/sequential/forall.hpp"
 
 #include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/fuse.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/params/reduce.hpp"
+#include "RAJA/pattern/params/schedule.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/plugins.hpp"
@@ -119,6 +129,58 @@ struct icount_adapter {
   }
 };
 
+/// True if a run list segment is executed with a host policy, which runs
+/// each run of the segment as a range segment
+template <typename ExecutionPolicy, typename Container>
+struct is_host_run_list
+    : std::integral_constant<
+          bool,
+          type_traits::is_run_list_segment<Container>::value &&
+              get_platform<camp::decay<ExecutionPolicy>>::value ==
+                  Platform::host> {
+};
+
+/// True if a box segment is executed with a sequential, loop, or simd
+/// policy, which runs each row of the last dimension of the box as a range
+/// segment. Parallel policies run the box as one loop over its positions.
+template <typename ExecutionPolicy>
+struct is_serial_host_policy
+    : std::integral_constant<
+          bool,
+          type_traits::is_sequential_policy<ExecutionPolicy>::value ||
+              type_traits::is_loop_policy<ExecutionPolicy>::value ||
+              type_traits::is_simd_policy<ExecutionPolicy>::value> {
+};
+
+template <typename ExecutionPolicy, typename Container>
+struct is_host_box
+    : std::conditional<type_traits::is_box_segment<Container>::value,
+                       is_serial_host_policy<ExecutionPolicy>,
+                       std::false_type>::type {
+};
+
+/// True if a bit mask segment is executed with a host policy, which runs
+/// the words of the mask and the set bits of each word
+template <typename ExecutionPolicy, typename Container>
+struct is_host_bit_mask
+    : std::integral_constant<
+          bool,
+          type_traits::is_bit_mask_segment<Container>::value &&
+              get_platform<camp::decay<ExecutionPolicy>>::value ==
+                  Platform::host> {
+};
+
+/// True if a bit mask segment is executed with a device policy, which
+/// runs the bits of the mask and tests each bit
+template <typename ExecutionPolicy, typename Container>
+struct is_device_bit_mask
+    : std::integral_constant<
+          bool,
+          type_traits::is_bit_mask_segment<Container>::value &&
+              get_platform<camp::decay<ExecutionPolicy>>::value !=
+                  Platform::host> {
+};
+
 struct CallForall {
   template <typename T, typename ExecPol, typename Body, typename Res>
   RAJA_INLINE camp::resources::EventProxy<Res> operator()(T const&, ExecPol, Body, Res) const;
@@ -132,6 +194,128 @@ struct CallForallIcount {
 
   const int start;
 };
+
+/// Dispatch for forall with reduction parameters, Args holds the
+/// parameters followed by the loop body
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename Args,
+          camp::idx_t... Is>
+RAJA_INLINE resources::EventProxy<Res> forall_param(ExecutionPolicy&& p,
+                                                    Res r,
+                                                    Container&& c,
+                                                    Args&& args,
+                                                    camp::idx_seq<Is...>)
+{
+  static_assert(concepts::all_of<expt::detail::is_reduce_param<
+                    camp::decay<decltype(camp::get<Is>(args))>>...>::value,
+                "Expected reduction parameters between the container and "
+                "the loop body");
+
+  using Body = camp::decay<decltype(camp::get<sizeof...(Is)>(args))>;
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, Body>(
+          util::KernelPattern::forall, nullptr, util::iteration_count(c), r)};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto body = trigger_updates_before(camp::get<sizeof...(Is)>(args));
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  auto params = camp::make_tuple(camp::get<Is>(args)...);
+
+  using RAJA::expt::detail::forall_param_impl;
+  resources::EventProxy<Res> e = forall_param_impl(
+      r,
+      p,
+      std::forward<Container>(c),
+      params,
+      std::move(body));
+
+  RAJA::detail::streaming_fence(r);
+
+  util::callPostLaunchPlugins(context);
+  return e;
+}
+
+/// Dispatch for forall with a scheduling hint
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename Hint,
+          typename LoopBody>
+RAJA_INLINE resources::EventProxy<Res> forall_hint(ExecutionPolicy&& p,
+                                                   Res r,
+                                                   Container&& c,
+                                                   Hint const& hint,
+                                                   LoopBody&& loop_body)
+{
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          util::KernelPattern::forall, nullptr, util::iteration_count(c), r)};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  using RAJA::expt::detail::forall_hint_impl;
+  resources::EventProxy<Res> e = forall_hint_impl(
+      r,
+      p,
+      std::forward<Container>(c),
+      hint,
+      std::move(body));
+
+  RAJA::detail::streaming_fence(r);
+
+  util::callPostLaunchPlugins(context);
+  return e;
+}
+
+/// Dispatch for forall with a kernel name
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename LoopBody>
+RAJA_INLINE resources::EventProxy<Res> forall_named(ExecutionPolicy&& p,
+                                                    Res r,
+                                                    Container&& c,
+                                                    expt::KernelName const& name,
+                                                    LoopBody&& loop_body)
+{
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          util::KernelPattern::forall, name, util::iteration_count(c), r)};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  util::ScopedKernelRange range(name.name);
+  resources::EventProxy<Res> e = wrap::forall(
+      r,
+      std::forward<ExecutionPolicy>(p),
+      std::forward<Container>(c),
+      std::move(body));
+
+  RAJA::detail::streaming_fence(r);
+
+  util::callPostLaunchPlugins(context);
+  return e;
+}
+
 }  // namespace detail
 
 /*!
@@ -156,6 +340,9 @@ template <typename Res, typename ExecutionPolicy, typename Container, typename L
 RAJA_INLINE concepts::enable_if_t<
     RAJA::resources::EventProxy<Res>,
     concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<detail::is_host_run_list<ExecutionPolicy, Container>>,
+    concepts::negate<detail::is_host_box<ExecutionPolicy, Container>>,
+    concepts::negate<type_traits::is_bit_mask_segment<Container>>,
     type_traits::is_range<Container>>
 forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 {
@@ -166,6 +353,107 @@ forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
                      std::forward<LoopBody>(loop_body));
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a run list segment with a host policy, each run is
+ *        executed as a contiguous range segment
+ *
+ ******************************************************************************
+ */
+template <typename Res, typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    detail::is_host_run_list<ExecutionPolicy, Container>>
+forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+{
+  for (Index_type run = 0; run < c.getNumRuns(); ++run) {
+    forall_impl(r, p, c.getRun(run), loop_body);
+  }
+  return RAJA::resources::EventProxy<Res>(r);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a bit mask segment with a host policy, the policy
+ *        runs the words of the mask and each word calls the body for its
+ *        set bits
+ *
+ ******************************************************************************
+ */
+template <typename Res, typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    detail::is_host_bit_mask<ExecutionPolicy, Container>>
+forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+{
+  using segment_type = camp::decay<Container>;
+  using body_type = RAJA::detail::BitMaskWordBody<
+      typename segment_type::value_type,
+      typename segment_type::word_type,
+      LoopBody>;
+  return forall_impl(r,
+                     std::forward<ExecutionPolicy>(p),
+                     TypedRangeSegment<Index_type>(0, c.getNumWords()),
+                     body_type{c, std::forward<LoopBody>(loop_body)});
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a bit mask segment with a device policy, the policy
+ *        runs the bits of the mask and the body is called for set bits
+ *
+ ******************************************************************************
+ */
+template <typename Res, typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    detail::is_device_bit_mask<ExecutionPolicy, Container>>
+forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+{
+  using segment_type = camp::decay<Container>;
+  using body_type = RAJA::detail::BitMaskBitBody<
+      typename segment_type::value_type,
+      typename segment_type::word_type,
+      LoopBody>;
+  return forall_impl(r,
+                     std::forward<ExecutionPolicy>(p),
+                     TypedRangeSegment<Index_type>(0, c.size()),
+                     body_type{c, std::forward<LoopBody>(loop_body)});
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a box segment with a sequential policy, each row
+ *        of the last dimension is executed as a range segment
+ *
+ ******************************************************************************
+ */
+template <typename Res, typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    detail::is_host_box<ExecutionPolicy, Container>>
+forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+{
+  if (c.hasContiguousRuns()) {
+    for (Index_type run = 0; run < c.getNumRuns(); ++run) {
+      forall_impl(r, p, c.getContiguousRun(run), loop_body);
+    }
+  } else {
+    for (Index_type run = 0; run < c.getNumRuns(); ++run) {
+      forall_impl(r, p, c.getRun(run), loop_body);
+    }
+  }
+  return RAJA::resources::EventProxy<Res>(r);
+}
+
 
 /*!
  ******************************************************************************
@@ -211,11 +499,13 @@ template <typename Res,
           typename SegmentExecPolicy,
           typename... SegmentTypes,
           typename LoopBody>
-RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res r,
-                                                ExecPolicy<SegmentIterPolicy,
-                                                SegmentExecPolicy>,
-                                                const TypedIndexSet<SegmentTypes...>& iset,
-                                                LoopBody loop_body)
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_balanced_segit_policy<SegmentIterPolicy>>>
+forall_Icount(Res r,
+              ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+              const TypedIndexSet<SegmentTypes...>& iset,
+              LoopBody loop_body)
 {
   // no need for icount variant here
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
@@ -234,11 +524,13 @@ template <typename Res,
           typename SegmentExecPolicy,
           typename LoopBody,
           typename... SegmentTypes>
-RAJA_INLINE resources::EventProxy<Res> forall(Res r,
-                                         ExecPolicy<SegmentIterPolicy,
-                                         SegmentExecPolicy>,
-                                         const TypedIndexSet<SegmentTypes...>& iset,
-                                         LoopBody loop_body)
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_balanced_segit_policy<SegmentIterPolicy>>>
+forall(Res r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+       const TypedIndexSet<SegmentTypes...>& iset,
+       LoopBody loop_body)
 {
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
   wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
@@ -247,6 +539,141 @@ RAJA_INLINE resources::EventProxy<Res> forall(Res r,
   return RAJA::resources::EventProxy<Res>(r);
 }
 
+/*!
+******************************************************************************
+*
+* \brief Execute segments split into chunks of similar length, the segment
+*        iteration policy back-end schedules the chunks.
+*
+******************************************************************************
+*/
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename... SegmentTypes,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_balanced_segit_policy<SegmentIterPolicy>>
+forall_Icount(Res r,
+              ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+              const TypedIndexSet<SegmentTypes...>& iset,
+              LoopBody loop_body)
+{
+  return forall_Icount_impl(r,
+                            SegmentIterPolicy(),
+                            SegmentExecPolicy(),
+                            iset,
+                            std::move(loop_body));
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_balanced_segit_policy<SegmentIterPolicy>>
+forall(Res r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+       const TypedIndexSet<SegmentTypes...>& iset,
+       LoopBody loop_body)
+{
+  return forall_impl(r,
+                     SegmentIterPolicy(),
+                     SegmentExecPolicy(),
+                     iset,
+                     std::move(loop_body));
+}
+
+/*!
+******************************************************************************
+*
+* \brief Execute segments of an index set with a dependency graph. Task
+*        graph segment iteration policies schedule segments by the graph,
+*        serial segment iteration runs them in index set order.
+*
+******************************************************************************
+*/
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename... SegmentTypes,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_taskgraph_segit_policy<SegmentIterPolicy>>
+forall_Icount(Res r,
+              ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+              const DepGraphIndexSet<SegmentTypes...>& iset,
+              LoopBody loop_body)
+{
+  return forall_Icount_impl(r,
+                            SegmentIterPolicy(),
+                            SegmentExecPolicy(),
+                            iset,
+                            std::move(loop_body));
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_taskgraph_segit_policy<SegmentIterPolicy>>
+forall(Res r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+       const DepGraphIndexSet<SegmentTypes...>& iset,
+       LoopBody loop_body)
+{
+  return forall_impl(r,
+                     SegmentIterPolicy(),
+                     SegmentExecPolicy(),
+                     iset,
+                     std::move(loop_body));
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename... SegmentTypes,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_taskgraph_segit_policy<SegmentIterPolicy>>>
+forall_Icount(Res r,
+              ExecPolicy<SegmentIterPolicy, SegmentExecPolicy> p,
+              const DepGraphIndexSet<SegmentTypes...>& iset,
+              LoopBody loop_body)
+{
+  static_assert(detail::is_serial_host_policy<SegmentIterPolicy>::value,
+                "An index set with a dependency graph requires a task graph "
+                "or sequential segment iteration policy");
+  return forall_Icount(r, p, iset.getIndexSet(), std::move(loop_body));
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_taskgraph_segit_policy<SegmentIterPolicy>>>
+forall(Res r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy> p,
+       const DepGraphIndexSet<SegmentTypes...>& iset,
+       LoopBody loop_body)
+{
+  static_assert(detail::is_serial_host_policy<SegmentIterPolicy>::value,
+                "An index set with a dependency graph requires a task graph "
+                "or sequential segment iteration policy");
+  return forall(r, p, iset.getIndexSet(), std::move(loop_body));
+}
+
 }  // end namespace wrap
 
 
@@ -277,11 +704,14 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                                                      IdxSet&& c,
                                                      LoopBody&& loop_body)
 {
-  static_assert(type_traits::is_index_set<IdxSet>::value,
+  static_assert(type_traits::is_index_set<IdxSet>::value ||
+                    type_traits::is_dep_graph_index_set<IdxSet>::value,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          util::KernelPattern::forall, nullptr, 0, r)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -297,6 +727,8 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
       std::forward<IdxSet>(c),
       std::move(body));
 
+  RAJA::detail::streaming_fence(r);
+
   util::callPostLaunchPlugins(context);
   return e;
 }
@@ -327,11 +759,14 @@ RAJA_INLINE concepts::enable_if_t<
     type_traits::is_indexset_policy<ExecutionPolicy>>
 forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
 {
-  static_assert(type_traits::is_index_set<IdxSet>::value,
+  static_assert(type_traits::is_index_set<IdxSet>::value ||
+                    type_traits::is_dep_graph_index_set<IdxSet>::value,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          util::KernelPattern::forall, nullptr, 0, r)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -347,6 +782,8 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
       std::forward<IdxSet>(c),
       std::move(body));
 
+  RAJA::detail::streaming_fence(r);
+
   util::callPostLaunchPlugins(context);
   return e;
 }
@@ -416,7 +853,9 @@ forall_Icount(ExecutionPolicy&& p,
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          util::KernelPattern::forall, nullptr, util::iteration_count(c), r)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -433,6 +872,8 @@ forall_Icount(ExecutionPolicy&& p,
       icount,
       std::move(body));
 
+  RAJA::detail::streaming_fence(r);
+
   util::callPostLaunchPlugins(context);
   return e;
 }
@@ -478,7 +919,9 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          util::KernelPattern::forall, nullptr, util::iteration_count(c), r)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -494,6 +937,8 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
       std::forward<Container>(c),
       std::move(body));
 
+  RAJA::detail::streaming_fence(r);
+
   util::callPostLaunchPlugins(context);
   return e;
 }
@@ -514,6 +959,177 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
       std::forward<LoopBody>(loop_body));
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with reduction parameters with a
+ *        value-based policy
+ *
+ *        The arguments after the container are one or more parameters made
+ *        with RAJA::expt::Reduce followed by the loop body. The loop body
+ *        takes the index followed by a reference to an accumulator for each
+ *        parameter.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename Param,
+          typename... Args>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    expt::detail::is_reduce_param<camp::decay<Param>>>
+forall(ExecutionPolicy&& p, Res r, Container&& c, Param&& param, Args&&... args)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+  static_assert(sizeof...(Args) > 0, "Expected a loop body");
+
+  auto args_tuple = camp::make_tuple(std::forward<Param>(param),
+                                     std::forward<Args>(args)...);
+  return detail::forall_param(std::forward<ExecutionPolicy>(p),
+                              r,
+                              std::forward<Container>(c),
+                              args_tuple,
+                              camp::make_idx_seq_t<sizeof...(Args)>{});
+}
+template <typename ExecutionPolicy,
+          typename Container,
+          typename Param,
+          typename... Args,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    expt::detail::is_reduce_param<camp::decay<Param>>>
+forall(ExecutionPolicy&& p, Container&& c, Param&& param, Args&&... args)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      std::forward<Param>(param),
+      std::forward<Args>(args)...);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a scheduling hint with a
+ *        value-based policy
+ *
+ *        The argument after the container is a hint made with
+ *        RAJA::expt::Grain or RAJA::expt::Cost, followed by the loop body.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename Hint,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    expt::detail::is_schedule_hint<camp::decay<Hint>>>
+forall(ExecutionPolicy&& p, Res r, Container&& c, Hint&& hint, LoopBody&& loop_body)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  return detail::forall_hint(std::forward<ExecutionPolicy>(p),
+                             r,
+                             std::forward<Container>(c),
+                             hint,
+                             std::forward<LoopBody>(loop_body));
+}
+template <typename ExecutionPolicy,
+          typename Container,
+          typename Hint,
+          typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    expt::detail::is_schedule_hint<camp::decay<Hint>>>
+forall(ExecutionPolicy&& p, Container&& c, Hint&& hint, LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      std::forward<Hint>(hint),
+      std::forward<LoopBody>(loop_body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a kernel name with a
+ *        value-based policy
+ *
+ *        The argument after the container is a RAJA::expt::KernelName,
+ *        followed by the loop body. The name labels the NVTX or roctx
+ *        range of the loop and is passed to plugins in the PluginContext.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename Name,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    expt::detail::is_kernel_name<camp::decay<Name>>>
+forall(ExecutionPolicy&& p, Res r, Container&& c, Name&& name, LoopBody&& loop_body)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  return detail::forall_named(std::forward<ExecutionPolicy>(p),
+                              r,
+                              std::forward<Container>(c),
+                              name,
+                              std::forward<LoopBody>(loop_body));
+}
+template <typename ExecutionPolicy,
+          typename Container,
+          typename Name,
+          typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    expt::detail::is_kernel_name<camp::decay<Name>>>
+forall(ExecutionPolicy&& p, Container&& c, Name&& name, LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      std::forward<Name>(name),
+      std::forward<LoopBody>(loop_body));
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -560,6 +1176,84 @@ forall_Icount(Res r, Args&&... args)
       ExecutionPolicy(), r, std::forward<Args>(args)...);
 }
 
+namespace expt
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Run several loop bodies over one iteration space as fused loops
+ *
+ *        The bodies between barriers form a group and run one after the
+ *        other for each index, so a body sees the writes of the bodies
+ *        before it in the group only at the same index. A
+ *        RAJA::expt::FuseBarrier between two bodies makes all iterations
+ *        of the bodies before it complete before any iteration of the
+ *        bodies after it:
+ *
+ *           forall_fused<omp_parallel_for_exec>(range,
+ *             [=](int i) { x[i] = a * x[i]; },
+ *             [=](int i) { y[i] += x[i]; },
+ *             expt::FuseBarrier{},
+ *             [=](int i) { z[i] = y[i - 1] + y[i + 1]; });
+ *
+ *        Each group is one loop, one kernel on a GPU. OpenMP parallel
+ *        policies run all the groups in one parallel region.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename... Bodies>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_resource<Res>,
+                                  type_traits::is_range<Container>>
+forall_fused(Res r, Container&& c, Bodies&&... bodies)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  util::PluginContext context{
+      util::make_context<ExecutionPolicy, camp::list<camp::decay<Bodies>...>>(
+          util::KernelPattern::forall, nullptr, util::iteration_count(c), r)};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto fused = camp::make_tuple(trigger_updates_before(bodies)...);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<Res> e = detail::forall_fused_unpack(
+      r,
+      ExecutionPolicy(),
+      std::forward<Container>(c),
+      fused,
+      camp::make_idx_seq_t<sizeof...(Bodies)>{});
+
+  RAJA::detail::streaming_fence(r);
+
+  util::callPostLaunchPlugins(context);
+  return e;
+}
+
+template <typename ExecutionPolicy,
+          typename Container,
+          typename... Bodies,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_range<Container>>
+forall_fused(Container&& c, Bodies&&... bodies)
+{
+  Res r = Res::get_default();
+  return ::RAJA::expt::forall_fused<ExecutionPolicy>(
+      r, std::forward<Container>(c), std::forward<Bodies>(bodies)...);
+}
+
+}  // namespace expt
+
 namespace detail
 {
 
@@ -569,10 +1263,10 @@ RAJA_INLINE camp::resources::EventProxy<Res> CallForall::operator()(T const& seg
                                                                LoopBody body,
                                                                Res r) const
 {
-  // this is only called inside a region, use impl
-  using policy::sequential::forall_impl;
+  // this is only called inside a region, go through wrap to run the runs
+  // of run list segments as ranges
   RAJA_FORCEINLINE_RECURSIVE
-  return forall_impl(r, ExecutionPolicy(), segment, body);
+  return wrap::forall(r, ExecutionPolicy(), segment, body);
 }
 
 constexpr CallForallIcount::CallForallIcount(int s) : start(s) {}
@@ -0,0 +1,75 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file declaring the recording and replay of the work
+ *          run on a resource as a graph.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_graph_HPP
+#define RAJA_pattern_graph_HPP
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Records the work launched on a resource, from its construction
+ *        until instantiate is called, instead of running it.
+ *
+ * A sequence of loops that runs many times with the same arguments can be
+ * recorded once and replayed with one launch per run:
+ *
+ * \code
+ *
+ * RAJA::resources::Cuda res;
+ * RAJA::expt::GraphRecorder<RAJA::resources::Cuda> rec(res);
+ * RAJA::forall<RAJA::cuda_exec_async<256>>(res, range, body0);
+ * RAJA::forall<RAJA::cuda_exec_async<256>>(res, range, body1);
+ * auto graph = rec.instantiate();
+ *
+ * for (int step = 0; step < num_steps; ++step) {
+ *   graph.launch();
+ * }
+ * res.wait();
+ *
+ * \endcode
+ *
+ * Only asynchronous policies may be used while recording, as the resource
+ * can not be synchronized until the recording ends. Reducers are not
+ * supported in recorded loops.
+ *
+ * \tparam Res resource type, specialized by the back-ends that support
+ *         graphs
+ *
+ * \see RAJA::expt::Graph
+ */
+template <typename Res>
+class GraphRecorder;
+
+/*!
+ * \brief An instantiated graph of recorded work, launched on a resource
+ *        each time launch is called.
+ *
+ * \see RAJA::expt::GraphRecorder
+ */
+template <typename Res>
+class Graph;
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_graph_HPP
@@ -0,0 +1,151 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_HPP
+#define RAJA_histogram_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/histogram.hpp"
+
+namespace RAJA
+{
+
+inline namespace policy_by_value_interface
+{
+
+/*!
+******************************************************************************
+*
+* \brief  histogram execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container, e.g. a Span of values or a
+*               RangeSegment of indices
+* \param[in,out] bins num_bins counts
+* \param[in] num_bins number of bins
+* \param[in] bin_of unary function giving the bin of a value of in
+*
+* Adds one to bins[bin_of(v)] for each value v of in; values whose bin is
+* not in [0, num_bins) are not counted. bins is in the memory space of the
+* execution policy, and is valid when the returned event completes.
+*
+* The bins are privatized and merged with one atomic per bin at the end,
+* per block in shared memory on gpus and per thread on the host, so values
+* that fall in the same few bins do not contend on atomics.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename CountT,
+          typename BinOp>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+histogram(ExecPolicy&& p,
+          Res r,
+          Container&& in,
+          CountT* bins,
+          Index_type num_bins,
+          BinOp bin_of)
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(std::is_arithmetic<CountT>::value,
+                "histogram counts must be arithmetic");
+
+  auto begin_it = begin(in);
+  const Index_type N = distance(begin_it, end(in));
+
+  if (N > 0 && num_bins > 0) {
+    return impl::histogram::count(r, std::forward<ExecPolicy>(p),
+                                  begin_it, N, bins, num_bins, bin_of);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename CountT,
+          typename BinOp,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+histogram(ExecPolicy&& p,
+          Container&& in,
+          CountT* bins,
+          Index_type num_bins,
+          BinOp bin_of)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::histogram(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(in),
+      bins,
+      num_bins,
+      bin_of);
+}
+
+}  // namespace policy_by_value_interface
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * histogram
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+histogram(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::histogram<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+histogram(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::histogram(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
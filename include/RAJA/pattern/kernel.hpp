@@ -27,6 +27,8 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include "RAJA/util/KernelName.hpp"
+#include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -82,6 +84,16 @@ RAJA_INLINE constexpr auto make_wrapped_tuple_impl(Tuple &&t,
               IndexType>{camp::get<I>(std::forward<Tuple>(t)).begin(),
                          camp::get<I>(std::forward<Tuple>(t)).end()}...);
 }
+
+//! product of the lengths of the segments, for the plugins
+template <class Tuple, camp::idx_t... I>
+RAJA_INLINE size_t segment_iterations(Tuple const &t, camp::idx_seq<I...>)
+{
+  size_t n = 1;
+  int expand[] = {0, (n *= util::iteration_count(camp::get<I>(t)), 0)...};
+  RAJA_UNUSED_VAR(expand);
+  return n;
+}
 }  // namespace internal
 
 template <class Tuple>
@@ -96,17 +108,30 @@ RAJA_INLINE constexpr auto make_wrapped_tuple(Tuple &&t)
 }
 
 
+namespace internal
+{
+
 template <typename PolicyType,
           typename SegmentTuple,
           typename ParamTuple,
           typename Resource,
           typename... Bodies>
-RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &&segments,
-                                                                  ParamTuple &&params,
-                                                                  Resource resource,
-                                                                  Bodies &&... bodies)
+RAJA_INLINE resources::EventProxy<Resource> kernel_named(
+    expt::KernelName const &name,
+    SegmentTuple &&segments,
+    ParamTuple &&params,
+    Resource resource,
+    Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  util::PluginContext context{
+      util::make_context<PolicyType, camp::list<camp::decay<Bodies>...>>(
+          util::KernelPattern::kernel,
+          name,
+          segment_iterations(
+              segments,
+              camp::make_idx_seq_t<
+                  camp::tuple_size<camp::decay<SegmentTuple>>::value>{}),
+          resource)};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -144,21 +169,53 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
   util::callPreLaunchPlugins(context);
 
   // Execute!
-  RAJA_FORCEINLINE_RECURSIVE
-  internal::execute_statement_list<PolicyType, loop_types_t>(loop_data);
+  {
+    util::ScopedKernelRange range(name.name);
+    RAJA_FORCEINLINE_RECURSIVE
+    internal::execute_statement_list<PolicyType, loop_types_t>(loop_data);
+  }
 
   util::callPostLaunchPlugins(context);
 
   return resources::EventProxy<Resource>(resource);
 }
 
+//! Excludes a RAJA::expt::KernelName from the unnamed overloads
+template <typename T, typename Ret>
+using enable_if_unnamed_t = concepts::enable_if_t<
+    Ret,
+    concepts::negate<expt::detail::is_kernel_name<camp::decay<T>>>>;
+
+}  // namespace internal
+
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename Resource,
+          typename... Bodies>
+RAJA_INLINE internal::enable_if_unnamed_t<SegmentTuple,
+                                          resources::EventProxy<Resource>>
+kernel_param_resource(SegmentTuple &&segments,
+                      ParamTuple &&params,
+                      Resource resource,
+                      Bodies &&... bodies)
+{
+  return internal::kernel_named<PolicyType>(expt::KernelName(nullptr),
+                                            std::forward<SegmentTuple>(segments),
+                                            std::forward<ParamTuple>(params),
+                                            resource,
+                                            std::forward<Bodies>(bodies)...);
+}
+
 template <typename PolicyType,
           typename SegmentTuple,
           typename Resource,
           typename... Bodies>
-RAJA_INLINE resources::EventProxy<Resource> kernel_resource(SegmentTuple &&segments,
-                                                            Resource resource,
-                                                            Bodies &&... bodies)
+RAJA_INLINE internal::enable_if_unnamed_t<SegmentTuple,
+                                          resources::EventProxy<Resource>>
+kernel_resource(SegmentTuple &&segments,
+                Resource resource,
+                Bodies &&... bodies)
 {
   return RAJA::kernel_param_resource<PolicyType>(std::forward<SegmentTuple>(segments),
                                                  RAJA::make_tuple(),
@@ -170,9 +227,12 @@ template <typename PolicyType,
           typename SegmentTuple,
           typename ParamTuple,
           typename... Bodies>
-RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> kernel_param(SegmentTuple &&segments,
-                                                                                           ParamTuple &&params,
-                                                                                           Bodies &&... bodies)
+RAJA_INLINE internal::enable_if_unnamed_t<
+    SegmentTuple,
+    resources::EventProxy<resources::resource_from_pol_t<PolicyType>>>
+kernel_param(SegmentTuple &&segments,
+             ParamTuple &&params,
+             Bodies &&... bodies)
 {
   auto res = resources::get_default_resource<PolicyType>();
   return RAJA::kernel_param_resource<PolicyType>(std::forward<SegmentTuple>(segments),
@@ -182,8 +242,11 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
 }
 
 template <typename PolicyType, typename SegmentTuple, typename... Bodies>
-RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> kernel(SegmentTuple &&segments,
-                                                                                     Bodies &&... bodies)
+RAJA_INLINE internal::enable_if_unnamed_t<
+    SegmentTuple,
+    resources::EventProxy<resources::resource_from_pol_t<PolicyType>>>
+kernel(SegmentTuple &&segments,
+       Bodies &&... bodies)
 {
   auto res = resources::get_default_resource<PolicyType>();
   return RAJA::kernel_param_resource<PolicyType>(std::forward<SegmentTuple>(segments),
@@ -192,6 +255,78 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
                                                  std::forward<Bodies>(bodies)...);
 }
 
+///
+/// Named versions of the kernel entry points. The RAJA::expt::KernelName
+/// labels the NVTX or roctx range of the kernel and is passed to plugins.
+///
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename Resource,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(
+    expt::KernelName const &name,
+    SegmentTuple &&segments,
+    ParamTuple &&params,
+    Resource resource,
+    Bodies &&... bodies)
+{
+  return internal::kernel_named<PolicyType>(name,
+                                            std::forward<SegmentTuple>(segments),
+                                            std::forward<ParamTuple>(params),
+                                            resource,
+                                            std::forward<Bodies>(bodies)...);
+}
+
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename Resource,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_resource(
+    expt::KernelName const &name,
+    SegmentTuple &&segments,
+    Resource resource,
+    Bodies &&... bodies)
+{
+  return internal::kernel_named<PolicyType>(name,
+                                            std::forward<SegmentTuple>(segments),
+                                            RAJA::make_tuple(),
+                                            resource,
+                                            std::forward<Bodies>(bodies)...);
+}
+
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>>
+kernel_param(expt::KernelName const &name,
+             SegmentTuple &&segments,
+             ParamTuple &&params,
+             Bodies &&... bodies)
+{
+  auto res = resources::get_default_resource<PolicyType>();
+  return internal::kernel_named<PolicyType>(name,
+                                            std::forward<SegmentTuple>(segments),
+                                            std::forward<ParamTuple>(params),
+                                            res,
+                                            std::forward<Bodies>(bodies)...);
+}
+
+template <typename PolicyType, typename SegmentTuple, typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>>
+kernel(expt::KernelName const &name,
+       SegmentTuple &&segments,
+       Bodies &&... bodies)
+{
+  auto res = resources::get_default_resource<PolicyType>();
+  return internal::kernel_named<PolicyType>(name,
+                                            std::forward<SegmentTuple>(segments),
+                                            RAJA::make_tuple(),
+                                            res,
+                                            std::forward<Bodies>(bodies)...);
+}
+
 
 }  // end namespace RAJA
 
@@ -200,14 +335,18 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
 #include "RAJA/pattern/kernel/Conditional.hpp"
 #include "RAJA/pattern/kernel/For.hpp"
 #include "RAJA/pattern/kernel/ForICount.hpp"
+#include "RAJA/pattern/kernel/ForRagged.hpp"
 #include "RAJA/pattern/kernel/Hyperplane.hpp"
 #include "RAJA/pattern/kernel/InitLocalMem.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
 #include "RAJA/pattern/kernel/Param.hpp"
+#include "RAJA/pattern/kernel/RecursiveTile.hpp"
 #include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/Region.hpp"
 #include "RAJA/pattern/kernel/Tile.hpp"
 #include "RAJA/pattern/kernel/TileTCount.hpp"
+#include "RAJA/pattern/kernel/TileTuner.hpp"
+#include "RAJA/pattern/kernel/KernelVariant.hpp"
 
 
 #endif /* RAJA_pattern_kernel_HPP */
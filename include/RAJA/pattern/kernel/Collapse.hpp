@@ -19,6 +19,12 @@
 #ifndef RAJA_pattern_kernel_Collapse_HPP
 #define RAJA_pattern_kernel_Collapse_HPP
 
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
 namespace RAJA
 {
 
@@ -34,6 +40,51 @@ struct Collapse : public internal::ForList,
 
 
 }  // namespace statement
+
+namespace internal
+{
+
+/*!
+ * Whether an iterator of a kernel segment steps through consecutive
+ * values.
+ */
+template <typename Iterator>
+struct is_unit_stride_iterator : std::false_type {
+};
+
+template <typename Type, typename DifferenceType, typename PointerType>
+struct is_unit_stride_iterator<
+    Iterators::numeric_iterator<Type, DifferenceType, PointerType>>
+    : std::true_type {
+};
+
+template <typename Type>
+struct is_unit_stride_iterator<Type*> : std::true_type {
+};
+
+template <camp::idx_t... Args>
+constexpr camp::idx_t collapse_inner_arg()
+{
+  camp::idx_t const args[] = {Args...};
+  return args[sizeof...(Args) - 1];
+}
+
+/*!
+ * Whether the innermost loop of a statement::Collapse over ArgList runs
+ * over consecutive values, so its iterations are unit stride in the
+ * arrays it indexes and the compiler can vectorize it.
+ */
+template <typename ArgList, typename Data>
+struct collapse_inner_unit_stride;
+
+template <camp::idx_t... Args, typename Data>
+struct collapse_inner_unit_stride<camp::idx_seq<Args...>, Data>
+    : is_unit_stride_iterator<typename camp::at_v<
+          typename camp::decay<Data>::segment_tuple_t::TList,
+          collapse_inner_arg<Args...>()>::iterator> {
+};
+
+}  // namespace internal
 }  // end namespace RAJA
 
 
@@ -40,6 +40,21 @@ template <typename Condition, typename... EnclosedStmts>
 struct If : public internal::Statement<camp::nil, EnclosedStmts...> {
 };
 
+/*!
+ * A RAJA::kernel statement that implements conditional control logic for a
+ * condition with the same value on all threads of a block, such as one that
+ * only depends on Params.
+ *
+ * On the device the condition is evaluated by the first thread of the block
+ * and broadcast to the others, so the enclosed statements are skipped by
+ * the whole block and may synchronize the block. Every thread of the block
+ * must reach the statement. Elsewhere it is the same as If.
+ *
+ */
+template <typename Condition, typename... EnclosedStmts>
+struct IfUniform : public internal::Statement<camp::nil, EnclosedStmts...> {
+};
+
 
 /*!
  * An expression that returns a compile time literal value.
@@ -211,6 +226,13 @@ struct StatementExecutor<statement::If<Condition, EnclosedStmts...>, Types> {
 };
 
 
+template <typename Condition, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::IfUniform<Condition, EnclosedStmts...>,
+                         Types>
+    : StatementExecutor<statement::If<Condition, EnclosedStmts...>, Types> {
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
@@ -23,6 +23,8 @@
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/index/StaticRangeSegment.hpp"
+
 #include "RAJA/pattern/kernel/internal.hpp"
 
 namespace RAJA
@@ -107,6 +109,32 @@ struct StatementExecutor<
   }
 };
 
+/*!
+ * Sequential loop over the offsets [0, len) of a segment of a kernel
+ */
+template <typename Segment, typename LenT, typename Wrapper>
+RAJA_INLINE void seq_for_offsets(Segment const &, LenT len, Wrapper &for_wrapper)
+{
+  RAJA_EXTRACT_BED_IT(TypedRangeSegment<LenT>(0, len));
+
+  RAJA_NO_SIMD
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    for_wrapper(*(begin_it + i));
+  }
+}
+
+/*!
+ * The offsets of a segment with compile time bounds are unrolled
+ */
+template <typename T, T Begin, T End, typename LenT, typename Wrapper>
+RAJA_INLINE void seq_for_offsets(TypedStaticRangeSegment<T, Begin, End> const &,
+                                 LenT,
+                                 Wrapper &for_wrapper)
+{
+  static_for_each(TypedStaticRangeSegment<LenT, 0, static_cast<LenT>(End - Begin)>{},
+                  for_wrapper);
+}
+
 /*!
  * A generic RAJA::kernel forall_impl executor for statement::For
  *
@@ -130,14 +158,8 @@ struct StatementExecutor<
     ForWrapper<ArgumentId, Data, NewTypes, EnclosedStmts...> for_wrapper(data);
 
     auto len = segment_length<ArgumentId>(data);
-    using len_t = decltype(len);
-
-    RAJA_EXTRACT_BED_IT(TypedRangeSegment<len_t>(0, len));
 
-    RAJA_NO_SIMD
-    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-      for_wrapper(*(begin_it + i));
-    }
+    seq_for_offsets(camp::get<ArgumentId>(data.segment_tuple), len, for_wrapper);
   }
 };
 
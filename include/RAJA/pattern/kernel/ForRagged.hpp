@@ -0,0 +1,129 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the kernel loop over the positions of a row of a
+ *          ragged segment.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_ForRagged_HPP
+#define RAJA_pattern_kernel_ForRagged_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/index/RaggedSegment.hpp"
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that loops over the positions of one row of a
+ * ragged segment.
+ * Segment ArgumentId is a TypedRaggedSegment, and the row is the current
+ * index of argument RowArgumentId, which an enclosing loop assigns.
+ * Assigns each position of the row to argument ArgumentId, so lambdas get
+ * the index at that position:
+ *
+ *   // for each element e, for each neighbor n of e
+ *   using pol = KernelPolicy<
+ *     statement::For<0, loop_exec,
+ *       statement::ForRagged<1, 0, seq_exec, statement::Lambda<0>>>>;
+ *
+ *   kernel<pol>(make_tuple(RangeSegment(0, num_elems), nbrs),
+ *               [=](Index_type e, Index_type n) { ... });
+ *
+ * Inside CUDA and HIP kernels seq_exec maps a row to each thread, and
+ * cuda/hip_warp_loop a row to each warp, with the lanes striding over it.
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t RowArgumentId,
+          typename ExecPolicy = camp::nil,
+          typename... EnclosedStmts>
+struct ForRagged : public internal::ForList,
+                   public internal::ForTraitBase<ArgumentId, ExecPolicy>,
+                   public internal::Statement<ExecPolicy, EnclosedStmts...> {
+
+  using execution_policy_t = ExecPolicy;
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+/*!
+ * The positions of the row of the ragged segment ArgumentId given by the
+ * current index of argument RowArgumentId
+ */
+template <camp::idx_t ArgumentId, camp::idx_t RowArgumentId, typename Data>
+RAJA_INLINE RAJA_HOST_DEVICE auto ragged_row_segment(Data const &data)
+    -> decltype(camp::get<ArgumentId>(data.segment_tuple).row(0))
+{
+  auto const &rows = camp::get<RowArgumentId>(data.segment_tuple);
+  auto row = RAJA::stripIndexType(
+      rows.begin()[camp::get<RowArgumentId>(data.offset_tuple)]);
+  return camp::get<ArgumentId>(data.segment_tuple).row(row);
+}
+
+
+/*!
+ * A generic RAJA::kernel forall_impl executor for statement::ForRagged
+ *
+ *
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t RowArgumentId,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::ForRagged<ArgumentId, RowArgumentId, ExecPolicy, EnclosedStmts...>,
+    Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+    // Create a wrapper, just in case forall_impl needs to thread_privatize
+    ForWrapper<ArgumentId, Data, NewTypes, EnclosedStmts...> for_wrapper(data);
+
+    // the offsets of ArgumentId are the positions of the row
+    auto positions = ragged_row_segment<ArgumentId, RowArgumentId>(data);
+
+    auto r = data.res;
+
+    forall_impl(r, ExecPolicy{}, positions, for_wrapper);
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_ForRagged_HPP */
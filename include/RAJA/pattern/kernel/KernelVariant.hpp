@@ -0,0 +1,286 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for running a RAJA::kernel with one of a list of
+ *          policies chosen at run time.
+ *
+ *          Each policy in the list is instantiated once for the kernel
+ *          bodies, and the one to run is chosen by an index:
+ *
+ *             using POLS = camp::list<
+ *                 KernelPolicy<
+ *                   statement::CudaKernel<
+ *                     statement::For<1, cuda_block_x_loop,
+ *                       statement::For<0, cuda_thread_x_loop,
+ *                         statement::Lambda<0> > > > >,
+ *                 KernelPolicy<
+ *                   statement::CudaKernel<
+ *                     statement::For<1, cuda_thread_y_direct,
+ *                       statement::For<0, cuda_thread_x_direct,
+ *                         statement::Lambda<0> > > > > >;
+ *
+ *             expt::kernel_variant<POLS>(variant, make_tuple(cols, rows),
+ *                                        [=] RAJA_DEVICE (int c, int r) {...});
+ *
+ *          or by timing each of them with kernel_variant_tuned, which keeps
+ *          its choice in a TileTuningCache.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_KernelVariant_HPP
+#define RAJA_pattern_kernel_KernelVariant_HPP
+
+#include "RAJA/config.hpp"
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/pattern/kernel/TileTuner.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+//! First policy of PolicyList, which gives the default resource
+template <typename PolicyList>
+using first_variant_t = typename camp::at<PolicyList, camp::num<0>>::type;
+
+//! Run the kernel with policy variant of PolicyList
+template <typename PolicyList>
+struct kernel_variant_invoker;
+
+template <typename PolicyType, typename... Rest>
+struct kernel_variant_invoker<camp::list<PolicyType, Rest...>> {
+
+  template <typename SegmentTuple,
+            typename ParamTuple,
+            typename Resource,
+            typename... Bodies>
+  static RAJA_INLINE resources::EventProxy<Resource> invoke(
+      int variant,
+      SegmentTuple&& segments,
+      ParamTuple&& params,
+      Resource resource,
+      Bodies&&... bodies)
+  {
+    if (variant == 0) {
+      return RAJA::kernel_param_resource<PolicyType>(
+          std::forward<SegmentTuple>(segments),
+          std::forward<ParamTuple>(params),
+          resource,
+          std::forward<Bodies>(bodies)...);
+    }
+    return kernel_variant_invoker<camp::list<Rest...>>::invoke(
+        variant - 1,
+        std::forward<SegmentTuple>(segments),
+        std::forward<ParamTuple>(params),
+        resource,
+        std::forward<Bodies>(bodies)...);
+  }
+};
+
+template <>
+struct kernel_variant_invoker<camp::list<>> {
+
+  template <typename SegmentTuple,
+            typename ParamTuple,
+            typename Resource,
+            typename... Bodies>
+  static RAJA_INLINE resources::EventProxy<Resource> invoke(int,
+                                                            SegmentTuple&&,
+                                                            ParamTuple&&,
+                                                            Resource resource,
+                                                            Bodies&&...)
+  {
+    RAJA_ABORT_OR_THROW("kernel_variant: variant index out of range");
+    return resources::EventProxy<Resource>(resource);
+  }
+};
+
+//! Time fn, waiting on resource before and after it
+template <typename Resource, typename Fn>
+RAJA_INLINE double time_variant(Resource& resource, Fn&& fn)
+{
+  resource.wait();
+  const auto start = std::chrono::steady_clock::now();
+  fn();
+  resource.wait();
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Run a kernel with policy number variant of PolicyList, a
+ *        camp::list of kernel policies.
+ *
+ * All the policies must run on the type of Resource. An index that is not
+ * in the list is an error.
+ */
+template <typename PolicyList,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename Resource,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_variant_resource(
+    int variant,
+    SegmentTuple&& segments,
+    ParamTuple&& params,
+    Resource resource,
+    Bodies&&... bodies)
+{
+  return detail::kernel_variant_invoker<PolicyList>::invoke(
+      variant,
+      std::forward<SegmentTuple>(segments),
+      std::forward<ParamTuple>(params),
+      resource,
+      std::forward<Bodies>(bodies)...);
+}
+
+/*!
+ * \brief Run a kernel with parameters and policy number variant of
+ *        PolicyList on the default resource of its first policy.
+ */
+template <typename PolicyList,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<
+    resources::resource_from_pol_t<detail::first_variant_t<PolicyList>>>
+kernel_param_variant(int variant,
+                     SegmentTuple&& segments,
+                     ParamTuple&& params,
+                     Bodies&&... bodies)
+{
+  auto res = resources::get_default_resource<detail::first_variant_t<PolicyList>>();
+  return kernel_variant_resource<PolicyList>(variant,
+                                             std::forward<SegmentTuple>(segments),
+                                             std::forward<ParamTuple>(params),
+                                             res,
+                                             std::forward<Bodies>(bodies)...);
+}
+
+/*!
+ * \brief Run a kernel with policy number variant of PolicyList on the
+ *        default resource of its first policy.
+ */
+template <typename PolicyList, typename SegmentTuple, typename... Bodies>
+RAJA_INLINE resources::EventProxy<
+    resources::resource_from_pol_t<detail::first_variant_t<PolicyList>>>
+kernel_variant(int variant, SegmentTuple&& segments, Bodies&&... bodies)
+{
+  auto res = resources::get_default_resource<detail::first_variant_t<PolicyList>>();
+  return kernel_variant_resource<PolicyList>(variant,
+                                             std::forward<SegmentTuple>(segments),
+                                             RAJA::make_tuple(),
+                                             res,
+                                             std::forward<Bodies>(bodies)...);
+}
+
+/*!
+ * \brief Run a kernel with the policy variant chosen for it by cache,
+ *        timing each variant in turn until they are all timed.
+ *
+ * The choice is keyed by name and the segment lengths, like the tile sizes
+ * chosen by kernel_tuned, and is saved and loaded with them.
+ */
+template <typename PolicyList,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename Resource,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_variant_tuned_resource(
+    TileTuningCache& cache,
+    std::string const& name,
+    SegmentTuple&& segments,
+    ParamTuple&& params,
+    Resource resource,
+    Bodies&&... bodies)
+{
+  constexpr int num_variants = camp::size<PolicyList>::value;
+
+  const std::string key = detail::tile_tuning_key(
+      name + "#variant",
+      segments,
+      camp::make_idx_seq_t<camp::tuple_size<camp::decay<SegmentTuple>>::value>{});
+
+  std::vector<camp::idx_t> const* chosen = cache.find(key);
+  if (chosen != nullptr && chosen->size() == 1) {
+    return kernel_variant_resource<PolicyList>(
+        static_cast<int>((*chosen)[0]),
+        std::forward<SegmentTuple>(segments),
+        std::forward<ParamTuple>(params),
+        resource,
+        std::forward<Bodies>(bodies)...);
+  }
+
+  const int trial = cache.nextTrial(key, num_variants);
+
+  const double seconds = detail::time_variant(resource, [&]() {
+    kernel_variant_resource<PolicyList>(trial,
+                                        std::forward<SegmentTuple>(segments),
+                                        std::forward<ParamTuple>(params),
+                                        resource,
+                                        std::forward<Bodies>(bodies)...);
+  });
+
+  cache.recordTrial(key,
+                    num_variants,
+                    std::vector<camp::idx_t>{static_cast<camp::idx_t>(trial)},
+                    seconds);
+  return resources::EventProxy<Resource>(resource);
+}
+
+/*!
+ * \brief Run a tuned kernel variant on the default resource of the first
+ *        policy of PolicyList.
+ */
+template <typename PolicyList, typename SegmentTuple, typename... Bodies>
+RAJA_INLINE resources::EventProxy<
+    resources::resource_from_pol_t<detail::first_variant_t<PolicyList>>>
+kernel_variant_tuned(TileTuningCache& cache,
+                     std::string const& name,
+                     SegmentTuple&& segments,
+                     Bodies&&... bodies)
+{
+  auto res = resources::get_default_resource<detail::first_variant_t<PolicyList>>();
+  return kernel_variant_tuned_resource<PolicyList>(
+      cache,
+      name,
+      std::forward<SegmentTuple>(segments),
+      RAJA::make_tuple(),
+      res,
+      std::forward<Bodies>(bodies)...);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif /* RAJA_pattern_kernel_KernelVariant_HPP */
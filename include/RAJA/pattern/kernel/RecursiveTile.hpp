@@ -0,0 +1,190 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for kernel recursive (cache-oblivious) tiling
+ *          statement.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_RecursiveTile_HPP
+#define RAJA_pattern_kernel_RecursiveTile_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/concepts.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that tiles several segments by recursive
+ * bisection.
+ *
+ * The largest of the segments in ArgList is split in halves, and each half
+ * is tiled the same way in turn, until no segment is longer than the base
+ * size given by TilePolicy (tile_fixed<N>, or tile_dynamic<P> to read a
+ * TileSize from parameter P). The enclosed statements then run over the
+ * tile, as for statement::Tile.
+ *
+ * The tiles are visited in the order of a cache-oblivious traversal, so
+ * the halves stay in each level of the cache hierarchy once they are small
+ * enough to fit, whatever the cache sizes are. The base size only needs to
+ * be large enough to hide the cost of the recursion, and to keep the inner
+ * loops long enough to vectorize.
+ *
+ * The recursion runs sequentially on the host, the enclosed statements may
+ * use any CPU policy:
+ *
+ *   RecursiveTile<ArgList<0, 1>, tile_fixed<16>,
+ *     For<1, loop_exec,
+ *       For<0, loop_exec,
+ *         Lambda<0>
+ *       >
+ *     >
+ *   >
+ *
+ */
+template <typename ArgList, typename TilePolicy, typename... EnclosedStmts>
+struct RecursiveTile
+    : public internal::Statement<camp::nil, EnclosedStmts...> {
+  using tile_policy_t = TilePolicy;
+};
+
+}  // end namespace statement
+
+namespace internal
+{
+
+template <typename TilePolicy>
+struct RecursiveTileBaseSize;
+
+template <camp::idx_t ChunkSize>
+struct RecursiveTileBaseSize<tile_fixed<ChunkSize>> {
+  template <typename Data>
+  static RAJA_INLINE camp::idx_t get(Data const &)
+  {
+    return ChunkSize;
+  }
+};
+
+template <camp::idx_t ParamId>
+struct RecursiveTileBaseSize<tile_dynamic<ParamId>> {
+  template <typename Data>
+  static RAJA_INLINE camp::idx_t get(Data const &data)
+  {
+    auto const &tile_size = camp::get<ParamId>(data.param_tuple);
+    static_assert(camp::concepts::metalib::is_same<
+                      TileSize,
+                      camp::decay<decltype(tile_size)>>::value,
+                  "Extracted parameter must be of type TileSize.");
+    return tile_size.size;
+  }
+};
+
+
+template <typename ArgList, typename... EnclosedStmts>
+struct RecursiveTiler;
+
+template <camp::idx_t... Args, typename... EnclosedStmts>
+struct RecursiveTiler<ArgList<Args...>, EnclosedStmts...> {
+
+  static constexpr camp::idx_t num_args = sizeof...(Args);
+
+  static_assert(num_args > 0, "RecursiveTile needs at least one argument");
+
+  template <typename Types, typename Data>
+  static RAJA_INLINE void tile(Data &data, camp::idx_t base_size)
+  {
+    camp::idx_t const lengths[num_args] = {
+        static_cast<camp::idx_t>(segment_length<Args>(data))...};
+
+    camp::idx_t largest = 0;
+    for (camp::idx_t a = 1; a < num_args; ++a) {
+      if (lengths[a] > lengths[largest]) {
+        largest = a;
+      }
+    }
+
+    if (lengths[largest] <= base_size) {
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+      return;
+    }
+
+    // split the segment in position largest of ArgList
+    camp::idx_t pos = 0;
+    int unused[] = {0,
+                    (pos++ == largest
+                         ? (split<Args, Types>(data, base_size), 0)
+                         : 0)...};
+    (void)unused;
+  }
+
+  template <camp::idx_t ArgumentId, typename Types, typename Data>
+  static RAJA_INLINE void split(Data &data, camp::idx_t base_size)
+  {
+    auto const segment = camp::get<ArgumentId>(data.segment_tuple);
+    auto const len = segment.end() - segment.begin();
+    auto const half = len / 2;
+
+    camp::get<ArgumentId>(data.segment_tuple) = segment.slice(0, half);
+    tile<Types>(data, base_size);
+
+    camp::get<ArgumentId>(data.segment_tuple) =
+        segment.slice(half, len - half);
+    tile<Types>(data, base_size);
+
+    camp::get<ArgumentId>(data.segment_tuple) = segment;
+  }
+};
+
+
+/*!
+ * A generic RAJA::kernel executor for statement::RecursiveTile
+ *
+ */
+template <typename ArgList,
+          typename TilePolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::RecursiveTile<ArgList, TilePolicy, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    camp::idx_t base_size = RecursiveTileBaseSize<TilePolicy>::get(data);
+    if (base_size < 1) {
+      base_size = 1;
+    }
+
+    RecursiveTiler<ArgList, EnclosedStmts...>::template tile<Types>(
+        data, base_size);
+  }
+};
+
+}  // end namespace internal
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_RecursiveTile_HPP */
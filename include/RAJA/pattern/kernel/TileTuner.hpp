@@ -0,0 +1,265 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the RAJA::kernel tile size tuner.
+ *
+ *          A tuned kernel runs its first invocations with each candidate set
+ *          of tile sizes, times them, and uses the fastest from then on:
+ *
+ *             using POL = KernelPolicy<
+ *                 statement::Tile<1, tile_dynamic<1>, seq_exec,
+ *                   statement::Tile<0, tile_dynamic<0>, seq_exec,
+ *                     statement::For<1, seq_exec,
+ *                       statement::For<0, seq_exec,
+ *                         statement::Lambda<0, Segs<0, 1>> > > > > >;
+ *
+ *             expt::TileTuningCache cache;
+ *             cache.load("tiles.txt");
+ *
+ *             std::vector<std::array<camp::idx_t, 2>> candidates{
+ *                 {{16, 16}}, {{32, 8}}, {{64, 4}}};
+ *
+ *             expt::kernel_tuned<POL>(cache, "transpose",
+ *                                     make_tuple(cols, rows), candidates,
+ *                                     [=](int c, int r) { ... });
+ *
+ *             cache.save("tiles.txt");
+ *
+ *          Candidate sizes are passed to the kernel as the TileSize
+ *          parameters 0, 1, ... read by the tile_dynamic statements.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_TileTuner_HPP
+#define RAJA_pattern_kernel_TileTuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/pattern/kernel/Tile.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Tile sizes chosen for tuned kernels, keyed by kernel name and
+ *         segment lengths.
+ *
+ *         Each candidate is timed trials times, in turn, before the fastest
+ *         is chosen. Chosen sizes may be saved to a text file and loaded
+ *         in a later run, which then skips the trial runs. The cache is
+ *         not thread safe.
+ *
+ ******************************************************************************
+ */
+class TileTuningCache
+{
+public:
+  explicit RAJASHAREDDLL_API TileTuningCache(int trials = 1);
+
+  //! Tile sizes chosen for key, nullptr if the key is not tuned yet
+  RAJASHAREDDLL_API const std::vector<camp::idx_t>* find(
+      std::string const& key) const;
+
+  //! Candidate for the next trial run of key
+  RAJASHAREDDLL_API int nextTrial(std::string const& key,
+                                  int num_candidates);
+
+  //! Record a trial run, the fastest sizes are chosen after the last trial
+  RAJASHAREDDLL_API void recordTrial(std::string const& key,
+                                     int num_candidates,
+                                     std::vector<camp::idx_t> const& sizes,
+                                     double seconds);
+
+  //! Choose sizes for key without trials
+  RAJASHAREDDLL_API void insert(std::string const& key,
+                                std::vector<camp::idx_t> const& sizes);
+
+  //! Add the sizes chosen in a file written by save, false if not readable
+  RAJASHAREDDLL_API bool load(std::string const& filename);
+
+  //! Write the chosen sizes, false if the file can not be written
+  RAJASHAREDDLL_API bool save(std::string const& filename) const;
+
+  RAJASHAREDDLL_API void clear();
+
+  //! Number of tuned keys
+  size_t size() const { return m_chosen.size(); }
+
+private:
+  struct Trials {
+    int runs;
+    double best_seconds;
+    std::vector<camp::idx_t> best_sizes;
+  };
+
+  int m_trials;
+  std::map<std::string, std::vector<camp::idx_t>> m_chosen;
+  std::map<std::string, Trials> m_tuning;
+};
+
+namespace detail
+{
+
+//! Key of a kernel, its name and the lengths of its segments
+template <typename SegmentTuple, camp::idx_t... Is>
+std::string tile_tuning_key(std::string const& name,
+                            SegmentTuple const& segments,
+                            camp::idx_seq<Is...>)
+{
+  std::ostringstream os;
+  os << name;
+  int unused[] = {0,
+                  ((os << (Is == 0 ? ':' : 'x')
+                       << (camp::get<Is>(segments).end() -
+                           camp::get<Is>(segments).begin())),
+                   0)...};
+  (void)unused;
+  return os.str();
+}
+
+//! Run the kernel with TileSize parameters from sizes
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename Resource,
+          camp::idx_t... Is,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_tile_sizes(
+    SegmentTuple&& segments,
+    camp::idx_t const* sizes,
+    camp::idx_seq<Is...>,
+    Resource resource,
+    Bodies&&... bodies)
+{
+  return RAJA::kernel_param_resource<PolicyType>(
+      std::forward<SegmentTuple>(segments),
+      RAJA::make_tuple(TileSize{sizes[Is]}...),
+      resource,
+      std::forward<Bodies>(bodies)...);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Run a kernel with the tile sizes chosen for it by cache, trying
+ *        candidates until they are all timed.
+ *
+ * Trial runs wait on the resource before and after the kernel so they
+ * time the kernel alone.
+ */
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename Resource,
+          size_t NumTiles,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Resource> kernel_tuned_resource(
+    TileTuningCache& cache,
+    std::string const& name,
+    SegmentTuple&& segments,
+    std::vector<std::array<camp::idx_t, NumTiles>> const& candidates,
+    Resource resource,
+    Bodies&&... bodies)
+{
+  using tile_seq = camp::make_idx_seq_t<NumTiles>;
+
+  const std::string key = detail::tile_tuning_key(
+      name,
+      segments,
+      camp::make_idx_seq_t<camp::tuple_size<camp::decay<SegmentTuple>>::value>{});
+
+  std::vector<camp::idx_t> const* chosen = cache.find(key);
+  if (chosen != nullptr && chosen->size() == NumTiles) {
+    return detail::kernel_tile_sizes<PolicyType>(
+        std::forward<SegmentTuple>(segments),
+        chosen->data(),
+        tile_seq{},
+        resource,
+        std::forward<Bodies>(bodies)...);
+  }
+
+  if (candidates.empty()) {
+    RAJA_ABORT_OR_THROW("kernel_tuned needs at least one candidate");
+  }
+
+  const int num_candidates = static_cast<int>(candidates.size());
+  std::array<camp::idx_t, NumTiles> const& trial =
+      candidates[cache.nextTrial(key, num_candidates)];
+
+  resource.wait();
+  const auto start = std::chrono::steady_clock::now();
+
+  resources::EventProxy<Resource> e =
+      detail::kernel_tile_sizes<PolicyType>(std::forward<SegmentTuple>(segments),
+                                            trial.data(),
+                                            tile_seq{},
+                                            resource,
+                                            std::forward<Bodies>(bodies)...);
+
+  resource.wait();
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  cache.recordTrial(key,
+                    num_candidates,
+                    std::vector<camp::idx_t>(trial.begin(), trial.end()),
+                    elapsed.count());
+  return e;
+}
+
+/*!
+ * \brief Run a tuned kernel on the default resource of the policy.
+ */
+template <typename PolicyType,
+          typename SegmentTuple,
+          size_t NumTiles,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>>
+kernel_tuned(TileTuningCache& cache,
+             std::string const& name,
+             SegmentTuple&& segments,
+             std::vector<std::array<camp::idx_t, NumTiles>> const& candidates,
+             Bodies&&... bodies)
+{
+  auto res = resources::get_default_resource<PolicyType>();
+  return kernel_tuned_resource<PolicyType>(cache,
+                                           name,
+                                           std::forward<SegmentTuple>(segments),
+                                           candidates,
+                                           res,
+                                           std::forward<Bodies>(bodies)...);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif /* RAJA_pattern_kernel_TileTuner_HPP */
@@ -102,6 +102,16 @@ using index_types_from_segments =
 
 
 
+/*!
+ * Resource of the LoopData made in device kernels, which have no use for
+ * the resource the kernel was launched on.
+ */
+struct DeviceLoopResource {
+};
+
+template <typename Data>
+struct LoopDataArgs;
+
 template <typename SegmentTuple,
           typename ParamTuple,
           typename Resource,
@@ -143,6 +153,14 @@ struct LoopData {
       : segment_tuple(s), param_tuple(p), res(r), bodies(b...)
   {
   }
+  //! LoopData of a device kernel made from its arguments
+  template <typename HostData>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr explicit
+  LoopData(LoopDataArgs<HostData> const &a)
+      : segment_tuple(a.segment_tuple), param_tuple(a.param_tuple),
+        res(a.device_res), bodies(a.bodies)
+  {
+  }
   constexpr LoopData(LoopData const &) = default;
   constexpr LoopData(LoopData &&) = default;
 
@@ -178,6 +196,37 @@ struct LoopData {
 
 
 
+/*!
+ * The parts of a LoopData passed to a device kernel as its argument: the
+ * segments, params and bodies. The offsets and vector sizes are set in the
+ * kernel and the resource is only used on the host, so leaving them out
+ * keeps deep nests within the kernel parameter limit. The kernel runs its
+ * statements on a data_t made from the arguments, whose resource is
+ * device_res.
+ */
+template <typename SegmentTuple,
+          typename ParamTuple,
+          typename Resource,
+          typename... Bodies>
+struct LoopDataArgs<LoopData<SegmentTuple, ParamTuple, Resource, Bodies...>> {
+
+  using data_t =
+      LoopData<SegmentTuple, ParamTuple, DeviceLoopResource, Bodies...>;
+
+  SegmentTuple segment_tuple;
+  ParamTuple param_tuple;
+  camp::tuple<Bodies...> bodies;
+  DeviceLoopResource device_res;
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr explicit LoopDataArgs(
+      LoopData<SegmentTuple, ParamTuple, Resource, Bodies...> const &d)
+      : segment_tuple(d.segment_tuple), param_tuple(d.param_tuple),
+        bodies(d.bodies)
+  {
+  }
+};
+
+
 
 template <camp::idx_t ArgumentId, typename Data>
 using segment_diff_type =
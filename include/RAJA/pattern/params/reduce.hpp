@@ -0,0 +1,325 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing reduction parameters for forall.
+ *
+ *          A reduction parameter is passed to forall between the iteration
+ *          space and the loop body:
+ *
+ *             double sum = 0.0;
+ *             forall<exec_policy>(range,
+ *                                 expt::Reduce<operators::plus>(&sum),
+ *                                 [=](int i, double& s) { s += x[i]; });
+ *
+ *          The loop body receives a reference to an accumulator for each
+ *          parameter. The accumulators are combined with the value in the
+ *          target when the loop completes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_params_reduce_HPP
+#define RAJA_pattern_params_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Target and combining operator of a reduction parameter.
+ */
+template <typename Op, typename T>
+struct ReduceParam {
+  using op_type = Op;
+  using value_type = T;
+
+  T* target;
+
+  RAJA_HOST_DEVICE
+  static constexpr T identity() { return Op::identity(); }
+
+  //! combine a partial result into the target
+  void combine(T const& val) const { *target = Op{}(*target, val); }
+
+  //! combine the partial results of several vector lanes into the target
+  template <size_t N>
+  void combine(RAJA::reduce::array_value<T, N> const& vals) const
+  {
+    for (size_t l = 0; l < N; ++l) {
+      combine(vals[l]);
+    }
+  }
+};
+
+template <typename T>
+struct is_reduce_param : std::false_type {
+};
+
+template <typename Op, typename T>
+struct is_reduce_param<ReduceParam<Op, T>> : std::true_type {
+};
+
+//! one accumulator per parameter
+template <typename... Params>
+using param_values = camp::tuple<typename Params::value_type...>;
+
+//! one accumulator per parameter and vector lane
+template <size_t Lanes, typename... Params>
+using param_lane_values =
+    camp::tuple<RAJA::reduce::array_value<typename Params::value_type,
+                                          Lanes>...>;
+
+template <typename... Params>
+RAJA_INLINE param_values<Params...> make_param_values(
+    camp::tuple<Params...> const&)
+{
+  return param_values<Params...>(Params::identity()...);
+}
+
+template <size_t Lanes, typename... Params>
+RAJA_INLINE param_lane_values<Lanes, Params...> make_param_lane_values(
+    camp::tuple<Params...> const&)
+{
+  return param_lane_values<Lanes, Params...>(
+      RAJA::reduce::array_value<typename Params::value_type, Lanes>(
+          Params::identity())...);
+}
+
+template <typename Params, typename Values, camp::idx_t... Is>
+RAJA_INLINE void combine_params(Params const& params,
+                                Values const& vals,
+                                camp::idx_seq<Is...>)
+{
+  camp::sink((camp::get<Is>(params).combine(camp::get<Is>(vals)), 0)...);
+}
+
+//! combine accumulators into the targets of the parameters
+template <typename... Params, typename Values>
+RAJA_INLINE void combine_params(camp::tuple<Params...> const& params,
+                                Values const& vals)
+{
+  combine_params(params, vals, camp::make_idx_seq_t<sizeof...(Params)>{});
+}
+
+/*!
+ * \brief Loop body adapter passing the accumulators to the loop body.
+ *
+ * The accumulators live in the frame of the launching function, so with
+ * the loop inlined they are kept in registers.
+ */
+template <typename Body, typename Values, typename Seq>
+struct ParamBody;
+
+template <typename Body, typename Values, camp::idx_t... Is>
+struct ParamBody<Body, Values, camp::idx_seq<Is...>> {
+  Body body;
+  Values* vals;
+
+  template <typename Idx>
+  RAJA_INLINE void operator()(Idx&& i) const
+  {
+    body(std::forward<Idx>(i), camp::get<Is>(*vals)...);
+  }
+
+  //! pass the accumulators of a single vector lane
+  template <typename Idx>
+  RAJA_INLINE void operator()(Idx&& i, int lane) const
+  {
+    body(std::forward<Idx>(i), camp::get<Is>(*vals)[lane]...);
+  }
+};
+
+template <typename Body, typename... Values>
+RAJA_INLINE ParamBody<camp::decay<Body>,
+                      camp::tuple<Values...>,
+                      camp::make_idx_seq_t<sizeof...(Values)>>
+make_param_body(Body&& body, camp::tuple<Values...>& vals)
+{
+  return {std::forward<Body>(body), &vals};
+}
+
+
+/*!
+ * \brief Reducer object used to lower a reduction parameter onto a back-end
+ *        that has no direct lowering.
+ */
+template <typename ReducePol, typename Param>
+struct param_reducer;
+
+template <typename ReducePol, typename T>
+struct param_reducer<ReducePol, ReduceParam<RAJA::operators::plus<T, T, T>, T>> {
+  using type = ReduceSum<ReducePol, T>;
+};
+
+template <typename ReducePol, typename T>
+struct param_reducer<ReducePol,
+                     ReduceParam<RAJA::operators::minimum<T, T, T>, T>> {
+  using type = ReduceMin<ReducePol, T>;
+};
+
+template <typename ReducePol, typename T>
+struct param_reducer<ReducePol,
+                     ReduceParam<RAJA::operators::maximum<T, T, T>, T>> {
+  using type = ReduceMax<ReducePol, T>;
+};
+
+template <typename ReducePol, typename T>
+struct param_reducer<ReducePol,
+                     ReduceParam<RAJA::operators::bit_or<T, T, T>, T>> {
+  using type = ReduceBitOr<ReducePol, T>;
+};
+
+template <typename ReducePol, typename T>
+struct param_reducer<ReducePol,
+                     ReduceParam<RAJA::operators::bit_and<T, T, T>, T>> {
+  using type = ReduceBitAnd<ReducePol, T>;
+};
+
+/*!
+ * \brief Reduction policy used to lower reduction parameters for an
+ *        execution policy onto reducer objects.
+ *
+ * Back-ends without a direct lowering specialize this, void means reduction
+ * parameters are not supported.
+ */
+template <typename ExecPol, typename Enable = void>
+struct param_reduce_policy {
+  using type = void;
+};
+
+/*!
+ * \brief Loop body adapter passing the local values of reducer objects to
+ *        the loop body.
+ *
+ * The reducers are copied with the adapter, so they are set up for the
+ * launch like reducers captured by a lambda.
+ */
+template <typename Body, typename Reducers, typename Seq>
+struct ParamReducerBody;
+
+template <typename Body, typename Reducers, camp::idx_t... Is>
+struct ParamReducerBody<Body, Reducers, camp::idx_seq<Is...>> {
+  Body body;
+  Reducers reducers;
+
+  RAJA_SUPPRESS_HD_WARN
+  template <typename Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Idx const& i) const
+  {
+    body(i, camp::get<Is>(reducers).local()...);
+  }
+};
+
+template <typename Res,
+          typename ExecPol,
+          typename Iterable,
+          typename Func,
+          typename... Params,
+          camp::idx_t... Is>
+RAJA_INLINE resources::EventProxy<Res> forall_param_reducers(
+    Res r,
+    ExecPol const& p,
+    Iterable&& iter,
+    camp::tuple<Params...> const& params,
+    Func&& loop_body,
+    camp::idx_seq<Is...>)
+{
+  using reduce_policy = typename param_reduce_policy<ExecPol>::type;
+  using reducers_type =
+      camp::tuple<typename param_reducer<reduce_policy, Params>::type...>;
+
+  reducers_type reducers(*camp::get<Is>(params).target...);
+
+  ParamReducerBody<camp::decay<Func>,
+                   reducers_type,
+                   camp::idx_seq<Is...>>
+      body{std::forward<Func>(loop_body), reducers};
+
+  resources::EventProxy<Res> e =
+      forall_impl(r, p, std::forward<Iterable>(iter), std::move(body));
+
+  camp::sink((*camp::get<Is>(params).target = camp::get<Is>(reducers).get(),
+              0)...);
+  return e;
+}
+
+/*!
+ * \brief Lower reduction parameters onto the reducer objects of a back-end.
+ *
+ * Back-ends with a direct lowering provide more specialized overloads.
+ */
+template <typename Res,
+          typename ExecPol,
+          typename Iterable,
+          typename Func,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<Res> forall_param_impl(
+    Res r,
+    ExecPol const& p,
+    Iterable&& iter,
+    camp::tuple<Params...> const& params,
+    Func&& loop_body)
+{
+  static_assert(!std::is_same<typename param_reduce_policy<ExecPol>::type,
+                              void>::value,
+                "Reduction parameters are not supported by this execution "
+                "policy");
+
+  return forall_param_reducers(r,
+                               p,
+                               std::forward<Iterable>(iter),
+                               params,
+                               std::forward<Func>(loop_body),
+                               camp::make_idx_seq_t<sizeof...(Params)>{});
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Create a reduction parameter for forall.
+ *
+ * \tparam Op combining operator, one of operators::plus, operators::minimum,
+ *            operators::maximum, operators::bit_or, operators::bit_and
+ *
+ * The value in target takes part in the reduction and receives the result.
+ */
+template <template <typename, typename, typename> class Op, typename T>
+RAJA_INLINE detail::ReduceParam<Op<T, T, T>, T> Reduce(T* target)
+{
+  return detail::ReduceParam<Op<T, T, T>, T>{target};
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,193 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing scheduling hints for forall.
+ *
+ *          A scheduling hint is passed to forall between the iteration
+ *          space and the loop body:
+ *
+ *             forall<omp_parallel_for_dynamic_exec<>>(range,
+ *                                                   expt::Grain(1024),
+ *                                                   [=](int i) { ... });
+ *
+ *             forall<omp_parallel_for_exec>(range,
+ *                                           expt::Cost([=](int i) {
+ *                                             return num_nbrs[i]; }),
+ *                                           [=](int i) { ... });
+ *
+ *             forall<omp_parallel_for_exec>(range,
+ *                                           expt::Affinity(expt::Bind::spread,
+ *                                                          expt::Smt::one_per_core),
+ *                                           [=](int i) { ... });
+ *
+ *          Hints change how the iterations are divided among threads, or
+ *          where the threads run, never which iterations run. Back-ends
+ *          without support for a hint run the loop as if it was not given.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_params_schedule_HPP
+#define RAJA_pattern_params_schedule_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Number of consecutive iterations a thread takes at a time.
+ */
+struct GrainHint {
+  Index_type grain;
+};
+
+/*!
+ * \brief Estimate of the cost of each iteration, used to give threads
+ *        blocks of about the same cost.
+ */
+template <typename CostFunc>
+struct CostHint {
+  CostFunc cost;
+  int blocks_per_thread;
+};
+
+}  // namespace detail
+
+/*!
+ * \brief How the threads of a loop are bound to the places of the machine.
+ *
+ * none keeps the binding of the OpenMP environment, close packs the threads
+ * on places next to the thread starting the loop, and spread spreads them
+ * evenly over the places.
+ */
+enum class Bind { none, close, spread };
+
+/*!
+ * \brief How many hardware threads of each core a loop uses.
+ *
+ * one_per_core suits memory bound loops, which gain nothing from a second
+ * thread on a core; all suits compute bound loops.
+ */
+enum class Smt { all, one_per_core };
+
+namespace detail
+{
+
+/*!
+ * \brief Binding of the threads of a loop, and how many to use per core.
+ */
+struct AffinityHint {
+  Bind bind;
+  Smt smt;
+};
+
+template <typename T>
+struct is_schedule_hint : std::false_type {
+};
+
+template <>
+struct is_schedule_hint<GrainHint> : std::true_type {
+};
+
+template <typename CostFunc>
+struct is_schedule_hint<CostHint<CostFunc>> : std::true_type {
+};
+
+template <>
+struct is_schedule_hint<AffinityHint> : std::true_type {
+};
+
+/*!
+ * \brief Run a loop with a scheduling hint.
+ *
+ * Back-ends that use a hint provide more specialized overloads, this one
+ * ignores it.
+ */
+template <typename Res,
+          typename ExecPol,
+          typename Iterable,
+          typename Hint,
+          typename Func>
+RAJA_INLINE resources::EventProxy<Res> forall_hint_impl(Res r,
+                                                        ExecPol const& p,
+                                                        Iterable&& iter,
+                                                        Hint const&,
+                                                        Func&& loop_body)
+{
+  return forall_impl(r,
+                     p,
+                     std::forward<Iterable>(iter),
+                     std::forward<Func>(loop_body));
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Create a hint giving the number of consecutive iterations a thread
+ *        takes at a time, in place of the chunk size of the policy.
+ */
+RAJA_INLINE detail::GrainHint Grain(Index_type grain)
+{
+  return detail::GrainHint{grain};
+}
+
+/*!
+ * \brief Create a hint giving the cost of each iteration.
+ *
+ * cost is called on the host with each index of the iteration space and
+ * returns a non-negative value convertible to double. The iterations are
+ * split into blocks_per_thread blocks of about the same cost per thread,
+ * which threads take as they finish their previous block.
+ */
+template <typename CostFunc>
+RAJA_INLINE detail::CostHint<camp::decay<CostFunc>> Cost(
+    CostFunc&& cost,
+    int blocks_per_thread = 4)
+{
+  return detail::CostHint<camp::decay<CostFunc>>{
+      std::forward<CostFunc>(cost), blocks_per_thread};
+}
+
+/*!
+ * \brief Create a hint binding the threads of a loop, and choosing whether
+ *        it runs on every hardware thread or on one per core.
+ *
+ * The hint overrides OMP_PROC_BIND for the one loop it is given to. Places
+ * still come from OMP_PLACES; with OMP_PLACES=cores, Smt::one_per_core and
+ * Bind::spread put exactly one thread on each core.
+ */
+RAJA_INLINE detail::AffinityHint Affinity(Bind bind, Smt smt = Smt::all)
+{
+  return detail::AffinityHint{bind, smt};
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -20,7 +20,9 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/util/CompensatedSum.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/ReproducibleSum.hpp"
 #include "RAJA/util/macros.hpp"
 
 namespace RAJA
@@ -231,6 +233,191 @@ class ReduceBitOr;
  */
 template <typename REDUCE_POLICY_T, typename T>
 class ReduceBitAnd;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fused multi-value reducer class template.
+ *
+ * Combines several reductions of different types and operations in one
+ * reducer object so backends do one combining pass and one result transfer
+ * for all of them.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   using values = RAJA::reduce::multi_value<RAJA::reduce::sum<Real_type>,
+                                            RAJA::reduce::min<Real_type>,
+                                            RAJA::reduce::max<Real_type>>;
+   ReduceMulti<reduce_policy, values> my_stats(values(0.0, 1.0e30, -1.0e30));
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_stats.reduce(data[i], data[i], data[i]);
+   }
+
+   Real_type sum = my_stats.get<0>();
+   Real_type min = my_stats.get<1>();
+   Real_type max = my_stats.get<2>();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceMulti;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Sum reducer of a small fixed size array, e.g. histogram bins.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   Int_ptr material = ...;
+   ReduceSumArray<reduce_policy, Real_type, 16> mat_sums(0.0);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      mat_sums.add(material[i], data[i]);
+   }
+
+   Real_type sum_of_material_3 = mat_sums.get(3);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T, size_t N>
+class ReduceSumArray;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reduction policy adapter giving bitwise reproducible sums.
+ *
+ * ReduceSum with this policy accumulates into a reduce::reproducible_sum<T>
+ * using the wrapped policy's reduction machinery, so the result does not
+ * depend on the number of threads, the block and grid sizes, or the order
+ * in which partial sums are combined. Each thread keeps a wider private
+ * value, so this is slower than the wrapped policy, notably on gpus.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   ReduceSum<reproducible_reduce<omp_reduce>, double> my_sum(0.0);
+
+   forall<omp_parallel_for_exec>( ..., [=] (Index_type i) {
+      my_sum += data[i];
+   }
+
+   double sum = my_sum.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T>
+struct reproducible_reduce {
+  using reduce_policy = REDUCE_POLICY_T;
+};
+
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceSum<reproducible_reduce<REDUCE_POLICY_T>, T>
+    : public ReduceSum<REDUCE_POLICY_T, reduce::reproducible_sum<T>>
+{
+public:
+  using Base = ReduceSum<REDUCE_POLICY_T, reduce::reproducible_sum<T>>;
+  using sum_type = reduce::reproducible_sum<T>;
+
+  ReduceSum() : Base() {}
+
+  explicit ReduceSum(T init_val) : Base(sum_type(init_val)) {}
+
+  //! add rhs directly into this thread's exact partial sum
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE
+  const ReduceSum& operator+=(T rhs) const
+  {
+    this->local().deposit(rhs);
+    return *this;
+  }
+
+  void reset(T val) { Base::reset(sum_type(val)); }
+
+  //! Get the reduced value rounded to T
+  T get() { return Base::get().value(); }
+
+  //! Get the reduced value rounded to T
+  operator T() { return get(); }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reduction policy adapter giving compensated (Kahan) sums.
+ *
+ * ReduceSum with this policy accumulates into a reduce::compensated_sum<T>
+ * using the wrapped policy's reduction machinery, and partial sums are
+ * combined by merging their sum and compensation terms. The rounding error
+ * stays close to that of a single addition for long sums, at the cost of a
+ * few flops per addition and twice the private storage.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   ReduceSum<compensated_reduce<omp_reduce>, double> energy(0.0);
+
+   forall<omp_parallel_for_exec>( ..., [=] (Index_type i) {
+      energy += e[i];
+   }
+
+   double total = energy.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T>
+struct compensated_reduce {
+  using reduce_policy = REDUCE_POLICY_T;
+};
+
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceSum<compensated_reduce<REDUCE_POLICY_T>, T>
+    : public ReduceSum<REDUCE_POLICY_T, reduce::compensated_sum<T>>
+{
+public:
+  using Base = ReduceSum<REDUCE_POLICY_T, reduce::compensated_sum<T>>;
+  using sum_type = reduce::compensated_sum<T>;
+
+  ReduceSum() : Base() {}
+
+  explicit ReduceSum(T init_val) : Base(sum_type(init_val)) {}
+
+  //! add rhs into this thread's compensated partial sum
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE
+  const ReduceSum& operator+=(T rhs) const
+  {
+    this->local().deposit(rhs);
+    return *this;
+  }
+
+  void reset(T val) { Base::reset(sum_type(val)); }
+
+  //! Get the compensated reduced value
+  T get() { return Base::get().value(); }
+
+  //! Get the compensated reduced value
+  operator T() { return get(); }
+};
+
 } //namespace RAJA
 
 
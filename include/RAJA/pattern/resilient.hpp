@@ -0,0 +1,238 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file declaring loops that are re-executed from a
+ *          snapshot of the arrays they write when a soft error is detected.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_resilient_HPP
+#define RAJA_pattern_resilient_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Flag set when a soft error is detected, for example by a signal
+ *        handler or by a check of the error counters of a device.
+ *
+ * Setting it from a signal handler is safe, as the flag is a lock-free
+ * atomic. soft_error_detected() reads and clears it, and is the default
+ * check of resilient_forall.
+ */
+RAJA_INLINE std::atomic<int>& soft_error_flag()
+{
+  static std::atomic<int> flag{0};
+  return flag;
+}
+
+struct soft_error_detected {
+  bool operator()() const { return soft_error_flag().exchange(0) != 0; }
+};
+
+/*!
+ * \brief The arrays a loop writes, which are saved before it runs and
+ *        restored before it is run again.
+ *
+ * Pointers are to memory the resource of the loop can copy, so device
+ * arrays for device resources. When fault tolerance is not enabled nothing
+ * is recorded.
+ */
+class WriteSet
+{
+public:
+  struct region {
+    void* ptr;
+    size_t bytes;
+  };
+
+  WriteSet() = default;
+
+  template <typename T>
+  WriteSet(T* ptr, size_t len)
+  {
+    add(ptr, len);
+  }
+
+  //! a loop writes len values starting at ptr
+  template <typename T>
+  WriteSet& add(T* ptr, size_t len)
+  {
+#if defined(RAJA_ENABLE_FT)
+    m_regions.push_back(region{static_cast<void*>(ptr), len * sizeof(T)});
+#else
+    RAJA_UNUSED_VAR(ptr, len);
+#endif
+    return *this;
+  }
+
+  std::vector<region> const& regions() const { return m_regions; }
+
+private:
+  std::vector<region> m_regions;
+};
+
+/*!
+ * \brief Memory for the snapshots of resilient loops on one resource.
+ *
+ * The buffers are allocated on the resource the first time they are needed
+ * and reused by every later loop, so after the first steps of a code
+ * taking a snapshot costs only the copies.
+ */
+template <typename Res>
+class SnapshotPool
+{
+public:
+  explicit SnapshotPool(Res r, int max_replays = 3)
+      : m_res(r), m_max_replays(max_replays)
+  { }
+
+  SnapshotPool(SnapshotPool const&) = delete;
+  SnapshotPool& operator=(SnapshotPool const&) = delete;
+
+  ~SnapshotPool()
+  {
+    for (auto& b : m_buffers) {
+      m_res.deallocate(b.ptr);
+    }
+  }
+
+  Res get_resource() const { return m_res; }
+
+  int max_replays() const { return m_max_replays; }
+
+  //! number of times loops using this pool were re-executed
+  long replays() const { return m_replays; }
+
+  //! copy the regions of writes to the buffers of the pool, on the resource
+  void save(WriteSet const& writes)
+  {
+    auto const& regions = writes.regions();
+    if (m_buffers.size() < regions.size()) {
+      m_buffers.resize(regions.size(), buffer{nullptr, 0});
+    }
+    for (size_t i = 0; i < regions.size(); ++i) {
+      buffer& b = m_buffers[i];
+      if (b.bytes < regions[i].bytes) {
+        if (b.ptr != nullptr) {
+          m_res.deallocate(b.ptr);
+        }
+        b.ptr = m_res.template allocate<char>(regions[i].bytes);
+        b.bytes = regions[i].bytes;
+      }
+      m_res.memcpy(b.ptr, regions[i].ptr, regions[i].bytes);
+    }
+  }
+
+  //! copy the buffers back to the regions of writes, on the resource
+  void restore(WriteSet const& writes)
+  {
+    auto const& regions = writes.regions();
+    for (size_t i = 0; i < regions.size(); ++i) {
+      m_res.memcpy(regions[i].ptr, m_buffers[i].ptr, regions[i].bytes);
+    }
+    ++m_replays;
+  }
+
+private:
+  struct buffer {
+    void* ptr;
+    size_t bytes;
+  };
+
+  Res m_res;
+  int m_max_replays;
+  long m_replays = 0;
+  std::vector<buffer> m_buffers;
+};
+
+/*!
+ * \brief Runs a loop that is re-executed when a soft error is detected.
+ *
+ * The arrays in writes are copied to the pool before the loop runs. Once the
+ * loop is done, check() is called on the host; if it returns true the
+ * arrays are restored and the loop runs again, up to the max_replays of the
+ * pool, after which std::runtime_error is thrown:
+ *
+ * \code
+ *
+ * RAJA::expt::SnapshotPool<RAJA::resources::Cuda> pool(res);
+ *
+ * RAJA::expt::resilient_forall<RAJA::cuda_exec<256>>(
+ *     pool, RAJA::expt::WriteSet(u, n).add(v, n), range,
+ *     [=] RAJA_DEVICE (int i) { u[i] += dt * v[i]; v[i] *= damp; });
+ *
+ * \endcode
+ *
+ * Restoring the arrays written makes any loop body safe to replay, as long
+ * as it writes no memory outside writes. Reducers are not supported, since
+ * a replay would combine into them twice.
+ *
+ * When RAJA_ENABLE_FT is not defined this is forall on the resource of the
+ * pool; nothing is saved and check is not called.
+ */
+template <typename ExecPol,
+          typename Res,
+          typename Iterable,
+          typename Body,
+          typename Check = soft_error_detected>
+resources::EventProxy<Res> resilient_forall(SnapshotPool<Res>& pool,
+                                            WriteSet const& writes,
+                                            Iterable&& iter,
+                                            Body&& body,
+                                            Check&& check = Check{})
+{
+  Res r = pool.get_resource();
+
+#if defined(RAJA_ENABLE_FT)
+  pool.save(writes);
+  for (int replay = 0;; ++replay) {
+    RAJA::forall<ExecPol>(r, iter, body);
+    r.wait();
+    if (!check()) {
+      break;
+    }
+    if (replay == pool.max_replays()) {
+      throw std::runtime_error(
+          "RAJA::expt::resilient_forall soft errors remain after replays");
+    }
+    pool.restore(writes);
+  }
+  return resources::EventProxy<Res>(r);
+#else
+  RAJA_UNUSED_VAR(writes, check);
+  return RAJA::forall<ExecPol>(r,
+                               std::forward<Iterable>(iter),
+                               std::forward<Body>(body));
+#endif
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
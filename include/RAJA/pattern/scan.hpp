@@ -23,10 +23,12 @@
 #include <iterator>
 #include <type_traits>
 
+#include "RAJA/internal/Iterators.hpp"
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/scan.hpp"
 
 namespace RAJA
 {
@@ -320,6 +322,463 @@ exclusive_scan(ExecPolicy&& p,
       value);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan of transformed values execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output
+* \param[in] transform unary function applied to each value of in, the
+*            results are scanned
+* \param[in] binop binary function to apply for scan
+*
+* The transformed values are computed when the scan reads them and are not
+* stored. in may be an index range such as RAJA::TypedRangeSegment.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename Transform,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<OutContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_scan_transform(ExecPolicy&& p,
+                         Res r,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Transform transform,
+                         Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  auto first = Iterators::make_transform_iterator(begin(in), transform);
+  return impl::scan::inclusive(r, std::forward<ExecPolicy>(p),
+                               first, first + distance(begin(in), end(in)),
+                               begin(out), binop);
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename Transform,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<OutContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+inclusive_scan_transform(ExecPolicy&& p,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Transform transform,
+                         Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_scan_transform(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      transform,
+      binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan of transformed values execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output
+* \param[in] transform unary function applied to each value of in, the
+*            results are scanned
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of the scan
+*
+* The transformed values are computed when the scan reads them and are not
+* stored. in may be an index range such as RAJA::TypedRangeSegment.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename Transform,
+          typename T = RAJA::detail::ContainerVal<OutContainer>,
+          typename Function = operators::plus<T>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_scan_transform(ExecPolicy&& p,
+                         Res r,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Transform transform,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  auto first = Iterators::make_transform_iterator(begin(in), transform);
+  return impl::scan::exclusive(r, std::forward<ExecPolicy>(p),
+                               first, first + distance(begin(in), end(in)),
+                               begin(out), binop, value);
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename Transform,
+          typename T = RAJA::detail::ContainerVal<OutContainer>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+exclusive_scan_transform(ExecPolicy&& p,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Transform transform,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_scan_transform(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      transform,
+      binop,
+      value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented inclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[in] flags Random-Access Container of segment head flags, a value of
+*            in starts a new segment if its flag is not zero
+* \param[out] out Random-Access Container for the output, may be in
+* \param[in] binop binary function to apply for scan
+*
+* Each segment is scanned separately, all segments in a single parallel scan.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename FlagContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_scan_segmented(ExecPolicy&& p,
+                         Res r,
+                         InContainer&& in,
+                         FlagContainer&& flags,
+                         OutContainer&& out,
+                         Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<FlagContainer>::value,
+                "FlagContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  const Index_type len = distance(begin(in), end(in));
+  auto seg_in = RAJA::detail::make_segmented_input<R>(begin(in), begin(flags));
+  auto seg_out = RAJA::detail::make_segmented_output<
+      RAJA::detail::segmented_output::inclusive>(
+      begin(out), begin(flags), binop, R(Function::identity()), len);
+  return impl::scan::inclusive_adapted(
+      r, std::forward<ExecPolicy>(p), seg_in, seg_in + len, seg_out,
+      RAJA::detail::segmented_op<Function, R>{binop});
+}
+
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename FlagContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_scan_segmented(ExecPolicy&& p,
+                         InContainer&& in,
+                         FlagContainer&& flags,
+                         OutContainer&& out,
+                         Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_scan_segmented(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<FlagContainer>(flags),
+      std::forward<OutContainer>(out),
+      binop);
+}
+
+
+/*!
+******************************************************************************
+*
+* \brief  segmented exclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[in] flags Random-Access Container of segment head flags, a value of
+*            in starts a new segment if its flag is not zero
+* \param[out] out Random-Access Container for the output, may be in
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of each segment
+*
+* Each segment is scanned separately, all segments in a single parallel scan.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename FlagContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_scan_segmented(ExecPolicy&& p,
+                         Res r,
+                         InContainer&& in,
+                         FlagContainer&& flags,
+                         OutContainer&& out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using U = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<FlagContainer>::value,
+                "FlagContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  const Index_type len = distance(begin(in), end(in));
+  auto seg_in = RAJA::detail::make_segmented_input<R>(begin(in), begin(flags));
+  auto seg_out = RAJA::detail::make_segmented_output<
+      RAJA::detail::segmented_output::exclusive>(
+      begin(out), begin(flags), binop, R(value), len);
+  return impl::scan::exclusive_adapted(
+      r, std::forward<ExecPolicy>(p), seg_in, seg_in + len, seg_out,
+      RAJA::detail::segmented_op<Function, R>{binop});
+}
+
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename FlagContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_scan_segmented(ExecPolicy&& p,
+                         InContainer&& in,
+                         FlagContainer&& flags,
+                         OutContainer&& out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_scan_segmented(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<FlagContainer>(flags),
+      std::forward<OutContainer>(out),
+      binop,
+      value);
+}
+
+
+/*!
+******************************************************************************
+*
+* \brief  segmented reduction execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[in] flags Random-Access Container of segment head flags, a value of
+*            in starts a new segment if its flag is not zero
+* \param[out] out Random-Access Container with one value per segment
+* \param[in] binop binary function to apply for the reduction
+*
+* The reduction of segment s is written to out[s], all segments are reduced
+* in a single parallel scan.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename FlagContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<OutContainer>>
+reduce_segmented(ExecPolicy&& p,
+                 Res r,
+                 InContainer&& in,
+                 FlagContainer&& flags,
+                 OutContainer&& out,
+                 Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<FlagContainer>::value,
+                "FlagContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  const Index_type len = distance(begin(in), end(in));
+  auto seg_in = RAJA::detail::make_segmented_input<R>(begin(in), begin(flags));
+  auto seg_out = RAJA::detail::make_segmented_output<
+      RAJA::detail::segmented_output::reduce>(
+      begin(out), begin(flags), binop, R(Function::identity()), len);
+  return impl::scan::inclusive_adapted(
+      r, std::forward<ExecPolicy>(p), seg_in, seg_in + len, seg_out,
+      RAJA::detail::segmented_op<Function, R>{binop});
+}
+
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename FlagContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<OutContainer>>
+reduce_segmented(ExecPolicy&& p,
+                 InContainer&& in,
+                 FlagContainer&& flags,
+                 OutContainer&& out,
+                 Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::reduce_segmented(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<FlagContainer>(flags),
+      std::forward<OutContainer>(out),
+      binop);
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -439,6 +898,151 @@ inclusive_scan_inplace(Res r, Args&&... args)
       ExecPolicy(), r, std::forward<Args>(args)...);
 }
 
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * inclusive_scan_transform
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_transform(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_scan_transform<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+inclusive_scan_transform(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::inclusive_scan_transform(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * exclusive_scan_transform
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_transform(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_scan_transform<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+exclusive_scan_transform(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::exclusive_scan_transform(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * inclusive_scan_segmented
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_segmented(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_scan_segmented<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+inclusive_scan_segmented(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::inclusive_scan_segmented(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * exclusive_scan_segmented
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_segmented(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_scan_segmented<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+exclusive_scan_segmented(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::exclusive_scan_segmented(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * reduce_segmented
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+reduce_segmented(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::reduce_segmented<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+reduce_segmented(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::reduce_segmented(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
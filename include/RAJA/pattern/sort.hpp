@@ -20,17 +20,54 @@
 
 #include "RAJA/config.hpp"
 
+#include <climits>
 #include <iterator>
 #include <type_traits>
 
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
 {
 
+namespace detail
+{
+
+//! loop body of a gather, writes out[i] = in[indices[i]]
+template <typename InIter, typename IdxIter, typename OutIter>
+struct GatherBody
+{
+  InIter in;
+  IdxIter indices;
+  OutIter out;
+
+  RAJA_HOST_DEVICE RAJA_INLINE
+  void operator()(RAJA::Index_type i) const
+  {
+    out[i] = in[indices[i]];
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief number of bits needed to hold the unsigned integer max_key, the
+ *        end_bit of a stable_sort_bits of keys less than or equal to max_key
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr int radix_end_bit(T max_key)
+{
+  static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+                "radix_end_bit requires an unsigned integer");
+  return max_key == 0 ? 0 : 1 + radix_end_bit(static_cast<T>(max_key >> 1));
+}
+
 inline namespace policy_by_value_interface
 {
 
@@ -322,109 +359,793 @@ stable_sort_pairs(ExecPolicy&& p,
       comp);
 }
 
-}  // end inline namespace policy_by_value_interface
-
-// =============================================================================
-
 /*!
- * \brief Conversion from template-based policy to value-based policy for
- * sort
- *
- * this reduces implementation overhead and perfectly forwards all arguments
- */
-template <typename ExecPolicy, typename... Args,
-          typename Res = typename resources::get_resource<ExecPolicy>::type>
+******************************************************************************
+*
+* \brief  segmented sort execution pattern
+*
+* Sorts each segment [offsets[s], offsets[s+1]) of c independently, all
+* segments are sorted by one call. The sort of each segment is stable.
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container or range of values to be sorted
+* \param[in] offsets RandomAccess Container or range of the num_segments+1
+* offsets of the segments, accessible with the execution policy
+* \param[in] comp comparison function to apply for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename OffsetContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
 concepts::enable_if_t<resources::EventProxy<Res>,
-                      type_traits::is_execution_policy<ExecPolicy>>
-sort(Args &&... args)
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>,
+                      type_traits::is_range<OffsetContainer>>
+sort_segmented(ExecPolicy&& p,
+               Res r,
+               Container&& c,
+               OffsetContainer&& offsets,
+               Compare comp = Compare{})
 {
-  Res r = Res::get_default();
-  return ::RAJA::policy_by_value_interface::sort<ExecPolicy>(
-      ExecPolicy(), r, std::forward<Args>(args)...);
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OffsetContainer>::value,
+                "OffsetContainer must model RandomAccessRange");
+  static_assert(std::is_integral<RAJA::detail::ContainerVal<OffsetContainer>>::value,
+                "OffsetContainer must contain integral offsets");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+  auto N = distance(begin_it, end_it);
+  auto begin_offsets = begin(offsets);
+  auto end_offsets   = end(offsets);
+  auto num_segments  = distance(begin_offsets, end_offsets) - 1;
+
+  if (N > 1 && num_segments > 0) {
+    return impl::sort::segmented(r, std::forward<ExecPolicy>(p),
+                                 begin_it, end_it,
+                                 begin_offsets, end_offsets, comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
 }
 ///
-template <typename ExecPolicy, typename Res, typename... Args>
+template <typename ExecPolicy,
+          typename Container,
+          typename OffsetContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
 concepts::enable_if_t<resources::EventProxy<Res>,
                       type_traits::is_execution_policy<ExecPolicy>,
-                      type_traits::is_resource<Res>>
-sort(Res r, Args &&... args)
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>,
+                      type_traits::is_range<OffsetContainer>>
+sort_segmented(ExecPolicy&& p,
+               Container&& c,
+               OffsetContainer&& offsets,
+               Compare comp = Compare{})
 {
-  return ::RAJA::policy_by_value_interface::sort(
-      ExecPolicy(), r, std::forward<Args>(args)...);
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::sort_segmented(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      std::forward<OffsetContainer>(offsets),
+      comp);
 }
 
 /*!
- * \brief Conversion from template-based policy to value-based policy for
- * stable_sort
- *
- * this reduces implementation overhead and perfectly forwards all arguments
- */
-template <typename ExecPolicy, typename... Args,
-          typename Res = typename resources::get_resource<ExecPolicy>::type>
+******************************************************************************
+*
+* \brief  segmented sort pairs execution pattern
+*
+* Sorts the pairs of each segment [offsets[s], offsets[s+1]) of keys and
+* vals independently, all segments are sorted by one call. The sort of each
+* segment is stable.
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in,out] vals RandomAccess Container or range of values to reorder
+* along with keys
+* \param[in] offsets RandomAccess Container or range of the num_segments+1
+* offsets of the segments, accessible with the execution policy
+* \param[in] comp comparison function to apply to keys for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename OffsetContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
 concepts::enable_if_t<resources::EventProxy<Res>,
-                      type_traits::is_execution_policy<ExecPolicy>>
-stable_sort(Args &&... args)
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<OffsetContainer>>
+sort_pairs_segmented(ExecPolicy&& p,
+                     Res r,
+                     KeyContainer&& keys,
+                     ValContainer&& vals,
+                     OffsetContainer&& offsets,
+                     Compare comp = Compare{})
 {
-  Res r = Res::get_default();
-  return ::RAJA::policy_by_value_interface::stable_sort<ExecPolicy>(
-      ExecPolicy(), r, std::forward<Args>(args)...);
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OffsetContainer>::value,
+                "OffsetContainer must model RandomAccessRange");
+  static_assert(std::is_integral<RAJA::detail::ContainerVal<OffsetContainer>>::value,
+                "OffsetContainer must contain integral offsets");
+
+  auto begin_key = begin(keys);
+  auto end_key   = end(keys);
+  auto N = distance(begin_key, end_key);
+  auto begin_offsets = begin(offsets);
+  auto end_offsets   = end(offsets);
+  auto num_segments  = distance(begin_offsets, end_offsets) - 1;
+
+  if (N > 1 && num_segments > 0) {
+    return impl::sort::segmented_pairs(r, std::forward<ExecPolicy>(p),
+                                       begin_key, end_key, begin(vals),
+                                       begin_offsets, end_offsets, comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
 }
 ///
-template <typename ExecPolicy, typename Res, typename... Args>
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename OffsetContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
 concepts::enable_if_t<resources::EventProxy<Res>,
                       type_traits::is_execution_policy<ExecPolicy>,
-                      type_traits::is_resource<Res>>
-stable_sort(Res r, Args &&... args)
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<OffsetContainer>>
+sort_pairs_segmented(ExecPolicy&& p,
+                     KeyContainer&& keys,
+                     ValContainer&& vals,
+                     OffsetContainer&& offsets,
+                     Compare comp = Compare{})
 {
-  return ::RAJA::policy_by_value_interface::stable_sort(
-      ExecPolicy(), r, std::forward<Args>(args)...);
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::sort_pairs_segmented(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(vals),
+      std::forward<OffsetContainer>(offsets),
+      comp);
 }
 
 /*!
- * \brief Conversion from template-based policy to value-based policy for
- * sort_pairs
- *
- * this reduces implementation overhead and perfectly forwards all arguments
- */
-template <typename ExecPolicy, typename... Args,
-          typename Res = typename resources::get_resource<ExecPolicy>::type>
+******************************************************************************
+*
+* \brief  nth element execution pattern
+*
+* Reorders c so c[nth] is the element that would be there if c were sorted,
+* no element before it is greater and no element after it is less.
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container or range
+* \param[in] nth index of the element to select
+* \param[in] comp comparison function to apply for selection
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
 concepts::enable_if_t<resources::EventProxy<Res>,
-                      type_traits::is_execution_policy<ExecPolicy>>
-sort_pairs(Args &&... args)
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+nth_element(ExecPolicy&& p,
+            Res r,
+            Container&& c,
+            RAJA::detail::ContainerDiff<Container> nth,
+            Compare comp = Compare{})
 {
-  Res r = Res::get_default();
-  return ::RAJA::policy_by_value_interface::sort_pairs<ExecPolicy>(
-      ExecPolicy(), r, std::forward<Args>(args)...);
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+  auto N = distance(begin_it, end_it);
+
+  if (N > 1 && nth >= 0 && nth < N) {
+    return impl::sort::nth_element(r, std::forward<ExecPolicy>(p),
+                                   begin_it, begin_it + nth, end_it, comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
 }
 ///
-template <typename ExecPolicy, typename Res, typename... Args>
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
 concepts::enable_if_t<resources::EventProxy<Res>,
                       type_traits::is_execution_policy<ExecPolicy>,
-                      type_traits::is_resource<Res>>
-sort_pairs(Res r, Args &&... args)
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+nth_element(ExecPolicy&& p,
+            Container&& c,
+            RAJA::detail::ContainerDiff<Container> nth,
+            Compare comp = Compare{})
 {
-  return ::RAJA::policy_by_value_interface::sort_pairs(
-      ExecPolicy(), r, std::forward<Args>(args)...);
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::nth_element(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      nth,
+      comp);
 }
 
 /*!
- * \brief Conversion from template-based policy to value-based policy for
- * sort_pairs
- *
- * this reduces implementation overhead and perfectly forwards all arguments
- */
-template <typename ExecPolicy, typename... Args,
-          typename Res = typename resources::get_resource<ExecPolicy>::type>
+******************************************************************************
+*
+* \brief  partial sort execution pattern
+*
+* Reorders c so its first k elements are the k smallest elements in sorted
+* order, the order of the other elements is unspecified. This is cheaper
+* than a sort when k is much smaller than the length of c.
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container or range
+* \param[in] k number of elements to sort
+* \param[in] comp comparison function to apply for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
 concepts::enable_if_t<resources::EventProxy<Res>,
-                      type_traits::is_execution_policy<ExecPolicy>>
-stable_sort_pairs(Args &&... args)
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+partial_sort(ExecPolicy&& p,
+             Res r,
+             Container&& c,
+             RAJA::detail::ContainerDiff<Container> k,
+             Compare comp = Compare{})
 {
-  Res r = Res::get_default();
-  return ::RAJA::policy_by_value_interface::stable_sort_pairs<ExecPolicy>(
-      ExecPolicy(), r, std::forward<Args>(args)...);
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+  auto N = distance(begin_it, end_it);
+
+  if (N > 1 && k > 0) {
+    return impl::sort::partial(r, std::forward<ExecPolicy>(p),
+                               begin_it, begin_it + (k < N ? k : N), end_it,
+                               comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
 }
 ///
-template <typename ExecPolicy, typename Res, typename... Args>
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+partial_sort(ExecPolicy&& p,
+             Container&& c,
+             RAJA::detail::ContainerDiff<Container> k,
+             Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partial_sort(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      k,
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  argsort execution pattern
+*
+* Writes the permutation that stably sorts keys to perm, perm[i] is the index
+* in keys of the value at position i of the sorted keys. The keys are not
+* modified and only indices are moved, use gather to apply the permutation to
+* the keys or to other values.
+*
+* \param[in] p Execution policy
+* \param[in] keys RandomAccess Container or range of keys
+* \param[out] perm RandomAccess Container or range of integral indices, at
+*                  least as long as keys
+* \param[in] comp comparison function to apply for sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename IdxContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<IdxContainer>>
+argsort(ExecPolicy&& p,
+        Res r,
+        KeyContainer&& keys,
+        IdxContainer&& perm,
+        Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using K = RAJA::detail::ContainerVal<KeyContainer>;
+  using I = RAJA::detail::ContainerVal<IdxContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, K, K>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<IdxContainer>::value,
+                "IdxContainer must model RandomAccessRange");
+  static_assert(std::is_integral<I>::value,
+                "IdxContainer must hold integral indices");
+
+  auto begin_it = begin(keys);
+  auto end_it   = end(keys);
+  auto N = distance(begin_it, end_it);
+
+  if (N > 0) {
+    return impl::sort::argsort(r, std::forward<ExecPolicy>(p),
+                               begin_it, end_it, begin(perm), comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename IdxContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>>
+argsort(ExecPolicy&& p,
+        KeyContainer&& keys,
+        IdxContainer&& perm,
+        Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::argsort(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<IdxContainer>(perm),
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  gather execution pattern
+*
+* Writes out[i] = in[indices[i]] for every index, e.g., to apply the
+* permutation of an argsort to the values it was computed for.
+*
+* \param[in] p Execution policy
+* \param[in] in RandomAccess Container or range of values
+* \param[in] indices RandomAccess Container or range of integral indices
+*                    into in
+* \param[out] out RandomAccess Container or range at least as long as indices,
+*                 must not overlap in
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename IdxContainer,
+          typename OutContainer>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<IdxContainer>,
+                      type_traits::is_range<OutContainer>>
+gather(ExecPolicy&& p,
+       Res r,
+       InContainer&& in,
+       IdxContainer&& indices,
+       OutContainer&& out)
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<IdxContainer>::value,
+                "IdxContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  static_assert(std::is_integral<RAJA::detail::ContainerVal<IdxContainer>>::value,
+                "IdxContainer must hold integral indices");
+
+  auto idx_begin = begin(indices);
+  auto N = distance(idx_begin, end(indices));
+
+  using body_type = detail::GatherBody<decltype(begin(in)),
+                                       decltype(idx_begin),
+                                       decltype(begin(out))>;
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecPolicy>(p),
+      r,
+      TypedRangeSegment<RAJA::Index_type>(0, N),
+      body_type{begin(in), idx_begin, begin(out)});
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename IdxContainer,
+          typename OutContainer,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>>
+gather(ExecPolicy&& p,
+       InContainer&& in,
+       IdxContainer&& indices,
+       OutContainer&& out)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::gather(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<IdxContainer>(indices),
+      std::forward<OutContainer>(out));
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort of a bit range execution pattern
+*
+* Stable sort of unsigned integer keys that only differ in bits
+* [begin_bit, end_bit), the radix sort back-ends skip the digits outside the
+* bit range. With keys less than or equal to max_key use
+* begin_bit = 0 and end_bit = RAJA::radix_end_bit(max_key).
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container or range of unsigned integers
+* \param[in] begin_bit least significant bit that differs between the keys
+* \param[in] end_bit one past the most significant bit that differs between
+*                    the keys
+* \param[in] comp comparison function to apply for stable_sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+stable_sort_bits(ExecPolicy&& p,
+                 Res r,
+                 Container&& c,
+                 int begin_bit,
+                 int end_bit,
+                 Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+                "Container must hold unsigned integers");
+
+  if (begin_bit < 0 || begin_bit > end_bit ||
+      end_bit > static_cast<int>(sizeof(T) * CHAR_BIT)) {
+    RAJA_ABORT_OR_THROW("stable_sort_bits invalid bit range");
+  }
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+  auto N = distance(begin_it, end_it);
+
+  if (N > 1 && begin_bit < end_bit) {
+    return impl::sort::stable_bits(r, std::forward<ExecPolicy>(p),
+                                   begin_it, end_it, begin_bit, end_bit, comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+stable_sort_bits(ExecPolicy&& p,
+                 Container&& c,
+                 int begin_bit,
+                 int end_bit,
+                 Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_sort_bits(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      begin_bit,
+      end_bit,
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort pairs of a bit range execution pattern
+*
+* Stable sort of pairs with unsigned integer keys that only differ in bits
+* [begin_bit, end_bit), the radix sort back-ends skip the digits outside the
+* bit range.
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess KeyContainer or range of unsigned integer
+*                     keys to be sorted
+* \param[in,out] vals RandomAccess Container or range of values to reorder
+* along with keys
+* \param[in] begin_bit least significant bit that differs between the keys
+* \param[in] end_bit one past the most significant bit that differs between
+*                    the keys
+* \param[in] comp comparison function to apply to keys for stable_sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
+stable_sort_pairs_bits(ExecPolicy&& p,
+                       Res r,
+                       KeyContainer&& keys,
+                       ValContainer&& vals,
+                       int begin_bit,
+                       int end_bit,
+                       Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+                "KeyContainer must hold unsigned integers");
+
+  if (begin_bit < 0 || begin_bit > end_bit ||
+      end_bit > static_cast<int>(sizeof(T) * CHAR_BIT)) {
+    RAJA_ABORT_OR_THROW("stable_sort_pairs_bits invalid bit range");
+  }
+
+  auto begin_key = begin(keys);
+  auto end_key   = end(keys);
+  auto N = distance(begin_key, end_key);
+
+  if (N > 1 && begin_bit < end_bit) {
+    return impl::sort::stable_pairs_bits(r, std::forward<ExecPolicy>(p),
+                                         begin_key, end_key, begin(vals),
+                                         begin_bit, end_bit, comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>>
+stable_sort_pairs_bits(ExecPolicy&& p,
+                       KeyContainer&& keys,
+                       ValContainer&& vals,
+                       int begin_bit,
+                       int end_bit,
+                       Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_sort_pairs_bits(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(vals),
+      begin_bit,
+      end_bit,
+      comp);
+}
+
+}  // end inline namespace policy_by_value_interface
+
+// =============================================================================
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * sort
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+sort(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::sort<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+sort(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::sort(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * stable_sort
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+stable_sort(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_sort<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+stable_sort(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::stable_sort(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * sort_pairs
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+sort_pairs(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::sort_pairs<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+sort_pairs(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::sort_pairs(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * sort_pairs
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+stable_sort_pairs(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_sort_pairs<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
 concepts::enable_if_t<resources::EventProxy<Res>,
                       type_traits::is_execution_policy<ExecPolicy>,
                       type_traits::is_resource<Res>>
@@ -434,6 +1155,222 @@ stable_sort_pairs(Res r, Args &&... args)
       ExecPolicy(), r, std::forward<Args>(args)...);
 }
 
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * sort_segmented
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+sort_segmented(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::sort_segmented<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+sort_segmented(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::sort_segmented(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * sort_pairs_segmented
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+sort_pairs_segmented(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::sort_pairs_segmented<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+sort_pairs_segmented(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::sort_pairs_segmented(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * nth_element
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+nth_element(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::nth_element<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+nth_element(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::nth_element(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * partial_sort
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+partial_sort(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partial_sort<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+partial_sort(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::partial_sort(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * argsort
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+argsort(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::argsort<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+argsort(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::argsort(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * gather
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+gather(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::gather<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+gather(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::gather(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * stable_sort_bits
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+stable_sort_bits(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_sort_bits<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+stable_sort_bits(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::stable_sort_bits(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * stable_sort_pairs_bits
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+stable_sort_pairs_bits(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_sort_pairs_bits<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+stable_sort_pairs_bits(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::stable_sort_pairs_bits(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
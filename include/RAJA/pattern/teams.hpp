@@ -39,4 +39,25 @@
 #include "RAJA/policy/openmp/teams.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+#include "RAJA/policy/openmp_target/teams.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+#include "RAJA/policy/sycl/teams.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include "RAJA/policy/tbb/teams.hpp"
+#endif
+
+#include "RAJA/pattern/teams/teams_batch.hpp"
+#include "RAJA/pattern/teams/teams_multi.hpp"
+#include "RAJA/pattern/teams/teams_ragged.hpp"
+#include "RAJA/pattern/teams/teams_reduce.hpp"
+#include "RAJA/pattern/teams/teams_stage.hpp"
+#include "RAJA/pattern/teams/teams_time_tiling.hpp"
+#include "RAJA/pattern/teams/teams_unroll.hpp"
+#include "RAJA/pattern/teams/teams_variant.hpp"
+
 #endif /* RAJA_pattern_teams_HPP */
@@ -0,0 +1,305 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing a batch that runs small launches
+ *          queued on a resource as one kernel.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_batch_HPP
+#define RAJA_pattern_teams_batch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/WorkGroup/Vtable.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+struct LaunchBatchID {
+};
+
+//! Vtable of the bodies in a batch, called with the context of the launch
+using LaunchBatchVtable = RAJA::detail::Vtable<LaunchBatchID, LaunchContext>;
+
+//! A queued body: its call function and its offset in the batch buffer
+struct LaunchBatchItem {
+  LaunchBatchVtable::call_sig call;
+  size_t offset;
+};
+
+/*!
+ * Host buffer of the launches of a batch. The buffer starts with one
+ * LaunchBatchItem per launch, followed by the bodies, so it is copied to
+ * the device as one block.
+ */
+class LaunchBatchQueue
+{
+public:
+  LaunchBatchQueue(size_t max_launches, size_t max_bytes)
+      : m_max_launches(max_launches),
+        m_body_begin(align_up(max_launches * sizeof(LaunchBatchItem))),
+        m_body_end(m_body_begin),
+        m_buffer(m_body_begin + max_bytes)
+  {
+  }
+
+  LaunchBatchQueue(LaunchBatchQueue const &) = delete;
+  LaunchBatchQueue &operator=(LaunchBatchQueue const &) = delete;
+
+  ~LaunchBatchQueue() { clear(); }
+
+  size_t size() const { return m_bodies.size(); }
+
+  bool empty() const { return m_bodies.empty(); }
+
+  bool full() const { return size() == m_max_launches; }
+
+  //! Bytes of the buffer, and the most a batch copies to the device
+  size_t capacity() const { return m_buffer.size(); }
+
+  //! Bytes used by the queued launches
+  size_t bytes() const { return m_body_end; }
+
+  const char *data() const { return m_buffer.data(); }
+
+  //! Grid of the queued launches, with the most dynamic shared memory
+  Grid const &grid() const { return m_grid; }
+
+  //! Whether a launch on grid can run in the same kernel as the queue
+  bool compatible(Grid const &grid) const
+  {
+    if (empty()) {
+      return true;
+    }
+    for (int d = 0; d < 3; ++d) {
+      if (grid.teams.value[d] != m_grid.teams.value[d] ||
+          grid.threads.value[d] != m_grid.threads.value[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! Whether a body of body_bytes bytes fits in the queue
+  bool fits(size_t body_bytes) const
+  {
+    return !full() && align_up(m_body_end) + body_bytes <= m_buffer.size();
+  }
+
+  template <typename BODY>
+  void push(Grid const &grid, LaunchBatchVtable::call_sig call, BODY &&body)
+  {
+    using body_type = camp::decay<BODY>;
+
+    if (empty()) {
+      m_grid = grid;
+    } else {
+      m_grid.shared_mem_size =
+          std::max(m_grid.shared_mem_size, grid.shared_mem_size);
+    }
+
+    const size_t offset = align_up(m_body_end);
+    new (&m_buffer[offset]) body_type(std::forward<BODY>(body));
+    m_body_end = offset + sizeof(body_type);
+
+    LaunchBatchItem item{call, offset};
+    std::memcpy(&m_buffer[size() * sizeof(LaunchBatchItem)],
+                &item,
+                sizeof(LaunchBatchItem));
+    m_bodies.push_back(
+        {&LaunchBatchVtable::template destroy<body_type>, offset});
+  }
+
+  //! Destroy the queued bodies
+  void clear()
+  {
+    for (auto const &body : m_bodies) {
+      body.destroy(&m_buffer[body.offset]);
+    }
+    m_bodies.clear();
+    m_body_end = m_body_begin;
+  }
+
+private:
+  struct QueuedBody {
+    LaunchBatchVtable::destroy_sig destroy;
+    size_t offset;
+  };
+
+  static size_t align_up(size_t n)
+  {
+    constexpr size_t align = alignof(std::max_align_t);
+    return (n + align - 1) / align * align;
+  }
+
+  size_t m_max_launches;
+  size_t m_body_begin;
+  size_t m_body_end;
+  std::vector<char> m_buffer;
+  std::vector<QueuedBody> m_bodies;
+  Grid m_grid;
+};
+
+/*!
+ * Queues and runs the launches of a batch for a launch policy. Back-ends
+ * that can run a batch as one kernel specialize it; the others leave every
+ * launch to RAJA::expt::launch.
+ */
+template <typename LAUNCH_POL>
+struct LaunchBatchExecute {
+  //! Queue body, or return false to have it launched on its own
+  template <typename BODY>
+  static bool enqueue(LaunchBatchQueue &,
+                      resources::Resource &,
+                      Grid const &,
+                      BODY const &)
+  {
+    return false;
+  }
+
+  static void run(LaunchBatchQueue &, resources::Resource &, char *) {}
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Defers small launches on a resource and runs them as one kernel.
+ *
+ * Launches on a device resource are queued while they have the same teams
+ * and threads as the launches already queued, and run in one kernel, in
+ * order, at the next flush, wait, or when max_launches launches or
+ * max_bytes bytes of loop bodies are queued. The launches in a batch are
+ * separated by a grid synchronization, so each sees the writes of the ones
+ * before it, as if launched one after the other. Launches that can not be
+ * batched, and all launches on a host resource, are run right away after
+ * the queue is flushed.
+ *
+ *   RAJA::expt::LaunchBatch<launch_policy> batch(res);
+ *   for (int b = 0; b < num_blocks; ++b) {
+ *     batch.launch(RAJA::expt::Grid(RAJA::expt::Teams(2),
+ *                                   RAJA::expt::Threads(128)),
+ *                  [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+ *                    ...
+ *                  });
+ *   }
+ *   batch.wait();
+ *
+ * The teams of a batch must all be resident on the device at once.
+ * Reductions used in queued launches are only complete after a flush.
+ */
+template <typename POLICY_LIST>
+class LaunchBatch
+{
+public:
+  explicit LaunchBatch(resources::Resource res,
+                       size_t max_launches = 64,
+                       size_t max_bytes = 64 * 1024)
+      : m_res(res), m_queue(max_launches, max_bytes)
+  {
+  }
+
+  LaunchBatch(LaunchBatch const &) = delete;
+  LaunchBatch &operator=(LaunchBatch const &) = delete;
+
+  ~LaunchBatch()
+  {
+    flush();
+    if (m_device_buffer) {
+      m_res.wait();
+      m_res.deallocate(m_device_buffer);
+    }
+  }
+
+  //! Queue a launch of body on grid, or run it if it can not be batched
+  template <typename BODY>
+  void launch(Grid const &grid, BODY const &body)
+  {
+#if defined(RAJA_DEVICE_ACTIVE)
+    using execute_t =
+        detail::LaunchBatchExecute<typename POLICY_LIST::device_policy_t>;
+    if (m_res.get_platform() != camp::resources::v1::Platform::host) {
+      if (!m_queue.compatible(grid)) {
+        flush();
+      }
+      bool queued = execute_t::enqueue(m_queue, m_res, grid, body);
+      if (!queued && !m_queue.empty()) {
+        flush();
+        queued = execute_t::enqueue(m_queue, m_res, grid, body);
+      }
+      if (queued) {
+        if (m_queue.full()) {
+          flush();
+        }
+        return;
+      }
+    }
+#endif
+    ::RAJA::expt::launch<POLICY_LIST>(m_res, grid, body);
+  }
+
+  //! Run the queued launches
+  resources::EventProxy<resources::Resource> flush()
+  {
+#if defined(RAJA_DEVICE_ACTIVE)
+    using execute_t =
+        detail::LaunchBatchExecute<typename POLICY_LIST::device_policy_t>;
+    if (!m_queue.empty()) {
+      if (!m_device_buffer) {
+        m_device_buffer = m_res.allocate<char>(m_queue.capacity());
+      }
+      execute_t::run(m_queue, m_res, m_device_buffer);
+      m_queue.clear();
+    }
+#endif
+    return resources::EventProxy<resources::Resource>(m_res);
+  }
+
+  //! Run the queued launches and wait for them to complete
+  void wait()
+  {
+    flush();
+    m_res.wait();
+  }
+
+  //! Number of queued launches
+  size_t size() const { return m_queue.size(); }
+
+private:
+  resources::Resource m_res;
+  detail::LaunchBatchQueue m_queue;
+  char *m_device_buffer{nullptr};
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_teams_batch_HPP
@@ -20,35 +20,59 @@
 
 #include "RAJA/config.hpp"
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/KernelName.hpp"
 #include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/Timer.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/plugins.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/util/types.hpp"
 #include "camp/camp.hpp"
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDACC__)
+#include <cooperative_groups.h>
+#elif defined(RAJA_ENABLE_HIP) && defined(__HIPCC__)
+#include <hip/hip_cooperative_groups.h>
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+#include <CL/sycl.hpp>
+#endif
+
 #if defined(RAJA_DEVICE_CODE)
 #define RAJA_TEAM_SHARED __shared__
 #else
 #define RAJA_TEAM_SHARED
 #endif
 
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDA_ARCH__) && \
+    (__CUDA_ARCH__ >= 900) && (CUDART_VERSION >= 11080)
+#define RAJA_TEAMS_CLUSTER_PTX
+#endif
+
 namespace RAJA
 {
 
 namespace expt
 {
 
-// GPU or CPU threads available
-enum ExecPlace { HOST, DEVICE, NUM_PLACES };
+// GPU or CPU threads available, or AUTO to let launch choose one of them
+enum ExecPlace { HOST, DEVICE, NUM_PLACES, AUTO };
 
 struct null_launch_t {
 };
 
 // Support for host, and device
 template <typename HOST_POLICY
-#if defined(RAJA_DEVICE_ACTIVE)
+#if defined(RAJA_LAUNCH_DEVICE_ACTIVE)
           ,
           typename DEVICE_POLICY = HOST_POLICY
 #endif
@@ -56,20 +80,20 @@ template <typename HOST_POLICY
 
 struct LoopPolicy {
   using host_policy_t = HOST_POLICY;
-#if defined(RAJA_DEVICE_ACTIVE)
+#if defined(RAJA_LAUNCH_DEVICE_ACTIVE)
   using device_policy_t = DEVICE_POLICY;
 #endif
 };
 
 template <typename HOST_POLICY
-#if defined(RAJA_DEVICE_ACTIVE)
+#if defined(RAJA_LAUNCH_DEVICE_ACTIVE)
           ,
           typename DEVICE_POLICY = HOST_POLICY
 #endif
           >
 struct LaunchPolicy {
   using host_policy_t = HOST_POLICY;
-#if defined(RAJA_DEVICE_ACTIVE)
+#if defined(RAJA_LAUNCH_DEVICE_ACTIVE)
   using device_policy_t = DEVICE_POLICY;
 #endif
 };
@@ -128,12 +152,52 @@ struct Lanes {
   constexpr Lanes(int i) : value(i) {}
 };
 
+/*!
+ * Teams grouped into a cluster in each dimension. The teams of a cluster
+ * run at the same time and can read and write each other's shared memory
+ * on devices that support thread block clusters; elsewhere every team is
+ * its own cluster.
+ */
+struct Clusters {
+  int value[3];
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr Clusters() : value{1, 1, 1} {}
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr Clusters(int i) : value{i, 1, 1} {}
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr Clusters(int i, int j) : value{i, j, 1} {}
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr Clusters(int i, int j, int k) : value{i, j, k} {}
+};
+
+//! Bytes of dynamic shared memory for each team of a launch
+struct DynamicMem {
+  size_t bytes;
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr explicit DynamicMem(size_t in_bytes) : bytes(in_bytes) {}
+};
+
 struct Grid {
 public:
   Teams teams;
   Threads threads;
   Lanes lanes;
   const char *kernel_name{nullptr};
+  size_t shared_mem_size{0};
+  Clusters clusters;
+  //! bytes moved and flops done by the launch, given to the plugins
+  size_t bytes{0};
+  size_t flops{0};
 
   RAJA_INLINE
   Grid() = default;
@@ -141,6 +205,35 @@ public:
   Grid(Teams in_teams, Threads in_threads, const char *in_kernel_name = nullptr)
     : teams(in_teams), threads(in_threads), kernel_name(in_kernel_name){};
 
+  Grid(Teams in_teams,
+       Threads in_threads,
+       DynamicMem in_shared_mem,
+       const char *in_kernel_name = nullptr)
+    : teams(in_teams),
+      threads(in_threads),
+      kernel_name(in_kernel_name),
+      shared_mem_size(in_shared_mem.bytes){};
+
+  Grid(Teams in_teams,
+       Threads in_threads,
+       Clusters in_clusters,
+       const char *in_kernel_name = nullptr)
+    : teams(in_teams),
+      threads(in_threads),
+      kernel_name(in_kernel_name),
+      clusters(in_clusters){};
+
+  Grid(Teams in_teams,
+       Threads in_threads,
+       Clusters in_clusters,
+       DynamicMem in_shared_mem,
+       const char *in_kernel_name = nullptr)
+    : teams(in_teams),
+      threads(in_threads),
+      kernel_name(in_kernel_name),
+      shared_mem_size(in_shared_mem.bytes),
+      clusters(in_clusters){};
+
 private:
   RAJA_HOST_DEVICE
   RAJA_INLINE
@@ -156,9 +249,92 @@ private:
 };
 
 
+namespace detail
+{
+
+//! Buffer of the calling thread for dynamic shared memory on the host
+inline char *host_launch_shared_mem(size_t bytes)
+{
+  thread_local std::vector<std::max_align_t> buffer;
+  const size_t count =
+      (bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+  if (buffer.size() < count) {
+    buffer.resize(count);
+  }
+  return reinterpret_cast<char *>(buffer.data());
+}
+
+//! Threads of a warp (wavefront on AMD devices); 1 on the host
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDA_ARCH__)
+constexpr int launch_warp_size = 32;
+#elif defined(RAJA_ENABLE_HIP) && defined(__HIP_DEVICE_COMPILE__) && \
+    defined(__HIP_PLATFORM_HCC__)
+constexpr int launch_warp_size = 64;
+#elif defined(RAJA_ENABLE_HIP) && defined(__HIP_DEVICE_COMPILE__)
+constexpr int launch_warp_size = 32;
+#elif defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+// SYCL launch kernels require sub-groups of this size
+constexpr int launch_warp_size = 16;
+#else
+constexpr int launch_warp_size = 1;
+#endif
+
+//! Lane of the calling thread in its warp, threads numbered x fastest
+RAJA_HOST_DEVICE RAJA_INLINE int launch_lane_id()
+{
+#if defined(RAJA_DEVICE_CODE)
+  const int thread_id = threadIdx.x + blockDim.x * threadIdx.y +
+                        (blockDim.x * blockDim.y) * threadIdx.z;
+  return thread_id % launch_warp_size;
+#else
+  return 0;
+#endif
+}
+
+/*!
+ * Value of var in lane src_lane of the warp, shuffled as 32 bit words so
+ * any trivially copyable type works.
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T launch_shfl(T var, int src_lane)
+{
+#if defined(RAJA_DEVICE_CODE)
+  constexpr int num_words = (sizeof(T) + sizeof(int) - 1) / sizeof(int);
+  int words[num_words];
+  memcpy(words, &var, sizeof(T));
+  for (int i = 0; i < num_words; ++i) {
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDA_ARCH__)
+    words[i] = ::__shfl_sync(0xffffffffu, words[i], src_lane);
+#else
+    words[i] = ::__shfl(words[i], src_lane);
+#endif
+  }
+  memcpy(&var, words, sizeof(T));
+#else
+  (void)src_lane;
+#endif
+  return var;
+}
+
+}  // namespace detail
+
 class LaunchContext : public Grid
 {
 public:
+  //! Bytes of dynamic shared memory handed out by getSharedMemory
+  size_t shared_mem_offset{0};
+
+#if defined(RAJA_ENABLE_SYCL)
+  //! Work-item of a SYCL launch, set by the kernel
+  cl::sycl::nd_item<3> *itm{nullptr};
+  //! Work-group local memory of a SYCL launch, for getSharedMemory
+  char *shared_mem_ptr{nullptr};
+  //! Work-group local memory of a SYCL launch, for teamReduce
+  char *team_scratch_ptr{nullptr};
+
+  //! Bytes of team_scratch_ptr, for up to 64 sub-groups of 16 bytes
+  static constexpr size_t team_scratch_size = 64 * 16;
+#endif
 
   LaunchContext(Grid const &base)
       : Grid(base)
@@ -170,6 +346,341 @@ public:
   {
 #if defined(RAJA_DEVICE_CODE)
     __syncthreads();
+#elif defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+    itm->barrier(cl::sycl::access::fence_space::local_space);
+#endif
+  }
+
+  /*!
+   * Returns the next count values of T of the dynamic shared memory given
+   * to the Grid with DynamicMem. Threads of a team that make the same calls
+   * in the same order get the same memory. On the device this is shared
+   * memory of the block, on the host a buffer of the calling thread.
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE T *getSharedMemory(size_t count)
+  {
+    const size_t offset =
+        (shared_mem_offset + alignof(T) - 1) / alignof(T) * alignof(T);
+    shared_mem_offset = offset + count * sizeof(T);
+    if (shared_mem_offset > shared_mem_size) {
+      RAJA_ABORT_OR_THROW("getSharedMemory: not enough dynamic shared memory");
+    }
+#if defined(RAJA_DEVICE_CODE)
+    extern __shared__ char raja_launch_shared_mem[];
+    char *base = raja_launch_shared_mem;
+#elif defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+    char *base = shared_mem_ptr;
+#else
+    char *base = detail::host_launch_shared_mem(shared_mem_size);
+#endif
+    return reinterpret_cast<T *>(base + offset);
+  }
+
+  //! Hand out the dynamic shared memory from the start again
+  RAJA_HOST_DEVICE
+  void releaseSharedMemory() { shared_mem_offset = 0; }
+
+  /*!
+   * Returns cond as seen by the first thread of the team to every thread of
+   * the team, so branches on it are taken by the whole team and may call
+   * teamSync. Every thread of the team must call it.
+   */
+  RAJA_HOST_DEVICE
+  bool teamUniform(bool cond)
+  {
+#if defined(RAJA_DEVICE_CODE)
+    const bool first_thread =
+        threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0;
+    return __syncthreads_or(first_thread && cond);
+#elif defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+    const bool first_thread = itm->get_local_linear_id() == 0;
+    return cl::sycl::any_of_group(itm->get_group(), first_thread && cond);
+#else
+    return cond;
+#endif
+  }
+
+  /*!
+   * Synchronize all threads of all teams of the grid. Only launches with a
+   * cooperative launch policy, such as cuda_launch_cooperative_t, may call
+   * it, and every thread of the grid must. On the host each team loop runs
+   * all of its teams before the next statement, so a gridSync between
+   * team loops has nothing to wait for.
+   */
+  RAJA_HOST_DEVICE
+  void gridSync()
+  {
+#if defined(RAJA_DEVICE_CODE)
+    cooperative_groups::this_grid().sync();
+#endif
+  }
+
+  /*!
+   * Teams in the cluster of the calling team, and the rank of the calling
+   * team in it. Both are 1 and 0 where clusters are not supported, as
+   * every team is then a cluster of its own.
+   */
+  RAJA_HOST_DEVICE
+  int clusterSize() const
+  {
+#if defined(RAJA_TEAMS_CLUSTER_PTX)
+    unsigned size;
+    asm volatile("mov.u32 %0, %%cluster_nctarank;" : "=r"(size));
+    return static_cast<int>(size);
+#else
+    return 1;
+#endif
+  }
+
+  RAJA_HOST_DEVICE
+  int clusterRank() const
+  {
+#if defined(RAJA_TEAMS_CLUSTER_PTX)
+    unsigned rank;
+    asm volatile("mov.u32 %0, %%cluster_ctarank;" : "=r"(rank));
+    return static_cast<int>(rank);
+#else
+    return 0;
+#endif
+  }
+
+  /*!
+   * Synchronize all threads of all teams of the cluster, and make their
+   * shared memory writes visible to each other. Every thread of the
+   * cluster must call it, and teams must call it before they exit when
+   * other teams of the cluster may still access their shared memory.
+   */
+  RAJA_HOST_DEVICE
+  void clusterSync()
+  {
+#if defined(RAJA_TEAMS_CLUSTER_PTX)
+    asm volatile("barrier.cluster.arrive;\n"
+                 "barrier.cluster.wait;\n" ::
+                     : "memory");
+#else
+    teamSync();
+#endif
+  }
+
+  /*!
+   * Address of the shared memory ptr of the calling team in the team with
+   * rank rank of the cluster. Where clusters are not supported only the
+   * rank of the calling team, 0, is valid.
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE T *clusterSharedMemory(T *ptr, int rank) const
+  {
+#if defined(RAJA_TEAMS_CLUSTER_PTX)
+    unsigned long long remote;
+    asm volatile("mapa.u64 %0, %1, %2;"
+                 : "=l"(remote)
+                 : "l"(reinterpret_cast<unsigned long long>(ptr)),
+                   "r"(static_cast<unsigned>(rank)));
+    return reinterpret_cast<T *>(remote);
+#else
+    if (rank != 0) {
+      RAJA_ABORT_OR_THROW("clusterSharedMemory: clusters are not supported");
+    }
+    return ptr;
+#endif
+  }
+
+  /*!
+   * Threads of a warp, the group the warp collectives below work over:
+   * 32 on CUDA devices, 64 on AMD devices and 1 on the host, where each
+   * thread of a team runs on its own.
+   *
+   * Every lane of the warp must call the collectives together, so the
+   * threads of a team should be a multiple of warpSize on the device and
+   * the calls must not be under branches that split a warp.
+   */
+  RAJA_HOST_DEVICE
+  static constexpr int warpSize() { return detail::launch_warp_size; }
+
+  //! Lane of the calling thread in its warp, threads numbered x fastest
+  RAJA_HOST_DEVICE
+  int warpLane() const
+  {
+#if defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+    return static_cast<int>(itm->get_sub_group().get_local_linear_id());
+#else
+    return detail::launch_lane_id();
+#endif
+  }
+
+  //! Value of var in lane src_lane of the warp
+  template <typename T>
+  RAJA_HOST_DEVICE T warpShuffle(T var, int src_lane) const
+  {
+#if defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+    return cl::sycl::select_from_group(itm->get_sub_group(), var, src_lane);
+#else
+    return detail::launch_shfl(var, src_lane);
+#endif
+  }
+
+  //! op of the values of all lanes of the warp, returned to every lane
+  template <typename T, typename Op>
+  RAJA_HOST_DEVICE T warpReduce(T val, Op op) const
+  {
+    for (int i = 1; i < warpSize(); i *= 2) {
+      val = op(val, warpShuffle(val, warpLane() ^ i));
+    }
+    return val;
+  }
+
+  //! op of the values of lanes 0 up to and including the calling lane
+  template <typename T, typename Op>
+  RAJA_HOST_DEVICE T warpInclusiveScan(T val, Op op) const
+  {
+    const int lane = warpLane();
+    for (int i = 1; i < warpSize(); i *= 2) {
+      const T lower = warpShuffle(val, lane >= i ? lane - i : lane);
+      if (lane >= i) {
+        val = op(lower, val);
+      }
+    }
+    return val;
+  }
+
+  //! op of the values of the lanes below the calling lane, identity in lane 0
+  template <typename T, typename Op>
+  RAJA_HOST_DEVICE T warpExclusiveScan(T val, Op op, T identity) const
+  {
+    const int lane = warpLane();
+    const T inclusive = warpInclusiveScan(val, op);
+    const T lower = warpShuffle(inclusive, lane > 0 ? lane - 1 : 0);
+    return lane > 0 ? lower : identity;
+  }
+
+  //! Value of val in lane src_lane, returned to every lane
+  template <typename T>
+  RAJA_HOST_DEVICE T warpBroadcast(T val, int src_lane) const
+  {
+    return warpShuffle(val, src_lane);
+  }
+
+  /*!
+   * op of the values of all threads of the team, returned to every thread.
+   *
+   * The warps combine their values with shuffles, and then the first warp
+   * combines the values of the warps, so a team takes two synchronizations
+   * whatever its size. Every thread of the team must call it, outside the
+   * thread loops:
+   *
+   *   double sum = 0.0;
+   *   loop<thread_pol>(ctx, range, [&](int i) { sum += x[i]; });
+   *   sum = ctx.teamReduce(sum, RAJA::operators::plus<double>{}, 0.0);
+   *
+   * On the host the thread loops of a team run in the calling thread, so
+   * val already holds the value of the team and is returned as is.
+   */
+  template <typename T, typename Op>
+  RAJA_HOST_DEVICE T teamReduce(T val, Op op, T identity)
+  {
+#if defined(RAJA_DEVICE_CODE)
+    constexpr int max_warps = 1024 / detail::launch_warp_size;
+    __shared__ typename std::aligned_storage<sizeof(T), alignof(T)>::type
+        storage[max_warps];
+    T *partials = reinterpret_cast<T *>(storage);
+
+    const int num_threads = blockDim.x * blockDim.y * blockDim.z;
+    const int thread_id = threadIdx.x + blockDim.x * threadIdx.y +
+                          (blockDim.x * blockDim.y) * threadIdx.z;
+    const int lane = thread_id % warpSize();
+    const int warp = thread_id / warpSize();
+    const int num_warps = (num_threads + warpSize() - 1) / warpSize();
+
+    // only combine values of threads that exist in a partial last warp
+    for (int i = 1; i < warpSize(); i *= 2) {
+      const T rhs = warpShuffle(val, lane ^ i);
+      if ((thread_id ^ i) < num_threads) {
+        val = op(val, rhs);
+      }
+    }
+    if (lane == 0) {
+      partials[warp] = val;
+    }
+    __syncthreads();
+
+    if (warp == 0) {
+      val = lane < num_warps ? partials[lane] : identity;
+      for (int i = 1; i < warpSize(); i *= 2) {
+        const T rhs = warpShuffle(val, lane ^ i);
+        if ((thread_id ^ i) < num_threads) {
+          val = op(val, rhs);
+        }
+      }
+      if (lane == 0) {
+        partials[0] = val;
+      }
+    }
+    __syncthreads();
+
+    val = partials[0];
+    // partials may be reused by the next call
+    __syncthreads();
+#elif defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+    static_assert(sizeof(T) <= 16 && alignof(T) <= 16,
+                  "teamReduce on SYCL needs values of at most 16 bytes");
+    T *partials = reinterpret_cast<T *>(team_scratch_ptr);
+
+    const int num_threads = static_cast<int>(itm->get_local_range().size());
+    const int thread_id = static_cast<int>(itm->get_local_linear_id());
+    const int lane = thread_id % warpSize();
+    const int warp = thread_id / warpSize();
+    const int num_warps = (num_threads + warpSize() - 1) / warpSize();
+
+    for (int i = 1; i < warpSize(); i *= 2) {
+      const T rhs = warpShuffle(val, lane ^ i);
+      if ((thread_id ^ i) < num_threads) {
+        val = op(val, rhs);
+      }
+    }
+    if (lane == 0) {
+      partials[warp] = val;
+    }
+    teamSync();
+
+    if (warp == 0) {
+      val = lane < num_warps ? partials[lane] : identity;
+      for (int i = 1; i < warpSize(); i *= 2) {
+        const T rhs = warpShuffle(val, lane ^ i);
+        if ((thread_id ^ i) < num_threads) {
+          val = op(val, rhs);
+        }
+      }
+      if (lane == 0) {
+        partials[0] = val;
+      }
+    }
+    teamSync();
+
+    val = partials[0];
+    teamSync();
+#else
+    (void)op;
+    (void)identity;
+#endif
+    return val;
+  }
+
+  //! Mask with bit i set when pred is true in lane i
+  RAJA_HOST_DEVICE
+  unsigned long long warpBallot(bool pred) const
+  {
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDA_ARCH__)
+    return ::__ballot_sync(0xffffffffu, pred);
+#elif defined(RAJA_DEVICE_CODE)
+    return ::__ballot(pred);
+#elif defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__)
+    return cl::sycl::reduce_over_group(
+        itm->get_sub_group(),
+        pred ? (1ull << warpLane()) : 0ull,
+        cl::sycl::bit_or<unsigned long long>());
+#else
+    return pred ? 1ull : 0ull;
 #endif
   }
 };
@@ -177,14 +688,215 @@ public:
 template <typename LAUNCH_POLICY>
 struct LaunchExecute;
 
+namespace detail
+{
+
+/*!
+ * Makes the device of a resource of type Res current while a launch on it
+ * is set up. Back-ends with several devices specialize it.
+ */
+template <typename Res>
+struct LaunchDeviceGuard {
+  explicit LaunchDeviceGuard(resources::Resource &) {}
+};
+
+//! Calls the post-launch plugins when a launch returns
+struct LaunchPostPlugins {
+  util::PluginContext &context;
+  ~LaunchPostPlugins() { util::callPostLaunchPlugins(context); }
+};
+
+/*!
+ * Runs exec(body) for a launch with LAUNCH_POL, calling the plugins with
+ * the kernel name of the grid. Device back-ends label their own profiler
+ * ranges, so a range is only pushed here for host launches.
+ */
+template <typename LAUNCH_POL, typename BODY, typename EXEC>
+RAJA_INLINE auto launch_with_plugins(Grid const &grid,
+                                     BODY const &launch_body,
+                                     EXEC &&exec)
+    -> decltype(exec(launch_body))
+{
+  util::PluginContext context{util::make_context<LAUNCH_POL>(grid.kernel_name)};
+  context.num_iterations =
+      static_cast<size_t>(grid.teams.value[0]) * grid.teams.value[1] *
+      grid.teams.value[2] * grid.threads.value[0] * grid.threads.value[1] *
+      grid.threads.value[2];
+  context.pattern = util::KernelPattern::launch;
+  context.policy_name = typeid(LAUNCH_POL).name();
+  context.launch_site = typeid(BODY).name();
+  for (int d = 0; d < 3; ++d) {
+    context.teams[d] = static_cast<size_t>(grid.teams.value[d]);
+    context.threads[d] = static_cast<size_t>(grid.threads.value[d]);
+  }
+  context.bytes = grid.bytes;
+  context.flops = grid.flops;
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto body = trigger_updates_before(launch_body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  LaunchPostPlugins post{context};
+  constexpr bool on_host =
+      RAJA::detail::get_platform<LAUNCH_POL>::value == Platform::host;
+  util::ScopedKernelRange range(on_host ? grid.kernel_name : nullptr);
+
+  return exec(body);
+}
+
+}  // namespace detail
+
+//! Where the data used by a launch lives, for select_place
+enum class Residency { host, device };
+
+/*!
+ * Cost model choosing the place of an AUTO launch. A launch with fewer
+ * iterations of its team and thread loops than threshold runs on the
+ * host, since starting a device kernel costs about as much as
+ * threshold host iterations.
+ */
+struct AutoPlaceModel {
+  //! Seconds to launch and wait for an empty device kernel
+  double launch_seconds{0.0};
+  //! Seconds for one iteration of a simple loop on the host
+  double host_seconds_per_iteration{0.0};
+  Index_type threshold{std::numeric_limits<Index_type>::max()};
+};
+
+//! True when a launch policy list has a device policy to choose
+template <typename POLICY_LIST>
+struct launch_has_device
+#if defined(RAJA_LAUNCH_DEVICE_ACTIVE)
+    : std::integral_constant<
+          bool,
+          !std::is_same<typename POLICY_LIST::host_policy_t,
+                        typename POLICY_LIST::device_policy_t>::value>
+#else
+    : std::false_type
+#endif
+{
+};
+
+namespace detail
+{
+
+//! Number of iterations of the team and thread loops of a grid
+inline Index_type grid_iterations(Grid const &grid)
+{
+  Index_type iterations = 1;
+  for (int d = 0; d < 3; ++d) {
+    iterations *= static_cast<Index_type>(grid.teams.value[d]) *
+                  static_cast<Index_type>(grid.threads.value[d]);
+  }
+  return iterations;
+}
+
+//! Without a device policy every launch runs on the host
+template <typename POLICY_LIST>
+AutoPlaceModel calibrate_auto_place(std::false_type)
+{
+  return AutoPlaceModel{};
+}
+
+/*!
+ * Times empty device launches and a host loop, and sets the threshold
+ * to the number of host iterations that take as long as a launch.
+ */
+template <typename POLICY_LIST>
+AutoPlaceModel calibrate_auto_place(std::true_type)
+{
+  using device_pol = typename POLICY_LIST::device_policy_t;
+  using launch_t = LaunchExecute<device_pol>;
+  constexpr int launch_reps = 16;
+  constexpr Index_type host_iterations = 1 << 16;
+
+  AutoPlaceModel model;
+
+  resources::Resource res{resources::get_default_resource<device_pol>()};
+  LaunchContext ctx{Grid(Teams(1), Threads(1))};
+  auto empty = [=] RAJA_HOST_DEVICE(LaunchContext) {};
+
+  // the first launch also loads the kernel, so it is not timed
+  launch_t::exec(res, ctx, empty);
+  res.wait();
+
+  RAJA::Timer timer;
+  timer.start();
+  for (int r = 0; r < launch_reps; ++r) {
+    launch_t::exec(res, ctx, empty);
+    res.wait();
+  }
+  timer.stop();
+  model.launch_seconds = timer.elapsed() / launch_reps;
+
+  std::vector<double> data(host_iterations, 1.0);
+  timer.reset();
+  timer.start();
+  for (Index_type i = 0; i < host_iterations; ++i) {
+    data[i] = data[i] * 0.5 + 1.0;
+  }
+  timer.stop();
+  volatile double sink = data[host_iterations / 2];
+  (void)sink;
+  model.host_seconds_per_iteration = timer.elapsed() / host_iterations;
+
+  if (model.host_seconds_per_iteration > 0.0) {
+    model.threshold = static_cast<Index_type>(
+        model.launch_seconds / model.host_seconds_per_iteration);
+  }
+  return model;
+}
+
+}  // namespace detail
+
+/*!
+ * The cost model for AUTO launches with POLICY_LIST, calibrated the
+ * first time it is used. Its threshold may be changed to tune or fix the
+ * choice.
+ */
+template <typename POLICY_LIST>
+AutoPlaceModel &auto_place_model()
+{
+  static AutoPlaceModel model = detail::calibrate_auto_place<POLICY_LIST>(
+      launch_has_device<POLICY_LIST>{});
+  return model;
+}
+
+/*!
+ * The place an AUTO launch of grid runs at. Launches on device data run
+ * on the device, other launches run on the host when they are smaller
+ * than the threshold of auto_place_model. Policy lists without a device
+ * policy always give HOST.
+ */
+template <typename POLICY_LIST>
+ExecPlace select_place(Grid const &grid, Residency data = Residency::host)
+{
+  if (!launch_has_device<POLICY_LIST>::value) {
+    return HOST;
+  }
+  if (data == Residency::device) {
+    return DEVICE;
+  }
+  return detail::grid_iterations(grid) < auto_place_model<POLICY_LIST>().threshold
+             ? HOST
+             : DEVICE;
+}
+
 //Policy based launch
 template <typename LAUNCH_POLICY, typename BODY>
 void launch(Grid const &grid, BODY const &body)
 {
   //Take the first policy as we assume the second policy is not user defined.
   //We rely on the user to pair launch and loop policies correctly.
-  using launch_t = LaunchExecute<typename LAUNCH_POLICY::host_policy_t>;
-  launch_t::exec(LaunchContext(grid), body);
+  using launch_pol = typename LAUNCH_POLICY::host_policy_t;
+  using launch_t = LaunchExecute<launch_pol>;
+  detail::launch_with_plugins<launch_pol>(grid, body, [&](auto const &b) {
+    launch_t::exec(LaunchContext(grid), b);
+  });
 }
 
 
@@ -192,16 +904,26 @@ void launch(Grid const &grid, BODY const &body)
 template <typename POLICY_LIST, typename BODY>
 void launch(ExecPlace place, Grid const &grid, BODY const &body)
 {
+  if (place == AUTO) {
+    place = select_place<POLICY_LIST>(grid);
+  }
+
   switch (place) {
     case HOST: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
-      launch_t::exec(LaunchContext(grid), body);
+      using launch_pol = typename POLICY_LIST::host_policy_t;
+      using launch_t = LaunchExecute<launch_pol>;
+      detail::launch_with_plugins<launch_pol>(grid, body, [&](auto const &b) {
+        launch_t::exec(LaunchContext(grid), b);
+      });
       break;
     }
-#ifdef RAJA_DEVICE_ACTIVE
+#ifdef RAJA_LAUNCH_DEVICE_ACTIVE
     case DEVICE: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
-      launch_t::exec(LaunchContext(grid), body);
+      using launch_pol = typename POLICY_LIST::device_policy_t;
+      using launch_t = LaunchExecute<launch_pol>;
+      detail::launch_with_plugins<launch_pol>(grid, body, [&](auto const &b) {
+        launch_t::exec(LaunchContext(grid), b);
+      });
       break;
     }
 #endif
@@ -211,20 +933,20 @@ void launch(ExecPlace place, Grid const &grid, BODY const &body)
 }
 
 // Helper function to retrieve a resource based on the run-time policy - if a device is active
-#if defined(RAJA_DEVICE_ACTIVE)
+#if defined(RAJA_LAUNCH_DEVICE_ACTIVE)
 template<typename T, typename U>
 RAJA::resources::Resource Get_Runtime_Resource(T host_res, U device_res, RAJA::expt::ExecPlace device){
   if(device == RAJA::expt::DEVICE) {return RAJA::resources::Resource(device_res);}
   else { return RAJA::resources::Resource(host_res); }
 }
-#else
+#endif
+
 template<typename T>
 RAJA::resources::Resource Get_Host_Resource(T host_res, RAJA::expt::ExecPlace device){
   if(device == RAJA::expt::DEVICE) {RAJA_ABORT_OR_THROW("Device is not enabled");}
 
   return RAJA::resources::Resource(host_res);
 }
-#endif
 
 
 //Launch API which takes team resource struct
@@ -242,13 +964,23 @@ launch(RAJA::resources::Resource res, Grid const &grid, BODY const &body)
 
   switch (place) {
     case HOST: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
-      return launch_t::exec(res, LaunchContext(grid), body); break;
+      using launch_pol = typename POLICY_LIST::host_policy_t;
+      using launch_t = LaunchExecute<launch_pol>;
+      return detail::launch_with_plugins<launch_pol>(
+          grid, body, [&](auto const &b) {
+            return launch_t::exec(res, LaunchContext(grid), b);
+          });
+      break;
     }
-#ifdef RAJA_DEVICE_ACTIVE
+#ifdef RAJA_LAUNCH_DEVICE_ACTIVE
     case DEVICE: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
-      return launch_t::exec(res, LaunchContext(grid), body); break;
+      using launch_pol = typename POLICY_LIST::device_policy_t;
+      using launch_t = LaunchExecute<launch_pol>;
+      return detail::launch_with_plugins<launch_pol>(
+          grid, body, [&](auto const &b) {
+            return launch_t::exec(res, LaunchContext(grid), b);
+          });
+      break;
     }
 #endif
     default: {
@@ -260,7 +992,8 @@ launch(RAJA::resources::Resource res, Grid const &grid, BODY const &body)
 }
 
 template<typename POLICY_LIST>
-#if defined(RAJA_DEVICE_CODE)
+#if defined(RAJA_DEVICE_CODE) || \
+    (defined(RAJA_ENABLE_SYCL) && defined(__SYCL_DEVICE_ONLY__))
 using loop_policy = typename POLICY_LIST::device_policy_t;
 #else
 using loop_policy = typename POLICY_LIST::host_policy_t;
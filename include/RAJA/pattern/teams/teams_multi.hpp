@@ -0,0 +1,149 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing a launch that splits the teams of a
+ *          grid across several resources.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_multi_HPP
+#define RAJA_pattern_teams_multi_HPP
+
+#include "RAJA/config.hpp"
+
+#include <vector>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Splits num_teams teams into num_parts contiguous ranges whose
+ *        sizes differ by at most one, the larger ones first.
+ *
+ * A partitioner is any callable with this signature; return empty ranges
+ * for the parts that get no teams.
+ */
+struct EvenTeamPartitioner {
+  TypedRangeSegment<int> operator()(int num_teams,
+                                    int num_parts,
+                                    int part) const
+  {
+    const int base = num_teams / num_parts;
+    const int rem = num_teams % num_parts;
+    const int begin = part * base + (part < rem ? part : rem);
+    return TypedRangeSegment<int>(begin, begin + base + (part < rem ? 1 : 0));
+  }
+};
+
+namespace detail
+{
+
+//! Body of the launch of one part, given the teams of that part
+template <typename BODY>
+struct LaunchPartBody {
+  BODY body;
+  TypedRangeSegment<int> teams;
+
+  RAJA_HOST_DEVICE void operator()(LaunchContext ctx) const
+  {
+    body(ctx, teams);
+  }
+};
+
+template <typename POLICY_LIST, typename Res, typename BODY>
+void launch_part(resources::Resource res, Grid const &grid, BODY const &body)
+{
+  LaunchDeviceGuard<Res> guard(res);
+  launch<POLICY_LIST>(res, grid, body);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Launch the teams of grid across several resources, such as
+ *        streams of one device or one stream for each device.
+ *
+ * The x extent of the teams is split by partition, and each resource runs
+ * a launch with the teams of its part. The body takes the context and the
+ * range of teams of its launch, and loops over that range with its team
+ * policy:
+ *
+ *   auto events = launch<launch_pol>(resources, Grid(Teams(NE), Threads(Q)),
+ *       [=] RAJA_HOST_DEVICE(LaunchContext ctx, TypedRangeSegment<int> teams) {
+ *         loop<team_x>(ctx, teams, [&](int e) { ... });
+ *       });
+ *   for (auto& e : events) { e.wait(); }
+ *
+ * Launches on device resources are set up with the device of the resource
+ * current. The returned events, one for each resource, complete with the
+ * launch on that resource.
+ */
+template <typename POLICY_LIST,
+          typename BODY,
+          typename PARTITIONER = EvenTeamPartitioner>
+std::vector<resources::Event> launch(
+    std::vector<resources::Resource> const &resources,
+    Grid const &grid,
+    BODY const &body,
+    PARTITIONER const &partition = PARTITIONER{})
+{
+  std::vector<resources::Event> events;
+  events.reserve(resources.size());
+
+  const int num_parts = static_cast<int>(resources.size());
+  for (int part = 0; part < num_parts; ++part) {
+    resources::Resource res = resources[part];
+
+    const TypedRangeSegment<int> teams =
+        partition(grid.teams.value[0], num_parts, part);
+
+    Grid part_grid(grid);
+    part_grid.teams.value[0] = static_cast<int>(teams.size());
+
+    detail::LaunchPartBody<camp::decay<BODY>> part_body{body, teams};
+
+    switch (res.get_platform()) {
+#if defined(RAJA_CUDA_ACTIVE)
+      case camp::resources::v1::Platform::cuda:
+        detail::launch_part<POLICY_LIST, resources::Cuda>(res, part_grid, part_body);
+        break;
+#endif
+#if defined(RAJA_HIP_ACTIVE)
+      case camp::resources::v1::Platform::hip:
+        detail::launch_part<POLICY_LIST, resources::Hip>(res, part_grid, part_body);
+        break;
+#endif
+      default:
+        detail::launch_part<POLICY_LIST, resources::Resource>(res, part_grid, part_body);
+        break;
+    }
+
+    events.push_back(res.get_event());
+  }
+
+  return events;
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_teams_multi_HPP
@@ -0,0 +1,101 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing team loops over the rows of a
+ *          ragged segment.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_ragged_HPP
+#define RAJA_pattern_teams_ragged_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/RaggedSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Loop over the positions of row of segment, distributed by
+ *        POLICY_LIST, calling body(k, segment[k]) with each position k and
+ *        the index at it.
+ *
+ * Whether a row goes to a thread or to a warp is the choice of the loops:
+ *
+ *   // a row per thread
+ *   loop<global_thread_x>(ctx, RangeSegment(0, nrows), [&](int e) {
+ *     loop_ragged<seq_loop>(ctx, nbrs, e, [&](int k, int n) { ... });
+ *   });
+ *
+ *   // a row per warp, with the lanes striding over it
+ *   loop<warp_y>(ctx, RangeSegment(0, nrows), [&](int e) {
+ *     loop_ragged<lane_x_loop>(ctx, nbrs, e, [&](int k, int n) { ... });
+ *   });
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename IDX,
+          typename OFFSET,
+          typename ROW,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_ragged(
+    CONTEXT const &ctx,
+    TypedRaggedSegment<IDX, OFFSET> const &segment,
+    ROW row,
+    BODY const &body)
+{
+  loop<POLICY_LIST>(ctx, segment.row(row), [&](OFFSET k) {
+    body(k, segment[k]);
+  });
+}
+
+/*!
+ * \brief Loop over the rows of segment in num_parts parts with about the
+ *        same number of positions, with the parts distributed by
+ *        POLICY_LIST, and the rows of a part run in order.
+ *
+ * With a host thread policy and num_parts the number of threads each
+ * thread gets about nnz / num_parts positions however long the rows are,
+ * where a loop over rows would balance only the number of rows.
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename IDX,
+          typename OFFSET,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_ragged_balanced(
+    CONTEXT const &ctx,
+    TypedRaggedSegment<IDX, OFFSET> const &segment,
+    Index_type num_parts,
+    BODY const &body)
+{
+  loop<POLICY_LIST>(ctx, TypedRangeSegment<Index_type>(0, num_parts),
+                    [&](Index_type part) {
+    for (Index_type r : segment.partition_rows(part, num_parts)) {
+      body(r);
+    }
+  });
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_teams_ragged_HPP
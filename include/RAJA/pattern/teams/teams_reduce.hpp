@@ -0,0 +1,173 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing reductions that combine the values of
+ *          a team before combining the values of the teams.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_reduce_HPP
+#define RAJA_pattern_teams_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void team_reduce_atomic(operators::plus<T>,
+                                                     T *acc,
+                                                     T val)
+{
+  RAJA::atomicAdd<RAJA::auto_atomic>(acc, val);
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void team_reduce_atomic(operators::minimum<T>,
+                                                     T *acc,
+                                                     T val)
+{
+  RAJA::atomicMin<RAJA::auto_atomic>(acc, val);
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void team_reduce_atomic(operators::maximum<T>,
+                                                     T *acc,
+                                                     T val)
+{
+  RAJA::atomicMax<RAJA::auto_atomic>(acc, val);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Reduction for RAJA::launch bodies that combines the values of the
+ *        threads of a team with LaunchContext::teamReduce, and then adds the
+ *        value of the team to the result with one atomic.
+ *
+ * There is no per thread state and no combining of copies when the launch
+ * ends: copies captured by the body all refer to one value in the memory
+ * of the resource, which get() reads back.
+ *
+ *   TeamReduceSum<double> sum(res, 0.0);
+ *   launch<launch_pol>(place, grid, [=] RAJA_HOST_DEVICE(LaunchContext ctx) {
+ *     loop<team_pol>(ctx, teams, [&](int t) {
+ *       double part = 0.0;
+ *       loop<thread_pol>(ctx, range, [&](int i) { part += x[t][i]; });
+ *       sum.combine(ctx, part);
+ *     });
+ *   });
+ *   double total = sum.get();
+ *
+ * combine must be called by every thread of the team, outside the thread
+ * loops, like teamReduce. Op is one of RAJA::operators::plus, minimum or
+ * maximum.
+ */
+template <typename T, typename Op>
+class TeamReduction
+{
+public:
+  TeamReduction(resources::Resource res, T identity)
+      : m_res(new resources::Resource(res)),
+        m_data(res.allocate<T>(1)),
+        m_identity(identity),
+        m_owner(true)
+  {
+    reset(identity);
+  }
+
+  //! Copies refer to the value of the reduction they were copied from
+  RAJA_HOST_DEVICE
+  TeamReduction(TeamReduction const &other)
+      : m_res(other.m_res),
+        m_data(other.m_data),
+        m_identity(other.m_identity),
+        m_owner(false)
+  {
+  }
+
+  TeamReduction &operator=(TeamReduction const &) = delete;
+
+  RAJA_HOST_DEVICE
+  ~TeamReduction()
+  {
+#if !defined(RAJA_DEVICE_CODE)
+    if (m_owner) {
+      m_res->deallocate(m_data);
+      delete m_res;
+    }
+#endif
+  }
+
+  //! Add the values of the threads of the team to the reduction
+  RAJA_HOST_DEVICE
+  void combine(LaunchContext &ctx, T val) const
+  {
+    const T team = ctx.teamReduce(val, Op{}, m_identity);
+#if defined(RAJA_DEVICE_CODE)
+    if (threadIdx.x != 0 || threadIdx.y != 0 || threadIdx.z != 0) {
+      return;
+    }
+#endif
+    detail::team_reduce_atomic(Op{}, m_data, team);
+  }
+
+  //! Value of the reduction, after waiting for the resource
+  T get() const
+  {
+    T val;
+    m_res->memcpy(&val, m_data, sizeof(T));
+    m_res->wait();
+    return val;
+  }
+
+  //! Start the reduction again from val
+  void reset(T val)
+  {
+    m_res->memcpy(m_data, &val, sizeof(T));
+    m_res->wait();
+  }
+
+private:
+  resources::Resource *m_res;
+  T *m_data;
+  T m_identity;
+  bool m_owner;
+};
+
+template <typename T>
+using TeamReduceSum = TeamReduction<T, operators::plus<T>>;
+
+template <typename T>
+using TeamReduceMin = TeamReduction<T, operators::minimum<T>>;
+
+template <typename T>
+using TeamReduceMax = TeamReduction<T, operators::maximum<T>>;
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_teams_reduce_HPP
@@ -0,0 +1,119 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing helpers to stage tiles of a View in
+ *          team shared memory with asynchronous copies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_stage_HPP
+#define RAJA_pattern_teams_stage_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/async_copy.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Buffers for Stages tiles of Rows x Cols values, to be declared
+ *        RAJA_TEAM_SHARED.
+ *
+ * Step k of a loop over tiles uses tile(k), so Stages - 1 tiles can be in
+ * flight while a team works on the current one:
+ *
+ *   RAJA_TEAM_SHARED StagedTiles<double, 16, 16, 3> As;
+ *
+ *   for (int k = 0; k < 2; ++k) {                     // prologue
+ *     stage_tile<row_pol, col_pol>(ctx, As.tile(k), 16, A, r0, k*16, 16, 16);
+ *   }
+ *   for (int k = 0; k < num_tiles; ++k) {
+ *     stage_tile<row_pol, col_pol>(ctx, As.tile(k + 2), 16, A,
+ *                                  r0, (k+2)*16, k + 2 < num_tiles ? 16 : 0, 16);
+ *     stage_wait<3>(ctx);                             // tile k is ready
+ *     ... use As.tile(k) ...
+ *     ctx.teamSync();                                 // before it is reused
+ *   }
+ */
+template <typename T, int Rows, int Cols, int Stages>
+struct StagedTiles {
+  static_assert(Stages >= 1, "StagedTiles needs at least one stage");
+
+  static constexpr int rows = Rows;
+  static constexpr int cols = Cols;
+  static constexpr int stages = Stages;
+
+  T data[Stages][Rows * Cols];
+
+  RAJA_HOST_DEVICE RAJA_INLINE T* tile(Index_type step)
+  {
+    return data[step % Stages];
+  }
+};
+
+/*!
+ * \brief Start copying rows x cols values of a 2-D View, from
+ *        (row0, col0), to tile with a row stride of ld.
+ *
+ * The threads of the team share the copies among them, with the loop
+ * policies given for rows and columns, and then commit them as one group.
+ * Each step of a pipeline must call stage_tile exactly once, with no rows
+ * when there is nothing left to stage, so the groups stay in step with
+ * stage_wait.
+ */
+template <typename ROW_POLICY,
+          typename COL_POLICY,
+          typename T,
+          typename SrcView>
+RAJA_HOST_DEVICE RAJA_INLINE void stage_tile(LaunchContext const& ctx,
+                                             T* tile,
+                                             Index_type ld,
+                                             SrcView const& src,
+                                             Index_type row0,
+                                             Index_type col0,
+                                             Index_type rows,
+                                             Index_type cols)
+{
+  loop<ROW_POLICY>(ctx, TypedRangeSegment<Index_type>(0, rows), [&](Index_type r) {
+    loop<COL_POLICY>(ctx, TypedRangeSegment<Index_type>(0, cols), [&](Index_type c) {
+      async_copy(&tile[r * ld + c], &src(row0 + r, col0 + c));
+    });
+  });
+  async_copy_commit();
+}
+
+/*!
+ * \brief Wait for the oldest tile of a pipeline of Stages stages, and make
+ *        it visible to the whole team.
+ */
+template <int Stages>
+RAJA_HOST_DEVICE RAJA_INLINE void stage_wait(LaunchContext& ctx)
+{
+  static_assert(Stages >= 1, "stage_wait needs at least one stage");
+  async_copy_wait<Stages - 1>();
+  ctx.teamSync();
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_teams_stage_HPP
@@ -0,0 +1,206 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing time-tiled stencil launches.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_time_tiling_HPP
+#define RAJA_pattern_teams_time_tiling_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Shape of the tiles of a time-tiled stencil.
+ *
+ * radius is the number of points on each side a point reads from the
+ * previous step, space_tile the number of points in a tile and time_tile
+ * the number of steps run on a tile before moving to the next tile.
+ */
+struct TimeTiling {
+  Index_type radius;
+  Index_type space_tile;
+  Index_type time_tile;
+
+  TimeTiling(Index_type radius_, Index_type space_tile_, Index_type time_tile_)
+      : radius(radius_), space_tile(space_tile_), time_tile(time_tile_)
+  {
+  }
+};
+
+namespace detail
+{
+
+//! Points of shrinking tile j updated at step s of a band
+RAJA_HOST_DEVICE RAJA_INLINE void time_tile_bounds(Index_type begin,
+                                                   Index_type end,
+                                                   Index_type space_tile,
+                                                   Index_type radius,
+                                                   Index_type num_tiles,
+                                                   Index_type j,
+                                                   Index_type s,
+                                                   Index_type &lo,
+                                                   Index_type &hi)
+{
+  // tiles at the ends of the space do not shrink there, the points beyond
+  // are ghosts that are never updated
+  lo = (j == 0) ? begin : begin + j * space_tile + s * radius;
+  hi = (j == num_tiles - 1) ? end : begin + (j + 1) * space_tile - s * radius;
+}
+
+//! Points of the growing gap before tile j updated at step s of a band
+RAJA_HOST_DEVICE RAJA_INLINE void time_gap_bounds(Index_type begin,
+                                                  Index_type end,
+                                                  Index_type space_tile,
+                                                  Index_type radius,
+                                                  Index_type j,
+                                                  Index_type s,
+                                                  Index_type &lo,
+                                                  Index_type &hi)
+{
+  const Index_type edge = begin + j * space_tile;
+  lo = edge - s * radius;
+  hi = edge + s * radius < end ? edge + s * radius : end;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Run num_steps steps of a stencil over space, several steps per
+ *        tile.
+ *
+ * body(step, i) updates point i from the values of step, in
+ * [i - radius, i + radius], into the values of step + 1. Steps must read
+ * and write different arrays, as with the two arrays of a Jacobi
+ * iteration alternating between steps, and points outside space must hold
+ * fixed (ghost) values in both arrays.
+ *
+ * The steps are run time_tile at a time, in two launches. The first runs
+ * each tile of space_tile points as one team, its edges shrinking by the
+ * radius each step so it only reads points it has updated itself. The
+ * second fills the gaps between tiles, growing from the tile edges. A
+ * team runs all the steps of its tile before any other tile, so a tile
+ * that fits in the cache (or in the shared memory of a GPU block) is read
+ * from memory once every time_tile steps instead of every step.
+ *
+ * The threads of a team share the points of each step, separated by
+ * teamSync. time_tile is reduced to fit in the tiles when
+ * space_tile < 2 * radius * (time_tile - 1).
+ *
+ * For multi-dimensional grids space is the outermost dimension and body
+ * updates the row or plane of point i.
+ */
+template <typename LAUNCH_POLICY,
+          typename TEAM_POLICY,
+          typename THREAD_POLICY,
+          typename IndexType,
+          typename BODY>
+void launch_time_tiled(ExecPlace place,
+                       Index_type num_threads,
+                       TypedRangeSegment<IndexType> const &space,
+                       Index_type num_steps,
+                       TimeTiling const &tiling,
+                       BODY const &body)
+{
+  const Index_type begin = static_cast<Index_type>(*space.begin());
+  const Index_type end = static_cast<Index_type>(*space.end());
+  const Index_type radius = tiling.radius;
+
+  if (end <= begin || num_steps <= 0) {
+    return;
+  }
+
+  if (tiling.space_tile <= 0 || radius < 0) {
+    RAJA_ABORT_OR_THROW("launch_time_tiled needs a positive tile size");
+  }
+
+  const Index_type space_tile = tiling.space_tile;
+  const Index_type num_tiles = (end - begin + space_tile - 1) / space_tile;
+
+  Index_type time_tile = tiling.time_tile > 0 ? tiling.time_tile : 1;
+  if (radius > 0 && time_tile - 1 > space_tile / (2 * radius)) {
+    time_tile = space_tile / (2 * radius) + 1;
+  }
+
+  for (Index_type t0 = 0; t0 < num_steps; t0 += time_tile) {
+
+    const Index_type band =
+        num_steps - t0 < time_tile ? num_steps - t0 : time_tile;
+
+    launch<LAUNCH_POLICY>(
+        place,
+        Grid(Teams(static_cast<int>(num_tiles)),
+             Threads(static_cast<int>(num_threads))),
+        [=] RAJA_HOST_DEVICE(LaunchContext ctx) {
+          loop<TEAM_POLICY>(
+              ctx, TypedRangeSegment<Index_type>(0, num_tiles), [&](Index_type j) {
+                for (Index_type s = 0; s < band; ++s) {
+                  Index_type lo, hi;
+                  detail::time_tile_bounds(
+                      begin, end, space_tile, radius, num_tiles, j, s, lo, hi);
+                  if (lo < hi) {
+                    loop<THREAD_POLICY>(
+                        ctx, TypedRangeSegment<IndexType>(lo, hi), [&](IndexType i) {
+                          body(t0 + s, i);
+                        });
+                  }
+                  ctx.teamSync();
+                }
+              });
+        });
+
+    if (num_tiles < 2 || band < 2 || radius == 0) {
+      // no gap points are left at step 0, or without a radius
+      continue;
+    }
+
+    launch<LAUNCH_POLICY>(
+        place,
+        Grid(Teams(static_cast<int>(num_tiles - 1)),
+             Threads(static_cast<int>(num_threads))),
+        [=] RAJA_HOST_DEVICE(LaunchContext ctx) {
+          loop<TEAM_POLICY>(
+              ctx, TypedRangeSegment<Index_type>(1, num_tiles), [&](Index_type j) {
+                for (Index_type s = 1; s < band; ++s) {
+                  Index_type lo, hi;
+                  detail::time_gap_bounds(
+                      begin, end, space_tile, radius, j, s, lo, hi);
+                  if (lo < hi) {
+                    loop<THREAD_POLICY>(
+                        ctx, TypedRangeSegment<IndexType>(lo, hi), [&](IndexType i) {
+                          body(t0 + s, i);
+                        });
+                  }
+                  ctx.teamSync();
+                }
+              });
+        });
+  }
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_teams_time_tiling_HPP
@@ -0,0 +1,159 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing team loops that give each step a
+ *          compile time number of consecutive indices, for register
+ *          blocking.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_unroll_HPP
+#define RAJA_pattern_teams_unroll_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief N consecutive indices starting at first, of which the first count
+ *        are in the segment.
+ *
+ * count is N except in the last block of a segment whose length is not a
+ * multiple of N. for_each is unrolled at compile time, so per-index values
+ * in arrays of N indexed by its k stay in registers:
+ *
+ *   double acc[4] = {0.0, 0.0, 0.0, 0.0};
+ *   for (int j = 0; j < n; ++j) {
+ *     blk.for_each([&](int k, int row) { acc[k] += A(row, j) * x[j]; });
+ *   }
+ *   blk.for_each([&](int k, int row) { y[row] = acc[k]; });
+ */
+template <typename IDX, int N>
+struct RegisterBlock {
+  static_assert(N >= 1, "RegisterBlock needs at least one index");
+
+  static constexpr int size = N;
+
+  IDX first;
+  IDX count;
+
+  RAJA_HOST_DEVICE RAJA_INLINE IDX operator[](int k) const
+  {
+    return first + static_cast<IDX>(k);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE bool valid(int k) const
+  {
+    return static_cast<IDX>(k) < count;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE bool full() const
+  {
+    return count == static_cast<IDX>(N);
+  }
+
+  //! Call f(k, index k) for each index in the segment, unrolled
+  template <typename F>
+  RAJA_HOST_DEVICE RAJA_INLINE void for_each(F &&f) const
+  {
+    if (full()) {
+      apply_all(f, camp::make_idx_seq_t<N>{});
+    } else {
+      apply_valid(f, camp::make_idx_seq_t<N>{});
+    }
+  }
+
+private:
+  template <typename F, camp::idx_t... Ks>
+  RAJA_HOST_DEVICE RAJA_INLINE void apply_all(F &f,
+                                              camp::idx_seq<Ks...>) const
+  {
+    int unused[] = {0, (f(static_cast<int>(Ks), (*this)[Ks]), 0)...};
+    (void)unused;
+  }
+
+  template <typename F, camp::idx_t... Ks>
+  RAJA_HOST_DEVICE RAJA_INLINE void apply_valid(F &f,
+                                                camp::idx_seq<Ks...>) const
+  {
+    int unused[] = {
+        0, (valid(Ks) ? (f(static_cast<int>(Ks), (*this)[Ks]), 0) : 0)...};
+    (void)unused;
+  }
+};
+
+/*!
+ * \brief Loop over segment in blocks of N consecutive indices, with the
+ *        blocks distributed by POLICY_LIST, and body called with each block
+ *        as a RegisterBlock.
+ *
+ * With a thread policy each thread of a team gets N consecutive indices
+ * per step, so the body can keep N partial results in registers.
+ */
+template <typename POLICY_LIST,
+          int N,
+          typename CONTEXT,
+          typename IDX,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void tile_register(
+    CONTEXT const &ctx,
+    TypedRangeSegment<IDX> const &segment,
+    BODY const &body)
+{
+  const IDX first = *segment.begin();
+  const IDX len = static_cast<IDX>(segment.size());
+  const IDX num_blocks = (len + static_cast<IDX>(N) - 1) / static_cast<IDX>(N);
+
+  loop<POLICY_LIST>(ctx, TypedRangeSegment<IDX>(0, num_blocks), [&](IDX b) {
+    const IDX offset = b * static_cast<IDX>(N);
+    const IDX rest = len - offset;
+    body(RegisterBlock<IDX, N>{first + offset,
+                               rest < static_cast<IDX>(N) ? rest
+                                                          : static_cast<IDX>(N)});
+  });
+}
+
+/*!
+ * \brief Loop over segment like loop, with each step of POLICY_LIST
+ *        calling body for N consecutive indices in unrolled code.
+ */
+template <typename POLICY_LIST,
+          int N,
+          typename CONTEXT,
+          typename IDX,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_unrolled(
+    CONTEXT const &ctx,
+    TypedRangeSegment<IDX> const &segment,
+    BODY const &body)
+{
+  tile_register<POLICY_LIST, N>(ctx, segment, [&](RegisterBlock<IDX, N> const &blk) {
+    blk.for_each([&](int, IDX i) { body(i); });
+  });
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_teams_unroll_HPP
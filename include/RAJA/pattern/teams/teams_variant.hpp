@@ -0,0 +1,162 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for launching a teams kernel with one of a list
+ *          of launch policies chosen at run time.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_variant_HPP
+#define RAJA_pattern_teams_variant_HPP
+
+#include "RAJA/config.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/KernelVariant.hpp"
+#include "RAJA/pattern/kernel/TileTuner.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+//! Launch the body with launch policy variant of PolicyList
+template <typename PolicyList>
+struct launch_variant_invoker;
+
+template <typename POLICY_LIST, typename... Rest>
+struct launch_variant_invoker<camp::list<POLICY_LIST, Rest...>> {
+
+  template <typename BODY>
+  static RAJA_INLINE resources::EventProxy<resources::Resource> invoke(
+      int variant,
+      resources::Resource res,
+      Grid const &grid,
+      BODY const &body)
+  {
+    if (variant == 0) {
+      return launch<POLICY_LIST>(res, grid, body);
+    }
+    return launch_variant_invoker<camp::list<Rest...>>::invoke(variant - 1,
+                                                               res,
+                                                               grid,
+                                                               body);
+  }
+};
+
+template <>
+struct launch_variant_invoker<camp::list<>> {
+
+  template <typename BODY>
+  static RAJA_INLINE resources::EventProxy<resources::Resource> invoke(
+      int,
+      resources::Resource res,
+      Grid const &,
+      BODY const &)
+  {
+    RAJA_ABORT_OR_THROW("launch_variant: variant index out of range");
+    return resources::EventProxy<resources::Resource>(res);
+  }
+};
+
+//! Key of a launch, its name and the sizes of its grid
+inline std::string launch_variant_key(std::string const &name,
+                                      Grid const &grid)
+{
+  std::ostringstream os;
+  os << name << "#variant:" << grid.teams.value[0] << 'x'
+     << grid.teams.value[1] << 'x' << grid.teams.value[2] << ':'
+     << grid.threads.value[0] << 'x' << grid.threads.value[1] << 'x'
+     << grid.threads.value[2];
+  return os.str();
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Launch a teams kernel with launch policy number variant of
+ *        PolicyList, a camp::list of LaunchPolicy types.
+ *
+ * The loop policies used by the body are fixed, so the variants differ in
+ * how the kernel is launched, e.g. synchronous or asynchronous launches or
+ * different thread counts.
+ */
+template <typename PolicyList, typename BODY>
+resources::EventProxy<resources::Resource> launch_variant(
+    int variant,
+    resources::Resource res,
+    Grid const &grid,
+    BODY const &body)
+{
+  return detail::launch_variant_invoker<PolicyList>::invoke(variant,
+                                                            res,
+                                                            grid,
+                                                            body);
+}
+
+/*!
+ * \brief Launch a teams kernel with the launch policy variant chosen for it
+ *        by cache, timing each variant in turn until they are all timed.
+ *
+ * The choice is keyed by name and the sizes of the grid.
+ */
+template <typename PolicyList, typename BODY>
+resources::EventProxy<resources::Resource> launch_variant_tuned(
+    TileTuningCache &cache,
+    std::string const &name,
+    resources::Resource res,
+    Grid const &grid,
+    BODY const &body)
+{
+  constexpr int num_variants = camp::size<PolicyList>::value;
+
+  const std::string key = detail::launch_variant_key(name, grid);
+
+  std::vector<camp::idx_t> const *chosen = cache.find(key);
+  if (chosen != nullptr && chosen->size() == 1) {
+    return launch_variant<PolicyList>(static_cast<int>((*chosen)[0]),
+                                      res,
+                                      grid,
+                                      body);
+  }
+
+  const int trial = cache.nextTrial(key, num_variants);
+
+  const double seconds = detail::time_variant(res, [&]() {
+    launch_variant<PolicyList>(trial, res, grid, body);
+  });
+
+  cache.recordTrial(key,
+                    num_variants,
+                    std::vector<camp::idx_t>{static_cast<camp::idx_t>(trial)},
+                    seconds);
+  return resources::EventProxy<resources::Resource>(res);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_pattern_teams_variant_HPP
@@ -32,6 +32,8 @@
 #include "RAJA/pattern/tensor/internal/VectorRegisterImpl.hpp"
 
 
+#include "RAJA/pattern/tensor/TensorBatch.hpp"
+#include "RAJA/pattern/tensor/TensorSparse.hpp"
 #include "RAJA/pattern/tensor/TensorBlock.hpp"
 
 #endif
@@ -0,0 +1,315 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining batches of small matrices that are
+ *          vectorized across the batch.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_TensorBatch_HPP
+#define RAJA_pattern_tensor_TensorBatch_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "camp/camp.hpp"
+#include "RAJA/pattern/tensor/TensorLayout.hpp"
+#include "RAJA/pattern/tensor/TensorRegister.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * A batch of ROWS x COLS matrices, one in each lane of a register.
+   *
+   * Element (i, j) of every matrix of the batch is held in one register, so
+   * batch arithmetic is the scalar algorithm applied to whole registers: a
+   * product is ROWS*COLS*K FMAs with no shuffles or horizontal reductions,
+   * however small the matrices are. For SIMD registers the batch is spread
+   * across lanes, and for the GPU warp/wavefront registers across threads.
+   *
+   * Batches are loaded from and stored to the BatchInterleavedLayout of the
+   * register width, one group of s_batch_size matrices at a time:
+   *
+   *   using batch_t = RAJA::expt::BatchMatrix<double, 8, 8>;
+   *   using layout_t = batch_t::layout_type;
+   *
+   *   for(camp::idx_t g = 0;g < layout_t::num_groups(num_elem);++ g){
+   *     batch_t K;
+   *     K.load_group(stiffness, g, num_elem);
+   *     batch_t KB = K * B;
+   *     ...
+   *   }
+   */
+  template<typename T, camp::idx_t ROWS, camp::idx_t COLS, typename REGISTER_POLICY = default_register>
+  class BatchMatrix
+  {
+    public:
+      using self_type = BatchMatrix<T, ROWS, COLS, REGISTER_POLICY>;
+      using element_type = T;
+      using register_policy = REGISTER_POLICY;
+      using register_type = Register<T, REGISTER_POLICY>;
+      using transpose_type = BatchMatrix<T, COLS, ROWS, REGISTER_POLICY>;
+
+      static constexpr camp::idx_t s_num_rows = ROWS;
+      static constexpr camp::idx_t s_num_columns = COLS;
+      static constexpr camp::idx_t s_batch_size = register_type::s_num_elem;
+
+      using layout_type = BatchInterleavedLayout<s_batch_size, ROWS, COLS>;
+
+    private:
+      register_type m_registers[ROWS*COLS];
+
+    public:
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      BatchMatrix(){}
+
+      //! Broadcasts c to all elements of all matrices
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      explicit
+      BatchMatrix(element_type c)
+      {
+        broadcast(c);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &broadcast(element_type c){
+        for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+          m_registers[e].broadcast(c);
+        }
+        return *this;
+      }
+
+      //! Register holding element (row, col) of every matrix
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      register_type &operator()(camp::idx_t row, camp::idx_t col){
+        return m_registers[row*COLS + col];
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      register_type const &operator()(camp::idx_t row, camp::idx_t col) const {
+        return m_registers[row*COLS + col];
+      }
+
+      //! Element (row, col) of matrix batch
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type get(camp::idx_t batch, camp::idx_t row, camp::idx_t col) const {
+        return m_registers[row*COLS + col].get(batch);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &set(element_type value, camp::idx_t batch, camp::idx_t row, camp::idx_t col){
+        m_registers[row*COLS + col].set(value, batch);
+        return *this;
+      }
+
+
+      /*!
+       * Loads one interleaved group, which starts at ptr
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr){
+        for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+          m_registers[e].load_packed(ptr + e*s_batch_size);
+        }
+        return *this;
+      }
+
+      /*!
+       * Loads the first num_batch matrices of an interleaved group, and
+       * zeroes the others
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_n(element_type const *ptr, camp::idx_t num_batch){
+        for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+          m_registers[e].load_packed_n(ptr + e*s_batch_size, num_batch);
+        }
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr) const {
+        for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+          m_registers[e].store_packed(ptr + e*s_batch_size);
+        }
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_n(element_type *ptr, camp::idx_t num_batch) const {
+        for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+          m_registers[e].store_packed_n(ptr + e*s_batch_size, num_batch);
+        }
+        return *this;
+      }
+
+      /*!
+       * Loads group of an interleaved array of num_batch matrices.
+       *
+       * The last group is loaded partially, so its padding need not be
+       * initialized.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_group(element_type const *ptr, camp::idx_t group, camp::idx_t num_batch){
+        camp::idx_t n = num_batch - group*s_batch_size;
+        if(n >= s_batch_size){
+          return load_packed(ptr + layout_type::group_offset(group));
+        }
+        return load_packed_n(ptr + layout_type::group_offset(group), n);
+      }
+
+      /*!
+       * Stores group of an interleaved array of num_batch matrices, leaving
+       * the padding of the last group untouched
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_group(element_type *ptr, camp::idx_t group, camp::idx_t num_batch) const {
+        camp::idx_t n = num_batch - group*s_batch_size;
+        if(n >= s_batch_size){
+          return store_packed(ptr + layout_type::group_offset(group));
+        }
+        return store_packed_n(ptr + layout_type::group_offset(group), n);
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type add(self_type const &b) const {
+        self_type r;
+        for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+          r.m_registers[e] = m_registers[e].add(b.m_registers[e]);
+        }
+        return r;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type subtract(self_type const &b) const {
+        self_type r;
+        for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+          r.m_registers[e] = m_registers[e].subtract(b.m_registers[e]);
+        }
+        return r;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type scale(element_type c) const {
+        self_type r;
+        for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+          r.m_registers[e] = m_registers[e].scale(c);
+        }
+        return r;
+      }
+
+      /*!
+       * Returns acc + this*b for each matrix of the batch
+       */
+      template<camp::idx_t K>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      BatchMatrix<T, ROWS, K, REGISTER_POLICY>
+      multiply_accumulate(BatchMatrix<T, COLS, K, REGISTER_POLICY> const &b,
+                          BatchMatrix<T, ROWS, K, REGISTER_POLICY> const &acc) const
+      {
+        BatchMatrix<T, ROWS, K, REGISTER_POLICY> r(acc);
+        for(camp::idx_t i = 0;i < ROWS;++ i){
+          for(camp::idx_t j = 0;j < K;++ j){
+            register_type c = r(i, j);
+            for(camp::idx_t k = 0;k < COLS;++ k){
+              c = (*this)(i, k).multiply_add(b(k, j), c);
+            }
+            r(i, j) = c;
+          }
+        }
+        return r;
+      }
+
+      //! Product of each matrix of the batch with the same matrix of b
+      template<camp::idx_t K>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      BatchMatrix<T, ROWS, K, REGISTER_POLICY>
+      multiply(BatchMatrix<T, COLS, K, REGISTER_POLICY> const &b) const
+      {
+        return multiply_accumulate(b, BatchMatrix<T, ROWS, K, REGISTER_POLICY>(element_type(0)));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      transpose_type transpose() const {
+        transpose_type r;
+        for(camp::idx_t i = 0;i < ROWS;++ i){
+          for(camp::idx_t j = 0;j < COLS;++ j){
+            r(j, i) = (*this)(i, j);
+          }
+        }
+        return r;
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator+(self_type const &b) const {
+        return add(b);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator-(self_type const &b) const {
+        return subtract(b);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator*(element_type c) const {
+        return scale(c);
+      }
+
+      template<camp::idx_t K>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      BatchMatrix<T, ROWS, K, REGISTER_POLICY>
+      operator*(BatchMatrix<T, COLS, K, REGISTER_POLICY> const &b) const {
+        return multiply(b);
+      }
+  };
+
+
+  //! A batch of N element vectors, one in each register lane
+  template<typename T, camp::idx_t N, typename REGISTER_POLICY = default_register>
+  using BatchVector = BatchMatrix<T, N, 1, REGISTER_POLICY>;
+
+
+} // namespace expt
+}  // namespace RAJA
+
+
+#endif
@@ -0,0 +1,115 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file with explicit instantiations of the common tensor
+ *          register types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_TensorInstantiate_HPP
+#define RAJA_pattern_tensor_TensorInstantiate_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/pattern/tensor.hpp"
+#include "RAJA/policy/tensor.hpp"
+
+/*
+ * Every translation unit that uses a tensor register instantiates all of
+ * its members again.  With RAJA_ENABLE_TENSOR_INSTANTIATIONS the RAJA
+ * library instantiates the common ones once, and the other translation
+ * units only declare them:
+ *
+ *   - the full width VectorRegister of float and double, and
+ *   - the row and column major SquareMatrixRegister of float and double,
+ *
+ * for the scalar register and for every x86 register the RAJA flags
+ * enable.  Codes with other common types can instantiate them the same way,
+ * in one of their own sources:
+ *
+ *   RAJA_TENSOR_INSTANTIATE_POLICY(template, my_register_policy)
+ *
+ * and in the header the other sources include:
+ *
+ *   RAJA_TENSOR_INSTANTIATE_POLICY(extern template, my_register_policy)
+ *
+ * Register operations are still inlined where they are used. What is saved
+ * is the repeated instantiation and code generation of the members, so a
+ * file that sees the extern declarations must be compiled with the same
+ * instruction set flags as RAJA.
+ */
+
+#define RAJA_TENSOR_INSTANTIATE_TYPE(PREFIX, REGISTER_POLICY, T) \
+  PREFIX class RAJA::expt::TensorRegister<REGISTER_POLICY, T, \
+      RAJA::expt::VectorLayout, \
+      camp::idx_seq<RAJA::internal::expt::RegisterTraits<REGISTER_POLICY, T>::s_num_elem>>; \
+  PREFIX class RAJA::expt::TensorRegister<REGISTER_POLICY, T, \
+      RAJA::expt::RowMajorLayout, \
+      camp::idx_seq<RAJA::internal::expt::RegisterTraits<REGISTER_POLICY, T>::s_num_elem, \
+                    RAJA::internal::expt::RegisterTraits<REGISTER_POLICY, T>::s_num_elem>>; \
+  PREFIX class RAJA::expt::TensorRegister<REGISTER_POLICY, T, \
+      RAJA::expt::ColMajorLayout, \
+      camp::idx_seq<RAJA::internal::expt::RegisterTraits<REGISTER_POLICY, T>::s_num_elem, \
+                    RAJA::internal::expt::RegisterTraits<REGISTER_POLICY, T>::s_num_elem>>;
+
+/*!
+ * Instantiates, with PREFIX template, or declares, with PREFIX
+ * extern template, the common tensor registers of REGISTER_POLICY
+ */
+#define RAJA_TENSOR_INSTANTIATE_POLICY(PREFIX, REGISTER_POLICY) \
+  RAJA_TENSOR_INSTANTIATE_TYPE(PREFIX, REGISTER_POLICY, float) \
+  RAJA_TENSOR_INSTANTIATE_TYPE(PREFIX, REGISTER_POLICY, double)
+
+
+#ifdef __AVX512F__
+#define RAJA_TENSOR_INSTANTIATE_AVX512(PREFIX) \
+  RAJA_TENSOR_INSTANTIATE_POLICY(PREFIX, RAJA::expt::avx512_register)
+#else
+#define RAJA_TENSOR_INSTANTIATE_AVX512(PREFIX)
+#endif
+
+#ifdef __AVX2__
+#define RAJA_TENSOR_INSTANTIATE_AVX2(PREFIX) \
+  RAJA_TENSOR_INSTANTIATE_POLICY(PREFIX, RAJA::expt::avx2_register)
+#else
+#define RAJA_TENSOR_INSTANTIATE_AVX2(PREFIX)
+#endif
+
+#ifdef __AVX__
+#define RAJA_TENSOR_INSTANTIATE_AVX(PREFIX) \
+  RAJA_TENSOR_INSTANTIATE_POLICY(PREFIX, RAJA::expt::avx_register)
+#else
+#define RAJA_TENSOR_INSTANTIATE_AVX(PREFIX)
+#endif
+
+/*!
+ * The common tensor registers of all policies enabled by the current flags
+ */
+#define RAJA_TENSOR_INSTANTIATE_ALL(PREFIX) \
+  RAJA_TENSOR_INSTANTIATE_POLICY(PREFIX, RAJA::expt::scalar_register) \
+  RAJA_TENSOR_INSTANTIATE_AVX(PREFIX) \
+  RAJA_TENSOR_INSTANTIATE_AVX2(PREFIX) \
+  RAJA_TENSOR_INSTANTIATE_AVX512(PREFIX)
+
+
+// The device compilers, and the other instruction sets of runtime dispatch,
+// see register policies RAJA was not built with
+#if defined(RAJA_ENABLE_TENSOR_INSTANTIATIONS) && \
+    !defined(RAJA_TENSOR_INSTANTIATION_SOURCE) && \
+    !defined(RAJA_TENSOR_DISPATCH_ISA_VARIANT) && \
+    !defined(__CUDACC__) && !defined(__HIPCC__)
+RAJA_TENSOR_INSTANTIATE_ALL(extern template)
+#endif
+
+
+#endif
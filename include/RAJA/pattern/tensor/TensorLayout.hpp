@@ -88,6 +88,92 @@ namespace expt
   using ColMajorLayout = TensorLayout<1, 0>;
 
 
+  /*!
+   * Layout of a batch of ROWS x COLS row-major matrices, interleaved in
+   * groups of BATCH_WIDTH: the matrices of a group are stored element by
+   * element, so one element of the whole group is BATCH_WIDTH contiguous
+   * values, and loads as one register.
+   *
+   *   offset(b, i, j) = ((b/BATCH_WIDTH)*ROWS*COLS + i*COLS + j)*BATCH_WIDTH
+   *                     + b%BATCH_WIDTH
+   *
+   * The last group is padded to BATCH_WIDTH matrices.
+   */
+  template<camp::idx_t BATCH_WIDTH, camp::idx_t ROWS, camp::idx_t COLS>
+  struct BatchInterleavedLayout
+  {
+      static constexpr camp::idx_t s_batch_width = BATCH_WIDTH;
+      static constexpr camp::idx_t s_num_rows = ROWS;
+      static constexpr camp::idx_t s_num_columns = COLS;
+
+      //! Number of values, padding included, in one group
+      static constexpr camp::idx_t s_group_size = BATCH_WIDTH*ROWS*COLS;
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      constexpr
+      camp::idx_t num_groups(camp::idx_t num_batch){
+        return (num_batch + BATCH_WIDTH - 1) / BATCH_WIDTH;
+      }
+
+      //! Number of values to allocate for num_batch matrices
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      constexpr
+      camp::idx_t size(camp::idx_t num_batch){
+        return num_groups(num_batch)*s_group_size;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      constexpr
+      camp::idx_t group_offset(camp::idx_t group){
+        return group*s_group_size;
+      }
+
+      //! Offset of element (row, col) of matrix batch
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      constexpr
+      camp::idx_t offset(camp::idx_t batch, camp::idx_t row, camp::idx_t col){
+        return group_offset(batch / BATCH_WIDTH) +
+               (row*COLS + col)*BATCH_WIDTH + batch % BATCH_WIDTH;
+      }
+
+      /*!
+       * Copies num_batch contiguous row-major matrices into the interleaved
+       * layout, zeroing the padding
+       */
+      template<typename T>
+      RAJA_INLINE
+      static
+      void interleave(T const *src, T *dst, camp::idx_t num_batch){
+        for(camp::idx_t b = 0;b < num_groups(num_batch)*BATCH_WIDTH;++ b){
+          for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+            dst[offset(b, e / COLS, e % COLS)] =
+                b < num_batch ? src[b*ROWS*COLS + e] : T(0);
+          }
+        }
+      }
+
+      //! Copies an interleaved batch back to contiguous row-major matrices
+      template<typename T>
+      RAJA_INLINE
+      static
+      void deinterleave(T const *src, T *dst, camp::idx_t num_batch){
+        for(camp::idx_t b = 0;b < num_batch;++ b){
+          for(camp::idx_t e = 0;e < ROWS*COLS;++ e){
+            dst[b*ROWS*COLS + e] = src[offset(b, e / COLS, e % COLS)];
+          }
+        }
+      }
+  };
+
+
 } // namespace expt
 }  // namespace RAJA
 
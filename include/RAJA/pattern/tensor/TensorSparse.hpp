@@ -0,0 +1,300 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining sparse matrices stored in SELL-C-sigma
+ *          slices of register width.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_TensorSparse_HPP
+#define RAJA_pattern_tensor_TensorSparse_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "camp/camp.hpp"
+#include "RAJA/pattern/tensor/TensorRegister.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * A sparse matrix in SELL-C-sigma storage, with C the register width.
+   *
+   * Rows are sorted by decreasing length within windows of sigma rows, and
+   * split into slices of C rows. Each slice is padded to its longest row
+   * and stored column by column, so that element k of the C rows of a slice
+   * is one packed load:
+   *
+   *   value(s, k, lane) = values[slice_offsets[s] + k*C + lane]
+   *
+   * Padding has a zero value and column 0. A product then loads a register
+   * of values, gathers x at a register of columns and accumulates with an
+   * FMA, with no horizontal reductions, and scatters the C results through
+   * the row permutation. A sigma of 1 keeps the row order and gives sliced
+   * ELLPACK.
+   *
+   * SellMatrix is a view of arrays, which from_csr() fills on the host:
+   *
+   *   using sell_t = RAJA::expt::SellMatrix<double>;
+   *
+   *   sell_t::index_type size = sell_t::storage_size(N, row_ptr, sigma);
+   *   // allocate slice_offsets (num_slices(N)+1), rows (num_slices(N)*C),
+   *   // cols and values (size)
+   *   sell_t::from_csr(N, row_ptr, col, val, sigma,
+   *                    slice_offsets, rows, cols, values);
+   *
+   *   sell_t A(N, slice_offsets, rows, cols, values);
+   *   A.multiply(x, y);
+   */
+  template<typename T, typename REGISTER_POLICY = default_register>
+  class SellMatrix
+  {
+    public:
+      using self_type = SellMatrix<T, REGISTER_POLICY>;
+      using element_type = T;
+      using register_policy = REGISTER_POLICY;
+      using register_type = Register<T, REGISTER_POLICY>;
+      using int_vector_type = typename register_type::int_vector_type;
+      using index_type = typename int_vector_type::element_type;
+
+      static constexpr camp::idx_t s_slice_size = register_type::s_num_elem;
+
+    private:
+      index_type m_num_rows;
+      index_type const *m_slice_offsets;
+      index_type const *m_rows;
+      index_type const *m_cols;
+      element_type const *m_values;
+
+    public:
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      SellMatrix(index_type num_rows,
+                 index_type const *slice_offsets,
+                 index_type const *rows,
+                 index_type const *cols,
+                 element_type const *values) :
+        m_num_rows(num_rows),
+        m_slice_offsets(slice_offsets),
+        m_rows(rows),
+        m_cols(cols),
+        m_values(values)
+      {}
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      index_type num_slices(index_type num_rows){
+        return (num_rows + s_slice_size - 1) / s_slice_size;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      index_type num_slices() const {
+        return num_slices(m_num_rows);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      index_type num_rows() const {
+        return m_num_rows;
+      }
+
+
+      /*!
+       * Returns the C row products of slice s with x, in slice order
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      register_type multiply_slice(index_type s, element_type const *x) const
+      {
+        index_type begin = m_slice_offsets[s];
+        index_type end = m_slice_offsets[s+1];
+
+        register_type y(element_type(0));
+        for(index_type k = begin;k < end;k += s_slice_size){
+          register_type a;
+          a.load_packed(m_values + k);
+
+          int_vector_type col;
+          col.load_packed(m_cols + k);
+
+          register_type xk;
+          xk.gather(x, col);
+
+          y = a.multiply_add(xk, y);
+        }
+        return y;
+      }
+
+      /*!
+       * y(rows of slice s) = A(rows of slice s, :) x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      void multiply_slice(index_type s, element_type const *x, element_type *y) const
+      {
+        register_type ys = multiply_slice(s, x);
+
+        int_vector_type row;
+        row.load_packed(m_rows + s*s_slice_size);
+
+        index_type n = m_num_rows - s*s_slice_size;
+        if(n >= s_slice_size){
+          ys.scatter(y, row);
+        }
+        else{
+          ys.scatter_n(y, row, n);
+        }
+      }
+
+      /*!
+       * y = A x
+       *
+       * Slices are independent, so parallel code can distribute them with
+       * multiply_slice() instead.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      void multiply(element_type const *x, element_type *y) const
+      {
+        index_type n = num_slices();
+        for(index_type s = 0;s < n;++ s){
+          multiply_slice(s, x, y);
+        }
+      }
+
+
+      /*!
+       * Row order of the SELL-C-sigma storage: rows sorted by decreasing
+       * length within each window of sigma rows
+       */
+      static
+      std::vector<index_type> row_permutation(index_type num_rows,
+                                              index_type const *row_ptr,
+                                              index_type sigma)
+      {
+        std::vector<index_type> perm(num_rows);
+        for(index_type i = 0;i < num_rows;++ i){
+          perm[i] = i;
+        }
+
+        sigma = std::max<index_type>(sigma, 1);
+        for(index_type w = 0;w < num_rows;w += sigma){
+          index_type w_end = std::min<index_type>(w + sigma, num_rows);
+          std::stable_sort(perm.begin() + w, perm.begin() + w_end,
+              [=](index_type a, index_type b){
+                return row_ptr[a+1]-row_ptr[a] > row_ptr[b+1]-row_ptr[b];
+              });
+        }
+        return perm;
+      }
+
+      /*!
+       * Number of stored elements, including padding, of a CSR matrix
+       */
+      static
+      index_type storage_size(index_type num_rows,
+                              index_type const *row_ptr,
+                              index_type sigma)
+      {
+        std::vector<index_type> perm = row_permutation(num_rows, row_ptr, sigma);
+
+        index_type size = 0;
+        for(index_type s = 0;s < num_slices(num_rows);++ s){
+          size += slice_width(num_rows, row_ptr, perm, s) * s_slice_size;
+        }
+        return size;
+      }
+
+      /*!
+       * Converts a CSR matrix to SELL-C-sigma storage.
+       *
+       * slice_offsets has num_slices(num_rows)+1 elements, rows has
+       * num_slices(num_rows)*C, and cols and values have
+       * storage_size(num_rows, row_ptr, sigma).
+       */
+      static
+      void from_csr(index_type num_rows,
+                    index_type const *row_ptr,
+                    index_type const *col,
+                    element_type const *val,
+                    index_type sigma,
+                    index_type *slice_offsets,
+                    index_type *rows,
+                    index_type *cols,
+                    element_type *values)
+      {
+        std::vector<index_type> perm = row_permutation(num_rows, row_ptr, sigma);
+
+        slice_offsets[0] = 0;
+        for(index_type s = 0;s < num_slices(num_rows);++ s){
+          index_type width = slice_width(num_rows, row_ptr, perm, s);
+          index_type offset = slice_offsets[s];
+
+          for(index_type lane = 0;lane < s_slice_size;++ lane){
+            index_type i = s*s_slice_size + lane;
+
+            // the rows past the end of the matrix are only padding
+            index_type row = i < num_rows ? perm[i] : 0;
+            index_type row_len = i < num_rows ? row_ptr[row+1]-row_ptr[row] : 0;
+
+            rows[i] = row;
+            for(index_type k = 0;k < width;++ k){
+              index_type dst = offset + k*s_slice_size + lane;
+              if(k < row_len){
+                cols[dst] = col[row_ptr[row] + k];
+                values[dst] = val[row_ptr[row] + k];
+              }
+              else{
+                cols[dst] = 0;
+                values[dst] = element_type(0);
+              }
+            }
+          }
+
+          slice_offsets[s+1] = offset + width*s_slice_size;
+        }
+      }
+
+    private:
+
+      static
+      index_type slice_width(index_type num_rows,
+                            index_type const *row_ptr,
+                            std::vector<index_type> const &perm,
+                            index_type s)
+      {
+        index_type width = 0;
+        for(index_type i = s*s_slice_size;i < std::min<index_type>((s+1)*s_slice_size, num_rows);++ i){
+          width = std::max<index_type>(width, row_ptr[perm[i]+1]-row_ptr[perm[i]]);
+        }
+        return width;
+      }
+  };
+
+
+} // namespace expt
+}  // namespace RAJA
+
+
+#endif
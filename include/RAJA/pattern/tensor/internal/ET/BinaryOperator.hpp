@@ -54,6 +54,14 @@ namespace expt
         static constexpr camp::idx_t s_num_dims =
             operator_traits::s_num_dims;
 
+        /*
+         * Type of eval(), spelled out instead of deduced from the operands'
+         * eval() so that each node does not instantiate its subtree again
+         * to form its return type
+         */
+        using eval_type =
+            typename operator_type::template eval_type<result_type>;
+
       private:
         left_operand_type m_left_operand;
         right_operand_type m_right_operand;
@@ -70,17 +78,23 @@ namespace expt
         RAJA_INLINE
         RAJA_HOST_DEVICE
         constexpr
-        auto getDimSize(camp::idx_t dim) const ->
-        decltype(operator_traits::getDimSize(dim, m_left_operand, m_right_operand))
+        int getDimSize(camp::idx_t dim) const
         {
           return operator_traits::getDimSize(dim, m_left_operand, m_right_operand);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        camp::idx_t getDimBegin(camp::idx_t dim) const
+        {
+          return operator_traits::getDimBegin(dim, m_left_operand, m_right_operand);
+        }
+
         template<typename TILE_TYPE>
         RAJA_INLINE
         RAJA_HOST_DEVICE
-        auto eval(TILE_TYPE const &tile) const ->
-          decltype(operator_type::eval(m_left_operand.eval(tile), m_right_operand.eval(tile)))
+        eval_type eval(TILE_TYPE const &tile) const
         {
           return operator_type::eval(m_left_operand.eval(tile), m_right_operand.eval(tile));
         }
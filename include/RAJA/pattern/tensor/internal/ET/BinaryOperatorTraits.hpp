@@ -33,6 +33,10 @@ namespace expt
     struct TensorOperatorAdd
     {
 
+      // evaluates to the tensor type of the operands
+      template<typename RESULT>
+      using eval_type = RESULT;
+
       template<typename LEFT, typename RIGHT>
       RAJA_INLINE
       RAJA_HOST_DEVICE
@@ -54,6 +58,9 @@ namespace expt
     struct TensorOperatorSubtract
     {
 
+      template<typename RESULT>
+      using eval_type = RESULT;
+
       template<typename LEFT, typename RIGHT>
       RAJA_INLINE
       RAJA_HOST_DEVICE
@@ -76,6 +83,156 @@ namespace expt
 
 
 
+    /*
+     * Element wise comparisons, which evaluate to the mask_type of the
+     * operand tensors
+     */
+    struct TensorOperatorEqual
+    {
+
+      template<typename RESULT>
+      using eval_type = typename RESULT::mask_type;
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left == right)
+      {
+        return left == right;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Equal");
+      }
+    };
+
+    struct TensorOperatorNotEqual
+    {
+
+      template<typename RESULT>
+      using eval_type = typename RESULT::mask_type;
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left != right)
+      {
+        return left != right;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("NotEqual");
+      }
+    };
+
+    struct TensorOperatorLess
+    {
+
+      template<typename RESULT>
+      using eval_type = typename RESULT::mask_type;
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left < right)
+      {
+        return left < right;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Less");
+      }
+    };
+
+    struct TensorOperatorLessEqual
+    {
+
+      template<typename RESULT>
+      using eval_type = typename RESULT::mask_type;
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left <= right)
+      {
+        return left <= right;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("LessEqual");
+      }
+    };
+
+    struct TensorOperatorGreater
+    {
+
+      template<typename RESULT>
+      using eval_type = typename RESULT::mask_type;
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left > right)
+      {
+        return left > right;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("Greater");
+      }
+    };
+
+    struct TensorOperatorGreaterEqual
+    {
+
+      template<typename RESULT>
+      using eval_type = typename RESULT::mask_type;
+
+      template<typename LEFT, typename RIGHT>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      auto eval(LEFT const &left, RIGHT const &right) ->
+        decltype(left >= right)
+      {
+        return left >= right;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      void print_ast(){
+        printf("GreaterEqual");
+      }
+    };
+
+
+
     template<typename OPERATOR, typename LEFT_OPERAND, typename RIGHT_OPERAND>
     class TensorBinaryOperator;
 
@@ -85,6 +242,24 @@ namespace expt
     template<typename LHS, typename RHS>
     using TensorSubtract = TensorBinaryOperator<TensorOperatorSubtract, LHS, RHS>;
 
+    template<typename LHS, typename RHS>
+    using TensorEqual = TensorBinaryOperator<TensorOperatorEqual, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorNotEqual = TensorBinaryOperator<TensorOperatorNotEqual, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorLess = TensorBinaryOperator<TensorOperatorLess, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorLessEqual = TensorBinaryOperator<TensorOperatorLessEqual, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorGreater = TensorBinaryOperator<TensorOperatorGreater, LHS, RHS>;
+
+    template<typename LHS, typename RHS>
+    using TensorGreaterEqual = TensorBinaryOperator<TensorOperatorGreaterEqual, LHS, RHS>;
+
 
 
 
@@ -117,6 +292,13 @@ namespace expt
           return dim == 0 ? lhs.getDimSize(0) : rhs.getDimSize(1);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        int getDimBegin(int dim, LHS_TYPE const &lhs, RHS_TYPE const &rhs) {
+          return dim == 0 ? lhs.getDimBegin(0) : rhs.getDimBegin(1);
+        }
+
     };
 
     /*!
@@ -144,6 +326,13 @@ namespace expt
           return rhs.getDimSize(dim);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        int getDimBegin(int dim, LHS_TYPE const &, RHS_TYPE const &rhs) {
+          return rhs.getDimBegin(dim);
+        }
+
     };
 
     /*!
@@ -171,6 +360,13 @@ namespace expt
           return lhs.getDimSize(dim);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        int getDimBegin(int dim, LHS_TYPE const &lhs, RHS_TYPE const &) {
+          return lhs.getDimBegin(dim);
+        }
+
 
 
     };
@@ -63,6 +63,25 @@ namespace expt
     template<typename TENSOR_TYPE>
     class TensorTranspose;
 
+    struct TensorReduceSum;
+    struct TensorReduceMin;
+    struct TensorReduceMax;
+
+    template<typename OP, typename ET_TYPE>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    typename ET_TYPE::result_type::element_type
+    tensorReduce(ET_TYPE const &et);
+
+    template<typename LEFT_TYPE, typename RIGHT_TYPE>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    typename LEFT_TYPE::result_type::element_type
+    tensorDot(LEFT_TYPE const &left, RIGHT_TYPE const &right);
+
+    template<typename LHS_TYPE, typename RHS_TYPE, typename ENABLE = void>
+    struct TensorMultiplyBlocked;
+
 
 
 
@@ -119,6 +138,65 @@ namespace expt
           return TensorSubtract<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
         }
 
+        /*!
+         * Element wise comparisons, for use in select():
+         *
+         *   y(all) = select(x(all) < 0.0, -x(all), x(all));
+         */
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorEqual<self_type, normalize_operand_t<RHS>>
+        operator==(RHS const &rhs) const {
+          return TensorEqual<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorNotEqual<self_type, normalize_operand_t<RHS>>
+        operator!=(RHS const &rhs) const {
+          return TensorNotEqual<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorLess<self_type, normalize_operand_t<RHS>>
+        operator<(RHS const &rhs) const {
+          return TensorLess<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorLessEqual<self_type, normalize_operand_t<RHS>>
+        operator<=(RHS const &rhs) const {
+          return TensorLessEqual<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorGreater<self_type, normalize_operand_t<RHS>>
+        operator>(RHS const &rhs) const {
+          return TensorGreater<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorGreaterEqual<self_type, normalize_operand_t<RHS>>
+        operator>=(RHS const &rhs) const {
+          return TensorGreaterEqual<self_type, normalize_operand_t<RHS>>(*getThis(), normalizeOperand(rhs));
+        }
+
         RAJA_SUPPRESS_HD_WARN
         RAJA_INLINE
         RAJA_HOST_DEVICE
@@ -153,6 +231,51 @@ namespace expt
           return TensorTranspose<self_type>(*getThis());
         }
 
+        /*!
+         * Reductions over all elements of a vector expression, for example
+         *
+         *   double nrm2 = (x(all)*x(all)).sum();
+         *   double d = x(all).dot(y(all));
+         *
+         * Each tile of the expression is combined into a register, with one
+         * horizontal reduction at the end.
+         */
+        RAJA_SUPPRESS_HD_WARN
+        template<typename ET_TYPE = self_type>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        typename ET_TYPE::result_type::element_type
+        sum() const {
+          return tensorReduce<TensorReduceSum>(*getThis());
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename ET_TYPE = self_type>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        typename ET_TYPE::result_type::element_type
+        min() const {
+          return tensorReduce<TensorReduceMin>(*getThis());
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename ET_TYPE = self_type>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        typename ET_TYPE::result_type::element_type
+        max() const {
+          return tensorReduce<TensorReduceMax>(*getThis());
+        }
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename RHS, typename ET_TYPE = self_type>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        typename ET_TYPE::result_type::element_type
+        dot(RHS const &rhs) const {
+          return tensorDot(*getThis(), normalizeOperand(rhs));
+        }
+
     };
 
 
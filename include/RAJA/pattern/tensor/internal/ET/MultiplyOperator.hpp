@@ -66,6 +66,13 @@ namespace expt
           return dim == 0 ? left.getDimSize(0) : right.getDimSize(1);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right) {
+          return dim == 0 ? left.getDimBegin(0) : right.getDimBegin(1);
+        }
+
         /*!
          * Evaluate operands and perform element-wise multiply
          */
@@ -73,8 +80,7 @@ namespace expt
         RAJA_INLINE
         RAJA_HOST_DEVICE
         static
-        auto multiply(TILE_TYPE const &tile, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right) ->
-          decltype(left.eval(tile) * right.eval(tile))
+        result_type multiply(TILE_TYPE const &tile, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right)
         {
           return left.eval(tile) * right.eval(tile);
         }
@@ -87,8 +93,7 @@ namespace expt
         RAJA_INLINE
         RAJA_HOST_DEVICE
         static
-        auto multiply_add(TILE_TYPE const &tile, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right, ADD_OPERAND_TYPE const &add) ->
-          decltype(left.eval(tile).multiply_add(right.eval(tile), add.eval(tile)))
+        result_type multiply_add(TILE_TYPE const &tile, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right, ADD_OPERAND_TYPE const &add)
         {
           return left.eval(tile).multiply_add(right.eval(tile), add.eval(tile));
         }
@@ -101,8 +106,7 @@ namespace expt
         RAJA_INLINE
         RAJA_HOST_DEVICE
         static
-        auto multiply_subtract(TILE_TYPE const &tile, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right, SUBTRACT_OPERAND_TYPE const &subtract) ->
-          decltype(left.eval(tile).multiply_subtract(right.eval(tile), subtract.eval(tile)))
+        result_type multiply_subtract(TILE_TYPE const &tile, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right, SUBTRACT_OPERAND_TYPE const &subtract)
         {
           return left.eval(tile).multiply_subtract(right.eval(tile), subtract.eval(tile));
         }
@@ -136,6 +140,13 @@ namespace expt
           return right.getDimSize(dim);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        int getDimBegin(int dim, LEFT_OPERAND_TYPE const &, RIGHT_OPERAND_TYPE const &right) {
+          return right.getDimBegin(dim);
+        }
+
         /*!
          * Evaluate operands and perform scaling operation
          */
@@ -205,6 +216,13 @@ namespace expt
           return left.getDimSize(dim);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &) {
+          return left.getDimBegin(dim);
+        }
+
         /*!
          * Evaluate operands and perform scaling operation
          */
@@ -285,6 +303,13 @@ namespace expt
         return dim == 0 ? right.getDimSize(0) : 0;
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &, RIGHT_OPERAND_TYPE const &right) {
+        return dim == 0 ? right.getDimBegin(0) : 0;
+      }
+
       /*!
        * Evaluate operands and perform element-wise multiply
        */
@@ -418,6 +443,13 @@ namespace expt
         return dim == 0 ? left.getDimSize(0) : 0;
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &) {
+        return dim == 0 ? left.getDimBegin(0) : 0;
+      }
+
       /*!
        * Evaluate operands and perform element-wise multiply
        */
@@ -544,6 +576,13 @@ namespace expt
         return dim == 0 ? left.getDimSize(0) : right.getDimSize(1);
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right) {
+        return dim == 0 ? left.getDimBegin(0) : right.getDimBegin(1);
+      }
+
       /*!
        * Evaluate operands and perform element-wise multiply
        */
@@ -775,6 +814,13 @@ namespace expt
           return dim == 0 ? left.getDimSize(0) : right.getDimSize(1);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &right) {
+          return dim == 0 ? left.getDimBegin(0) : right.getDimBegin(1);
+        }
+
         /*!
          * Evaluate operands and perform element-wise multiply
          */
@@ -59,6 +59,13 @@ namespace expt
         return right.getDimSize(dim);
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &, RIGHT_OPERAND_TYPE const &right) {
+        return right.getDimBegin(dim);
+      }
+
       /*!
        * Evaluate operands and perform element-wise divide
        */
@@ -98,6 +105,13 @@ namespace expt
         return left.getDimSize(dim);
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &) {
+        return left.getDimBegin(dim);
+      }
+
       /*!
        * Evaluate operands and perform element-wise divide
        */
@@ -137,6 +151,13 @@ namespace expt
         return left.getDimSize(dim);
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &) {
+        return left.getDimBegin(dim);
+      }
+
       /*!
        * Evaluate operands and perform element-wise divide
        */
@@ -178,6 +199,13 @@ namespace expt
         return right.getDimSize(dim);
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &, RIGHT_OPERAND_TYPE const &right) {
+        return right.getDimBegin(dim);
+      }
+
       /*!
        * Evaluate operands and perform element-wise divide
        */
@@ -217,6 +245,13 @@ namespace expt
         return left.getDimSize(dim);
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &) {
+        return left.getDimBegin(dim);
+      }
+
       /*!
        * Evaluate operands and perform element-wise divide
        */
@@ -257,6 +292,13 @@ namespace expt
         return left.getDimSize(dim);
       }
 
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      static
+      int getDimBegin(int dim, LEFT_OPERAND_TYPE const &left, RIGHT_OPERAND_TYPE const &) {
+        return left.getDimBegin(dim);
+      }
+
       /*!
        * Evaluate operands and perform element-wise divide
        */
@@ -310,6 +352,13 @@ namespace expt
           return divide_op::getDimSize(dim, m_left_operand, m_right_operand);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        camp::idx_t getDimBegin(camp::idx_t dim) const {
+          return divide_op::getDimBegin(dim, m_left_operand, m_right_operand);
+        }
+
 
         template<typename TILE_TYPE>
         RAJA_INLINE
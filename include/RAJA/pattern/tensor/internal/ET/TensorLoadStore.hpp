@@ -22,12 +22,22 @@
 
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/pattern/tensor/TensorLayout.hpp"
 #include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
 #include "RAJA/pattern/tensor/internal/TensorTileExec.hpp"
 
 
 namespace RAJA
 {
+namespace expt
+{
+  template<typename REGISTER_POLICY,
+           typename T,
+           typename LAYOUT,
+           typename SIZES>
+  class TensorRegister;
+}
+
 namespace internal
 {
 namespace expt
@@ -40,6 +50,32 @@ namespace expt
   namespace ET
   {
 
+    /*!
+     * The tensor dimension that must be stride-one for TENSOR_TYPE to use
+     * packed loads and stores, or -1 if it has none.
+     *
+     * Only register types are listed: they load into the same type whatever
+     * the ref, which lets TensorLoadStore pick the ref at run time.
+     */
+    template<typename TENSOR_TYPE>
+    struct TensorPackedDim
+    {
+        static constexpr camp::idx_t value = -1;
+    };
+
+    template<typename REGISTER_POLICY, typename T, camp::idx_t SIZE>
+    struct TensorPackedDim<RAJA::expt::TensorRegister<REGISTER_POLICY, T, RAJA::expt::VectorLayout, camp::idx_seq<SIZE>>>
+    {
+        static constexpr camp::idx_t value = 0;
+    };
+
+    // row-major matrices need stride-one columns, column-major stride-one rows
+    template<typename REGISTER_POLICY, typename T, camp::idx_t ROW_ORD, camp::idx_t COL_ORD, camp::idx_t ROW_SIZE, camp::idx_t COL_SIZE>
+    struct TensorPackedDim<RAJA::expt::TensorRegister<REGISTER_POLICY, T, RAJA::expt::TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>>
+    {
+        static constexpr camp::idx_t value = COL_ORD;
+    };
+
 
 
     template<typename STORAGE, typename LHS_TYPE, typename RHS_TYPE>
@@ -90,9 +126,47 @@ namespace expt
 
         static constexpr camp::idx_t s_num_dims = result_type::s_num_dims;
 
+        /*
+         * Refs from Views with run time layouts do not know their
+         * stride-one dimension, so each load and store would take the
+         * strided (gather/scatter) path even when the data is packed.
+         *
+         * For those refs the stride is checked once, when the expression is
+         * built, and packed data is then accessed through packed_ref_type.
+         */
+        static constexpr camp::idx_t s_packed_dim = TensorPackedDim<TENSOR_TYPE>::value;
+
+        static constexpr bool s_runtime_stride_check =
+            s_packed_dim >= 0 && ref_type::s_stride_one_dim < 0;
+
+        using packed_ref_type = typename std::conditional<s_runtime_stride_check,
+            decltype(make_ref_stride_one<(s_runtime_stride_check ? s_packed_dim : 0)>(std::declval<ref_type>())),
+            ref_type>::type;
+
+        using packed_type = TensorLoadStore<TENSOR_TYPE, packed_ref_type>;
+
 
       private:
+        template<typename T, typename R>
+        friend class TensorLoadStore;
+
         ref_type m_ref;
+        bool m_packed;
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        constexpr
+        bool s_is_packed(ref_type const &ref){
+          return s_runtime_stride_check &&
+                 ref.m_stride[s_runtime_stride_check ? s_packed_dim : 0] == 1;
+        }
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        packed_ref_type get_packed_ref() const {
+          return make_ref_stride_one<(s_runtime_stride_check ? s_packed_dim : 0)>(m_ref);
+        }
 
 
       public:
@@ -100,13 +174,13 @@ namespace expt
         RAJA_INLINE
         RAJA_HOST_DEVICE
         explicit
-        TensorLoadStore(ref_type const &ref) : m_ref{ref}
+        TensorLoadStore(ref_type const &ref) : m_ref{ref}, m_packed{s_is_packed(ref)}
         {
         }
 
         RAJA_INLINE
         RAJA_HOST_DEVICE
-        TensorLoadStore(self_type const &rhs) : m_ref(rhs.m_ref)
+        TensorLoadStore(self_type const &rhs) : m_ref(rhs.m_ref), m_packed(rhs.m_packed)
         {}
 
 
@@ -186,6 +260,9 @@ namespace expt
         auto eval(TILE_TYPE const &tile) const ->
           decltype(tensor_type::s_load_ref(merge_ref_tile(m_ref, tile)))
         {
+          if(m_packed){
+            return tensor_type::s_load_ref(merge_ref_tile(get_packed_ref(), tile));
+          }
           return tensor_type::s_load_ref(merge_ref_tile(m_ref, tile));
         }
 
@@ -207,6 +284,13 @@ namespace expt
           return m_ref.m_tile.m_size[dim];
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        index_type getDimBegin(index_type dim) const {
+          return m_ref.m_tile.m_begin[dim];
+        }
+
         RAJA_INLINE
         RAJA_HOST_DEVICE
         void print_ast() const {
@@ -233,6 +317,16 @@ namespace expt
           printf(")\n");
 #endif
 
+          if(m_packed){
+            packed_type(get_packed_ref()).store(rhs);
+            return;
+          }
+
+          // large matrix products are cache blocked
+          if(TensorMultiplyBlocked<self_type, RHS>::exec(*this, rhs)){
+            return;
+          }
+
           tensorTileExec<tensor_type>(m_ref.m_tile,
               makeTensorStoreFunctor<tensor_type>(*this, rhs));
         }
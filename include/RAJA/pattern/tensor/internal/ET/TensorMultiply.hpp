@@ -72,6 +72,13 @@ namespace expt
           return multiply_op::getDimSize(dim, m_left_operand, m_right_operand);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        camp::idx_t getDimBegin(camp::idx_t dim) const {
+          return multiply_op::getDimBegin(dim, m_left_operand, m_right_operand);
+        }
+
 
         template<typename TILE_TYPE>
         RAJA_INLINE
@@ -69,6 +69,21 @@ namespace expt
         {}
 
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        int getDimSize(int dim) const {
+          return multiply_op::getDimSize(dim, m_left_operand, m_right_operand);
+        }
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        camp::idx_t getDimBegin(camp::idx_t dim) const {
+          return multiply_op::getDimBegin(dim, m_left_operand, m_right_operand);
+        }
+
+
         template<typename TILE_TYPE>
         RAJA_INLINE
         RAJA_HOST_DEVICE
@@ -78,6 +93,36 @@ namespace expt
           return multiply_op::multiply_add(tile, m_left_operand, m_right_operand, m_add_operand);
         }
 
+        /*!
+         * Returns the LHS of the multiply
+         */
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        left_operand_type const &getLeftOperand() const {
+          return m_left_operand;
+        }
+
+        /*!
+         * Returns the RHS of the multiply
+         */
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        right_operand_type const &getRightOperand() const {
+          return m_right_operand;
+        }
+
+        /*!
+         * Returns the addend
+         */
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        add_operand_type const &getAddOperand() const {
+          return m_add_operand;
+        }
+
 
         RAJA_INLINE
         RAJA_HOST_DEVICE
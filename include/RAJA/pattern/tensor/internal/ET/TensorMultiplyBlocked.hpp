@@ -0,0 +1,451 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining cache blocked matrix products of
+ *          tensor expressions stored to Views.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_ET_TensorMultiplyBlocked_HPP
+#define RAJA_pattern_tensor_ET_TensorMultiplyBlocked_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/internal/foldl.hpp"
+#include "RAJA/policy/tensor/arch.hpp"
+
+#include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
+#include "RAJA/pattern/tensor/internal/ET/TensorLoadStore.hpp"
+#include "RAJA/pattern/tensor/internal/ET/TensorMultiply.hpp"
+#include "RAJA/pattern/tensor/internal/ET/TensorMultiplyAdd.hpp"
+
+#include <memory>
+#include <new>
+#include <type_traits>
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+
+  namespace ET
+  {
+
+    /*!
+     * Whether products of REGISTER_POLICY matrices may be cache blocked.
+     *
+     * Blocking packs operand tiles into per-thread host buffers, so the GPU
+     * registers keep the register tiled product.
+     */
+    template<typename REGISTER_POLICY>
+    struct TensorMultiplyBlockedPolicy : std::true_type {};
+
+#ifdef RAJA_ENABLE_CUDA
+    template<>
+    struct TensorMultiplyBlockedPolicy<RAJA::expt::cuda_warp_register> : std::false_type {};
+
+    template<>
+    struct TensorMultiplyBlockedPolicy<RAJA::expt::cuda_mma_register> : std::false_type {};
+#endif
+
+#ifdef RAJA_ENABLE_HIP
+    template<>
+    struct TensorMultiplyBlockedPolicy<RAJA::expt::hip_wave_register> : std::false_type {};
+
+    template<>
+    struct TensorMultiplyBlockedPolicy<RAJA::expt::hip_mfma_register> : std::false_type {};
+#endif
+
+
+    /*!
+     * Block sizes of a product of LEFT_TENSOR and RIGHT_TENSOR tiles, in
+     * register tiles.
+     *
+     * A s_kc x s_nc panel of the right operand stays cached (L3) while it
+     * is used by every row of the result, and a s_mc x s_kc block of the
+     * left operand (L2) while it is used by every column of the panel.
+     */
+    template<typename LEFT_TENSOR, typename RIGHT_TENSOR>
+    struct TensorMultiplyBlocking
+    {
+        static constexpr camp::idx_t s_k_elem = 256;
+        static constexpr camp::idx_t s_left_block_bytes = 128*1024;
+        static constexpr camp::idx_t s_right_panel_bytes = 1024*1024;
+
+        static constexpr camp::idx_t s_kc =
+            RAJA::max<camp::idx_t>(1, s_k_elem / RIGHT_TENSOR::s_dim_elem(0));
+
+        static constexpr camp::idx_t s_mc =
+            RAJA::max<camp::idx_t>(1, s_left_block_bytes / (s_kc*sizeof(LEFT_TENSOR)));
+
+        static constexpr camp::idx_t s_nc =
+            RAJA::max<camp::idx_t>(1, s_right_panel_bytes / (s_kc*sizeof(RIGHT_TENSOR)));
+
+        // smaller products reuse too few tiles to pay for the packing
+        static constexpr camp::idx_t s_min_tiles = 64;
+    };
+
+
+    /*!
+     * Array of registers that only grows, aligned for TENSOR_TYPE
+     */
+    template<typename TENSOR_TYPE>
+    class TensorPackBuffer
+    {
+      public:
+        TensorPackBuffer() : m_storage(nullptr), m_data(nullptr), m_size(0) {}
+
+        ~TensorPackBuffer(){
+          release();
+        }
+
+        TensorPackBuffer(TensorPackBuffer const &) = delete;
+        TensorPackBuffer &operator=(TensorPackBuffer const &) = delete;
+
+        //! Returns room for at least n registers
+        TENSOR_TYPE *reserve(camp::idx_t n){
+          if(n > m_size){
+            release();
+
+            size_t space = n*sizeof(TENSOR_TYPE) + alignof(TENSOR_TYPE);
+            m_storage = new char[space];
+
+            void *ptr = m_storage;
+            m_data = static_cast<TENSOR_TYPE*>(
+                std::align(alignof(TENSOR_TYPE), n*sizeof(TENSOR_TYPE), ptr, space));
+
+            for(camp::idx_t i = 0;i < n;++ i){
+              new (m_data + i) TENSOR_TYPE();
+            }
+            m_size = n;
+          }
+          return m_data;
+        }
+
+      private:
+        void release(){
+          for(camp::idx_t i = 0;i < m_size;++ i){
+            m_data[i].~TENSOR_TYPE();
+          }
+          delete[] m_storage;
+
+          m_storage = nullptr;
+          m_data = nullptr;
+          m_size = 0;
+        }
+
+        char *m_storage;
+        TENSOR_TYPE *m_data;
+        camp::idx_t m_size;
+    };
+
+
+    /*!
+     * Computes C = A*B (+ ADD) for matrix Views, GotoBLAS style.
+     *
+     * The register tiled product reloads the k-panels of A and B for every
+     * register tile of C. Here a panel of B tiles and a block of A tiles are
+     * loaded once into packed buffers, which edge tiles enter zero-padded,
+     * and every C tile of the block accumulates from those buffers. C tiles
+     * are stored after each k-block and reloaded for the next.
+     *
+     * As in the register tiled product, A rows follow the rows of C and B
+     * columns follow the columns of C.
+     */
+    template<typename C_TYPE, typename A_TYPE, typename B_TYPE>
+    struct TensorMultiplyBlockedImpl
+    {
+        using c_tensor_type = typename C_TYPE::result_type;
+        using a_tensor_type = typename A_TYPE::result_type;
+        using b_tensor_type = typename B_TYPE::result_type;
+        using index_type = typename C_TYPE::index_type;
+        using tile_type = TensorTile<index_type, TENSOR_FULL, 2>;
+        using blocking = TensorMultiplyBlocking<a_tensor_type, b_tensor_type>;
+
+        static constexpr camp::idx_t s_tile_m = c_tensor_type::s_dim_elem(0);
+        static constexpr camp::idx_t s_tile_n = c_tensor_type::s_dim_elem(1);
+        static constexpr camp::idx_t s_tile_k = b_tensor_type::s_dim_elem(0);
+
+        /*!
+         * Evaluates et on a tile, which is partial if it is smaller than a
+         * register
+         */
+        template<typename ET_TYPE>
+        RAJA_INLINE
+        static
+        typename ET_TYPE::result_type
+        eval_tile(ET_TYPE const &et, tile_type &tile)
+        {
+          using tensor_type = typename ET_TYPE::result_type;
+
+          if(tile.m_size[0] == tensor_type::s_dim_elem(0) &&
+             tile.m_size[1] == tensor_type::s_dim_elem(1))
+          {
+            return et.eval(tile);
+          }
+          return et.eval(make_tensor_tile_partial(tile));
+        }
+
+        RAJA_INLINE
+        static
+        void store_tile(C_TYPE const &c, tile_type &tile, c_tensor_type const &value)
+        {
+          if(tile.m_size[0] == s_tile_m && tile.m_size[1] == s_tile_n){
+            c.eval_lhs(tile) = value;
+          }
+          else{
+            c.eval_lhs(make_tensor_tile_partial(tile)) = value;
+          }
+        }
+
+        /*!
+         * Returns false, without touching C, if the product is too small to
+         * be blocked.
+         *
+         * init(tile) gives the value a C tile starts from.
+         */
+        template<typename INIT>
+        static
+        bool exec(C_TYPE const &c, A_TYPE const &a, B_TYPE const &b, INIT const &init)
+        {
+          index_type const m = c.getDimSize(0);
+          index_type const n = c.getDimSize(1);
+          index_type const k = a.getDimSize(1);
+
+          camp::idx_t const m_tiles = (m + s_tile_m - 1) / s_tile_m;
+          camp::idx_t const n_tiles = (n + s_tile_n - 1) / s_tile_n;
+          camp::idx_t const k_tiles = (k + s_tile_k - 1) / s_tile_k;
+
+          if(m_tiles*n_tiles*k_tiles < blocking::s_min_tiles){
+            return false;
+          }
+
+          index_type const c_row0 = c.getDimBegin(0);
+          index_type const c_col0 = c.getDimBegin(1);
+          index_type const a_k0 = a.getDimBegin(1);
+          index_type const b_k0 = b.getDimBegin(0);
+
+          static thread_local TensorPackBuffer<a_tensor_type> a_buffer;
+          static thread_local TensorPackBuffer<b_tensor_type> b_buffer;
+
+          a_tensor_type *a_pack = a_buffer.reserve(blocking::s_mc*blocking::s_kc);
+          b_tensor_type *b_pack = b_buffer.reserve(blocking::s_kc*blocking::s_nc);
+
+          tile_type tile;
+
+          for(camp::idx_t jc = 0;jc < n_tiles;jc += blocking::s_nc){
+            camp::idx_t const nc = RAJA::min<camp::idx_t>(blocking::s_nc, n_tiles - jc);
+
+            for(camp::idx_t pc = 0;pc < k_tiles;pc += blocking::s_kc){
+              camp::idx_t const kc = RAJA::min<camp::idx_t>(blocking::s_kc, k_tiles - pc);
+
+              // pack the panel of B, each column of tiles contiguous in k
+              for(camp::idx_t j = 0;j < nc;++ j){
+                for(camp::idx_t p = 0;p < kc;++ p){
+                  index_type const kk = (pc+p)*s_tile_k;
+                  index_type const col = (jc+j)*s_tile_n;
+
+                  tile.m_begin[0] = b_k0 + kk;
+                  tile.m_begin[1] = c_col0 + col;
+                  tile.m_size[0] = RAJA::min<index_type>(s_tile_k, k - kk);
+                  tile.m_size[1] = RAJA::min<index_type>(s_tile_n, n - col);
+
+                  b_pack[j*kc + p] = eval_tile(b, tile);
+                }
+              }
+
+              for(camp::idx_t ic = 0;ic < m_tiles;ic += blocking::s_mc){
+                camp::idx_t const mc = RAJA::min<camp::idx_t>(blocking::s_mc, m_tiles - ic);
+
+                // pack the block of A, each row of tiles contiguous in k
+                for(camp::idx_t i = 0;i < mc;++ i){
+                  for(camp::idx_t p = 0;p < kc;++ p){
+                    index_type const row = (ic+i)*s_tile_m;
+                    index_type const kk = (pc+p)*s_tile_k;
+
+                    tile.m_begin[0] = c_row0 + row;
+                    tile.m_begin[1] = a_k0 + kk;
+                    tile.m_size[0] = RAJA::min<index_type>(s_tile_m, m - row);
+                    tile.m_size[1] = RAJA::min<index_type>(s_tile_k, k - kk);
+
+                    a_pack[i*kc + p] = eval_tile(a, tile);
+                  }
+                }
+
+                // accumulate the C tiles of the block
+                for(camp::idx_t j = 0;j < nc;++ j){
+                  for(camp::idx_t i = 0;i < mc;++ i){
+                    index_type const row = (ic+i)*s_tile_m;
+                    index_type const col = (jc+j)*s_tile_n;
+
+                    tile.m_begin[0] = c_row0 + row;
+                    tile.m_begin[1] = c_col0 + col;
+                    tile.m_size[0] = RAJA::min<index_type>(s_tile_m, m - row);
+                    tile.m_size[1] = RAJA::min<index_type>(s_tile_n, n - col);
+
+                    c_tensor_type acc = pc == 0 ? init(tile) : eval_tile(c, tile);
+
+                    a_tensor_type const *a_row = a_pack + i*kc;
+                    b_tensor_type const *b_col = b_pack + j*kc;
+                    for(camp::idx_t p = 0;p < kc;++ p){
+                      a_row[p].matrix_multiply_accumulate(acc, b_col[p]);
+                    }
+
+                    store_tile(c, tile, acc);
+                  }
+                }
+              }
+            }
+          }
+
+          return true;
+        }
+    };
+
+
+    /*!
+     * Start of a C tile of C = A*B
+     */
+    template<typename TENSOR_TYPE>
+    struct TensorMultiplyBlockedZero
+    {
+        template<typename TILE_TYPE>
+        RAJA_INLINE
+        TENSOR_TYPE operator()(TILE_TYPE const &) const {
+          return TENSOR_TYPE(0);
+        }
+    };
+
+    /*!
+     * Start of a C tile of C = A*B + ADD
+     */
+    template<typename IMPL, typename ADD_TYPE>
+    struct TensorMultiplyBlockedAdd
+    {
+        ADD_TYPE const &m_add;
+
+        template<typename TILE_TYPE>
+        RAJA_INLINE
+        typename IMPL::c_tensor_type operator()(TILE_TYPE &tile) const {
+          return IMPL::eval_tile(m_add, tile);
+        }
+    };
+
+
+    /*!
+     * Expressions that are not products of matrix Views use the register
+     * tiled store.
+     */
+    template<typename LHS_TYPE, typename RHS_TYPE, typename ENABLE>
+    struct TensorMultiplyBlocked
+    {
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        constexpr
+        bool exec(LHS_TYPE const &, RHS_TYPE const &){
+          return false;
+        }
+    };
+
+
+    /*!
+     * Conditions for blocking C = A*B: all three are 2D register Views with
+     * tiles that chain, and the register policy runs on the host.
+     */
+    template<typename C_TENSOR, typename A_TENSOR, typename B_TENSOR,
+             bool IS_MATRIX = C_TENSOR::s_num_dims == 2 &&
+                              A_TENSOR::s_num_dims == 2 &&
+                              B_TENSOR::s_num_dims == 2>
+    struct TensorMultiplyBlockable : std::false_type {};
+
+    template<typename C_TENSOR, typename A_TENSOR, typename B_TENSOR>
+    struct TensorMultiplyBlockable<C_TENSOR, A_TENSOR, B_TENSOR, true>
+    {
+        static constexpr bool value =
+            std::is_same<C_TENSOR, typename A_TENSOR::product_type>::value &&
+            A_TENSOR::s_dim_elem(1) == B_TENSOR::s_dim_elem(0) &&
+            B_TENSOR::s_dim_elem(1) == C_TENSOR::s_dim_elem(1) &&
+            TensorMultiplyBlockedPolicy<typename A_TENSOR::register_policy>::value;
+    };
+
+
+    /*!
+     * C = A*B
+     */
+    template<typename C_TENSOR, typename C_REF, typename A_TENSOR, typename A_REF, typename B_TENSOR, typename B_REF>
+    struct TensorMultiplyBlocked<TensorLoadStore<C_TENSOR, C_REF>,
+                                 TensorMultiply<TensorLoadStore<A_TENSOR, A_REF>, TensorLoadStore<B_TENSOR, B_REF>>,
+                                 typename std::enable_if<TensorMultiplyBlockable<C_TENSOR, A_TENSOR, B_TENSOR>::value>::type>
+    {
+        using lhs_type = TensorLoadStore<C_TENSOR, C_REF>;
+        using rhs_type = TensorMultiply<TensorLoadStore<A_TENSOR, A_REF>, TensorLoadStore<B_TENSOR, B_REF>>;
+        using impl_type = TensorMultiplyBlockedImpl<lhs_type, TensorLoadStore<A_TENSOR, A_REF>, TensorLoadStore<B_TENSOR, B_REF>>;
+
+        RAJA_SUPPRESS_HD_WARN
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        bool exec(lhs_type const &lhs, rhs_type const &rhs){
+#ifdef RAJA_DEVICE_CODE
+          return false;
+#else
+          return impl_type::exec(lhs, rhs.getLeftOperand(), rhs.getRightOperand(),
+                                 TensorMultiplyBlockedZero<C_TENSOR>{});
+#endif
+        }
+    };
+
+
+    /*!
+     * C = A*B + ADD, which includes C += A*B
+     */
+    template<typename C_TENSOR, typename C_REF, typename A_TENSOR, typename A_REF, typename B_TENSOR, typename B_REF, typename ADD_TYPE>
+    struct TensorMultiplyBlocked<TensorLoadStore<C_TENSOR, C_REF>,
+                                 TensorMultiplyAdd<TensorLoadStore<A_TENSOR, A_REF>, TensorLoadStore<B_TENSOR, B_REF>, ADD_TYPE>,
+                                 typename std::enable_if<TensorMultiplyBlockable<C_TENSOR, A_TENSOR, B_TENSOR>::value &&
+                                                         std::is_same<C_TENSOR, typename ADD_TYPE::result_type>::value>::type>
+    {
+        using lhs_type = TensorLoadStore<C_TENSOR, C_REF>;
+        using rhs_type = TensorMultiplyAdd<TensorLoadStore<A_TENSOR, A_REF>, TensorLoadStore<B_TENSOR, B_REF>, ADD_TYPE>;
+        using impl_type = TensorMultiplyBlockedImpl<lhs_type, TensorLoadStore<A_TENSOR, A_REF>, TensorLoadStore<B_TENSOR, B_REF>>;
+
+        RAJA_SUPPRESS_HD_WARN
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        bool exec(lhs_type const &lhs, rhs_type const &rhs){
+#ifdef RAJA_DEVICE_CODE
+          return false;
+#else
+          return impl_type::exec(lhs, rhs.getLeftOperand(), rhs.getRightOperand(),
+                                 TensorMultiplyBlockedAdd<impl_type, ADD_TYPE>{rhs.getAddOperand()});
+#endif
+        }
+    };
+
+
+  } // namespace ET
+
+  } // namespace internal
+} // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
@@ -0,0 +1,312 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining reductions of tensor expressions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_ET_TensorReduce_HPP
+#define RAJA_pattern_tensor_ET_TensorReduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
+#include "RAJA/pattern/tensor/internal/TensorTileExec.hpp"
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+
+  namespace ET
+  {
+
+    /*
+     * Reduction operators
+     *
+     * Full tiles are combined lane-wise into one register, and the partial
+     * tile (there is at most one for a vector) is reduced to a scalar, so
+     * that lanes past its end never reach the accumulator.
+     */
+
+    struct TensorReduceSum
+    {
+        template<typename T>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        constexpr
+        T identity(){
+          return T(0);
+        }
+
+        template<typename TENSOR>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        TENSOR combine(TENSOR const &acc, TENSOR const &x){
+          return acc.add(x);
+        }
+
+        template<typename T>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        constexpr
+        T combine_scalar(T a, T b){
+          return a + b;
+        }
+
+        template<typename TENSOR>
+        RAJA_INLINE
+        static
+        typename TENSOR::element_type reduce(TENSOR const &x){
+          return x.sum();
+        }
+
+        // partial loads zero the lanes past N
+        template<typename TENSOR>
+        RAJA_INLINE
+        static
+        typename TENSOR::element_type reduce_n(TENSOR const &x, camp::idx_t){
+          return x.sum();
+        }
+    };
+
+    struct TensorReduceMin
+    {
+        template<typename T>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        constexpr
+        T identity(){
+          return RAJA::operators::limits<T>::max();
+        }
+
+        template<typename TENSOR>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        TENSOR combine(TENSOR const &acc, TENSOR const &x){
+          return acc.vmin(x);
+        }
+
+        template<typename T>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        constexpr
+        T combine_scalar(T a, T b){
+          return RAJA::min<T>(a, b);
+        }
+
+        template<typename TENSOR>
+        RAJA_INLINE
+        static
+        typename TENSOR::element_type reduce(TENSOR const &x){
+          return x.min();
+        }
+
+        template<typename TENSOR>
+        RAJA_INLINE
+        static
+        typename TENSOR::element_type reduce_n(TENSOR const &x, camp::idx_t N){
+          return x.min_n(N);
+        }
+    };
+
+    struct TensorReduceMax
+    {
+        template<typename T>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        constexpr
+        T identity(){
+          return RAJA::operators::limits<T>::min();
+        }
+
+        template<typename TENSOR>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        TENSOR combine(TENSOR const &acc, TENSOR const &x){
+          return acc.vmax(x);
+        }
+
+        template<typename T>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        static
+        constexpr
+        T combine_scalar(T a, T b){
+          return RAJA::max<T>(a, b);
+        }
+
+        template<typename TENSOR>
+        RAJA_INLINE
+        static
+        typename TENSOR::element_type reduce(TENSOR const &x){
+          return x.max();
+        }
+
+        template<typename TENSOR>
+        RAJA_INLINE
+        static
+        typename TENSOR::element_type reduce_n(TENSOR const &x, camp::idx_t N){
+          return x.max_n(N);
+        }
+    };
+
+
+    template<typename OP, typename ET_TYPE>
+    struct TensorReduceFunctor
+    {
+        using tensor_type = typename ET_TYPE::result_type;
+        using element_type = typename tensor_type::element_type;
+
+        ET_TYPE const &m_et;
+        tensor_type &m_acc;
+        element_type &m_tail;
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename TILE_TYPE>
+        RAJA_HOST_DEVICE
+        RAJA_INLINE
+        void operator()(TILE_TYPE const &tile) const {
+          tensor_type value = m_et.eval(tile);
+
+          if(TILE_TYPE::s_tensor_size == TENSOR_FULL){
+            m_acc = OP::combine(m_acc, value);
+          }
+          else{
+            m_tail = OP::combine_scalar(m_tail, OP::reduce_n(value, tile.m_size[0]));
+          }
+        }
+    };
+
+    template<typename LEFT_TYPE, typename RIGHT_TYPE>
+    struct TensorDotFunctor
+    {
+        using tensor_type = typename LEFT_TYPE::result_type;
+        using element_type = typename tensor_type::element_type;
+
+        LEFT_TYPE const &m_left;
+        RIGHT_TYPE const &m_right;
+        tensor_type &m_acc;
+        element_type &m_tail;
+
+        RAJA_SUPPRESS_HD_WARN
+        template<typename TILE_TYPE>
+        RAJA_HOST_DEVICE
+        RAJA_INLINE
+        void operator()(TILE_TYPE const &tile) const {
+          tensor_type left = m_left.eval(tile);
+          tensor_type right = m_right.eval(tile);
+
+          if(TILE_TYPE::s_tensor_size == TENSOR_FULL){
+            m_acc = left.multiply_add(right, m_acc);
+          }
+          else{
+            // partial loads zero the lanes past the tile
+            m_tail += left.dot(right);
+          }
+        }
+    };
+
+
+    /*!
+     * Returns the tile spanning a vector expression
+     */
+    template<typename ET_TYPE>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    TensorTile<camp::idx_t, TENSOR_FULL, 1>
+    getReduceTile(ET_TYPE const &et)
+    {
+      static_assert(ET_TYPE::s_num_dims == 1,
+          "Tensor reductions are only supported for vector expressions");
+
+      return TensorTile<camp::idx_t, TENSOR_FULL, 1>{
+        {(camp::idx_t)et.getDimBegin(0)},
+        {(camp::idx_t)et.getDimSize(0)}
+      };
+    }
+
+    /*!
+     * Reduces all elements of a vector expression with OP.
+     *
+     * The expression is evaluated one register-sized tile at a time, and
+     * the tiles are combined in a register, so the only horizontal
+     * reduction is the one at the end.
+     */
+    RAJA_SUPPRESS_HD_WARN
+    template<typename OP, typename ET_TYPE>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    typename ET_TYPE::result_type::element_type
+    tensorReduce(ET_TYPE const &et)
+    {
+      using tensor_type = typename ET_TYPE::result_type;
+      using element_type = typename tensor_type::element_type;
+
+      tensor_type acc(OP::template identity<element_type>());
+      element_type tail = OP::template identity<element_type>();
+
+      tensorTileExec<tensor_type>(getReduceTile(et),
+          TensorReduceFunctor<OP, ET_TYPE>{et, acc, tail});
+
+      return OP::combine_scalar(OP::reduce(acc), tail);
+    }
+
+    /*!
+     * Dot product of two vector expressions, accumulated with FMAs
+     */
+    RAJA_SUPPRESS_HD_WARN
+    template<typename LEFT_TYPE, typename RIGHT_TYPE>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    typename LEFT_TYPE::result_type::element_type
+    tensorDot(LEFT_TYPE const &left, RIGHT_TYPE const &right)
+    {
+      using tensor_type = typename LEFT_TYPE::result_type;
+      using element_type = typename tensor_type::element_type;
+
+      tensor_type acc(element_type(0));
+      element_type tail(0);
+
+      tensorTileExec<tensor_type>(getReduceTile(left),
+          TensorDotFunctor<LEFT_TYPE, RIGHT_TYPE>{left, right, acc, tail});
+
+      return acc.sum() + tail;
+    }
+
+
+  } // namespace ET
+
+  } // namespace internal
+} // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
@@ -0,0 +1,165 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the element wise select of tensor
+ *          expressions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_ET_TensorSelect_HPP
+#define RAJA_pattern_tensor_ET_TensorSelect_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
+#include "RAJA/pattern/tensor/internal/ET/BinaryOperatorTraits.hpp"
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+
+  namespace ET
+  {
+
+    /*!
+     * Evaluates to TRUE_OPERAND where the comparison MASK_OPERAND holds, and
+     * to FALSE_OPERAND elsewhere, with a blend of each tile.
+     *
+     * Both operands are evaluated for every tile, so this replaces a branch
+     * and not a guard: the unselected values must still be safe to compute.
+     * One of the operands may be a scalar.
+     */
+    template<typename MASK_OPERAND, typename TRUE_OPERAND, typename FALSE_OPERAND>
+    class TensorSelect :
+        public TensorExpressionBase<TensorSelect<MASK_OPERAND, TRUE_OPERAND, FALSE_OPERAND>>
+    {
+      public:
+        using self_type = TensorSelect<MASK_OPERAND, TRUE_OPERAND, FALSE_OPERAND>;
+        using mask_operand_type = MASK_OPERAND;
+        using true_operand_type = TRUE_OPERAND;
+        using false_operand_type = FALSE_OPERAND;
+
+        using operator_traits = OperatorTraits<TRUE_OPERAND, FALSE_OPERAND>;
+        using result_type = typename operator_traits::result_type;
+
+        static constexpr camp::idx_t s_num_dims =
+            operator_traits::s_num_dims;
+
+      private:
+        mask_operand_type m_mask_operand;
+        true_operand_type m_true_operand;
+        false_operand_type m_false_operand;
+
+      public:
+
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        TensorSelect(mask_operand_type const &mask,
+                     true_operand_type const &if_true,
+                     false_operand_type const &if_false) :
+        m_mask_operand{mask}, m_true_operand{if_true}, m_false_operand{if_false}
+        {}
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        int getDimSize(camp::idx_t dim) const
+        {
+          return operator_traits::getDimSize(dim, m_true_operand, m_false_operand);
+        }
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        camp::idx_t getDimBegin(camp::idx_t dim) const
+        {
+          return operator_traits::getDimBegin(dim, m_true_operand, m_false_operand);
+        }
+
+        template<typename TILE_TYPE>
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        result_type eval(TILE_TYPE const &tile) const
+        {
+          // scalar operands are broadcast
+          return result_type(m_false_operand.eval(tile)).blend(
+              m_mask_operand.eval(tile), result_type(m_true_operand.eval(tile)));
+        }
+
+
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        void print_ast() const {
+          printf("Select(");
+          m_mask_operand.print_ast();
+          printf(", ");
+          m_true_operand.print_ast();
+          printf(", ");
+          m_false_operand.print_ast();
+          printf(")");
+        }
+
+
+    };
+
+
+  } // namespace ET
+
+  } // namespace internal
+} // namespace expt
+
+
+namespace expt
+{
+
+  /*!
+   * Element wise select of tensor expressions, if_true where mask holds and
+   * if_false elsewhere, for example a limiter:
+   *
+   *   y(all) = select(x(all) < x_min, x_min, x(all));
+   *
+   * A masked store is the select of the stored tensor itself:
+   *
+   *   y(all) = select(x(all) > y(all), x(all), y(all));
+   */
+  template<typename MASK, typename TRUE_TYPE, typename FALSE_TYPE,
+    typename std::enable_if<std::is_base_of<RAJA::internal::expt::ET::TensorExpressionConcreteBase, MASK>::value, bool>::type = true>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  auto select(MASK const &mask, TRUE_TYPE const &if_true, FALSE_TYPE const &if_false) ->
+  RAJA::internal::expt::ET::TensorSelect<MASK,
+      RAJA::internal::expt::ET::normalize_operand_t<TRUE_TYPE>,
+      RAJA::internal::expt::ET::normalize_operand_t<FALSE_TYPE>>
+  {
+    return RAJA::internal::expt::ET::TensorSelect<MASK,
+        RAJA::internal::expt::ET::normalize_operand_t<TRUE_TYPE>,
+        RAJA::internal::expt::ET::normalize_operand_t<FALSE_TYPE>>(
+            mask,
+            RAJA::internal::expt::ET::normalizeOperand(if_true),
+            RAJA::internal::expt::ET::normalizeOperand(if_false));
+  }
+
+} // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
@@ -62,6 +62,13 @@ namespace expt
           return m_tensor.getDimSize(dim);
         }
 
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        camp::idx_t getDimBegin(camp::idx_t dim) const {
+          return m_tensor.getDimBegin(dim);
+        }
+
         template<typename TILE_TYPE>
         RAJA_INLINE
         RAJA_HOST_DEVICE
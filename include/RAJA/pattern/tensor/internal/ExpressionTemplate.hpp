@@ -26,8 +26,11 @@
 #include "RAJA/pattern/tensor/internal/ET/TensorLoadStore.hpp"
 #include "RAJA/pattern/tensor/internal/ET/TensorMultiply.hpp"
 #include "RAJA/pattern/tensor/internal/ET/TensorMultiplyAdd.hpp"
+#include "RAJA/pattern/tensor/internal/ET/TensorMultiplyBlocked.hpp"
 #include "RAJA/pattern/tensor/internal/ET/TensorNegate.hpp"
+#include "RAJA/pattern/tensor/internal/ET/TensorReduce.hpp"
 #include "RAJA/pattern/tensor/internal/ET/TensorScalarLiteral.hpp"
+#include "RAJA/pattern/tensor/internal/ET/TensorSelect.hpp"
 #include "RAJA/pattern/tensor/internal/ET/TensorTranspose.hpp"
 
 
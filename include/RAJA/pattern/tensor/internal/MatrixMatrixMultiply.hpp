@@ -93,9 +93,7 @@ namespace expt
       typename std::enable_if<(s_C_minor_dim_registers != 0), dummy>::type
       multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
       {
-#if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(__CUDA_ARCH__)
-        RAJA::tensor_stats::num_matrix_mm_multacc_row_row ++;
-#endif
+        RAJA_TENSOR_STATS_INC(num_matrix_mm_multacc_row_row);
 
         constexpr camp::idx_t num_bc_reg_per_row = s_C_minor_dim_registers;
 
@@ -109,7 +107,7 @@ namespace expt
             camp::idx_t b_reg = a_col * num_bc_reg_per_row + bc_col_reg;
 
             C.get_register(c_reg) =
-                register_type(A.get(ac_row, a_col)).multiply_add(
+                A.get_and_broadcast(ac_row, a_col).multiply_add(
                     B.get_register(b_reg),
                     C.get_register(c_reg));
           }
@@ -128,6 +126,8 @@ namespace expt
       typename std::enable_if<(s_C_minor_dim_registers == 0), dummy>::type
       multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
       {
+        RAJA_TENSOR_STATS_INC(num_matrix_mm_multacc_row_row);
+
         constexpr camp::idx_t bc_segbits = result_type::s_segbits;
         constexpr camp::idx_t a_segments_per_register = 1<<bc_segbits;
 
@@ -166,6 +166,7 @@ namespace expt
       static
       RAJA_INLINE
       void multiply(left_type const &A, right_type const &B, result_type &C){
+        RAJA_TENSOR_STATS_INC(num_matrix_mm_mult_row_row);
         C = result_type(0);
         multiply_accumulate(A, B, C);
       }
@@ -237,9 +238,7 @@ namespace expt
         multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
         {
 
-  #if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(__CUDA_ARCH__)
-          RAJA::tensor_stats::num_matrix_mm_multacc_row_row ++;
-  #endif
+          RAJA_TENSOR_STATS_INC(num_matrix_mm_multacc_col_col);
 
 
           constexpr camp::idx_t num_ac_reg_per_col = s_C_minor_dim_registers;
@@ -254,7 +253,7 @@ namespace expt
               camp::idx_t a_reg = b_row * num_ac_reg_per_col + ac_row_reg;
 
               C.get_register(c_reg) =
-                  register_type(B.get(b_row, bc_col)).multiply_add(
+                  B.get_and_broadcast(b_row, bc_col).multiply_add(
                       A.get_register(a_reg),
                       C.get_register(c_reg));
             }
@@ -274,6 +273,8 @@ namespace expt
         typename std::enable_if<(s_C_minor_dim_registers == 0), dummy>::type
         multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
         {
+          RAJA_TENSOR_STATS_INC(num_matrix_mm_multacc_col_col);
+
           constexpr camp::idx_t ac_segbits = result_type::s_segbits;
           constexpr camp::idx_t b_segments_per_register = 1<<ac_segbits;
 
@@ -320,6 +321,7 @@ namespace expt
         static
         RAJA_INLINE
         void multiply(left_type const &A, right_type const &B, result_type &C){
+          RAJA_TENSOR_STATS_INC(num_matrix_mm_mult_col_col);
           C = result_type(0);
           self_type::multiply_accumulate(A, B, C);
         }
@@ -249,10 +249,12 @@ namespace expt
         if(is_ref_packed<STRIDE_ONE_DIM>()){
           // full vector?
           if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+            RAJA_TENSOR_STATS_INC(num_matrix_load_packed);
             load_packed(ptr, ref.m_stride[0], ref.m_stride[1]);
           }
           // partial
           else{
+            RAJA_TENSOR_STATS_INC(num_matrix_load_packed_nm);
             load_packed_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                 ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
           }
@@ -263,10 +265,12 @@ namespace expt
         {
           // full vector?
           if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+            RAJA_TENSOR_STATS_INC(num_matrix_load_strided);
             load_strided(ptr, ref.m_stride[0], ref.m_stride[1]);
           }
           // partial
           else{
+            RAJA_TENSOR_STATS_INC(num_matrix_load_strided_nm);
             load_strided_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                 ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
           }
@@ -291,10 +295,12 @@ namespace expt
         {
           // full vector?
           if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+            RAJA_TENSOR_STATS_INC(num_matrix_store_packed);
             store_packed(ptr, ref.m_stride[0], ref.m_stride[1]);
           }
           // partial
           else{
+            RAJA_TENSOR_STATS_INC(num_matrix_store_packed_nm);
             store_packed_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                 ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
           }
@@ -305,10 +311,12 @@ namespace expt
         {
           // full vector?
           if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+            RAJA_TENSOR_STATS_INC(num_matrix_store_strided);
             store_strided(ptr, ref.m_stride[0], ref.m_stride[1]);
           }
           // partial
           else{
+            RAJA_TENSOR_STATS_INC(num_matrix_store_strided_nm);
             store_strided_nm(ptr, ref.m_stride[0], ref.m_stride[1],
                                 ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
           }
@@ -1473,6 +1481,17 @@ namespace expt
         return m_registers[to_register(row, col)].get(to_lane(row,col));
       }
 
+      /*!
+       * Broadcasts element (row, col) to a whole register, without going
+       * through element_type, so registers that compute wider than they
+       * store keep the full value.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      register_type get_and_broadcast(int row, int col) const {
+        return m_registers[to_register(row, col)].get_and_broadcast(to_lane(row,col));
+      }
+
 
       RAJA_HOST_DEVICE
       RAJA_INLINE
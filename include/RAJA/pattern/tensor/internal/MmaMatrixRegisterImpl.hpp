@@ -0,0 +1,745 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining matrix registers stored in the
+ *          accumulator fragment layout of a warp matrix instruction.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_MmaMatrixRegisterImpl_HPP
+#define RAJA_pattern_tensor_MmaMatrixRegisterImpl_HPP
+
+#include "camp/camp.hpp"
+#include "RAJA/config.hpp"
+#include "RAJA/pattern/tensor/MatrixRegister.hpp"
+#include "RAJA/pattern/tensor/VectorRegister.hpp"
+#include "RAJA/pattern/tensor/internal/TensorRegisterBase.hpp"
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Describes the operand and accumulator fragments of one warp level
+   * matrix multiply-accumulate, C(MxN) += A(MxK) * B(KxN).
+   *
+   * Specializations provide:
+   *
+   *   static constexpr camp::idx_t s_tile_rows;   // M
+   *   static constexpr camp::idx_t s_tile_cols;   // N
+   *   static constexpr camp::idx_t s_tile_k;      // K
+   *   static constexpr camp::idx_t s_num_slots;   // C elements per lane
+   *
+   *   c_row(lane, slot), c_col(lane, slot)  // position of a C element
+   *   c_lane(row, col), c_slot(row, col)    // owner of a C element
+   *   a_row(lane), a_k(lane)                // the A element a lane holds
+   *   a_lane(row, k)                        // the lane holding A(row, k)
+   *   b_k(lane), b_col(lane)                // the B element a lane holds
+   *   b_lane(k, col)                        // the lane holding B(k, col)
+   *
+   *   mma(a, b, c)   // c[slot] += (A*B)(c_row, c_col) for this lane
+   */
+  template<typename REGISTER_POLICY, typename T>
+  struct MmaTraits;
+
+
+  /*!
+   * Tile multiply-accumulate with shuffles and FMAs, in the fragment layout
+   * of MMA_TRAITS.
+   *
+   * Used for element types and architectures that have no matrix
+   * instruction, so every MMA layout works everywhere.
+   */
+  template<typename MMA_TRAITS, typename REGISTER_TYPE, typename T>
+  RAJA_DEVICE
+  RAJA_INLINE
+  void mma_fma_tile(T a, T b, T (&c)[MMA_TRAITS::s_num_slots])
+  {
+    REGISTER_TYPE ra(a), rb(b);
+    int lane = REGISTER_TYPE::get_lane();
+
+    RAJA_UNROLL
+    for(camp::idx_t slot = 0;slot < MMA_TRAITS::s_num_slots;++ slot){
+      int row = MMA_TRAITS::c_row(lane, slot);
+      int col = MMA_TRAITS::c_col(lane, slot);
+      RAJA_UNROLL
+      for(camp::idx_t k = 0;k < MMA_TRAITS::s_tile_k;++ k){
+        c[slot] += ra.get(MMA_TRAITS::a_lane(row, k)) *
+                   rb.get(MMA_TRAITS::b_lane(k, col));
+      }
+    }
+  }
+
+
+  /*!
+   * Matrix register whose elements are kept in the accumulator fragment
+   * layout of MmaTraits<REGISTER_POLICY, T>.
+   *
+   * The matrix is split into MxN tiles, numbered row-major. Register
+   * (tile*s_num_slots + slot) holds, in each lane, the tile element that
+   * MmaTraits assigns to that lane and slot. Loads and stores convert
+   * between memory and this layout, so matrix_multiply can feed the
+   * fragments straight to the matrix instruction. The layout template
+   * argument only selects the preferred memory layout for loads and stores.
+   */
+  template<typename Derived>
+  class MmaMatrixRegisterBase;
+
+  template<typename REGISTER_POLICY, typename T, camp::idx_t ROW_ORD, camp::idx_t COL_ORD, camp::idx_t ROW_SIZE, camp::idx_t COL_SIZE>
+  class MmaMatrixRegisterBase<RAJA::expt::TensorRegister<REGISTER_POLICY, T, RAJA::expt::TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>> :
+    public TensorRegisterBase<RAJA::expt::TensorRegister<REGISTER_POLICY, T, RAJA::expt::TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>>
+  {
+    public:
+      using self_type = RAJA::expt::TensorRegister<REGISTER_POLICY, T, RAJA::expt::TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>;
+      using base_type = TensorRegisterBase<self_type>;
+      using register_type = RAJA::expt::Register<T, REGISTER_POLICY>;
+      using row_vector_type = RAJA::expt::VectorRegister<T, REGISTER_POLICY, COL_SIZE>;
+      using column_vector_type = RAJA::expt::VectorRegister<T, REGISTER_POLICY, ROW_SIZE>;
+      using register_policy = REGISTER_POLICY;
+      using element_type = T;
+      using layout_type = RAJA::expt::TensorLayout<ROW_ORD, COL_ORD>;
+      using mma_traits = MmaTraits<REGISTER_POLICY, T>;
+
+      using transpose_tensor_type = RAJA::expt::TensorRegister<REGISTER_POLICY, T, RAJA::expt::TensorLayout<!ROW_ORD, !COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>;
+
+      using transpose_type = RAJA::expt::TensorRegister<REGISTER_POLICY, T, layout_type, camp::idx_seq<COL_SIZE, ROW_SIZE>>;
+      using product_type = RAJA::expt::TensorRegister<REGISTER_POLICY, T, layout_type, camp::idx_seq<ROW_SIZE, ROW_SIZE>>;
+
+      static constexpr camp::idx_t s_num_rows = ROW_SIZE;
+      static constexpr camp::idx_t s_num_columns = COL_SIZE;
+
+      static constexpr camp::idx_t s_elements_per_register = register_type::s_num_elem;
+
+      static constexpr camp::idx_t s_tile_rows = mma_traits::s_tile_rows;
+      static constexpr camp::idx_t s_tile_cols = mma_traits::s_tile_cols;
+      static constexpr camp::idx_t s_tile_k = mma_traits::s_tile_k;
+      static constexpr camp::idx_t s_num_slots = mma_traits::s_num_slots;
+
+      static constexpr camp::idx_t s_row_tiles = ROW_SIZE / s_tile_rows;
+      static constexpr camp::idx_t s_col_tiles = COL_SIZE / s_tile_cols;
+
+      static_assert(ROW_SIZE % s_tile_rows == 0 && COL_SIZE % s_tile_cols == 0,
+          "MMA MatrixRegister must be dimensioned in whole MMA tiles");
+
+      static_assert(s_tile_rows*s_tile_cols == s_num_slots*s_elements_per_register,
+          "MMA accumulator tile must exactly fill s_num_slots registers");
+
+      static_assert(s_tile_rows % s_tile_k == 0 && s_tile_cols % s_tile_k == 0 &&
+                    s_elements_per_register % s_tile_rows == 0 &&
+                    s_elements_per_register % s_tile_cols == 0,
+          "MMA tile shape is not supported");
+
+    protected:
+      using base_type::m_registers;
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type *getThis(){
+        return static_cast<self_type *>(this);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      self_type const *getThis() const{
+        return static_cast<self_type const *>(this);
+      }
+
+      /*!
+       * Row of the element that lane holds in register reg
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      int reg_row(camp::idx_t reg, int lane){
+        return (reg / s_num_slots / s_col_tiles) * s_tile_rows +
+               mma_traits::c_row(lane, reg % s_num_slots);
+      }
+
+      /*!
+       * Column of the element that lane holds in register reg
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      int reg_col(camp::idx_t reg, int lane){
+        return (reg / s_num_slots % s_col_tiles) * s_tile_cols +
+               mma_traits::c_col(lane, reg % s_num_slots);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      camp::idx_t to_register(int row, int col){
+        return ((row / s_tile_rows) * s_col_tiles + col / s_tile_cols) * s_num_slots +
+               mma_traits::c_slot(row % s_tile_rows, col % s_tile_cols);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      int to_lane(int row, int col){
+        return mma_traits::c_lane(row % s_tile_rows, col % s_tile_cols);
+      }
+
+    public:
+
+      /*!
+       * Gathers this lane's element of a tile-local (row, col) that varies
+       * by lane, from the tile starting at register tile_reg.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type gather_tile(camp::idx_t tile_reg, int row, int col) const {
+        int src = mma_traits::c_lane(row, col);
+        camp::idx_t src_slot = mma_traits::c_slot(row, col);
+        element_type value = 0;
+        RAJA_UNROLL
+        for(camp::idx_t slot = 0;slot < s_num_slots;++ slot){
+          element_type v = m_registers[tile_reg + slot].get(src);
+          value = slot == src_slot ? v : value;
+        }
+        return value;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      MmaMatrixRegisterBase() : base_type() {}
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      MmaMatrixRegisterBase(element_type c) : base_type(c) {}
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      MmaMatrixRegisterBase(self_type const &c) : base_type(c) {}
+
+
+      /*!
+       * Returns true if the underlying data packed for a given tensor ref
+       *
+       * Fragment loads and stores handle any strides, so load_ref and
+       * store_ref do not depend on this.
+       */
+      template<camp::idx_t STRIDE_ONE_DIM>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      bool is_ref_packed() {
+        return (STRIDE_ONE_DIM == 0 && layout_type::is_column_major()) ||
+            (STRIDE_ONE_DIM == 1 && layout_type::is_row_major());
+      }
+
+      /*!
+       * Gets the maximum size of matrix along specified dimension
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr camp::idx_t s_dim_elem(camp::idx_t dim){
+        return dim == 0 ? ROW_SIZE : COL_SIZE;
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &operator=(element_type value)
+      {
+        this->broadcast(value);
+        return *getThis();
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &operator=(self_type const &c){
+        return this->copy(c);
+      }
+
+      /*!
+       * Provide right matrix-vector multiply for operator* between this
+       * matrix and a vector.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      column_vector_type
+      operator*(row_vector_type const &y) const
+      {
+        return right_multiply_vector(y);
+      }
+
+
+      /*!
+       * @brief Performs load specified by TensorRef object.
+       *
+       * Each lane reads the elements of its fragments directly, which is
+       * where the conversion from the memory layout happens.
+       */
+      template<typename POINTER_TYPE, typename INDEX_TYPE, RAJA::internal::expt::TensorTileSize TENSOR_SIZE, camp::idx_t STRIDE_ONE_DIM>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type &load_ref(RAJA::internal::expt::TensorRef<POINTER_TYPE, INDEX_TYPE, TENSOR_SIZE, 2, STRIDE_ONE_DIM> const &ref){
+
+        auto ptr = ref.m_pointer + ref.m_tile.m_begin[0]*ref.m_stride[0] +
+                                   ref.m_tile.m_begin[1]*ref.m_stride[1];
+
+        if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+          load_strided(ptr, ref.m_stride[0], ref.m_stride[1]);
+        }
+        else{
+          load_strided_nm(ptr, ref.m_stride[0], ref.m_stride[1],
+                               ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
+        }
+        return *getThis();
+      }
+
+      /*!
+       * @brief Performs store specified by TensorRef object.
+       */
+      template<typename POINTER_TYPE, typename INDEX_TYPE, RAJA::internal::expt::TensorTileSize TENSOR_SIZE, camp::idx_t STRIDE_ONE_DIM>
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type const &store_ref(RAJA::internal::expt::TensorRef<POINTER_TYPE, INDEX_TYPE, TENSOR_SIZE, 2, STRIDE_ONE_DIM> const &ref) const {
+
+        auto ptr = ref.m_pointer + ref.m_tile.m_begin[0]*ref.m_stride[0] +
+                                   ref.m_tile.m_begin[1]*ref.m_stride[1];
+
+        if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
+          store_strided(ptr, ref.m_stride[0], ref.m_stride[1]);
+        }
+        else{
+          store_strided_nm(ptr, ref.m_stride[0], ref.m_stride[1],
+                                ref.m_tile.m_size[0], ref.m_tile.m_size[1]);
+        }
+        return *getThis();
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr,
+          int row_stride, int col_stride)
+      {
+        return load_strided(ptr, row_stride, col_stride);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_strided(element_type const *ptr,
+          int row_stride, int col_stride)
+      {
+        int lane = register_type::get_lane();
+        RAJA_UNROLL
+        for(camp::idx_t reg = 0;reg < base_type::s_num_registers;++ reg){
+          m_registers[reg].get_raw_value() =
+              ptr[reg_row(reg, lane)*row_stride + reg_col(reg, lane)*col_stride];
+        }
+        return *getThis();
+      }
+
+      /*!
+       * Loads a partial matrix, filling the rest with zeros
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_nm(element_type const *ptr,
+          int row_stride, int col_stride,
+          int num_rows, int num_cols)
+      {
+        return load_strided_nm(ptr, row_stride, col_stride, num_rows, num_cols);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_strided_nm(element_type const *ptr,
+          int row_stride, int col_stride,
+          int num_rows, int num_cols)
+      {
+        int lane = register_type::get_lane();
+        RAJA_UNROLL
+        for(camp::idx_t reg = 0;reg < base_type::s_num_registers;++ reg){
+          int row = reg_row(reg, lane);
+          int col = reg_col(reg, lane);
+          m_registers[reg].get_raw_value() = (row < num_rows && col < num_cols) ?
+              ptr[row*row_stride + col*col_stride] : element_type(0);
+        }
+        return *getThis();
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr,
+          int row_stride, int col_stride) const
+      {
+        return store_strided(ptr, row_stride, col_stride);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_strided(element_type *ptr,
+          int row_stride, int col_stride) const
+      {
+        int lane = register_type::get_lane();
+        RAJA_UNROLL
+        for(camp::idx_t reg = 0;reg < base_type::s_num_registers;++ reg){
+          ptr[reg_row(reg, lane)*row_stride + reg_col(reg, lane)*col_stride] =
+              m_registers[reg].get_raw_value();
+        }
+        return *getThis();
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_nm(element_type *ptr,
+          int row_stride, int col_stride,
+          int num_rows, int num_cols) const
+      {
+        return store_strided_nm(ptr, row_stride, col_stride, num_rows, num_cols);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_strided_nm(element_type *ptr,
+          int row_stride, int col_stride,
+          int num_rows, int num_cols) const
+      {
+        int lane = register_type::get_lane();
+        RAJA_UNROLL
+        for(camp::idx_t reg = 0;reg < base_type::s_num_registers;++ reg){
+          int row = reg_row(reg, lane);
+          int col = reg_col(reg, lane);
+          if(row < num_rows && col < num_cols){
+            ptr[row*row_stride + col*col_stride] = m_registers[reg].get_raw_value();
+          }
+        }
+        return *getThis();
+      }
+
+
+      /*!
+       * Divides by mat inside the num_rows x num_cols corner, zero elsewhere
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide_nm(self_type mat, int num_rows, int num_cols) const {
+        self_type result;
+        int lane = register_type::get_lane();
+        RAJA_UNROLL
+        for(camp::idx_t reg = 0;reg < base_type::s_num_registers;++ reg){
+          bool inside = reg_row(reg, lane) < num_rows && reg_col(reg, lane) < num_cols;
+          result.get_register(reg).get_raw_value() = inside ?
+              m_registers[reg].get_raw_value() / mat.get_register(reg).get_raw_value() :
+              element_type(0);
+        }
+        return result;
+      }
+
+
+      /*!
+       * Matrix vector product
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      column_vector_type right_multiply_vector(row_vector_type v) const {
+        column_vector_type result(0);
+        return right_multiply_vector_accumulate(v, result);
+      }
+
+      /*!
+       * Matrix vector product
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      row_vector_type left_multiply_vector(column_vector_type v) const {
+        row_vector_type result(0);
+        return left_multiply_vector_accumulate(v, result);
+      }
+
+      /*!
+       * Matrix vector product with accumulation into another vector
+       *
+       * acc += (this) * v
+       *
+       * Each lane first sums its slots over the column tiles, then the
+       * partial sums of each row are gathered from their owner lanes.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      column_vector_type right_multiply_vector_accumulate(row_vector_type const &v, column_vector_type result) const {
+        int lane = register_type::get_lane();
+
+        // partial[ti*s_num_slots + slot], summed over column tiles
+        register_type partial[s_row_tiles*s_num_slots];
+        RAJA_UNROLL
+        for(camp::idx_t ti = 0;ti < s_row_tiles;++ ti){
+          RAJA_UNROLL
+          for(camp::idx_t slot = 0;slot < s_num_slots;++ slot){
+            element_type sum = 0;
+            RAJA_UNROLL
+            for(camp::idx_t tj = 0;tj < s_col_tiles;++ tj){
+              camp::idx_t reg = (ti*s_col_tiles + tj)*s_num_slots + slot;
+              int col = reg_col(reg, lane);
+              // a column tile never straddles two vector registers
+              element_type vv = v.get_register((tj*s_tile_cols) / s_elements_per_register).get(
+                  col % s_elements_per_register);
+              sum += m_registers[reg].get_raw_value() * vv;
+            }
+            partial[ti*s_num_slots + slot].get_raw_value() = sum;
+          }
+        }
+
+        // result element row = reg*s_elements_per_register + lane
+        RAJA_UNROLL
+        for(camp::idx_t reg = 0;reg*s_elements_per_register < ROW_SIZE;++ reg){
+          element_type sum = 0;
+          RAJA_UNROLL
+          for(camp::idx_t t = 0;t < s_elements_per_register/s_tile_rows;++ t){
+            camp::idx_t ti = reg*(s_elements_per_register/s_tile_rows) + t;
+            if(ti < s_row_tiles){
+              int row = lane % s_tile_rows;
+              element_type tsum = 0;
+              RAJA_UNROLL
+              for(camp::idx_t col = 0;col < s_tile_cols;++ col){
+                int src = mma_traits::c_lane(row, col);
+                camp::idx_t src_slot = mma_traits::c_slot(row, col);
+                RAJA_UNROLL
+                for(camp::idx_t slot = 0;slot < s_num_slots;++ slot){
+                  element_type p = partial[ti*s_num_slots + slot].get(src);
+                  tsum += slot == src_slot ? p : element_type(0);
+                }
+              }
+              sum = (lane / s_tile_rows == t) ? tsum : sum;
+            }
+          }
+          result.get_register(reg).get_raw_value() += sum;
+        }
+
+        return result;
+      }
+
+      /*!
+       * Matrix vector product with accumulation into another vector
+       *
+       * acc += v * (this)
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      row_vector_type left_multiply_vector_accumulate(column_vector_type const &v, row_vector_type result) const {
+        int lane = register_type::get_lane();
+
+        // partial[tj*s_num_slots + slot], summed over row tiles
+        register_type partial[s_col_tiles*s_num_slots];
+        RAJA_UNROLL
+        for(camp::idx_t tj = 0;tj < s_col_tiles;++ tj){
+          RAJA_UNROLL
+          for(camp::idx_t slot = 0;slot < s_num_slots;++ slot){
+            element_type sum = 0;
+            RAJA_UNROLL
+            for(camp::idx_t ti = 0;ti < s_row_tiles;++ ti){
+              camp::idx_t reg = (ti*s_col_tiles + tj)*s_num_slots + slot;
+              int row = reg_row(reg, lane);
+              element_type vv = v.get_register((ti*s_tile_rows) / s_elements_per_register).get(
+                  row % s_elements_per_register);
+              sum += m_registers[reg].get_raw_value() * vv;
+            }
+            partial[tj*s_num_slots + slot].get_raw_value() = sum;
+          }
+        }
+
+        // result element col = reg*s_elements_per_register + lane
+        RAJA_UNROLL
+        for(camp::idx_t reg = 0;reg*s_elements_per_register < COL_SIZE;++ reg){
+          element_type sum = 0;
+          RAJA_UNROLL
+          for(camp::idx_t t = 0;t < s_elements_per_register/s_tile_cols;++ t){
+            camp::idx_t tj = reg*(s_elements_per_register/s_tile_cols) + t;
+            if(tj < s_col_tiles){
+              int col = lane % s_tile_cols;
+              element_type tsum = 0;
+              RAJA_UNROLL
+              for(camp::idx_t row = 0;row < s_tile_rows;++ row){
+                int src = mma_traits::c_lane(row, col);
+                camp::idx_t src_slot = mma_traits::c_slot(row, col);
+                RAJA_UNROLL
+                for(camp::idx_t slot = 0;slot < s_num_slots;++ slot){
+                  element_type p = partial[tj*s_num_slots + slot].get(src);
+                  tsum += slot == src_slot ? p : element_type(0);
+                }
+              }
+              sum = (lane / s_tile_cols == t) ? tsum : sum;
+            }
+          }
+          result.get_register(reg).get_raw_value() += sum;
+        }
+
+        return result;
+      }
+
+
+      /*!
+       * Matrix-Matrix product
+       */
+      template<typename RMAT>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      RAJA::expt::TensorRegister<REGISTER_POLICY, T, layout_type, camp::idx_seq<ROW_SIZE, RMAT::s_num_columns>>
+      matrix_multiply(RMAT const &B) const {
+        RAJA::expt::TensorRegister<REGISTER_POLICY, T, layout_type, camp::idx_seq<ROW_SIZE, RMAT::s_num_columns>> res(0);
+        matrix_multiply_accumulate(res, B);
+        return res;
+      }
+
+      /*!
+       * Matrix-Matrix multiply add
+       */
+      template<typename RMAT, typename ACCMAT>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      ACCMAT
+      matrix_multiply_add(RMAT const &B, ACCMAT const &C) const {
+        ACCMAT res(C);
+        matrix_multiply_accumulate(res, B);
+        return res;
+      }
+
+      /*!
+       * Matrix-Matrix multiply accumulate, acc += (this) * B
+       *
+       * For each C tile, the A and B operand fragments of every K step are
+       * gathered from the accumulator layout tiles of this and B, and then
+       * handed to MmaTraits::mma.
+       */
+      template<typename ACCMAT, typename RMAT>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      void
+      matrix_multiply_accumulate(ACCMAT &acc, RMAT const &B) const {
+        static_assert(RMAT::s_num_rows == COL_SIZE, "Inner dimensions must match");
+        static_assert(ACCMAT::s_num_rows == ROW_SIZE &&
+                      ACCMAT::s_num_columns == RMAT::s_num_columns,
+                      "Result dimensions must match");
+
+        constexpr camp::idx_t b_col_tiles = RMAT::s_num_columns / s_tile_cols;
+
+        int lane = register_type::get_lane();
+
+        RAJA_UNROLL
+        for(camp::idx_t ti = 0;ti < s_row_tiles;++ ti){
+          RAJA_UNROLL
+          for(camp::idx_t tj = 0;tj < b_col_tiles;++ tj){
+
+            camp::idx_t c_reg = (ti*b_col_tiles + tj)*s_num_slots;
+
+            element_type c[s_num_slots];
+            RAJA_UNROLL
+            for(camp::idx_t slot = 0;slot < s_num_slots;++ slot){
+              c[slot] = acc.get_register(c_reg + slot).get_raw_value();
+            }
+
+            RAJA_UNROLL
+            for(camp::idx_t k0 = 0;k0 < COL_SIZE;k0 += s_tile_k){
+
+              // this lane's A(row, k) lives in column tile k0/N of this
+              int ak = k0 + mma_traits::a_k(lane);
+              element_type a = gather_tile(
+                  (ti*s_col_tiles + k0/s_tile_cols)*s_num_slots,
+                  mma_traits::a_row(lane), ak % s_tile_cols);
+
+              // this lane's B(k, col) lives in row tile k0/M of B
+              int bk = k0 + mma_traits::b_k(lane);
+              element_type b = B.gather_tile(
+                  ((k0/s_tile_rows)*b_col_tiles + tj)*s_num_slots,
+                  bk % s_tile_rows, mma_traits::b_col(lane));
+
+              mma_traits::mma(a, b, c);
+            }
+
+            RAJA_UNROLL
+            for(camp::idx_t slot = 0;slot < s_num_slots;++ slot){
+              acc.get_register(c_reg + slot).get_raw_value() = c[slot];
+            }
+          }
+        }
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &set(element_type val, int row, int col){
+        m_registers[to_register(row, col)].set(val, to_lane(row,col));
+        return *getThis();
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type get(int row, int col) const {
+        return m_registers[to_register(row, col)].get(to_lane(row,col));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      register_type get_and_broadcast(int row, int col) const {
+        return m_registers[to_register(row, col)].get_and_broadcast(to_lane(row,col));
+      }
+
+
+      /*!
+       * @brief Converts to matrix to a string
+       */
+      RAJA_INLINE
+      std::string to_string(bool one_line=false) const {
+        std::string s = "Matrix(" + std::to_string(s_num_rows) +
+            "x" + std::to_string(s_num_columns);
+        if(!one_line){
+          s +=")\n";
+        }
+
+        s += "[ ";
+
+        for(camp::idx_t r = 0;r < s_num_rows; ++ r){
+          if(r > 0){
+            s += ", ";
+            if(!one_line){
+              s+= "\n  ";
+            }
+          }
+          s += "[";
+          for(camp::idx_t c = 0;c < s_num_columns; ++ c){
+            if(c > 0){
+              s += ", ";
+            }
+            s += std::to_string(get(r,c));
+          }
+          s += "]";
+        }
+
+        s += " ]";
+        if(!one_line){
+          s+="\n";
+        }
+        return s;
+      }
+
+  };
+
+} // namespace expt
+} // namespace internal
+} // namespace RAJA
+
+
+#endif
@@ -22,10 +22,14 @@
 
 #include "RAJA/util/macros.hpp"
 
+#include <cmath>
+
 #include "camp/camp.hpp"
 #include "RAJA/pattern/tensor/TensorLayout.hpp"
 #include "RAJA/pattern/tensor/internal/TensorRef.hpp"
 #include "RAJA/util/BitMask.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterMath.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterMask.hpp"
 
 #include "RAJA/policy/tensor/arch.hpp"
 
@@ -126,6 +130,8 @@ namespace expt
       using int_element_type = typename RegisterTraits<REGISTER_POLICY, T>::int_element_type;
       using int_vector_type = RAJA::expt::Register<int_element_type, REGISTER_POLICY>;
 
+      using mask_type = RAJA::expt::RegisterMask<RegisterTraits<REGISTER_POLICY, T>::s_num_elem>;
+
     private:
 
       RAJA_HOST_DEVICE
@@ -217,9 +223,7 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type &gather(element_type const *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> offsets){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
         for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
           getThis()->set(ptr[offsets.get(i)], i);
         }
@@ -240,9 +244,7 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type &gather_n(element_type const *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
           for(camp::idx_t i = 0;i < N;++ i){
             getThis()->set(ptr[offsets.get(i)], i);
           }
@@ -325,9 +327,7 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type const &scatter(element_type *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets) const {
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
         for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
           ptr[offsets.get(i)] = getThis()->get(i);
         }
@@ -347,9 +347,7 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type const &scatter_n(element_type *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets, camp::idx_t N) const {
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
         for(camp::idx_t i = 0;i < N;++ i){
           ptr[offsets.get(i)] = getThis()->get(i);
         }
@@ -779,6 +777,523 @@ namespace expt
         return getThis()->max(N);
       }
 
+      /*!
+       * @brief Rounds each element to the nearest integer, ties to even
+       *
+       * The default adds and subtracts 1.5*2^(digits-1), so it needs the
+       * default rounding mode and is only valid for |x| < 2^(digits-2).
+       * Derived types can override this with a rounding instruction.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type round() const
+      {
+        self_type c(element_type(RegisterMathConstants<element_type>::s_round));
+        return getThis()->add(c).subtract(c);
+      }
+
+      /*!
+       * @brief Multiplies each element by 2^n, where n holds integer values
+       *
+       * Derived types can override this to avoid the scalar loop
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type ldexp(self_type const &n) const
+      {
+        self_type r;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          r.set(std::ldexp(getThis()->get(i), (int)n.get(i)), i);
+        }
+        return r;
+      }
+
+      /*!
+       * @brief Returns floor(log2(|x|)) of each element, for normal values
+       *
+       * Derived types can override this to avoid the scalar loop
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type exponent() const
+      {
+        self_type r;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          r.set(element_type(std::ilogb(getThis()->get(i))), i);
+        }
+        return r;
+      }
+
+      /*!
+       * @brief Square root of each element
+       *
+       * Derived types can override this to use a square root instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type sqrt() const
+      {
+        self_type r;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          r.set(std::sqrt(getThis()->get(i)), i);
+        }
+        return r;
+      }
+
+      /*!
+       * @brief Returns true if all elements are in [lo, hi], and none is NaN
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      bool in_range(element_type lo, element_type hi) const
+      {
+        element_type s = getThis()->sum();
+        return getThis()->min() >= lo && getThis()->max() <= hi && s == s;
+      }
+
+      /*!
+       * @brief Exponential of each element
+       *
+       * Computes 2^n exp(r) with r = x - n ln(2), and exp(r) from its Taylor
+       * series. Registers with elements outside of [s_exp_min, s_exp_max]
+       * (overflow, underflow to denormals, infinities and NaNs) use std::exp.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type exp() const
+      {
+        using C = RegisterMathConstants<element_type>;
+        self_type const &x = *getThis();
+
+        if(!x.in_range(element_type(C::s_exp_min), element_type(C::s_exp_max))){
+          self_type r;
+          for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+            r.set(std::exp(x.get(i)), i);
+          }
+          return r;
+        }
+
+        self_type n = x.scale(element_type(C::s_log2e)).round();
+
+        // Cody-Waite reduction, n*ln2_hi is exact
+        self_type r = n.scale(element_type(-C::s_ln2_hi)).add(x);
+        r = n.scale(element_type(-C::s_ln2_lo)).add(r);
+
+        element_type c[C::s_exp_degree + 1];
+        registerExpCoefficients(c, C::s_exp_degree);
+
+        return registerPolynomial(r, c, C::s_exp_degree).ldexp(n);
+      }
+
+      /*!
+       * @brief Natural logarithm of each element
+       *
+       * Computes e ln(2) + log(m) with x = 2^e m and m in [sqrt(1/2), sqrt(2)),
+       * and log(m) = 2 atanh((m-1)/(m+1)) from its series. Registers with
+       * elements outside of [s_log_min, s_log_max] (zero, negative, denormal
+       * and very large values, infinities and NaNs) use std::log.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type log() const
+      {
+        using C = RegisterMathConstants<element_type>;
+        self_type const &x = *getThis();
+
+        if(!x.in_range(element_type(C::s_log_min), element_type(C::s_log_max))){
+          self_type r;
+          for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+            r.set(std::log(x.get(i)), i);
+          }
+          return r;
+        }
+
+        self_type e = x.scale(element_type(C::s_sqrt2)).exponent();
+        self_type m = x.ldexp(-e);
+
+        self_type one(element_type(1));
+        self_type f = m.subtract(one).divide(m.add(one));
+        self_type f2 = f.multiply(f);
+
+        element_type c[C::s_log_degree + 1];
+        registerLogCoefficients(c, C::s_log_degree);
+
+        self_type log_m = registerPolynomial(f2, c, C::s_log_degree).multiply(f.add(f));
+
+        return e.multiply_add(self_type(element_type(C::s_ln2_hi)),
+                              e.multiply_add(self_type(element_type(C::s_ln2_lo)), log_m));
+      }
+
+      /*!
+       * @brief Power of each element, x^y = exp(y log(x))
+       *
+       * The relative error grows with |y log(x)|, by about that many ulp.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type pow(self_type const &y) const
+      {
+        return y.multiply(getThis()->log()).exp();
+      }
+
+      /*!
+       * @brief Sine of each element
+       *
+       * Reduces x to r = x - n pi/2, |r| <= pi/4, evaluates the sin(r) and
+       * cos(r) series and combines them by quadrant n mod 4 without
+       * branches. Registers with elements outside of +/-s_trig_max use
+       * std::sin.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type sin() const
+      {
+        using C = RegisterMathConstants<element_type>;
+        self_type const &x = *getThis();
+
+        if(!x.in_range(element_type(-C::s_trig_max), element_type(C::s_trig_max))){
+          self_type r;
+          for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+            r.set(std::sin(x.get(i)), i);
+          }
+          return r;
+        }
+
+        return x.sin_quadrant(element_type(0));
+      }
+
+      /*!
+       * @brief Cosine of each element, cos(x) = sin(x + pi/2) with the
+       * quarter turn added to the quadrant so that it is exact
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type cos() const
+      {
+        using C = RegisterMathConstants<element_type>;
+        self_type const &x = *getThis();
+
+        if(!x.in_range(element_type(-C::s_trig_max), element_type(C::s_trig_max))){
+          self_type r;
+          for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+            r.set(std::cos(x.get(i)), i);
+          }
+          return r;
+        }
+
+        return x.sin_quadrant(element_type(1));
+      }
+
+      /*!
+       * @brief sin(x + q pi/2), for |x| <= s_trig_max
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type sin_quadrant(element_type q) const
+      {
+        using C = RegisterMathConstants<element_type>;
+        self_type const &x = *getThis();
+
+        self_type n = x.scale(element_type(C::s_2_over_pi)).round();
+
+        // three part reduction, each n*pio2_k is exact
+        self_type r = n.scale(element_type(-C::s_pio2_1)).add(x);
+        r = n.scale(element_type(-C::s_pio2_2)).add(r);
+        r = n.scale(element_type(-C::s_pio2_3)).add(r);
+        self_type r2 = r.multiply(r);
+
+        element_type cs[C::s_sin_degree + 1];
+        registerSinCoefficients(cs, C::s_sin_degree);
+        self_type sin_r = registerPolynomial(r2, cs, C::s_sin_degree).multiply(r);
+
+        element_type cc[C::s_cos_degree + 1];
+        registerCosCoefficients(cc, C::s_cos_degree);
+        self_type cos_r = registerPolynomial(r2, cc, C::s_cos_degree);
+
+        // quadrant k = (n+q) mod 4, with floor(y) = round(y - 3/8) for y
+        // a multiple of 1/4
+        self_type nq = n.add(self_type(q));
+        self_type k = nq.subtract(nq.scale(element_type(0.25)).subtract(self_type(element_type(0.375))).round().scale(element_type(4)));
+
+        // odd = k mod 2, half = floor(k/2)
+        self_type half = k.scale(element_type(0.5)).subtract(self_type(element_type(0.25))).round();
+        self_type odd = k.subtract(half.scale(element_type(2)));
+
+        // sin for k = 0, cos for 1, -sin for 2, -cos for 3
+        self_type value = cos_r.subtract(sin_r).multiply_add(odd, sin_r);
+        return value.subtract(value.scale(element_type(2)).multiply(half));
+      }
+
+
+      /*!
+       * @brief Mask of the lanes that are equal to x
+       *
+       * Derived types can override this with a compare instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type compare_eq(self_type const &x) const
+      {
+        mask_type m;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          m.set(getThis()->get(i) == x.get(i), i);
+        }
+        return m;
+      }
+
+      /*!
+       * @brief Mask of the lanes that are not equal to x
+       *
+       * Derived types can override this with a compare instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type compare_ne(self_type const &x) const
+      {
+        mask_type m;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          m.set(getThis()->get(i) != x.get(i), i);
+        }
+        return m;
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than x
+       *
+       * Derived types can override this with a compare instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type compare_lt(self_type const &x) const
+      {
+        mask_type m;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          m.set(getThis()->get(i) < x.get(i), i);
+        }
+        return m;
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than or equal to x
+       *
+       * Derived types can override this with a compare instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type compare_le(self_type const &x) const
+      {
+        mask_type m;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          m.set(getThis()->get(i) <= x.get(i), i);
+        }
+        return m;
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than x
+       *
+       * Derived types can override this with a compare instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type compare_gt(self_type const &x) const
+      {
+        mask_type m;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          m.set(getThis()->get(i) > x.get(i), i);
+        }
+        return m;
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than or equal to x
+       *
+       * Derived types can override this with a compare instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type compare_ge(self_type const &x) const
+      {
+        mask_type m;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          m.set(getThis()->get(i) >= x.get(i), i);
+        }
+        return m;
+      }
+
+      /*!
+       * @brief Element wise comparison operators, which return a mask_type
+       *
+       * These compare lanes, the reductions compare whole registers.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator==(self_type const &x) const
+      {
+        return getThis()->compare_eq(x);
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator==(element_type const &x) const
+      {
+        return getThis()->compare_eq(self_type(x));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator!=(self_type const &x) const
+      {
+        return getThis()->compare_ne(x);
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator!=(element_type const &x) const
+      {
+        return getThis()->compare_ne(self_type(x));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator<(self_type const &x) const
+      {
+        return getThis()->compare_lt(x);
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator<(element_type const &x) const
+      {
+        return getThis()->compare_lt(self_type(x));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator<=(self_type const &x) const
+      {
+        return getThis()->compare_le(x);
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator<=(element_type const &x) const
+      {
+        return getThis()->compare_le(self_type(x));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator>(self_type const &x) const
+      {
+        return getThis()->compare_gt(x);
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator>(element_type const &x) const
+      {
+        return getThis()->compare_gt(self_type(x));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator>=(self_type const &x) const
+      {
+        return getThis()->compare_ge(x);
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      mask_type operator>=(element_type const &x) const
+      {
+        return getThis()->compare_ge(self_type(x));
+      }
+
+      /*!
+       * @brief Returns x in the lanes where mask is set, and this elsewhere
+       *
+       * Derived types can override this with a blend instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type blend(mask_type const &mask, self_type const &x) const
+      {
+        self_type r;
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          r.set(mask.get(i) ? x.get(i) : getThis()->get(i), i);
+        }
+        return r;
+      }
+
+      /*!
+       * @brief Loads the lanes where mask is set from a stride-one memory
+       * location, and zeroes the others
+       *
+       * Memory is only accessed for the lanes that are set.
+       * Derived types can override this with a masked load instruction.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type &load_packed_masked(element_type const *ptr, mask_type const &mask)
+      {
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          getThis()->set(mask.get(i) ? ptr[i] : element_type(0), i);
+        }
+        return *getThis();
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set to a stride-one memory
+       * location, leaving the others untouched
+       *
+       * Derived types can override this with a masked store instruction
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const
+      {
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          if(mask.get(i)){
+            ptr[i] = getThis()->get(i);
+          }
+        }
+        return *getThis();
+      }
+
+
       /*!
        * Provides vector-level building block for matrix transpose operations.
        *
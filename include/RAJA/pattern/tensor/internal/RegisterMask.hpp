@@ -0,0 +1,406 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the lane masks produced by register
+ *          comparisons.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_RegisterMask_HPP
+#define RAJA_pattern_tensor_RegisterMask_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include <cstdint>
+
+#include "camp/camp.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * A mask of the NUM_ELEM lanes of a register, lane i in bit i.
+   *
+   * Masks are returned by the register comparisons, and used by blend(),
+   * select() and the masked loads and stores:
+   *
+   *   auto neg = x < 0.0;
+   *   x = x.blend(neg, -x);             // |x|
+   *   y.store_packed_masked(ptr, ~neg);
+   *
+   * The bits map directly onto the AVX512 k-registers and the CUDA/HIP
+   * warp ballots, and are converted to and from vector masks and SVE
+   * predicates by the other registers.
+   */
+  template<camp::idx_t NUM_ELEM>
+  class RegisterMask
+  {
+    public:
+      using self_type = RegisterMask<NUM_ELEM>;
+      using bits_type = uint64_t;
+
+      static constexpr camp::idx_t s_num_elem = NUM_ELEM;
+
+      static_assert(NUM_ELEM >= 1 && NUM_ELEM <= 64,
+          "RegisterMask supports 1 to 64 lanes");
+
+    private:
+      bits_type m_bits;
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      bits_type s_full_bits(){
+        return ~bits_type(0) >> (64 - NUM_ELEM);
+      }
+
+    public:
+
+      /*!
+       * @brief Default constructor, no lanes set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      RegisterMask() : m_bits(0) {}
+
+      /*!
+       * @brief Construct from bits, lane i is set if bit i is
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      explicit RegisterMask(bits_type bits) : m_bits(bits & s_full_bits()) {}
+
+      /*!
+       * @brief Mask with all lanes set to value
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      self_type s_broadcast(bool value){
+        return self_type(value ? s_full_bits() : bits_type(0));
+      }
+
+      /*!
+       * @brief Mask with the first N lanes set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      self_type s_first_n(camp::idx_t N){
+        return self_type(N >= NUM_ELEM ? s_full_bits() : (bits_type(1) << N) - 1);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      bits_type bits() const {
+        return m_bits;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      bool get(camp::idx_t i) const {
+        return (m_bits >> i) & 1;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &set(bool value, camp::idx_t i){
+        m_bits = value ? (m_bits | (bits_type(1) << i)) : (m_bits & ~(bits_type(1) << i));
+        return *this;
+      }
+
+      /*!
+       * @brief Returns true if any lane is set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      bool any() const {
+        return m_bits != 0;
+      }
+
+      /*!
+       * @brief Returns true if all lanes are set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      bool all() const {
+        return m_bits == s_full_bits();
+      }
+
+      /*!
+       * @brief Returns true if no lane is set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      bool none() const {
+        return m_bits == 0;
+      }
+
+      /*!
+       * @brief Number of lanes set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      camp::idx_t count() const {
+        camp::idx_t n = 0;
+        for(bits_type b = m_bits;b != 0;b &= b-1){
+          ++ n;
+        }
+        return n;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      self_type operator&(self_type const &x) const {
+        return self_type(m_bits & x.m_bits);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      self_type operator|(self_type const &x) const {
+        return self_type(m_bits | x.m_bits);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      self_type operator^(self_type const &x) const {
+        return self_type(m_bits ^ x.m_bits);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      self_type operator~() const {
+        return self_type(~m_bits);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      bool operator==(self_type const &x) const {
+        return m_bits == x.m_bits;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      bool operator!=(self_type const &x) const {
+        return m_bits != x.m_bits;
+      }
+  };
+
+
+  /*!
+   * A mask of the NUM_ELEM elements of a tensor register, one RegisterMask
+   * for each of its registers.
+   *
+   * Element i is lane i%W of register i/W, for registers of W lanes. The
+   * padding lanes of a partial last register are ignored by get(), any(),
+   * all(), none() and count().
+   */
+  template<typename REGISTER_MASK, camp::idx_t NUM_ELEM>
+  class TensorMask
+  {
+    public:
+      using self_type = TensorMask<REGISTER_MASK, NUM_ELEM>;
+      using register_mask_type = REGISTER_MASK;
+
+      static constexpr camp::idx_t s_num_elem = NUM_ELEM;
+
+      static constexpr camp::idx_t s_register_num_elem = REGISTER_MASK::s_num_elem;
+
+      static constexpr camp::idx_t s_num_registers =
+          (NUM_ELEM + s_register_num_elem - 1) / s_register_num_elem;
+
+    private:
+      register_mask_type m_masks[s_num_registers];
+
+      //! Mask of register i without its padding lanes
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      register_mask_type valid_vec(camp::idx_t i) const {
+        return i+1 < s_num_registers ? m_masks[i] :
+          m_masks[i] & register_mask_type::s_first_n(NUM_ELEM - i*s_register_num_elem);
+      }
+
+    public:
+
+      /*!
+       * @brief Default constructor, no elements set
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      TensorMask(){}
+
+      /*!
+       * @brief Mask with all elements set to value
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      self_type s_broadcast(bool value){
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.m_masks[i] = register_mask_type::s_broadcast(value);
+        }
+        return result;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      register_mask_type &vec(camp::idx_t i){
+        return m_masks[i];
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      register_mask_type const &vec(camp::idx_t i) const {
+        return m_masks[i];
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool get(camp::idx_t i) const {
+        return m_masks[i / s_register_num_elem].get(i % s_register_num_elem);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &set(bool value, camp::idx_t i){
+        m_masks[i / s_register_num_elem].set(value, i % s_register_num_elem);
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool any() const {
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          if(valid_vec(i).any()){
+            return true;
+          }
+        }
+        return false;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool all() const {
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          if(valid_vec(i) != register_mask_type::s_first_n(NUM_ELEM - i*s_register_num_elem)){
+            return false;
+          }
+        }
+        return true;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      bool none() const {
+        return !any();
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      camp::idx_t count() const {
+        camp::idx_t n = 0;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          n += valid_vec(i).count();
+        }
+        return n;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator&(self_type const &x) const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.m_masks[i] = m_masks[i] & x.m_masks[i];
+        }
+        return result;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator|(self_type const &x) const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.m_masks[i] = m_masks[i] | x.m_masks[i];
+        }
+        return result;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator^(self_type const &x) const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.m_masks[i] = m_masks[i] ^ x.m_masks[i];
+        }
+        return result;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type operator~() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.m_masks[i] = ~m_masks[i];
+        }
+        return result;
+      }
+  };
+
+
+  /*!
+   * Returns a where mask is set, and b elsewhere
+   */
+  template<camp::idx_t NUM_ELEM, typename REGISTER>
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  REGISTER select(RegisterMask<NUM_ELEM> const &mask, REGISTER const &a, REGISTER const &b)
+  {
+    return b.blend(mask, a);
+  }
+
+  template<typename REGISTER_MASK, camp::idx_t NUM_ELEM, typename TENSOR>
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  TENSOR select(TensorMask<REGISTER_MASK, NUM_ELEM> const &mask, TENSOR const &a, TENSOR const &b)
+  {
+    return b.blend(mask, a);
+  }
+
+
+} // namespace expt
+}  // namespace RAJA
+
+
+#endif
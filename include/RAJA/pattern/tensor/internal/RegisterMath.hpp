@@ -0,0 +1,188 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the constants of the register math
+ *          functions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_RegisterMath_HPP
+#define RAJA_pattern_tensor_RegisterMath_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Range reduction constants and polynomial coefficients of the register
+   * exp, log, sin and cos.
+   *
+   * Each function is evaluated with polynomials on registers for inputs in
+   * its regular domain [s_*_min, s_*_max], and registers with any lane
+   * outside of it fall back to the scalar std:: function lane by lane.
+   * The polynomials are truncated Taylor series, long enough that the
+   * truncation error is below half an ulp on the reduced range, so results
+   * are within a few ulp of the correctly rounded ones.
+   */
+  template<typename T>
+  struct RegisterMathConstants;
+
+
+  template<>
+  struct RegisterMathConstants<double>
+  {
+      // x + s_round - s_round rounds to an integer for |x| < 2^51
+      static constexpr double s_round = 6755399441055744.0;
+
+      // exp(x) = 2^n exp(r), r = x - n ln(2), |r| <= ln(2)/2
+      static constexpr double s_exp_min = -708.0;
+      static constexpr double s_exp_max = 709.0;
+      static constexpr double s_log2e = 1.44269504088896340736;
+      static constexpr double s_ln2_hi = 6.93147180369123816490e-01;
+      static constexpr double s_ln2_lo = 1.90821492927058770002e-10;
+      static constexpr int s_exp_degree = 13;
+
+      // log(x) = e ln(2) + log(m), m in [sqrt(1/2), sqrt(2))
+      static constexpr double s_log_min = 2.2250738585072014e-308;
+      static constexpr double s_log_max = 8.9884656743115785e+307;
+      static constexpr double s_sqrt2 = 1.41421356237309504880;
+      static constexpr int s_log_degree = 10;
+
+      // sin(x) and cos(x) from r = x - n pi/2, |r| <= pi/4
+      static constexpr double s_trig_max = 1.0e5;
+      static constexpr double s_2_over_pi = 6.36619772367581382433e-01;
+      static constexpr double s_pio2_1 = 1.57079632673412561417e+00;
+      static constexpr double s_pio2_2 = 6.07710050630396597660e-11;
+      static constexpr double s_pio2_3 = 2.02226624871116645580e-21;
+      static constexpr int s_sin_degree = 8;
+      static constexpr int s_cos_degree = 8;
+  };
+
+
+  template<>
+  struct RegisterMathConstants<float>
+  {
+      static constexpr float s_round = 12582912.0f;
+
+      static constexpr float s_exp_min = -87.0f;
+      static constexpr float s_exp_max = 88.0f;
+      static constexpr float s_log2e = 1.44269504088896340736f;
+      static constexpr float s_ln2_hi = 0.693359375f;
+      static constexpr float s_ln2_lo = -2.12194440e-4f;
+      static constexpr int s_exp_degree = 7;
+
+      static constexpr float s_log_min = 1.17549435e-38f;
+      static constexpr float s_log_max = 1.70141173e+38f;
+      static constexpr float s_sqrt2 = 1.41421356237309504880f;
+      static constexpr int s_log_degree = 5;
+
+      static constexpr float s_trig_max = 8192.0f;
+      static constexpr float s_2_over_pi = 6.36619772367581382433e-01f;
+      static constexpr float s_pio2_1 = 1.5703125f;
+      static constexpr float s_pio2_2 = 4.837512969970703125e-4f;
+      static constexpr float s_pio2_3 = 7.54978995489188216e-8f;
+      static constexpr int s_sin_degree = 5;
+      static constexpr int s_cos_degree = 6;
+  };
+
+
+  /*!
+   * Evaluates c[0] + x*(c[1] + x*(... + x*c[N])) with FMAs
+   */
+  template<typename REGISTER, typename T>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  REGISTER registerPolynomial(REGISTER const &x, T const *c, int N)
+  {
+    REGISTER p(c[N]);
+    for(int i = N-1;i >= 0;-- i){
+      p = p.multiply_add(x, REGISTER(c[i]));
+    }
+    return p;
+  }
+
+  /*!
+   * Taylor coefficients of exp, 1/i!
+   *
+   * The coefficients are computed in double, and the loops are folded into
+   * constants since N is always a compile time constant.
+   */
+  template<typename T>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  void registerExpCoefficients(T *c, int N)
+  {
+    double ci = 1.0;
+    c[0] = T(ci);
+    for(int i = 1;i <= N;++ i){
+      ci /= double(i);
+      c[i] = T(ci);
+    }
+  }
+
+  /*!
+   * Coefficients of sin(r)/r in r^2: (-1)^i/(2i+1)!, and of cos(r) in r^2:
+   * (-1)^i/(2i)!
+   */
+  template<typename T>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  void registerSinCoefficients(T *c, int N)
+  {
+    double ci = 1.0;
+    c[0] = T(ci);
+    for(int i = 1;i <= N;++ i){
+      ci /= -double((2*i)*(2*i+1));
+      c[i] = T(ci);
+    }
+  }
+
+  template<typename T>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  void registerCosCoefficients(T *c, int N)
+  {
+    double ci = 1.0;
+    c[0] = T(ci);
+    for(int i = 1;i <= N;++ i){
+      ci /= -double((2*i-1)*(2*i));
+      c[i] = T(ci);
+    }
+  }
+
+  /*!
+   * Coefficients of atanh(f)/f in f^2: 1/(2i+1)
+   */
+  template<typename T>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  void registerLogCoefficients(T *c, int N)
+  {
+    for(int i = 0;i <= N;++ i){
+      c[i] = T(1.0 / double(2*i+1));
+    }
+  }
+
+} // namespace expt
+} // namespace internal
+}  // namespace RAJA
+
+
+#endif
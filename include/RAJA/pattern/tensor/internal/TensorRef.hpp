@@ -195,6 +195,27 @@ namespace expt
       return MergeRefTile<REF_TYPE, TILE_TYPE, camp::make_idx_seq_t<TILE_TYPE::s_num_dims>>::shift_origin(ref, tile_origin);
     }
 
+    /*!
+     * Retypes a ref so that DIM is its stride-one dimension.
+     *
+     * Used when a ref's strides are only known at run time, and DIM was
+     * found to have a stride of one.
+     */
+    template<camp::idx_t DIM, typename POINTER_TYPE, typename INDEX_TYPE, TensorTileSize TENSOR_SIZE, camp::idx_t NUM_DIMS, camp::idx_t STRIDE_ONE_DIM>
+    RAJA_INLINE
+    RAJA_HOST_DEVICE
+    TensorRef<POINTER_TYPE, INDEX_TYPE, TENSOR_SIZE, NUM_DIMS, DIM>
+    make_ref_stride_one(TensorRef<POINTER_TYPE, INDEX_TYPE, TENSOR_SIZE, NUM_DIMS, STRIDE_ONE_DIM> const &ref){
+      TensorRef<POINTER_TYPE, INDEX_TYPE, TENSOR_SIZE, NUM_DIMS, DIM> result;
+      result.m_pointer = ref.m_pointer;
+      for(camp::idx_t i = 0;i < NUM_DIMS;++ i){
+        result.m_stride[i] = ref.m_stride[i];
+      }
+      result.m_tile = ref.m_tile;
+      return result;
+    }
+
+
     /*!
      * Changes TensorTile size type to FULL
      */
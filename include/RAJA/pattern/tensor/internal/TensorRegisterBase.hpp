@@ -25,6 +25,7 @@
 #include "camp/camp.hpp"
 #include "RAJA/pattern/tensor/TensorLayout.hpp"
 #include "RAJA/pattern/tensor/internal/TensorRef.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterMask.hpp"
 
 namespace RAJA
 {
@@ -124,6 +125,8 @@ namespace expt
 
       using register_policy = REGISTER_POLICY;
 
+      using mask_type = RAJA::expt::TensorMask<typename register_type::mask_type, RAJA::product<camp::idx_t>(SIZES...)>;
+
     private:
 
       RAJA_HOST_DEVICE
@@ -699,6 +702,260 @@ namespace expt
       }
 
 
+      /*!
+       * @brief Returns element wise square root tensor
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].sqrt();
+        }
+        return result;
+      }
+
+
+      /*!
+       * @brief Returns element wise exponential tensor
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type exp() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].exp();
+        }
+        return result;
+      }
+
+
+      /*!
+       * @brief Returns element wise natural logarithm tensor
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type log() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].log();
+        }
+        return result;
+      }
+
+
+      /*!
+       * @brief Returns element wise sine tensor
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sin() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].sin();
+        }
+        return result;
+      }
+
+
+      /*!
+       * @brief Returns element wise cosine tensor
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type cos() const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].cos();
+        }
+        return result;
+      }
+
+
+      /*!
+       * @brief Returns element wise power tensor, (*this)^y
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type pow(self_type const &y) const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].pow(y.vec(i));
+        }
+        return result;
+      }
+
+
+      /*!
+       * @brief Returns the mask of the elements that are equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_eq(self_type const &x) const {
+        mask_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].compare_eq(x.vec(i));
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Returns the mask of the elements that are not equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ne(self_type const &x) const {
+        mask_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].compare_ne(x.vec(i));
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Returns the mask of the elements that are less than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_lt(self_type const &x) const {
+        mask_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].compare_lt(x.vec(i));
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Returns the mask of the elements that are less than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_le(self_type const &x) const {
+        mask_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].compare_le(x.vec(i));
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Returns the mask of the elements that are greater than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_gt(self_type const &x) const {
+        mask_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].compare_gt(x.vec(i));
+        }
+        return result;
+      }
+
+      /*!
+       * @brief Returns the mask of the elements that are greater than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ge(self_type const &x) const {
+        mask_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].compare_ge(x.vec(i));
+        }
+        return result;
+      }
+
+
+      /*!
+       * @brief Element wise comparison operators, which return a mask_type
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator==(self_type const &x) const {
+        return getThis()->compare_eq(x);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator==(element_type const &x) const {
+        return getThis()->compare_eq(self_type(x));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator!=(self_type const &x) const {
+        return getThis()->compare_ne(x);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator!=(element_type const &x) const {
+        return getThis()->compare_ne(self_type(x));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator<(self_type const &x) const {
+        return getThis()->compare_lt(x);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator<(element_type const &x) const {
+        return getThis()->compare_lt(self_type(x));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator<=(self_type const &x) const {
+        return getThis()->compare_le(x);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator<=(element_type const &x) const {
+        return getThis()->compare_le(self_type(x));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator>(self_type const &x) const {
+        return getThis()->compare_gt(x);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator>(element_type const &x) const {
+        return getThis()->compare_gt(self_type(x));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator>=(self_type const &x) const {
+        return getThis()->compare_ge(x);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type operator>=(element_type const &x) const {
+        return getThis()->compare_ge(self_type(x));
+      }
+
+
+      /*!
+       * @brief Returns x in the elements where mask is set, and this
+       * elsewhere
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type blend(mask_type const &mask, self_type const &x) const {
+        self_type result;
+        for(camp::idx_t i = 0;i < s_num_registers;++ i){
+          result.vec(i) = m_registers[i].blend(mask.vec(i), x.vec(i));
+        }
+        return result;
+      }
+
+
 
       RAJA_HOST_DEVICE
       RAJA_INLINE
@@ -53,6 +53,9 @@ namespace expt
       using int_element_type = typename register_type::int_vector_type::element_type;
       using int_vector_type = TensorRegister<REGISTER_POLICY, int_element_type, RAJA::expt::VectorLayout, camp::idx_seq<SIZE>>;
 
+      using mask_type = typename base_type::mask_type;
+      using register_mask_type = typename register_type::mask_type;
+
     private:
 
       static constexpr camp::idx_t s_register_num_elem = register_type::s_num_elem;
@@ -229,16 +232,12 @@ namespace expt
         if(STRIDE_ONE_DIM == 0){
           // full vector?
           if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_packed ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_packed);
             load_packed(ptr);
           }
           // partial
           else{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_packed_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_packed_n);
             load_packed_n(ptr, ref.m_tile.m_size[0]);
           }
 
@@ -248,16 +247,12 @@ namespace expt
         {
           // full vector?
           if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided);
             load_strided(ptr, ref.m_stride[0]);
           }
           // partial
           else{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
             load_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
           }
         }
@@ -279,16 +274,12 @@ namespace expt
         if(STRIDE_ONE_DIM == 0){
           // full vector?
           if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_packed ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_store_packed);
             store_packed(ptr);
           }
           // partial
           else{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_packed_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_store_packed_n);
             store_packed_n(ptr, ref.m_tile.m_size[0]);
           }
 
@@ -298,16 +289,12 @@ namespace expt
         {
           // full vector?
           if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_strided ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_store_strided);
             store_strided(ptr, ref.m_stride[0]);
           }
           // partial
           else{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_store_strided_n);
             store_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
           }
         }
@@ -421,6 +408,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &gather(element_type const *ptr, int_vector_type offsets){
+        RAJA_TENSOR_STATS_INC(num_vector_gather);
         for(camp::idx_t reg = 0;reg < s_num_full_registers;++ reg){
           m_registers[reg].gather(ptr, offsets.vec(reg));
         }
@@ -441,6 +429,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
+        RAJA_TENSOR_STATS_INC(num_vector_gather_n);
         for(camp::idx_t reg = 0;reg < s_num_full_registers;++ reg){
           if(N >= reg*s_register_num_elem + s_register_num_elem){
             m_registers[reg].gather(ptr, offsets.vec(reg));
@@ -522,6 +511,42 @@ namespace expt
         return *this;
       }
 
+      /*!
+       * Loads the elements where mask is set from a dense vector in memory,
+       * and zeroes the others
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_masked(element_type const *ptr, mask_type const &mask)
+      {
+        for(camp::idx_t reg = 0;reg < s_num_full_registers;++ reg){
+          m_registers[reg].load_packed_masked(ptr+reg*s_register_num_elem, mask.vec(reg));
+        }
+        if(s_num_partial_lanes){
+          m_registers[s_final_register].load_packed_masked(ptr+s_final_register*s_register_num_elem,
+              mask.vec(s_final_register) & register_mask_type::s_first_n(s_num_partial_lanes));
+        }
+        return *this;
+      }
+
+      /*!
+       * Stores the elements where mask is set to a dense vector in memory,
+       * leaving the others untouched
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const
+      {
+        for(camp::idx_t reg = 0;reg < s_num_full_registers;++ reg){
+          m_registers[reg].store_packed_masked(ptr+reg*s_register_num_elem, mask.vec(reg));
+        }
+        if(s_num_partial_lanes){
+          m_registers[s_final_register].store_packed_masked(ptr+s_final_register*s_register_num_elem,
+              mask.vec(s_final_register) & register_mask_type::s_first_n(s_num_partial_lanes));
+        }
+        return *this;
+      }
+
       /*!
        * Loads a strided partial vector from memory
        */
@@ -565,6 +590,7 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type const &scatter(element_type *ptr, int_vector_type const &offsets) const {
+        RAJA_TENSOR_STATS_INC(num_vector_scatter);
         for(camp::idx_t reg = 0;reg < s_num_full_registers;++ reg){
           m_registers[reg].scatter(ptr, offsets.vec(reg));
         }
@@ -586,6 +612,7 @@ namespace expt
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type const &scatter_n(element_type *ptr, int_vector_type const &offsets, camp::idx_t N) const {
+        RAJA_TENSOR_STATS_INC(num_vector_scatter_n);
         for(camp::idx_t reg = 0;reg < s_num_full_registers;++ reg){
           if(N >= reg*s_register_num_elem + s_register_num_elem){
             m_registers[reg].scatter(ptr, offsets.vec(reg));
@@ -0,0 +1,445 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining registers of 16-bit elements that
+ *          compute in float registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_WidenedRegister_HPP
+#define RAJA_pattern_tensor_WidenedRegister_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/half.hpp"
+
+#include "RAJA/pattern/tensor/internal/RegisterBase.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Register of 16-bit storage elements (half_t or bfloat16_t) that keeps
+   * its values in a float register of the same policy.
+   *
+   * Elements are widened when they are loaded and rounded back when they are
+   * stored, so every operation in between, including the multiply_add
+   * chains of a matrix multiply, accumulates in float.
+   *
+   * The loads and stores here convert one element at a time; architecture
+   * specializations replace them with vector conversions.
+   */
+  template<typename T, typename REGISTER_POLICY>
+  class WidenedRegister :
+    public RegisterBase<RAJA::expt::Register<T, REGISTER_POLICY>>
+  {
+    public:
+      using base_type = RegisterBase<RAJA::expt::Register<T, REGISTER_POLICY>>;
+
+      using register_policy = REGISTER_POLICY;
+      using self_type = RAJA::expt::Register<T, REGISTER_POLICY>;
+      using element_type = T;
+      using compute_type = float;
+      using wide_type = RAJA::expt::Register<compute_type, REGISTER_POLICY>;
+      using register_type = typename wide_type::register_type;
+
+      static constexpr camp::idx_t s_num_elem = wide_type::s_num_elem;
+
+    protected:
+      wide_type m_wide;
+
+    public:
+
+      /*!
+       * @brief Default constructor, zeros register contents
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      WidenedRegister() : base_type(), m_wide() {}
+
+      /*!
+       * @brief Construct from the float register holding the values
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      explicit WidenedRegister(wide_type const &w) : base_type(), m_wide(w) {}
+
+      /*!
+       * @brief Construct from scalar.
+       * Sets all elements to same value (broadcast).
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      WidenedRegister(element_type const &c) :
+        base_type(), m_wide(compute_type(c)) {}
+
+      /*!
+       * @brief Construct from a float scalar without rounding it to
+       * element_type first.
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      WidenedRegister(compute_type c) : base_type(), m_wide(c) {}
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      WidenedRegister(WidenedRegister const &c) :
+        base_type(), m_wide(c.m_wide) {}
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      WidenedRegister &operator=(WidenedRegister const &c){
+        m_wide = c.m_wide;
+        return *this;
+      }
+
+      /*!
+       * @brief The float register holding the values
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      wide_type const &get_wide() const {
+        return m_wide;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      wide_type &get_wide() {
+        return m_wide;
+      }
+
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr){
+        for(camp::idx_t i = 0;i < s_num_elem;++ i){
+          m_wide.set(compute_type(ptr[i]), i);
+        }
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
+        m_wide = wide_type();
+        for(camp::idx_t i = 0;i < N;++ i){
+          m_wide.set(compute_type(ptr[i]), i);
+        }
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_strided(element_type const *ptr, camp::idx_t stride){
+        for(camp::idx_t i = 0;i < s_num_elem;++ i){
+          m_wide.set(compute_type(ptr[i*stride]), i);
+        }
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_strided_n(element_type const *ptr, camp::idx_t stride, camp::idx_t N){
+        m_wide = wide_type();
+        for(camp::idx_t i = 0;i < N;++ i){
+          m_wide.set(compute_type(ptr[i*stride]), i);
+        }
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr) const{
+        for(camp::idx_t i = 0;i < s_num_elem;++ i){
+          ptr[i] = element_type(m_wide.get(i));
+        }
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
+        for(camp::idx_t i = 0;i < N;++ i){
+          ptr[i] = element_type(m_wide.get(i));
+        }
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
+        for(camp::idx_t i = 0;i < s_num_elem;++ i){
+          ptr[i*stride] = element_type(m_wide.get(i));
+        }
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
+        for(camp::idx_t i = 0;i < N;++ i){
+          ptr[i*stride] = element_type(m_wide.get(i));
+        }
+        return *getThis();
+      }
+
+      /*!
+       * @brief Get scalar value from vector register, rounded to element_type
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type get(camp::idx_t i) const {
+        return element_type(m_wide.get(i));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &set(element_type value, camp::idx_t i){
+        m_wide.set(compute_type(value), i);
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &broadcast(element_type const &value){
+        m_wide.broadcast(compute_type(value));
+        return *getThis();
+      }
+
+      /*!
+       * @brief Broadcasts element i without rounding it
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type get_and_broadcast(int i) const {
+        return self_type(m_wide.get_and_broadcast(i));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &copy(self_type const &src){
+        m_wide = src.m_wide;
+        return *getThis();
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type add(self_type const &b) const {
+        return self_type(m_wide.add(b.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type subtract(self_type const &b) const {
+        return self_type(m_wide.subtract(b.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type multiply(self_type const &b) const {
+        return self_type(m_wide.multiply(b.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide(self_type const &b) const {
+        return self_type(m_wide.divide(b.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide_n(self_type const &b, camp::idx_t N) const {
+        return self_type(m_wide.divide_n(b.m_wide, N));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type multiply_add(self_type const &b, self_type const &c) const {
+        return self_type(m_wide.multiply_add(b.m_wide, c.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type multiply_subtract(self_type const &b, self_type const &c) const {
+        return self_type(m_wide.multiply_subtract(b.m_wide, c.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type scale(compute_type c) const {
+        return self_type(m_wide.scale(c));
+      }
+
+      /*!
+       * @brief Dot product, summed in float and rounded once
+       */
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type dot(self_type const &x) const {
+        return element_type(m_wide.dot(x.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type sum() const {
+        return element_type(m_wide.sum());
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type max() const {
+        return element_type(m_wide.max());
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type max_n(camp::idx_t N) const {
+        return element_type(m_wide.max_n(N));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type vmax(self_type a) const {
+        return self_type(m_wide.vmax(a.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type min() const {
+        return element_type(m_wide.min());
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      element_type min_n(camp::idx_t N) const {
+        return element_type(m_wide.min_n(N));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type vmin(self_type a) const {
+        return self_type(m_wide.vmin(a.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const {
+        return self_type(m_wide.transpose_shuffle_left(lvl, y.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const {
+        return self_type(m_wide.transpose_shuffle_right(lvl, y.m_wide));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type segmented_sum_inner(camp::idx_t segbits, camp::idx_t output_segment) const {
+        return self_type(m_wide.segmented_sum_inner(segbits, output_segment));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type segmented_sum_outer(camp::idx_t segbits, camp::idx_t output_segment) const {
+        return self_type(m_wide.segmented_sum_outer(segbits, output_segment));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type segmented_divide_nm(self_type den, camp::idx_t segbits, camp::idx_t num_inner, camp::idx_t num_outer) const {
+        return self_type(m_wide.segmented_divide_nm(den.m_wide, segbits, num_inner, num_outer));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type segmented_broadcast_inner(camp::idx_t segbits, camp::idx_t input_segment) const {
+        return self_type(m_wide.segmented_broadcast_inner(segbits, input_segment));
+      }
+
+      RAJA_SUPPRESS_HD_WARN
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type segmented_broadcast_outer(camp::idx_t segbits, camp::idx_t input_segment) const {
+        return self_type(m_wide.segmented_broadcast_outer(segbits, input_segment));
+      }
+
+    protected:
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type *getThis(){
+        return static_cast<self_type *>(this);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      self_type const *getThis() const{
+        return static_cast<self_type const *>(this);
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+} // namespace RAJA
+
+
+
+#endif
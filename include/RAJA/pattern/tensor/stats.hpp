@@ -3,7 +3,7 @@
  *
  * \file
  *
- * \brief   RAJA header file defining SIMD/SIMT register operations.
+ * \brief   RAJA header file defining SIMD/SIMT register operation counters.
  *
  ******************************************************************************
  */
@@ -19,68 +19,322 @@
 // Place the following line before including RAJA to enable
 // statistics on the Vector abstractions
 // #define RAJA_ENABLE_VECTOR_STATS
+//
+// Without it RAJA_TENSOR_STATS_INC expands to nothing, so the register
+// operations carry no counting code at all.
 
 
 #ifndef RAJA_pattern_simd_register_stats_HPP
 #define RAJA_pattern_simd_register_stats_HPP
 
 #include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
 #include "camp/camp.hpp"
 
+#include <atomic>
+#include <cstdio>
+
+#if defined(RAJA_ENABLE_VECTOR_STATS) && defined(RAJA_ENABLE_CUDA) && defined(__CUDACC__)
+#include <cuda_runtime.h>
+#define RAJA_TENSOR_STATS_DEVICE
+#elif defined(RAJA_ENABLE_VECTOR_STATS) && defined(RAJA_ENABLE_HIP) && defined(__HIPCC__)
+#include <hip/hip_runtime.h>
+#define RAJA_TENSOR_STATS_DEVICE
+#endif
+
+
+/*!
+ * All tensor_stats counters, as X(name)
+ */
+#define RAJA_TENSOR_STATS_COUNTERS(X) \
+  X(num_vector_copy) \
+  X(num_vector_copy_ctor) \
+  X(num_vector_broadcast_ctor) \
+  X(num_vector_load_packed) \
+  X(num_vector_load_packed_n) \
+  X(num_vector_load_strided) \
+  X(num_vector_load_strided_n) \
+  X(num_vector_store_packed) \
+  X(num_vector_store_packed_n) \
+  X(num_vector_store_strided) \
+  X(num_vector_store_strided_n) \
+  X(num_vector_gather) \
+  X(num_vector_gather_n) \
+  X(num_vector_scatter) \
+  X(num_vector_scatter_n) \
+  X(num_vector_broadcast) \
+  X(num_vector_get) \
+  X(num_vector_set) \
+  X(num_vector_add) \
+  X(num_vector_subtract) \
+  X(num_vector_multiply) \
+  X(num_vector_divide) \
+  X(num_vector_fma) \
+  X(num_vector_fms) \
+  X(num_vector_sum) \
+  X(num_vector_max) \
+  X(num_vector_min) \
+  X(num_vector_vmax) \
+  X(num_vector_vmin) \
+  X(num_vector_dot) \
+  X(num_matrix_load_packed) \
+  X(num_matrix_load_packed_nm) \
+  X(num_matrix_load_strided) \
+  X(num_matrix_load_strided_nm) \
+  X(num_matrix_store_packed) \
+  X(num_matrix_store_packed_nm) \
+  X(num_matrix_store_strided) \
+  X(num_matrix_store_strided_nm) \
+  X(num_matrix_mm_mult_row_row) \
+  X(num_matrix_mm_multacc_row_row) \
+  X(num_matrix_mm_mult_col_col) \
+  X(num_matrix_mm_multacc_col_col)
+
+
 namespace RAJA
 {
 namespace expt
 {
-struct tensor_stats
+namespace tensor_stats
 {
-    static int indent;
 
-  static camp::idx_t num_vector_copy;
-  static camp::idx_t num_vector_copy_ctor;
-  static camp::idx_t num_vector_broadcast_ctor;
+  enum counter : int
+  {
+#define RAJA_TENSOR_STATS_ENUM(NAME) NAME,
+    RAJA_TENSOR_STATS_COUNTERS(RAJA_TENSOR_STATS_ENUM)
+#undef RAJA_TENSOR_STATS_ENUM
+    num_counters
+  };
+
+  /*!
+   * A value for each counter
+   */
+  struct counts
+  {
+      camp::idx_t value[num_counters];
+
+      RAJA_INLINE
+      counts() : value{} {}
+
+      RAJA_INLINE
+      camp::idx_t &operator[](int c) { return value[c]; }
+
+      RAJA_INLINE
+      camp::idx_t operator[](int c) const { return value[c]; }
+
+      RAJA_INLINE
+      counts &operator+=(counts const &b)
+      {
+        for(int c = 0;c < num_counters;++ c){
+          value[c] += b.value[c];
+        }
+        return *this;
+      }
+
+      RAJA_INLINE
+      counts operator-(counts const &b) const
+      {
+        counts r;
+        for(int c = 0;c < num_counters;++ c){
+          r.value[c] = value[c] - b.value[c];
+        }
+        return r;
+      }
+  };
+
+  //! Name of counter c, as it is spelled in RAJA_TENSOR_STATS_COUNTERS
+  const char *counter_name(int c);
+
+
+  namespace detail
+  {
+    /*!
+     * Counters of one host thread.
+     *
+     * Only the owning thread writes them, so an increment is a relaxed load
+     * and store with no lock, and other threads may read them at any time.
+     * Construction registers the counters for host_counts(), and destruction
+     * folds them into a total kept for exited threads.
+     */
+    struct thread_counters
+    {
+        std::atomic<camp::idx_t> value[num_counters];
+
+        thread_counters();
+        ~thread_counters();
+
+        thread_counters(thread_counters const &) = delete;
+        thread_counters &operator=(thread_counters const &) = delete;
+    };
+
+    RAJA_INLINE
+    thread_counters &local_counters()
+    {
+      static thread_local thread_counters counters;
+      return counters;
+    }
 
-  static camp::idx_t num_vector_load_packed;
-  static camp::idx_t num_vector_load_packed_n;
-  static camp::idx_t num_vector_load_strided;
-  static camp::idx_t num_vector_load_strided_n;
+    RAJA_INLINE
+    void host_increment(counter c)
+    {
+      std::atomic<camp::idx_t> &v = local_counters().value[c];
+      v.store(v.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
 
-  static camp::idx_t num_vector_store_packed;
-  static camp::idx_t num_vector_store_packed_n;
-  static camp::idx_t num_vector_store_strided;
-  static camp::idx_t num_vector_store_strided_n;
+#ifdef RAJA_TENSOR_STATS_DEVICE
+    /*!
+     * Device counters, one set per translation unit unless device code is
+     * linked as relocatable.
+     */
+    static __device__ unsigned long long s_device_counts[num_counters];
 
-  static camp::idx_t num_vector_broadcast;
+    RAJA_DEVICE
+    RAJA_INLINE
+    void device_increment(counter c)
+    {
+      atomicAdd(&s_device_counts[c], 1ull);
+    }
+#endif
+
+  } // namespace detail
+
+
+  //! Sum of the counters of all host threads, including those that exited
+  counts host_counts();
+
+  //! Zeroes the host counters, while no kernel is counting
+  void reset_host_counts();
+
+  //! Device counters of the calling translation unit, zero if not counted
+  RAJA_INLINE
+  counts device_counts()
+  {
+    counts r;
+#ifdef RAJA_TENSOR_STATS_DEVICE
+    unsigned long long d[num_counters];
+#if defined(RAJA_ENABLE_CUDA)
+    cudaDeviceSynchronize();
+    cudaMemcpyFromSymbol(d, detail::s_device_counts, sizeof(d));
+#else
+    hipDeviceSynchronize();
+    hipMemcpyFromSymbol(d, HIP_SYMBOL(detail::s_device_counts), sizeof(d));
+#endif
+    for(int c = 0;c < num_counters;++ c){
+      r.value[c] = static_cast<camp::idx_t>(d[c]);
+    }
+#endif
+    return r;
+  }
+
+  //! Zeroes the device counters of the calling translation unit
+  RAJA_INLINE
+  void reset_device_counts()
+  {
+#ifdef RAJA_TENSOR_STATS_DEVICE
+    unsigned long long d[num_counters] = {};
+#if defined(RAJA_ENABLE_CUDA)
+    cudaDeviceSynchronize();
+    cudaMemcpyToSymbol(detail::s_device_counts, d, sizeof(d));
+#else
+    hipDeviceSynchronize();
+    hipMemcpyToSymbol(HIP_SYMBOL(detail::s_device_counts), d, sizeof(d));
+#endif
+#endif
+  }
 
-  static camp::idx_t num_vector_get;
-  static camp::idx_t num_vector_set;
+  //! Host and device counters combined
+  RAJA_INLINE
+  counts read()
+  {
+    counts r = host_counts();
+    r += device_counts();
+    return r;
+  }
 
-  static camp::idx_t num_vector_add;
-  static camp::idx_t num_vector_subtract;
-  static camp::idx_t num_vector_multiply;
-  static camp::idx_t num_vector_divide;
+  RAJA_INLINE
+  void reset()
+  {
+    reset_host_counts();
+    reset_device_counts();
+  }
 
-  static camp::idx_t num_vector_fma;
-  static camp::idx_t num_vector_fms;
+  /*!
+   * Prints the nonzero counters of c, followed by the share of vector and
+   * matrix loads and stores that took the strided, partial or gather paths.
+   */
+  void print(counts const &c, const char *kernel_name = nullptr,
+             FILE *out = stdout);
 
-  static camp::idx_t num_vector_sum;
-  static camp::idx_t num_vector_max;
-  static camp::idx_t num_vector_min;
-  static camp::idx_t num_vector_vmax;
-  static camp::idx_t num_vector_vmin;
-  static camp::idx_t num_vector_dot;
+  //! Adds c to the running total of the named kernel
+  void record_kernel(const char *kernel_name, counts const &c);
 
+  //! Prints the totals of every recorded kernel, in recording order
+  void print_kernel_report(FILE *out = stdout);
 
-  static camp::idx_t num_matrix_mm_mult_row_row;
-  static camp::idx_t num_matrix_mm_multacc_row_row;
-  static camp::idx_t num_matrix_mm_mult_col_col;
-  static camp::idx_t num_matrix_mm_multacc_col_col;
+  //! Forgets all recorded kernels
+  void reset_kernel_report();
 
-  static void resetVectorStats();
-  static void printVectorStats();
+  /*!
+   * Counts the register operations done during its lifetime and records
+   * them for kernel_name when it ends.
+   *
+   *   {
+   *     RAJA::expt::tensor_stats::kernel_scope scope("ltimes");
+   *     RAJA::kernel<POL>(...);
+   *   }
+   *   RAJA::expt::tensor_stats::print_kernel_report();
+   */
+  class kernel_scope
+  {
+    public:
+      RAJA_INLINE
+      explicit kernel_scope(const char *kernel_name) :
+        m_name(kernel_name), m_start(read())
+      {}
 
-};
+      RAJA_INLINE
+      ~kernel_scope()
+      {
+        record_kernel(m_name, elapsed());
+      }
 
+      //! Counts since construction
+      RAJA_INLINE
+      counts elapsed() const
+      {
+        return read() - m_start;
+      }
+
+      kernel_scope(kernel_scope const &) = delete;
+      kernel_scope &operator=(kernel_scope const &) = delete;
+
+    private:
+      const char *m_name;
+      counts m_start;
+  };
+
+  RAJA_INLINE
+  void resetVectorStats(){ reset(); }
+
+  RAJA_INLINE
+  void printVectorStats(){ print(read()); }
+
+} // namespace tensor_stats
 } // namespace expt
 } // namespace RAJA
 
+
+/*!
+ * Counts one register operation, in host or device code
+ */
+#if !defined(RAJA_ENABLE_VECTOR_STATS)
+#define RAJA_TENSOR_STATS_INC(NAME)
+#elif defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+#define RAJA_TENSOR_STATS_INC(NAME) \
+  RAJA::expt::tensor_stats::detail::device_increment(RAJA::expt::tensor_stats::NAME)
+#else
+#define RAJA_TENSOR_STATS_INC(NAME) \
+  RAJA::expt::tensor_stats::detail::host_increment(RAJA::expt::tensor_stats::NAME)
+#endif
+
 #endif
@@ -20,7 +20,16 @@
 
 #include "RAJA/config.hpp"
 
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include "RAJA/policy/PolicyBase.hpp"
 
@@ -40,6 +49,178 @@ template <size_t index, size_t size, typename Policy, typename... rest>
 struct policy_invoker;
 }
 
+namespace expt
+{
+
+/// AdaptiveSelector - MultiPolicy selector that picks the fastest policy for
+/// each problem size from measured run times
+///
+/// Problem sizes are grouped in buckets of powers of two. During warmup the
+/// policies of a bucket are run in turn, each warmup times, and timed with
+/// an exponential moving average; afterwards the policy with the smallest
+/// average is used. Every reprobe_interval runs of a bucket one other policy
+/// is timed again, so the choice follows changes in the machine or the data.
+/// Timed runs wait for the resource of the policy, so that asynchronous
+/// device policies are timed to completion; other runs do not wait.
+///
+/// Copies of a selector, such as the ones made by MultiPolicy on each
+/// forall, share their timings.
+class AdaptiveSelector
+{
+public:
+  struct selection {
+    size_t index;
+    size_t bucket;
+    bool timed;
+  };
+
+  explicit AdaptiveSelector(size_t num_policies,
+                            int warmup = 3,
+                            double alpha = 0.25,
+                            long reprobe_interval = 1000)
+      : m_state(std::make_shared<state>())
+  {
+    if (num_policies == 0) {
+      throw std::invalid_argument("AdaptiveSelector needs a policy");
+    }
+    m_state->num_policies = num_policies;
+    m_state->warmup = warmup > 0 ? warmup : 1;
+    m_state->alpha = alpha;
+    m_state->reprobe_interval = reprobe_interval;
+  }
+
+  //! choose the policy for a problem of size n
+  selection select(size_t n)
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    const size_t b = bucket_of(n);
+    bucket& bk = get_bucket(b);
+    ++bk.calls;
+
+    for (size_t p = 0; p < m_state->num_policies; ++p) {
+      if (bk.samples[p] < m_state->warmup) {
+        return selection{p, b, true};
+      }
+    }
+
+    const size_t best = best_of(bk);
+    if (m_state->reprobe_interval > 0 &&
+        bk.calls % m_state->reprobe_interval == 0 &&
+        m_state->num_policies > 1) {
+      bk.next_probe = (bk.next_probe + 1) % m_state->num_policies;
+      if (bk.next_probe == best) {
+        bk.next_probe = (bk.next_probe + 1) % m_state->num_policies;
+      }
+      return selection{bk.next_probe, b, true};
+    }
+    return selection{best, b, false};
+  }
+
+  //! record the time of a timed selection
+  void record(selection const& sel, double seconds)
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    bucket& bk = get_bucket(sel.bucket);
+    double& avg = bk.average[sel.index];
+    avg = bk.samples[sel.index] == 0
+              ? seconds
+              : m_state->alpha * seconds + (1.0 - m_state->alpha) * avg;
+    ++bk.samples[sel.index];
+  }
+
+  //! the policy used for problems of size n once warmup is done
+  size_t best(size_t n) const
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    const size_t b = bucket_of(n);
+    if (b >= m_state->buckets.size()) {
+      return 0;
+    }
+    return best_of(m_state->buckets[b]);
+  }
+
+  //! the moving average of the run time of policy for size n, or 0
+  double average(size_t policy, size_t n) const
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    const size_t b = bucket_of(n);
+    if (b >= m_state->buckets.size() || policy >= m_state->num_policies) {
+      return 0.0;
+    }
+    return m_state->buckets[b].average[policy];
+  }
+
+  //! selection without timing, for use as a plain selector
+  template <typename Iterable>
+  size_t operator()(Iterable const& iter)
+  {
+    return select(size_of(iter)).index;
+  }
+
+  template <typename Iterable>
+  static size_t size_of(Iterable const& iter)
+  {
+    using std::begin;
+    using std::end;
+    return static_cast<size_t>(std::distance(begin(iter), end(iter)));
+  }
+
+private:
+  struct bucket {
+    std::vector<double> average;
+    std::vector<int> samples;
+    long calls = 0;
+    size_t next_probe = 0;
+  };
+
+  struct state {
+    std::mutex mutex;
+    size_t num_policies = 1;
+    int warmup = 1;
+    double alpha = 1.0;
+    long reprobe_interval = 0;
+    std::vector<bucket> buckets;
+  };
+
+  std::shared_ptr<state> m_state;
+
+  static size_t bucket_of(size_t n)
+  {
+    size_t b = 0;
+    while (n > 1) {
+      n >>= 1;
+      ++b;
+    }
+    return b;
+  }
+
+  bucket& get_bucket(size_t b)
+  {
+    while (m_state->buckets.size() <= b) {
+      bucket bk;
+      bk.average.assign(m_state->num_policies, 0.0);
+      bk.samples.assign(m_state->num_policies, 0);
+      m_state->buckets.push_back(bk);
+    }
+    return m_state->buckets[b];
+  }
+
+  size_t best_of(bucket const& bk) const
+  {
+    size_t best = 0;
+    double best_time = std::numeric_limits<double>::max();
+    for (size_t p = 0; p < m_state->num_policies; ++p) {
+      if (bk.samples[p] > 0 && bk.average[p] < best_time) {
+        best = p;
+        best_time = bk.average[p];
+      }
+    }
+    return best;
+  }
+};
+
+}  // namespace expt
+
 namespace policy
 {
 namespace multi
@@ -67,14 +248,37 @@ public:
   template <typename Iterable, typename Body>
   int invoke(Iterable &&i, Body &&b)
   {
-    size_t index = s(i);
-    _policies.invoke(index, i, b);
-    return s(i);
+    return invoke(std::is_same<Selector, expt::AdaptiveSelector>{}, i, b);
   }
 
   detail::
       policy_invoker<sizeof...(Policies) - 1, sizeof...(Policies), Policies...>
           _policies;
+
+private:
+  template <typename Iterable, typename Body>
+  int invoke(std::false_type, Iterable &&i, Body &&b)
+  {
+    size_t index = s(i);
+    _policies.invoke(index, i, b);
+    return index;
+  }
+
+  template <typename Iterable, typename Body>
+  int invoke(std::true_type, Iterable &&i, Body &&b)
+  {
+    auto sel = s.select(expt::AdaptiveSelector::size_of(i));
+    if (!sel.timed) {
+      _policies.invoke(sel.index, i, b);
+      return sel.index;
+    }
+    auto start = std::chrono::steady_clock::now();
+    _policies.invoke(sel.index, i, b, true);
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    s.record(sel, elapsed.count());
+    return sel.index;
+  }
 };
 
 /// forall_impl - MultiPolicy specialization, select at runtime from a
@@ -157,6 +361,26 @@ auto make_multi_policy(std::tuple<Policies...> policies, Selector s)
       camp::make_idx_seq_t<sizeof...(Policies)>{}, s, policies);
 }
 
+/// make_adaptive_multi_policy - Construct a MultiPolicy that chooses
+/// among Policies by their measured run time, see expt::AdaptiveSelector
+///
+/// \tparam Policies list of policies, 0 to N-1
+/// \param warmup number of timed runs of each policy per problem size
+/// \param alpha weight of a new time in the moving average of a policy
+/// \param reprobe_interval number of runs between timing another policy
+/// \return A MultiPolicy with an AdaptiveSelector for the policies
+template <typename... Policies>
+auto make_adaptive_multi_policy(int warmup = 3,
+                                double alpha = 0.25,
+                                long reprobe_interval = 1000)
+    -> MultiPolicy<expt::AdaptiveSelector, Policies...>
+{
+  return MultiPolicy<expt::AdaptiveSelector, Policies...>(
+      expt::AdaptiveSelector(sizeof...(Policies), warmup, alpha,
+                             reprobe_interval),
+      Policies{}...);
+}
+
 namespace detail
 {
 
@@ -169,7 +393,7 @@ struct policy_invoker : public policy_invoker<index - 1, size, rest...> {
   policy_invoker(Policy p, rest... args) : NextInvoker(args...), _p(p) {}
 
   template <typename Iterable, typename LoopBody>
-  void invoke(int offset, Iterable &&iter, LoopBody &&loop_body)
+  void invoke(int offset, Iterable &&iter, LoopBody &&loop_body, bool wait = false)
   {
     if (offset == size - index - 1) {
 
@@ -187,10 +411,13 @@ struct policy_invoker : public policy_invoker<index - 1, size, rest...> {
       RAJA_FORCEINLINE_RECURSIVE
       auto r = resources::get_resource<Policy>::type::get_default();
       forall_impl(r, _p, std::forward<Iterable>(iter), body);
+      if (wait) {
+        r.wait();
+      }
 
       util::callPostLaunchPlugins(context);
     } else {
-      NextInvoker::invoke(offset, std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+      NextInvoker::invoke(offset, std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body), wait);
     }
   }
 };
@@ -200,7 +427,7 @@ struct policy_invoker<0, size, Policy, rest...> {
   Policy _p;
   policy_invoker(Policy p, rest...) : _p(p) {}
   template <typename Iterable, typename LoopBody>
-  void invoke(int offset, Iterable &&iter, LoopBody &&loop_body)
+  void invoke(int offset, Iterable &&iter, LoopBody &&loop_body, bool wait = false)
   {
     if (offset == size - 1) {
 
@@ -219,6 +446,9 @@ struct policy_invoker<0, size, Policy, rest...> {
       RAJA_FORCEINLINE_RECURSIVE
       auto r = resources::get_resource<Policy>::type::get_default();
       forall_impl(r, _p, std::forward<Iterable>(iter), body);
+      if (wait) {
+        r.wait();
+      }
 
       util::callPostLaunchPlugins(context);
     } else {
@@ -36,7 +36,8 @@ enum class Policy {
   cuda,
   hip,
   sycl,
-  tbb
+  tbb,
+  stdpar
 };
 
 enum class Pattern {
@@ -45,11 +46,13 @@ enum class Pattern {
   region,
   reduce,
   taskgraph,
+  balanced_segit,
   synchronize,
   workgroup,
   workgroup_exec,
   workgroup_order,
-  workgroup_storage
+  workgroup_storage,
+  workgroup_dispatch
 };
 
 enum class Launch { undefined, sync, async };
@@ -187,6 +190,9 @@ template <typename Pol>
 struct is_tbb_policy : RAJA::policy_is<Pol, RAJA::Policy::tbb> {
 };
 template <typename Pol>
+struct is_stdpar_policy : RAJA::policy_is<Pol, RAJA::Policy::stdpar> {
+};
+template <typename Pol>
 struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
@@ -56,10 +56,39 @@ struct constant_stride_array_of_objects
     : RAJA::make_policy_pattern_t<Policy::undefined,
                                   Pattern::workgroup_storage> {
 };
+struct device_ragged_array_of_objects
+    : RAJA::make_policy_pattern_t<Policy::undefined,
+                                  Pattern::workgroup_storage> {
+};
+struct device_constant_stride_array_of_objects
+    : RAJA::make_policy_pattern_t<Policy::undefined,
+                                  Pattern::workgroup_storage> {
+};
+
+/*!
+ * Call the loops through function pointers in their vtables.
+ * Any loop may be enqueued.
+ */
+struct indirect_function_call_dispatch
+    : RAJA::make_policy_pattern_t<Policy::undefined,
+                                  Pattern::workgroup_dispatch> {
+};
+
+/*!
+ * Call the loops with a switch over a known set of loop types, given as
+ * camp::list<Segment, LoopBody> pairs, so the loop bodies can be inlined.
+ * Only loops of these types may be enqueued.
+ */
+template < typename ... Loops >
+struct direct_dispatch
+    : RAJA::make_policy_pattern_t<Policy::undefined,
+                                  Pattern::workgroup_dispatch> {
+};
 
 template < typename EXEC_POLICY_T,
            typename ORDER_POLICY_T,
-           typename STORAGE_POLICY_T >
+           typename STORAGE_POLICY_T,
+           typename DISPATCH_POLICY_T = indirect_function_call_dispatch >
 struct WorkGroupPolicy
     : public RAJA::make_policy_pattern_platform_t<
                        policy_of<EXEC_POLICY_T>::value,
@@ -71,6 +100,8 @@ struct WorkGroupPolicy
       "WorkGroupPolicy: ORDER_POLICY_T must be a workgroup order policy");
   static_assert(RAJA::pattern_is<STORAGE_POLICY_T, RAJA::Pattern::workgroup_storage>::value,
       "WorkGroupPolicy: STORAGE_POLICY_T must be a workgroup storage policy");
+  static_assert(RAJA::pattern_is<DISPATCH_POLICY_T, RAJA::Pattern::workgroup_dispatch>::value,
+      "WorkGroupPolicy: DISPATCH_POLICY_T must be a workgroup dispatch policy");
 };
 
 }  // end namespace workgroup
@@ -82,6 +113,11 @@ using policy::workgroup::reverse_ordered;
 using policy::workgroup::array_of_pointers;
 using policy::workgroup::ragged_array_of_objects;
 using policy::workgroup::constant_stride_array_of_objects;
+using policy::workgroup::device_ragged_array_of_objects;
+using policy::workgroup::device_constant_stride_array_of_objects;
+
+using policy::workgroup::indirect_function_call_dispatch;
+using policy::workgroup::direct_dispatch;
 
 using policy::workgroup::WorkGroupPolicy;
 
@@ -31,6 +31,8 @@
  *
  * If we are in a CUDA __device__ function, then it always uses the cuda_atomic
  * policy.
+ * Likewise for the hip_atomic and sycl_atomic policies in HIP and SYCL
+ * device code.
  *
  * Next, if OpenMP is enabled we always use the omp_atomic, which should
  * generally work everywhere.
@@ -44,6 +46,9 @@
 #elif defined(__HIP_DEVICE_COMPILE__)
 #define RAJA_AUTO_ATOMIC \
   RAJA::hip_atomic {}
+#elif defined(__SYCL_DEVICE_ONLY__)
+#define RAJA_AUTO_ATOMIC \
+  RAJA::sycl_atomic {}
 #elif defined(RAJA_ENABLE_OPENMP)
 #define RAJA_AUTO_ATOMIC \
   RAJA::omp_atomic {}
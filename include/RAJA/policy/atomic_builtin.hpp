@@ -20,6 +20,10 @@
 
 #include "RAJA/config.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
 
@@ -124,6 +128,100 @@ RAJA_DEVICE_HIP RAJA_INLINE
 }
 
 
+/*!
+ * 16 byte values as two 64-bit words, for the 16 byte compare and swap
+ * primitives that have no hardware instruction and use a lock instead.
+ * The words are read and written through volatile pointers so the compiler
+ * keeps them in the lock.
+ */
+struct atomic_wide_words {
+  unsigned long long w[2];
+};
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE atomic_wide_words atomic_wide_load(
+    T volatile *acc)
+{
+  unsigned long long volatile *words =
+      reinterpret_cast<unsigned long long volatile *>(acc);
+  atomic_wide_words val;
+  val.w[0] = words[0];
+  val.w[1] = words[1];
+  return val;
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void atomic_wide_store(T volatile *acc,
+                                                   atomic_wide_words val)
+{
+  unsigned long long volatile *words =
+      reinterpret_cast<unsigned long long volatile *>(acc);
+  words[0] = val.w[0];
+  words[1] = val.w[1];
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE bool atomic_wide_equal(atomic_wide_words a,
+                                                    atomic_wide_words b)
+{
+  return a.w[0] == b.w[0] && a.w[1] == b.w[1];
+}
+
+//! Number of locks of the lock striped 16 byte compare and swap fallbacks
+constexpr size_t atomic_wide_num_locks = 1024;
+
+//! Lock of the address, the same for every byte of a 16 byte value
+RAJA_HOST_DEVICE RAJA_INLINE size_t atomic_wide_lock_index(void volatile *acc)
+{
+  return (reinterpret_cast<uintptr_t>(acc) >> 4) % atomic_wide_num_locks;
+}
+
+#if !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+//! Host locks of the 16 byte compare and swap, each on its own cache line
+struct alignas(64) builtin_atomic_wide_lock {
+  std::atomic<bool> locked{false};
+};
+
+inline builtin_atomic_wide_lock &builtin_atomic_get_wide_lock(
+    void volatile *acc)
+{
+  static builtin_atomic_wide_lock locks[atomic_wide_num_locks];
+  return locks[atomic_wide_lock_index(acc)];
+}
+#endif
+
+/*!
+ * Compare and swap of 16 byte values, T must be trivially copyable and
+ * aligned to 16 bytes.  Uses cmpxchg16b, or the equivalent of the target,
+ * when the compiler has it (x86-64 needs -mcx16), or else a lock from a
+ * table of locks indexed by the address.  The comparison is bitwise.
+ */
+template <typename T>
+RAJA_INLINE typename std::enable_if<sizeof(T) == 16, T>::type
+builtin_atomic_CAS(T volatile *acc, T compare, T value)
+{
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+  using wide_type = unsigned __int128;
+  return RAJA::util::reinterp_A_as_B<wide_type, T>(
+      __sync_val_compare_and_swap(
+          (wide_type volatile *)acc,
+          RAJA::util::reinterp_A_as_B<T, wide_type>(compare),
+          RAJA::util::reinterp_A_as_B<T, wide_type>(value)));
+#else
+  std::atomic<bool> &lock = builtin_atomic_get_wide_lock(acc).locked;
+  while (lock.exchange(true, std::memory_order_acquire)) {
+  }
+  atomic_wide_words old = atomic_wide_load(acc);
+  if (atomic_wide_equal(
+          old, RAJA::util::reinterp_A_as_B<T, atomic_wide_words>(compare))) {
+    atomic_wide_store(acc,
+                      RAJA::util::reinterp_A_as_B<T, atomic_wide_words>(value));
+  }
+  lock.store(false, std::memory_order_release);
+  return RAJA::util::reinterp_A_as_B<atomic_wide_words, T>(old);
+#endif
+}
+
+
 template <size_t BYTES>
 struct BuiltinAtomicCAS;
 template <size_t BYTES>
@@ -0,0 +1,393 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining atomic policies with a memory scope and
+ *          memory order.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_scope_HPP
+#define RAJA_policy_atomic_scope_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+//
+// The backend atomics are included here, and so before the templates that
+// call them by qualified name, whatever order the policies are included in.
+//
+#if !defined(RAJA_ENABLE_DESUL_ATOMICS)
+    #include "RAJA/policy/sequential/policy.hpp"
+    #include "RAJA/policy/sequential/atomic.hpp"
+    #include "RAJA/policy/loop/policy.hpp"
+    #include "RAJA/policy/loop/atomic.hpp"
+    #include "RAJA/policy/atomic_builtin.hpp"
+#if defined(RAJA_ENABLE_OPENMP)
+    #include "RAJA/policy/openmp/atomic.hpp"
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+    #include <cuda_runtime.h>
+    #include "RAJA/policy/cuda/policy.hpp"
+    #include "RAJA/policy/cuda/atomic.hpp"
+#endif
+#if defined(RAJA_HIP_ACTIVE)
+    #include "RAJA/policy/hip/policy.hpp"
+    #include "RAJA/policy/hip/atomic.hpp"
+#endif
+#if defined(RAJA_ENABLE_SYCL)
+    #include "RAJA/policy/sycl/policy.hpp"
+    #include "RAJA/policy/sycl/atomic.hpp"
+#endif
+#else
+    #include "RAJA/policy/desul/atomic.hpp"
+#endif
+
+
+namespace RAJA
+{
+
+/*!
+ * Memory scopes of scoped_atomic, the threads that the atomic is atomic
+ * with respect to and that its ordering applies to:
+ *
+ *   block   -- the threads of the same gpu thread block, which is enough for
+ *              atomics on shared memory
+ *   device  -- the threads of the same device, the scope of all other atomic
+ *              policies
+ *   system  -- all threads of the host and devices, for flags polled by the
+ *              host or other devices
+ */
+namespace atomic_scope
+{
+struct block {
+};
+struct device {
+};
+struct system {
+};
+}  // namespace atomic_scope
+
+/*!
+ * Memory orders of scoped_atomic, with the meanings of std::memory_order
+ */
+namespace atomic_order
+{
+struct relaxed {
+};
+struct acquire {
+};
+struct release {
+};
+struct acq_rel {
+};
+struct seq_cst {
+};
+}  // namespace atomic_order
+
+/*!
+ * Atomic policy that does the atomics of AtomicPolicy with the memory scope
+ * Scope and the memory order Order:
+ *
+ *     // block local histogram in shared memory
+ *     RAJA::atomicAdd<RAJA::scoped_atomic<RAJA::cuda_atomic,
+ *                                         RAJA::atomic_scope::block>>(
+ *         &shared_bins[bin], 1);
+ *
+ *     // publish a result to the host
+ *     RAJA::atomicExchange<RAJA::scoped_atomic<RAJA::cuda_atomic,
+ *                                              RAJA::atomic_scope::system,
+ *                                              RAJA::atomic_order::release>>(
+ *         flag, 1);
+ *
+ * With desul atomics these map to desul's scopes and orders.  Otherwise
+ * block scope atomics use the _block cuda atomic functions where they exist,
+ * and the orders and the system scope are given by fences of the scope
+ * around the device scope atomics of AtomicPolicy.
+ */
+template <typename AtomicPolicy,
+          typename Scope = atomic_scope::device,
+          typename Order = atomic_order::relaxed>
+struct scoped_atomic {
+};
+
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+
+namespace detail
+{
+
+template <typename Scope>
+struct desul_atomic_scope;
+
+template <>
+struct desul_atomic_scope<atomic_scope::block> {
+  using type = desul::MemoryScopeCore;
+};
+template <>
+struct desul_atomic_scope<atomic_scope::device> {
+  using type = desul::MemoryScopeDevice;
+};
+template <>
+struct desul_atomic_scope<atomic_scope::system> {
+  using type = desul::MemoryScopeNode;
+};
+
+template <typename Order>
+struct desul_atomic_order;
+
+template <>
+struct desul_atomic_order<atomic_order::relaxed> {
+  using type = desul::MemoryOrderRelaxed;
+};
+template <>
+struct desul_atomic_order<atomic_order::acquire> {
+  using type = desul::MemoryOrderAcquire;
+};
+template <>
+struct desul_atomic_order<atomic_order::release> {
+  using type = desul::MemoryOrderRelease;
+};
+template <>
+struct desul_atomic_order<atomic_order::acq_rel> {
+  using type = desul::MemoryOrderAcqRel;
+};
+template <>
+struct desul_atomic_order<atomic_order::seq_cst> {
+  using type = desul::MemoryOrderSeqCst;
+};
+
+template <typename AtomicPolicy, typename Scope, typename Order>
+struct desul_atomic_traits<scoped_atomic<AtomicPolicy, Scope, Order>> {
+  using order = typename desul_atomic_order<Order>::type;
+  using scope = typename desul_atomic_scope<Scope>::type;
+};
+
+}  // namespace detail
+
+#else  // RAJA_ENABLE_DESUL_ATOMICS
+
+namespace detail
+{
+
+RAJA_HOST_DEVICE RAJA_INLINE void scoped_atomic_fence(atomic_scope::block)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  __threadfence_block();
+#else
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE void scoped_atomic_fence(atomic_scope::device)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  __threadfence();
+#else
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE void scoped_atomic_fence(atomic_scope::system)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  __threadfence_system();
+#else
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/*!
+ * Whether an atomic of Order needs a fence before it, so that earlier
+ * accesses are not moved after it, and after it, so that later accesses are
+ * not moved before it.
+ */
+template <typename Order>
+struct scoped_atomic_fences;
+
+template <>
+struct scoped_atomic_fences<atomic_order::relaxed> {
+  static constexpr bool before = false;
+  static constexpr bool after = false;
+};
+template <>
+struct scoped_atomic_fences<atomic_order::acquire> {
+  static constexpr bool before = false;
+  static constexpr bool after = true;
+};
+template <>
+struct scoped_atomic_fences<atomic_order::release> {
+  static constexpr bool before = true;
+  static constexpr bool after = false;
+};
+template <>
+struct scoped_atomic_fences<atomic_order::acq_rel> {
+  static constexpr bool before = true;
+  static constexpr bool after = true;
+};
+template <>
+struct scoped_atomic_fences<atomic_order::seq_cst> {
+  static constexpr bool before = true;
+  static constexpr bool after = true;
+};
+
+/*!
+ * Scopes wider than the device scope of the atomic itself always fence, to
+ * make the atomic visible to the rest of the system.
+ */
+template <typename Scope, typename Order>
+RAJA_HOST_DEVICE RAJA_INLINE void scoped_atomic_fence_before()
+{
+  if (scoped_atomic_fences<Order>::before ||
+      std::is_same<Scope, atomic_scope::system>::value) {
+    scoped_atomic_fence(Scope{});
+  }
+}
+
+template <typename Scope, typename Order>
+RAJA_HOST_DEVICE RAJA_INLINE void scoped_atomic_fence_after()
+{
+  if (scoped_atomic_fences<Order>::after ||
+      std::is_same<Scope, atomic_scope::system>::value) {
+    scoped_atomic_fence(Scope{});
+  }
+}
+
+}  // namespace detail
+
+
+#define RAJA_SCOPED_ATOMIC_OP(NAME, PARAMS, ARGS)                             \
+  RAJA_SUPPRESS_HD_WARN                                                       \
+  template <typename AtomicPolicy, typename Scope, typename Order, typename T>\
+  RAJA_INLINE RAJA_HOST_DEVICE T                                              \
+  NAME(scoped_atomic<AtomicPolicy, Scope, Order>, T volatile *acc PARAMS)     \
+  {                                                                           \
+    detail::scoped_atomic_fence_before<Scope, Order>();                       \
+    T old = RAJA::NAME(AtomicPolicy{}, acc ARGS);                              \
+    detail::scoped_atomic_fence_after<Scope, Order>();                        \
+    return old;                                                               \
+  }
+
+#define RAJA_SCOPED_ATOMIC_COMMA ,
+
+RAJA_SCOPED_ATOMIC_OP(atomicAdd, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicSub, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicMin, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicMax, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicInc, , )
+RAJA_SCOPED_ATOMIC_OP(atomicInc, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicDec, , )
+RAJA_SCOPED_ATOMIC_OP(atomicDec, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicAnd, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicOr, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicXor, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicExchange, RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA value)
+RAJA_SCOPED_ATOMIC_OP(atomicCAS, RAJA_SCOPED_ATOMIC_COMMA T compare RAJA_SCOPED_ATOMIC_COMMA T value, RAJA_SCOPED_ATOMIC_COMMA compare RAJA_SCOPED_ATOMIC_COMMA value)
+
+#undef RAJA_SCOPED_ATOMIC_COMMA
+#undef RAJA_SCOPED_ATOMIC_OP
+
+
+#if defined(RAJA_ENABLE_CUDA)
+
+namespace detail
+{
+
+/*!
+ * Relaxed block scope cuda atomics with the _block functions of sm_60 and
+ * later, for the types they take; others use the device scope atomics.
+ */
+template <typename host_policy, typename T>
+RAJA_DEVICE RAJA_INLINE T cuda_atomicAdd_block(T volatile *acc, T value)
+{
+  return RAJA::atomicAdd(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+
+template <typename host_policy, typename T>
+RAJA_DEVICE RAJA_INLINE T cuda_atomicMin_block(T volatile *acc, T value)
+{
+  return RAJA::atomicMin(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+
+template <typename host_policy, typename T>
+RAJA_DEVICE RAJA_INLINE T cuda_atomicMax_block(T volatile *acc, T value)
+{
+  return RAJA::atomicMax(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 600
+
+#define RAJA_CUDA_ATOMIC_BLOCK(NAME, TYPE)                                    \
+  template <typename host_policy>                                             \
+  RAJA_DEVICE RAJA_INLINE TYPE cuda_##NAME##_block(TYPE volatile *acc,        \
+                                                   TYPE value)                \
+  {                                                                           \
+    return ::NAME##_block(const_cast<TYPE *>(acc), value);                    \
+  }
+
+RAJA_CUDA_ATOMIC_BLOCK(atomicAdd, int)
+RAJA_CUDA_ATOMIC_BLOCK(atomicAdd, unsigned)
+RAJA_CUDA_ATOMIC_BLOCK(atomicAdd, unsigned long long)
+RAJA_CUDA_ATOMIC_BLOCK(atomicAdd, float)
+RAJA_CUDA_ATOMIC_BLOCK(atomicAdd, double)
+RAJA_CUDA_ATOMIC_BLOCK(atomicMin, int)
+RAJA_CUDA_ATOMIC_BLOCK(atomicMin, unsigned)
+RAJA_CUDA_ATOMIC_BLOCK(atomicMin, unsigned long long)
+RAJA_CUDA_ATOMIC_BLOCK(atomicMax, int)
+RAJA_CUDA_ATOMIC_BLOCK(atomicMax, unsigned)
+RAJA_CUDA_ATOMIC_BLOCK(atomicMax, unsigned long long)
+
+#undef RAJA_CUDA_ATOMIC_BLOCK
+
+#endif
+
+}  // namespace detail
+
+#define RAJA_CUDA_SCOPED_ATOMIC_BLOCK(NAME)                                   \
+  RAJA_SUPPRESS_HD_WARN                                                       \
+  template <typename host_policy, typename T>                                 \
+  RAJA_INLINE RAJA_HOST_DEVICE T                                              \
+  NAME(scoped_atomic<cuda_atomic_explicit<host_policy>,                       \
+                     atomic_scope::block,                                     \
+                     atomic_order::relaxed>,                                  \
+       T volatile *acc,                                                       \
+       T value)                                                               \
+  {                                                                           \
+    RAJA_CUDA_SCOPED_ATOMIC_BLOCK_BODY(NAME)                                  \
+  }
+
+#if defined(__CUDA_ARCH__)
+#define RAJA_CUDA_SCOPED_ATOMIC_BLOCK_BODY(NAME)                              \
+    return detail::cuda_##NAME##_block<host_policy>(acc, value);
+#else
+#define RAJA_CUDA_SCOPED_ATOMIC_BLOCK_BODY(NAME)                              \
+    return RAJA::NAME(host_policy{}, acc, value);
+#endif
+
+RAJA_CUDA_SCOPED_ATOMIC_BLOCK(atomicAdd)
+RAJA_CUDA_SCOPED_ATOMIC_BLOCK(atomicMin)
+RAJA_CUDA_SCOPED_ATOMIC_BLOCK(atomicMax)
+
+#undef RAJA_CUDA_SCOPED_ATOMIC_BLOCK_BODY
+#undef RAJA_CUDA_SCOPED_ATOMIC_BLOCK
+
+#endif  // RAJA_ENABLE_CUDA
+
+#endif  // RAJA_ENABLE_DESUL_ATOMICS
+
+}  // namespace RAJA
+
+#endif  // guard
@@ -32,14 +32,17 @@
 #endif
 
 #include "RAJA/policy/cuda/forall.hpp"
+#include "RAJA/policy/cuda/histogram.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
 #include "RAJA/policy/cuda/reduce.hpp"
+#include "RAJA/policy/cuda/warp_atomic.hpp"
 #include "RAJA/policy/cuda/scan.hpp"
 #include "RAJA/policy/cuda/sort.hpp"
 #include "RAJA/policy/cuda/kernel.hpp"
 #include "RAJA/policy/cuda/synchronize.hpp"
 #include "RAJA/policy/cuda/teams.hpp"
 #include "RAJA/policy/cuda/WorkGroup.hpp"
+#include "RAJA/policy/cuda/graph.hpp"
 
 #endif  // closing endif for if defined(RAJA_ENABLE_CUDA)
 
@@ -20,9 +20,13 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #include "RAJA/policy/cuda/policy.hpp"
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 
+#include "RAJA/pattern/WorkGroup/WorkStorage.hpp"
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
 
@@ -32,6 +36,92 @@ namespace RAJA
 namespace detail
 {
 
+/*!
+ * Device copy of the loops in a work storage container.
+ *
+ * Storage with a device image policy is written into one host buffer and
+ * copied to device memory by the first run, with a single copy, and that
+ * copy is used by the later runs until the runner is cleared.
+ * Other storage is used where it is.
+ */
+struct CudaStorageImage
+{
+  CudaStorageImage() = default;
+
+  CudaStorageImage(CudaStorageImage const&) = delete;
+  CudaStorageImage& operator=(CudaStorageImage const&) = delete;
+
+  CudaStorageImage(CudaStorageImage && o)
+    : m_image(o.m_image)
+    , m_stream(o.m_stream)
+  {
+    o.m_image = nullptr;
+  }
+  CudaStorageImage& operator=(CudaStorageImage && o)
+  {
+    if (this != &o) {
+      clear();
+      m_image = o.m_image;
+      m_stream = o.m_stream;
+      o.m_image = nullptr;
+    }
+    return *this;
+  }
+
+  ~CudaStorageImage()
+  {
+    clear();
+  }
+
+  // iterator to the first loop in storage that can be used on the device
+  template < typename WorkContainer >
+  auto begin(WorkContainer const& storage, resources::Cuda r)
+    -> decltype(std::begin(storage))
+  {
+    return begin_impl(storage, r,
+        is_device_image_storage<typename WorkContainer::storage_policy>{});
+  }
+
+  // free the device copy
+  void clear()
+  {
+    if (m_image != nullptr) {
+      RAJA::cuda::device_mempool_type::getInstance().stream_free(
+          m_image, m_stream);
+      m_image = nullptr;
+    }
+  }
+
+private:
+  char* m_image = nullptr;
+  cudaStream_t m_stream = 0;
+
+  template < typename WorkContainer >
+  auto begin_impl(WorkContainer const& storage, resources::Cuda, std::false_type)
+    -> decltype(std::begin(storage))
+  {
+    return std::begin(storage);
+  }
+
+  template < typename WorkContainer >
+  auto begin_impl(WorkContainer const& storage, resources::Cuda r, std::true_type)
+    -> decltype(std::begin(storage))
+  {
+    if (m_image == nullptr) {
+      std::vector<char> host_image(storage.image_size());
+      storage.write_image(host_image.data());
+      m_image = RAJA::cuda::device_mempool_type::getInstance()
+          .stream_malloc<char>(host_image.size(), r.get_stream());
+      cudaErrchk(cudaMemcpyAsync(m_image, host_image.data(), host_image.size(),
+                                 cudaMemcpyHostToDevice, r.get_stream()));
+      // later runs may use other streams
+      cudaErrchk(cudaStreamSynchronize(r.get_stream()));
+    }
+    m_stream = r.get_stream();
+    return storage.image_begin(m_image);
+  }
+};
+
 /*!
  * Runs work in a storage container in order
  * and returns any per run resources
@@ -224,12 +314,14 @@ struct WorkRunner<
 
   WorkRunner(WorkRunner && o)
     : m_total_iterations(o.m_total_iterations)
+    , m_image(std::move(o.m_image))
   {
     o.m_total_iterations = 0;
   }
   WorkRunner& operator=(WorkRunner && o)
   {
     m_total_iterations = o.m_total_iterations;
+    m_image = std::move(o.m_image);
 
     o.m_total_iterations = 0;
     return *this;
@@ -296,9 +388,7 @@ struct WorkRunner<
     //
     // Compute the requested iteration space size
     //
-    Iterator begin = std::begin(storage);
-    Iterator end = std::end(storage);
-    IndexType num_loops = std::distance(begin, end);
+    IndexType num_loops = std::distance(std::begin(storage), std::end(storage));
 
     // Only launch kernel if we have something to iterate over
     if (num_loops > 0 && BLOCK_SIZE > 0) {
@@ -314,6 +404,8 @@ struct WorkRunner<
                           static_cast<cuda_dim_member_t>(num_loops),
                           1};
 
+      Iterator begin = m_image.begin(storage, r);
+
       RAJA_FT_BEGIN;
 
       //
@@ -339,12 +431,560 @@ struct WorkRunner<
   void clear()
   {
     m_total_iterations = 0;
+    m_image.clear();
   }
 
 private:
   index_type m_total_iterations = 0;
+  mutable CudaStorageImage m_image;
+};
+
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * by a single block on the device
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldCudaDeviceXThreadLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldCudaDeviceXThreadLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_DEVICE RAJA_INLINE void operator()(Args... args) const
+  {
+    const index_type i_begin = threadIdx.x;
+    const index_type stride  = blockDim.x;
+    const auto begin = m_segment.begin();
+    const auto end   = m_segment.end();
+    const index_type len(end - begin);
+    for ( index_type i = i_begin; i < len; i += stride ) {
+      m_body(begin[i], std::forward<Args>(args)...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+template < size_t BLOCK_SIZE,
+           size_t BLOCKS_PER_SM,
+           typename StorageIter,
+           typename value_type,
+           typename index_type,
+           typename ... Args >
+__launch_bounds__(BLOCK_SIZE, BLOCKS_PER_SM) __global__
+    void cuda_persistent_block_queue_global(StorageIter iter,
+                                            index_type num_loops,
+                                            unsigned int* queue,
+                                            Args... args)
+{
+  __shared__ index_type s_loop;
+  while (true) {
+    // the block takes the next loop off the queue
+    if (threadIdx.x == 0) {
+      s_loop = static_cast<index_type>(atomicAdd(queue, 1u));
+    }
+    __syncthreads();
+    const index_type i_loop = s_loop;
+    if (i_loop >= num_loops) {
+      break;
+    }
+    value_type::call(&iter[i_loop], args...);
+    // every thread has read s_loop before it is overwritten
+    __syncthreads();
+  }
+}
+
+
+/*!
+ * Runs work in a storage container out of order with a grid of blocks that
+ * stays resident on the device, each block taking the next loop from a
+ * device side queue and running its iterations over the threads in the
+ * x direction until the queue is empty.
+ *
+ * The grid is sized to fill the device, so all the loops in the container
+ * cost one launch, and small loops do not leave most of the grid idle.
+ */
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+        RAJA::policy::cuda::unordered_cuda_persistent_block_queue,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>;
+  using order_policy = RAJA::policy::cuda::unordered_cuda_persistent_block_queue;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Cuda;
+
+  using vtable_type = Vtable<RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, true>, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner &&) = default;
+  WorkRunner& operator=(WorkRunner &&) = default;
+
+  // The type  that will hold the segment and loop body in work storage
+  template < typename ITERABLE, typename LOOP_BODY >
+  using holder_type = HoldCudaDeviceXThreadLoop<ITERABLE, LOOP_BODY,
+                                 index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the device
+  using vtable_exec_policy = exec_policy;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type<ITERABLE, LOOP_BODY>;
+
+    // Only enqueue if we have something to iterate over
+    if (std::begin(iter) != std::end(iter) && BLOCK_SIZE > 0) {
+
+      storage.template emplace<holder>(
+          get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type r, Args... args) const
+  {
+    using Iterator  = camp::decay<decltype(std::begin(storage))>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(storage), std::end(storage)))>;
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    auto func = cuda_persistent_block_queue_global<BLOCK_SIZE, BLOCKS_PER_SM, Iterator, value_type, index_type, Args...>;
+
+    IndexType num_loops = std::distance(std::begin(storage), std::end(storage));
+
+    // Only launch kernel if we have something to iterate over
+    if (num_loops > 0 && BLOCK_SIZE > 0) {
+
+      Iterator begin = m_image.begin(storage, r);
+
+      //
+      // Compute the number of resident blocks, once per kernel
+      //
+      static const index_type max_blocks = [&]() {
+        int blocks_per_sm = 0;
+        cudaErrchk(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_sm, func, static_cast<int>(BLOCK_SIZE), 0));
+        return static_cast<index_type>(
+            std::max(blocks_per_sm, 1) *
+            RAJA::cuda::device_prop().multiProcessorCount);
+      }();
+
+      index_type num_loops_idx = static_cast<index_type>(num_loops);
+      index_type num_blocks = std::min(max_blocks, num_loops_idx);
+
+      cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(BLOCK_SIZE), 1, 1};
+      cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(num_blocks), 1, 1};
+
+      RAJA_FT_BEGIN;
+
+      //
+      // Setup the queue, reused in stream order by later runs
+      //
+      unsigned int* queue =
+          RAJA::cuda::device_mempool_type::getInstance()
+              .stream_malloc<unsigned int>(1, r.get_stream());
+      cudaErrchk(cudaMemsetAsync(queue, 0, sizeof(unsigned int), r.get_stream()));
+
+      size_t shmem = 0;
+
+      {
+        //
+        // Launch the kernel
+        //
+        void* func_args[] = { (void*)&begin, (void*)&num_loops_idx,
+                              (void*)&queue, (void*)&args... };
+        RAJA::cuda::launch((const void*)func, gridSize, blockSize, func_args, shmem, r, Async);
+      }
+
+      RAJA::cuda::device_mempool_type::getInstance().stream_free(
+          queue, r.get_stream());
+
+      RAJA_FT_END;
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_image.clear();
+  }
+
+private:
+  mutable CudaStorageImage m_image;
 };
 
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * a chunk of iterations at a time by a single block on the device
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldCudaDeviceXThreadChunk
+{
+  template < typename segment_in, typename body_in >
+  HoldCudaDeviceXThreadChunk(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_DEVICE RAJA_INLINE void operator()(index_type chunk_begin,
+                                          index_type chunk_end,
+                                          Args... args) const
+  {
+    const auto begin = m_segment.begin();
+    const auto end   = m_segment.end();
+    const index_type len(end - begin);
+    const index_type i_end = chunk_end < len ? chunk_end : len;
+    for ( index_type i = chunk_begin + threadIdx.x; i < i_end; i += blockDim.x ) {
+      m_body(begin[i], std::forward<Args>(args)...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+template < size_t BLOCK_SIZE,
+           size_t BLOCKS_PER_SM,
+           typename StorageIter,
+           typename value_type,
+           typename index_type,
+           typename ... Args >
+__launch_bounds__(BLOCK_SIZE, BLOCKS_PER_SM) __global__
+    void cuda_persistent_chunk_queue_global(StorageIter iter,
+                                            index_type num_loops,
+                                            index_type chunk_size,
+                                            const index_type* schedule,
+                                            unsigned int* queue,
+                                            Args... args)
+{
+  // the first chunk of each scheduled loop and the number of chunks,
+  // followed by the loop of each schedule entry
+  const index_type* chunk_offsets = schedule;
+  const index_type* loops = schedule + num_loops + 1;
+  const index_type num_chunks = chunk_offsets[num_loops];
+
+  __shared__ index_type s_chunk;
+  while (true) {
+    // the block takes the next chunk off the queue
+    if (threadIdx.x == 0) {
+      s_chunk = static_cast<index_type>(atomicAdd(queue, 1u));
+    }
+    __syncthreads();
+    const index_type chunk = s_chunk;
+    if (chunk >= num_chunks) {
+      break;
+    }
+    // find the schedule entry with chunk_offsets[lo] <= chunk < chunk_offsets[lo+1]
+    index_type lo = 0;
+    index_type hi = num_loops;
+    while (hi - lo > 1) {
+      const index_type mid = lo + (hi - lo) / 2;
+      if (chunk_offsets[mid] <= chunk) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    const index_type i_begin = (chunk - chunk_offsets[lo]) * chunk_size;
+    value_type::call(&iter[loops[lo]], i_begin, i_begin + chunk_size, args...);
+    // every thread has read s_chunk before it is overwritten
+    __syncthreads();
+  }
+}
+
+
+/*!
+ * Runs work in a storage container out of order with a grid of blocks that
+ * stays resident on the device, each block taking the next chunk of
+ * iterations from a device side queue and running it over the threads in
+ * the x direction until the queue is empty.
+ *
+ * The loops are split into chunks of a multiple of the block size, sized
+ * so each resident block gets a few chunks, and the chunks of the longest
+ * loops are handed out first. A long loop is shared by many blocks, so
+ * groups of loops with very different lengths finish together.
+ *
+ * The schedule is copied to the device by the first run and kept there
+ * for the later runs of the same work group.
+ */
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+        RAJA::policy::cuda::unordered_cuda_persistent_chunk_queue,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>;
+  using order_policy = RAJA::policy::cuda::unordered_cuda_persistent_chunk_queue;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Cuda;
+
+  using vtable_type = Vtable<RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, true>,
+                             index_type, index_type, Args...>;
+
+  //! Chunks handed to each resident block when the loops are long enough
+  static constexpr index_type chunks_per_block = 4;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : m_lengths(std::move(o.m_lengths))
+    , m_schedule(o.m_schedule)
+    , m_schedule_stream(o.m_schedule_stream)
+    , m_chunk_size(o.m_chunk_size)
+    , m_num_chunks(o.m_num_chunks)
+    , m_image(std::move(o.m_image))
+  {
+    o.m_lengths.clear();
+    o.m_schedule = nullptr;
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    if (this != &o) {
+      clear();
+      m_lengths = std::move(o.m_lengths);
+      m_schedule = o.m_schedule;
+      m_schedule_stream = o.m_schedule_stream;
+      m_chunk_size = o.m_chunk_size;
+      m_num_chunks = o.m_num_chunks;
+      m_image = std::move(o.m_image);
+      o.m_lengths.clear();
+      o.m_schedule = nullptr;
+    }
+    return *this;
+  }
+
+  // The type  that will hold the segment and loop body in work storage
+  template < typename ITERABLE, typename LOOP_BODY >
+  using holder_type = HoldCudaDeviceXThreadChunk<ITERABLE, LOOP_BODY,
+                                 index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the device
+  using vtable_exec_policy = exec_policy;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type<ITERABLE, LOOP_BODY>;
+
+    const index_type len =
+        static_cast<index_type>(std::distance(std::begin(iter), std::end(iter)));
+
+    // Only enqueue if we have something to iterate over
+    if (len > 0 && BLOCK_SIZE > 0) {
+
+      m_lengths.push_back(len);
+
+      storage.template emplace<holder>(
+          get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type r, Args... args) const
+  {
+    using Iterator  = camp::decay<decltype(std::begin(storage))>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(storage), std::end(storage)))>;
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    auto func = cuda_persistent_chunk_queue_global<BLOCK_SIZE, BLOCKS_PER_SM, Iterator, value_type, index_type, Args...>;
+
+    IndexType num_loops = std::distance(std::begin(storage), std::end(storage));
+
+    // Only launch kernel if we have something to iterate over
+    if (num_loops > 0 && BLOCK_SIZE > 0) {
+
+      Iterator begin = m_image.begin(storage, r);
+
+      //
+      // Compute the number of resident blocks, once per kernel
+      //
+      static const index_type max_blocks = [&]() {
+        int blocks_per_sm = 0;
+        cudaErrchk(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_sm, func, static_cast<int>(BLOCK_SIZE), 0));
+        return static_cast<index_type>(
+            std::max(blocks_per_sm, 1) *
+            RAJA::cuda::device_prop().multiProcessorCount);
+      }();
+
+      index_type num_loops_idx = static_cast<index_type>(num_loops);
+
+      if (m_schedule == nullptr) {
+        build_schedule(max_blocks, r);
+      }
+      m_schedule_stream = r.get_stream();
+
+      index_type chunk_size = m_chunk_size;
+      const index_type num_chunks = m_num_chunks;
+
+      index_type num_blocks = std::min(max_blocks, num_chunks);
+
+      cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(BLOCK_SIZE), 1, 1};
+      cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(num_blocks), 1, 1};
+
+      RAJA_FT_BEGIN;
+
+      //
+      // Setup the queue, reused in stream order by later runs
+      //
+      unsigned int* queue =
+          RAJA::cuda::device_mempool_type::getInstance()
+              .stream_malloc<unsigned int>(1, r.get_stream());
+      cudaErrchk(cudaMemsetAsync(queue, 0, sizeof(unsigned int), r.get_stream()));
+
+      size_t shmem = 0;
+
+      {
+        //
+        // Launch the kernel
+        //
+        const index_type* schedule_arg = m_schedule;
+        void* func_args[] = { (void*)&begin, (void*)&num_loops_idx,
+                              (void*)&chunk_size, (void*)&schedule_arg,
+                              (void*)&queue, (void*)&args... };
+        RAJA::cuda::launch((const void*)func, gridSize, blockSize, func_args, shmem, r, Async);
+      }
+
+      RAJA::cuda::device_mempool_type::getInstance().stream_free(
+          queue, r.get_stream());
+
+      RAJA_FT_END;
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    if (m_schedule != nullptr) {
+      RAJA::cuda::device_mempool_type::getInstance().stream_free(
+          m_schedule, m_schedule_stream);
+      m_schedule = nullptr;
+    }
+    m_lengths.clear();
+    m_image.clear();
+  }
+
+  ~WorkRunner()
+  {
+    clear();
+  }
+
+private:
+  std::vector<index_type> m_lengths;
+
+  // device copy of the schedule, set by the first run
+  mutable index_type* m_schedule = nullptr;
+  mutable cudaStream_t m_schedule_stream = 0;
+  mutable index_type m_chunk_size = 0;
+  mutable index_type m_num_chunks = 0;
+
+  // device copy of the loops, set by the first run
+  mutable CudaStorageImage m_image;
+
+  //
+  // Size the chunks from the total work and the size of the grid, schedule
+  // the longest loops first and copy the schedule to the device
+  //
+  void build_schedule(index_type max_blocks, resource_type r) const
+  {
+    const index_type num_loops_idx = static_cast<index_type>(m_lengths.size());
+    constexpr index_type block_size = static_cast<index_type>(BLOCK_SIZE);
+    index_type total_iterations = 0;
+    for (index_type len : m_lengths) {
+      total_iterations += len;
+    }
+    index_type chunk_size =
+        (total_iterations + max_blocks * chunks_per_block - 1) /
+        (max_blocks * chunks_per_block);
+    chunk_size = std::max(block_size,
+        (chunk_size + block_size - 1) / block_size * block_size);
+
+    //
+    // Schedule the longest loops first
+    //
+    std::vector<index_type> schedule(2 * num_loops_idx + 1);
+    index_type* chunk_offsets = schedule.data();
+    index_type* loops = schedule.data() + num_loops_idx + 1;
+    for (index_type i = 0; i < num_loops_idx; ++i) {
+      loops[i] = i;
+    }
+    std::stable_sort(loops, loops + num_loops_idx,
+                     [&](index_type a, index_type b) {
+                       return m_lengths[a] > m_lengths[b];
+                     });
+    chunk_offsets[0] = 0;
+    for (index_type i = 0; i < num_loops_idx; ++i) {
+      chunk_offsets[i + 1] = chunk_offsets[i] +
+          (m_lengths[loops[i]] + chunk_size - 1) / chunk_size;
+    }
+    m_chunk_size = chunk_size;
+    m_num_chunks = chunk_offsets[num_loops_idx];
+
+    m_schedule = RAJA::cuda::device_mempool_type::getInstance()
+        .stream_malloc<index_type>(schedule.size(), r.get_stream());
+    cudaErrchk(cudaMemcpyAsync(m_schedule, schedule.data(),
+                               schedule.size() * sizeof(index_type),
+                               cudaMemcpyHostToDevice, r.get_stream()));
+    // later runs may use other streams
+    cudaErrchk(cudaStreamSynchronize(r.get_stream()));
+  }
+};
 
 }  // namespace detail
 
@@ -52,6 +52,13 @@ namespace detail
 // Most >= 200 checks can be deemed as >= 110 (except CAS 64-bit, Add 32-bit float, and Add 64-bit ULL), but using 200 for shared memory support.
 // If using < 350, certain atomics will be implemented with atomicCAS.
 
+/*!
+ * Device locks of the 16 byte compare and swap on architectures without a
+ * 128-bit atomicCAS, one table per translation unit, so 16 byte values must
+ * not be updated by kernels of different translation units at the same time.
+ */
+static __device__ unsigned cuda_atomic_wide_locks[atomic_wide_num_locks];
+
 #if __CUDA_ARCH__ >= 200
 /*!
  * Generic impementation of atomic 32-bit or 64-bit compare and swap primitive.
@@ -97,6 +104,44 @@ cuda_atomic_CAS(T volatile *acc, T compare, T value)
           RAJA::util::reinterp_A_as_B<T, unsigned long long>(value)));
 }
 
+///
+/*!
+ * Compare and swap of 16 byte values, T must be trivially copyable and
+ * aligned to 16 bytes.  Uses the 128-bit atomicCAS of sm_90 and CUDA 12.4,
+ * or else a lock from a table of locks indexed by the address.  The lock is
+ * taken and released in the same iteration of the loop so threads of a warp
+ * that hash to the same lock make progress.  The comparison is bitwise.
+ */
+template <typename T>
+RAJA_INLINE __device__
+typename std::enable_if<sizeof(T) == 16, T>::type
+cuda_atomic_CAS(T volatile *acc, T compare, T value)
+{
+#if __CUDA_ARCH__ >= 900 && defined(CUDART_VERSION) && CUDART_VERSION >= 12040
+  return ::atomicCAS((T *)acc, compare, value);
+#else
+  unsigned *lock = &cuda_atomic_wide_locks[atomic_wide_lock_index(acc)];
+  atomic_wide_words old;
+  bool done = false;
+  while (!done) {
+    if (::atomicCAS(lock, 0u, 1u) == 0u) {
+      __threadfence();
+      old = atomic_wide_load(acc);
+      if (atomic_wide_equal(
+              old,
+              RAJA::util::reinterp_A_as_B<T, atomic_wide_words>(compare))) {
+        atomic_wide_store(
+            acc, RAJA::util::reinterp_A_as_B<T, atomic_wide_words>(value));
+      }
+      __threadfence();
+      ::atomicExch(lock, 0u);
+      done = true;
+    }
+  }
+  return RAJA::util::reinterp_A_as_B<atomic_wide_words, T>(old);
+#endif
+}
+
 template <size_t BYTES>
 struct CudaAtomicCAS {
 };
@@ -342,6 +387,56 @@ RAJA_INLINE __device__ unsigned long long cuda_atomicMax<unsigned long long>(
 }
 #endif
 
+// float and double atomicMin and atomicMax with the integer atomics on their
+// bits instead of CAS loops: values with the sign bit clear order like their
+// bits as signed integers, and values with the sign bit set order in reverse
+// of their bits as unsigned integers. NaNs are ordered by their bits.
+#if __CUDA_ARCH__ >= 200
+template <>
+RAJA_INLINE __device__ float cuda_atomicMin<float>(float volatile *acc,
+                                                   float value)
+{
+  return (__float_as_int(value) < 0)
+      ? __uint_as_float(::atomicMax((unsigned *)acc, __float_as_uint(value)))
+      : __int_as_float(::atomicMin((int *)acc, __float_as_int(value)));
+}
+
+template <>
+RAJA_INLINE __device__ float cuda_atomicMax<float>(float volatile *acc,
+                                                   float value)
+{
+  return (__float_as_int(value) < 0)
+      ? __uint_as_float(::atomicMin((unsigned *)acc, __float_as_uint(value)))
+      : __int_as_float(::atomicMax((int *)acc, __float_as_int(value)));
+}
+#endif
+
+#if __CUDA_ARCH__ >= 350
+template <>
+RAJA_INLINE __device__ double cuda_atomicMin<double>(double volatile *acc,
+                                                     double value)
+{
+  const long long bits = __double_as_longlong(value);
+  return (bits < 0)
+      ? __longlong_as_double(static_cast<long long>(
+            ::atomicMax((unsigned long long *)acc,
+                        static_cast<unsigned long long>(bits))))
+      : __longlong_as_double(::atomicMin((long long *)acc, bits));
+}
+
+template <>
+RAJA_INLINE __device__ double cuda_atomicMax<double>(double volatile *acc,
+                                                     double value)
+{
+  const long long bits = __double_as_longlong(value);
+  return (bits < 0)
+      ? __longlong_as_double(static_cast<long long>(
+            ::atomicMin((unsigned long long *)acc,
+                        static_cast<unsigned long long>(bits))))
+      : __longlong_as_double(::atomicMax((long long *)acc, bits));
+}
+#endif
+
 #if __CUDA_ARCH__ >= 200
 template <typename T>
 RAJA_INLINE __device__ T cuda_atomicInc(T volatile *acc, T val)
@@ -0,0 +1,171 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the CUDA graph recorder and graph.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_graph_cuda_HPP
+#define RAJA_graph_cuda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <cuda_runtime.h>
+
+#include "RAJA/pattern/graph.hpp"
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief A CUDA graph, launched as a whole on a stream.
+ */
+template <>
+class Graph<resources::Cuda>
+{
+public:
+  Graph(resources::Cuda res, cudaGraph_t graph, cudaGraphExec_t exec)
+      : m_res(res), m_graph(graph), m_exec(exec)
+  {
+  }
+
+  Graph(Graph const&) = delete;
+  Graph& operator=(Graph const&) = delete;
+
+  Graph(Graph&& other)
+      : m_res(other.m_res), m_graph(other.m_graph), m_exec(other.m_exec)
+  {
+    other.m_graph = nullptr;
+    other.m_exec = nullptr;
+  }
+
+  Graph& operator=(Graph&& other)
+  {
+    if (this != &other) {
+      destroy();
+      m_res = other.m_res;
+      m_graph = other.m_graph;
+      m_exec = other.m_exec;
+      other.m_graph = nullptr;
+      other.m_exec = nullptr;
+    }
+    return *this;
+  }
+
+  ~Graph() { destroy(); }
+
+  /*!
+   * \brief Launch the graph on the resource it was recorded on.
+   */
+  resources::EventProxy<resources::Cuda> launch() { return launch(m_res); }
+
+  /*!
+   * \brief Launch the graph on res.
+   */
+  resources::EventProxy<resources::Cuda> launch(resources::Cuda res)
+  {
+    cudaErrchk(cudaGraphLaunch(m_exec, res.get_stream()));
+    ::RAJA::cuda::launch(res, true);
+    return resources::EventProxy<resources::Cuda>(res);
+  }
+
+private:
+  void destroy()
+  {
+    if (m_exec != nullptr) {
+      cudaErrchk(cudaGraphExecDestroy(m_exec));
+      m_exec = nullptr;
+    }
+    if (m_graph != nullptr) {
+      cudaErrchk(cudaGraphDestroy(m_graph));
+      m_graph = nullptr;
+    }
+  }
+
+  resources::Cuda m_res;
+  cudaGraph_t m_graph;
+  cudaGraphExec_t m_exec;
+};
+
+/*!
+ * \brief Captures the work launched on the stream of a CUDA resource.
+ */
+template <>
+class GraphRecorder<resources::Cuda>
+{
+public:
+  explicit GraphRecorder(resources::Cuda res) : m_res(res)
+  {
+    cudaErrchk(cudaStreamBeginCapture(m_res.get_stream(),
+                                      cudaStreamCaptureModeRelaxed));
+  }
+
+  GraphRecorder(GraphRecorder const&) = delete;
+  GraphRecorder& operator=(GraphRecorder const&) = delete;
+
+  //! Discards the recording if instantiate was not called
+  ~GraphRecorder()
+  {
+    if (m_capturing) {
+      cudaGraph_t graph = nullptr;
+      cudaErrchk(cudaStreamEndCapture(m_res.get_stream(), &graph));
+      if (graph != nullptr) {
+        cudaErrchk(cudaGraphDestroy(graph));
+      }
+    }
+  }
+
+  /*!
+   * \brief End the recording and make a graph that can be launched.
+   */
+  Graph<resources::Cuda> instantiate()
+  {
+    if (!m_capturing) {
+      RAJA_ABORT_OR_THROW("GraphRecorder::instantiate called twice");
+    }
+    m_capturing = false;
+
+    cudaGraph_t graph = nullptr;
+    cudaErrchk(cudaStreamEndCapture(m_res.get_stream(), &graph));
+
+    cudaGraphExec_t exec = nullptr;
+#if CUDART_VERSION >= 12000
+    cudaErrchk(cudaGraphInstantiate(&exec, graph, 0));
+#else
+    cudaErrchk(cudaGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+#endif
+
+    return Graph<resources::Cuda>(m_res, graph, exec);
+  }
+
+private:
+  resources::Cuda m_res;
+  bool m_capturing = true;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // defined(RAJA_ENABLE_CUDA)
+
+#endif  // RAJA_graph_cuda_HPP
@@ -0,0 +1,168 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_cuda_HPP
+#define RAJA_histogram_cuda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <algorithm>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+#include "RAJA/pattern/detail/histogram.hpp"
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/teams.hpp"
+#include "RAJA/policy/atomic_scope.hpp"
+#include "RAJA/policy/cuda/warp_atomic.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+/*!
+ * \brief Each block counts its values in bins in shared memory, then adds
+ *        them to bins with one atomic per bin.
+ */
+template <size_t BlockSize,
+          size_t BlocksPerSM,
+          typename Iter,
+          typename CountT,
+          typename BinOp>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
+    void histogram_cuda_shared_kernel(const Iter begin,
+                                      Index_type len,
+                                      CountT* bins,
+                                      Index_type num_bins,
+                                      BinOp bin_of)
+{
+  extern __shared__ char raja_histogram_shared_mem[];
+  CountT* block_bins = reinterpret_cast<CountT*>(raja_histogram_shared_mem);
+
+  for (Index_type bin = threadIdx.x; bin < num_bins; bin += BlockSize) {
+    block_bins[bin] = CountT(0);
+  }
+  __syncthreads();
+
+  const Index_type stride = static_cast<Index_type>(gridDim.x) * BlockSize;
+  for (Index_type i = blockIdx.x * BlockSize + threadIdx.x; i < len;
+       i += stride) {
+    const Index_type bin = RAJA::detail::histogram_bin(bin_of, begin[i], num_bins);
+    if (bin >= 0) {
+      RAJA::atomicAdd(
+          RAJA::scoped_atomic<RAJA::cuda_atomic, RAJA::atomic_scope::block>{},
+          &block_bins[bin],
+          CountT(1));
+    }
+  }
+  __syncthreads();
+
+  for (Index_type bin = threadIdx.x; bin < num_bins; bin += BlockSize) {
+    if (block_bins[bin] != CountT(0)) {
+      RAJA::atomicAdd(RAJA::cuda_atomic{}, &bins[bin], block_bins[bin]);
+    }
+  }
+}
+
+/*!
+ * \brief Adds the values to bins with warp aggregated atomics, for bins that
+ *        do not fit in shared memory.
+ */
+template <size_t BlockSize,
+          size_t BlocksPerSM,
+          typename Iter,
+          typename CountT,
+          typename BinOp>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
+    void histogram_cuda_global_kernel(const Iter begin,
+                                      Index_type len,
+                                      CountT* bins,
+                                      Index_type num_bins,
+                                      BinOp bin_of)
+{
+  const Index_type i = blockIdx.x * BlockSize + threadIdx.x;
+  if (i < len) {
+    const Index_type bin = RAJA::detail::histogram_bin(bin_of, begin[i], num_bins);
+    if (bin >= 0) {
+      RAJA::atomicAdd(RAJA::cuda_warp_atomic{}, &bins[bin], CountT(1));
+    }
+  }
+}
+
+/*!
+        \brief count the values of [begin, begin + len) in their bins
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename Iter, typename CountT, typename BinOp>
+resources::EventProxy<resources::Cuda>
+count(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Iter begin,
+    Index_type len,
+    CountT* bins,
+    Index_type num_bins,
+    BinOp bin_of)
+{
+  cuda_dim_t blockSize{BLOCK_SIZE, 1, 1};
+  size_t shmem = static_cast<size_t>(num_bins) * sizeof(CountT);
+  const void* func = nullptr;
+  cuda_dim_t gridSize{0, 1, 1};
+
+  const Index_type len_blocks = (len + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+  if (shmem <= cuda::device_prop().sharedMemPerBlock) {
+
+    // as many blocks as fit on the device, each counts many values so the
+    // cost of its bins is amortized
+    func = (const void*)&histogram_cuda_shared_kernel<
+        BLOCK_SIZE, BLOCKS_PER_SM, Iter, CountT, BinOp>;
+    const Index_type max_blocks = static_cast<Index_type>(
+        RAJA::expt::detail::launch_coresident_blocks(func, BLOCK_SIZE, shmem));
+    gridSize.x = static_cast<cuda_dim_member_t>(std::min(len_blocks, max_blocks));
+
+  } else {
+
+    func = (const void*)&histogram_cuda_global_kernel<
+        BLOCK_SIZE, BLOCKS_PER_SM, Iter, CountT, BinOp>;
+    gridSize.x = static_cast<cuda_dim_member_t>(len_blocks);
+    shmem = 0;
+  }
+
+  void* args[] = {(void*)&begin, (void*)&len, (void*)&bins,
+                  (void*)&num_bins, (void*)&bin_of};
+  RAJA::cuda::launch(func, gridSize, blockSize, args, shmem, cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA guard
+
+#endif  // closing endif for header file include guard
@@ -23,6 +23,7 @@
 #include "RAJA/policy/cuda/kernel/CudaKernel.hpp"
 #include "RAJA/policy/cuda/kernel/For.hpp"
 #include "RAJA/policy/cuda/kernel/ForICount.hpp"
+#include "RAJA/policy/cuda/kernel/ForRagged.hpp"
 #include "RAJA/policy/cuda/kernel/Hyperplane.hpp"
 #include "RAJA/policy/cuda/kernel/InitLocalMem.hpp"
 #include "RAJA/policy/cuda/kernel/Lambda.hpp"
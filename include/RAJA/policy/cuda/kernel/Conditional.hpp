@@ -71,6 +71,48 @@ struct CudaStatementExecutor<Data,
 };
 
 
+/*!
+ * IfUniform evaluates the condition on the first thread of the block and
+ * broadcasts it with the block barrier, so the branch is uniform.
+ */
+template <typename Data,
+          typename Conditional,
+          typename... EnclosedStmts,
+          typename Types>
+struct CudaStatementExecutor<Data,
+                             statement::IfUniform<Conditional, EnclosedStmts...>,
+                             Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+  using enclosed_stmts_t = CudaStatementListExecutor<Data, stmt_list_t, Types>;
+
+
+  static
+  inline
+  RAJA_DEVICE
+  void exec(Data &data, bool thread_active)
+  {
+    const bool first_thread =
+        threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0;
+
+    if (__syncthreads_or(first_thread && Conditional::eval(data))) {
+
+      // execute enclosed statements
+      enclosed_stmts_t::exec(data, thread_active);
+    }
+  }
+
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const &data)
+  {
+    return enclosed_stmts_t::calculateDimensions(data);
+  }
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
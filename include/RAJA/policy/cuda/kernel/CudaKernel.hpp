@@ -79,6 +79,18 @@ using cuda_launch = cuda_explicit_launch<async0, num_blocks, num_threads, policy
 template <size_t num_threads0, bool async0>
 using cuda_occ_calc_launch = cuda_explicit_launch<async0, 0, num_threads0, policy::cuda::MIN_BLOCKS_PER_SM>;
 
+/*!
+ * CUDA kernel launch policy where the user specifies the number of physical
+ * thread blocks and threads per block, and the registers a thread may use.
+ * The register bound becomes the min blocks per SM of __launch_bounds__, so
+ * the compiler spills rather than use more registers, as with
+ * -maxrregcount for this kernel only. num_threads must be non-zero.
+ */
+template <bool async0, size_t num_blocks, size_t num_threads, size_t max_registers>
+using cuda_register_launch = cuda_explicit_launch<
+    async0, num_blocks, num_threads,
+    policy::cuda::blocks_per_sm_for_registers(num_threads, max_registers)>;
+
 namespace statement
 {
 
@@ -171,6 +183,28 @@ using CudaKernelFixedSMAsync =
     CudaKernelExt<cuda_explicit_launch<true, operators::limits<size_t>::max(), num_threads, blocks_per_sm>,
                   EnclosedStmts...>;
 
+/*!
+ * A RAJA::kernel statement that launches a CUDA kernel with a fixed
+ * number of threads (specified by num_threads) and at most max_registers
+ * registers per thread.
+ * The kernel launch is synchronous.
+ */
+template <size_t num_threads, size_t max_registers, typename... EnclosedStmts>
+using CudaKernelFixedRegisters =
+    CudaKernelExt<cuda_register_launch<false, operators::limits<size_t>::max(), num_threads, max_registers>,
+                  EnclosedStmts...>;
+
+/*!
+ * A RAJA::kernel statement that launches a CUDA kernel with a fixed
+ * number of threads (specified by num_threads) and at most max_registers
+ * registers per thread.
+ * The kernel launch is asynchronous.
+ */
+template <size_t num_threads, size_t max_registers, typename... EnclosedStmts>
+using CudaKernelFixedRegistersAsync =
+    CudaKernelExt<cuda_register_launch<true, operators::limits<size_t>::max(), num_threads, max_registers>,
+                  EnclosedStmts...>;
+
 /*!
  * A RAJA::kernel statement that launches a CUDA kernel with 1024 threads
  * The kernel launch is synchronous.
@@ -194,12 +228,12 @@ namespace internal
 /*!
  * CUDA global function for launching CudaKernel policies
  */
-template <typename Data, typename Exec>
-__global__ void CudaKernelLauncher(Data data)
+template <typename Args, typename Exec>
+__global__ void CudaKernelLauncher(Args args)
 {
 
-  using data_t = camp::decay<Data>;
-  data_t private_data = data;
+  using data_t = typename camp::decay<Args>::data_t;
+  data_t private_data(args);
 
   Exec::exec(private_data, true);
 }
@@ -212,13 +246,13 @@ __global__ void CudaKernelLauncher(Data data)
  *
  * This launcher is used by the CudaKerelFixed policies.
  */
-template <size_t BlockSize, size_t BlocksPerSM, typename Data, typename Exec>
+template <size_t BlockSize, size_t BlocksPerSM, typename Args, typename Exec>
 __launch_bounds__(BlockSize, BlocksPerSM) __global__
-    void CudaKernelLauncherFixed(Data data)
+    void CudaKernelLauncherFixed(Args args)
 {
 
-  using data_t = camp::decay<Data>;
-  data_t private_data = data;
+  using data_t = typename camp::decay<Args>::data_t;
+  data_t private_data(args);
 
   // execute the the object
   Exec::exec(private_data, true);
@@ -279,9 +313,13 @@ struct CudaLaunchHelper<cuda_explicit_launch<async0, num_blocks, num_threads, bl
 
   static constexpr bool async = async0;
 
-  using executor_t = internal::cuda_statement_list_executor_t<StmtList, Data, Types>;
+  // the kernel argument and the data the statements run on in the kernel
+  using args_t = internal::LoopDataArgs<Data>;
+  using device_data_t = typename args_t::data_t;
 
-  using kernelGetter_t = CudaKernelLauncherGetter<(num_threads <= 0) ? 0 : num_threads, (blocks_per_sm <= 0) ? 0 : blocks_per_sm, Data, executor_t>;
+  using executor_t = internal::cuda_statement_list_executor_t<StmtList, device_data_t, Types>;
+
+  using kernelGetter_t = CudaKernelLauncherGetter<(num_threads <= 0) ? 0 : num_threads, (blocks_per_sm <= 0) ? 0 : blocks_per_sm, args_t, executor_t>;
 
   inline static void recommended_blocks_threads(int shmem_size,
       size_t &recommended_blocks, size_t &recommended_threads)
@@ -398,7 +436,17 @@ struct CudaLaunchHelper<cuda_explicit_launch<async0, num_blocks, num_threads, bl
     }
   }
 
-  static void launch(Data &&data,
+  //! blocks of actual_threads threads that can be resident at once
+  inline static void resident_blocks(int shmem_size,
+      size_t &resident_blocks, size_t actual_threads)
+  {
+    auto func = kernelGetter_t::get();
+
+    internal::cuda_occupancy_max_blocks<Self>(
+        func, shmem_size, resident_blocks, actual_threads);
+  }
+
+  static void launch(args_t &&data,
                      internal::LaunchDims launch_dims,
                      size_t shmem,
                      RAJA::resources::Cuda res)
@@ -406,7 +454,11 @@ struct CudaLaunchHelper<cuda_explicit_launch<async0, num_blocks, num_threads, bl
     auto func = kernelGetter_t::get();
 
     void *args[] = {(void*)&data};
-    RAJA::cuda::launch((const void*)func, launch_dims.blocks, launch_dims.threads, args, shmem, res, async);
+    if (launch_dims.grid_sync) {
+      RAJA::cuda::launch_cooperative((const void*)func, launch_dims.blocks, launch_dims.threads, args, shmem, res, async);
+    } else {
+      RAJA::cuda::launch((const void*)func, launch_dims.blocks, launch_dims.threads, args, shmem, res, async);
+    }
   }
 };
 
@@ -503,9 +555,10 @@ struct StatementExecutor<
     if (num_blocks > 0 || num_threads > 0) {
 
       //
-      // Setup shared memory buffers
+      // Setup shared memory buffers, the dynamic shared memory requested
+      // by the enclosed statements
       //
-      int shmem = 0;
+      int shmem = static_cast<int>(launch_dims.shmem);
 
 
       //
@@ -588,12 +641,30 @@ struct StatementExecutor<
         RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num threads");
       }
 
+      //
+      // A kernel that synchronizes its grid is launched cooperatively, which
+      // runs all of its blocks at once, so it runs no more blocks than can
+      // be resident at once
+      //
+      if (launch_dims.grid_sync) {
+        size_t resident_blocks;
+        launch_t::resident_blocks(shmem, resident_blocks, launch_dims.num_threads());
+
+        launch_dims.blocks = fitCudaDims(
+            resident_blocks, launch_dims.blocks, launch_dims.min_blocks);
+        if (launch_dims.num_blocks() > static_cast<size_t>(resident_blocks)) {
+          RAJA_ABORT_OR_THROW("RAJA::kernel grid sync needs more blocks than can be resident");
+        }
+      }
+
       {
         //
-        // Privatize the LoopData, using make_launch_body to setup reductions
+        // Privatize the kernel arguments of the LoopData, using
+        // make_launch_body to setup reductions
         //
         auto cuda_data = RAJA::cuda::make_launch_body(
-            launch_dims.blocks, launch_dims.threads, shmem, res, data);
+            launch_dims.blocks, launch_dims.threads, shmem, res,
+            typename launch_t::args_t(data));
 
 
         //
@@ -0,0 +1,169 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for CUDA statement executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifndef RAJA_policy_cuda_kernel_ForRagged_HPP
+#define RAJA_policy_cuda_kernel_ForRagged_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/pattern/kernel/ForRagged.hpp"
+
+#include "RAJA/policy/cuda/kernel/internal.hpp"
+
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+
+/*
+ * Executor for a row of a ragged segment inside CudaKernel.
+ * Each thread loops over the positions of its own row.
+ * Assigns the positions to offset ArgumentId
+ */
+template <typename Data,
+          camp::idx_t ArgumentId,
+          camp::idx_t RowArgumentId,
+          typename... EnclosedStmts,
+          typename Types>
+struct CudaStatementExecutor<
+    Data,
+    statement::ForRagged<ArgumentId, RowArgumentId, seq_exec, EnclosedStmts...>,
+    Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  // Set the argument type for this loop
+  using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+  using enclosed_stmts_t =
+      CudaStatementListExecutor<Data, stmt_list_t, NewTypes>;
+
+  static
+  inline
+  RAJA_DEVICE
+  void exec(Data &data, bool thread_active)
+  {
+    // threads without a row have no positions
+    if (!thread_active) {
+      return;
+    }
+
+    auto positions = ragged_row_segment<ArgumentId, RowArgumentId>(data);
+    auto begin = *positions.begin();
+    auto end = *positions.end();
+
+    for (auto k = begin; k < end; ++k) {
+      // Assign the position to the argument
+      data.template assign_offset<ArgumentId>(k);
+
+      // execute enclosed statements
+      enclosed_stmts_t::exec(data, thread_active);
+    }
+  }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const &data)
+  {
+    return enclosed_stmts_t::calculateDimensions(data);
+  }
+};
+
+
+/*
+ * Executor for a row of a ragged segment inside CudaKernel.
+ * The lanes of a warp stride over the positions of the row of the warp.
+ * Assigns the positions to offset ArgumentId
+ */
+template <typename Data,
+          camp::idx_t ArgumentId,
+          camp::idx_t RowArgumentId,
+          typename... EnclosedStmts,
+          typename Types>
+struct CudaStatementExecutor<
+    Data,
+    statement::ForRagged<ArgumentId, RowArgumentId, RAJA::cuda_warp_loop, EnclosedStmts...>,
+    Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  // Set the argument type for this loop
+  using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+  using enclosed_stmts_t =
+      CudaStatementListExecutor<Data, stmt_list_t, NewTypes>;
+
+  static
+  inline RAJA_DEVICE void exec(Data &data, bool thread_active)
+  {
+    // the row is the same for all lanes of a warp, so an inactive warp
+    // skips its loop together
+    if (!thread_active) {
+      return;
+    }
+
+    auto positions = ragged_row_segment<ArgumentId, RowArgumentId>(data);
+    using pos_t = camp::decay<decltype(*positions.begin())>;
+    pos_t begin = *positions.begin();
+    pos_t end = *positions.end();
+    pos_t i_init = threadIdx.x;
+    pos_t i_stride = RAJA::policy::cuda::WARP_SIZE;
+
+    // warp stride loop, all lanes run the same number of steps
+    for (pos_t ii = begin; ii < end; ii += i_stride) {
+      pos_t k = ii + i_init;
+
+      // Assign the position to the argument
+      data.template assign_offset<ArgumentId>(k);
+
+      // execute enclosed statements, but mask off lanes past the row
+      enclosed_stmts_t::exec(data, k < end);
+    }
+  }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const &data)
+  {
+    // Get enclosed statements
+    LaunchDims dims = enclosed_stmts_t::calculateDimensions(data);
+
+    // we always get EXACTLY one warp by allocating one warp in the X dimension
+    int len = RAJA::policy::cuda::WARP_SIZE;
+
+    // request one thread per lane
+    set_cuda_dim<0>(dims.threads, len);
+
+    // since we are direct-mapping, we REQUIRE len
+    set_cuda_dim<0>(dims.min_threads, len);
+
+    return dims;
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_policy_cuda_kernel_ForRagged_HPP */
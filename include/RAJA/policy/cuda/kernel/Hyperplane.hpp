@@ -23,9 +23,12 @@
 #include <iostream>
 #include <type_traits>
 
+#include <cooperative_groups.h>
+
 #include "camp/camp.hpp"
 
 #include "RAJA/pattern/kernel/Hyperplane.hpp"
+#include "RAJA/policy/cuda/kernel/internal.hpp"
 
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -104,6 +107,92 @@ struct CudaStatementExecutor<Data,
 
 
 
+/*!
+ * Arrive at a synchronization of the whole grid and wait for every block of
+ * the kernel to arrive. Writes made by any block before it are visible to
+ * all blocks after it. Every thread of the kernel must call it the same
+ * number of times, and the kernel must be launched cooperatively.
+ */
+RAJA_DEVICE
+RAJA_INLINE
+void cuda_grid_sync()
+{
+  cooperative_groups::this_grid().sync();
+}
+
+/*!
+ * Hyperplanes run in order by all the blocks of the kernel.
+ *
+ * The enclosing loops over the Args must map each of their iterations to one
+ * thread with direct policies, so every thread sweeps the same hyperplanes
+ * and reaches the same grid synchronizations. They must cover whole
+ * segments rather than tiles, as the hyperplane of a point is computed from
+ * its offsets within the segments.
+ *
+ * The kernel is launched cooperatively, so all of its blocks run at once.
+ * The launch checks the resident block limit from the occupancy calculator
+ * before the kernel runs and aborts if the direct policies need more blocks,
+ * or if the device does not support cooperative launch.
+ */
+template <typename Data,
+          camp::idx_t HpArgumentId,
+          camp::idx_t... Args,
+          typename... EnclosedStmts,
+          typename Types>
+struct CudaStatementExecutor<Data,
+                             statement::Hyperplane<HpArgumentId,
+                                                   cuda_hyperplane_grid_sync,
+                                                   ArgList<Args...>,
+                                                   EnclosedStmts...>,
+                             Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  // Set the argument type for this loop
+  using NewTypes = setSegmentTypeFromData<Types, HpArgumentId, Data>;
+
+  using enclosed_stmts_t = CudaStatementListExecutor<Data, stmt_list_t, NewTypes>;
+
+  static
+  inline
+  RAJA_DEVICE
+  void exec(Data &data, bool thread_active)
+  {
+    int hp_len = segment_length<HpArgumentId>(data) +
+                 foldl(RAJA::operators::plus<int>(),
+                               segment_length<Args>(data)...);
+
+    int h_args = foldl(RAJA::operators::plus<idx_t>(),
+        camp::get<Args>(data.offset_tuple)...);
+
+    auto i_len = segment_length<HpArgumentId>(data);
+
+    for (int h = 0; h < hp_len; ++h) {
+
+      idx_t i = h - h_args;
+
+      data.template assign_offset<HpArgumentId>(i);
+      enclosed_stmts_t::exec(data, thread_active && (i >= 0 && i < i_len));
+
+      // the next hyperplane reads what every block wrote in this one
+      cuda_grid_sync();
+    }
+  }
+
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const &data)
+  {
+    LaunchDims dims = enclosed_stmts_t::calculateDimensions(data);
+    dims.grid_sync = true;
+    return dims;
+  }
+};
+
+
+
 
 }  // end namespace internal
 
@@ -35,6 +35,7 @@ namespace RAJA
 
 struct cuda_thread_mem;
 struct cuda_shared_mem;
+struct cuda_dynamic_shared_mem;
 
 namespace internal
 {
@@ -131,6 +132,98 @@ struct CudaStatementExecutor<Data,
 
 };
 
+//! The dynamic shared memory of the block
+RAJA_DEVICE RAJA_INLINE unsigned char* cuda_dynamic_shared_memory()
+{
+  extern __shared__ __align__(16) unsigned char raja_cuda_dynamic_shmem[];
+  return raja_cuda_dynamic_shmem;
+}
+
+//Intialize block shared arrays in dynamic shared memory
+//The launch allocates the bytes they need, so the block size does not have
+//to fit the static shared memory limit at compile time. Arrays of an
+//InitLocalMem nested in another using cuda_dynamic_shared_mem would overlap.
+template <typename Data, camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct CudaStatementExecutor<Data,
+                             statement::InitLocalMem<RAJA::cuda_dynamic_shared_mem,
+                             camp::idx_seq<Indices...>, EnclosedStmts...>,
+                             Types>
+{
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+  using enclosed_stmts_t = CudaStatementListExecutor<Data, stmt_list_t, Types>;
+
+  template<camp::idx_t Pos>
+  using array_t = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>;
+
+  //Bytes of an array, rounded up to keep the next one aligned
+  template<camp::idx_t Pos>
+  static
+  constexpr
+  RAJA_HOST_DEVICE
+  size_t arrayBytes()
+  {
+    return (sizeof(typename array_t<Pos>::value_type) *
+                array_t<Pos>::layout_type::s_size + 15) / 16 * 16;
+  }
+
+  static
+  constexpr
+  RAJA_HOST_DEVICE
+  size_t totalBytes()
+  {
+    size_t const bytes[] = {0, arrayBytes<Indices>()...};
+    size_t total = 0;
+    for (size_t b : bytes) {
+      total += b;
+    }
+    return total;
+  }
+
+  template<camp::idx_t Pos>
+  static
+  inline
+  RAJA_DEVICE
+  void setPtr(Data &data, unsigned char* shmem, size_t &offset)
+  {
+    using varType = typename array_t<Pos>::value_type;
+    camp::get<Pos>(data.param_tuple).set_data(
+        reinterpret_cast<varType*>(shmem + offset));
+    offset += arrayBytes<Pos>();
+  }
+
+
+  static
+  inline
+  RAJA_DEVICE
+  void exec(Data &data, bool thread_active)
+  {
+    unsigned char* shmem = cuda_dynamic_shared_memory();
+    size_t offset = 0;
+
+    //Intialize scoped arrays + launch loops
+    int set[] = {0, (setPtr<Indices>(data, shmem, offset), 0)...};
+    RAJA_UNUSED_VAR(set);
+
+    enclosed_stmts_t::exec(data, thread_active);
+
+    //set pointers in scoped arrays to null
+    int reset[] = {0, (camp::get<Indices>(data.param_tuple).set_data(nullptr), 0)...};
+    RAJA_UNUSED_VAR(reset);
+  }
+
+
+  inline
+  static
+  LaunchDims calculateDimensions(Data const &data)
+  {
+    LaunchDims dims = enclosed_stmts_t::calculateDimensions(data);
+    dims.shmem = std::max(dims.shmem, totalBytes());
+    return dims;
+  }
+
+};
+
 //Intialize thread private array
 template <typename Data, camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
 struct CudaStatementExecutor<Data, statement::InitLocalMem<RAJA::cuda_thread_mem, camp::idx_seq<Indices...>, EnclosedStmts...>, Types>
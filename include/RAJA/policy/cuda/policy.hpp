@@ -77,6 +77,24 @@ namespace cuda
 constexpr const size_t MIN_BLOCKS_PER_SM = 1;
 constexpr const size_t MAX_BLOCKS_PER_SM = 32;
 
+//! Registers of an SM, the same for compute capabilities 5.0 through 9.0
+constexpr const size_t REGISTERS_PER_SM = 65536;
+
+/*!
+ * Min blocks per SM to pass to __launch_bounds__ so the compiler keeps to
+ * about max_registers registers per thread in blocks of num_threads.
+ */
+constexpr size_t blocks_per_sm_for_registers(size_t num_threads,
+                                             size_t max_registers)
+{
+  return (num_threads == 0 || max_registers == 0 ||
+          REGISTERS_PER_SM / (num_threads * max_registers) < MIN_BLOCKS_PER_SM)
+             ? MIN_BLOCKS_PER_SM
+             : (REGISTERS_PER_SM / (num_threads * max_registers) > MAX_BLOCKS_PER_SM
+                    ? MAX_BLOCKS_PER_SM
+                    : REGISTERS_PER_SM / (num_threads * max_registers));
+}
+
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async = false>
 struct cuda_exec_explicit : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Policy::cuda,
@@ -85,6 +103,53 @@ struct cuda_exec_explicit : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Platform::cuda> {
 };
 
+//! values scanned by each thread of cuda_scan_exec
+constexpr const size_t SCAN_ITEMS_PER_THREAD = 4;
+
+/*!
+ * \brief Execution policy for scans using a native single pass decoupled
+ *        look-back scan, each thread scans ITEMS_PER_THREAD values.
+ *
+ * Other patterns run as with cuda_exec.
+ */
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD, bool Async = false>
+struct cuda_scan_exec_explicit
+    : public cuda_exec_explicit<BLOCK_SIZE, MIN_BLOCKS_PER_SM, Async> {
+};
+
+/*!
+ * \brief Policy of a RAJA::kernel Hyperplane statement whose hyperplanes are
+ *        run in order by all the blocks of the kernel, with the grid
+ *        synchronized between hyperplanes.
+ *
+ * All the blocks of the kernel must be resident at once, so the kernel is
+ * launched with no more blocks than the device can hold.
+ */
+struct cuda_hyperplane_grid_sync
+    : public RAJA::make_policy_pattern_launch_platform_t<
+          RAJA::Policy::cuda,
+          RAJA::Pattern::forall,
+          detail::get_launch<false>::value,
+          RAJA::Platform::cuda> {
+};
+
+//! iterations run by each thread in each pass of cuda_exec_grid_stride
+constexpr const size_t GRID_STRIDE_ITEMS_PER_THREAD = 4;
+
+/*!
+ * \brief Execution policy for forall launching no more blocks than can be
+ *        resident at once, each thread runs ITEMS_PER_THREAD iterations in
+ *        each pass of a grid-stride loop.
+ *
+ * Other patterns run as with cuda_exec.
+ */
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD, size_t BLOCKS_PER_SM, bool Async = false>
+struct cuda_exec_grid_stride_explicit
+    : public cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> {
+  static_assert(ITEMS_PER_THREAD > 0,
+                "cuda_exec_grid_stride requires ITEMS_PER_THREAD > 0");
+};
+
 namespace expt
 {
 template <bool Async, int num_threads, size_t BLOCKS_PER_SM = policy::cuda::MIN_BLOCKS_PER_SM>
@@ -94,14 +159,38 @@ struct cuda_launch_explicit_t : public RAJA::make_policy_pattern_launch_platform
                                 detail::get_launch<Async>::value,
                                 RAJA::Platform::cuda> {
 };
+
+/*!
+ * \brief Launch policy for cooperative launches, whose teams are all
+ *        resident at once so LaunchContext::gridSync can synchronize them.
+ *
+ * The grid is limited to the teams the device can hold at once, so team
+ * loops should be block-stride loops such as cuda_block_x_loop.
+ */
+template <bool Async>
+struct cuda_launch_cooperative_t : public RAJA::make_policy_pattern_launch_platform_t<
+                                   RAJA::Policy::cuda,
+                                   RAJA::Pattern::region,
+                                   detail::get_launch<Async>::value,
+                                   RAJA::Platform::cuda> {
+};
 }
 
 
 
 
-//
-// NOTE: There is no Index set segment iteration policy for CUDA
-//
+///
+/// Index set segment iteration policy that runs all segments in one kernel
+/// launch, the segment execution policy must be a cuda_exec policy. Each
+/// thread finds its segment in a table of the segments copied to the device.
+///
+struct cuda_single_launch_segit
+    : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::balanced_segit,
+                       RAJA::Launch::undefined,
+                       RAJA::Platform::cuda> {
+};
 
 ///
 /// WorkGroup execution policies
@@ -121,6 +210,20 @@ struct unordered_cuda_loop_y_block_iter_x_threadblock_average
                        RAJA::Platform::cuda> {
 };
 
+struct unordered_cuda_persistent_block_queue
+    : public RAJA::make_policy_pattern_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::workgroup_order,
+                       RAJA::Platform::cuda> {
+};
+
+struct unordered_cuda_persistent_chunk_queue
+    : public RAJA::make_policy_pattern_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::workgroup_order,
+                       RAJA::Platform::cuda> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -151,6 +254,16 @@ struct cuda_atomic_explicit{};
 //
 using cuda_atomic = cuda_atomic_explicit<loop_atomic>;
 
+//
+// Cuda atomic policy that combines the values of the lanes of a warp that
+// update the same address before using cuda atomics on the device, and
+// uses the provided Policy on the host
+//
+template<typename host_policy>
+struct cuda_warp_atomic_explicit{};
+
+using cuda_warp_atomic = cuda_warp_atomic_explicit<loop_atomic>;
+
 using cuda_reduce = cuda_reduce_base<false>;
 
 using cuda_reduce_atomic = cuda_reduce_base<true>;
@@ -236,6 +349,29 @@ using cuda_exec = policy::cuda::cuda_exec_explicit<BLOCK_SIZE, policy::cuda::MIN
 template <size_t BLOCK_SIZE>
 using cuda_exec_async = policy::cuda::cuda_exec_explicit<BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, true>;
 
+using policy::cuda::cuda_hyperplane_grid_sync;
+
+using policy::cuda::cuda_exec_grid_stride_explicit;
+
+template <size_t BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD = policy::cuda::GRID_STRIDE_ITEMS_PER_THREAD,
+          bool ASYNC = false>
+using cuda_exec_grid_stride = policy::cuda::cuda_exec_grid_stride_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, policy::cuda::MIN_BLOCKS_PER_SM, ASYNC>;
+
+template <size_t BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD = policy::cuda::GRID_STRIDE_ITEMS_PER_THREAD>
+using cuda_exec_grid_stride_async = policy::cuda::cuda_exec_grid_stride_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, policy::cuda::MIN_BLOCKS_PER_SM, true>;
+
+using policy::cuda::cuda_single_launch_segit;
+
+using policy::cuda::cuda_scan_exec_explicit;
+
+template <size_t BLOCK_SIZE, bool ASYNC = false>
+using cuda_scan_exec = policy::cuda::cuda_scan_exec_explicit<BLOCK_SIZE, policy::cuda::SCAN_ITEMS_PER_THREAD, ASYNC>;
+
+template <size_t BLOCK_SIZE>
+using cuda_scan_exec_async = policy::cuda::cuda_scan_exec_explicit<BLOCK_SIZE, policy::cuda::SCAN_ITEMS_PER_THREAD, true>;
+
 using policy::cuda::cuda_work_explicit;
 
 template <size_t BLOCK_SIZE, bool ASYNC = false>
@@ -245,9 +381,13 @@ template <size_t BLOCK_SIZE>
 using cuda_work_async = policy::cuda::cuda_work_explicit<BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, true>;
 
 using policy::cuda::unordered_cuda_loop_y_block_iter_x_threadblock_average;
+using policy::cuda::unordered_cuda_persistent_block_queue;
+using policy::cuda::unordered_cuda_persistent_chunk_queue;
 
 using policy::cuda::cuda_atomic;
 using policy::cuda::cuda_atomic_explicit;
+using policy::cuda::cuda_warp_atomic;
+using policy::cuda::cuda_warp_atomic_explicit;
 
 using policy::cuda::cuda_reduce_base;
 using policy::cuda::cuda_reduce;
@@ -272,6 +412,8 @@ namespace expt
   // num_threads defaults to 1, but not expected to be used in kernel launch
   template <bool Async, int num_threads = 1>
   using cuda_launch_t = policy::cuda::expt::cuda_launch_explicit_t<Async, num_threads, policy::cuda::MIN_BLOCKS_PER_SM>;
+
+  using policy::cuda::expt::cuda_launch_cooperative_t;
 }
 
 
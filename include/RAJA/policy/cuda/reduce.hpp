@@ -25,7 +25,11 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <cuda.h>
 
@@ -38,6 +42,7 @@
 
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
+#include "RAJA/pattern/params/reduce.hpp"
 
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 
@@ -474,6 +479,23 @@ RAJA_DEVICE RAJA_INLINE T block_reduce(T val, T identity)
 }
 
 
+//! reduce values in a grid of one block into thread 0
+//  returns true if put reduced value in val
+template <typename Combiner, typename T>
+RAJA_DEVICE RAJA_INLINE bool single_block_reduce(T& val, T identity)
+{
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  T temp = block_reduce<Combiner>(val, identity);
+
+  if (threadId == 0) {
+    val = temp;
+  }
+
+  return threadId == 0;
+}
+
 //! reduce values in grid into thread 0 of last running block
 //  returns true if put reduced value in val
 template <typename Combiner, typename T, typename TempIterator>
@@ -578,6 +600,186 @@ RAJA_DEVICE RAJA_INLINE bool grid_reduce_atomic(T& val,
 
 }  // namespace impl
 
+namespace detail
+{
+
+//! Object that hands out reducer result slots from contiguous pinned chunks
+//  shared by every PinnedTally created while a ReduceTallyBatch is active
+class PinnedTallyBatch : public std::enable_shared_from_this<PinnedTallyBatch>
+{
+public:
+  static const size_t chunk_bytes = 16 * 1024;
+  static const size_t slot_alignment = alignof(std::max_align_t);
+
+  PinnedTallyBatch() = default;
+
+  PinnedTallyBatch(const PinnedTallyBatch&) = delete;
+
+  ~PinnedTallyBatch()
+  {
+    for (char* chunk : m_chunks) {
+      cuda::pinned_mempool_type::getInstance().free(chunk);
+    }
+  }
+
+  //! get a slot of at least nbytes, reusing a released slot if possible
+  void* allocate(size_t nbytes)
+  {
+    nbytes = slot_size(nbytes);
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (free_slots& fs : m_free_slots) {
+      if (fs.nbytes == nbytes && fs.head) {
+        void* ptr = fs.head;
+        fs.head = *static_cast<void**>(ptr);
+        return ptr;
+      }
+    }
+    if (m_chunks.empty() || m_offset + nbytes > m_chunk_bytes) {
+      m_chunk_bytes =
+          nbytes > size_t(chunk_bytes) ? nbytes : size_t(chunk_bytes);
+      m_chunks.push_back(
+          cuda::pinned_mempool_type::getInstance().template malloc<char>(
+              m_chunk_bytes, size_t(slot_alignment)));
+      m_offset = 0;
+    }
+    void* ptr = m_chunks.back() + m_offset;
+    m_offset += nbytes;
+    return ptr;
+  }
+
+  //! return a slot to the batch, the slot is reused by later allocations
+  void deallocate(void* ptr, size_t nbytes)
+  {
+    nbytes = slot_size(nbytes);
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (free_slots& fs : m_free_slots) {
+      if (fs.nbytes == nbytes) {
+        *static_cast<void**>(ptr) = fs.head;
+        fs.head = ptr;
+        return;
+      }
+    }
+    *static_cast<void**>(ptr) = nullptr;
+    m_free_slots.push_back(free_slots{nbytes, ptr});
+  }
+
+  //! remember a resource that results in this batch are written on
+  void add_resource(::RAJA::resources::Cuda res)
+  {
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (::RAJA::resources::Cuda& r : m_resources) {
+      if (r.get_stream() == res.get_stream()) return;
+    }
+    m_resources.push_back(res);
+  }
+
+  //! synchronize every resource used by reducers in this batch
+  void synchronize_resources()
+  {
+    std::vector<::RAJA::resources::Cuda> resources;
+    {
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+      lock_guard<omp::mutex> lock(m_mutex);
+#endif
+      resources = m_resources;
+    }
+    for (::RAJA::resources::Cuda& r : resources) {
+      ::RAJA::cuda::synchronize(r);
+    }
+  }
+
+private:
+  //! list of released slots of a given size, linked through the slots
+  struct free_slots {
+    size_t nbytes;
+    void* head;
+  };
+
+  static size_t slot_size(size_t nbytes)
+  {
+    if (nbytes < sizeof(void*)) nbytes = sizeof(void*);
+    return (nbytes + size_t(slot_alignment) - 1) / size_t(slot_alignment) *
+           size_t(slot_alignment);
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+  omp::mutex m_mutex;
+#endif
+  std::vector<char*> m_chunks;
+  size_t m_offset = 0;
+  size_t m_chunk_bytes = 0;
+  std::vector<free_slots> m_free_slots;
+  std::vector<::RAJA::resources::Cuda> m_resources;
+};
+
+//! get the batch new reducers on this thread take result slots from
+RAJA_INLINE
+PinnedTallyBatch* currentTallyBatch() { return tl_status.tally_batch; }
+
+//! events from each resource a reducer was used on, usable as a camp Event
+struct ReduceEvents {
+  std::vector<::RAJA::resources::Event> events;
+
+  bool check() const
+  {
+    for (auto const& e : events) {
+      if (!e.check()) return false;
+    }
+    return true;
+  }
+
+  void wait() const
+  {
+    for (auto const& e : events) {
+      e.wait();
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Scope object that batches the pinned result buffers of reducers.
+ *
+ *         Reducers constructed on this thread while the object is alive get
+ *         their result slots from one contiguous pinned buffer instead of
+ *         individual pinned_mempool_type allocations, and all of their
+ *         resources may be synchronized at once with synchronize() before
+ *         the results are read. Batches nest, the innermost one is used.
+ *
+ ******************************************************************************
+ */
+class ReduceTallyBatch
+{
+public:
+  ReduceTallyBatch()
+      : m_batch(std::make_shared<detail::PinnedTallyBatch>()),
+        m_prev(detail::tl_status.tally_batch)
+  {
+    detail::tl_status.tally_batch = m_batch.get();
+  }
+
+  ReduceTallyBatch(const ReduceTallyBatch&) = delete;
+  ReduceTallyBatch& operator=(const ReduceTallyBatch&) = delete;
+
+  ~ReduceTallyBatch() { detail::tl_status.tally_batch = m_prev; }
+
+  //! synchronize every resource used by reducers in this batch
+  void synchronize() { m_batch->synchronize_resources(); }
+
+private:
+  std::shared_ptr<detail::PinnedTallyBatch> m_batch;
+  detail::PinnedTallyBatch* m_prev;
+};
+
 //! Object that manages pinned memory buffers for reduction results
 //  use one per reducer object
 template <typename T>
@@ -594,6 +796,10 @@ public:
     ResourceNode* next;
     ::RAJA::resources::Cuda res;
     Node* node_list;
+    //! marks the point in res after which node_list values are complete
+    cudaEvent_t event;
+    //! event was recorded after the last value was added
+    bool event_recorded;
   };
 
   //! Iterator over resources used by reducer
@@ -679,7 +885,13 @@ public:
     Node* m_n;
   };
 
-  PinnedTally() : resource_list(nullptr) {}
+  PinnedTally()
+      : resource_list(nullptr),
+        m_batch(detail::currentTallyBatch()
+                    ? detail::currentTallyBatch()->shared_from_this()
+                    : nullptr)
+  {
+  }
 
   PinnedTally(const PinnedTally&) = delete;
 
@@ -714,23 +926,66 @@ public:
       rn->next = resource_list;
       rn->res = res;
       rn->node_list = nullptr;
+      rn->event = nullptr;
       resource_list = rn;
     }
-    Node* n = cuda::pinned_mempool_type::getInstance().template malloc<Node>(1);
+    rn->event_recorded = false;
+    Node* n;
+    if (m_batch) {
+      m_batch->add_resource(res);
+      n = static_cast<Node*>(m_batch->allocate(sizeof(Node)));
+    } else {
+      n = cuda::pinned_mempool_type::getInstance().template malloc<Node>(1);
+    }
     n->next = rn->node_list;
     rn->node_list = n;
     return &n->value;
   }
 
   //! synchronize all resources used
+  //  only waits for work up to the last record_events() when it is current
   void synchronize_resources()
   {
-    auto end = resourceEnd();
-    for (auto r = resourceBegin(); r != end; ++r) {
-      ::RAJA::cuda::synchronize(*r);
+    for (ResourceNode* rn = resource_list; rn; rn = rn->next) {
+      if (rn->event_recorded) {
+        cudaErrchk(cudaEventSynchronize(rn->event));
+      } else {
+        ::RAJA::cuda::synchronize(rn->res);
+      }
+    }
+  }
+
+  //! mark the current end of work in every resource used
+  //  later synchronize_resources() calls wait for this point only
+  void record_events()
+  {
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (ResourceNode* rn = resource_list; rn; rn = rn->next) {
+      if (!rn->event) {
+        cudaErrchk(
+            cudaEventCreateWithFlags(&rn->event, cudaEventDisableTiming));
+      }
+      cudaErrchk(cudaEventRecord(rn->event, rn->res.get_stream()));
+      rn->event_recorded = true;
     }
   }
 
+  //! check without blocking if the work synchronize_resources() would wait
+  //  for has completed
+  bool resources_complete()
+  {
+    for (ResourceNode* rn = resource_list; rn; rn = rn->next) {
+      cudaError_t err = rn->event_recorded
+                            ? cudaEventQuery(rn->event)
+                            : cudaStreamQuery(rn->res.get_stream());
+      if (err == cudaErrorNotReady) return false;
+      cudaErrchk(err);
+    }
+    return true;
+  }
+
   //! all values used in all resources
   void free_list()
   {
@@ -739,9 +994,16 @@ public:
       while (rn->node_list) {
         Node* n = rn->node_list;
         rn->node_list = n->next;
-        cuda::pinned_mempool_type::getInstance().free(n);
+        if (m_batch) {
+          m_batch->deallocate(n, sizeof(Node));
+        } else {
+          cuda::pinned_mempool_type::getInstance().free(n);
+        }
       }
       resource_list = rn->next;
+      if (rn->event) {
+        cudaErrchk(cudaEventDestroy(rn->event));
+      }
       free(rn);
     }
   }
@@ -754,6 +1016,8 @@ public:
 
 private:
   ResourceNode* resource_list;
+  //! batch the nodes are allocated from, or null for pinned_mempool_type
+  std::shared_ptr<detail::PinnedTallyBatch> m_batch;
 };
 
 //
@@ -774,6 +1038,10 @@ struct Reduce_Data {
   unsigned int* device_count;
   RAJA::detail::SoAPtr<T, device_mempool_type> device;
   bool own_device_ptr;
+  //! launch has one block, reduce in the block without device memory
+  bool single_block;
+  //! stream the device pointers are used on, they are freed in stream order
+  cudaStream_t device_stream;
 
   Reduce_Data() : Reduce_Data(T(), T()){};
 
@@ -787,7 +1055,9 @@ struct Reduce_Data {
         identity{identity_},
         device_count{nullptr},
         device{},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        single_block{false},
+        device_stream{nullptr}
   {
   }
 
@@ -797,6 +1067,7 @@ struct Reduce_Data {
     identity = identity_;
     device_count = nullptr;
     own_device_ptr = false;
+    single_block = false;
   }
 
   RAJA_HOST_DEVICE
@@ -805,7 +1076,9 @@ struct Reduce_Data {
         identity{other.identity},
         device_count{other.device_count},
         device{other.device},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        single_block{other.single_block},
+        device_stream{other.device_stream}
   {
   }
 
@@ -821,23 +1094,34 @@ struct Reduce_Data {
   {
     T temp = value;
 
-    if (impl::grid_reduce<Combiner>(temp, identity, device, device_count)) {
+    if (single_block) {
+      if (impl::single_block_reduce<Combiner>(temp, identity)) {
+        *output = temp;
+      }
+    } else if (impl::grid_reduce<Combiner>(
+                   temp, identity, device, device_count)) {
       *output = temp;
     }
   }
 
   //! check and setup for device
   //  allocate device pointers and get a new result buffer from the pinned tally
+  //  launches of one block write the result directly and allocate nothing
   bool setupForDevice()
   {
-    bool act = !device.allocated() && setupReducers();
+    bool act = !device.allocated() && !single_block && setupReducers();
     if (act) {
       cuda_dim_t gridDim = currentGridDim();
       size_t numBlocks = gridDim.x * gridDim.y * gridDim.z;
-      device.allocate(numBlocks);
-      device_count = device_zeroed_mempool_type::getInstance()
-                         .template malloc<unsigned int>(1);
-      own_device_ptr = true;
+      device_stream = currentResource()->get_stream();
+      if (numBlocks == 1) {
+        single_block = true;
+      } else {
+        device.allocate(numBlocks, device_stream);
+        device_count = device_zeroed_mempool_type::getInstance()
+                           .template stream_malloc<unsigned int>(1, device_stream);
+        own_device_ptr = true;
+      }
     }
     return act;
   }
@@ -848,8 +1132,9 @@ struct Reduce_Data {
   {
     bool act = own_device_ptr;
     if (act) {
-      device.deallocate();
-      device_zeroed_mempool_type::getInstance().free(device_count);
+      device.deallocate(device_stream);
+      device_zeroed_mempool_type::getInstance().stream_free(device_count,
+                                                            device_stream);
       device_count = nullptr;
       own_device_ptr = false;
     }
@@ -867,6 +1152,10 @@ struct ReduceAtomic_Data {
   unsigned int* device_count;
   T* device;
   bool own_device_ptr;
+  //! launch has one block, reduce in the block without device memory
+  bool single_block;
+  //! stream the device pointers are used on, they are freed in stream order
+  cudaStream_t device_stream;
 
   ReduceAtomic_Data() : ReduceAtomic_Data(T(), T()){};
 
@@ -875,7 +1164,9 @@ struct ReduceAtomic_Data {
         identity{identity_},
         device_count{nullptr},
         device{nullptr},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        single_block{false},
+        device_stream{nullptr}
   {
   }
 
@@ -886,6 +1177,7 @@ struct ReduceAtomic_Data {
     device_count = nullptr;
     device = nullptr;
     own_device_ptr = false;
+    single_block = false;
   }
 
   RAJA_HOST_DEVICE
@@ -894,7 +1186,9 @@ struct ReduceAtomic_Data {
         identity{other.identity},
         device_count{other.device_count},
         device{other.device},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        single_block{other.single_block},
+        device_stream{other.device_stream}
   {
   }
 
@@ -910,22 +1204,35 @@ struct ReduceAtomic_Data {
   {
     T temp = value;
 
-    if (impl::grid_reduce_atomic<Combiner>(
-            temp, identity, device, device_count)) {
+    if (single_block) {
+      if (impl::single_block_reduce<Combiner>(temp, identity)) {
+        *output = temp;
+      }
+    } else if (impl::grid_reduce_atomic<Combiner>(
+                   temp, identity, device, device_count)) {
       *output = temp;
     }
   }
 
   //! check and setup for device
   //  allocate device pointers and get a new result buffer from the pinned tally
+  //  launches of one block write the result directly and allocate nothing
   bool setupForDevice()
   {
-    bool act = !device && setupReducers();
+    bool act = !device && !single_block && setupReducers();
     if (act) {
-      device = device_mempool_type::getInstance().template malloc<T>(1);
-      device_count = device_zeroed_mempool_type::getInstance()
-                         .template malloc<unsigned int>(1);
-      own_device_ptr = true;
+      cuda_dim_t gridDim = currentGridDim();
+      size_t numBlocks = gridDim.x * gridDim.y * gridDim.z;
+      device_stream = currentResource()->get_stream();
+      if (numBlocks == 1) {
+        single_block = true;
+      } else {
+        device = device_mempool_type::getInstance()
+                     .template stream_malloc<T>(1, device_stream);
+        device_count = device_zeroed_mempool_type::getInstance()
+                           .template stream_malloc<unsigned int>(1, device_stream);
+        own_device_ptr = true;
+      }
     }
     return act;
   }
@@ -936,9 +1243,10 @@ struct ReduceAtomic_Data {
   {
     bool act = own_device_ptr;
     if (act) {
-      device_mempool_type::getInstance().free(device);
+      device_mempool_type::getInstance().stream_free(device, device_stream);
       device = nullptr;
-      device_zeroed_mempool_type::getInstance().free(device_count);
+      device_zeroed_mempool_type::getInstance().stream_free(device_count,
+                                                            device_stream);
       device_count = nullptr;
       own_device_ptr = false;
     }
@@ -1040,6 +1348,30 @@ public:
   //! alias for operator T()
   T get() { return operator T(); }
 
+  /*!
+   * \brief Get an event that completes when the reduced value is available.
+   *
+   * Does not block. The returned event covers the work launched so far on
+   * every resource this reducer was used on, and a later get() waits only
+   * for that work, so other work may be launched on the same resources
+   * before the value is read.
+   */
+  ::RAJA::resources::Event get_event()
+  {
+    tally_or_val_ptr.list->record_events();
+    detail::ReduceEvents events;
+    auto end = tally_or_val_ptr.list->resourceEnd();
+    for (auto r = tally_or_val_ptr.list->resourceBegin(); r != end; ++r) {
+      events.events.push_back((*r).get_event());
+    }
+    return ::RAJA::resources::Event{std::move(events)};
+  }
+
+  //! check without blocking if the reduced value is available, covers the
+  //  work launched up to the last get_event() if it was called since
+  //  the reducer was last used
+  bool ready() { return tally_or_val_ptr.list->resources_complete(); }
+
   //! apply reduction (const version) -- still combines internal values
   RAJA_HOST_DEVICE
   void combine(T other) const { Combiner{}(val.value, other); }
@@ -1047,6 +1379,7 @@ public:
   /*!
    *  \return reference to the local value
    */
+  RAJA_HOST_DEVICE
   T& local() const { return val.value; }
 
   T get_combined() const { return val.value; }
@@ -1194,6 +1527,15 @@ public:
     return *this;
   }
 
+  //! reducer function taking the components of a tuple IndexType
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  RAJA_HOST_DEVICE
+  const ReduceMinLoc& minloc(T rhs, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    this->combine(value_type(rhs, IndexType(i0, i1, is...)));
+    return *this;
+  }
+
   //! Get the calculated reduced value
   IndexType getLoc() { return Base::get().getLoc(); }
 
@@ -1231,6 +1573,15 @@ public:
     return *this;
   }
 
+  //! reducer function taking the components of a tuple IndexType
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  RAJA_HOST_DEVICE
+  const ReduceMaxLoc& maxloc(T rhs, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    this->combine(value_type(rhs, IndexType(i0, i1, is...)));
+    return *this;
+  }
+
   //! Get the calculated reduced value
   IndexType getLoc() { return Base::get().getLoc(); }
 
@@ -1241,6 +1592,52 @@ public:
   T get() { return Base::get(); }
 };
 
+//! specialization of ReduceMulti for cuda_reduce
+//  all values are combined in one block reduction and copied back together
+template <bool maybe_atomic, typename T>
+class ReduceMulti<cuda_reduce_base<maybe_atomic>, T>
+    : public cuda::Reduce<RAJA::reduce::multi<T>, T, maybe_atomic>
+{
+public:
+  using Base = cuda::Reduce<RAJA::reduce::multi<T>, T, maybe_atomic>;
+  using Base::Base;
+
+  //! reducer function; combines one value into each reduction, in order
+  template <typename... Args>
+  RAJA_HOST_DEVICE
+  const ReduceMulti& reduce(Args const&... args) const
+  {
+    this->combine(T(args...));
+    return *this;
+  }
+
+  //! Get the calculated Ith reduced value
+  template <camp::idx_t I>
+  typename T::template element_type<I> get()
+  {
+    return Base::get().template get<I>();
+  }
+
+  //! Get all of the calculated reduced values
+  T get() { return Base::get(); }
+};
+
+namespace expt
+{
+namespace detail
+{
+
+//! reduction parameters of cuda loops are lowered onto cuda_reduce reducers
+template <typename ExecPol>
+struct param_reduce_policy<
+    ExecPol,
+    typename std::enable_if<type_traits::is_cuda_policy<ExecPol>::value>::type> {
+  using type = cuda_reduce;
+};
+
+}  // namespace detail
+}  // namespace expt
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_CUDA guard
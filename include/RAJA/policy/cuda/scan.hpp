@@ -22,17 +22,396 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include <cstring>
 #include <iterator>
 #include <type_traits>
 
 #include "cub/device/device_scan.cuh"
 #include "cub/util_allocator.cuh"
 
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
 
 namespace RAJA
 {
+
+namespace cuda
+{
+
+namespace impl
+{
+
+//! state of a tile in the look-back scan
+enum lookback_status : unsigned int {
+  lookback_invalid = 0,    //!< nothing published yet
+  lookback_aggregate = 1,  //!< sum of the tile published
+  lookback_prefix = 2      //!< sum of the tile and all tiles before published
+};
+
+/*!
+ * \brief Per tile state of the look-back scan in device memory.
+ *
+ * The counter and flags are zeroed before each launch, the sums of a tile
+ * are only read after its flag says they are published.
+ */
+template <typename T>
+struct LookbackTiles {
+  unsigned int* counter;
+  unsigned int* flags;
+  T* aggregates;
+  T* prefixes;
+
+  //! bytes of the counter and flags, which are zeroed before a launch
+  static size_t zeroed_bytes(size_t num_tiles)
+  {
+    return sizeof(unsigned int) * (num_tiles + 1);
+  }
+
+  //! bytes of the counter and flags padded to the alignment of the sums
+  static size_t flag_bytes(size_t num_tiles)
+  {
+    const size_t align = alignof(T) > 16 ? alignof(T) : 16;
+    return (zeroed_bytes(num_tiles) + align - 1) / align * align;
+  }
+
+  static size_t storage_bytes(size_t num_tiles)
+  {
+    return flag_bytes(num_tiles) + 2 * num_tiles * sizeof(T);
+  }
+
+  static LookbackTiles make(void* storage, size_t num_tiles)
+  {
+    unsigned char* bytes = static_cast<unsigned char*>(storage);
+    T* sums = reinterpret_cast<T*>(bytes + flag_bytes(num_tiles));
+    unsigned int* words = static_cast<unsigned int*>(storage);
+    return LookbackTiles{words, words + 1, sums, sums + num_tiles};
+  }
+};
+
+//! bytes of static shared memory the look-back scan kernel may use
+constexpr size_t lookback_shmem_bytes = 48ull * 1024ull;
+
+/*!
+ * \brief Items per thread of a look-back scan of T values with BlockSize
+ *        threads, at most MaxItemsPerThread.
+ *
+ * The tile, the thread sums and the tile prefix are held in static shared
+ * memory, so large types or blocks scan fewer items per thread to stay
+ * within lookback_shmem_bytes. It is 0 when even one item per thread does
+ * not fit.
+ */
+template <typename T, size_t BlockSize, size_t MaxItemsPerThread>
+struct lookback_items_per_thread {
+  // the thread sums, tile prefix and tile id with room for alignment
+  static constexpr size_t fixed_bytes =
+      sizeof(T) * (BlockSize + 1) + 2 * alignof(T) + sizeof(unsigned int);
+  static constexpr size_t max_fit =
+      fixed_bytes < lookback_shmem_bytes
+          ? (lookback_shmem_bytes - fixed_bytes) / (sizeof(T) * BlockSize)
+          : 0;
+  static constexpr size_t value =
+      max_fit < MaxItemsPerThread ? max_fit : MaxItemsPerThread;
+};
+
+//! whether the look-back scan can scan T values with BlockSize threads
+template <typename T, size_t BlockSize>
+using lookback_scan_fits = std::integral_constant<
+    bool,
+    (lookback_items_per_thread<T, BlockSize, 1>::value > 0)>;
+
+/*!
+ * \brief load a value published by another block
+ *
+ * The value is read with volatile loads so it does not come from the non
+ * coherent L1 cache. T must be trivially copyable.
+ */
+template <typename T>
+RAJA_DEVICE RAJA_INLINE T lookback_load(T const* ptr)
+{
+  using word = typename std::conditional<
+      sizeof(T) % sizeof(unsigned int) == 0 &&
+          alignof(T) % alignof(unsigned int) == 0,
+      unsigned int,
+      unsigned char>::type;
+  constexpr size_t num_words = sizeof(T) / sizeof(word);
+  word words[num_words];
+  volatile word const* src = reinterpret_cast<volatile word const*>(ptr);
+  for (size_t w = 0; w < num_words; ++w) {
+    words[w] = src[w];
+  }
+  T val;
+  memcpy(&val, words, sizeof(T));
+  return val;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernel for a single pass scan with decoupled look-back.
+ *
+ *         Each block scans a tile of BlockSize * ItemsPerThread values,
+ *         which must fit in shared memory, see lookback_items_per_thread.
+ *         Tiles are numbered in the order blocks start, so the tiles a block
+ *         waits for belong to blocks that are already running. A block
+ *         publishes the sum of its tile, then finds the sum of the tiles
+ *         before it by walking back over the published sums until it finds
+ *         a tile that published its full prefix, and then publishes its own
+ *         prefix. The input is read and the output written once.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          size_t ItemsPerThread,
+          bool Exclusive,
+          typename InputIter,
+          typename OutputIter,
+          typename IndexType,
+          typename Function,
+          typename T>
+__launch_bounds__(BlockSize, 1) __global__
+    void lookback_scan_kernel(InputIter in,
+                              OutputIter out,
+                              IndexType len,
+                              Function f,
+                              T init,
+                              LookbackTiles<T> tiles)
+{
+  constexpr IndexType tile_size =
+      static_cast<IndexType>(BlockSize * ItemsPerThread);
+
+  __shared__ typename std::aligned_storage<sizeof(T) * tile_size,
+                                           alignof(T)>::type items_storage;
+  __shared__ typename std::aligned_storage<sizeof(T) * BlockSize,
+                                           alignof(T)>::type sums_storage;
+  __shared__ typename std::aligned_storage<sizeof(T), alignof(T)>::type
+      prefix_storage;
+  __shared__ unsigned int tile_id;
+  T* items = reinterpret_cast<T*>(&items_storage);
+  T* sums = reinterpret_cast<T*>(&sums_storage);
+  T* prefix = reinterpret_cast<T*>(&prefix_storage);
+
+  const IndexType tid = static_cast<IndexType>(threadIdx.x);
+  if (tid == 0) {
+    tile_id = atomicAdd(tiles.counter, 1u);
+  }
+  __syncthreads();
+  const unsigned int tile = tile_id;
+  const IndexType tile_begin = static_cast<IndexType>(tile) * tile_size;
+  const IndexType tile_len =
+      (len - tile_begin < tile_size) ? len - tile_begin : tile_size;
+
+  // load with neighboring threads reading neighboring values
+  for (IndexType k = 0; k < static_cast<IndexType>(ItemsPerThread); ++k) {
+    const IndexType idx = k * static_cast<IndexType>(BlockSize) + tid;
+    if (idx < tile_len) {
+      items[idx] = in[tile_begin + idx];
+    }
+  }
+  __syncthreads();
+
+  // each thread owns ItemsPerThread consecutive values of the tile
+  const IndexType first = tid * static_cast<IndexType>(ItemsPerThread);
+  T thread_sum = Function::identity();
+  for (IndexType k = 0; k < static_cast<IndexType>(ItemsPerThread); ++k) {
+    if (first + k < tile_len) {
+      thread_sum = f(thread_sum, items[first + k]);
+    }
+  }
+
+  // inclusive scan of the thread sums
+  sums[tid] = thread_sum;
+  __syncthreads();
+  for (IndexType offset = 1; offset < static_cast<IndexType>(BlockSize);
+       offset *= 2) {
+    T val = sums[tid];
+    if (tid >= offset) {
+      val = f(sums[tid - offset], val);
+    }
+    __syncthreads();
+    sums[tid] = val;
+    __syncthreads();
+  }
+  const T thread_prefix =
+      (tid > 0) ? sums[tid - 1] : static_cast<T>(Function::identity());
+
+  if (tid == 0) {
+    volatile unsigned int* flags = tiles.flags;
+    const T tile_sum = sums[BlockSize - 1];
+    T tile_prefix = init;
+    if (tile > 0) {
+      tiles.aggregates[tile] = tile_sum;
+      __threadfence();
+      flags[tile] = lookback_aggregate;
+
+      T look = Function::identity();
+      unsigned int pred = tile - 1;
+      while (true) {
+        unsigned int flag;
+        do {
+          flag = flags[pred];
+        } while (flag == lookback_invalid);
+        __threadfence();
+        if (flag == lookback_prefix) {
+          look = f(lookback_load(&tiles.prefixes[pred]), look);
+          break;
+        }
+        look = f(lookback_load(&tiles.aggregates[pred]), look);
+        --pred;
+      }
+      tile_prefix = look;
+    }
+    tiles.prefixes[tile] = f(tile_prefix, tile_sum);
+    __threadfence();
+    flags[tile] = lookback_prefix;
+    *prefix = tile_prefix;
+  }
+  __syncthreads();
+
+  T running = f(*prefix, thread_prefix);
+  for (IndexType k = 0; k < static_cast<IndexType>(ItemsPerThread); ++k) {
+    const IndexType idx = first + k;
+    if (idx < tile_len) {
+      if (Exclusive) {
+        const T val = items[idx];
+        items[idx] = running;
+        running = f(running, val);
+      } else {
+        running = f(running, items[idx]);
+        items[idx] = running;
+      }
+    }
+  }
+  __syncthreads();
+
+  for (IndexType k = 0; k < static_cast<IndexType>(ItemsPerThread); ++k) {
+    const IndexType idx = k * static_cast<IndexType>(BlockSize) + tid;
+    if (idx < tile_len) {
+      out[tile_begin + idx] = items[idx];
+    }
+  }
+}
+
+/*!
+ * \brief Scan [begin, end) into out, which may be begin, with a decoupled
+ *        look-back scan of at most ItemsPerThread values per thread. The
+ *        tile state is held by the current AlgorithmWorkspace if there is
+ *        one.
+ */
+template <size_t BlockSize,
+          size_t ItemsPerThread,
+          bool Exclusive,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename T>
+RAJA_INLINE void lookback_scan(::RAJA::resources::Cuda cuda_res,
+                               bool async,
+                               InputIter begin,
+                               InputIter end,
+                               OutputIter out,
+                               Function binary_op,
+                               T init)
+{
+  using IndexType = camp::decay<decltype(std::distance(begin, end))>;
+  static_assert(BlockSize > 0 && ItemsPerThread > 0,
+                "Scan tiles must not be empty");
+  constexpr size_t items_per_thread =
+      lookback_items_per_thread<T, BlockSize, ItemsPerThread>::value;
+  static_assert(items_per_thread > 0,
+                "Scan tiles of one value per thread must fit in shared "
+                "memory, use a smaller block size");
+
+  IndexType len = std::distance(begin, end);
+  if (len <= 0) {
+    return;
+  }
+
+  cudaStream_t stream = cuda_res.get_stream();
+  constexpr size_t tile_size = BlockSize * items_per_thread;
+  const size_t num_tiles = (static_cast<size_t>(len) + tile_size - 1) / tile_size;
+
+  void* storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, LookbackTiles<T>::storage_bytes(num_tiles), stream);
+  cudaErrchk(cudaMemsetAsync(storage,
+                             0,
+                             LookbackTiles<T>::zeroed_bytes(num_tiles),
+                             stream));
+  LookbackTiles<T> tiles = LookbackTiles<T>::make(storage, num_tiles);
+
+  auto func = lookback_scan_kernel<BlockSize,
+                                   items_per_thread,
+                                   Exclusive,
+                                   InputIter,
+                                   OutputIter,
+                                   IndexType,
+                                   Function,
+                                   T>;
+  cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(num_tiles), 1, 1};
+  cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(BlockSize), 1, 1};
+  void* args[] = {(void*)&begin,
+                  (void*)&out,
+                  (void*)&len,
+                  (void*)&binary_op,
+                  (void*)&init,
+                  (void*)&tiles};
+  ::RAJA::cuda::launch(
+      (const void*)func, gridSize, blockSize, args, 0, cuda_res, async);
+
+  cuda::detail::algorithm_free(storage, stream);
+}
+
+}  // namespace impl
+
+/*!
+ * \brief Bytes of device storage used by an in-place scan of len values of
+ *        type T with policy, the tile state of the look-back scan.
+ *
+ * Reserve them with AlgorithmWorkspace::reserve to keep the scan from
+ * allocating. It is 0 for types too large for the look-back tiles, which
+ * are scanned with cub instead.
+ */
+template <typename T, size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async>
+RAJA_INLINE size_t scan_inplace_storage_bytes(
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    size_t len)
+{
+  constexpr size_t items_per_thread = impl::lookback_items_per_thread<
+      T, BLOCK_SIZE, policy::cuda::SCAN_ITEMS_PER_THREAD>::value;
+  // types too large for the look-back tiles are scanned with cub
+  if (items_per_thread == 0) {
+    return 0;
+  }
+  constexpr size_t tile_size =
+      BLOCK_SIZE * (items_per_thread > 0 ? items_per_thread : 1);
+  return impl::LookbackTiles<T>::storage_bytes((len + tile_size - 1) /
+                                               tile_size);
+}
+
+template <typename T, size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD, bool Async>
+RAJA_INLINE size_t scan_inplace_storage_bytes(
+    cuda_scan_exec_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, Async>,
+    size_t len)
+{
+  constexpr size_t items_per_thread =
+      impl::lookback_items_per_thread<T, BLOCK_SIZE, ITEMS_PER_THREAD>::value;
+  static_assert(items_per_thread > 0,
+                "Scan tiles of one value per thread must fit in shared "
+                "memory, use a smaller block size");
+  constexpr size_t tile_size = BLOCK_SIZE * items_per_thread;
+  return impl::LookbackTiles<T>::storage_bytes((len + tile_size - 1) /
+                                               tile_size);
+}
+
+template <typename ExecPolicy, typename T>
+RAJA_INLINE size_t scan_inplace_storage_bytes(size_t len)
+{
+  return scan_inplace_storage_bytes<T>(ExecPolicy{}, len);
+}
+
+}  // namespace cuda
+
 namespace impl
 {
 namespace scan
@@ -41,10 +420,20 @@ namespace scan
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
+
+   Runs the decoupled look-back scan in place, so the only device storage is
+   the tile state returned by scan_inplace_storage_bytes.
 */
-template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename InputIter, typename Function>
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename Function>
 RAJA_INLINE
-resources::EventProxy<resources::Cuda>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      cuda::impl::lookback_scan_fits<
+                          RAJA::detail::IterVal<InputIter>,
+                          BLOCK_SIZE>>
 inclusive_inplace(
     resources::Cuda cuda_res,
     cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
@@ -52,35 +441,12 @@ inclusive_inplace(
     InputIter end,
     Function binary_op)
 {
-  cudaStream_t stream = cuda_res.get_stream();
-
-  int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              binary_op,
-                                              len,
-                                              stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-  cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              binary_op,
-                                              len,
-                                              stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
-
-  cuda::launch(cuda_res, Async);
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE,
+                            policy::cuda::SCAN_ITEMS_PER_THREAD,
+                            false>(
+      cuda_res, Async, begin, end, begin, binary_op,
+      static_cast<T>(Function::identity()));
 
   return resources::EventProxy<resources::Cuda>(cuda_res);
 }
@@ -88,54 +454,34 @@ inclusive_inplace(
 /*!
         \brief explicit exclusive inplace scan given range, function, and
    initial value
+
+   Runs the decoupled look-back scan in place, so the only device storage is
+   the tile state returned by scan_inplace_storage_bytes.
 */
 template <size_t BLOCK_SIZE,
           size_t BLOCKS_PER_SM,
           bool Async,
           typename InputIter,
           typename Function,
-          typename T>
+          typename TInit>
 RAJA_INLINE
-resources::EventProxy<resources::Cuda>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      cuda::impl::lookback_scan_fits<
+                          RAJA::detail::IterVal<InputIter>,
+                          BLOCK_SIZE>>
 exclusive_inplace(
     resources::Cuda cuda_res,
     cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
     InputIter begin,
     InputIter end,
     Function binary_op,
-    T init)
+    TInit init)
 {
-  cudaStream_t stream = cuda_res.get_stream();
-
-  int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              binary_op,
-                                              init,
-                                              len,
-                                              stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-  cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              binary_op,
-                                              init,
-                                              len,
-                                              stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
-
-  cuda::launch(cuda_res, Async);
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE,
+                            policy::cuda::SCAN_ITEMS_PER_THREAD,
+                            true>(
+      cuda_res, Async, begin, end, begin, binary_op, static_cast<T>(init));
 
   return resources::EventProxy<resources::Cuda>(cuda_res);
 }
@@ -166,17 +512,21 @@ inclusive(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              out,
-                                              binary_op,
-                                              len,
-                                              stream));
+  auto key = cuda::AlgorithmWorkspace::make_key<InputIter, OutputIter, Function>(
+      cuda::AlgorithmWorkspace::algorithm::inclusive_scan, len);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                out,
+                                                binary_op,
+                                                len,
+                                                stream));
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
   // Run
   cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
                                               temp_storage_bytes,
@@ -186,7 +536,7 @@ inclusive(
                                               len,
                                               stream));
   // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  cuda::detail::algorithm_free(d_temp_storage, stream);
 
   cuda::launch(cuda_res, Async);
 
@@ -221,18 +571,22 @@ exclusive(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              out,
-                                              binary_op,
-                                              init,
-                                              len,
-                                              stream));
+  auto key = cuda::AlgorithmWorkspace::make_key<InputIter, OutputIter, Function, T>(
+      cuda::AlgorithmWorkspace::algorithm::exclusive_scan, len);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                out,
+                                                binary_op,
+                                                init,
+                                                len,
+                                                stream));
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
   // Run
   cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
                                               temp_storage_bytes,
@@ -243,13 +597,351 @@ exclusive(
                                               len,
                                               stream));
   // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  cuda::detail::algorithm_free(d_temp_storage, stream);
 
   cuda::launch(cuda_res, Async);
 
   return resources::EventProxy<resources::Cuda>(cuda_res);
 }
 
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value of values too large for the look-back scan tiles
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename Function>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<cuda::impl::lookback_scan_fits<
+                          RAJA::detail::IterVal<InputIter>,
+                          BLOCK_SIZE>>>
+inclusive_inplace(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> exec,
+    InputIter begin,
+    InputIter end,
+    Function binary_op)
+{
+  return inclusive(cuda_res, exec, begin, end, begin, binary_op);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value of values too large for the look-back scan tiles
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename Function,
+          typename TInit>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<cuda::impl::lookback_scan_fits<
+                          RAJA::detail::IterVal<InputIter>,
+                          BLOCK_SIZE>>>
+exclusive_inplace(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> exec,
+    InputIter begin,
+    InputIter end,
+    Function binary_op,
+    TInit init)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  return exclusive(cuda_res, exec, begin, end, begin, binary_op,
+                   static_cast<T>(init));
+}
+
+/*!
+        \brief inclusive scan used by the scan based algorithms of values
+   too large for the look-back scan tiles
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<cuda::impl::lookback_scan_fits<
+                          RAJA::detail::IterVal<InputIter>,
+                          BLOCK_SIZE>>>
+inclusive_adapted(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> exec,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  return inclusive(cuda_res, exec, begin, end, out, binary_op);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms of values
+   too large for the look-back scan tiles
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<cuda::impl::lookback_scan_fits<
+                          RAJA::detail::IterVal<InputIter>,
+                          BLOCK_SIZE>>>
+exclusive_adapted(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> exec,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  return exclusive(cuda_res, exec, begin, end, out, binary_op,
+                   static_cast<T>(Function::identity()));
+}
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value using a single pass decoupled look-back scan
+*/
+template <size_t BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD,
+          bool Async,
+          typename InputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+inclusive_inplace(
+    resources::Cuda cuda_res,
+    cuda_scan_exec_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, Async>,
+    InputIter begin,
+    InputIter end,
+    Function binary_op)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE, ITEMS_PER_THREAD, false>(
+      cuda_res, Async, begin, end, begin, binary_op,
+      static_cast<T>(Function::identity()));
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value using a single pass decoupled look-back scan
+*/
+template <size_t BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD,
+          bool Async,
+          typename InputIter,
+          typename Function,
+          typename TInit>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+exclusive_inplace(
+    resources::Cuda cuda_res,
+    cuda_scan_exec_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, Async>,
+    InputIter begin,
+    InputIter end,
+    Function binary_op,
+    TInit init)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE, ITEMS_PER_THREAD, true>(
+      cuda_res, Async, begin, end, begin, binary_op, static_cast<T>(init));
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value using a single pass decoupled look-back scan
+*/
+template <size_t BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+inclusive(
+    resources::Cuda cuda_res,
+    cuda_scan_exec_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  using T = typename std::iterator_traits<OutputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE, ITEMS_PER_THREAD, false>(
+      cuda_res, Async, begin, end, out, binary_op,
+      static_cast<T>(Function::identity()));
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value using a single pass decoupled look-back scan
+*/
+template <size_t BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename TInit>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+exclusive(
+    resources::Cuda cuda_res,
+    cuda_scan_exec_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op,
+    TInit init)
+{
+  using T = typename std::iterator_traits<OutputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE, ITEMS_PER_THREAD, true>(
+      cuda_res, Async, begin, end, out, binary_op, static_cast<T>(init));
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief inclusive scan used by the scan based algorithms, the values of
+   begin are combined with binary_op and the results assigned to out[i]
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      cuda::impl::lookback_scan_fits<
+                          RAJA::detail::IterVal<InputIter>,
+                          BLOCK_SIZE>>
+inclusive_adapted(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE,
+                            policy::cuda::SCAN_ITEMS_PER_THREAD,
+                            false>(
+      cuda_res, Async, begin, end, out, binary_op,
+      static_cast<T>(Function::identity()));
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief inclusive scan used by the scan based algorithms, the values of
+   begin are combined with binary_op and the results assigned to out[i]
+*/
+template <size_t BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+inclusive_adapted(
+    resources::Cuda cuda_res,
+    cuda_scan_exec_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE, ITEMS_PER_THREAD, false>(
+      cuda_res, Async, begin, end, out, binary_op,
+      static_cast<T>(Function::identity()));
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms, the values of
+   begin are combined with binary_op and the results assigned to out[i]
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      cuda::impl::lookback_scan_fits<
+                          RAJA::detail::IterVal<InputIter>,
+                          BLOCK_SIZE>>
+exclusive_adapted(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE,
+                            policy::cuda::SCAN_ITEMS_PER_THREAD,
+                            true>(
+      cuda_res, Async, begin, end, out, binary_op,
+      static_cast<T>(Function::identity()));
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms, the values of
+   begin are combined with binary_op and the results assigned to out[i]
+*/
+template <size_t BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+exclusive_adapted(
+    resources::Cuda cuda_res,
+    cuda_scan_exec_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  cuda::impl::lookback_scan<BLOCK_SIZE, ITEMS_PER_THREAD, true>(
+      cuda_res, Async, begin, end, out, binary_op,
+      static_cast<T>(Function::identity()));
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
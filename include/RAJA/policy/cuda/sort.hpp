@@ -22,14 +22,22 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include <algorithm>
 #include <climits>
 #include <iterator>
 #include <type_traits>
 
+#include "cub/device/device_histogram.cuh"
+#include "cub/device/device_partition.cuh"
 #include "cub/device/device_radix_sort.cuh"
+#include "cub/device/device_scan.cuh"
+#include "cub/device/device_segmented_radix_sort.cuh"
+#include "cub/iterator/constant_input_iterator.cuh"
+#include "cub/iterator/transform_input_iterator.cuh"
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/radix_sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
@@ -73,17 +81,20 @@ stable(
 }
 
 /*!
-        \brief stable sort given range in ascending order
+        \brief stable sort given range in ascending order of bits
+               [begin_bit, end_bit) of the values
 */
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter>
 concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
                       type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                       std::is_pointer<Iter>>
-stable(
+stable_bits(
     resources::Cuda cuda_res,
     cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
     Iter begin,
     Iter end,
+    int begin_bit,
+    int end_bit,
     operators::less<RAJA::detail::IterVal<Iter>>)
 {
   cudaStream_t stream = cuda_res.get_stream();
@@ -91,11 +102,9 @@ stable(
   using R = RAJA::detail::IterVal<Iter>;
 
   int len = std::distance(begin, end);
-  int begin_bit=0;
-  int end_bit=sizeof(R)*CHAR_BIT;
 
   // Allocate temporary storage for the output array
-  R* d_out = cuda::device_mempool_type::getInstance().malloc<R>(len);
+  R* d_out = cuda::detail::algorithm_malloc<R>(1, len, stream);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
@@ -104,17 +113,21 @@ stable(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
-                                              temp_storage_bytes,
-                                              d_keys,
-                                              len,
-                                              begin_bit,
-                                              end_bit,
-                                              stream));
+  auto key = cuda::AlgorithmWorkspace::make_key<R>(
+      cuda::AlgorithmWorkspace::algorithm::sort_keys, len, begin_bit, end_bit);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys,
+                                                len,
+                                                begin_bit,
+                                                end_bit,
+                                                stream));
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
 
   // Run
   cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
@@ -125,7 +138,7 @@ stable(
                                               end_bit,
                                               stream));
   // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  cuda::detail::algorithm_free(d_temp_storage, stream);
 
   if (d_keys.Current() == d_out) {
 
@@ -133,7 +146,7 @@ stable(
     cudaErrchk(cudaMemcpyAsync(begin, d_out, len*sizeof(R), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_out);
+  cuda::detail::algorithm_free(d_out, stream);
 
   cuda::launch(cuda_res, Async);
 
@@ -141,17 +154,20 @@ stable(
 }
 
 /*!
-        \brief stable sort given range in descending order
+        \brief stable sort given range in descending order of bits
+               [begin_bit, end_bit) of the values
 */
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter>
 concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
                       type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                       std::is_pointer<Iter>>
-stable(
+stable_bits(
     resources::Cuda cuda_res,
     cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
     Iter begin,
     Iter end,
+    int begin_bit,
+    int end_bit,
     operators::greater<RAJA::detail::IterVal<Iter>>)
 {
   cudaStream_t stream = cuda_res.get_stream();
@@ -159,11 +175,9 @@ stable(
   using R = RAJA::detail::IterVal<Iter>;
 
   int len = std::distance(begin, end);
-  int begin_bit=0;
-  int end_bit=sizeof(R)*CHAR_BIT;
 
   // Allocate temporary storage for the output array
-  R* d_out = cuda::device_mempool_type::getInstance().malloc<R>(len);
+  R* d_out = cuda::detail::algorithm_malloc<R>(1, len, stream);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
@@ -172,17 +186,21 @@ stable(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
-                                                        temp_storage_bytes,
-                                                        d_keys,
-                                                        len,
-                                                        begin_bit,
-                                                        end_bit,
-                                                        stream));
+  auto key = cuda::AlgorithmWorkspace::make_key<R>(
+      cuda::AlgorithmWorkspace::algorithm::sort_keys_descending, len, begin_bit, end_bit);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_keys,
+                                                          len,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream));
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
 
   // Run
   cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
@@ -193,7 +211,7 @@ stable(
                                                         end_bit,
                                                         stream));
   // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  cuda::detail::algorithm_free(d_temp_storage, stream);
 
   if (d_keys.Current() == d_out) {
 
@@ -201,13 +219,65 @@ stable(
     cudaErrchk(cudaMemcpyAsync(begin, d_out, len*sizeof(R), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_out);
+  cuda::detail::algorithm_free(d_out, stream);
 
   cuda::launch(cuda_res, Async);
 
   return resources::EventProxy<resources::Cuda>(cuda_res);
 }
 
+/*!
+        \brief static assert unimplemented stable sort of a bit range
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                        std::is_pointer<Iter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
+stable_bits(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Iter,
+    Iter,
+    int,
+    int,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                  std::is_pointer<Iter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>::value,
+                "RAJA stable_sort_bits<cuda_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief stable sort given range in ascending or descending order
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                      std::is_pointer<Iter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+stable(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> p,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  return stable_bits(cuda_res, p, begin, end, 0, sizeof(R)*CHAR_BIT, comp);
+}
+
 
 /*!
         \brief static assert unimplemented sort
@@ -312,7 +382,8 @@ stable_pairs(
 }
 
 /*!
-        \brief stable sort given range of pairs in ascending order of keys
+        \brief stable sort given range of pairs in ascending order of bits
+               [begin_bit, end_bit) of the keys
 */
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
           typename KeyIter, typename ValIter>
@@ -320,12 +391,14 @@ concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
                       type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                       std::is_pointer<KeyIter>,
                       std::is_pointer<ValIter>>
-stable_pairs(
+stable_pairs_bits(
     resources::Cuda cuda_res,
     cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
     KeyIter keys_begin,
     KeyIter keys_end,
     ValIter vals_begin,
+    int begin_bit,
+    int end_bit,
     operators::less<RAJA::detail::IterVal<KeyIter>>)
 {
   cudaStream_t stream = cuda_res.get_stream();
@@ -334,12 +407,10 @@ stable_pairs(
   using V = RAJA::detail::IterVal<ValIter>;
 
   int len = std::distance(keys_begin, keys_end);
-  int begin_bit=0;
-  int end_bit=sizeof(K)*CHAR_BIT;
 
   // Allocate temporary storage for the output arrays
-  K* d_keys_out = cuda::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = cuda::device_mempool_type::getInstance().malloc<V>(len);
+  K* d_keys_out = cuda::detail::algorithm_malloc<K>(1, len, stream);
+  V* d_vals_out = cuda::detail::algorithm_malloc<V>(2, len, stream);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
@@ -349,18 +420,22 @@ stable_pairs(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
-                                               temp_storage_bytes,
-                                               d_keys,
-                                               d_vals,
-                                               len,
-                                               begin_bit,
-                                               end_bit,
-                                               stream));
+  auto key = cuda::AlgorithmWorkspace::make_key<K, V>(
+      cuda::AlgorithmWorkspace::algorithm::sort_pairs, len, begin_bit, end_bit);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_keys,
+                                                 d_vals,
+                                                 len,
+                                                 begin_bit,
+                                                 end_bit,
+                                                 stream));
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
 
   // Run
   cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
@@ -372,7 +447,7 @@ stable_pairs(
                                                end_bit,
                                                stream));
   // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  cuda::detail::algorithm_free(d_temp_storage, stream);
 
   if (d_keys.Current() == d_keys_out) {
 
@@ -385,8 +460,8 @@ stable_pairs(
     cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_keys_out);
-  cuda::device_mempool_type::getInstance().free(d_vals_out);
+  cuda::detail::algorithm_free(d_keys_out, stream);
+  cuda::detail::algorithm_free(d_vals_out, stream);
 
   cuda::launch(cuda_res, Async);
 
@@ -394,7 +469,8 @@ stable_pairs(
 }
 
 /*!
-        \brief stable sort given range of pairs in descending order of keys
+        \brief stable sort given range of pairs in descending order of bits
+               [begin_bit, end_bit) of the keys
 */
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
           typename KeyIter, typename ValIter>
@@ -402,12 +478,14 @@ concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
                       type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                       std::is_pointer<KeyIter>,
                       std::is_pointer<ValIter>>
-stable_pairs(
+stable_pairs_bits(
     resources::Cuda cuda_res,
     cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
     KeyIter keys_begin,
     KeyIter keys_end,
     ValIter vals_begin,
+    int begin_bit,
+    int end_bit,
     operators::greater<RAJA::detail::IterVal<KeyIter>>)
 {
   cudaStream_t stream = cuda_res.get_stream();
@@ -416,12 +494,10 @@ stable_pairs(
   using V = RAJA::detail::IterVal<ValIter>;
 
   int len = std::distance(keys_begin, keys_end);
-  int begin_bit=0;
-  int end_bit=sizeof(K)*CHAR_BIT;
 
   // Allocate temporary storage for the output arrays
-  K* d_keys_out = cuda::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = cuda::device_mempool_type::getInstance().malloc<V>(len);
+  K* d_keys_out = cuda::detail::algorithm_malloc<K>(1, len, stream);
+  V* d_vals_out = cuda::detail::algorithm_malloc<V>(2, len, stream);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
@@ -431,18 +507,22 @@ stable_pairs(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
-                                                         temp_storage_bytes,
-                                                         d_keys,
-                                                         d_vals,
-                                                         len,
-                                                         begin_bit,
-                                                         end_bit,
-                                                         stream));
+  auto key = cuda::AlgorithmWorkspace::make_key<K, V>(
+      cuda::AlgorithmWorkspace::algorithm::sort_pairs_descending, len, begin_bit, end_bit);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_keys,
+                                                           d_vals,
+                                                           len,
+                                                           begin_bit,
+                                                           end_bit,
+                                                           stream));
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
 
   // Run
   cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
@@ -454,7 +534,7 @@ stable_pairs(
                                                          end_bit,
                                                          stream));
   // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  cuda::detail::algorithm_free(d_temp_storage, stream);
 
   if (d_keys.Current() == d_keys_out) {
 
@@ -467,14 +547,75 @@ stable_pairs(
     cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_keys_out);
-  cuda::device_mempool_type::getInstance().free(d_vals_out);
+  cuda::detail::algorithm_free(d_keys_out, stream);
+  cuda::detail::algorithm_free(d_vals_out, stream);
 
   cuda::launch(cuda_res, Async);
 
   return resources::EventProxy<resources::Cuda>(cuda_res);
 }
 
+/*!
+        \brief static assert unimplemented stable sort pairs of a bit range
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                        std::is_pointer<KeyIter>,
+                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
+stable_pairs_bits(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter,
+    KeyIter,
+    ValIter,
+    int,
+    int,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                  std::is_pointer<KeyIter>,
+                  std::is_pointer<ValIter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>::value,
+                "RAJA stable_sort_pairs_bits<cuda_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief stable sort given range of pairs in ascending or descending
+               order of keys
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<ValIter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+stable_pairs(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  using K = RAJA::detail::IterVal<KeyIter>;
+  return stable_pairs_bits(cuda_res, p, keys_begin, keys_end, vals_begin,
+                           0, sizeof(K)*CHAR_BIT, comp);
+}
+
 
 /*!
         \brief static assert unimplemented sort pairs
@@ -552,6 +693,586 @@ unstable_pairs(
   return stable_pairs(cuda_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+        \brief static assert unimplemented segmented sort
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                        std::is_pointer<Iter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
+segmented(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Iter,
+    Iter,
+    OffsetIter,
+    OffsetIter,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                  std::is_pointer<Iter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>::value,
+                "RAJA sort_segmented<cuda_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief stable sort each segment of given range in ascending or
+               descending order, all segments are sorted in one call
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                      std::is_pointer<Iter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+segmented(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Iter begin,
+    Iter end,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  using R = RAJA::detail::IterVal<Iter>;
+  constexpr bool descending =
+      camp::is_same<Compare, operators::greater<R>>::value;
+
+  int len = std::distance(begin, end);
+  int num_segments = std::distance(offsets_begin, offsets_end) - 1;
+  int begin_bit=0;
+  int end_bit=sizeof(R)*CHAR_BIT;
+
+  // Allocate temporary storage for the output array
+  R* d_out = cuda::detail::algorithm_malloc<R>(1, len, stream);
+
+  // use cub double buffer to reduce temporary memory requirements
+  // by allowing cub to write to the begin buffer
+  cub::DoubleBuffer<R> d_keys(begin, d_out);
+
+  auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+    if (descending) {
+      cudaErrchk(::cub::DeviceSegmentedRadixSort::SortKeysDescending(
+          d_temp_storage, temp_storage_bytes, d_keys, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    } else {
+      cudaErrchk(::cub::DeviceSegmentedRadixSort::SortKeys(
+          d_temp_storage, temp_storage_bytes, d_keys, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    }
+  };
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  auto key = cuda::AlgorithmWorkspace::make_key<R, OffsetIter>(
+      descending ? cuda::AlgorithmWorkspace::algorithm::sort_keys_segmented_descending
+                 : cuda::AlgorithmWorkspace::algorithm::sort_keys_segmented,
+      len, begin_bit, end_bit, num_segments);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    run(d_temp_storage, temp_storage_bytes);
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
+  // Allocate temporary storage
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
+
+  // Run
+  run(d_temp_storage, temp_storage_bytes);
+
+  // Free temporary storage
+  cuda::detail::algorithm_free(d_temp_storage, stream);
+
+  if (d_keys.Current() == d_out) {
+
+    // copy
+    cudaErrchk(cudaMemcpyAsync(begin, d_out, len*sizeof(R), cudaMemcpyDefault, stream));
+  }
+
+  cuda::detail::algorithm_free(d_out, stream);
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief static assert unimplemented segmented sort pairs
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename ValIter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                        std::is_pointer<KeyIter>,
+                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
+segmented_pairs(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter,
+    KeyIter,
+    ValIter,
+    OffsetIter,
+    OffsetIter,
+    Compare)
+{
+  static_assert (std::is_pointer<KeyIter>::value,
+      "sort_pairs_segmented<cuda_exec> is only implemented for pointers");
+  static_assert (std::is_pointer<ValIter>::value,
+      "sort_pairs_segmented<cuda_exec> is only implemented for pointers");
+  using K = RAJA::detail::IterVal<KeyIter>;
+  static_assert (type_traits::is_arithmetic<K>::value,
+      "sort_pairs_segmented<cuda_exec> is only implemented for arithmetic types");
+  static_assert (concepts::any_of<
+      camp::is_same<Compare, operators::less<K>>,
+      camp::is_same<Compare, operators::greater<K>>>::value,
+      "sort_pairs_segmented<cuda_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief stable sort each segment of given range of pairs in ascending
+               or descending order of keys, all segments are sorted in one call
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename ValIter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<ValIter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+segmented_pairs(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using V = RAJA::detail::IterVal<ValIter>;
+  constexpr bool descending =
+      camp::is_same<Compare, operators::greater<K>>::value;
+
+  int len = std::distance(keys_begin, keys_end);
+  int num_segments = std::distance(offsets_begin, offsets_end) - 1;
+  int begin_bit=0;
+  int end_bit=sizeof(K)*CHAR_BIT;
+
+  // Allocate temporary storage for the output arrays
+  K* d_keys_out = cuda::detail::algorithm_malloc<K>(1, len, stream);
+  V* d_vals_out = cuda::detail::algorithm_malloc<V>(2, len, stream);
+
+  // use cub double buffer to reduce temporary memory requirements
+  // by allowing cub to write to the keys_begin and vals_begin buffers
+  cub::DoubleBuffer<K> d_keys(keys_begin, d_keys_out);
+  cub::DoubleBuffer<V> d_vals(vals_begin, d_vals_out);
+
+  auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+    if (descending) {
+      cudaErrchk(::cub::DeviceSegmentedRadixSort::SortPairsDescending(
+          d_temp_storage, temp_storage_bytes, d_keys, d_vals, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    } else {
+      cudaErrchk(::cub::DeviceSegmentedRadixSort::SortPairs(
+          d_temp_storage, temp_storage_bytes, d_keys, d_vals, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    }
+  };
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  auto key = cuda::AlgorithmWorkspace::make_key<K, V, OffsetIter>(
+      descending ? cuda::AlgorithmWorkspace::algorithm::sort_pairs_segmented_descending
+                 : cuda::AlgorithmWorkspace::algorithm::sort_pairs_segmented,
+      len, begin_bit, end_bit, num_segments);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    run(d_temp_storage, temp_storage_bytes);
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
+  // Allocate temporary storage
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
+
+  // Run
+  run(d_temp_storage, temp_storage_bytes);
+
+  // Free temporary storage
+  cuda::detail::algorithm_free(d_temp_storage, stream);
+
+  if (d_keys.Current() == d_keys_out) {
+
+    // copy keys
+    cudaErrchk(cudaMemcpyAsync(keys_begin, d_keys_out, len*sizeof(K), cudaMemcpyDefault, stream));
+  }
+  if (d_vals.Current() == d_vals_out) {
+
+    // copy vals
+    cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
+  }
+
+  cuda::detail::algorithm_free(d_keys_out, stream);
+  cuda::detail::algorithm_free(d_vals_out, stream);
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief static assert unimplemented nth_element
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                        std::is_pointer<Iter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
+nth_element(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Iter,
+    Iter,
+    Iter,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                  std::is_pointer<Iter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>::value,
+                "RAJA nth_element<cuda_exec> and partial_sort<cuda_exec> are only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief partially sort given range in ascending or descending order
+               so nth is the value it would be if the range were sorted
+
+        A radix select finds the digits of the nth value from the most
+        significant digit down. Each pass counts the digits of the keys
+        that have the digits found so far and keeps the digit that holds
+        the nth value, until it is the only candidate or all digits are
+        found. Two partitions then put the keys less than the candidates
+        first and the candidates after them.
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                      std::is_pointer<Iter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+nth_element(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  using R = RAJA::detail::IterVal<Iter>;
+  using bits_type = typename RAJA::detail::radix_key<R>::bits_type;
+  constexpr bool descending =
+      camp::is_same<Compare, operators::greater<R>>::value;
+  constexpr int digit_bits = RAJA::detail::get_radix_sort_digit_bits();
+  constexpr int num_buckets = 1 << digit_bits;
+
+  using digit_op = RAJA::detail::radix_select_digit<descending, R>;
+  using less_op = RAJA::detail::radix_select_partition<descending, false, R>;
+  using equal_op = RAJA::detail::radix_select_partition<descending, true, R>;
+  using digit_iter = ::cub::TransformInputIterator<int, digit_op, Iter>;
+
+  int len = std::distance(begin, end);
+  int rank = std::distance(begin, nth);
+
+  // Allocate temporary storage for the digit counts, also used for the
+  // number of selected keys of the partitions, and the partitioned keys
+  int* d_counts = cuda::detail::algorithm_malloc<int>(1, num_buckets, stream);
+  R* d_out = cuda::detail::algorithm_malloc<R>(2, len, stream);
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  auto key = cuda::AlgorithmWorkspace::make_key<R>(
+      descending ? cuda::AlgorithmWorkspace::algorithm::select_descending
+                 : cuda::AlgorithmWorkspace::algorithm::select,
+      len);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    size_t histogram_bytes = 0;
+    cudaErrchk(::cub::DeviceHistogram::HistogramEven(d_temp_storage,
+                                                     histogram_bytes,
+                                                     digit_iter(begin, digit_op{}),
+                                                     d_counts,
+                                                     num_buckets+1,
+                                                     0,
+                                                     num_buckets,
+                                                     len,
+                                                     stream));
+    size_t partition_bytes = 0;
+    cudaErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                          partition_bytes,
+                                          begin,
+                                          d_out,
+                                          d_counts,
+                                          len,
+                                          less_op{},
+                                          stream));
+    temp_storage_bytes = std::max(histogram_bytes, partition_bytes);
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
+  // Allocate temporary storage
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
+
+  // Find the digits of the nth value, num_before counts the keys before
+  // the candidates
+  bits_type prefix = 0;
+  bits_type prefix_mask = 0;
+  int num_before = 0;
+  int counts[num_buckets];
+  for (int shift = static_cast<int>(sizeof(R)*CHAR_BIT) - digit_bits;
+       shift >= 0;
+       shift -= digit_bits) {
+
+    cudaErrchk(::cub::DeviceHistogram::HistogramEven(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     digit_iter(begin, digit_op{prefix, prefix_mask, shift}),
+                                                     d_counts,
+                                                     num_buckets+1,
+                                                     0,
+                                                     num_buckets,
+                                                     len,
+                                                     stream));
+    cudaErrchk(cudaMemcpyAsync(counts, d_counts, sizeof(counts), cudaMemcpyDefault, stream));
+    cudaErrchk(cudaStreamSynchronize(stream));
+
+    int digit = 0;
+    while (rank - num_before >= counts[digit]) {
+      num_before += counts[digit];
+      ++digit;
+    }
+    prefix |= static_cast<bits_type>(bits_type(digit) << shift);
+    prefix_mask |= static_cast<bits_type>(bits_type(num_buckets-1) << shift);
+
+    if (counts[digit] == 1) {
+      break;
+    }
+  }
+
+  // Partition the keys less than the candidates to the front of d_out, then
+  // the candidates to their place after them in the range
+  cudaErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        begin,
+                                        d_out,
+                                        d_counts,
+                                        len,
+                                        less_op{prefix, prefix_mask},
+                                        stream));
+  cudaErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_out + num_before,
+                                        begin + num_before,
+                                        d_counts,
+                                        len - num_before,
+                                        equal_op{prefix, prefix_mask},
+                                        stream));
+  cudaErrchk(cudaMemcpyAsync(begin, d_out, num_before*sizeof(R), cudaMemcpyDefault, stream));
+
+  // Free temporary storage
+  cuda::detail::algorithm_free(d_temp_storage, stream);
+  cuda::detail::algorithm_free(d_counts, stream);
+  cuda::detail::algorithm_free(d_out, stream);
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief sort the smallest values of given range into [begin, middle)
+               with a radix select followed by a radix sort of [begin, middle)
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter, typename Compare>
+resources::EventProxy<resources::Cuda>
+partial(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> p,
+    Iter begin,
+    Iter middle,
+    Iter end,
+    Compare comp)
+{
+  if (middle != end) {
+    nth_element(cuda_res, p, begin, middle, end, comp);
+  }
+
+  return unstable(cuda_res, p, begin, middle, comp);
+}
+
+/*!
+        \brief static assert unimplemented argsort
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                        std::is_pointer<KeyIter>,
+                        std::is_pointer<IdxIter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
+argsort(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter,
+    KeyIter,
+    IdxIter,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                  std::is_pointer<KeyIter>,
+                  std::is_pointer<IdxIter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>::value,
+                "RAJA argsort<cuda_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief write the permutation that stably sorts given range of keys in
+               ascending or descending order, the keys are not modified
+
+        The identity permutation is made by a scan of ones and sorted as the
+        values of a radix sort of pairs into the output, the sorted keys go
+        to temporary storage.
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<IdxIter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+argsort(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    IdxIter perm_begin,
+    Compare)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using I = RAJA::detail::IterVal<IdxIter>;
+  constexpr bool descending =
+      camp::is_same<Compare, operators::greater<K>>::value;
+
+  int len = std::distance(keys_begin, keys_end);
+  int begin_bit=0;
+  int end_bit=sizeof(K)*CHAR_BIT;
+
+  // Allocate temporary storage for the identity permutation and the
+  // sorted keys
+  I* d_iota = cuda::detail::algorithm_malloc<I>(1, len, stream);
+  K* d_keys_out = cuda::detail::algorithm_malloc<K>(2, len, stream);
+
+  ::cub::ConstantInputIterator<I> ones(I(1));
+
+  auto sort = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+    if (descending) {
+      cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(
+          d_temp_storage, temp_storage_bytes, keys_begin, d_keys_out,
+          d_iota, perm_begin, len, begin_bit, end_bit, stream));
+    } else {
+      cudaErrchk(::cub::DeviceRadixSort::SortPairs(
+          d_temp_storage, temp_storage_bytes, keys_begin, d_keys_out,
+          d_iota, perm_begin, len, begin_bit, end_bit, stream));
+    }
+  };
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  auto key = cuda::AlgorithmWorkspace::make_key<K, I>(
+      descending ? cuda::AlgorithmWorkspace::algorithm::argsort_descending
+                 : cuda::AlgorithmWorkspace::algorithm::argsort,
+      len, begin_bit, end_bit);
+  if (!cuda::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    size_t scan_bytes = 0;
+    cudaErrchk(::cub::DeviceScan::ExclusiveSum(d_temp_storage,
+                                               scan_bytes,
+                                               ones,
+                                               d_iota,
+                                               len,
+                                               stream));
+    size_t sort_bytes = 0;
+    sort(d_temp_storage, sort_bytes);
+    temp_storage_bytes = std::max(scan_bytes, sort_bytes);
+    cuda::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
+  // Allocate temporary storage
+  d_temp_storage = cuda::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
+
+  // Run
+  cudaErrchk(::cub::DeviceScan::ExclusiveSum(d_temp_storage,
+                                             temp_storage_bytes,
+                                             ones,
+                                             d_iota,
+                                             len,
+                                             stream));
+  sort(d_temp_storage, temp_storage_bytes);
+
+  // Free temporary storage
+  cuda::detail::algorithm_free(d_temp_storage, stream);
+  cuda::detail::algorithm_free(d_iota, stream);
+  cuda::detail::algorithm_free(d_keys_out, stream);
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
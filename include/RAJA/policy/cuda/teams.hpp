@@ -18,10 +18,14 @@
 #ifndef RAJA_pattern_teams_cuda_HPP
 #define RAJA_pattern_teams_cuda_HPP
 
+#include <algorithm>
+
+#include "RAJA/pattern/teams/teams_batch.hpp"
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/WorkGroup/Vtable.hpp"
 #include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
 #include "RAJA/util/resource.hpp"
 
@@ -31,6 +35,96 @@ namespace RAJA
 namespace expt
 {
 
+namespace detail
+{
+
+//! Makes the device of a Cuda resource current, and restores the previous one
+template <>
+struct LaunchDeviceGuard<resources::Cuda> {
+  int prev_device;
+
+  explicit LaunchDeviceGuard(resources::Resource &res)
+  {
+    cudaErrchk(cudaGetDevice(&prev_device));
+    cudaErrchk(cudaSetDevice(res.get<resources::Cuda>().get_device()));
+  }
+
+  ~LaunchDeviceGuard() { cudaErrchk(cudaSetDevice(prev_device)); }
+};
+
+}  // namespace detail
+
+//! Let func use more dynamic shared memory than the default limit
+RAJA_INLINE
+void launch_shared_mem_setup(const void* func, size_t shmem)
+{
+  if (shmem > 48 * 1024) {
+    cudaErrchk(cudaFuncSetAttribute(func,
+                                    cudaFuncAttributeMaxDynamicSharedMemorySize,
+                                    static_cast<int>(shmem)));
+  }
+}
+
+/*!
+ * Launch func with the teams grouped in clusters of clusters teams, on
+ * devices of compute capability 9.0 and newer. Elsewhere, or with clusters
+ * of one team, the teams are launched as independent blocks.
+ */
+RAJA_INLINE
+void launch_clusters(const void* func,
+                     cuda_dim_t gridSize,
+                     cuda_dim_t blockSize,
+                     Clusters const& clusters,
+                     void** args,
+                     size_t shmem,
+                     resources::Cuda cuda_res,
+                     bool async,
+                     const char* name)
+{
+#if CUDART_VERSION >= 11080
+  const bool use_clusters =
+      (clusters.value[0] * clusters.value[1] * clusters.value[2] > 1) &&
+      RAJA::cuda::device_prop().major >= 9;
+  if (use_clusters) {
+    if (gridSize.x % clusters.value[0] != 0 ||
+        gridSize.y % clusters.value[1] != 0 ||
+        gridSize.z % clusters.value[2] != 0) {
+      RAJA_ABORT_OR_THROW("launch: teams must be a multiple of the clusters");
+    }
+
+    cudaLaunchAttribute attribute;
+    attribute.id = cudaLaunchAttributeClusterDimension;
+    attribute.val.clusterDim.x = clusters.value[0];
+    attribute.val.clusterDim.y = clusters.value[1];
+    attribute.val.clusterDim.z = clusters.value[2];
+
+    cudaLaunchConfig_t config = {};
+    config.gridDim = gridSize;
+    config.blockDim = blockSize;
+    config.dynamicSmemBytes = shmem;
+    config.stream = cuda_res.get_stream();
+    config.attrs = &attribute;
+    config.numAttrs = 1;
+
+#if defined(RAJA_ENABLE_NV_TOOLS_EXT)
+    if(name) nvtxRangePushA(name);
+#else
+    RAJA_UNUSED_VAR(name);
+#endif
+    RAJA::cuda::detail::prefetch_managed_ranges(cuda_res);
+    cudaErrchk(cudaLaunchKernelExC(&config, func, args));
+#if defined(RAJA_ENABLE_NV_TOOLS_EXT)
+    if(name) nvtxRangePop();
+#endif
+    RAJA::cuda::launch(cuda_res, async);
+    return;
+  }
+#else
+  RAJA_UNUSED_VAR(clusters);
+#endif
+  RAJA::cuda::launch(func, gridSize, blockSize, args, shmem, cuda_res, async, name);
+}
+
 template <typename BODY>
 __global__ void launch_global_fcn(LaunchContext ctx, BODY body_in)
 {
@@ -75,7 +169,8 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 1>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
+      launch_shared_mem_setup((const void*)func, shmem);
 
       {
         //
@@ -88,7 +183,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 1>> {
         // Launch the kernel
         //
         void *args[] = {(void*)&ctx, (void*)&body};
-        RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, async, ctx.kernel_name);
+        launch_clusters((const void*)func, gridSize, blockSize, ctx.clusters, args, shmem, cuda_res, async, ctx.kernel_name);
       }
 
       RAJA_FT_END;
@@ -129,7 +224,8 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 1>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
+      launch_shared_mem_setup((const void*)func, shmem);
 
       {
         //
@@ -143,7 +239,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 1>> {
         //
         void *args[] = {(void*)&ctx, (void*)&body};
         {
-          RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, async, ctx.kernel_name);
+          launch_clusters((const void*)func, gridSize, blockSize, ctx.clusters, args, shmem, cuda_res, async, ctx.kernel_name);
         }
       }
 
@@ -199,7 +295,8 @@ struct LaunchExecute<RAJA::policy::cuda::expt::cuda_launch_explicit_t<async, nth
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
+      launch_shared_mem_setup((const void*)func, shmem);
 
       {
         //
@@ -212,7 +309,7 @@ struct LaunchExecute<RAJA::policy::cuda::expt::cuda_launch_explicit_t<async, nth
         // Launch the kernel
         //
         void *args[] = {(void*)&ctx, (void*)&body};
-        RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, async, ctx.kernel_name);
+        launch_clusters((const void*)func, gridSize, blockSize, ctx.clusters, args, shmem, cuda_res, async, ctx.kernel_name);
       }
 
       RAJA_FT_END;
@@ -253,7 +350,8 @@ struct LaunchExecute<RAJA::policy::cuda::expt::cuda_launch_explicit_t<async, nth
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
+      launch_shared_mem_setup((const void*)func, shmem);
 
       {
         //
@@ -267,7 +365,7 @@ struct LaunchExecute<RAJA::policy::cuda::expt::cuda_launch_explicit_t<async, nth
         //
         void *args[] = {(void*)&ctx, (void*)&body};
         {
-          RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, async, ctx.kernel_name);
+          launch_clusters((const void*)func, gridSize, blockSize, ctx.clusters, args, shmem, cuda_res, async, ctx.kernel_name);
         }
       }
 
@@ -279,6 +377,232 @@ struct LaunchExecute<RAJA::policy::cuda::expt::cuda_launch_explicit_t<async, nth
 
 };
 
+/*!
+ * Number of blocks of block_threads threads using shmem bytes of dynamic
+ * shared memory that can be resident on the device at once
+ */
+RAJA_INLINE
+int launch_coresident_blocks(const void* func, int block_threads, size_t shmem)
+{
+  int blocks_per_sm = 0;
+  cudaErrchk(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &blocks_per_sm, func, block_threads, shmem));
+  return std::max(blocks_per_sm, 1) * RAJA::cuda::device_prop().multiProcessorCount;
+}
+
+template <bool async>
+struct LaunchExecute<RAJA::expt::cuda_launch_cooperative_t<async>> {
+
+  template <typename BODY_IN>
+  static void exec(LaunchContext const &ctx, BODY_IN &&body_in)
+  {
+    exec(RAJA::resources::Resource(resources::Cuda::get_default()),
+         ctx,
+         std::forward<BODY_IN>(body_in));
+  }
+
+  template <typename BODY_IN>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY_IN &&body_in)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    auto func = launch_global_fcn<BODY>;
+
+    /*Get the concrete resource */
+    resources::Cuda cuda_res = res.get<RAJA::resources::Cuda>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    cuda_dim_t gridSize{ static_cast<cuda_dim_member_t>(ctx.teams.value[0]),
+                         static_cast<cuda_dim_member_t>(ctx.teams.value[1]),
+                         static_cast<cuda_dim_member_t>(ctx.teams.value[2]) };
+
+    cuda_dim_t blockSize{ static_cast<cuda_dim_member_t>(ctx.threads.value[0]),
+                          static_cast<cuda_dim_member_t>(ctx.threads.value[1]),
+                          static_cast<cuda_dim_member_t>(ctx.threads.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr cuda_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      //
+      // Setup shared memory buffers
+      //
+      size_t shmem = ctx.shared_mem_size;
+      launch_shared_mem_setup((const void*)func, shmem);
+
+      //
+      // Limit the grid to the blocks that can be resident at once, taking
+      // from x first, then y and z
+      //
+      const cuda_dim_member_t max_blocks = static_cast<cuda_dim_member_t>(
+          launch_coresident_blocks((const void*)func,
+                                   blockSize.x * blockSize.y * blockSize.z,
+                                   shmem));
+      gridSize.x = std::min(gridSize.x, max_blocks);
+      gridSize.y = std::min(gridSize.y, std::max(max_blocks / gridSize.x, cuda_dim_member_t(1)));
+      gridSize.z = std::min(gridSize.z, std::max(max_blocks / (gridSize.x * gridSize.y), cuda_dim_member_t(1)));
+
+      {
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::cuda::make_launch_body(
+            gridSize, blockSize, shmem, cuda_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel
+        //
+        void *args[] = {(void*)&ctx, (void*)&body};
+#if defined(RAJA_ENABLE_NV_TOOLS_EXT)
+        if(ctx.kernel_name) nvtxRangePushA(ctx.kernel_name);
+#endif
+        RAJA::cuda::detail::prefetch_managed_ranges(cuda_res);
+        cudaErrchk(cudaLaunchCooperativeKernel((const void*)func, gridSize, blockSize, args, shmem, cuda_res.get_stream()));
+#if defined(RAJA_ENABLE_NV_TOOLS_EXT)
+        if(ctx.kernel_name) nvtxRangePop();
+#endif
+        RAJA::cuda::launch(cuda_res, async);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+/*!
+ * Run the bodies of a batch in order, with a grid synchronization between
+ * them.
+ */
+template <typename Vtable_T>
+__global__ void launch_batch_global_fcn(LaunchContext ctx,
+                                        const char* buffer,
+                                        int num_launches)
+{
+  const detail::LaunchBatchItem* items =
+      reinterpret_cast<const detail::LaunchBatchItem*>(buffer);
+  for (int i = 0; i < num_launches; ++i) {
+    if (i > 0) {
+      cooperative_groups::this_grid().sync();
+    }
+    items[i].call(buffer + items[i].offset, ctx);
+  }
+}
+
+namespace detail
+{
+
+template <bool async, int num_threads, size_t BLOCKS_PER_SM>
+struct LaunchBatchExecute<
+    RAJA::policy::cuda::expt::cuda_launch_explicit_t<async, num_threads, BLOCKS_PER_SM>> {
+
+  template <typename BODY_IN>
+  static bool enqueue(LaunchBatchQueue& queue,
+                      resources::Resource& res,
+                      Grid const& grid,
+                      BODY_IN const& body_in)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    cuda_dim_t gridSize{ static_cast<cuda_dim_member_t>(grid.teams.value[0]),
+                         static_cast<cuda_dim_member_t>(grid.teams.value[1]),
+                         static_cast<cuda_dim_member_t>(grid.teams.value[2]) };
+
+    cuda_dim_t blockSize{ static_cast<cuda_dim_member_t>(grid.threads.value[0]),
+                          static_cast<cuda_dim_member_t>(grid.threads.value[1]),
+                          static_cast<cuda_dim_member_t>(grid.threads.value[2]) };
+
+    const cuda_dim_member_t blocks = gridSize.x * gridSize.y * gridSize.z;
+    const cuda_dim_member_t threads = blockSize.x * blockSize.y * blockSize.z;
+    const bool clustered =
+        grid.clusters.value[0] * grid.clusters.value[1] * grid.clusters.value[2] > 1;
+    if (blocks == 0 || threads == 0 || clustered ||
+        !queue.compatible(grid) || !queue.fits(sizeof(BODY))) {
+      return false;
+    }
+
+    //
+    // All the teams of a batch must be resident for the grid
+    // synchronizations between its launches
+    //
+    const size_t shmem = std::max(grid.shared_mem_size,
+                                  queue.empty() ? size_t(0) : queue.grid().shared_mem_size);
+    auto func = launch_batch_global_fcn<LaunchBatchVtable>;
+    launch_shared_mem_setup((const void*)func, shmem);
+    if (static_cast<int>(blocks) >
+        launch_coresident_blocks((const void*)func, static_cast<int>(threads), shmem)) {
+      return false;
+    }
+
+    resources::Cuda cuda_res = res.get<RAJA::resources::Cuda>();
+
+    //
+    // Privatize the loop_body, using make_launch_body to setup reductions
+    //
+    BODY body = RAJA::cuda::make_launch_body(
+        gridSize, blockSize, shmem, cuda_res, body_in);
+
+    queue.push(grid,
+               RAJA::detail::get_cached_Vtable_cuda_device_call<BODY, LaunchBatchVtable>(),
+               std::move(body));
+    return true;
+  }
+
+  static void run(LaunchBatchQueue& queue,
+                  resources::Resource& res,
+                  char* device_buffer)
+  {
+    resources::Cuda cuda_res = res.get<RAJA::resources::Cuda>();
+
+    Grid const& grid = queue.grid();
+
+    cuda_dim_t gridSize{ static_cast<cuda_dim_member_t>(grid.teams.value[0]),
+                         static_cast<cuda_dim_member_t>(grid.teams.value[1]),
+                         static_cast<cuda_dim_member_t>(grid.teams.value[2]) };
+
+    cuda_dim_t blockSize{ static_cast<cuda_dim_member_t>(grid.threads.value[0]),
+                          static_cast<cuda_dim_member_t>(grid.threads.value[1]),
+                          static_cast<cuda_dim_member_t>(grid.threads.value[2]) };
+
+    RAJA_FT_BEGIN;
+
+    //
+    // The copy is ordered after the previous batch on the stream, so the
+    // device buffer is not overwritten while that batch runs
+    //
+    cudaErrchk(cudaMemcpyAsync(device_buffer,
+                               queue.data(),
+                               queue.bytes(),
+                               cudaMemcpyHostToDevice,
+                               cuda_res.get_stream()));
+
+    LaunchContext ctx(grid);
+    const char* buffer = device_buffer;
+    int num_launches = static_cast<int>(queue.size());
+    size_t shmem = grid.shared_mem_size;
+
+    void *args[] = {(void*)&ctx, (void*)&buffer, (void*)&num_launches};
+    RAJA::cuda::detail::prefetch_managed_ranges(cuda_res);
+    cudaErrchk(cudaLaunchCooperativeKernel((const void*)launch_batch_global_fcn<LaunchBatchVtable>,
+                                           gridSize, blockSize, args, shmem,
+                                           cuda_res.get_stream()));
+    RAJA::cuda::launch(cuda_res, async);
+
+    RAJA_FT_END;
+  }
+};
+
+}  // namespace detail
+
 /*
    CUDA global thread mapping
 */
@@ -0,0 +1,247 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining warp aggregated atomic operations for
+ *          CUDA
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_cuda_warp_atomic_HPP
+#define RAJA_policy_cuda_warp_atomic_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <type_traits>
+
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/reduce.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+#if defined(__CUDA_ARCH__) && defined(CUDART_VERSION) && CUDART_VERSION >= 9000
+
+#define RAJA_CUDA_WARP_AGGREGATED_ATOMICS
+
+RAJA_DEVICE RAJA_INLINE int cuda_warp_atomic_lane()
+{
+  int lane;
+  asm("mov.u32 %0, %%laneid;" : "=r"(lane));
+  return lane;
+}
+
+RAJA_DEVICE RAJA_INLINE unsigned cuda_warp_atomic_lanemask_lt()
+{
+  unsigned mask;
+  asm("mov.u32 %0, %%lanemask_lt;" : "=r"(mask));
+  return mask;
+}
+
+/*!
+ * Shuffle of any type among the lanes of mask, which must all call it
+ */
+template <typename T>
+RAJA_DEVICE RAJA_INLINE T cuda_warp_atomic_shfl(unsigned mask, T var, int srcLane)
+{
+  RAJA::cuda::impl::AsIntegerArray<T,
+                                   RAJA::cuda::impl::min_shfl_int_type_size,
+                                   RAJA::cuda::impl::max_shfl_int_type_size> u(var);
+
+  for (size_t i = 0; i < u.array_size(); ++i) {
+    u.array[i] = ::__shfl_sync(mask, u.array[i], srcLane);
+  }
+  return u.value;
+}
+
+/*!
+ * The lanes of active whose acc is the same as this lane's
+ */
+RAJA_DEVICE RAJA_INLINE unsigned cuda_warp_atomic_peers(unsigned active,
+                                                        void const volatile *acc)
+{
+  const unsigned long long addr = reinterpret_cast<unsigned long long>(acc);
+#if __CUDA_ARCH__ >= 700
+  return ::__match_any_sync(active, addr);
+#else
+  // take the address of the lowest remaining lane, until it is this lane's
+  unsigned remaining = active;
+  for (;;) {
+    const int leader = __ffs(remaining) - 1;
+    const unsigned long long leader_addr =
+        ::__shfl_sync(remaining, addr, leader);
+    const unsigned same = ::__ballot_sync(remaining, leader_addr == addr);
+    if (leader_addr == addr) {
+      return same;
+    }
+    remaining &= ~same;
+  }
+#endif
+}
+
+/*!
+ * Combines the values of the lanes of the warp with the same acc, and
+ * applies them with one call of atomic by the highest of those lanes.
+ *
+ * Each lane returns the value it would have seen if the lanes had done
+ * their atomics one after another in lane order: apply of the value before
+ * the combined atomic and the combined values of the lower lanes.
+ */
+template <typename T, typename Combine, typename Apply, typename Atomic>
+RAJA_DEVICE RAJA_INLINE T cuda_warp_aggregated_atomic(T volatile *acc,
+                                                      T value,
+                                                      Combine combine,
+                                                      Apply apply,
+                                                      Atomic atomic)
+{
+  const unsigned active = ::__activemask();
+  const unsigned peers = cuda_warp_atomic_peers(active, acc);
+  const unsigned lower = peers & cuda_warp_atomic_lanemask_lt();
+
+  const int lane = cuda_warp_atomic_lane();
+  const int prev = lower ? 31 - __clz(lower) : -1;
+  const int last = 31 - __clz(peers);
+
+  // inclusive scan over the peers in lane order, by pointer jumping, with
+  // every active lane shuffling in each step
+  T inclusive = value;
+  int pred = prev;
+  for (int step = 1; step < RAJA::policy::cuda::WARP_SIZE; step *= 2) {
+    const int src = pred < 0 ? lane : pred;
+    const T other = cuda_warp_atomic_shfl(active, inclusive, src);
+    const int other_pred = ::__shfl_sync(active, pred, src);
+    if (pred >= 0) {
+      inclusive = combine(other, inclusive);
+      pred = other_pred;
+    }
+  }
+  const T exclusive =
+      cuda_warp_atomic_shfl(active, inclusive, prev < 0 ? lane : prev);
+
+  T old = value;
+  if (lane == last) {
+    old = atomic(acc, inclusive);
+  }
+  old = cuda_warp_atomic_shfl(active, old, last);
+
+  return prev < 0 ? old : apply(old, exclusive);
+}
+
+#endif
+
+}  // namespace detail
+
+
+/*!
+ * Warp aggregated atomics: lanes that update the same address combine their
+ * values first, so that there is one atomic per address per warp.
+ *
+ * Add, Sub, Min, Max, And, Or, Xor, and Inc and Dec without a limit are
+ * aggregated, on top of the cuda_atomic_explicit atomics; the others are
+ * passed on to those unchanged.
+ */
+#define RAJA_CUDA_WARP_ATOMIC_AGGREGATED(NAME, COMBINE, APPLY)                \
+  RAJA_SUPPRESS_HD_WARN                                                       \
+  template <typename T, typename host_policy>                                 \
+  RAJA_INLINE RAJA_HOST_DEVICE T                                              \
+  NAME(cuda_warp_atomic_explicit<host_policy>, T volatile *acc, T value)      \
+  {                                                                           \
+    RAJA_CUDA_WARP_ATOMIC_BODY(NAME, COMBINE, APPLY, value)                   \
+  }
+
+#if defined(RAJA_CUDA_WARP_AGGREGATED_ATOMICS)
+#define RAJA_CUDA_WARP_ATOMIC_BODY(NAME, COMBINE, APPLY, VALUE)               \
+    return detail::cuda_warp_aggregated_atomic(                               \
+        acc, VALUE, COMBINE<T>{}, APPLY<T>{},                                 \
+        [](T volatile *a, T v) {                                              \
+          return RAJA::NAME(cuda_atomic_explicit<host_policy>{}, a, v);       \
+        });
+#else
+#define RAJA_CUDA_WARP_ATOMIC_BODY(NAME, COMBINE, APPLY, VALUE)               \
+    return RAJA::NAME(cuda_atomic_explicit<host_policy>{}, acc, VALUE);
+#endif
+
+RAJA_CUDA_WARP_ATOMIC_AGGREGATED(atomicAdd, RAJA::operators::plus, RAJA::operators::plus)
+RAJA_CUDA_WARP_ATOMIC_AGGREGATED(atomicSub, RAJA::operators::plus, RAJA::operators::minus)
+RAJA_CUDA_WARP_ATOMIC_AGGREGATED(atomicMin, RAJA::operators::minimum, RAJA::operators::minimum)
+RAJA_CUDA_WARP_ATOMIC_AGGREGATED(atomicMax, RAJA::operators::maximum, RAJA::operators::maximum)
+RAJA_CUDA_WARP_ATOMIC_AGGREGATED(atomicAnd, RAJA::operators::bit_and, RAJA::operators::bit_and)
+RAJA_CUDA_WARP_ATOMIC_AGGREGATED(atomicOr, RAJA::operators::bit_or, RAJA::operators::bit_or)
+RAJA_CUDA_WARP_ATOMIC_AGGREGATED(atomicXor, RAJA::operators::bit_xor, RAJA::operators::bit_xor)
+
+#undef RAJA_CUDA_WARP_ATOMIC_AGGREGATED
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(cuda_warp_atomic_explicit<host_policy>, T volatile *acc)
+{
+  RAJA_CUDA_WARP_ATOMIC_BODY(atomicAdd, RAJA::operators::plus, RAJA::operators::plus, T(1))
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(cuda_warp_atomic_explicit<host_policy>, T volatile *acc)
+{
+  RAJA_CUDA_WARP_ATOMIC_BODY(atomicSub, RAJA::operators::plus, RAJA::operators::minus, T(1))
+}
+
+#undef RAJA_CUDA_WARP_ATOMIC_BODY
+#undef RAJA_CUDA_WARP_AGGREGATED_ATOMICS
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(cuda_warp_atomic_explicit<host_policy>, T volatile *acc, T val)
+{
+  return RAJA::atomicInc(cuda_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(cuda_warp_atomic_explicit<host_policy>, T volatile *acc, T val)
+{
+  return RAJA::atomicDec(cuda_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(cuda_warp_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(cuda_warp_atomic_explicit<host_policy>, T volatile *acc, T compare, T value)
+{
+  return RAJA::atomicCAS(cuda_atomic_explicit<host_policy>{}, acc, compare, value);
+}
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_CUDA
+#endif  // guard
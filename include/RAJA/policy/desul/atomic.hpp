@@ -26,6 +26,20 @@ using raja_default_desul_scope = desul::MemoryScopeDevice;
 namespace RAJA
 {
 
+namespace detail
+{
+
+/*!
+ * The desul memory order and scope of the atomics of AtomicPolicy
+ */
+template <typename AtomicPolicy>
+struct desul_atomic_traits {
+  using order = raja_default_desul_order;
+  using scope = raja_default_desul_scope;
+};
+
+}  // namespace detail
+
 RAJA_SUPPRESS_HD_WARN
 template <typename AtomicPolicy, typename T>
 RAJA_HOST_DEVICE
@@ -33,8 +47,8 @@ RAJA_INLINE T
 atomicAdd(AtomicPolicy, T volatile *acc, T value) {
   return desul::atomic_fetch_add(const_cast<T*>(acc),
                                  value,
-                                 raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -44,8 +58,8 @@ RAJA_INLINE T
 atomicSub(AtomicPolicy, T volatile *acc, T value) {
   return desul::atomic_fetch_sub(const_cast<T*>(acc),
                                  value,
-                                 raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -55,8 +69,8 @@ RAJA_INLINE T atomicMin(AtomicPolicy, T volatile *acc, T value)
 {
   return desul::atomic_fetch_min(const_cast<T*>(acc),
                                  value,
-                                 raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -66,8 +80,8 @@ RAJA_INLINE T atomicMax(AtomicPolicy, T volatile *acc, T value)
 {
   return desul::atomic_fetch_max(const_cast<T*>(acc),
                                  value,
-                                 raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -76,8 +90,8 @@ RAJA_HOST_DEVICE
 RAJA_INLINE T atomicInc(AtomicPolicy, T volatile *acc)
 {
   return desul::atomic_fetch_inc(const_cast<T*>(acc),
-                                 raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -89,8 +103,8 @@ RAJA_INLINE T atomicInc(AtomicPolicy, T volatile *acc, T val)
   // http://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html#atomicinc
   return desul::atomic_wrapping_fetch_inc(const_cast<T*>(acc),
                                           val,
-                                          raja_default_desul_order{},
-                                          raja_default_desul_scope{});
+                                          typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                          typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -99,8 +113,8 @@ RAJA_HOST_DEVICE
 RAJA_INLINE T atomicDec(AtomicPolicy, T volatile *acc)
 {
   return desul::atomic_fetch_dec(const_cast<T*>(acc),
-                                 raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -112,8 +126,8 @@ RAJA_INLINE T atomicDec(AtomicPolicy, T volatile *acc, T val)
   // http://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html#atomicdec
   return desul::atomic_wrapping_fetch_dec(const_cast<T*>(acc),
                                           val,
-                                          raja_default_desul_order{},
-                                          raja_default_desul_scope{});
+                                          typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                          typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -123,8 +137,8 @@ RAJA_INLINE T atomicAnd(AtomicPolicy, T volatile *acc, T value)
 {
   return desul::atomic_fetch_and(const_cast<T*>(acc),
                                  value,
-                                 raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -134,8 +148,8 @@ RAJA_INLINE T atomicOr(AtomicPolicy, T volatile *acc, T value)
 {
   return desul::atomic_fetch_or(const_cast<T*>(acc),
                                 value,
-                                raja_default_desul_order{},
-                                raja_default_desul_scope{});
+                                typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -145,8 +159,8 @@ RAJA_INLINE T atomicXor(AtomicPolicy, T volatile *acc, T value)
 {
   return desul::atomic_fetch_xor(const_cast<T*>(acc),
                                  value,
-                                 raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                 typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -156,8 +170,8 @@ RAJA_INLINE T atomicExchange(AtomicPolicy, T volatile *acc, T value)
 {
   return desul::atomic_exchange(const_cast<T*>(acc),
                                 value,
-                                raja_default_desul_order{},
-                                raja_default_desul_scope{});
+                                typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -168,8 +182,8 @@ RAJA_INLINE T atomicCAS(AtomicPolicy, T volatile *acc, T compare, T value)
   return desul::atomic_compare_exchange(const_cast<T*>(acc),
                                         compare,
                                         value,
-                                        raja_default_desul_order{},
-                                        raja_default_desul_scope{});
+                                        typename detail::desul_atomic_traits<AtomicPolicy>::order{},
+                                        typename detail::desul_atomic_traits<AtomicPolicy>::scope{});
 }
 
 }  // namespace RAJA
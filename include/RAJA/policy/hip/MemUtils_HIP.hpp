@@ -23,11 +23,19 @@
 
 #if defined(RAJA_ENABLE_HIP)
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <typeindex>
+#include <typeinfo>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "RAJA/util/basic_mempool.hpp"
 #include "RAJA/util/mutex.hpp"
@@ -69,8 +77,45 @@ struct PinnedAllocator {
   }
 };
 
+//! Stream and event support for stream ordered frees in basic_mempool
+struct StreamOrderedAllocatorBase {
+
+  using stream_type = hipStream_t;
+  using event_type = hipEvent_t;
+
+  event_type create_event()
+  {
+    event_type event;
+    hipErrchk(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+    return event;
+  }
+
+  void destroy_event(event_type event) { hipErrchk(hipEventDestroy(event)); }
+
+  void record_event(event_type event, stream_type stream)
+  {
+    hipErrchk(hipEventRecord(event, stream));
+  }
+
+  // returns true if the work recorded in event has completed
+  bool event_complete(event_type event)
+  {
+    hipError_t err = hipEventQuery(event);
+    if (err == hipErrorNotReady) {
+      return false;
+    }
+    hipErrchk(err);
+    return true;
+  }
+
+  void synchronize_event(event_type event)
+  {
+    hipErrchk(hipEventSynchronize(event));
+  }
+};
+
 //! Allocator for device memory for use in basic_mempool
-struct DeviceAllocator {
+struct DeviceAllocator : StreamOrderedAllocatorBase {
 
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
@@ -90,7 +135,7 @@ struct DeviceAllocator {
 
 //! Allocator for pre-zeroed device memory for use in basic_mempool
 //  Note: Memory must be zero when returned to mempool
-struct DeviceZeroedAllocator {
+struct DeviceZeroedAllocator : StreamOrderedAllocatorBase {
 
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
@@ -109,20 +154,143 @@ struct DeviceZeroedAllocator {
   }
 };
 
+#if defined(RAJA_ENABLE_MALLOC_ASYNC) && \
+    !((HIP_VERSION_MAJOR > 5) || \
+      (HIP_VERSION_MAJOR == 5 && HIP_VERSION_MINOR >= 2))
+#error RAJA_ENABLE_MALLOC_ASYNC requires ROCm 5.2 or newer
+#endif
+
+#if (HIP_VERSION_MAJOR > 5) || \
+    (HIP_VERSION_MAJOR == 5 && HIP_VERSION_MINOR >= 2)
+//! Base for allocators using the stream ordered memory pool of the current
+//  device, requires ROCm 5.2 or newer
+//
+//  Arenas are shared by all streams, so allocations are made on a dedicated
+//  stream that is synchronized before the memory is handed out. Memory freed
+//  to the device pool is kept by the driver up to the release threshold, so
+//  arenas reallocated after MemPool::free_chunks are cheap.
+struct DeviceAsyncAllocatorBase : StreamOrderedAllocatorBase {
+
+  //! get the release threshold used by the device memory pool, in bytes
+  static uint64_t release_threshold()
+  {
+    return release_threshold_ref().load();
+  }
+
+  //! set the release threshold used by the device memory pool, in bytes,
+  //  applied on the next allocation, returns the previous threshold
+  static uint64_t release_threshold(uint64_t nbytes)
+  {
+    return release_threshold_ref().exchange(nbytes);
+  }
+
+protected:
+  static std::atomic<uint64_t>& release_threshold_ref()
+  {
+    // by default keep all freed memory in the device pool
+    static std::atomic<uint64_t> threshold{
+        std::numeric_limits<uint64_t>::max()};
+    return threshold;
+  }
+
+  stream_type get_alloc_stream()
+  {
+    if (m_alloc_stream == nullptr) {
+      hipErrchk(hipStreamCreateWithFlags(&m_alloc_stream, hipStreamNonBlocking));
+    }
+
+    int device;
+    hipErrchk(hipGetDevice(&device));
+    hipMemPool_t pool;
+    hipErrchk(hipDeviceGetDefaultMemPool(&pool, device));
+    uint64_t threshold = release_threshold();
+    hipErrchk(hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold));
+
+    return m_alloc_stream;
+  }
+
+  stream_type m_alloc_stream = nullptr;
+};
+
+//! Allocator for device memory from the device memory pool for use in
+//  basic_mempool
+struct DeviceAsyncAllocator : DeviceAsyncAllocatorBase {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    stream_type stream = get_alloc_stream();
+    void* ptr;
+    hipErrchk(hipMallocAsync(&ptr, nbytes, stream));
+    hipErrchk(hipStreamSynchronize(stream));
+    return ptr;
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    // the arena may be in use by work on any stream
+    hipErrchk(hipDeviceSynchronize());
+    hipErrchk(hipFreeAsync(ptr, get_alloc_stream()));
+    return true;
+  }
+};
+
+//! Allocator for pre-zeroed device memory from the device memory pool for use
+//  in basic_mempool
+//  Note: Memory must be zero when returned to mempool
+struct DeviceZeroedAsyncAllocator : DeviceAsyncAllocatorBase {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    stream_type stream = get_alloc_stream();
+    void* ptr;
+    hipErrchk(hipMallocAsync(&ptr, nbytes, stream));
+    hipErrchk(hipMemsetAsync(ptr, 0, nbytes, stream));
+    hipErrchk(hipStreamSynchronize(stream));
+    return ptr;
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    // the arena may be in use by work on any stream
+    hipErrchk(hipDeviceSynchronize());
+    hipErrchk(hipFreeAsync(ptr, get_alloc_stream()));
+    return true;
+  }
+};
+#endif
+
+#if defined(RAJA_ENABLE_MALLOC_ASYNC)
+using device_mempool_type = basic_mempool::MemPool<DeviceAsyncAllocator>;
+using device_zeroed_mempool_type =
+    basic_mempool::MemPool<DeviceZeroedAsyncAllocator>;
+#else
 using device_mempool_type = basic_mempool::MemPool<DeviceAllocator>;
 using device_zeroed_mempool_type =
     basic_mempool::MemPool<DeviceZeroedAllocator>;
+#endif
 using pinned_mempool_type = basic_mempool::MemPool<PinnedAllocator>;
 
+class AlgorithmWorkspace;
+
 namespace detail
 {
 
+class PinnedTallyBatch;
+
 //! struct containing data necessary to coordinate kernel launches with reducers
 struct hipInfo {
   hip_dim_t gridDim = 0;
   hip_dim_t blockDim = 0;
   ::RAJA::resources::Hip* res = nullptr;
   bool setup_reducers = false;
+  //! batch that reducers constructed on this thread take result slots from
+  PinnedTallyBatch* tally_batch = nullptr;
+  //! workspace sort and scan on this thread hold temporary storage in
+  AlgorithmWorkspace* workspace = nullptr;
 #if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
   hipInfo* thread_states = nullptr;
   omp::mutex lock;
@@ -156,6 +324,41 @@ extern hipInfo tl_status;
 // stream to synchronization status: true synchronized, false running
 extern std::unordered_map<hipStream_t, bool> g_stream_info_map;
 
+//! range of managed memory with a preferred location registered by the user
+struct ManagedRange {
+  const void* ptr;
+  size_t nbytes;
+  int device;
+  //! true if the range should be prefetched before the next launch
+  bool pending;
+};
+
+//! managed ranges with preferred locations, guarded by g_status.lock
+extern std::vector<ManagedRange> g_managed_ranges;
+
+//! number of ranges in g_managed_ranges waiting to be prefetched
+extern std::atomic<size_t> g_num_pending_prefetches;
+
+//! prefetch pending ranges that prefer the current device onto res
+RAJA_INLINE
+void prefetch_managed_ranges(::RAJA::resources::Hip res)
+{
+  if (g_num_pending_prefetches.load(std::memory_order_relaxed) == 0) return;
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+  lock_guard<omp::mutex> lock(g_status.lock);
+#endif
+  int device;
+  hipErrchk(hipGetDevice(&device));
+  for (ManagedRange& range : g_managed_ranges) {
+    if (range.pending && range.device == device) {
+      hipErrchk(hipMemPrefetchAsync(
+          range.ptr, range.nbytes, device, res.get_stream()));
+      range.pending = false;
+      g_num_pending_prefetches.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+}
+
 RAJA_INLINE
 void synchronize_impl(::RAJA::resources::Hip res)
 {
@@ -229,6 +432,7 @@ void launch(const void* func, hip_dim_t gridDim, hip_dim_t blockDim, void** args
   #else
     RAJA_UNUSED_VAR(name);
   #endif
+  detail::prefetch_managed_ranges(res);
   hipErrchk(hipLaunchKernel(func, dim3(gridDim), dim3(blockDim), args, shmem, res.get_stream()));
   #if defined(RAJA_ENABLE_ROCTX)
   if(name) roctxRangePop();
@@ -240,6 +444,109 @@ void launch(const void* func, hip_dim_t gridDim, hip_dim_t blockDim, void** args
 RAJA_INLINE
 void peekAtLastError() { hipErrchk(hipPeekAtLastError()); }
 
+/*!
+ * \brief Register a range of managed memory with a preferred location.
+ *
+ * Advises the driver that ptr[0, nbytes) prefers to live on device, which may
+ * be hipCpuDeviceId. Ranges that prefer a device are prefetched onto the
+ * stream of the next kernel launched on that device by forall, kernel, or
+ * launch, so the kernel does not take page faults on first touch.
+ */
+RAJA_INLINE
+void prefer_location(const void* ptr, size_t nbytes, int device)
+{
+  hipErrchk(hipMemAdvise(
+      ptr, nbytes, hipMemAdviseSetPreferredLocation, device));
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+  lock_guard<omp::mutex> lock(detail::g_status.lock);
+#endif
+  bool pending = (device != hipCpuDeviceId);
+  for (detail::ManagedRange& range : detail::g_managed_ranges) {
+    if (range.ptr == ptr) {
+      if (range.pending) {
+        detail::g_num_pending_prefetches.fetch_sub(1, std::memory_order_relaxed);
+      }
+      range = detail::ManagedRange{ptr, nbytes, device, pending};
+      if (pending) {
+        detail::g_num_pending_prefetches.fetch_add(1, std::memory_order_relaxed);
+      }
+      return;
+    }
+  }
+  detail::g_managed_ranges.push_back(
+      detail::ManagedRange{ptr, nbytes, device, pending});
+  if (pending) {
+    detail::g_num_pending_prefetches.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+//! Register a range of managed memory that prefers the current device
+RAJA_INLINE
+void prefer_location(const void* ptr, size_t nbytes)
+{
+  int device;
+  hipErrchk(hipGetDevice(&device));
+  prefer_location(ptr, nbytes, device);
+}
+
+//! Register the managed memory referenced by a View with a preferred location
+template <typename ViewType>
+RAJA_INLINE auto prefer_location(ViewType const& view, int device)
+    -> decltype(view.get_data(), view.get_layout().size(), void())
+{
+  using value_type = typename std::remove_pointer<
+      typename std::decay<decltype(view.get_data())>::type>::type;
+  prefer_location(static_cast<const void*>(view.get_data()),
+                  static_cast<size_t>(view.get_layout().size()) *
+                      sizeof(value_type),
+                  device);
+}
+
+/*!
+ * \brief Mark a registered range as touched on the host.
+ *
+ * The range is prefetched again before the next launch on its preferred
+ * device.
+ */
+RAJA_INLINE
+void mark_host_touched(const void* ptr)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+  lock_guard<omp::mutex> lock(detail::g_status.lock);
+#endif
+  for (detail::ManagedRange& range : detail::g_managed_ranges) {
+    if (range.ptr == ptr && !range.pending &&
+        range.device != hipCpuDeviceId) {
+      range.pending = true;
+      detail::g_num_pending_prefetches.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+//! Remove a registered range and its preferred location advice
+RAJA_INLINE
+void forget_location(const void* ptr)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+  lock_guard<omp::mutex> lock(detail::g_status.lock);
+#endif
+  for (auto iter = detail::g_managed_ranges.begin();
+       iter != detail::g_managed_ranges.end();
+       ++iter) {
+    if (iter->ptr == ptr) {
+      hipErrchk(hipMemAdvise(iter->ptr,
+                             iter->nbytes,
+                             hipMemAdviseUnsetPreferredLocation,
+                             iter->device));
+      if (iter->pending) {
+        detail::g_num_pending_prefetches.fetch_sub(1, std::memory_order_relaxed);
+      }
+      detail::g_managed_ranges.erase(iter);
+      return;
+    }
+  }
+}
+
 //! query whether reducers in this thread should setup for device execution now
 RAJA_INLINE
 bool setupReducers() { return detail::tl_status.setup_reducers; }
@@ -256,7 +563,220 @@ hip_dim_t currentBlockDim() { return detail::tl_status.blockDim; }
 RAJA_INLINE
 ::RAJA::resources::Hip* currentResource() { return detail::tl_status.res; }
 
-//! create copy of loop_body that is setup for device execution
+/*!
+ ******************************************************************************
+ *
+ * \brief  Scope object that holds sort and scan temporary storage across calls.
+ *
+ *         While an object of this type is alive on a thread, sort and scan
+ *         calls on that thread cache their temporary storage requirements by
+ *         (types, length, bit range, segments) instead of querying them
+ *         every call, and keep their temporary and double buffers instead of
+ *         returning them to device_mempool_type. Buffers are reused in stream
+ *         order and released by release() or at destruction. Workspaces nest,
+ *         the innermost one is used.
+ *
+ ******************************************************************************
+ */
+class AlgorithmWorkspace
+{
+public:
+  //! algorithm the temporary storage requirements are cached for
+  enum struct algorithm : int {
+    sort_keys,
+    sort_keys_descending,
+    sort_pairs,
+    sort_pairs_descending,
+    sort_keys_segmented,
+    sort_keys_segmented_descending,
+    sort_pairs_segmented,
+    sort_pairs_segmented_descending,
+    select,
+    select_descending,
+    argsort,
+    argsort_descending,
+    inclusive_scan,
+    exclusive_scan
+  };
+
+  using key_type = std::tuple<std::type_index, int, int, int, int, int>;
+
+  //! number of buffers held per workspace, temporary storage plus outputs
+  static const size_t num_buffers = 3;
+
+  //! make a key for the temporary storage requirements of an algorithm call
+  template <typename... Ts>
+  static key_type make_key(algorithm alg,
+                           int len,
+                           int begin_bit = 0,
+                           int end_bit = 0,
+                           int num_segments = 0)
+  {
+    return key_type{std::type_index(typeid(camp::list<Ts...>)),
+                    static_cast<int>(alg),
+                    len,
+                    begin_bit,
+                    end_bit,
+                    num_segments};
+  }
+
+  AlgorithmWorkspace() : m_prev(detail::tl_status.workspace)
+  {
+    detail::tl_status.workspace = this;
+  }
+
+  AlgorithmWorkspace(const AlgorithmWorkspace&) = delete;
+  AlgorithmWorkspace& operator=(const AlgorithmWorkspace&) = delete;
+
+  ~AlgorithmWorkspace()
+  {
+    release();
+    detail::tl_status.workspace = m_prev;
+  }
+
+  //! return held buffers to the pool, cached requirements are kept
+  void release()
+  {
+    for (buffer& b : m_buffers) {
+      if (b.ptr) {
+        device_mempool_type::getInstance().stream_free(b.ptr, b.stream);
+        b = buffer{};
+      }
+    }
+  }
+
+  //! hold at least nbytes of temporary storage for calls on stream
+  void reserve(size_t nbytes, hipStream_t stream)
+  {
+    get_buffer(0, nbytes, stream);
+  }
+
+  //! get cached temporary storage bytes for key, returns false if not cached
+  bool find_temp_storage_bytes(key_type const& key, size_t& nbytes) const
+  {
+    auto iter = m_temp_storage_bytes.find(key);
+    if (iter == m_temp_storage_bytes.end()) return false;
+    nbytes = iter->second;
+    return true;
+  }
+
+  //! cache temporary storage bytes for key
+  void cache_temp_storage_bytes(key_type const& key, size_t nbytes)
+  {
+    m_temp_storage_bytes[key] = nbytes;
+  }
+
+  //! get buffer slot with at least nbytes for use on stream
+  void* get_buffer(size_t slot, size_t nbytes, hipStream_t stream)
+  {
+    buffer& b = m_buffers[slot];
+    if (b.ptr && (b.nbytes < nbytes || b.stream != stream)) {
+      device_mempool_type::getInstance().stream_free(b.ptr, b.stream);
+      b = buffer{};
+    }
+    if (!b.ptr) {
+      b.ptr = device_mempool_type::getInstance().stream_malloc<unsigned char>(
+          nbytes, stream);
+      b.nbytes = nbytes;
+      b.stream = stream;
+    }
+    return b.ptr;
+  }
+
+private:
+  struct buffer {
+    void* ptr = nullptr;
+    size_t nbytes = 0;
+    hipStream_t stream = nullptr;
+  };
+
+  buffer m_buffers[num_buffers];
+  std::map<key_type, size_t> m_temp_storage_bytes;
+  AlgorithmWorkspace* m_prev;
+};
+
+namespace detail
+{
+
+//! get device memory for algorithm buffer slot, held by the current workspace
+template <typename T>
+RAJA_INLINE T* algorithm_malloc(size_t slot, size_t nTs, hipStream_t stream)
+{
+  AlgorithmWorkspace* ws = tl_status.workspace;
+  if (ws) {
+    return static_cast<T*>(ws->get_buffer(slot, nTs * sizeof(T), stream));
+  }
+  return device_mempool_type::getInstance().stream_malloc<T>(nTs, stream);
+}
+
+//! free device memory from algorithm_malloc unless held by the workspace
+RAJA_INLINE
+void algorithm_free(void* ptr, hipStream_t stream)
+{
+  if (!tl_status.workspace) {
+    device_mempool_type::getInstance().stream_free(ptr, stream);
+  }
+}
+
+//! get cached temporary storage bytes, returns false if not cached
+RAJA_INLINE
+bool find_temp_storage_bytes(AlgorithmWorkspace::key_type const& key,
+                             size_t& nbytes)
+{
+  AlgorithmWorkspace* ws = tl_status.workspace;
+  return ws && ws->find_temp_storage_bytes(key, nbytes);
+}
+
+//! cache temporary storage bytes in the current workspace, if there is one
+RAJA_INLINE
+void cache_temp_storage_bytes(AlgorithmWorkspace::key_type const& key,
+                              size_t nbytes)
+{
+  AlgorithmWorkspace* ws = tl_status.workspace;
+  if (ws) ws->cache_temp_storage_bytes(key, nbytes);
+}
+
+//! copy loop_body with the launch state reducers read when copied set up
+template <typename LOOP_BODY>
+RAJA_INLINE typename std::remove_reference<LOOP_BODY>::type make_launch_body_impl(
+    hip_dim_t gridDim,
+    hip_dim_t blockDim,
+    ::RAJA::resources::Hip& res,
+    LOOP_BODY&& loop_body,
+    std::true_type)
+{
+  SetterResetter<bool> setup_reducers_srer(tl_status.setup_reducers, true);
+  SetterResetter<::RAJA::resources::Hip*> res_srer(tl_status.res, &res);
+
+  tl_status.gridDim = gridDim;
+  tl_status.blockDim = blockDim;
+
+  using return_type = typename std::remove_reference<LOOP_BODY>::type;
+  return return_type(std::forward<LOOP_BODY>(loop_body));
+}
+
+//! a trivially copyable body captures no reducers, so it is just copied
+template <typename LOOP_BODY>
+RAJA_INLINE typename std::remove_reference<LOOP_BODY>::type make_launch_body_impl(
+    hip_dim_t,
+    hip_dim_t,
+    ::RAJA::resources::Hip&,
+    LOOP_BODY&& loop_body,
+    std::false_type)
+{
+  using return_type = typename std::remove_reference<LOOP_BODY>::type;
+  return return_type(std::forward<LOOP_BODY>(loop_body));
+}
+
+}  // namespace detail
+
+/*!
+ * create copy of loop_body that is setup for device execution
+ *
+ * Reducers register with the launch when they are copied, so their copy
+ * constructors are not trivial; the launch state is only set up for bodies
+ * that are not trivially copyable.
+ */
 template <typename LOOP_BODY>
 RAJA_INLINE typename std::remove_reference<LOOP_BODY>::type make_launch_body(
     hip_dim_t gridDim,
@@ -265,16 +785,15 @@ RAJA_INLINE typename std::remove_reference<LOOP_BODY>::type make_launch_body(
     ::RAJA::resources::Hip res,
     LOOP_BODY&& loop_body)
 {
-  detail::SetterResetter<bool> setup_reducers_srer(
-      detail::tl_status.setup_reducers, true);
-  detail::SetterResetter<::RAJA::resources::Hip*> res_srer(
-      detail::tl_status.res, &res);
-
-  detail::tl_status.gridDim = gridDim;
-  detail::tl_status.blockDim = blockDim;
-
   using return_type = typename std::remove_reference<LOOP_BODY>::type;
-  return return_type(std::forward<LOOP_BODY>(loop_body));
+  return detail::make_launch_body_impl(
+      gridDim,
+      blockDim,
+      res,
+      std::forward<LOOP_BODY>(loop_body),
+      std::integral_constant<
+          bool,
+          !std::is_trivially_copyable<camp::decay<return_type>>::value>{});
 }
 
 RAJA_INLINE
@@ -294,6 +813,32 @@ hipDeviceProp_t& device_prop()
   return prop;
 }
 
+/*!
+ * Launch a kernel whose blocks all run at the same time, so they can
+ * synchronize with cooperative_groups::this_grid().sync(). The grid must fit
+ * in the blocks that can be resident at once.
+ */
+RAJA_INLINE
+void launch_cooperative(const void* func, hip_dim_t gridDim, hip_dim_t blockDim,
+                        void** args, size_t shmem, ::RAJA::resources::Hip res,
+                        bool async = true, const char *name = nullptr)
+{
+  if (!device_prop().cooperativeLaunch) {
+    RAJA_ABORT_OR_THROW("RAJA::hip::launch_cooperative: the device does not support cooperative launch");
+  }
+  #if defined(RAJA_ENABLE_ROCTX)
+  if(name) roctxRangePush(name);
+  #else
+    RAJA_UNUSED_VAR(name);
+  #endif
+  detail::prefetch_managed_ranges(res);
+  hipErrchk(hipLaunchCooperativeKernel(func, dim3(gridDim), dim3(blockDim), args, shmem, res.get_stream()));
+  #if defined(RAJA_ENABLE_ROCTX)
+  if(name) roctxRangePop();
+  #endif
+  launch(res, async);
+}
+
 }  // namespace hip
 
 }  // namespace RAJA
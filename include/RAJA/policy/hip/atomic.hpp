@@ -44,6 +44,13 @@ namespace RAJA
 namespace detail
 {
 
+/*!
+ * Device locks of the 16 byte compare and swap, one table per translation
+ * unit, so 16 byte values must not be updated by kernels of different
+ * translation units at the same time.
+ */
+static __device__ unsigned hip_atomic_wide_locks[atomic_wide_num_locks];
+
 /*!
  * Generic impementation of atomic 32-bit or 64-bit compare and swap primitive.
  * Implementation uses the existing HIP supplied unsigned 32-bit and 64-bit
@@ -88,6 +95,40 @@ hip_atomic_CAS(T volatile *acc, T compare, T value)
           RAJA::util::reinterp_A_as_B<T, unsigned long long>(value)));
 }
 
+///
+/*!
+ * Compare and swap of 16 byte values, T must be trivially copyable and
+ * aligned to 16 bytes.  HIP has no 128-bit atomicCAS, so this takes a lock
+ * from a table of locks indexed by the address.  The lock is taken and
+ * released in the same iteration of the loop so threads of a wavefront that
+ * hash to the same lock make progress.  The comparison is bitwise.
+ */
+template <typename T>
+RAJA_INLINE __device__
+typename std::enable_if<sizeof(T) == 16, T>::type
+hip_atomic_CAS(T volatile *acc, T compare, T value)
+{
+  unsigned *lock = &hip_atomic_wide_locks[atomic_wide_lock_index(acc)];
+  atomic_wide_words old;
+  bool done = false;
+  while (!done) {
+    if (::atomicCAS(lock, 0u, 1u) == 0u) {
+      __threadfence();
+      old = atomic_wide_load(acc);
+      if (atomic_wide_equal(
+              old,
+              RAJA::util::reinterp_A_as_B<T, atomic_wide_words>(compare))) {
+        atomic_wide_store(
+            acc, RAJA::util::reinterp_A_as_B<T, atomic_wide_words>(value));
+      }
+      __threadfence();
+      ::atomicExch(lock, 0u);
+      done = true;
+    }
+  }
+  return RAJA::util::reinterp_A_as_B<atomic_wide_words, T>(old);
+}
+
 template <size_t BYTES>
 struct HipAtomicCAS {
 };
@@ -323,6 +364,76 @@ RAJA_INLINE __device__ unsigned long long hip_atomicMax<unsigned long long>(
 }
 #endif
 
+// float and double atomicMin and atomicMax with the integer atomics on their
+// bits instead of CAS loops: values with the sign bit clear order like their
+// bits as signed integers, and values with the sign bit set order in reverse
+// of their bits as unsigned integers. NaNs are ordered by their bits.
+#if __HIP_ARCH_HAS_GLOBAL_INT32_ATOMICS__
+template <>
+RAJA_INLINE __device__ float hip_atomicMin<float>(float volatile *acc,
+                                                  float value)
+{
+  return (__float_as_int(value) < 0)
+      ? __uint_as_float(::atomicMax((unsigned *)acc, __float_as_uint(value)))
+      : __int_as_float(::atomicMin((int *)acc, __float_as_int(value)));
+}
+
+template <>
+RAJA_INLINE __device__ float hip_atomicMax<float>(float volatile *acc,
+                                                  float value)
+{
+  return (__float_as_int(value) < 0)
+      ? __uint_as_float(::atomicMin((unsigned *)acc, __float_as_uint(value)))
+      : __int_as_float(::atomicMax((int *)acc, __float_as_int(value)));
+}
+#endif
+
+#if defined(RAJA_ENABLE_HIP_UNSAFE_FP_ATOMICS) && \
+    (defined(__gfx90a__) || defined(__gfx940__) || \
+     defined(__gfx941__) || defined(__gfx942__))
+// native 64-bit float atomicMin and atomicMax, which only work on coarse
+// grained memory
+template <>
+RAJA_INLINE __device__ double hip_atomicMin<double>(double volatile *acc,
+                                                    double value)
+{
+  return ::unsafeAtomicMin((double *)acc, value);
+}
+
+template <>
+RAJA_INLINE __device__ double hip_atomicMax<double>(double volatile *acc,
+                                                    double value)
+{
+  return ::unsafeAtomicMax((double *)acc, value);
+}
+#elif __HIP_ARCH_HAS_GLOBAL_INT64_ATOMICS__
+template <>
+RAJA_INLINE __device__ double hip_atomicMin<double>(double volatile *acc,
+                                                    double value)
+{
+  const long long bits = __double_as_longlong(value);
+  return (bits < 0)
+      ? __longlong_as_double(static_cast<long long>(
+            ::atomicMax((unsigned long long *)acc,
+                        static_cast<unsigned long long>(bits))))
+      : __longlong_as_double(
+            __atomic_fetch_min((long long *)acc, bits, __ATOMIC_RELAXED));
+}
+
+template <>
+RAJA_INLINE __device__ double hip_atomicMax<double>(double volatile *acc,
+                                                    double value)
+{
+  const long long bits = __double_as_longlong(value);
+  return (bits < 0)
+      ? __longlong_as_double(static_cast<long long>(
+            ::atomicMin((unsigned long long *)acc,
+                        static_cast<unsigned long long>(bits))))
+      : __longlong_as_double(
+            __atomic_fetch_max((long long *)acc, bits, __ATOMIC_RELAXED));
+}
+#endif
+
 template <typename T>
 RAJA_INLINE __device__ T hip_atomicInc(T volatile *acc, T val)
 {
@@ -27,6 +27,9 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
 #include "hip/hip_runtime.h"
 
 #include "RAJA/pattern/forall.hpp"
@@ -70,6 +73,25 @@ hip_dim_t getGridDim(hip_dim_member_t len, hip_dim_t blockDim)
   return gridSize;
 }
 
+/*!
+ * Number of blocks of func, of block_threads threads without dynamic shared
+ * memory, that can be resident on the device at once
+ */
+RAJA_INLINE
+hip_dim_member_t max_resident_blocks(const void* func, int block_threads)
+{
+  int blocks_per_sm = 0;
+#ifdef RAJA_ENABLE_HIP_OCCUPANCY_CALCULATOR
+  hipErrchk(hipOccupancyMaxActiveBlocksPerMultiprocessor(
+      &blocks_per_sm, func, block_threads, 0));
+#else
+  RAJA_UNUSED_VAR(func);
+  RAJA_UNUSED_VAR(block_threads);
+#endif
+  return static_cast<hip_dim_member_t>(
+      std::max(blocks_per_sm, 1) * RAJA::hip::device_prop().multiProcessorCount);
+}
+
 /*!
  ******************************************************************************
  *
@@ -145,6 +167,411 @@ __launch_bounds__(BlockSize, 1) __global__
   }
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP kernal forall template for a grid-stride loop, each thread
+ *         runs ItemsPerThread iterations in each pass over the grid.
+ *
+ *         Item k of a thread is k grid widths after its first, so each item
+ *         is coalesced across the threads of a wavefront.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          size_t ItemsPerThread,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_hip_grid_stride_kernel(LOOP_BODY loop_body,
+                                       const Iterator idx,
+                                       IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  const auto stride = static_cast<IndexType>(BlockSize * gridDim.x);
+  const auto last_item = stride * static_cast<IndexType>(ItemsPerThread - 1);
+  auto ii = static_cast<IndexType>(getGlobalIdx_1D_1D());
+  // full passes, with the items of a thread independent of each other
+  for (; ii + last_item < length;
+       ii += stride * static_cast<IndexType>(ItemsPerThread)) {
+    RAJA_UNROLL
+    for (size_t k = 0; k < ItemsPerThread; ++k) {
+      body(idx[ii + static_cast<IndexType>(k) * stride]);
+    }
+  }
+  for (; ii < length; ii += stride) {
+    body(idx[ii]);
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP kernal forall template for a range whose indices fit in int.
+ *
+ *         The index is computed in 32 bits and converted to the value type
+ *         of the range for the body.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          typename Iterator,
+          typename LOOP_BODY>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_hip_kernel_int(LOOP_BODY loop_body,
+                               int first,
+                               int length)
+{
+  using value_type = camp::decay<decltype(*std::declval<Iterator>())>;
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto ii = static_cast<int>(getGlobalIdx_1D_1D());
+  if (ii < length) {
+    body(static_cast<value_type>(first + ii));
+  }
+}
+
+//! launch the forall kernel with the body and the iterator as arguments
+template <size_t BlockSize,
+          bool Async,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+RAJA_INLINE void launch_forall(LOOP_BODY& body,
+                               Iterator begin,
+                               IndexType len,
+                               hip_dim_t gridSize,
+                               size_t shmem,
+                               resources::Hip res,
+                               std::false_type)
+{
+  auto func = forall_hip_kernel<BlockSize, Iterator, LOOP_BODY, IndexType>;
+
+  void *args[] = {(void*)&body, (void*)&begin, (void*)&len};
+  RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, res, Async);
+}
+
+//! ranges of wide indices that fit in int are run with 32 bit index math
+template <size_t BlockSize,
+          bool Async,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+RAJA_INLINE void launch_forall(LOOP_BODY& body,
+                               Iterator begin,
+                               IndexType len,
+                               hip_dim_t gridSize,
+                               size_t shmem,
+                               resources::Hip res,
+                               std::true_type)
+{
+  if (!RAJA::Iterators::range_fits_int(begin, len)) {
+    launch_forall<BlockSize, Async>(
+        body, begin, len, gridSize, shmem, res, std::false_type{});
+    return;
+  }
+
+  auto func = forall_hip_kernel_int<BlockSize, Iterator, LOOP_BODY>;
+
+  int first = static_cast<int>(RAJA::stripIndexType(*begin));
+  int length = static_cast<int>(len);
+  void *args[] = {(void*)&body, (void*)&first, (void*)&length};
+  RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, res, Async);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Device table of the segments of an index set.
+ *
+ *         Segment seg starts at position icounts[seg] of the index set, has
+ *         segment type types[seg] and begins at camp::get<type>(iters)[seg].
+ *         icounts[num_segs] is the length of the index set.
+ *
+ ******************************************************************************
+ */
+template <typename... Iterators>
+struct SegmentTable {
+  static constexpr camp::idx_t num_types = sizeof...(Iterators);
+
+  const Index_type* icounts;
+  const int* types;
+  camp::tuple<const Iterators*...> iters;
+  Index_type num_segs;
+};
+
+//! position of segment type T in the segment types of an index set
+template <typename T, typename... Ts>
+struct segment_type_index;
+
+template <typename T, typename... Ts>
+struct segment_type_index<T, T, Ts...> : camp::num<0> {
+};
+
+template <typename T, typename U, typename... Ts>
+struct segment_type_index<T, U, Ts...>
+    : camp::num<1 + segment_type_index<T, Ts...>::value> {
+};
+
+//! calls body with the index, and its position in the index set if Icount
+template <bool Icount>
+struct SegmentBodyCall {
+  template <typename Body, typename T>
+  static __device__ __forceinline__ void call(Body& body, Index_type, T&& idx)
+  {
+    body(idx);
+  }
+};
+
+template <>
+struct SegmentBodyCall<true> {
+  template <typename Body, typename T>
+  static __device__ __forceinline__ void call(Body& body,
+                                              Index_type icount,
+                                              T&& idx)
+  {
+    body(icount, idx);
+  }
+};
+
+//! runs index offset of segment seg, which has segment type K or above
+template <bool Icount, camp::idx_t K, camp::idx_t N>
+struct SegmentTableDispatch {
+  template <typename Table, typename Body>
+  static __device__ __forceinline__ void call(Table const& table,
+                                              int type,
+                                              Index_type seg,
+                                              Index_type offset,
+                                              Index_type icount,
+                                              Body& body)
+  {
+    if (type == K) {
+      SegmentBodyCall<Icount>::call(body,
+                                    icount,
+                                    camp::get<K>(table.iters)[seg][offset]);
+    } else {
+      SegmentTableDispatch<Icount, K + 1, N>::call(
+          table, type, seg, offset, icount, body);
+    }
+  }
+};
+
+template <bool Icount, camp::idx_t N>
+struct SegmentTableDispatch<Icount, N, N> {
+  template <typename Table, typename Body>
+  static __device__ __forceinline__ void call(Table const&,
+                                              int,
+                                              Index_type,
+                                              Index_type,
+                                              Index_type,
+                                              Body&)
+  {
+  }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP kernel forall template over all segments of an index set,
+ *         each thread finds its segment with a binary search of the table.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          bool Icount,
+          typename Table,
+          typename LOOP_BODY>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_hip_segments_kernel(LOOP_BODY loop_body,
+                                    const Table table,
+                                    Index_type length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto ii = static_cast<Index_type>(getGlobalIdx_1D_1D());
+  if (ii < length) {
+    // last segment starting at or before ii, this skips empty segments
+    Index_type seg = 0;
+    Index_type count = table.num_segs;
+    while (count > 0) {
+      const Index_type step = count / 2;
+      if (table.icounts[seg + step] <= ii) {
+        seg += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    --seg;
+
+    SegmentTableDispatch<Icount, 0, Table::num_types>::call(
+        table, table.types[seg], seg, ii - table.icounts[seg], ii, body);
+  }
+}
+
+//! writes the type and begin iterator of a segment to the host table
+template <typename... SegmentTypes>
+struct SegmentTableFill {
+  unsigned char* buf;
+  const size_t* iter_offsets;
+  int* types;
+  Index_type seg;
+
+  template <typename T>
+  void operator()(T const& segment) const
+  {
+    constexpr camp::idx_t type = segment_type_index<T, SegmentTypes...>::value;
+    using iterator = camp::decay<decltype(segment.begin())>;
+    const iterator begin = segment.begin();
+    std::memcpy(buf + iter_offsets[type] + seg * sizeof(iterator),
+           &begin,
+           sizeof(iterator));
+    types[seg] = static_cast<int>(type);
+  }
+};
+
+template <typename... Iterators, camp::idx_t... Is>
+RAJA_INLINE SegmentTable<Iterators...> make_segment_table(
+    unsigned char* dev_buf,
+    size_t icounts_offset,
+    size_t types_offset,
+    const size_t* iter_offsets,
+    Index_type num_segs,
+    camp::idx_seq<Is...>)
+{
+  return SegmentTable<Iterators...>{
+      reinterpret_cast<const Index_type*>(dev_buf + icounts_offset),
+      reinterpret_cast<const int*>(dev_buf + types_offset),
+      camp::tuple<const Iterators*...>{
+          reinterpret_cast<const Iterators*>(dev_buf + iter_offsets[Is])...},
+      num_segs};
+}
+
+//! byte offset of an array of n Ts placed after nbytes, nbytes is updated
+template <typename T>
+RAJA_INLINE size_t place_segment_table_array(size_t& nbytes, Index_type n)
+{
+  const size_t offset = RAJA_DIVIDE_CEILING_INT(nbytes, alignof(T)) * alignof(T);
+  nbytes = offset + static_cast<size_t>(n) * sizeof(T);
+  return offset;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Run all segments of iset in one kernel launch.
+ *
+ *         The table of the segments is built on the host and copied to
+ *         device memory from the pool, which is freed on the stream after the
+ *         launch.
+ *
+ ******************************************************************************
+ */
+template <bool Icount,
+          size_t BlockSize,
+          bool Async,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE void forall_segments(
+    resources::Hip res,
+    hip_exec<BlockSize, Async>,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    LoopBody&& loop_body)
+{
+  using Table = SegmentTable<
+      camp::decay<decltype(std::declval<SegmentTypes const&>().begin())>...>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+
+  auto func = impl::forall_hip_segments_kernel<BlockSize, Icount, Table, LOOP_BODY>;
+
+  const Index_type num_segs = static_cast<Index_type>(iset.getNumSegments());
+  const Index_type len = static_cast<Index_type>(iset.getLength());
+
+  // Only launch kernel if we have something to iterate over
+  if (len <= 0 || BlockSize == 0) return;
+
+  //
+  // Lay out the table, icounts then types then the iterator arrays
+  //
+  size_t nbytes = 0;
+  const size_t icounts_offset =
+      place_segment_table_array<Index_type>(nbytes, num_segs + 1);
+  const size_t types_offset = place_segment_table_array<int>(nbytes, num_segs);
+  const size_t iter_offsets[] = {place_segment_table_array<
+      camp::decay<decltype(std::declval<SegmentTypes const&>().begin())>>(
+      nbytes, num_segs)...};
+
+  std::vector<unsigned char> host_buf(nbytes);
+  Index_type* icounts =
+      reinterpret_cast<Index_type*>(host_buf.data() + icounts_offset);
+  int* types = reinterpret_cast<int*>(host_buf.data() + types_offset);
+  for (Index_type seg = 0; seg < num_segs; ++seg) {
+    icounts[seg] = iset.getSegmentIcounts()[seg];
+    iset.segmentCall(seg,
+                     SegmentTableFill<SegmentTypes...>{host_buf.data(),
+                                                        iter_offsets,
+                                                        types,
+                                                        seg});
+  }
+  icounts[num_segs] = len;
+
+  hipStream_t stream = res.get_stream();
+  unsigned char* dev_buf =
+      RAJA::hip::device_mempool_type::getInstance().stream_malloc<unsigned char>(
+          nbytes, stream, alignof(std::max_align_t));
+  hipErrchk(hipMemcpyAsync(dev_buf,
+                              host_buf.data(),
+                              nbytes,
+                              hipMemcpyHostToDevice,
+                              stream));
+
+  const Table table = make_segment_table<
+      camp::decay<decltype(std::declval<SegmentTypes const&>().begin())>...>(
+      dev_buf,
+      icounts_offset,
+      types_offset,
+      iter_offsets,
+      num_segs,
+      camp::make_idx_seq_t<sizeof...(SegmentTypes)>{});
+
+  //
+  // Compute the number of blocks
+  //
+  hip_dim_t blockSize{BlockSize, 1, 1};
+  hip_dim_t gridSize = getGridDim(static_cast<hip_dim_member_t>(len), blockSize);
+
+  RAJA_FT_BEGIN;
+
+  //
+  // Setup shared memory buffers
+  //
+  size_t shmem = 0;
+
+  {
+    //
+    // Privatize the loop_body, using make_launch_body to setup reductions
+    //
+    LOOP_BODY body = RAJA::hip::make_launch_body(
+        gridSize, blockSize, shmem, res, std::forward<LoopBody>(loop_body));
+
+    //
+    // Launch the kernel
+    //
+    Index_type length = len;
+    void *args[] = {(void*)&body, (void*)&table, (void*)&length};
+    RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, res, Async);
+  }
+
+  RAJA_FT_END;
+
+  RAJA::hip::device_mempool_type::getInstance().stream_free(dev_buf, stream);
+}
+
 }  // namespace impl
 
 //
@@ -165,8 +592,6 @@ RAJA_INLINE resources::EventProxy<resources::Hip> forall_impl(resources::Hip hip
   using LOOP_BODY = camp::decay<LoopBody>;
   using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
 
-  auto func = impl::forall_hip_kernel<BlockSize, Iterator, LOOP_BODY, IndexType>;
-
   //
   // Compute the requested iteration space size
   //
@@ -205,6 +630,71 @@ RAJA_INLINE resources::EventProxy<resources::Hip> forall_impl(resources::Hip hip
       //
       // Launch the kernels
       //
+      impl::launch_forall<BlockSize, Async>(
+          body, begin, len, gridSize, shmem, hip_res,
+          RAJA::Iterators::is_wide_numeric_iterator<Iterator>{});
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+template <typename Iterable,
+          typename LoopBody,
+          size_t BlockSize,
+          size_t ItemsPerThread,
+          bool Async>
+RAJA_INLINE resources::EventProxy<resources::Hip> forall_impl(resources::Hip hip_res,
+                                                    hip_exec_grid_stride_explicit<BlockSize, ItemsPerThread, Async>,
+                                                    Iterable&& iter,
+                                                    LoopBody&& loop_body)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+  auto func = impl::forall_hip_grid_stride_kernel<BlockSize, ItemsPerThread,
+                                                  Iterator, LOOP_BODY, IndexType>;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+    //
+    // Compute the number of blocks, no more than can be resident at once
+    //
+    static const hip_dim_member_t max_blocks =
+        impl::max_resident_blocks((const void*)func, static_cast<int>(BlockSize));
+    constexpr hip_dim_member_t items_per_block = BlockSize * ItemsPerThread;
+    const hip_dim_member_t num_blocks =
+        (static_cast<hip_dim_member_t>(len) + items_per_block - 1) / items_per_block;
+    hip_dim_t blockSize{BlockSize, 1, 1};
+    hip_dim_t gridSize{std::min(num_blocks, max_blocks), 1, 1};
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::hip::make_launch_body(
+          gridSize, blockSize, shmem, hip_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernel
+      //
       void *args[] = {(void*)&body, (void*)&begin, (void*)&len};
       RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, hip_res, Async);
     }
@@ -215,6 +705,7 @@ RAJA_INLINE resources::EventProxy<resources::Hip> forall_impl(resources::Hip hip
   return resources::EventProxy<resources::Hip>(hip_res);
 }
 
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -256,6 +747,44 @@ forall_impl(resources::Hip r,
   return resources::EventProxy<resources::Hip>(r);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Run all segments of index set in one HIP kernel launch, each
+ *         thread runs one index of the index set.
+ *
+ ******************************************************************************
+ */
+template <typename LoopBody,
+          size_t BlockSize,
+          bool Async,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Hip>
+forall_impl(resources::Hip r,
+            hip_single_launch_segit,
+            hip_exec<BlockSize, Async> pol,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            LoopBody&& loop_body)
+{
+  impl::forall_segments<false>(r, pol, iset, std::forward<LoopBody>(loop_body));
+  return resources::EventProxy<resources::Hip>(r);
+}
+
+template <typename LoopBody,
+          size_t BlockSize,
+          bool Async,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Hip>
+forall_Icount_impl(resources::Hip r,
+                   hip_single_launch_segit,
+                   hip_exec<BlockSize, Async> pol,
+                   const TypedIndexSet<SegmentTypes...>& iset,
+                   LoopBody&& loop_body)
+{
+  impl::forall_segments<true>(r, pol, iset, std::forward<LoopBody>(loop_body));
+  return resources::EventProxy<resources::Hip>(r);
+}
+
 }  // namespace hip
 
 }  // namespace policy
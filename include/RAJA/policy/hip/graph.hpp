@@ -0,0 +1,167 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the HIP graph recorder and graph.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_graph_hip_HPP
+#define RAJA_graph_hip_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <hip/hip_runtime.h>
+
+#include "RAJA/pattern/graph.hpp"
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief A HIP graph, launched as a whole on a stream.
+ */
+template <>
+class Graph<resources::Hip>
+{
+public:
+  Graph(resources::Hip res, hipGraph_t graph, hipGraphExec_t exec)
+      : m_res(res), m_graph(graph), m_exec(exec)
+  {
+  }
+
+  Graph(Graph const&) = delete;
+  Graph& operator=(Graph const&) = delete;
+
+  Graph(Graph&& other)
+      : m_res(other.m_res), m_graph(other.m_graph), m_exec(other.m_exec)
+  {
+    other.m_graph = nullptr;
+    other.m_exec = nullptr;
+  }
+
+  Graph& operator=(Graph&& other)
+  {
+    if (this != &other) {
+      destroy();
+      m_res = other.m_res;
+      m_graph = other.m_graph;
+      m_exec = other.m_exec;
+      other.m_graph = nullptr;
+      other.m_exec = nullptr;
+    }
+    return *this;
+  }
+
+  ~Graph() { destroy(); }
+
+  /*!
+   * \brief Launch the graph on the resource it was recorded on.
+   */
+  resources::EventProxy<resources::Hip> launch() { return launch(m_res); }
+
+  /*!
+   * \brief Launch the graph on res.
+   */
+  resources::EventProxy<resources::Hip> launch(resources::Hip res)
+  {
+    hipErrchk(hipGraphLaunch(m_exec, res.get_stream()));
+    ::RAJA::hip::launch(res, true);
+    return resources::EventProxy<resources::Hip>(res);
+  }
+
+private:
+  void destroy()
+  {
+    if (m_exec != nullptr) {
+      hipErrchk(hipGraphExecDestroy(m_exec));
+      m_exec = nullptr;
+    }
+    if (m_graph != nullptr) {
+      hipErrchk(hipGraphDestroy(m_graph));
+      m_graph = nullptr;
+    }
+  }
+
+  resources::Hip m_res;
+  hipGraph_t m_graph;
+  hipGraphExec_t m_exec;
+};
+
+/*!
+ * \brief Captures the work launched on the stream of a HIP resource.
+ */
+template <>
+class GraphRecorder<resources::Hip>
+{
+public:
+  explicit GraphRecorder(resources::Hip res) : m_res(res)
+  {
+    hipErrchk(hipStreamBeginCapture(m_res.get_stream(),
+                                    hipStreamCaptureModeRelaxed));
+  }
+
+  GraphRecorder(GraphRecorder const&) = delete;
+  GraphRecorder& operator=(GraphRecorder const&) = delete;
+
+  //! Discards the recording if instantiate was not called
+  ~GraphRecorder()
+  {
+    if (m_capturing) {
+      hipGraph_t graph = nullptr;
+      hipErrchk(hipStreamEndCapture(m_res.get_stream(), &graph));
+      if (graph != nullptr) {
+        hipErrchk(hipGraphDestroy(graph));
+      }
+    }
+  }
+
+  /*!
+   * \brief End the recording and make a graph that can be launched.
+   */
+  Graph<resources::Hip> instantiate()
+  {
+    if (!m_capturing) {
+      RAJA_ABORT_OR_THROW("GraphRecorder::instantiate called twice");
+    }
+    m_capturing = false;
+
+    hipGraph_t graph = nullptr;
+    hipErrchk(hipStreamEndCapture(m_res.get_stream(), &graph));
+
+    hipGraphExec_t exec = nullptr;
+    hipErrchk(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+
+    return Graph<resources::Hip>(m_res, graph, exec);
+  }
+
+private:
+  resources::Hip m_res;
+  bool m_capturing = true;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // defined(RAJA_ENABLE_HIP)
+
+#endif  // RAJA_graph_hip_HPP
@@ -23,6 +23,7 @@
 #include "RAJA/policy/hip/kernel/Conditional.hpp"
 #include "RAJA/policy/hip/kernel/For.hpp"
 #include "RAJA/policy/hip/kernel/ForICount.hpp"
+#include "RAJA/policy/hip/kernel/ForRagged.hpp"
 #include "RAJA/policy/hip/kernel/HipKernel.hpp"
 #include "RAJA/policy/hip/kernel/Hyperplane.hpp"
 #include "RAJA/policy/hip/kernel/InitLocalMem.hpp"
@@ -54,7 +54,8 @@ namespace RAJA
  * Num_threads and num_blocks are determined by the HIP occupancy calculator.
  * If num_threads is 0 and num_blocks is non-zero then num_threads is chosen at
  * runtime.
- * Num_threads is 1024, which may not be appropriate for all kernels.
+ * Num_threads is policy::hip::DEFAULT_BLOCK_SIZE, 256 on AMD GPUs and 1024
+ * otherwise, which may not be appropriate for all kernels.
  */
 template <bool async0, int num_blocks, int num_threads>
 struct hip_launch {};
@@ -151,6 +152,10 @@ using HipKernelFixedAsync =
 /*!
  * A RAJA::kernel statement that launches a HIP kernel with 1024 threads
  * Thre kernel launch is synchronous.
+ *
+ * The kernel is compiled for blocks of up to 1024 threads, on AMD GPUs
+ * kernels that use fewer threads run better with
+ * HipKernelFixed<policy::hip::DEFAULT_BLOCK_SIZE, ...>.
  */
 template <typename... EnclosedStmts>
 using HipKernel = HipKernelFixed<1024, EnclosedStmts...>;
@@ -171,12 +176,12 @@ namespace internal
 /*!
  * HIP global function for launching HipKernel policies
  */
-template <typename Data, typename Exec>
-__global__ void HipKernelLauncher(Data data)
+template <typename Args, typename Exec>
+__global__ void HipKernelLauncher(Args args)
 {
 
-  using data_t = camp::decay<Data>;
-  data_t private_data = data;
+  using data_t = typename camp::decay<Args>::data_t;
+  data_t private_data(args);
 
   Exec::exec(private_data, true);
 }
@@ -189,13 +194,13 @@ __global__ void HipKernelLauncher(Data data)
  *
  * This launcher is used by the HipKerelFixed policies.
  */
-template <size_t BlockSize, typename Data, typename Exec>
+template <size_t BlockSize, typename Args, typename Exec>
 __launch_bounds__(BlockSize, 1) __global__
-    void HipKernelLauncherFixed(Data data)
+    void HipKernelLauncherFixed(Args args)
 {
 
-  using data_t = camp::decay<Data>;
-  data_t private_data = data;
+  using data_t = typename camp::decay<Args>::data_t;
+  data_t private_data(args);
 
   // execute the the object
   Exec::exec(private_data, true);
@@ -256,9 +261,13 @@ struct HipLaunchHelper<hip_launch<async0, num_blocks, num_threads>,StmtList,Data
 
   static constexpr bool async = async0;
 
-  using executor_t = internal::hip_statement_list_executor_t<StmtList, Data, Types>;
+  // the kernel argument and the data the statements run on in the kernel
+  using args_t = internal::LoopDataArgs<Data>;
+  using device_data_t = typename args_t::data_t;
+
+  using executor_t = internal::hip_statement_list_executor_t<StmtList, device_data_t, Types>;
 
-  using kernelGetter_t = HipKernelLauncherGetter<(num_threads <= 0) ? 0 : num_threads, Data, executor_t>;
+  using kernelGetter_t = HipKernelLauncherGetter<(num_threads <= 0) ? 0 : num_threads, args_t, executor_t>;
 
   inline static void recommended_blocks_threads(int shmem_size,
       int &recommended_blocks, int &recommended_threads)
@@ -294,10 +303,10 @@ struct HipLaunchHelper<hip_launch<async0, num_blocks, num_threads>,StmtList,Data
       if (num_threads <= 0) {
 
         //
-        // determine threads at runtime, unsure what use 1024
+        // determine threads at runtime, use the default block size
         // this value may be invalid for kernels with high register pressure
         //
-        recommended_threads = 1024;
+        recommended_threads = policy::hip::DEFAULT_BLOCK_SIZE;
 
       } else {
 
@@ -359,7 +368,17 @@ struct HipLaunchHelper<hip_launch<async0, num_blocks, num_threads>,StmtList,Data
     }
   }
 
-  static void launch(Data &&data,
+  //! blocks of actual_threads threads that can be resident at once
+  inline static void resident_blocks(int shmem_size,
+      int &resident_blocks, int actual_threads)
+  {
+    auto func = kernelGetter_t::get();
+
+    internal::hip_occupancy_max_blocks<Self>(
+        func, shmem_size, resident_blocks, actual_threads);
+  }
+
+  static void launch(args_t &&data,
                      internal::LaunchDims launch_dims,
                      size_t shmem,
                      RAJA::resources::Hip res)
@@ -367,7 +386,11 @@ struct HipLaunchHelper<hip_launch<async0, num_blocks, num_threads>,StmtList,Data
     auto func = kernelGetter_t::get();
 
     void *args[] = {(void*)&data};
-    RAJA::hip::launch((const void*)func, launch_dims.blocks, launch_dims.threads, args, shmem, res, async);
+    if (launch_dims.grid_sync) {
+      RAJA::hip::launch_cooperative((const void*)func, launch_dims.blocks, launch_dims.threads, args, shmem, res, async);
+    } else {
+      RAJA::hip::launch((const void*)func, launch_dims.blocks, launch_dims.threads, args, shmem, res, async);
+    }
   }
 };
 
@@ -464,9 +487,10 @@ struct StatementExecutor<
     if (num_blocks > 0 || num_threads > 0) {
 
       //
-      // Setup shared memory buffers
+      // Setup shared memory buffers, the dynamic shared memory requested
+      // by the enclosed statements
       //
-      int shmem = 0;
+      int shmem = static_cast<int>(launch_dims.shmem);
 
 
       //
@@ -548,12 +572,30 @@ struct StatementExecutor<
         RAJA_ABORT_OR_THROW("RAJA::kernel exceeds max num threads");
       }
 
+      //
+      // A kernel that synchronizes its grid is launched cooperatively, which
+      // runs all of its blocks at once, so it runs no more blocks than can
+      // be resident at once
+      //
+      if (launch_dims.grid_sync) {
+        int resident_blocks;
+        launch_t::resident_blocks(shmem, resident_blocks, static_cast<int>(launch_dims.num_threads()));
+
+        launch_dims.blocks = fitHipDims(
+            resident_blocks, launch_dims.blocks, launch_dims.min_blocks);
+        if (launch_dims.num_blocks() > static_cast<size_t>(resident_blocks)) {
+          RAJA_ABORT_OR_THROW("RAJA::kernel grid sync needs more blocks than can be resident");
+        }
+      }
+
       {
         //
-        // Privatize the LoopData, using make_launch_body to setup reductions
+        // Privatize the kernel arguments of the LoopData, using
+        // make_launch_body to setup reductions
         //
         auto hip_data = RAJA::hip::make_launch_body(
-            launch_dims.blocks, launch_dims.threads, shmem, res, data);
+            launch_dims.blocks, launch_dims.threads, shmem, res,
+            typename launch_t::args_t(data));
 
 
         //
@@ -56,7 +56,7 @@ struct HipStatementExecutor<Data,
     // block reduce on the specified parameter
     auto value = data.template get_param<ParamId>();
     using value_t = decltype(value);
-    value_t ident = value_t();
+    value_t ident = ReduceOperator<value_t>::identity();
 
     // if this thread isn't active, just set it to the identity
     if (!thread_active) {
@@ -115,7 +115,7 @@ struct HipStatementExecutor<Data,
     // block reduce on the specified parameter
     auto value = data.template get_param<ParamId>();
     using value_t = decltype(value);
-    value_t ident = value_t();
+    value_t ident = ReduceOperator<value_t>::identity();
 
     // if this thread isn't active, just set it to the identity
     if (!thread_active) {
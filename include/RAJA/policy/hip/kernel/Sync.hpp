@@ -31,6 +31,7 @@
 
 #include "RAJA/pattern/kernel.hpp"
 
+#include "RAJA/util/async_copy.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -52,6 +53,22 @@ struct HipSyncThreads : public internal::Statement<camp::nil> {
 struct HipSyncWarp : public internal::Statement<camp::nil> {
 };
 
+/*!
+ * A RAJA::kernel statement that ends the group of RAJA::expt::async_copy
+ * copies each thread has started since the last commit.
+ */
+struct HipAsyncCopyCommit : public internal::Statement<camp::nil> {
+};
+
+/*!
+ * A RAJA::kernel statement that waits until at most Pending groups of
+ * copies of each thread are in flight, then performs a __syncthreads() so
+ * the copies are visible to the whole block.
+ */
+template <int Pending>
+struct HipAsyncCopyWait : public internal::Statement<camp::nil> {
+};
+
 }  // namespace statement
 
 namespace internal
@@ -92,6 +109,44 @@ struct HipStatementExecutor<Data, statement::HipSyncWarp, Types> {
 };
 
 
+template <typename Data, typename Types>
+struct HipStatementExecutor<Data, statement::HipAsyncCopyCommit, Types> {
+
+  static
+  inline
+  RAJA_DEVICE
+  void exec(Data &, bool) { RAJA::expt::async_copy_commit(); }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const & RAJA_UNUSED_ARG(data))
+  {
+    return LaunchDims();
+  }
+};
+
+template <typename Data, int Pending, typename Types>
+struct HipStatementExecutor<Data, statement::HipAsyncCopyWait<Pending>, Types> {
+
+  static
+  inline
+  RAJA_DEVICE
+  void exec(Data &, bool)
+  {
+    RAJA::expt::async_copy_wait<Pending>();
+    __syncthreads();
+  }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const & RAJA_UNUSED_ARG(data))
+  {
+    return LaunchDims();
+  }
+};
+
 }  // namespace internal
 }  // namespace RAJA
 
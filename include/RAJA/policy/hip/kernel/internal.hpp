@@ -117,17 +117,26 @@ struct LaunchDims {
   hip_dim_t threads;
   hip_dim_t min_threads;
 
+  //! bytes of dynamic shared memory per block
+  size_t shmem;
+
+  //! whether a statement synchronizes the whole grid, so all blocks must be
+  //! resident at once
+  bool grid_sync;
+
   RAJA_INLINE
   RAJA_HOST_DEVICE
   LaunchDims() : blocks{0,0,0},  min_blocks{0,0,0},
-                 threads{0,0,0}, min_threads{0,0,0} {}
+                 threads{0,0,0}, min_threads{0,0,0}, shmem(0),
+                 grid_sync(false) {}
 
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   LaunchDims(LaunchDims const &c) :
   blocks(c.blocks),   min_blocks(c.min_blocks),
-  threads(c.threads), min_threads(c.min_threads)
+  threads(c.threads), min_threads(c.min_threads),
+  shmem(c.shmem), grid_sync(c.grid_sync)
   {
   }
 
@@ -152,6 +161,10 @@ struct LaunchDims {
     result.min_threads.y = std::max(c.min_threads.y, min_threads.y);
     result.min_threads.z = std::max(c.min_threads.z, min_threads.z);
 
+    result.shmem = std::max(c.shmem, shmem);
+
+    result.grid_sync = c.grid_sync || grid_sync;
+
     return result;
   }
 
@@ -70,7 +70,18 @@ namespace policy
 namespace hip
 {
 
-template <size_t BLOCK_SIZE, bool Async = false>
+//
+// Threads per block of hip_exec<> and of the kernel launches that choose
+// the block size at runtime. Blocks of 256 threads let more blocks share a
+// CU of AMD GPUs and give the compiler more registers per thread.
+//
+#if defined(__HIP_PLATFORM_HCC__)
+constexpr const size_t DEFAULT_BLOCK_SIZE = 256;
+#else
+constexpr const size_t DEFAULT_BLOCK_SIZE = 1024;
+#endif
+
+template <size_t BLOCK_SIZE = DEFAULT_BLOCK_SIZE, bool Async = false>
 struct hip_exec : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Policy::hip,
                        RAJA::Pattern::forall,
@@ -78,6 +89,51 @@ struct hip_exec : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Platform::hip> {
 };
 
+//! values scanned by each thread of hip_scan_exec
+constexpr const size_t SCAN_ITEMS_PER_THREAD = 4;
+
+/*!
+ * \brief Execution policy for scans using a native single pass decoupled
+ *        look-back scan, each thread scans ITEMS_PER_THREAD values.
+ *
+ * Other patterns run as with hip_exec.
+ */
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD, bool Async = false>
+struct hip_scan_exec_explicit : public hip_exec<BLOCK_SIZE, Async> {
+};
+
+/*!
+ * \brief Policy of a RAJA::kernel Hyperplane statement whose hyperplanes are
+ *        run in order by all the blocks of the kernel, with the grid
+ *        synchronized between hyperplanes.
+ *
+ * All the blocks of the kernel must be resident at once, so the kernel is
+ * launched with no more blocks than the device can hold.
+ */
+struct hip_hyperplane_grid_sync
+    : public RAJA::make_policy_pattern_launch_platform_t<
+          RAJA::Policy::hip,
+          RAJA::Pattern::forall,
+          detail::get_launch<false>::value,
+          RAJA::Platform::hip> {
+};
+
+//! iterations run by each thread in each pass of hip_exec_grid_stride
+constexpr const size_t GRID_STRIDE_ITEMS_PER_THREAD = 4;
+
+/*!
+ * \brief Execution policy for forall launching no more blocks than can be
+ *        resident at once, each thread runs ITEMS_PER_THREAD iterations in
+ *        each pass of a grid-stride loop.
+ *
+ * Other patterns run as with hip_exec.
+ */
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD, bool Async = false>
+struct hip_exec_grid_stride_explicit : public hip_exec<BLOCK_SIZE, Async> {
+  static_assert(ITEMS_PER_THREAD > 0,
+                "hip_exec_grid_stride requires ITEMS_PER_THREAD > 0");
+};
+
 template <bool Async, int num_threads = 0>
 struct hip_launch_t : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Policy::hip,
@@ -86,10 +142,34 @@ struct hip_launch_t : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Platform::hip> {
 };
 
+/*!
+ * \brief Launch policy for cooperative launches, whose teams are all
+ *        resident at once so LaunchContext::gridSync can synchronize them.
+ *
+ * The grid is limited to the teams the device can hold at once, so team
+ * loops should be block-stride loops such as hip_block_x_loop.
+ */
+template <bool Async>
+struct hip_launch_cooperative_t : public RAJA::make_policy_pattern_launch_platform_t<
+                                  RAJA::Policy::hip,
+                                  RAJA::Pattern::region,
+                                  detail::get_launch<Async>::value,
+                                  RAJA::Platform::hip> {
+};
 
-//
-// NOTE: There is no Index set segment iteration policy for HIP
-//
+
+///
+/// Index set segment iteration policy that runs all segments in one kernel
+/// launch, the segment execution policy must be a hip_exec policy. Each
+/// thread finds its segment in a table of the segments copied to the device.
+///
+struct hip_single_launch_segit
+    : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::hip,
+                       RAJA::Pattern::balanced_segit,
+                       RAJA::Launch::undefined,
+                       RAJA::Platform::hip> {
+};
 
 ///
 /// WorkGroup execution policies
@@ -109,6 +189,20 @@ struct unordered_hip_loop_y_block_iter_x_threadblock_average
                        RAJA::Pattern::workgroup_order,
                        RAJA::Platform::hip> {
 };
+
+struct unordered_hip_persistent_block_queue
+    : public RAJA::make_policy_pattern_platform_t<
+                       RAJA::Policy::hip,
+                       RAJA::Pattern::workgroup_order,
+                       RAJA::Platform::hip> {
+};
+
+struct unordered_hip_persistent_chunk_queue
+    : public RAJA::make_policy_pattern_platform_t<
+                       RAJA::Policy::hip,
+                       RAJA::Pattern::workgroup_order,
+                       RAJA::Platform::hip> {
+};
 #endif
 
 
@@ -219,14 +313,47 @@ struct hip_atomic_explicit{};
  */
 using hip_atomic = hip_atomic_explicit<loop_atomic>;
 
+/*!
+ * Hip atomic policy that combines the values of the lanes of a wavefront
+ * that update the same address before using hip atomics on the device, and
+ * uses the provided host_policy on the host
+ */
+template<typename host_policy>
+struct hip_warp_atomic_explicit{};
+
+using hip_warp_atomic = hip_warp_atomic_explicit<loop_atomic>;
+
 }  // end namespace hip
 }  // end namespace policy
 
 using policy::hip::hip_exec;
 
-template <size_t BLOCK_SIZE>
+template <size_t BLOCK_SIZE = policy::hip::DEFAULT_BLOCK_SIZE>
 using hip_exec_async = policy::hip::hip_exec<BLOCK_SIZE, true>;
 
+using policy::hip::hip_hyperplane_grid_sync;
+
+using policy::hip::hip_exec_grid_stride_explicit;
+
+template <size_t BLOCK_SIZE = policy::hip::DEFAULT_BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD = policy::hip::GRID_STRIDE_ITEMS_PER_THREAD,
+          bool ASYNC = false>
+using hip_exec_grid_stride = policy::hip::hip_exec_grid_stride_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, ASYNC>;
+
+template <size_t BLOCK_SIZE = policy::hip::DEFAULT_BLOCK_SIZE,
+          size_t ITEMS_PER_THREAD = policy::hip::GRID_STRIDE_ITEMS_PER_THREAD>
+using hip_exec_grid_stride_async = policy::hip::hip_exec_grid_stride_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, true>;
+
+using policy::hip::hip_single_launch_segit;
+
+using policy::hip::hip_scan_exec_explicit;
+
+template <size_t BLOCK_SIZE, bool ASYNC = false>
+using hip_scan_exec = policy::hip::hip_scan_exec_explicit<BLOCK_SIZE, policy::hip::SCAN_ITEMS_PER_THREAD, ASYNC>;
+
+template <size_t BLOCK_SIZE>
+using hip_scan_exec_async = policy::hip::hip_scan_exec_explicit<BLOCK_SIZE, policy::hip::SCAN_ITEMS_PER_THREAD, true>;
+
 using policy::hip::hip_work;
 
 template <size_t BLOCK_SIZE>
@@ -234,9 +361,13 @@ using hip_work_async = policy::hip::hip_work<BLOCK_SIZE, true>;
 
 using policy::hip::hip_atomic;
 using policy::hip::hip_atomic_explicit;
+using policy::hip::hip_warp_atomic;
+using policy::hip::hip_warp_atomic_explicit;
 
 #if defined(RAJA_ENABLE_HIP_INDIRECT_FUNCTION_CALL)
 using policy::hip::unordered_hip_loop_y_block_iter_x_threadblock_average;
+using policy::hip::unordered_hip_persistent_block_queue;
+using policy::hip::unordered_hip_persistent_chunk_queue;
 #endif
 
 using policy::hip::hip_reduce_base;
@@ -260,6 +391,7 @@ using policy::hip::hip_synchronize;
 namespace expt
 {
   using policy::hip::hip_launch_t;
+  using policy::hip::hip_launch_cooperative_t;
 }
 
 /*!
@@ -25,7 +25,11 @@
 
 #if defined(RAJA_ENABLE_HIP)
 
+#include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 
@@ -38,6 +42,7 @@
 
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
+#include "RAJA/pattern/params/reduce.hpp"
 
 #include "RAJA/policy/hip/MemUtils_HIP.hpp"
 #include "RAJA/policy/hip/atomic.hpp"
@@ -216,41 +221,96 @@ RAJA_DEVICE RAJA_INLINE float shfl_sync<float>(float var, int srcLane)
 }
 
 
-//! reduce values in block into thread 0
-template <typename Combiner, typename T>
-RAJA_DEVICE RAJA_INLINE T warp_reduce(T val, T RAJA_UNUSED_ARG(identity))
-{
-  int numThreads = blockDim.x * blockDim.y * blockDim.z;
 
-  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
-                 (blockDim.x * blockDim.y) * threadIdx.z;
+//
+// On AMD GPUs with 64 wide wavefronts the lanes of a row of 16 exchange
+// values with DPP moves, which run in the vector ALU instead of going
+// through the LDS crossbar like the ds_bpermute of __shfl. Rows combine
+// with a ds_swizzle and the two halves of the wave with readlane.
+//
+#if defined(__HIP_DEVICE_COMPILE__) && defined(__HIP_PLATFORM_HCC__) && \
+    defined(__AMDGCN_WAVEFRONT_SIZE) && (__AMDGCN_WAVEFRONT_SIZE == 64)
+#define RAJA_HIP_DPP_WAVE64
+#endif
 
-  T temp = val;
+#if defined(RAJA_HIP_DPP_WAVE64)
 
-  if (numThreads % policy::hip::WARP_SIZE == 0) {
+//! DPP controls used to reduce a row of 16 lanes
+constexpr const int dpp_quad_perm_xor1 = 0xb1;  // quad_perm:[1,0,3,2]
+constexpr const int dpp_quad_perm_xor2 = 0x4e;  // quad_perm:[2,3,0,1]
+constexpr const int dpp_row_half_mirror = 0x141;
+constexpr const int dpp_row_mirror = 0x140;
 
-    // reduce each warp
-    for (int i = 1; i < policy::hip::WARP_SIZE; i *= 2) {
-      T rhs = shfl_xor_sync(temp, i);
-      Combiner{}(temp, rhs);
-    }
+//! ds_swizzle pattern that swaps the halves of each 32 lanes
+constexpr const int swizzle_xor16 = 0x401f;
 
-  } else {
+//! move var from the lane given by DppCtrl in the same row of 16 lanes
+template <int DppCtrl, typename T>
+RAJA_DEVICE RAJA_INLINE T dpp_move(T var)
+{
+  AsIntegerArray<T, min_shfl_int_type_size, max_shfl_int_type_size> u(var);
 
-    // reduce each warp
-    for (int i = 1; i < policy::hip::WARP_SIZE; i *= 2) {
-      int srcLane = threadId ^ i;
-      T rhs = shfl_sync(temp, srcLane);
-      // only add from threads that exist (don't double count own value)
-      if (srcLane < numThreads) {
-        Combiner{}(temp, rhs);
-      }
-    }
+  for (size_t i = 0; i < u.array_size(); ++i) {
+    u.array[i] = __builtin_amdgcn_mov_dpp(u.array[i], DppCtrl, 0xf, 0xf, false);
   }
+  return u.value;
+}
+
+//! move var from the lane 16 away in the same 32 lanes
+template <typename T>
+RAJA_DEVICE RAJA_INLINE T swizzle_xor16_move(T var)
+{
+  AsIntegerArray<T, min_shfl_int_type_size, max_shfl_int_type_size> u(var);
 
+  for (size_t i = 0; i < u.array_size(); ++i) {
+    u.array[i] = __builtin_amdgcn_ds_swizzle(u.array[i], swizzle_xor16);
+  }
+  return u.value;
+}
+
+//! read var of srcLane, the same value in every lane
+template <typename T>
+RAJA_DEVICE RAJA_INLINE T readlane(T var, int srcLane)
+{
+  AsIntegerArray<T, min_shfl_int_type_size, max_shfl_int_type_size> u(var);
+
+  for (size_t i = 0; i < u.array_size(); ++i) {
+    u.array[i] = __builtin_amdgcn_readlane(u.array[i], srcLane);
+  }
+  return u.value;
+}
+
+/*!
+ * Allreduce values in each row of 16 lanes, all lanes must be active.
+ *
+ * After the two quad permutes each lane has the value of its quad, the half
+ * mirror combines the quads of each half row and the mirror the halves.
+ */
+template <typename Combiner, typename T>
+RAJA_DEVICE RAJA_INLINE T dpp_row_allreduce(T val)
+{
+  T temp = val;
+  Combiner{}(temp, dpp_move<dpp_quad_perm_xor1>(temp));
+  Combiner{}(temp, dpp_move<dpp_quad_perm_xor2>(temp));
+  Combiner{}(temp, dpp_move<dpp_row_half_mirror>(temp));
+  Combiner{}(temp, dpp_move<dpp_row_mirror>(temp));
+  return temp;
+}
+
+//! Allreduce values in a wave of 64 lanes, all lanes must be active
+template <typename Combiner, typename T>
+RAJA_DEVICE RAJA_INLINE T dpp_wave_allreduce(T val)
+{
+  T temp = dpp_row_allreduce<Combiner>(val);
+  Combiner{}(temp, swizzle_xor16_move(temp));
+  T hi = readlane(temp, 32);
+  temp = readlane(temp, 0);
+  Combiner{}(temp, hi);
   return temp;
 }
 
+#endif
+
 /*!
  * Allreduce values in a warp.
  *
@@ -261,6 +321,9 @@ RAJA_DEVICE RAJA_INLINE T warp_reduce(T val, T RAJA_UNUSED_ARG(identity))
 template <typename Combiner, typename T>
 RAJA_DEVICE RAJA_INLINE T warp_allreduce(T val)
 {
+#if defined(RAJA_HIP_DPP_WAVE64)
+  return dpp_wave_allreduce<Combiner>(val);
+#else
   T temp = val;
 
   for (int i = 1; i < policy::hip::WARP_SIZE; i *= 2) {
@@ -268,6 +331,40 @@ RAJA_DEVICE RAJA_INLINE T warp_allreduce(T val)
     Combiner{}(temp, rhs);
   }
 
+  return temp;
+#endif
+}
+
+
+//! reduce values in block into thread 0
+template <typename Combiner, typename T>
+RAJA_DEVICE RAJA_INLINE T warp_reduce(T val, T RAJA_UNUSED_ARG(identity))
+{
+  int numThreads = blockDim.x * blockDim.y * blockDim.z;
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  T temp = val;
+
+  if (numThreads % policy::hip::WARP_SIZE == 0) {
+
+    // reduce each warp
+    temp = warp_allreduce<Combiner>(temp);
+
+  } else {
+
+    // reduce each warp
+    for (int i = 1; i < policy::hip::WARP_SIZE; i *= 2) {
+      int srcLane = threadId ^ i;
+      T rhs = shfl_sync(temp, srcLane);
+      // only add from threads that exist (don't double count own value)
+      if (srcLane < numThreads) {
+        Combiner{}(temp, rhs);
+      }
+    }
+  }
+
   return temp;
 }
 
@@ -288,10 +385,7 @@ RAJA_DEVICE RAJA_INLINE T block_reduce(T val, T identity)
   if (numThreads % policy::hip::WARP_SIZE == 0) {
 
     // reduce each warp
-    for (int i = 1; i < policy::hip::WARP_SIZE; i *= 2) {
-      T rhs = shfl_xor_sync(temp, i);
-      Combiner{}(temp, rhs);
-    }
+    temp = warp_allreduce<Combiner>(temp);
 
   } else {
 
@@ -332,10 +426,17 @@ RAJA_DEVICE RAJA_INLINE T block_reduce(T val, T identity)
         temp = identity;
       }
 
+#if defined(RAJA_HIP_DPP_WAVE64)
+      // the 16 warps of the largest block are the first row of the wave
+      static_assert(policy::hip::MAX_WARPS == 16,
+          "the per warp values must fit in a row of 16 lanes");
+      temp = dpp_row_allreduce<Combiner>(temp);
+#else
       for (int i = 1; i < policy::hip::MAX_WARPS; i *= 2) {
         T rhs = shfl_xor_sync(temp, i);
         Combiner{}(temp, rhs);
       }
+#endif
     }
 
     __syncthreads();
@@ -345,6 +446,23 @@ RAJA_DEVICE RAJA_INLINE T block_reduce(T val, T identity)
 }
 
 
+//! reduce values in a grid of one block into thread 0
+//  returns true if put reduced value in val
+template <typename Combiner, typename T>
+RAJA_DEVICE RAJA_INLINE bool single_block_reduce(T& val, T identity)
+{
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  T temp = block_reduce<Combiner>(val, identity);
+
+  if (threadId == 0) {
+    val = temp;
+  }
+
+  return threadId == 0;
+}
+
 //! reduce values in grid into thread 0 of last running block
 //  returns true if put reduced value in val
 template <typename Combiner, typename T, typename TempIterator>
@@ -449,6 +567,186 @@ RAJA_DEVICE RAJA_INLINE bool grid_reduce_atomic(T& val,
 
 }  // namespace impl
 
+namespace detail
+{
+
+//! Object that hands out reducer result slots from contiguous pinned chunks
+//  shared by every PinnedTally created while a ReduceTallyBatch is active
+class PinnedTallyBatch : public std::enable_shared_from_this<PinnedTallyBatch>
+{
+public:
+  static const size_t chunk_bytes = 16 * 1024;
+  static const size_t slot_alignment = alignof(std::max_align_t);
+
+  PinnedTallyBatch() = default;
+
+  PinnedTallyBatch(const PinnedTallyBatch&) = delete;
+
+  ~PinnedTallyBatch()
+  {
+    for (char* chunk : m_chunks) {
+      hip::pinned_mempool_type::getInstance().free(chunk);
+    }
+  }
+
+  //! get a slot of at least nbytes, reusing a released slot if possible
+  void* allocate(size_t nbytes)
+  {
+    nbytes = slot_size(nbytes);
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (free_slots& fs : m_free_slots) {
+      if (fs.nbytes == nbytes && fs.head) {
+        void* ptr = fs.head;
+        fs.head = *static_cast<void**>(ptr);
+        return ptr;
+      }
+    }
+    if (m_chunks.empty() || m_offset + nbytes > m_chunk_bytes) {
+      m_chunk_bytes =
+          nbytes > size_t(chunk_bytes) ? nbytes : size_t(chunk_bytes);
+      m_chunks.push_back(
+          hip::pinned_mempool_type::getInstance().template malloc<char>(
+              m_chunk_bytes, size_t(slot_alignment)));
+      m_offset = 0;
+    }
+    void* ptr = m_chunks.back() + m_offset;
+    m_offset += nbytes;
+    return ptr;
+  }
+
+  //! return a slot to the batch, the slot is reused by later allocations
+  void deallocate(void* ptr, size_t nbytes)
+  {
+    nbytes = slot_size(nbytes);
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (free_slots& fs : m_free_slots) {
+      if (fs.nbytes == nbytes) {
+        *static_cast<void**>(ptr) = fs.head;
+        fs.head = ptr;
+        return;
+      }
+    }
+    *static_cast<void**>(ptr) = nullptr;
+    m_free_slots.push_back(free_slots{nbytes, ptr});
+  }
+
+  //! remember a resource that results in this batch are written on
+  void add_resource(::RAJA::resources::Hip res)
+  {
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (::RAJA::resources::Hip& r : m_resources) {
+      if (r.get_stream() == res.get_stream()) return;
+    }
+    m_resources.push_back(res);
+  }
+
+  //! synchronize every resource used by reducers in this batch
+  void synchronize_resources()
+  {
+    std::vector<::RAJA::resources::Hip> resources;
+    {
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+      lock_guard<omp::mutex> lock(m_mutex);
+#endif
+      resources = m_resources;
+    }
+    for (::RAJA::resources::Hip& r : resources) {
+      ::RAJA::hip::synchronize(r);
+    }
+  }
+
+private:
+  //! list of released slots of a given size, linked through the slots
+  struct free_slots {
+    size_t nbytes;
+    void* head;
+  };
+
+  static size_t slot_size(size_t nbytes)
+  {
+    if (nbytes < sizeof(void*)) nbytes = sizeof(void*);
+    return (nbytes + size_t(slot_alignment) - 1) / size_t(slot_alignment) *
+           size_t(slot_alignment);
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+  omp::mutex m_mutex;
+#endif
+  std::vector<char*> m_chunks;
+  size_t m_offset = 0;
+  size_t m_chunk_bytes = 0;
+  std::vector<free_slots> m_free_slots;
+  std::vector<::RAJA::resources::Hip> m_resources;
+};
+
+//! get the batch new reducers on this thread take result slots from
+RAJA_INLINE
+PinnedTallyBatch* currentTallyBatch() { return tl_status.tally_batch; }
+
+//! events from each resource a reducer was used on, usable as a camp Event
+struct ReduceEvents {
+  std::vector<::RAJA::resources::Event> events;
+
+  bool check() const
+  {
+    for (auto const& e : events) {
+      if (!e.check()) return false;
+    }
+    return true;
+  }
+
+  void wait() const
+  {
+    for (auto const& e : events) {
+      e.wait();
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Scope object that batches the pinned result buffers of reducers.
+ *
+ *         Reducers constructed on this thread while the object is alive get
+ *         their result slots from one contiguous pinned buffer instead of
+ *         individual pinned_mempool_type allocations, and all of their
+ *         resources may be synchronized at once with synchronize() before
+ *         the results are read. Batches nest, the innermost one is used.
+ *
+ ******************************************************************************
+ */
+class ReduceTallyBatch
+{
+public:
+  ReduceTallyBatch()
+      : m_batch(std::make_shared<detail::PinnedTallyBatch>()),
+        m_prev(detail::tl_status.tally_batch)
+  {
+    detail::tl_status.tally_batch = m_batch.get();
+  }
+
+  ReduceTallyBatch(const ReduceTallyBatch&) = delete;
+  ReduceTallyBatch& operator=(const ReduceTallyBatch&) = delete;
+
+  ~ReduceTallyBatch() { detail::tl_status.tally_batch = m_prev; }
+
+  //! synchronize every resource used by reducers in this batch
+  void synchronize() { m_batch->synchronize_resources(); }
+
+private:
+  std::shared_ptr<detail::PinnedTallyBatch> m_batch;
+  detail::PinnedTallyBatch* m_prev;
+};
+
 //! Object that manages pinned memory buffers for reduction results
 //  use one per reducer object
 template <typename T>
@@ -465,6 +763,10 @@ public:
     ResourceNode* next;
     ::RAJA::resources::Hip res;
     Node* node_list;
+    //! marks the point in res after which node_list values are complete
+    hipEvent_t event;
+    //! event was recorded after the last value was added
+    bool event_recorded;
   };
 
   //! Iterator over resources used by reducer
@@ -550,7 +852,13 @@ public:
     Node* m_n;
   };
 
-  PinnedTally() : resource_list(nullptr) {}
+  PinnedTally()
+      : resource_list(nullptr),
+        m_batch(detail::currentTallyBatch()
+                    ? detail::currentTallyBatch()->shared_from_this()
+                    : nullptr)
+  {
+  }
 
   PinnedTally(const PinnedTally&) = delete;
 
@@ -585,23 +893,66 @@ public:
       rn->next = resource_list;
       rn->res = res;
       rn->node_list = nullptr;
+      rn->event = nullptr;
       resource_list = rn;
     }
-    Node* n = hip::pinned_mempool_type::getInstance().template malloc<Node>(1);
+    rn->event_recorded = false;
+    Node* n;
+    if (m_batch) {
+      m_batch->add_resource(res);
+      n = static_cast<Node*>(m_batch->allocate(sizeof(Node)));
+    } else {
+      n = hip::pinned_mempool_type::getInstance().template malloc<Node>(1);
+    }
     n->next = rn->node_list;
     rn->node_list = n;
     return &n->value;
   }
 
   //! synchronize all resources used
+  //  only waits for work up to the last record_events() when it is current
   void synchronize_resources()
   {
-    auto end = resourceEnd();
-    for (auto r = resourceBegin(); r != end; ++r) {
-      ::RAJA::hip::synchronize(*r);
+    for (ResourceNode* rn = resource_list; rn; rn = rn->next) {
+      if (rn->event_recorded) {
+        hipErrchk(hipEventSynchronize(rn->event));
+      } else {
+        ::RAJA::hip::synchronize(rn->res);
+      }
     }
   }
 
+  //! mark the current end of work in every resource used
+  //  later synchronize_resources() calls wait for this point only
+  void record_events()
+  {
+#if defined(RAJA_ENABLE_OPENMP) && defined(_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    for (ResourceNode* rn = resource_list; rn; rn = rn->next) {
+      if (!rn->event) {
+        hipErrchk(
+            hipEventCreateWithFlags(&rn->event, hipEventDisableTiming));
+      }
+      hipErrchk(hipEventRecord(rn->event, rn->res.get_stream()));
+      rn->event_recorded = true;
+    }
+  }
+
+  //! check without blocking if the work synchronize_resources() would wait
+  //  for has completed
+  bool resources_complete()
+  {
+    for (ResourceNode* rn = resource_list; rn; rn = rn->next) {
+      hipError_t err = rn->event_recorded
+                           ? hipEventQuery(rn->event)
+                           : hipStreamQuery(rn->res.get_stream());
+      if (err == hipErrorNotReady) return false;
+      hipErrchk(err);
+    }
+    return true;
+  }
+
   //! all values used in all resources
   void free_list()
   {
@@ -610,9 +961,16 @@ public:
       while (rn->node_list) {
         Node* n = rn->node_list;
         rn->node_list = n->next;
-        hip::pinned_mempool_type::getInstance().free(n);
+        if (m_batch) {
+          m_batch->deallocate(n, sizeof(Node));
+        } else {
+          hip::pinned_mempool_type::getInstance().free(n);
+        }
       }
       resource_list = rn->next;
+      if (rn->event) {
+        hipErrchk(hipEventDestroy(rn->event));
+      }
       free(rn);
     }
   }
@@ -625,6 +983,8 @@ public:
 
 private:
   ResourceNode* resource_list;
+  //! batch the nodes are allocated from, or null for pinned_mempool_type
+  std::shared_ptr<detail::PinnedTallyBatch> m_batch;
 };
 
 //
@@ -645,6 +1005,10 @@ struct Reduce_Data {
   unsigned int* device_count;
   RAJA::detail::SoAPtr<T, device_mempool_type> device;
   bool own_device_ptr;
+  //! launch has one block, reduce in the block without device memory
+  bool single_block;
+  //! stream the device pointers are used on, they are freed in stream order
+  hipStream_t device_stream;
 
   Reduce_Data() : Reduce_Data(T(), T()){};
 
@@ -658,7 +1022,9 @@ struct Reduce_Data {
         identity{identity_},
         device_count{nullptr},
         device{},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        single_block{false},
+        device_stream{nullptr}
   {
   }
 
@@ -668,6 +1034,7 @@ struct Reduce_Data {
     identity = identity_;
     device_count = nullptr;
     own_device_ptr = false;
+    single_block = false;
   }
 
   RAJA_HOST_DEVICE
@@ -676,7 +1043,9 @@ struct Reduce_Data {
         identity{other.identity},
         device_count{other.device_count},
         device{other.device},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        single_block{other.single_block},
+        device_stream{other.device_stream}
   {
   }
 
@@ -692,23 +1061,34 @@ struct Reduce_Data {
   {
     T temp = value;
 
-    if (impl::grid_reduce<Combiner>(temp, identity, device, device_count)) {
+    if (single_block) {
+      if (impl::single_block_reduce<Combiner>(temp, identity)) {
+        *output = temp;
+      }
+    } else if (impl::grid_reduce<Combiner>(
+                   temp, identity, device, device_count)) {
       *output = temp;
     }
   }
 
   //! check and setup for device
   //  allocate device pointers and get a new result buffer from the pinned tally
+  //  launches of one block write the result directly and allocate nothing
   bool setupForDevice()
   {
-    bool act = !device.allocated() && setupReducers();
+    bool act = !device.allocated() && !single_block && setupReducers();
     if (act) {
       hip_dim_t gridDim = currentGridDim();
       size_t numBlocks = gridDim.x * gridDim.y * gridDim.z;
-      device.allocate(numBlocks);
-      device_count = device_zeroed_mempool_type::getInstance()
-                         .template malloc<unsigned int>(1);
-      own_device_ptr = true;
+      device_stream = currentResource()->get_stream();
+      if (numBlocks == 1) {
+        single_block = true;
+      } else {
+        device.allocate(numBlocks, device_stream);
+        device_count = device_zeroed_mempool_type::getInstance()
+                           .template stream_malloc<unsigned int>(1, device_stream);
+        own_device_ptr = true;
+      }
     }
     return act;
   }
@@ -719,8 +1099,9 @@ struct Reduce_Data {
   {
     bool act = own_device_ptr;
     if (act) {
-      device.deallocate();
-      device_zeroed_mempool_type::getInstance().free(device_count);
+      device.deallocate(device_stream);
+      device_zeroed_mempool_type::getInstance().stream_free(device_count,
+                                                            device_stream);
       device_count = nullptr;
       own_device_ptr = false;
     }
@@ -738,6 +1119,10 @@ struct ReduceAtomic_Data {
   unsigned int* device_count;
   T* device;
   bool own_device_ptr;
+  //! launch has one block, reduce in the block without device memory
+  bool single_block;
+  //! stream the device pointers are used on, they are freed in stream order
+  hipStream_t device_stream;
 
   ReduceAtomic_Data() : ReduceAtomic_Data(T(), T()){};
 
@@ -746,7 +1131,9 @@ struct ReduceAtomic_Data {
         identity{identity_},
         device_count{nullptr},
         device{nullptr},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        single_block{false},
+        device_stream{nullptr}
   {
   }
 
@@ -757,6 +1144,7 @@ struct ReduceAtomic_Data {
     device_count = nullptr;
     device = nullptr;
     own_device_ptr = false;
+    single_block = false;
   }
 
   RAJA_HOST_DEVICE
@@ -765,7 +1153,9 @@ struct ReduceAtomic_Data {
         identity{other.identity},
         device_count{other.device_count},
         device{other.device},
-        own_device_ptr{false}
+        own_device_ptr{false},
+        single_block{other.single_block},
+        device_stream{other.device_stream}
   {
   }
 
@@ -781,22 +1171,35 @@ struct ReduceAtomic_Data {
   {
     T temp = value;
 
-    if (impl::grid_reduce_atomic<Combiner>(
-            temp, identity, device, device_count)) {
+    if (single_block) {
+      if (impl::single_block_reduce<Combiner>(temp, identity)) {
+        *output = temp;
+      }
+    } else if (impl::grid_reduce_atomic<Combiner>(
+                   temp, identity, device, device_count)) {
       *output = temp;
     }
   }
 
   //! check and setup for device
   //  allocate device pointers and get a new result buffer from the pinned tally
+  //  launches of one block write the result directly and allocate nothing
   bool setupForDevice()
   {
-    bool act = !device && setupReducers();
+    bool act = !device && !single_block && setupReducers();
     if (act) {
-      device = device_mempool_type::getInstance().template malloc<T>(1);
-      device_count = device_zeroed_mempool_type::getInstance()
-                         .template malloc<unsigned int>(1);
-      own_device_ptr = true;
+      hip_dim_t gridDim = currentGridDim();
+      size_t numBlocks = gridDim.x * gridDim.y * gridDim.z;
+      device_stream = currentResource()->get_stream();
+      if (numBlocks == 1) {
+        single_block = true;
+      } else {
+        device = device_mempool_type::getInstance()
+                     .template stream_malloc<T>(1, device_stream);
+        device_count = device_zeroed_mempool_type::getInstance()
+                           .template stream_malloc<unsigned int>(1, device_stream);
+        own_device_ptr = true;
+      }
     }
     return act;
   }
@@ -807,9 +1210,10 @@ struct ReduceAtomic_Data {
   {
     bool act = own_device_ptr;
     if (act) {
-      device_mempool_type::getInstance().free(device);
+      device_mempool_type::getInstance().stream_free(device, device_stream);
       device = nullptr;
-      device_zeroed_mempool_type::getInstance().free(device_count);
+      device_zeroed_mempool_type::getInstance().stream_free(device_count,
+                                                            device_stream);
       device_count = nullptr;
       own_device_ptr = false;
     }
@@ -911,6 +1315,30 @@ public:
   //! alias for operator T()
   T get() { return operator T(); }
 
+  /*!
+   * \brief Get an event that completes when the reduced value is available.
+   *
+   * Does not block. The returned event covers the work launched so far on
+   * every resource this reducer was used on, and a later get() waits only
+   * for that work, so other work may be launched on the same resources
+   * before the value is read.
+   */
+  ::RAJA::resources::Event get_event()
+  {
+    tally_or_val_ptr.list->record_events();
+    detail::ReduceEvents events;
+    auto end = tally_or_val_ptr.list->resourceEnd();
+    for (auto r = tally_or_val_ptr.list->resourceBegin(); r != end; ++r) {
+      events.events.push_back((*r).get_event());
+    }
+    return ::RAJA::resources::Event{std::move(events)};
+  }
+
+  //! check without blocking if the reduced value is available, covers the
+  //  work launched up to the last get_event() if it was called since
+  //  the reducer was last used
+  bool ready() { return tally_or_val_ptr.list->resources_complete(); }
+
   //! apply reduction (const version) -- still combines internal values
   RAJA_HOST_DEVICE
   void combine(T other) const { Combiner{}(val.value, other); }
@@ -918,6 +1346,7 @@ public:
   /*!
    *  \return reference to the local value
    */
+  RAJA_HOST_DEVICE
   T& local() const { return val.value; }
 
   T get_combined() const { return val.value; }
@@ -1065,6 +1494,15 @@ public:
     return *this;
   }
 
+  //! reducer function taking the components of a tuple IndexType
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  RAJA_HOST_DEVICE
+  const ReduceMinLoc& minloc(T rhs, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    this->combine(value_type(rhs, IndexType(i0, i1, is...)));
+    return *this;
+  }
+
   //! Get the calculated reduced value
   IndexType getLoc() { return Base::get().getLoc(); }
 
@@ -1102,6 +1540,15 @@ public:
     return *this;
   }
 
+  //! reducer function taking the components of a tuple IndexType
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  RAJA_HOST_DEVICE
+  const ReduceMaxLoc& maxloc(T rhs, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    this->combine(value_type(rhs, IndexType(i0, i1, is...)));
+    return *this;
+  }
+
   //! Get the calculated reduced value
   IndexType getLoc() { return Base::get().getLoc(); }
 
@@ -1112,6 +1559,52 @@ public:
   T get() { return Base::get(); }
 };
 
+//! specialization of ReduceMulti for hip_reduce
+//  all values are combined in one block reduction and copied back together
+template <bool maybe_atomic, typename T>
+class ReduceMulti<hip_reduce_base<maybe_atomic>, T>
+    : public hip::Reduce<RAJA::reduce::multi<T>, T, maybe_atomic>
+{
+public:
+  using Base = hip::Reduce<RAJA::reduce::multi<T>, T, maybe_atomic>;
+  using Base::Base;
+
+  //! reducer function; combines one value into each reduction, in order
+  template <typename... Args>
+  RAJA_HOST_DEVICE
+  const ReduceMulti& reduce(Args const&... args) const
+  {
+    this->combine(T(args...));
+    return *this;
+  }
+
+  //! Get the calculated Ith reduced value
+  template <camp::idx_t I>
+  typename T::template element_type<I> get()
+  {
+    return Base::get().template get<I>();
+  }
+
+  //! Get all of the calculated reduced values
+  T get() { return Base::get(); }
+};
+
+namespace expt
+{
+namespace detail
+{
+
+//! reduction parameters of hip loops are lowered onto hip_reduce reducers
+template <typename ExecPol>
+struct param_reduce_policy<
+    ExecPol,
+    typename std::enable_if<type_traits::is_hip_policy<ExecPol>::value>::type> {
+  using type = hip_reduce;
+};
+
+}  // namespace detail
+}  // namespace expt
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_HIP guard
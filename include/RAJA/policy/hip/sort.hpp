@@ -22,6 +22,7 @@
 
 #if defined(RAJA_ENABLE_HIP)
 
+#include <algorithm>
 #include <climits>
 #include <iterator>
 #include <type_traits>
@@ -29,13 +30,26 @@
 #if defined(__HIPCC__)
 #define ROCPRIM_HIP_API 1
 #include "rocprim/device/device_transform.hpp"
+#include "rocprim/device/device_histogram.hpp"
+#include "rocprim/device/device_partition.hpp"
 #include "rocprim/device/device_radix_sort.hpp"
+#include "rocprim/device/device_scan.hpp"
+#include "rocprim/device/device_segmented_radix_sort.hpp"
+#include "rocprim/iterator/constant_iterator.hpp"
+#include "rocprim/iterator/transform_iterator.hpp"
 #elif defined(__CUDACC__)
+#include "cub/device/device_histogram.cuh"
+#include "cub/device/device_partition.cuh"
 #include "cub/device/device_radix_sort.cuh"
+#include "cub/device/device_scan.cuh"
+#include "cub/device/device_segmented_radix_sort.cuh"
+#include "cub/iterator/constant_input_iterator.cuh"
+#include "cub/iterator/transform_input_iterator.cuh"
 #endif
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/radix_sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/policy/hip/MemUtils_HIP.hpp"
 #include "RAJA/policy/hip/policy.hpp"
@@ -100,17 +114,20 @@ stable(
 }
 
 /*!
-        \brief stable sort given range in ascending order
+        \brief stable sort given range in ascending order of bits
+               [begin_bit, end_bit) of the values
 */
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if_t<resources::EventProxy<resources::Hip>,
                       type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                       std::is_pointer<Iter>>
-stable(
+stable_bits(
     resources::Hip hip_res,
     hip_exec<BLOCK_SIZE, Async>,
     Iter begin,
     Iter end,
+    int begin_bit,
+    int end_bit,
     operators::less<RAJA::detail::IterVal<Iter>>)
 {
   hipStream_t stream = hip_res.get_stream();
@@ -118,11 +135,9 @@ stable(
   using R = RAJA::detail::IterVal<Iter>;
 
   int len = std::distance(begin, end);
-  int begin_bit=0;
-  int end_bit=sizeof(R)*CHAR_BIT;
 
   // Allocate temporary storage for the output array
-  R* d_out = hip::device_mempool_type::getInstance().malloc<R>(len);
+  R* d_out = hip::detail::algorithm_malloc<R>(1, len, stream);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
@@ -131,27 +146,31 @@ stable(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
+  auto key = hip::AlgorithmWorkspace::make_key<R>(
+      hip::AlgorithmWorkspace::algorithm::sort_keys, len, begin_bit, end_bit);
+  if (!hip::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_keys(d_temp_storage,
-                                       temp_storage_bytes,
-                                       d_keys,
-                                       len,
-                                       begin_bit,
-                                       end_bit,
-                                       stream));
+    hipErrchk(::rocprim::radix_sort_keys(d_temp_storage,
+                                         temp_storage_bytes,
+                                         d_keys,
+                                         len,
+                                         begin_bit,
+                                         end_bit,
+                                         stream));
 #elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
-                                              temp_storage_bytes,
-                                              d_keys,
-                                              len,
-                                              begin_bit,
-                                              end_bit,
-                                              stream));
+    cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys,
+                                                len,
+                                                begin_bit,
+                                                end_bit,
+                                                stream));
 #endif
+    hip::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = hip::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
 
   // Run
 #if defined(__HIPCC__)
@@ -172,7 +191,7 @@ stable(
                                               stream));
 #endif
   // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+  hip::detail::algorithm_free(d_temp_storage, stream);
 
   if (detail::get_current(d_keys) == d_out) {
 
@@ -180,7 +199,7 @@ stable(
     hipErrchk(hipMemcpyAsync(begin, d_out, len*sizeof(R), hipMemcpyDefault, stream));
   }
 
-  hip::device_mempool_type::getInstance().free(d_out);
+  hip::detail::algorithm_free(d_out, stream);
 
   hip::launch(hip_res, Async);
 
@@ -188,17 +207,20 @@ stable(
 }
 
 /*!
-        \brief stable sort given range in descending order
+        \brief stable sort given range in descending order of bits
+               [begin_bit, end_bit) of the values
 */
 template <size_t BLOCK_SIZE, bool Async, typename Iter>
 concepts::enable_if_t<resources::EventProxy<resources::Hip>,
                       type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
                       std::is_pointer<Iter>>
-stable(
+stable_bits(
     resources::Hip hip_res,
     hip_exec<BLOCK_SIZE, Async>,
     Iter begin,
     Iter end,
+    int begin_bit,
+    int end_bit,
     operators::greater<RAJA::detail::IterVal<Iter>>)
 {
   hipStream_t stream = hip_res.get_stream();
@@ -206,11 +228,9 @@ stable(
   using R = RAJA::detail::IterVal<Iter>;
 
   int len = std::distance(begin, end);
-  int begin_bit=0;
-  int end_bit=sizeof(R)*CHAR_BIT;
 
   // Allocate temporary storage for the output array
-  R* d_out = hip::device_mempool_type::getInstance().malloc<R>(len);
+  R* d_out = hip::detail::algorithm_malloc<R>(1, len, stream);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
@@ -219,27 +239,31 @@ stable(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
+  auto key = hip::AlgorithmWorkspace::make_key<R>(
+      hip::AlgorithmWorkspace::algorithm::sort_keys_descending, len, begin_bit, end_bit);
+  if (!hip::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_keys_desc(d_temp_storage,
-                                            temp_storage_bytes,
-                                            d_keys,
-                                            len,
-                                            begin_bit,
-                                            end_bit,
-                                            stream));
+    hipErrchk(::rocprim::radix_sort_keys_desc(d_temp_storage,
+                                              temp_storage_bytes,
+                                              d_keys,
+                                              len,
+                                              begin_bit,
+                                              end_bit,
+                                              stream));
 #elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
-                                                        temp_storage_bytes,
-                                                        d_keys,
-                                                        len,
-                                                        begin_bit,
-                                                        end_bit,
-                                                        stream));
+    cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_keys,
+                                                          len,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream));
 #endif
+    hip::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = hip::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
 
   // Run
 #if defined(__HIPCC__)
@@ -260,7 +284,7 @@ stable(
                                                         stream));
 #endif
   // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+  hip::detail::algorithm_free(d_temp_storage, stream);
 
   if (detail::get_current(d_keys) == d_out) {
 
@@ -268,13 +292,65 @@ stable(
     hipErrchk(hipMemcpyAsync(begin, d_out, len*sizeof(R), hipMemcpyDefault, stream));
   }
 
-  hip::device_mempool_type::getInstance().free(d_out);
+  hip::detail::algorithm_free(d_out, stream);
 
   hip::launch(hip_res, Async);
 
   return resources::EventProxy<resources::Hip>(hip_res);
 }
 
+/*!
+        \brief static assert unimplemented stable sort of a bit range
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                        std::is_pointer<Iter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
+stable_bits(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    Iter,
+    Iter,
+    int,
+    int,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                  std::is_pointer<Iter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>::value,
+                "RAJA stable_sort_bits<hip_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief stable sort given range in ascending or descending order
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                      std::is_pointer<Iter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+stable(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async> p,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  return stable_bits(hip_res, p, begin, end, 0, sizeof(R)*CHAR_BIT, comp);
+}
+
 
 /*!
         \brief static assert unimplemented sort
@@ -377,7 +453,8 @@ stable_pairs(
 }
 
 /*!
-        \brief stable sort given range of pairs in ascending order of keys
+        \brief stable sort given range of pairs in ascending order of bits
+               [begin_bit, end_bit) of the keys
 */
 template <size_t BLOCK_SIZE, bool Async,
           typename KeyIter, typename ValIter>
@@ -385,12 +462,14 @@ concepts::enable_if_t<resources::EventProxy<resources::Hip>,
                       type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                       std::is_pointer<KeyIter>,
                       std::is_pointer<ValIter>>
-stable_pairs(
+stable_pairs_bits(
     resources::Hip hip_res,
     hip_exec<BLOCK_SIZE, Async>,
     KeyIter keys_begin,
     KeyIter keys_end,
     ValIter vals_begin,
+    int begin_bit,
+    int end_bit,
     operators::less<RAJA::detail::IterVal<KeyIter>>)
 {
   hipStream_t stream = hip_res.get_stream();
@@ -399,12 +478,10 @@ stable_pairs(
   using V = RAJA::detail::IterVal<ValIter>;
 
   int len = std::distance(keys_begin, keys_end);
-  int begin_bit=0;
-  int end_bit=sizeof(K)*CHAR_BIT;
 
   // Allocate temporary storage for the output arrays
-  K* d_keys_out = hip::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = hip::device_mempool_type::getInstance().malloc<V>(len);
+  K* d_keys_out = hip::detail::algorithm_malloc<K>(1, len, stream);
+  V* d_vals_out = hip::detail::algorithm_malloc<V>(2, len, stream);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
@@ -414,29 +491,33 @@ stable_pairs(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
+  auto key = hip::AlgorithmWorkspace::make_key<K, V>(
+      hip::AlgorithmWorkspace::algorithm::sort_pairs, len, begin_bit, end_bit);
+  if (!hip::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_pairs(d_temp_storage,
-                                        temp_storage_bytes,
-                                        d_keys,
-                                        d_vals,
-                                        len,
-                                        begin_bit,
-                                        end_bit,
-                                        stream));
+    hipErrchk(::rocprim::radix_sort_pairs(d_temp_storage,
+                                          temp_storage_bytes,
+                                          d_keys,
+                                          d_vals,
+                                          len,
+                                          begin_bit,
+                                          end_bit,
+                                          stream));
 #elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
-                                               temp_storage_bytes,
-                                               d_keys,
-                                               d_vals,
-                                               len,
-                                               begin_bit,
-                                               end_bit,
-                                               stream));
+    cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_keys,
+                                                 d_vals,
+                                                 len,
+                                                 begin_bit,
+                                                 end_bit,
+                                                 stream));
 #endif
+    hip::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = hip::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
 
   // Run
 #if defined(__HIPCC__)
@@ -459,7 +540,7 @@ stable_pairs(
                                                stream));
 #endif
   // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+  hip::detail::algorithm_free(d_temp_storage, stream);
 
   if (detail::get_current(d_keys) == d_keys_out) {
 
@@ -472,8 +553,8 @@ stable_pairs(
     hipErrchk(hipMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), hipMemcpyDefault, stream));
   }
 
-  hip::device_mempool_type::getInstance().free(d_keys_out);
-  hip::device_mempool_type::getInstance().free(d_vals_out);
+  hip::detail::algorithm_free(d_keys_out, stream);
+  hip::detail::algorithm_free(d_vals_out, stream);
 
   hip::launch(hip_res, Async);
 
@@ -481,7 +562,8 @@ stable_pairs(
 }
 
 /*!
-        \brief stable sort given range of pairs in descending order of keys
+        \brief stable sort given range of pairs in descending order of bits
+               [begin_bit, end_bit) of the keys
 */
 template <size_t BLOCK_SIZE, bool Async,
           typename KeyIter, typename ValIter>
@@ -489,12 +571,14 @@ concepts::enable_if_t<resources::EventProxy<resources::Hip>,
                       type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                       std::is_pointer<KeyIter>,
                       std::is_pointer<ValIter>>
-stable_pairs(
+stable_pairs_bits(
     resources::Hip hip_res,
     hip_exec<BLOCK_SIZE, Async>,
     KeyIter keys_begin,
     KeyIter keys_end,
     ValIter vals_begin,
+    int begin_bit,
+    int end_bit,
     operators::greater<RAJA::detail::IterVal<KeyIter>>)
 {
   hipStream_t stream = hip_res.get_stream();
@@ -503,12 +587,10 @@ stable_pairs(
   using V = RAJA::detail::IterVal<ValIter>;
 
   int len = std::distance(keys_begin, keys_end);
-  int begin_bit=0;
-  int end_bit=sizeof(K)*CHAR_BIT;
 
   // Allocate temporary storage for the output arrays
-  K* d_keys_out = hip::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = hip::device_mempool_type::getInstance().malloc<V>(len);
+  K* d_keys_out = hip::detail::algorithm_malloc<K>(1, len, stream);
+  V* d_vals_out = hip::detail::algorithm_malloc<V>(2, len, stream);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
@@ -518,29 +600,33 @@ stable_pairs(
   // Determine temporary device storage requirements
   void* d_temp_storage = nullptr;
   size_t temp_storage_bytes = 0;
+  auto key = hip::AlgorithmWorkspace::make_key<K, V>(
+      hip::AlgorithmWorkspace::algorithm::sort_pairs_descending, len, begin_bit, end_bit);
+  if (!hip::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_pairs_desc(d_temp_storage,
-                                             temp_storage_bytes,
-                                             d_keys,
-                                             d_vals,
-                                             len,
-                                             begin_bit,
-                                             end_bit,
-                                             stream));
+    hipErrchk(::rocprim::radix_sort_pairs_desc(d_temp_storage,
+                                               temp_storage_bytes,
+                                               d_keys,
+                                               d_vals,
+                                               len,
+                                               begin_bit,
+                                               end_bit,
+                                               stream));
 #elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
-                                                         temp_storage_bytes,
-                                                         d_keys,
-                                                         d_vals,
-                                                         len,
-                                                         begin_bit,
-                                                         end_bit,
-                                                         stream));
+    cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_keys,
+                                                           d_vals,
+                                                           len,
+                                                           begin_bit,
+                                                           end_bit,
+                                                           stream));
 #endif
+    hip::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
   // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
+  d_temp_storage = hip::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
 
   // Run
 #if defined(__HIPCC__)
@@ -563,7 +649,7 @@ stable_pairs(
                                                          stream));
 #endif
   // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+  hip::detail::algorithm_free(d_temp_storage, stream);
 
   if (detail::get_current(d_keys) == d_keys_out) {
 
@@ -576,14 +662,75 @@ stable_pairs(
     hipErrchk(hipMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), hipMemcpyDefault, stream));
   }
 
-  hip::device_mempool_type::getInstance().free(d_keys_out);
-  hip::device_mempool_type::getInstance().free(d_vals_out);
+  hip::detail::algorithm_free(d_keys_out, stream);
+  hip::detail::algorithm_free(d_vals_out, stream);
 
   hip::launch(hip_res, Async);
 
   return resources::EventProxy<resources::Hip>(hip_res);
 }
 
+/*!
+        \brief static assert unimplemented stable sort pairs of a bit range
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                        std::is_pointer<KeyIter>,
+                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
+stable_pairs_bits(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter,
+    KeyIter,
+    ValIter,
+    int,
+    int,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                  std::is_pointer<KeyIter>,
+                  std::is_pointer<ValIter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>::value,
+                "RAJA stable_sort_pairs_bits<hip_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief stable sort given range of pairs in ascending or descending
+               order of keys
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<ValIter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+stable_pairs(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async> p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  using K = RAJA::detail::IterVal<KeyIter>;
+  return stable_pairs_bits(hip_res, p, keys_begin, keys_end, vals_begin,
+                           0, sizeof(K)*CHAR_BIT, comp);
+}
+
 
 /*!
         \brief static assert unimplemented sort pairs
@@ -661,6 +808,683 @@ unstable_pairs(
   return stable_pairs(hip_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+        \brief static assert unimplemented segmented sort
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                        std::is_pointer<Iter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
+segmented(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    Iter,
+    Iter,
+    OffsetIter,
+    OffsetIter,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                  std::is_pointer<Iter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>::value,
+                "RAJA sort_segmented<hip_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief stable sort each segment of given range in ascending or
+               descending order, all segments are sorted in one call
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                      std::is_pointer<Iter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+segmented(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    Iter begin,
+    Iter end,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  using R = RAJA::detail::IterVal<Iter>;
+  constexpr bool descending =
+      camp::is_same<Compare, operators::greater<R>>::value;
+
+  int len = std::distance(begin, end);
+  int num_segments = std::distance(offsets_begin, offsets_end) - 1;
+  int begin_bit=0;
+  int end_bit=sizeof(R)*CHAR_BIT;
+
+  // Allocate temporary storage for the output array
+  R* d_out = hip::detail::algorithm_malloc<R>(1, len, stream);
+
+  // use double buffer to reduce temporary memory requirements
+  // by allowing the sort to write to the begin buffer
+  detail::double_buffer<R> d_keys(begin, d_out);
+
+  auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+    if (descending) {
+      hipErrchk(::rocprim::segmented_radix_sort_keys_desc(
+          d_temp_storage, temp_storage_bytes, d_keys, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    } else {
+      hipErrchk(::rocprim::segmented_radix_sort_keys(
+          d_temp_storage, temp_storage_bytes, d_keys, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    }
+#elif defined(__CUDACC__)
+    if (descending) {
+      cudaErrchk(::cub::DeviceSegmentedRadixSort::SortKeysDescending(
+          d_temp_storage, temp_storage_bytes, d_keys, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    } else {
+      cudaErrchk(::cub::DeviceSegmentedRadixSort::SortKeys(
+          d_temp_storage, temp_storage_bytes, d_keys, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    }
+#endif
+  };
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  auto key = hip::AlgorithmWorkspace::make_key<R, OffsetIter>(
+      descending ? hip::AlgorithmWorkspace::algorithm::sort_keys_segmented_descending
+                 : hip::AlgorithmWorkspace::algorithm::sort_keys_segmented,
+      len, begin_bit, end_bit, num_segments);
+  if (!hip::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    run(d_temp_storage, temp_storage_bytes);
+    hip::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
+  // Allocate temporary storage
+  d_temp_storage = hip::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
+
+  // Run
+  run(d_temp_storage, temp_storage_bytes);
+
+  // Free temporary storage
+  hip::detail::algorithm_free(d_temp_storage, stream);
+
+  if (detail::get_current(d_keys) == d_out) {
+
+    // copy
+    hipErrchk(hipMemcpyAsync(begin, d_out, len*sizeof(R), hipMemcpyDefault, stream));
+  }
+
+  hip::detail::algorithm_free(d_out, stream);
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief static assert unimplemented segmented sort pairs
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                        std::is_pointer<KeyIter>,
+                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
+segmented_pairs(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter,
+    KeyIter,
+    ValIter,
+    OffsetIter,
+    OffsetIter,
+    Compare)
+{
+  static_assert (std::is_pointer<KeyIter>::value,
+      "sort_pairs_segmented<hip_exec> is only implemented for pointers");
+  static_assert (std::is_pointer<ValIter>::value,
+      "sort_pairs_segmented<hip_exec> is only implemented for pointers");
+  using K = RAJA::detail::IterVal<KeyIter>;
+  static_assert (type_traits::is_arithmetic<K>::value,
+      "sort_pairs_segmented<hip_exec> is only implemented for arithmetic types");
+  static_assert (concepts::any_of<
+      camp::is_same<Compare, operators::less<K>>,
+      camp::is_same<Compare, operators::greater<K>>>::value,
+      "sort_pairs_segmented<hip_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief stable sort each segment of given range of pairs in ascending
+               or descending order of keys, all segments are sorted in one call
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<ValIter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+segmented_pairs(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using V = RAJA::detail::IterVal<ValIter>;
+  constexpr bool descending =
+      camp::is_same<Compare, operators::greater<K>>::value;
+
+  int len = std::distance(keys_begin, keys_end);
+  int num_segments = std::distance(offsets_begin, offsets_end) - 1;
+  int begin_bit=0;
+  int end_bit=sizeof(K)*CHAR_BIT;
+
+  // Allocate temporary storage for the output arrays
+  K* d_keys_out = hip::detail::algorithm_malloc<K>(1, len, stream);
+  V* d_vals_out = hip::detail::algorithm_malloc<V>(2, len, stream);
+
+  // use double buffer to reduce temporary memory requirements
+  // by allowing the sort to write to the keys_begin and vals_begin buffers
+  detail::double_buffer<K> d_keys(keys_begin, d_keys_out);
+  detail::double_buffer<V> d_vals(vals_begin, d_vals_out);
+
+  auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+    if (descending) {
+      hipErrchk(::rocprim::segmented_radix_sort_pairs_desc(
+          d_temp_storage, temp_storage_bytes, d_keys, d_vals, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    } else {
+      hipErrchk(::rocprim::segmented_radix_sort_pairs(
+          d_temp_storage, temp_storage_bytes, d_keys, d_vals, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    }
+#elif defined(__CUDACC__)
+    if (descending) {
+      cudaErrchk(::cub::DeviceSegmentedRadixSort::SortPairsDescending(
+          d_temp_storage, temp_storage_bytes, d_keys, d_vals, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    } else {
+      cudaErrchk(::cub::DeviceSegmentedRadixSort::SortPairs(
+          d_temp_storage, temp_storage_bytes, d_keys, d_vals, len, num_segments,
+          offsets_begin, offsets_begin + 1, begin_bit, end_bit, stream));
+    }
+#endif
+  };
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  auto key = hip::AlgorithmWorkspace::make_key<K, V, OffsetIter>(
+      descending ? hip::AlgorithmWorkspace::algorithm::sort_pairs_segmented_descending
+                 : hip::AlgorithmWorkspace::algorithm::sort_pairs_segmented,
+      len, begin_bit, end_bit, num_segments);
+  if (!hip::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    run(d_temp_storage, temp_storage_bytes);
+    hip::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
+  // Allocate temporary storage
+  d_temp_storage = hip::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
+
+  // Run
+  run(d_temp_storage, temp_storage_bytes);
+
+  // Free temporary storage
+  hip::detail::algorithm_free(d_temp_storage, stream);
+
+  if (detail::get_current(d_keys) == d_keys_out) {
+
+    // copy keys
+    hipErrchk(hipMemcpyAsync(keys_begin, d_keys_out, len*sizeof(K), hipMemcpyDefault, stream));
+  }
+  if (detail::get_current(d_vals) == d_vals_out) {
+
+    // copy vals
+    hipErrchk(hipMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), hipMemcpyDefault, stream));
+  }
+
+  hip::detail::algorithm_free(d_keys_out, stream);
+  hip::detail::algorithm_free(d_vals_out, stream);
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief static assert unimplemented nth_element
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                        std::is_pointer<Iter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
+nth_element(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    Iter,
+    Iter,
+    Iter,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                  std::is_pointer<Iter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>::value,
+                "RAJA nth_element<hip_exec> and partial_sort<hip_exec> are only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief partially sort given range in ascending or descending order
+               so nth is the value it would be if the range were sorted
+
+        A radix select finds the digits of the nth value from the most
+        significant digit down. Each pass counts the digits of the keys
+        that have the digits found so far and keeps the digit that holds
+        the nth value, until it is the only candidate or all digits are
+        found. Two partitions then put the keys less than the candidates
+        first and the candidates after them.
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                      std::is_pointer<Iter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+nth_element(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  using R = RAJA::detail::IterVal<Iter>;
+  using bits_type = typename RAJA::detail::radix_key<R>::bits_type;
+  constexpr bool descending =
+      camp::is_same<Compare, operators::greater<R>>::value;
+  constexpr int digit_bits = RAJA::detail::get_radix_sort_digit_bits();
+  constexpr int num_buckets = 1 << digit_bits;
+
+  using digit_op = RAJA::detail::radix_select_digit<descending, R>;
+  using less_op = RAJA::detail::radix_select_partition<descending, false, R>;
+  using equal_op = RAJA::detail::radix_select_partition<descending, true, R>;
+#if defined(__HIPCC__)
+  using digit_iter = ::rocprim::transform_iterator<Iter, digit_op, int>;
+#elif defined(__CUDACC__)
+  using digit_iter = ::cub::TransformInputIterator<int, digit_op, Iter>;
+#endif
+
+  int len = std::distance(begin, end);
+  int rank = std::distance(begin, nth);
+
+  // Allocate temporary storage for the digit counts, also used for the
+  // number of selected keys of the partitions, and the partitioned keys
+  int* d_counts = hip::detail::algorithm_malloc<int>(1, num_buckets, stream);
+  R* d_out = hip::detail::algorithm_malloc<R>(2, len, stream);
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  auto key = hip::AlgorithmWorkspace::make_key<R>(
+      descending ? hip::AlgorithmWorkspace::algorithm::select_descending
+                 : hip::AlgorithmWorkspace::algorithm::select,
+      len);
+  if (!hip::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    size_t histogram_bytes = 0;
+#if defined(__HIPCC__)
+    hipErrchk(::rocprim::histogram_even(d_temp_storage,
+                                        histogram_bytes,
+                                        digit_iter(begin, digit_op{}),
+                                        len,
+                                        d_counts,
+                                        num_buckets+1,
+                                        0,
+                                        num_buckets,
+                                        stream));
+#elif defined(__CUDACC__)
+    cudaErrchk(::cub::DeviceHistogram::HistogramEven(d_temp_storage,
+                                                     histogram_bytes,
+                                                     digit_iter(begin, digit_op{}),
+                                                     d_counts,
+                                                     num_buckets+1,
+                                                     0,
+                                                     num_buckets,
+                                                     len,
+                                                     stream));
+#endif
+    size_t partition_bytes = 0;
+#if defined(__HIPCC__)
+    hipErrchk(::rocprim::partition(d_temp_storage,
+                                   partition_bytes,
+                                   begin,
+                                   d_out,
+                                   d_counts,
+                                   len,
+                                   less_op{},
+                                   stream));
+#elif defined(__CUDACC__)
+    cudaErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                          partition_bytes,
+                                          begin,
+                                          d_out,
+                                          d_counts,
+                                          len,
+                                          less_op{},
+                                          stream));
+#endif
+    temp_storage_bytes = std::max(histogram_bytes, partition_bytes);
+    hip::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
+  // Allocate temporary storage
+  d_temp_storage = hip::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
+
+  // Find the digits of the nth value, num_before counts the keys before
+  // the candidates
+  bits_type prefix = 0;
+  bits_type prefix_mask = 0;
+  int num_before = 0;
+  int counts[num_buckets];
+  for (int shift = static_cast<int>(sizeof(R)*CHAR_BIT) - digit_bits;
+       shift >= 0;
+       shift -= digit_bits) {
+
+#if defined(__HIPCC__)
+    hipErrchk(::rocprim::histogram_even(d_temp_storage,
+                                        temp_storage_bytes,
+                                        digit_iter(begin, digit_op{prefix, prefix_mask, shift}),
+                                        len,
+                                        d_counts,
+                                        num_buckets+1,
+                                        0,
+                                        num_buckets,
+                                        stream));
+#elif defined(__CUDACC__)
+    cudaErrchk(::cub::DeviceHistogram::HistogramEven(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     digit_iter(begin, digit_op{prefix, prefix_mask, shift}),
+                                                     d_counts,
+                                                     num_buckets+1,
+                                                     0,
+                                                     num_buckets,
+                                                     len,
+                                                     stream));
+#endif
+    hipErrchk(hipMemcpyAsync(counts, d_counts, sizeof(counts), hipMemcpyDefault, stream));
+    hipErrchk(hipStreamSynchronize(stream));
+
+    int digit = 0;
+    while (rank - num_before >= counts[digit]) {
+      num_before += counts[digit];
+      ++digit;
+    }
+    prefix |= static_cast<bits_type>(bits_type(digit) << shift);
+    prefix_mask |= static_cast<bits_type>(bits_type(num_buckets-1) << shift);
+
+    if (counts[digit] == 1) {
+      break;
+    }
+  }
+
+  // Partition the keys less than the candidates to the front of d_out, then
+  // the candidates to their place after them in the range
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::partition(d_temp_storage,
+                                 temp_storage_bytes,
+                                 begin,
+                                 d_out,
+                                 d_counts,
+                                 len,
+                                 less_op{prefix, prefix_mask},
+                                 stream));
+#elif defined(__CUDACC__)
+  cudaErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        begin,
+                                        d_out,
+                                        d_counts,
+                                        len,
+                                        less_op{prefix, prefix_mask},
+                                        stream));
+#endif
+#if defined(__HIPCC__)
+  hipErrchk(::rocprim::partition(d_temp_storage,
+                                 temp_storage_bytes,
+                                 d_out + num_before,
+                                 begin + num_before,
+                                 d_counts,
+                                 len - num_before,
+                                 equal_op{prefix, prefix_mask},
+                                 stream));
+#elif defined(__CUDACC__)
+  cudaErrchk(::cub::DevicePartition::If(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_out + num_before,
+                                        begin + num_before,
+                                        d_counts,
+                                        len - num_before,
+                                        equal_op{prefix, prefix_mask},
+                                        stream));
+#endif
+  hipErrchk(hipMemcpyAsync(begin, d_out, num_before*sizeof(R), hipMemcpyDefault, stream));
+
+  // Free temporary storage
+  hip::detail::algorithm_free(d_temp_storage, stream);
+  hip::detail::algorithm_free(d_counts, stream);
+  hip::detail::algorithm_free(d_out, stream);
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief sort the smallest values of given range into [begin, middle)
+               with a radix select followed by a radix sort of [begin, middle)
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+resources::EventProxy<resources::Hip>
+partial(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async> p,
+    Iter begin,
+    Iter middle,
+    Iter end,
+    Compare comp)
+{
+  if (middle != end) {
+    nth_element(hip_res, p, begin, middle, end, comp);
+  }
+
+  return unstable(hip_res, p, begin, middle, comp);
+}
+
+/*!
+        \brief static assert unimplemented argsort
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                        std::is_pointer<KeyIter>,
+                        std::is_pointer<IdxIter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
+argsort(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter,
+    KeyIter,
+    IdxIter,
+    Compare)
+{
+  static_assert(concepts::all_of<
+                  type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                  std::is_pointer<KeyIter>,
+                  std::is_pointer<IdxIter>,
+                  concepts::any_of<
+                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>::value,
+                "RAJA argsort<hip_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief write the permutation that stably sorts given range of keys in
+               ascending or descending order, the keys are not modified
+
+        The identity permutation is made by a scan of ones and sorted as the
+        values of a radix sort of pairs into the output.
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<IdxIter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+argsort(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    IdxIter perm_begin,
+    Compare)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using I = RAJA::detail::IterVal<IdxIter>;
+  constexpr bool descending =
+      camp::is_same<Compare, operators::greater<K>>::value;
+
+  int len = std::distance(keys_begin, keys_end);
+  int begin_bit=0;
+  int end_bit=sizeof(K)*CHAR_BIT;
+
+  // Allocate temporary storage for the identity permutation and the
+  // sorted keys
+  I* d_iota = hip::detail::algorithm_malloc<I>(1, len, stream);
+  K* d_keys_out = hip::detail::algorithm_malloc<K>(2, len, stream);
+
+  auto scan = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+    hipErrchk(::rocprim::exclusive_scan(
+        d_temp_storage, temp_storage_bytes,
+        ::rocprim::constant_iterator<I>(I(1)), d_iota, I(0), len,
+        ::rocprim::plus<I>(), stream));
+#elif defined(__CUDACC__)
+    cudaErrchk(::cub::DeviceScan::ExclusiveSum(
+        d_temp_storage, temp_storage_bytes,
+        ::cub::ConstantInputIterator<I>(I(1)), d_iota, len, stream));
+#endif
+  };
+
+  auto sort = [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+    if (descending) {
+      hipErrchk(::rocprim::radix_sort_pairs_desc(
+          d_temp_storage, temp_storage_bytes, keys_begin, d_keys_out,
+          d_iota, perm_begin, len, begin_bit, end_bit, stream));
+    } else {
+      hipErrchk(::rocprim::radix_sort_pairs(
+          d_temp_storage, temp_storage_bytes, keys_begin, d_keys_out,
+          d_iota, perm_begin, len, begin_bit, end_bit, stream));
+    }
+#elif defined(__CUDACC__)
+    if (descending) {
+      cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(
+          d_temp_storage, temp_storage_bytes, keys_begin, d_keys_out,
+          d_iota, perm_begin, len, begin_bit, end_bit, stream));
+    } else {
+      cudaErrchk(::cub::DeviceRadixSort::SortPairs(
+          d_temp_storage, temp_storage_bytes, keys_begin, d_keys_out,
+          d_iota, perm_begin, len, begin_bit, end_bit, stream));
+    }
+#endif
+  };
+
+  // Determine temporary device storage requirements
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+  auto key = hip::AlgorithmWorkspace::make_key<K, I>(
+      descending ? hip::AlgorithmWorkspace::algorithm::argsort_descending
+                 : hip::AlgorithmWorkspace::algorithm::argsort,
+      len, begin_bit, end_bit);
+  if (!hip::detail::find_temp_storage_bytes(key, temp_storage_bytes)) {
+    size_t scan_bytes = 0;
+    scan(d_temp_storage, scan_bytes);
+    size_t sort_bytes = 0;
+    sort(d_temp_storage, sort_bytes);
+    temp_storage_bytes = std::max(scan_bytes, sort_bytes);
+    hip::detail::cache_temp_storage_bytes(key, temp_storage_bytes);
+  }
+  // Allocate temporary storage
+  d_temp_storage = hip::detail::algorithm_malloc<unsigned char>(
+      0, temp_storage_bytes, stream);
+
+  // Run
+  scan(d_temp_storage, temp_storage_bytes);
+  sort(d_temp_storage, temp_storage_bytes);
+
+  // Free temporary storage
+  hip::detail::algorithm_free(d_temp_storage, stream);
+  hip::detail::algorithm_free(d_iota, stream);
+  hip::detail::algorithm_free(d_keys_out, stream);
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
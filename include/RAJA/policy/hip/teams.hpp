@@ -18,6 +18,8 @@
 #ifndef RAJA_pattern_teams_hip_HPP
 #define RAJA_pattern_teams_hip_HPP
 
+#include <algorithm>
+
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
 #include "RAJA/policy/hip/policy.hpp"
@@ -31,6 +33,25 @@ namespace RAJA
 namespace expt
 {
 
+namespace detail
+{
+
+//! Makes the device of a Hip resource current, and restores the previous one
+template <>
+struct LaunchDeviceGuard<resources::Hip> {
+  int prev_device;
+
+  explicit LaunchDeviceGuard(resources::Resource &res)
+  {
+    hipErrchk(hipGetDevice(&prev_device));
+    hipErrchk(hipSetDevice(res.get<resources::Hip>().get_device()));
+  }
+
+  ~LaunchDeviceGuard() { hipErrchk(hipSetDevice(prev_device)); }
+};
+
+}  // namespace detail
+
 template <typename BODY>
 __global__ void launch_global_fcn(LaunchContext ctx, BODY body_in)
 {
@@ -74,7 +95,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -127,7 +148,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -195,7 +216,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -248,7 +269,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -272,6 +293,113 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
 
 };
 
+/*!
+ * Number of blocks of block_threads threads using shmem bytes of dynamic
+ * shared memory that can be resident on the device at once
+ */
+RAJA_INLINE
+int launch_coresident_blocks(const void* func, int block_threads, size_t shmem)
+{
+  int blocks_per_sm = 0;
+#ifdef RAJA_ENABLE_HIP_OCCUPANCY_CALCULATOR
+  hipErrchk(hipOccupancyMaxActiveBlocksPerMultiprocessor(
+      &blocks_per_sm, func, block_threads, shmem));
+#else
+  RAJA_UNUSED_VAR(func);
+  RAJA_UNUSED_VAR(block_threads);
+  RAJA_UNUSED_VAR(shmem);
+#endif
+  return std::max(blocks_per_sm, 1) * RAJA::hip::device_prop().multiProcessorCount;
+}
+
+template <bool async>
+struct LaunchExecute<RAJA::expt::hip_launch_cooperative_t<async>> {
+
+  template <typename BODY_IN>
+  static void exec(LaunchContext const &ctx, BODY_IN &&body_in)
+  {
+    exec(RAJA::resources::Resource(resources::Hip::get_default()),
+         ctx,
+         std::forward<BODY_IN>(body_in));
+  }
+
+  template <typename BODY_IN>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY_IN &&body_in)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    auto func = launch_global_fcn<BODY>;
+
+    /*Get the concrete resource */
+    resources::Hip hip_res = res.get<RAJA::resources::Hip>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    hip_dim_t gridSize{ static_cast<hip_dim_member_t>(ctx.teams.value[0]),
+                        static_cast<hip_dim_member_t>(ctx.teams.value[1]),
+                        static_cast<hip_dim_member_t>(ctx.teams.value[2]) };
+
+    hip_dim_t blockSize{ static_cast<hip_dim_member_t>(ctx.threads.value[0]),
+                         static_cast<hip_dim_member_t>(ctx.threads.value[1]),
+                         static_cast<hip_dim_member_t>(ctx.threads.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr hip_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      //
+      // Setup shared memory buffers
+      //
+      size_t shmem = ctx.shared_mem_size;
+
+      //
+      // Limit the grid to the blocks that can be resident at once, taking
+      // from x first, then y and z
+      //
+      const hip_dim_member_t max_blocks = static_cast<hip_dim_member_t>(
+          launch_coresident_blocks((const void*)func,
+                                   blockSize.x * blockSize.y * blockSize.z,
+                                   shmem));
+      gridSize.x = std::min(gridSize.x, max_blocks);
+      gridSize.y = std::min(gridSize.y, std::max(max_blocks / gridSize.x, hip_dim_member_t(1)));
+      gridSize.z = std::min(gridSize.z, std::max(max_blocks / (gridSize.x * gridSize.y), hip_dim_member_t(1)));
+
+      {
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::hip::make_launch_body(
+            gridSize, blockSize, shmem, hip_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel
+        //
+        void *args[] = {(void*)&ctx, (void*)&body};
+#if defined(RAJA_ENABLE_ROCTX)
+        if(ctx.kernel_name) roctxRangePush(ctx.kernel_name);
+#endif
+        RAJA::hip::detail::prefetch_managed_ranges(hip_res);
+        hipErrchk(hipLaunchCooperativeKernel((const void*)func, dim3(gridSize), dim3(blockSize), args, shmem, hip_res.get_stream()));
+#if defined(RAJA_ENABLE_ROCTX)
+        if(ctx.kernel_name) roctxRangePop();
+#endif
+        RAJA::hip::launch(hip_res, async);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
 /*
    HIP global thread mapping
 */
@@ -0,0 +1,231 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining warp aggregated atomic operations for
+ *          HIP
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_hip_warp_atomic_HPP
+#define RAJA_policy_hip_warp_atomic_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <type_traits>
+
+#include "hip/hip_runtime.h"
+
+#include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/reduce.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+#if defined(__HIP_DEVICE_COMPILE__)
+
+#define RAJA_HIP_WARP_AGGREGATED_ATOMICS
+
+/*!
+ * Shuffle of any type, from an active srcLane
+ */
+template <typename T>
+RAJA_DEVICE RAJA_INLINE T hip_warp_atomic_shfl(T var, int srcLane)
+{
+  RAJA::hip::impl::AsIntegerArray<T,
+                                  RAJA::hip::impl::min_shfl_int_type_size,
+                                  RAJA::hip::impl::max_shfl_int_type_size> u(var);
+
+  for (size_t i = 0; i < u.array_size(); ++i) {
+    u.array[i] = ::__shfl(u.array[i], srcLane);
+  }
+  return u.value;
+}
+
+/*!
+ * The active lanes whose acc is the same as this lane's
+ */
+RAJA_DEVICE RAJA_INLINE unsigned long long hip_warp_atomic_peers(
+    unsigned long long active,
+    void const volatile *acc)
+{
+  const unsigned long long addr = reinterpret_cast<unsigned long long>(acc);
+  // take the address of the lowest remaining lane, until it is this lane's
+  unsigned long long remaining = active;
+  for (;;) {
+    const int leader = __ffsll(static_cast<long long>(remaining)) - 1;
+    const unsigned long long leader_addr = hip_warp_atomic_shfl(addr, leader);
+    const unsigned long long same = ::__ballot(leader_addr == addr);
+    if (leader_addr == addr) {
+      return same;
+    }
+    remaining &= ~same;
+  }
+}
+
+/*!
+ * Combines the values of the lanes of the wavefront with the same acc, and
+ * applies them with one call of atomic by the highest of those lanes.
+ *
+ * Each lane returns the value it would have seen if the lanes had done
+ * their atomics one after another in lane order: apply of the value before
+ * the combined atomic and the combined values of the lower lanes.
+ */
+template <typename T, typename Combine, typename Apply, typename Atomic>
+RAJA_DEVICE RAJA_INLINE T hip_warp_aggregated_atomic(T volatile *acc,
+                                                     T value,
+                                                     Combine combine,
+                                                     Apply apply,
+                                                     Atomic atomic)
+{
+  const unsigned long long active = ::__ballot(1);
+  const unsigned long long peers = hip_warp_atomic_peers(active, acc);
+
+  const int lane = ::__lane_id();
+  const unsigned long long lower = peers & ((1ull << lane) - 1ull);
+  const int prev = lower ? 63 - __clzll(lower) : -1;
+  const int last = 63 - __clzll(peers);
+
+  // inclusive scan over the peers in lane order, by pointer jumping, with
+  // every active lane shuffling in each step
+  T inclusive = value;
+  int pred = prev;
+  for (int step = 1; step < RAJA::policy::hip::WARP_SIZE; step *= 2) {
+    const int src = pred < 0 ? lane : pred;
+    const T other = hip_warp_atomic_shfl(inclusive, src);
+    const int other_pred = ::__shfl(pred, src);
+    if (pred >= 0) {
+      inclusive = combine(other, inclusive);
+      pred = other_pred;
+    }
+  }
+  const T exclusive = hip_warp_atomic_shfl(inclusive, prev < 0 ? lane : prev);
+
+  T old = value;
+  if (lane == last) {
+    old = atomic(acc, inclusive);
+  }
+  old = hip_warp_atomic_shfl(old, last);
+
+  return prev < 0 ? old : apply(old, exclusive);
+}
+
+#endif
+
+}  // namespace detail
+
+
+/*!
+ * Warp aggregated atomics: lanes of a wavefront that update the same
+ * address combine
+ * their values first, so that there is one atomic per address per wavefront.
+ *
+ * Add, Sub, Min, Max, And, Or, Xor, and Inc and Dec without a limit are
+ * aggregated, on top of the hip_atomic_explicit atomics; the others are
+ * passed on to those unchanged.
+ */
+#define RAJA_HIP_WARP_ATOMIC_AGGREGATED(NAME, COMBINE, APPLY)                 \
+  RAJA_SUPPRESS_HD_WARN                                                       \
+  template <typename T, typename host_policy>                                 \
+  RAJA_INLINE RAJA_HOST_DEVICE T                                              \
+  NAME(hip_warp_atomic_explicit<host_policy>, T volatile *acc, T value)       \
+  {                                                                           \
+    RAJA_HIP_WARP_ATOMIC_BODY(NAME, COMBINE, APPLY, value)                    \
+  }
+
+#if defined(RAJA_HIP_WARP_AGGREGATED_ATOMICS)
+#define RAJA_HIP_WARP_ATOMIC_BODY(NAME, COMBINE, APPLY, VALUE)                \
+    return detail::hip_warp_aggregated_atomic(                                \
+        acc, VALUE, COMBINE<T>{}, APPLY<T>{},                                 \
+        [](T volatile *a, T v) {                                              \
+          return RAJA::NAME(hip_atomic_explicit<host_policy>{}, a, v);        \
+        });
+#else
+#define RAJA_HIP_WARP_ATOMIC_BODY(NAME, COMBINE, APPLY, VALUE)                \
+    return RAJA::NAME(hip_atomic_explicit<host_policy>{}, acc, VALUE);
+#endif
+
+RAJA_HIP_WARP_ATOMIC_AGGREGATED(atomicAdd, RAJA::operators::plus, RAJA::operators::plus)
+RAJA_HIP_WARP_ATOMIC_AGGREGATED(atomicSub, RAJA::operators::plus, RAJA::operators::minus)
+RAJA_HIP_WARP_ATOMIC_AGGREGATED(atomicMin, RAJA::operators::minimum, RAJA::operators::minimum)
+RAJA_HIP_WARP_ATOMIC_AGGREGATED(atomicMax, RAJA::operators::maximum, RAJA::operators::maximum)
+RAJA_HIP_WARP_ATOMIC_AGGREGATED(atomicAnd, RAJA::operators::bit_and, RAJA::operators::bit_and)
+RAJA_HIP_WARP_ATOMIC_AGGREGATED(atomicOr, RAJA::operators::bit_or, RAJA::operators::bit_or)
+RAJA_HIP_WARP_ATOMIC_AGGREGATED(atomicXor, RAJA::operators::bit_xor, RAJA::operators::bit_xor)
+
+#undef RAJA_HIP_WARP_ATOMIC_AGGREGATED
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_warp_atomic_explicit<host_policy>, T volatile *acc)
+{
+  RAJA_HIP_WARP_ATOMIC_BODY(atomicAdd, RAJA::operators::plus, RAJA::operators::plus, T(1))
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_warp_atomic_explicit<host_policy>, T volatile *acc)
+{
+  RAJA_HIP_WARP_ATOMIC_BODY(atomicSub, RAJA::operators::plus, RAJA::operators::minus, T(1))
+}
+
+#undef RAJA_HIP_WARP_ATOMIC_BODY
+#undef RAJA_HIP_WARP_AGGREGATED_ATOMICS
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_warp_atomic_explicit<host_policy>, T volatile *acc, T val)
+{
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_warp_atomic_explicit<host_policy>, T volatile *acc, T val)
+{
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(hip_warp_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(hip_warp_atomic_explicit<host_policy>, T volatile *acc, T compare, T value)
+{
+  return RAJA::atomicCAS(hip_atomic_explicit<host_policy>{}, acc, compare, value);
+}
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_HIP
+#endif  // guard
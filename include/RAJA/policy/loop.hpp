@@ -25,6 +25,7 @@
 #endif
 
 #include "RAJA/policy/loop/forall.hpp"
+#include "RAJA/policy/loop/histogram.hpp"
 #include "RAJA/policy/loop/kernel.hpp"
 #include "RAJA/policy/loop/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
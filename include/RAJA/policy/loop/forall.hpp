@@ -32,6 +32,8 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/params/reduce.hpp"
+
 using RAJA::concepts::enable_if;
 
 namespace RAJA
@@ -65,6 +67,27 @@ RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
   }
   return RAJA::resources::EventProxy<Resource>(res);
 }
+
+///
+/// Reduction parameters are accumulated in registers of the calling thread
+///
+template <typename Iterable, typename Func, typename Resource,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<Resource> forall_param_impl(
+    Resource res,
+    const loop_exec &,
+    Iterable &&iter,
+    camp::tuple<Params...> const &params,
+    Func &&body)
+{
+  auto vals = expt::detail::make_param_values(params);
+  forall_impl(res,
+              loop_exec{},
+              std::forward<Iterable>(iter),
+              expt::detail::make_param_body(std::forward<Func>(body), vals));
+  expt::detail::combine_params(params, vals);
+  return RAJA::resources::EventProxy<Resource>(res);
+}
 }  // namespace loop
 
 }  // namespace policy
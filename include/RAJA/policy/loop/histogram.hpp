@@ -0,0 +1,70 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_loop_HPP
+#define RAJA_histogram_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/histogram.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+/*!
+        \brief count the values of [begin, begin + len) in their bins
+*/
+template <typename ExecPolicy, typename Iter, typename CountT, typename BinOp>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+count(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Index_type len,
+    CountT* bins,
+    Index_type num_bins,
+    BinOp bin_of)
+{
+  for (Index_type i = 0; i < len; ++i) {
+    const Index_type bin = RAJA::detail::histogram_bin(bin_of, begin[i], num_bins);
+    if (bin >= 0) {
+      bins[bin] += CountT(1);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
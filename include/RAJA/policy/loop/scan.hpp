@@ -156,6 +156,69 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief inclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+inclusive_adapted(
+    resources::Host host_res,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  ValueT agg = BinFn::identity();
+
+  for (DistanceT i = 0; i < n; ++i) {
+    agg = f(agg, begin[i]);
+    out[i] = agg;
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+exclusive_adapted(
+    resources::Host host_res,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::iterator_traits<Iter>::value_type;
+  ValueT agg = BinFn::identity();
+
+  for (DistanceT i = 0; i < n; ++i) {
+    const ValueT val = begin[i];
+    out[i] = agg;
+    agg = f(agg, val);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -25,6 +25,7 @@
 #include <iterator>
 
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
 
 #include "RAJA/util/concepts.hpp"
 
@@ -154,6 +155,166 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief stable sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  const RAJA::Index_type num_segments = (offsets_end - offsets_begin) - 1;
+  for (RAJA::Index_type s = 0; s < num_segments; ++s) {
+    detail::StableSorter{}(begin + offsets_begin[s],
+                           begin + offsets_begin[s+1], comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort each segment of given range of pairs using
+               comparison function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter,
+    ValIter vals_begin,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  const RAJA::Index_type num_segments = (offsets_end - offsets_begin) - 1;
+  for (RAJA::Index_type s = 0; s < num_segments; ++s) {
+    detail::StableSorter{}(begin + offsets_begin[s],
+                           begin + offsets_begin[s+1],
+                           RAJA::compare_first<zip_ref>(comp));
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief partially sort given range using comparison function so nth
+               is the element it would be if the range were sorted
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+nth_element(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::intro_select(begin, nth, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort the smallest elements of given range into [begin, middle)
+               using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+partial(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter middle,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::partial_sort(begin, middle, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief write the permutation that stably sorts given range of keys
+               using comparison function, the keys are not modified
+*/
+template <typename ExecPolicy, typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+argsort(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    IdxIter perm_begin,
+    Compare comp)
+{
+  using I = RAJA::detail::IterVal<IdxIter>;
+  const RAJA::Index_type len = keys_end - keys_begin;
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    perm_begin[i] = static_cast<I>(i);
+  }
+  detail::StableSorter{}(perm_begin, perm_begin + len,
+                         RAJA::detail::compare_indirect(keys_begin, comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range using comparison function, the
+               comparison sort does not use the bit range
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+stable_bits(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    int,
+    int,
+    Compare comp)
+{
+  return stable(host_res, ::RAJA::loop_exec{}, begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+               keys, the comparison sort does not use the bit range
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+stable_pairs_bits(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    int,
+    int,
+    Compare comp)
+{
+  return stable_pairs(host_res, ::RAJA::loop_exec{},
+      keys_begin, keys_end, vals_begin, comp);
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -34,7 +34,9 @@
 #endif
 
 #include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/histogram.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
+#include "RAJA/policy/openmp/MemUtils_OpenMP.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
 #include "RAJA/policy/openmp/region.hpp"
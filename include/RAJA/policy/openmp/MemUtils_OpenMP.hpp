@@ -0,0 +1,180 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining host allocators that place memory for
+ *          OpenMP execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MemUtils_OpenMP_HPP
+#define RAJA_MemUtils_OpenMP_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace omp
+{
+
+//! Where one thread first touched part of an allocation
+struct FirstTouchPlacement {
+  //! OpenMP thread number that touched the range
+  int thread;
+  //! cpu the thread ran on, -1 if unknown
+  int cpu;
+  //! NUMA node the thread ran on, -1 if unknown
+  int numa_node;
+  //! byte range [begin, end) of the allocation touched by the thread
+  size_t begin;
+  size_t end;
+};
+
+namespace detail
+{
+
+//! get the size of a page of host memory
+RAJA_INLINE
+size_t page_size()
+{
+#if defined(__linux__)
+  long bytes = sysconf(_SC_PAGESIZE);
+  return bytes > 0 ? static_cast<size_t>(bytes) : size_t(4096);
+#else
+  return size_t(4096);
+#endif
+}
+
+//! get the cpu and NUMA node the calling thread is running on
+RAJA_INLINE
+void current_cpu_and_node(int& cpu, int& numa_node)
+{
+  cpu = -1;
+  numa_node = -1;
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned c = 0;
+  unsigned n = 0;
+  if (syscall(SYS_getcpu, &c, &n, nullptr) == 0) {
+    cpu = static_cast<int>(c);
+    numa_node = static_cast<int>(n);
+  }
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Host allocator that places memory with parallel first touch.
+ *
+ * Pages are zeroed in an OpenMP parallel loop with schedule(static), the same
+ * contiguous partitioning used by omp_parallel_for_exec and
+ * omp_for_schedule_exec<Static<>>. On systems with a first touch policy each
+ * thread's part of the allocation lands on that thread's NUMA domain, so
+ * later loops over the data with the same number of threads read local
+ * memory. Usable with basic_mempool::MemPool.
+ *
+ * The placement of the most recent allocation is available from placement().
+ */
+struct FirstTouchAllocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    const size_t page_bytes = detail::page_size();
+    void* ptr = RAJA::allocate_aligned(page_bytes, nbytes);
+    if (ptr == nullptr) return nullptr;
+
+    char* bytes = static_cast<char*>(ptr);
+    const long num_pages = static_cast<long>((nbytes + page_bytes - 1) /
+                                             page_bytes);
+
+    std::vector<FirstTouchPlacement> placement(omp_get_max_threads());
+    int num_threads = 0;
+
+#pragma omp parallel
+    {
+      const int tid = omp_get_thread_num();
+      long first = num_pages;
+      long last = -1;
+
+#pragma omp for schedule(static) nowait
+      for (long p = 0; p < num_pages; ++p) {
+        const size_t begin = static_cast<size_t>(p) * page_bytes;
+        const size_t len =
+            (nbytes - begin) < page_bytes ? (nbytes - begin) : page_bytes;
+        std::memset(bytes + begin, 0, len);
+        if (p < first) first = p;
+        last = p;
+      }
+
+      FirstTouchPlacement& tp = placement[tid];
+      tp.thread = tid;
+      detail::current_cpu_and_node(tp.cpu, tp.numa_node);
+      if (last < first) {
+        tp.begin = tp.end = 0;
+      } else {
+        tp.begin = static_cast<size_t>(first) * page_bytes;
+        tp.end = static_cast<size_t>(last + 1) * page_bytes;
+        if (tp.end > nbytes) tp.end = nbytes;
+      }
+
+#pragma omp single nowait
+      num_threads = omp_get_num_threads();
+    }
+
+    placement.resize(num_threads);
+    m_placement = std::move(placement);
+    return ptr;
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    RAJA::free_aligned(ptr);
+    return true;
+  }
+
+  //! get the placement of the most recent allocation, one entry per thread
+  const std::vector<FirstTouchPlacement>& placement() const
+  {
+    return m_placement;
+  }
+
+private:
+  std::vector<FirstTouchPlacement> m_placement;
+};
+
+}  // namespace omp
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP
+
+#endif  // closing endif for header file include guard
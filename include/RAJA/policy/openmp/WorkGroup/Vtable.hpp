@@ -40,6 +40,15 @@ inline const Vtable_T* get_Vtable(omp_work const&)
   return get_Vtable<T, Vtable_T>(loop_work{});
 }
 
+/*!
+* Populate and return a Vtable object
+*/
+template < typename T, typename Vtable_T >
+inline const Vtable_T* get_Vtable(omp_work_steal const&)
+{
+  return get_Vtable<T, Vtable_T>(loop_work{});
+}
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -20,6 +20,12 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <omp.h>
+
 #include "RAJA/policy/openmp/policy.hpp"
 
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
@@ -75,6 +81,268 @@ struct WorkRunner<
         Args...>
 { };
 
+/*!
+ * Runs work in a storage container in order, each with the work-stealing
+ * loop policy, and returns any per run resources
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work_steal,
+        RAJA::ordered,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallOrdered<
+        RAJA::omp_parallel_for_steal_exec< >,
+        RAJA::omp_work_steal,
+        RAJA::ordered,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{ };
+
+/*!
+ * Runs work in a storage container in reverse order, each with the
+ * work-stealing loop policy, and returns any per run resources
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work_steal,
+        RAJA::reverse_ordered,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallReverse<
+        RAJA::omp_parallel_for_steal_exec< >,
+        RAJA::omp_work_steal,
+        RAJA::reverse_ordered,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{ };
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * a chunk of iterations at a time by one thread
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldOmpChunk
+{
+  template < typename segment_in, typename body_in >
+  HoldOmpChunk(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()(index_type chunk_begin, index_type chunk_end,
+                              Args... args) const
+  {
+    auto begin = std::begin(m_segment);
+    for (index_type i = chunk_begin; i < chunk_end; ++i) {
+      m_body(begin[i], args...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Runs work in a storage container out of order in a single parallel
+ * region. The loops are split into chunks, sized so each thread gets a
+ * few of them, and the threads take the next chunk as they finish one,
+ * the chunks of the longest loops first. Only the end of the region
+ * synchronizes the threads.
+ *
+ * The chunks are made by the first run and kept for the later runs of
+ * the same work group.
+ */
+template <typename EXEC_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunnerOmpChunkQueue
+{
+  using exec_policy = EXEC_POLICY_T;
+  using order_policy = RAJA::policy::omp::unordered_omp_chunk_queue;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Host;
+
+  using vtable_type = Vtable<void, index_type, index_type, Args...>;
+
+  //! Chunks handed to each thread when the loops are long enough
+  static constexpr std::ptrdiff_t chunks_per_thread = 4;
+
+  WorkRunnerOmpChunkQueue() = default;
+
+  WorkRunnerOmpChunkQueue(WorkRunnerOmpChunkQueue const&) = delete;
+  WorkRunnerOmpChunkQueue& operator=(WorkRunnerOmpChunkQueue const&) = delete;
+
+  WorkRunnerOmpChunkQueue(WorkRunnerOmpChunkQueue &&) = default;
+  WorkRunnerOmpChunkQueue& operator=(WorkRunnerOmpChunkQueue &&) = default;
+
+  // The type  that will hold the segment and loop body in work storage
+  template < typename ITERABLE, typename LOOP_BODY >
+  using holder_type = HoldOmpChunk<ITERABLE, LOOP_BODY, index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host by the threads
+  using vtable_exec_policy = exec_policy;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type<ITERABLE, LOOP_BODY>;
+
+    const std::ptrdiff_t len = std::distance(std::begin(iter), std::end(iter));
+
+    // Only enqueue if we have something to iterate over
+    if (len > 0) {
+
+      m_lengths.push_back(len);
+
+      storage.template emplace<holder>(
+          get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    if (m_chunks.empty() && !m_lengths.empty()) {
+      build_chunks();
+    }
+
+    auto begin = std::begin(storage);
+    const chunk_type* chunks = m_chunks.data();
+    const std::ptrdiff_t num_chunks = static_cast<std::ptrdiff_t>(m_chunks.size());
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (std::ptrdiff_t c = 0; c < num_chunks; ++c) {
+      value_type::call(&begin[chunks[c].loop],
+                       static_cast<index_type>(chunks[c].begin),
+                       static_cast<index_type>(chunks[c].end),
+                       args...);
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_lengths.clear();
+    m_chunks.clear();
+  }
+
+private:
+  struct chunk_type
+  {
+    std::ptrdiff_t loop;
+    std::ptrdiff_t begin;
+    std::ptrdiff_t end;
+  };
+
+  std::vector<std::ptrdiff_t> m_lengths;
+
+  // chunks of all the loops, set by the first run
+  mutable std::vector<chunk_type> m_chunks;
+
+  //
+  // Size the chunks from the total work and the number of threads, and
+  // put the chunks of the longest loops first
+  //
+  void build_chunks() const
+  {
+    const std::ptrdiff_t num_loops = static_cast<std::ptrdiff_t>(m_lengths.size());
+    std::ptrdiff_t total_iterations = 0;
+    for (std::ptrdiff_t len : m_lengths) {
+      total_iterations += len;
+    }
+    const std::ptrdiff_t num_threads = omp_get_max_threads();
+    const std::ptrdiff_t chunk_size = std::max(std::ptrdiff_t(1),
+        (total_iterations + num_threads * chunks_per_thread - 1) /
+        (num_threads * chunks_per_thread));
+
+    std::vector<std::ptrdiff_t> loops(num_loops);
+    for (std::ptrdiff_t i = 0; i < num_loops; ++i) {
+      loops[i] = i;
+    }
+    std::stable_sort(loops.begin(), loops.end(),
+                     [&](std::ptrdiff_t a, std::ptrdiff_t b) {
+                       return m_lengths[a] > m_lengths[b];
+                     });
+
+    for (std::ptrdiff_t loop : loops) {
+      for (std::ptrdiff_t b = 0; b < m_lengths[loop]; b += chunk_size) {
+        m_chunks.push_back(
+            chunk_type{loop, b, std::min(b + chunk_size, m_lengths[loop])});
+      }
+    }
+  }
+};
+
+/*!
+ * Runs work in a storage container out of order in a single parallel
+ * region and returns any per run resources
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_chunk_queue,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerOmpChunkQueue<
+        RAJA::omp_work,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{ };
+
+/*!
+ * Runs work in a storage container out of order in a single parallel
+ * region, the threads taking chunks as they finish as with the
+ * work-stealing loop policy, and returns any per run resources
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work_steal,
+        RAJA::policy::omp::unordered_omp_chunk_queue,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerOmpChunkQueue<
+        RAJA::omp_work_steal,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{ };
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -0,0 +1,260 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the work-stealing range scheduler used by
+ *          the OpenMP work-stealing execution policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_WorkSteal_HPP
+#define RAJA_policy_openmp_WorkSteal_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+namespace internal
+{
+
+/*!
+ * \brief Chase-Lev work-stealing deque of index ranges.
+ *
+ * The owning thread pushes and takes ranges at the bottom, other threads
+ * steal them from the top. Memory orders follow Le, Pop, Cohen and
+ * Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (PPoPP 2013).
+ *
+ * The owner only pushes the upper half of the range it is running, so the
+ * ranges in a deque about halve in length from top to bottom and a deque
+ * never holds more ranges than Index_type has bits. The buffer is fixed
+ * at twice that and does not grow; push reports a full deque instead.
+ *
+ * top and bottom are on separate cache lines so thieves polling top do not
+ * slow the owner's updates of bottom.
+ */
+class WorkStealDeque
+{
+public:
+  static constexpr int capacity = 128;
+
+  WorkStealDeque() : m_top(0), m_bottom(0) {}
+
+  WorkStealDeque(WorkStealDeque const&) = delete;
+  WorkStealDeque& operator=(WorkStealDeque const&) = delete;
+
+  //! Add a range at the bottom, owner only
+  bool push(Index_type begin, Index_type end)
+  {
+    const std::int64_t b = m_bottom.load(std::memory_order_relaxed);
+    const std::int64_t t = m_top.load(std::memory_order_acquire);
+    if (b - t >= capacity) {
+      return false;
+    }
+    Entry& e = m_buffer[b % capacity];
+    e.begin.store(begin, std::memory_order_relaxed);
+    e.end.store(end, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  //! Remove the range at the bottom, owner only
+  bool take(Index_type& begin, Index_type& end)
+  {
+    const std::int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = m_top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+
+    const Entry& e = m_buffer[b % capacity];
+    begin = e.begin.load(std::memory_order_relaxed);
+    end = e.end.load(std::memory_order_relaxed);
+
+    if (t == b) {
+      // last range, race thieves for it
+      const bool won = m_top.compare_exchange_strong(
+          t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  //! Remove the range at the top, any thread
+  bool steal(Index_type& begin, Index_type& end)
+  {
+    std::int64_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::int64_t b = m_bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+      return false;
+    }
+
+    const Entry& e = m_buffer[t % capacity];
+    begin = e.begin.load(std::memory_order_relaxed);
+    end = e.end.load(std::memory_order_relaxed);
+
+    return m_top.compare_exchange_strong(
+        t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+  }
+
+private:
+  struct Entry {
+    std::atomic<Index_type> begin;
+    std::atomic<Index_type> end;
+  };
+
+  static constexpr size_t line_bytes = static_cast<size_t>(RAJA::DATA_ALIGN);
+
+  std::atomic<std::int64_t> m_top;
+  char m_pad_top[line_bytes];
+  std::atomic<std::int64_t> m_bottom;
+  char m_pad_bottom[line_bytes];
+  Entry m_buffer[capacity];
+};
+
+/*!
+ * \brief Work-stealing scheduler for the iterations [0, length) of a loop.
+ *
+ * Every thread of an OpenMP team calls run. Each thread starts with an
+ * equal share of the iterations in its deque. A thread splits the range
+ * it takes in halves, pushing the upper half, until at most grain
+ * iterations are left to run. Threads without work steal the largest
+ * range of a random thread, so irregular loops rebalance without a
+ * central queue. run returns when all iterations are done.
+ */
+class WorkStealScheduler
+{
+public:
+  /*!
+   * A grain of zero or less picks one that gives each of max_threads
+   * threads about 32 ranges, enough to rebalance without splitting
+   * ranges smaller than the stealing costs.
+   */
+  WorkStealScheduler(Index_type length, Index_type grain, int max_threads)
+      : m_length(length),
+        m_grain(grain),
+        m_num_deques(max_threads > 0 ? max_threads : 1),
+        m_deques(new WorkStealDeque[m_num_deques]),
+        m_remaining(length)
+  {
+    if (m_grain <= 0) {
+      m_grain = length / (Index_type(32) * m_num_deques);
+    }
+    if (m_grain <= 0) {
+      m_grain = 1;
+    }
+  }
+
+  WorkStealScheduler(WorkStealScheduler const&) = delete;
+  WorkStealScheduler& operator=(WorkStealScheduler const&) = delete;
+
+  /*!
+   * \brief Run the iterations, chunk_body(begin, end) runs [begin, end).
+   *
+   * Called by each thread of the team inside the parallel region.
+   */
+  template <typename ChunkBody>
+  void run(ChunkBody&& chunk_body)
+  {
+    const int num_threads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+
+    if (num_threads > m_num_deques || tid >= m_num_deques) {
+      // more threads than deques, fall back to the first thread
+      if (tid == 0) {
+        chunk_body(Index_type(0), m_length);
+        m_remaining.store(0, std::memory_order_release);
+      }
+      return;
+    }
+
+    WorkStealDeque& own = m_deques[tid];
+
+    const Index_type share_begin = m_length * tid / num_threads;
+    const Index_type share_end = m_length * (tid + 1) / num_threads;
+    if (share_begin < share_end) {
+      own.push(share_begin, share_end);
+    }
+
+    std::uint64_t state = 0x9e3779b97f4a7c15ull * (tid + 1);
+
+    while (m_remaining.load(std::memory_order_acquire) > 0) {
+
+      Index_type begin = 0;
+      Index_type end = 0;
+
+      bool found = own.take(begin, end);
+
+      for (int attempt = 0; !found && attempt < num_threads; ++attempt) {
+        // xorshift victim selection
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const int victim = static_cast<int>(state % num_threads);
+        if (victim != tid) {
+          found = m_deques[victim].steal(begin, end);
+        }
+      }
+
+      if (!found) continue;
+
+      while (end - begin > m_grain) {
+        const Index_type mid = begin + (end - begin) / 2;
+        if (!own.push(mid, end)) break;
+        end = mid;
+      }
+
+      chunk_body(begin, end);
+
+      m_remaining.fetch_sub(end - begin, std::memory_order_acq_rel);
+    }
+  }
+
+private:
+  Index_type m_length;
+  Index_type m_grain;
+  int m_num_deques;
+  std::unique_ptr<WorkStealDeque[]> m_deques;
+  std::atomic<Index_type> m_remaining;
+};
+
+}  // namespace internal
+}  // namespace omp
+}  // namespace policy
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
@@ -68,8 +68,19 @@ template <typename T>
 RAJA_HOST_DEVICE
 RAJA_INLINE T atomicMin(omp_atomic, T volatile *acc, T value)
 {
+#if _OPENMP >= 202011
+  // OpenMP 5.1 atomic compare also works inside omp target regions
+  T ret;
+#pragma omp atomic compare capture
+  {
+    ret = *acc;  // capture old for return value
+    if (value < *acc) { *acc = value; }
+  }
+  return ret;
+#else
   // OpenMP doesn't define atomic trinary operators so use builtin atomics
   return atomicMin(builtin_atomic{}, acc, value);
+#endif
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -77,8 +88,19 @@ template <typename T>
 RAJA_HOST_DEVICE
 RAJA_INLINE T atomicMax(omp_atomic, T volatile *acc, T value)
 {
+#if _OPENMP >= 202011
+  // OpenMP 5.1 atomic compare also works inside omp target regions
+  T ret;
+#pragma omp atomic compare capture
+  {
+    ret = *acc;  // capture old for return value
+    if (value > *acc) { *acc = value; }
+  }
+  return ret;
+#else
   // OpenMP doesn't define atomic trinary operators so use builtin atomics
   return atomicMax(builtin_atomic{}, acc, value);
+#endif
 }
 
 
@@ -25,22 +25,32 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <memory>
 #include <type_traits>
 
 #include <omp.h>
 
+#include "RAJA/util/Span.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/IndexSetDepGraph.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/WorkSteal.hpp"
 
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/detail/fuse.hpp"
+#include "RAJA/pattern/params/reduce.hpp"
+#include "RAJA/pattern/params/schedule.hpp"
 #include "RAJA/pattern/region.hpp"
 
 
@@ -308,6 +318,470 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP implementations with reduction parameters
+///
+/// Each thread accumulates into its own registers and combines into the
+/// targets once when its part of the loop is done.
+///
+template <typename Iterable, typename Func, typename InnerPolicy, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_param_impl(resources::Host host_res,
+                                                                     const omp_parallel_exec<InnerPolicy>&,
+                                                                     Iterable&& iter,
+                                                                     camp::tuple<Params...> const& params,
+                                                                     Func&& loop_body)
+{
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    forall_param_impl(host_res, InnerPolicy{}, iter, params, body.get_priv());
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Schedule, typename Iterable, typename Func, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_param_impl(resources::Host host_res,
+                                                                     const omp_for_schedule_exec<Schedule>&,
+                                                                     Iterable&& iter,
+                                                                     camp::tuple<Params...> const& params,
+                                                                     Func&& loop_body)
+{
+  auto vals = expt::detail::make_param_values(params);
+  internal::forall_impl(Schedule{},
+                        std::forward<Iterable>(iter),
+                        expt::detail::make_param_body(std::forward<Func>(loop_body), vals));
+  #pragma omp critical
+  expt::detail::combine_params(params, vals);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Schedule, typename Iterable, typename Func, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_param_impl(resources::Host host_res,
+                                                                     const omp_for_nowait_schedule_exec<Schedule>&,
+                                                                     Iterable&& iter,
+                                                                     camp::tuple<Params...> const& params,
+                                                                     Func&& loop_body)
+{
+  auto vals = expt::detail::make_param_values(params);
+  internal::forall_impl_nowait(Schedule{},
+                               std::forward<Iterable>(iter),
+                               expt::detail::make_param_body(std::forward<Func>(loop_body), vals));
+  #pragma omp critical
+  expt::detail::combine_params(params, vals);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP implementations with scheduling hints
+///
+namespace internal
+{
+
+  //
+  // omp for schedule(static, grain)
+  //
+  template <typename Iterable, typename Func, int ChunkSize>
+  RAJA_INLINE void forall_grain_impl(const ::RAJA::policy::omp::Static<ChunkSize>&,
+                                     Iterable&& iter,
+                                     int grain,
+                                     Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(static, grain)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for schedule(guided, grain)
+  //
+  template <typename Iterable, typename Func, int ChunkSize>
+  RAJA_INLINE void forall_grain_impl(const ::RAJA::policy::omp::Guided<ChunkSize>&,
+                                     Iterable&& iter,
+                                     int grain,
+                                     Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(guided, grain)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for schedule(dynamic, grain), also used for Auto and Runtime
+  //
+  template <typename Policy, typename Iterable, typename Func>
+  RAJA_INLINE void forall_grain_impl(const Policy&,
+                                     Iterable&& iter,
+                                     int grain,
+                                     Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(dynamic, grain)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for schedule(static, grain) nowait, the only schedule that may be
+  // used with nowait
+  //
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_grain_impl_nowait(Iterable&& iter,
+                                            int grain,
+                                            Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for schedule(static, grain) nowait
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for over blocks of about the same cost. The threads of the team
+  // share the cumulative costs, blocks are found by binary search and
+  // taken dynamically.
+  //
+  template <typename Iterable, typename CostFunc, typename Func>
+  RAJA_INLINE void forall_cost_impl(Iterable&& iter,
+                                    const expt::detail::CostHint<CostFunc>& hint,
+                                    Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    using diff_type = decltype(distance_it);
+
+    if (distance_it <= 0) return;
+
+    double* cost_sum = nullptr;
+    #pragma omp single copyprivate(cost_sum)
+    {
+      cost_sum = new double[distance_it + 1];
+      cost_sum[0] = 0.0;
+    }
+
+    #pragma omp for schedule(static)
+    for (diff_type i = 0; i < distance_it; ++i) {
+      cost_sum[i + 1] = static_cast<double>(hint.cost(begin_it[i]));
+    }
+
+    #pragma omp single
+    {
+      for (diff_type i = 0; i < distance_it; ++i) {
+        cost_sum[i + 1] += cost_sum[i];
+      }
+    }
+
+    const double total = cost_sum[distance_it];
+    const diff_type num_blocks = std::min(
+        distance_it,
+        static_cast<diff_type>(
+            std::max(1, omp_get_num_threads() * hint.blocks_per_thread)));
+
+    auto block_begin = [=](diff_type b) -> diff_type {
+      if (b >= num_blocks) return distance_it;
+      if (!(total > 0.0)) return distance_it * b / num_blocks;
+      const double target = total * static_cast<double>(b) /
+                            static_cast<double>(num_blocks);
+      return static_cast<diff_type>(
+          std::lower_bound(cost_sum, cost_sum + distance_it, target) -
+          cost_sum);
+    };
+
+    #pragma omp for schedule(dynamic, 1)
+    for (diff_type b = 0; b < num_blocks; ++b) {
+      const diff_type end = block_begin(b + 1);
+      for (diff_type i = block_begin(b); i < end; ++i) {
+        loop_body(begin_it[i]);
+      }
+    }
+
+    #pragma omp single nowait
+    {
+      delete[] cost_sum;
+    }
+  }
+
+}  // end namespace internal
+
+template <typename Iterable, typename Func, typename InnerPolicy, typename Hint>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_hint_impl(resources::Host host_res,
+                                                                    const omp_parallel_exec<InnerPolicy>&,
+                                                                    Iterable&& iter,
+                                                                    Hint const& hint,
+                                                                    Func&& loop_body)
+{
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    using RAJA::expt::detail::forall_hint_impl;
+    forall_hint_impl(host_res, InnerPolicy{}, iter, hint, body.get_priv());
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// The affinity hint opens the parallel region itself, with the binding and
+/// number of threads it asks for, and the inner policy runs as usual in it.
+///
+namespace internal
+{
+
+  RAJA_INLINE int affinity_num_threads(expt::detail::AffinityHint const& hint)
+  {
+    const int max_threads = omp_get_max_threads();
+    if (hint.smt == expt::Smt::one_per_core) {
+      return std::max(1, std::min(max_threads, getNumCoresCPU()));
+    }
+    return max_threads;
+  }
+
+  template <typename Func>
+  RAJA_INLINE void affinity_region(expt::detail::AffinityHint const& hint,
+                                   Func&& body)
+  {
+    const int num_threads = affinity_num_threads(hint);
+    switch (hint.bind) {
+      case expt::Bind::close:
+        #pragma omp parallel num_threads(num_threads) proc_bind(close)
+        {
+          auto loopbody = body;
+          loopbody();
+        }
+        break;
+      case expt::Bind::spread:
+        #pragma omp parallel num_threads(num_threads) proc_bind(spread)
+        {
+          auto loopbody = body;
+          loopbody();
+        }
+        break;
+      default:
+        #pragma omp parallel num_threads(num_threads)
+        {
+          auto loopbody = body;
+          loopbody();
+        }
+        break;
+    }
+  }
+
+}  // end namespace internal
+
+template <typename Iterable, typename Func, typename InnerPolicy>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_hint_impl(resources::Host host_res,
+                                                                    const omp_parallel_exec<InnerPolicy>&,
+                                                                    Iterable&& iter,
+                                                                    expt::detail::AffinityHint const& hint,
+                                                                    Func&& loop_body)
+{
+  internal::affinity_region(hint, [&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    forall_impl(host_res, InnerPolicy{}, iter, body.get_priv());
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Schedule, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_hint_impl(resources::Host host_res,
+                                                                    const omp_for_schedule_exec<Schedule>&,
+                                                                    Iterable&& iter,
+                                                                    expt::detail::GrainHint const& hint,
+                                                                    Func&& loop_body)
+{
+  internal::forall_grain_impl(Schedule{},
+                              std::forward<Iterable>(iter),
+                              static_cast<int>(std::max(hint.grain, Index_type(1))),
+                              std::forward<Func>(loop_body));
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Schedule, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_hint_impl(resources::Host host_res,
+                                                                    const omp_for_nowait_schedule_exec<Schedule>&,
+                                                                    Iterable&& iter,
+                                                                    expt::detail::GrainHint const& hint,
+                                                                    Func&& loop_body)
+{
+  internal::forall_grain_impl_nowait(std::forward<Iterable>(iter),
+                                     static_cast<int>(std::max(hint.grain, Index_type(1))),
+                                     std::forward<Func>(loop_body));
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// The cost hint replaces the schedule of the policy. It is not used with
+/// nowait policies, which must keep their static schedule.
+///
+template <typename Schedule, typename Iterable, typename Func, typename CostFunc>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_hint_impl(resources::Host host_res,
+                                                                    const omp_for_schedule_exec<Schedule>&,
+                                                                    Iterable&& iter,
+                                                                    expt::detail::CostHint<CostFunc> const& hint,
+                                                                    Func&& loop_body)
+{
+  internal::forall_cost_impl(std::forward<Iterable>(iter),
+                             hint,
+                             std::forward<Func>(loop_body));
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP implementation of fused loops
+///
+/// All groups of loop bodies run in one parallel region. The loops of a
+/// static schedule give each thread the same indices in every group.
+///
+namespace internal
+{
+
+  template <typename Policy>
+  struct is_omp_nowait : std::false_type {
+  };
+
+  template <typename Schedule>
+  struct is_omp_nowait<omp_for_nowait_schedule_exec<Schedule>> : std::true_type {
+  };
+
+  template <typename InnerPolicy, typename Iterable>
+  struct OmpFuseRunner {
+    resources::Host host_res;
+    Iterable const& iter;
+
+    template <typename... Bodies>
+    RAJA_INLINE void group(expt::detail::FusedBodies<Bodies...> const& bodies)
+    {
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(bodies);
+      forall_impl(host_res, InnerPolicy{}, iter, body.get_priv());
+    }
+
+    RAJA_INLINE void group(expt::detail::FusedBodies<> const&) {}
+
+    // loops without nowait end with a barrier
+    RAJA_INLINE void barrier()
+    {
+      if (is_omp_nowait<InnerPolicy>::value) {
+        #pragma omp barrier
+      }
+    }
+  };
+
+}  // end namespace internal
+
+template <typename Iterable, typename InnerPolicy, typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_fused_impl(resources::Host host_res,
+                                                                     const omp_parallel_exec<InnerPolicy>&,
+                                                                     Iterable&& iter,
+                                                                     Bodies&&... bodies)
+{
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    internal::OmpFuseRunner<InnerPolicy, camp::decay<Iterable>> run{host_res, iter};
+    expt::detail::FuseGroups<>::apply(run, bodies...);
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP work-stealing policy implementation
+///
+namespace internal
+{
+
+  //
+  // Loop run by each thread of the team, begin_it[i] for the iterations
+  // i the scheduler gives the thread
+  //
+  template <typename Iterator, typename Func>
+  RAJA_INLINE void forall_steal_thread(WorkStealScheduler& sched,
+                                       Iterator begin_it,
+                                       Func&& loop_body)
+  {
+    using diff_type = decltype(begin_it - begin_it);
+    sched.run([&](Index_type begin, Index_type end) {
+      for (Index_type i = begin; i < end; ++i) {
+        loop_body(begin_it[static_cast<diff_type>(i)]);
+      }
+    });
+  }
+
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_steal_impl(Iterable&& iter,
+                                     Index_type grain,
+                                     Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    if (distance_it <= 0) return;
+
+    WorkStealScheduler sched(static_cast<Index_type>(distance_it),
+                             grain,
+                             omp_get_max_threads());
+
+    RAJA::region<RAJA::omp_parallel_region>([&]() {
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      forall_steal_thread(sched, begin_it, body.get_priv());
+    });
+  }
+
+}  // end namespace internal
+
+template <typename Iterable, typename Func, int GrainSize>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_parallel_for_steal_exec<GrainSize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  internal::forall_steal_impl(std::forward<Iterable>(iter),
+                              GrainSize,
+                              std::forward<Func>(loop_body));
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, int GrainSize>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_hint_impl(resources::Host host_res,
+                                                                    const omp_parallel_for_steal_exec<GrainSize>&,
+                                                                    Iterable&& iter,
+                                                                    expt::detail::GrainHint const& hint,
+                                                                    Func&& loop_body)
+{
+  internal::forall_steal_impl(std::forward<Iterable>(iter),
+                              std::max(hint.grain, Index_type(1)),
+                              std::forward<Func>(loop_body));
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, int GrainSize, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_param_impl(resources::Host host_res,
+                                                                     const omp_parallel_for_steal_exec<GrainSize>&,
+                                                                     Iterable&& iter,
+                                                                     camp::tuple<Params...> const& params,
+                                                                     Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  if (distance_it <= 0) return resources::EventProxy<resources::Host>(host_res);
+
+  internal::WorkStealScheduler sched(static_cast<Index_type>(distance_it),
+                                     GrainSize,
+                                     omp_get_max_threads());
+
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    auto vals = expt::detail::make_param_values(params);
+    internal::forall_steal_thread(sched,
+                                  begin_it,
+                                  expt::detail::make_param_body(body.get_priv(), vals));
+    #pragma omp critical
+    expt::detail::combine_params(params, vals);
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -318,67 +792,346 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace internal
+{
+
+/// Runs the indices [offset, offset + length) of a segment, with their
+/// position icount + i in the index set if Icount is true
+template <bool Icount>
+struct CallForallSlice;
+
+template <>
+struct CallForallSlice<false> {
+  Index_type offset;
+  Index_type length;
+  Index_type icount;
+
+  template <typename T, typename ExecPol, typename Body, typename Res>
+  RAJA_INLINE void operator()(T const& segment,
+                              ExecPol,
+                              Body const& body,
+                              Res r) const
+  {
+    wrap::forall(r,
+                 ExecPol(),
+                 RAJA::make_span(segment.begin() + offset, length),
+                 body);
+  }
+};
+
+template <>
+struct CallForallSlice<true> {
+  Index_type offset;
+  Index_type length;
+  Index_type icount;
+
+  template <typename T, typename ExecPol, typename Body, typename Res>
+  RAJA_INLINE void operator()(T const& segment,
+                              ExecPol,
+                              Body const& body,
+                              Res r) const
+  {
+    wrap::forall_Icount(r,
+                        ExecPol(),
+                        RAJA::make_span(segment.begin() + offset, length),
+                        icount,
+                        body);
+  }
+};
+
 /*!
- ******************************************************************************
+ * \brief Split the indices of iset into chunks of similar length and run
+ *        them in an omp parallel loop.
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ *        Chunk c covers the positions [c*chunk, (c+1)*chunk) of the index
+ *        set, so long segments are split across chunks and short segments
+ *        share one. Each chunk runs the slices of the segments it covers
+ *        with the segment execution policy.
+ */
+template <bool Icount,
+          typename SegmentExecPolicy,
+          typename Res,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE void forall_balanced(Res r,
+                                 Index_type min_chunk_size,
+                                 const TypedIndexSet<SegmentTypes...>& iset,
+                                 LoopBody const& loop_body)
+{
+  // chunks per thread, more chunks absorb the cost differences between
+  // segment types at the price of more scheduling
+  constexpr Index_type chunks_per_thread = 4;
+
+  const Index_type num_segs = static_cast<Index_type>(iset.getNumSegments());
+  const Index_type len = static_cast<Index_type>(iset.getLength());
+  if (len <= 0) return;
+
+  const Index_type nt = omp_get_max_threads();
+  Index_type chunk = RAJA_DIVIDE_CEILING_INT(len, nt * chunks_per_thread);
+  if (chunk < min_chunk_size) chunk = min_chunk_size;
+  const Index_type num_chunks = RAJA_DIVIDE_CEILING_INT(len, chunk);
+
+  auto const& icounts = iset.getSegmentIcounts();
+
+#pragma omp parallel
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+
+#pragma omp for schedule(dynamic, 1)
+    for (Index_type c = 0; c < num_chunks; ++c) {
+      Index_type pos = c * chunk;
+      const Index_type chunk_end = (pos + chunk < len) ? pos + chunk : len;
+
+      // last segment starting at or before pos, this skips empty segments
+      Index_type seg = 0;
+      Index_type count = num_segs;
+      while (count > 0) {
+        const Index_type step = count / 2;
+        if (icounts[seg + step] <= pos) {
+          seg += step + 1;
+          count -= step + 1;
+        } else {
+          count = step;
+        }
+      }
+      --seg;
+
+      for (; pos < chunk_end; ++seg) {
+        const Index_type seg_end = (seg + 1 < num_segs) ? icounts[seg + 1]
+                                                         : len;
+        const Index_type end = (seg_end < chunk_end) ? seg_end : chunk_end;
+        if (end > pos) {
+          iset.segmentCall(
+              seg,
+              CallForallSlice<Icount>{pos - icounts[seg], end - pos, pos},
+              SegmentExecPolicy(),
+              body,
+              r);
+        }
+        pos = end;
+      }
+    }
+  }
+}
+
+}  // namespace internal
+
+/*!
+ ******************************************************************************
  *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ * \brief  Iterate over index set segments split into chunks of similar
+ *         length using an omp parallel loop. Individual slices of segments
+ *         use the segment execution policy.
  *
  ******************************************************************************
  */
+template <typename Res,
+          int MinChunkSize,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall_impl(
+    Res r,
+    const omp_parallel_balanced_chunk_segit<MinChunkSize>&,
+    SegmentExecPolicy,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    LoopBody loop_body)
+{
+  internal::forall_balanced<false, SegmentExecPolicy>(r,
+                                                      MinChunkSize,
+                                                      iset,
+                                                      loop_body);
+  return resources::EventProxy<Res>(r);
+}
 
-/*
- * TODO: Fix this!!!
+template <typename Res,
+          int MinChunkSize,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall_Icount_impl(
+    Res r,
+    const omp_parallel_balanced_chunk_segit<MinChunkSize>&,
+    SegmentExecPolicy,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    LoopBody loop_body)
+{
+  internal::forall_balanced<true, SegmentExecPolicy>(r,
+                                                     MinChunkSize,
+                                                     iset,
+                                                     loop_body);
+  return resources::EventProxy<Res>(r);
+}
+
+namespace internal
+{
+
+/*!
+ * \brief Run segment seg of iset in an omp task, then start the tasks of
+ *        its successors that have no other unfinished predecessor.
+ *
+ *        Threads without a ready segment wait at the barrier of the
+ *        enclosing parallel region, where they execute tasks as they are
+ *        created, so no thread spins on a dependency.
  */
+template <bool Icount,
+          typename SegmentExecPolicy,
+          typename Res,
+          typename LoopBody,
+          typename... SegmentTypes>
+void forall_taskgraph_segment(Res r,
+                              const TypedIndexSet<SegmentTypes...>* iset,
+                              const IndexSetDepGraph* graph,
+                              std::atomic<Index_type>* num_pending,
+                              Index_type seg,
+                              LoopBody const* loop_body)
+{
+  // arguments are pointers so the task copies them and not the objects
+#pragma omp task firstprivate(seg)
+  {
+    {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(*loop_body);
+      auto& body = privatizer.get_priv();
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
-{
-  if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+      const Index_type num_segs =
+          static_cast<Index_type>(iset->getNumSegments());
+      auto const& icounts = iset->getSegmentIcounts();
+      const Index_type begin = icounts[seg];
+      const Index_type end = (seg + 1 < num_segs)
+                                 ? icounts[seg + 1]
+                                 : static_cast<Index_type>(iset->getLength());
+      iset->segmentCall(seg,
+                        CallForallSlice<Icount>{0, end - begin, begin},
+                        SegmentExecPolicy(),
+                        body,
+                        r);
+    }
+
+    const Index_type* succs = graph->getSuccessors(seg);
+    for (Index_type k = 0; k < graph->getNumSuccessors(seg); ++k) {
+      if (num_pending[succs[k]].fetch_sub(1) == 1) {
+        forall_taskgraph_segment<Icount, SegmentExecPolicy>(
+            r, iset, graph, num_pending, succs[k], loop_body);
+      }
+    }
   }
+}
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+/*!
+ * \brief Run the segments of an index set as omp tasks in an order that
+ *        respects the dependency graph of the segments.
+ */
+template <bool Icount,
+          typename SegmentExecPolicy,
+          typename Res,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE void forall_taskgraph(Res r,
+                                  const DepGraphIndexSet<SegmentTypes...>& dgset,
+                                  LoopBody const& loop_body)
+{
+  const TypedIndexSet<SegmentTypes...>& iset = dgset.getIndexSet();
+  const IndexSetDepGraph& graph = dgset.getDepGraph();
+
+  const Index_type num_segs = static_cast<Index_type>(iset.getNumSegments());
+  if (graph.getNumSegments() != num_segs) {
+    RAJA_ABORT_OR_THROW("IndexSet dependency graph does not match the "
+                        "segments of the index set");
+  }
+  if (num_segs == 0) return;
 
-  int num_seg = ncis.getNumSegments();
+  std::unique_ptr<std::atomic<Index_type>[]> num_pending(
+      new std::atomic<Index_type>[num_segs]);
+  for (Index_type s = 0; s < num_segs; ++s) {
+    num_pending[s].store(graph.getNumPredecessors(s));
+  }
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+#pragma omp parallel
+#pragma omp single nowait
+  for (Index_type s = 0; s < num_segs; ++s) {
+    if (graph.getNumPredecessors(s) == 0) {
+      forall_taskgraph_segment<Icount, SegmentExecPolicy>(
+          r, &iset, &graph, num_pending.get(), s, &loop_body);
+    }
+  }
+}
 
-    task->wait();
+}  // namespace internal
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments using omp tasks scheduled by the
+ *         segment dependency graph. Individual segment execution will use
+ *         execution policy template parameter.
+ *
+ *         A segment starts as soon as the segments it depends on are done,
+ *         so independent segments of a sweep run concurrently.
+ *
+ ******************************************************************************
+ */
+template <typename Res,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall_impl(
+    Res r,
+    const omp_taskgraph_segit&,
+    SegmentExecPolicy,
+    const DepGraphIndexSet<SegmentTypes...>& iset,
+    LoopBody loop_body)
+{
+  internal::forall_taskgraph<false, SegmentExecPolicy>(r, iset, loop_body);
+  return resources::EventProxy<Res>(r);
+}
 
-    task->reset();
+template <typename Res,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall_Icount_impl(
+    Res r,
+    const omp_taskgraph_segit&,
+    SegmentExecPolicy,
+    const DepGraphIndexSet<SegmentTypes...>& iset,
+    LoopBody loop_body)
+{
+  internal::forall_taskgraph<true, SegmentExecPolicy>(r, iset, loop_body);
+  return resources::EventProxy<Res>(r);
+}
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
-    }
+template <typename Res,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall_impl(
+    Res r,
+    const omp_taskgraph_interval_segit&,
+    SegmentExecPolicy,
+    const DepGraphIndexSet<SegmentTypes...>& iset,
+    LoopBody loop_body)
+{
+  internal::forall_taskgraph<false, SegmentExecPolicy>(r, iset, loop_body);
+  return resources::EventProxy<Res>(r);
+}
 
-  }  // iterate over segments of index set
+template <typename Res,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall_Icount_impl(
+    Res r,
+    const omp_taskgraph_interval_segit&,
+    SegmentExecPolicy,
+    const DepGraphIndexSet<SegmentTypes...>& iset,
+    LoopBody loop_body)
+{
+  internal::forall_taskgraph<true, SegmentExecPolicy>(r, iset, loop_body);
+  return resources::EventProxy<Res>(r);
 }
-*/
 
 }  // namespace omp
 
@@ -0,0 +1,127 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_openmp_HPP
+#define RAJA_histogram_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/histogram.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+namespace detail
+{
+namespace openmp
+{
+
+//! bytes between the bins of different threads, so they do not share lines
+constexpr size_t get_cache_line_bytes() { return 64; }
+
+}  // namespace openmp
+
+}  // namespace detail
+
+/*!
+        \brief count the values of [begin, begin + len) in their bins
+
+        Each thread counts its values in its own bins, then adds them to
+        bins with one atomic per bin. When there are more private bins than
+        values the values are added to bins with atomics directly.
+*/
+template <typename ExecPolicy, typename Iter, typename CountT, typename BinOp>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+count(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Index_type len,
+    CountT* bins,
+    Index_type num_bins,
+    BinOp bin_of)
+{
+  const int max_threads = omp_get_max_threads();
+
+  if (num_bins > len / max_threads) {
+
+#pragma omp parallel for
+    for (Index_type i = 0; i < len; ++i) {
+      const Index_type bin = RAJA::detail::histogram_bin(bin_of, begin[i], num_bins);
+      if (bin >= 0) {
+#pragma omp atomic
+        bins[bin] += CountT(1);
+      }
+    }
+
+  } else {
+
+    // each thread's bins start a line after the end of the previous ones
+    constexpr Index_type line_count =
+        detail::openmp::get_cache_line_bytes() / sizeof(CountT);
+    const Index_type stride =
+        (num_bins + line_count - 1) / line_count * line_count + line_count;
+    std::vector<CountT> thread_bins(stride * max_threads, CountT(0));
+
+#pragma omp parallel
+    {
+      CountT* my_bins = thread_bins.data() + stride * omp_get_thread_num();
+
+#pragma omp for nowait
+      for (Index_type i = 0; i < len; ++i) {
+        const Index_type bin = RAJA::detail::histogram_bin(bin_of, begin[i], num_bins);
+        if (bin >= 0) {
+          my_bins[bin] += CountT(1);
+        }
+      }
+
+      for (Index_type bin = 0; bin < num_bins; ++bin) {
+        if (my_bins[bin] != CountT(0)) {
+#pragma omp atomic
+          bins[bin] += my_bins[bin];
+        }
+      }
+    }
+
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -27,6 +27,7 @@
 #include "RAJA/pattern/kernel/Collapse.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 
+#include "RAJA/util/Layout.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -41,6 +42,19 @@ struct omp_parallel_collapse_exec
                             RAJA::policy::omp::For> {
 };
 
+/*!
+ * Collapse policy that runs the outer loops of the collapsed loops in
+ * parallel, collapsed as with omp_parallel_collapse_exec, and the
+ * innermost loop as a simd_exec loop, so it stays a simple loop the
+ * compiler can vectorize. internal::collapse_inner_unit_stride tells
+ * whether that loop is unit stride.
+ */
+struct omp_parallel_collapse_simd_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For> {
+};
+
 namespace internal
 {
 
@@ -129,6 +143,147 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
 };
 
 
+/////////
+// Collapsing any other number of loops into one flat loop
+/////////
+
+template <typename Types, typename Data, camp::idx_t... Args>
+struct CollapseSegmentTypes {
+  using type = Types;
+};
+
+template <typename Types, typename Data, camp::idx_t Arg0, camp::idx_t... Args>
+struct CollapseSegmentTypes<Types, Data, Arg0, Args...> {
+  using type = typename CollapseSegmentTypes<
+      setSegmentTypeFromData<Types, Arg0, Data>, Data, Args...>::type;
+};
+
+template <camp::idx_t... Args, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
+                                             ArgList<Args...>,
+                                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    exec_flat(data, camp::make_idx_seq_t<sizeof...(Args)>{});
+  }
+
+  // The loops run as one loop over the product of their lengths, and a
+  // Layout of the lengths recovers the index of each loop with its
+  // precomputed divisors
+  template <typename Data, camp::idx_t... Is>
+  static RAJA_INLINE void exec_flat(Data& data, camp::idx_seq<Is...>)
+  {
+    const Layout<sizeof...(Args)> layout(
+        static_cast<Index_type>(segment_length<Args>(data))...);
+    const Index_type len = layout.size_noproj();
+
+    // Set the argument types for this loop
+    using NewTypes = typename CollapseSegmentTypes<Types, Data, Args...>::type;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel for firstprivate(privatizer)
+    for (Index_type i = 0; i < len; ++i) {
+      Index_type idx[sizeof...(Args)];
+      layout.toIndices(i, idx[Is]...);
+      auto& private_data = privatizer.get_priv();
+      camp::sink((private_data.template assign_offset<Args>(
+                      static_cast<segment_diff_type<Args, Data>>(idx[Is])),
+                  0)...);
+      execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(private_data);
+    }
+  }
+};
+
+
+
+/////////
+// Collapsing the outer loops, with a vectorized innermost loop
+/////////
+
+template <camp::idx_t Arg0, camp::idx_t Arg1, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_simd_exec,
+                                             ArgList<Arg0, Arg1>,
+                                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    auto i0 = l0;
+    auto i1 = l1;
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel for private(i0, i1) firstprivate(privatizer)
+    for (i0 = 0; i0 < l0; ++i0) {
+      auto& private_data = privatizer.get_priv();
+      private_data.template assign_offset<Arg0>(i0);
+      RAJA_SIMD
+      for (i1 = 0; i1 < l1; ++i1) {
+        private_data.template assign_offset<Arg1>(i1);
+        execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
+      }
+    }
+  }
+};
+
+
+template <camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_simd_exec,
+                                             ArgList<Arg0, Arg1, Arg2>,
+                                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    const auto l2 = segment_length<Arg2>(data);
+    auto i0 = l0;
+    auto i1 = l1;
+    auto i2 = l2;
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel for private(i0, i1, i2) firstprivate(privatizer) \
+    RAJA_COLLAPSE(2)
+    for (i0 = 0; i0 < l0; ++i0) {
+      for (i1 = 0; i1 < l1; ++i1) {
+        auto& private_data = privatizer.get_priv();
+        private_data.template assign_offset<Arg0>(i0);
+        private_data.template assign_offset<Arg1>(i1);
+        RAJA_SIMD
+        for (i2 = 0; i2 < l2; ++i2) {
+          private_data.template assign_offset<Arg2>(i2);
+          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
+        }
+      }
+    }
+  }
+};
+
+
+
 
 
 
@@ -0,0 +1,210 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for a persistent OpenMP thread team that runs the
+ *          OpenMP parallel regions of successive foralls without forking a
+ *          new team for each one.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_persistent_team_openmp_HPP
+#define RAJA_persistent_team_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#include <omp.h>
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * @brief Scope object that keeps one OpenMP thread team alive for its
+ *        lifetime and runs the OpenMP parallel regions started on the
+ *        creating thread on that team.
+ *
+ * Every forall with an omp_parallel_exec policy, and every
+ * RAJA::region<omp_parallel_region>, opens a parallel region and so pays a
+ * fork and a join. Inside the scope of a team they are run by the threads of
+ * one parallel region opened when the team is created, which wait between
+ * regions by spinning for spin_count iterations and then parking:
+ *
+ *     for (int step = 0; step < num_steps; ++step) {
+ *       RAJA::expt::OmpPersistentTeam team;
+ *
+ *       RAJA::forall<RAJA::omp_parallel_for_exec>(range, body0);
+ *       RAJA::forall<RAJA::omp_parallel_for_exec>(range, body1);
+ *     }
+ *
+ * The team's parallel region is opened by a helper thread, which is thread 0
+ * of the team, so the creating thread only hands out the regions and waits
+ * for them. Only regions started on the creating thread, outside any other
+ * parallel region, use the team; the nested and worksharing constructs of a
+ * region behave as in a region of its own. Teams may be nested, the
+ * innermost one is used.
+ */
+class OmpPersistentTeam
+{
+public:
+  static constexpr int default_spin_count = 1 << 14;
+
+  explicit OmpPersistentTeam(int num_threads = omp_get_max_threads(),
+                             int spin_count = default_spin_count)
+      : m_spin_count(spin_count),
+        m_previous(current())
+  {
+    // the per-thread storage of reducers is sized by omp_get_max_threads
+    num_threads = std::max(1, std::min(num_threads, omp_get_max_threads()));
+
+    m_helper = std::thread([this, num_threads]() { team_main(num_threads); });
+    while (m_num_threads.load(std::memory_order_acquire) == 0) {
+      std::this_thread::yield();
+    }
+
+    current() = this;
+  }
+
+  OmpPersistentTeam(OmpPersistentTeam const&) = delete;
+  OmpPersistentTeam& operator=(OmpPersistentTeam const&) = delete;
+
+  ~OmpPersistentTeam()
+  {
+    current() = m_previous;
+
+    m_stop = true;
+    post();
+    m_helper.join();
+  }
+
+  //! number of threads of the team
+  int num_threads() const
+  {
+    return m_num_threads.load(std::memory_order_relaxed);
+  }
+
+  //! the team regions on this thread run on, or nullptr
+  static OmpPersistentTeam*& current()
+  {
+    static thread_local OmpPersistentTeam* team = nullptr;
+    return team;
+  }
+
+  /*!
+   * Runs a copy of body on each thread of the team, like the body of a
+   * parallel region, and returns when all are done
+   */
+  template <typename Func>
+  void run(Func&& body)
+  {
+    using body_type = typename std::decay<Func>::type;
+
+    m_body = static_cast<const void*>(&body);
+    m_invoke = [](const void* b) {
+      body_type loopbody = *static_cast<const body_type*>(b);
+      loopbody();
+    };
+    m_done.store(0, std::memory_order_relaxed);
+    post();
+
+    const int num = num_threads();
+    int spins = 0;
+    while (m_done.load(std::memory_order_acquire) != num) {
+      if (++spins > m_spin_count) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  int m_spin_count;
+  OmpPersistentTeam* m_previous;
+  std::thread m_helper;
+
+  std::atomic<int> m_num_threads{0};
+  std::atomic<unsigned> m_generation{0};
+  std::atomic<int> m_parked{0};
+  std::atomic<int> m_done{0};
+  bool m_stop = false;
+
+  const void* m_body = nullptr;
+  void (*m_invoke)(const void*) = nullptr;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+
+  //! start the next generation of the team, writes before are visible to it
+  void post()
+  {
+    m_generation.fetch_add(1, std::memory_order_seq_cst);
+    if (m_parked.load(std::memory_order_seq_cst) > 0) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_wake.notify_all();
+    }
+  }
+
+  //! wait for a generation after seen, spinning and then parking
+  unsigned wait_after(unsigned seen)
+  {
+    for (int spins = 0; spins < m_spin_count; ++spins) {
+      unsigned g = m_generation.load(std::memory_order_acquire);
+      if (g != seen) {
+        return g;
+      }
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_parked.fetch_add(1, std::memory_order_seq_cst);
+    m_wake.wait(lock, [&]() {
+      return m_generation.load(std::memory_order_seq_cst) != seen;
+    });
+    m_parked.fetch_sub(1, std::memory_order_relaxed);
+    return m_generation.load(std::memory_order_acquire);
+  }
+
+  void team_main(int num_threads)
+  {
+    const unsigned first = m_generation.load(std::memory_order_relaxed);
+
+#pragma omp parallel num_threads(num_threads)
+    {
+#pragma omp single
+      m_num_threads.store(omp_get_num_threads(), std::memory_order_release);
+
+      unsigned seen = first;
+      while (true) {
+        seen = wait_after(seen);
+        if (m_stop) {
+          break;
+        }
+        m_invoke(m_body);
+        m_done.fetch_add(1, std::memory_order_acq_rel);
+      }
+    }
+  }
+};
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
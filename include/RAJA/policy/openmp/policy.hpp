@@ -224,6 +224,28 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
 
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Work-stealing loop execution policies
+///
+/// The threads of an OpenMP parallel region split the iterations into
+/// ranges of at most GrainSize iterations and steal ranges from each
+/// other. The default picks a grain from the length and thread count.
+///
+///////////////////////////////////////////////////////////////////////
+///
+template <int GrainSize = default_chunk_size>
+struct omp_parallel_for_steal_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+  static constexpr int grain_size = GrainSize;
+};
+
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -236,6 +258,31 @@ using omp_parallel_for_segit = omp_parallel_for_exec;
 ///
 using omp_parallel_segit = omp_parallel_for_segit;
 
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Load balanced Indexset segment iteration policies
+///
+/// Segments are split into chunks of similar length, at least
+/// MinChunkSize indices, and short segments are coalesced into one chunk.
+/// The chunks are scheduled dynamically across the threads.
+///
+///////////////////////////////////////////////////////////////////////
+///
+template <int MinChunkSize>
+struct omp_parallel_balanced_chunk_segit
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::balanced_segit,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+  static_assert(MinChunkSize > 0, "MinChunkSize must be positive");
+  static constexpr int min_chunk_size = MinChunkSize;
+};
+
+///
+using omp_parallel_balanced_segit = omp_parallel_balanced_chunk_segit<1024>;
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -267,6 +314,28 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+///
+/// Runs the loops of a WorkGroup one after another, each with the
+/// work-stealing loop execution policy.
+///
+struct omp_work_steal
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::workgroup_exec,
+                                            Launch::sync,
+                                            Platform::host> {
+};
+
+///
+/// Runs the loops of a WorkGroup out of order in one parallel region, as
+/// chunks of iterations handed out to the threads as they finish, with a
+/// single barrier at the end.
+///
+struct unordered_omp_chunk_queue
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -328,6 +397,8 @@ using policy::omp::omp_parallel_for_dynamic_exec;
 using policy::omp::omp_parallel_for_guided_exec;
 ///
 using policy::omp::omp_parallel_for_runtime_exec;
+///
+using policy::omp::omp_parallel_for_steal_exec;
 
 ///
 /// Type aliases for omp parallel for iteration over indexset segments
@@ -335,6 +406,10 @@ using policy::omp::omp_parallel_for_runtime_exec;
 using policy::omp::omp_parallel_for_segit;
 ///
 using policy::omp::omp_parallel_segit;
+///
+using policy::omp::omp_parallel_balanced_chunk_segit;
+///
+using policy::omp::omp_parallel_balanced_segit;
 
 ///
 /// Type alias for omp parallel region containing an inner 'omp for' loop 
@@ -400,6 +475,10 @@ using policy::omp::omp_synchronize;
 
 ///
 using policy::omp::omp_work;
+///
+using policy::omp::omp_work_steal;
+///
+using policy::omp::unordered_omp_chunk_queue;
 
 }  // namespace RAJA
 
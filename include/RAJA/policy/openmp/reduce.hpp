@@ -25,11 +25,13 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <cstddef>
 #include <memory>
-#include <vector>
+#include <new>
 
 #include <omp.h>
 
+#include "RAJA/util/align.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
@@ -42,6 +44,72 @@ namespace RAJA
 
 namespace detail
 {
+
+/*!
+ * \brief One value per OpenMP thread, each starting on its own cache line.
+ *
+ * Slots are DATA_ALIGN aligned and padded to a multiple of DATA_ALIGN bytes
+ * so threads writing their own slot never share a cache line.
+ */
+template <typename T>
+class OmpThreadSlots
+{
+public:
+  static constexpr size_t line_bytes = static_cast<size_t>(RAJA::DATA_ALIGN);
+  static constexpr size_t stride =
+      (sizeof(T) + line_bytes - 1) / line_bytes * line_bytes;
+
+  OmpThreadSlots(size_t count, T const& val)
+      : m_count(count), m_buffer(new char[stride * count + line_bytes])
+  {
+    void* ptr = m_buffer.get();
+    size_t space = stride * count + line_bytes;
+    m_data = static_cast<char*>(
+        RAJA::align(line_bytes, stride * count, ptr, space));
+    for (size_t i = 0; i < m_count; ++i) {
+      new (m_data + i * stride) T(val);
+    }
+  }
+
+  OmpThreadSlots(OmpThreadSlots const&) = delete;
+  OmpThreadSlots& operator=(OmpThreadSlots const&) = delete;
+
+  ~OmpThreadSlots()
+  {
+    for (size_t i = 0; i < m_count; ++i) {
+      (*this)[i].~T();
+    }
+  }
+
+  size_t size() const { return m_count; }
+
+  T& operator[](size_t i) const
+  {
+    return *reinterpret_cast<T*>(m_data + i * stride);
+  }
+
+  void fill(T const& val) const
+  {
+    for (size_t i = 0; i < m_count; ++i) {
+      (*this)[i] = val;
+    }
+  }
+
+private:
+  size_t m_count;
+  std::unique_ptr<char[]> m_buffer;
+  char* m_data;
+};
+
+/*!
+ * \brief OpenMP combinable.
+ *
+ * Thread-private copies are combined into a padded slot per thread of the
+ * original reducer when they are destroyed in a single level parallel
+ * region, so threads neither contend on a lock nor share cache lines. The
+ * slots are combined in thread order when the value is requested. Copies
+ * destroyed elsewhere combine directly under a critical section.
+ */
 template <typename T, typename Reduce>
 class ReduceOMP
     : public reduce::detail::BaseCombinable<T, Reduce, ReduceOMP<T, Reduce>>
@@ -49,18 +117,57 @@ class ReduceOMP
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMP>;
 
 public:
-  using Base::Base;
   //! prohibit compiler-generated default ctor
   ReduceOMP() = delete;
 
+  explicit ReduceOMP(T init_val, T identity_ = T())
+      : Base(init_val, identity_),
+        m_slots(new OmpThreadSlots<T>(omp_get_max_threads(), identity_))
+  {
+  }
+
+  //! copies combine into the original object's slots
+  ReduceOMP(ReduceOMP const& other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    m_slots->fill(identity_);
+  }
+
   ~ReduceOMP()
   {
     if (Base::parent) {
+      auto const* root = static_cast<ReduceOMP const*>(Base::parent);
+      const int tid = omp_get_thread_num();
+      if (omp_get_level() == 1 && omp_get_active_level() == 1 &&
+          static_cast<size_t>(tid) < root->m_slots->size()) {
+        Reduce()((*root->m_slots)[tid], Base::my_data);
+      } else {
 #pragma omp critical(ompReduceCritical)
-      Reduce()(Base::parent->local(), Base::my_data);
+        Reduce()(Base::parent->local(), Base::my_data);
+      }
       Base::my_data = Base::identity;
     }
   }
+
+  T get_combined() const
+  {
+    if (m_slots) {
+      // combine every slot, one equal to the identity in value may still
+      // hold the location of a loc reduction
+      for (size_t i = 0; i < m_slots->size(); ++i) {
+        T& slot = (*m_slots)[i];
+        Reduce()(Base::my_data, slot);
+        slot = Base::identity;
+      }
+    }
+    return Base::my_data;
+  }
+
+private:
+  //! only owned by the original object
+  std::unique_ptr<OmpThreadSlots<T>> m_slots;
 };
 
 }  // namespace detail
@@ -81,7 +188,7 @@ class ReduceOMPOrdered
           BaseCombinable<T, Reduce, ReduceOMPOrdered<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPOrdered>;
-  std::shared_ptr<std::vector<T>> data;
+  std::shared_ptr<OmpThreadSlots<T>> data;
 
 public:
   ReduceOMPOrdered() { reset(T(), T()); }
@@ -95,8 +202,8 @@ public:
   void reset(T init_val, T identity_)
   {
     Base::reset(init_val, identity_);
-    data = std::shared_ptr<std::vector<T>>(
-        std::make_shared<std::vector<T>>(omp_get_max_threads(), identity_));
+    data = std::make_shared<OmpThreadSlots<T>>(omp_get_max_threads(),
+                                                identity_);
   }
 
   ~ReduceOMPOrdered()
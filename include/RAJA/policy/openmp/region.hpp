@@ -8,6 +8,8 @@
 #ifndef RAJA_region_openmp_HPP
 #define RAJA_region_openmp_HPP
 
+#include "RAJA/policy/openmp/persistent_team.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -30,6 +32,9 @@ namespace omp
  *
  * \endcode
  *
+ * Inside the scope of a RAJA::expt::OmpPersistentTeam the body runs on the
+ * threads of that team instead of a new parallel region.
+ *
  * \tparam Policy region policy
  *
  */
@@ -37,6 +42,13 @@ namespace omp
 template <typename Func>
 RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
 {
+  if (RAJA::expt::OmpPersistentTeam* team =
+          RAJA::expt::OmpPersistentTeam::current()) {
+    if (!omp_in_parallel()) {
+      team->run(body);
+      return;
+    }
+  }
 
 #pragma omp parallel
     { // curly brackets to ensure body() is encapsulated in omp parallel region
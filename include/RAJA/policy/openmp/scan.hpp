@@ -29,7 +29,6 @@
 #include <omp.h>
 
 #include "RAJA/policy/openmp/policy.hpp"
-#include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
@@ -39,6 +38,85 @@ namespace impl
 namespace scan
 {
 
+/*!
+        \brief blocked scan of n values from begin into out, which may be
+   the same as begin
+
+   The range is processed in rounds of one tile per thread, with tiles of
+   SCAN_TILE_BYTES so the values of a tile are still in cache when they are
+   read the second time. In a round each thread first reduces its tile, the
+   tile sums are scanned, and then each thread scans its tile starting from
+   the scanned sum of the tiles before it. Every value is read from memory
+   and written once.
+*/
+template <bool Exclusive,
+          typename Iter,
+          typename OutIter,
+          typename DistanceT,
+          typename BinFn,
+          typename Value>
+RAJA_INLINE void blocked_scan(Iter begin,
+                              DistanceT n,
+                              OutIter out,
+                              BinFn f,
+                              Value init)
+{
+  using RAJA::detail::firstIndex;
+  if (n <= 0) {
+    return;
+  }
+
+  const DistanceT tile = std::max(
+      static_cast<DistanceT>(RAJA::SCAN_TILE_BYTES / sizeof(Value)),
+      static_cast<DistanceT>(1));
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<Value> sums(p0, Value());
+  Value carry = init;
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT round_size = tile * p;
+    for (DistanceT round_begin = 0; round_begin < n;
+         round_begin += round_size) {
+      const DistanceT round_n = std::min(n - round_begin, round_size);
+      const DistanceT idx_begin = round_begin + firstIndex(round_n, p, pid);
+      const DistanceT idx_end = round_begin + firstIndex(round_n, p, pid + 1);
+
+      Value sum = BinFn::identity();
+      for (DistanceT i = idx_begin; i < idx_end; ++i) {
+        sum = f(sum, begin[i]);
+      }
+      sums[pid] = sum;
+#pragma omp barrier
+#pragma omp single
+      {
+        Value agg = carry;
+        for (int t = 0; t < p; ++t) {
+          const Value s = sums[t];
+          sums[t] = agg;
+          agg = f(agg, s);
+        }
+        carry = agg;
+      }
+
+      Value agg = sums[pid];
+      if (Exclusive) {
+        for (DistanceT i = idx_begin; i < idx_end; ++i) {
+          const Value t = begin[i];
+          out[i] = agg;
+          agg = f(agg, t);
+        }
+      } else {
+        for (DistanceT i = idx_begin; i < idx_end; ++i) {
+          agg = f(agg, begin[i]);
+          out[i] = agg;
+        }
+      }
+    }
+  }
+}
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
@@ -55,31 +133,9 @@ inclusive_inplace(
     BinFn f)
 {
   using std::distance;
-  using RAJA::detail::firstIndex;
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const auto n = distance(begin, end);
-  using DistanceT = typename std::remove_const<decltype(n)>::type;
-  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
-  ::std::vector<Value> sums(p0, Value());
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    if (idx_begin != idx_end) {
-      inclusive_inplace(host_res, ::RAJA::loop_exec{},
-                        begin + idx_begin, begin + idx_end, f);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, ::RAJA::loop_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
-  }
+  blocked_scan<false>(
+      begin, distance(begin, end), begin, f, Value(BinFn::identity()));
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -101,33 +157,8 @@ exclusive_inplace(
     ValueT v)
 {
   using std::distance;
-  using RAJA::detail::firstIndex;
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const auto n = distance(begin, end);
-  using DistanceT = typename std::remove_const<decltype(n)>::type;
-  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + idx_begin - 1));
-#pragma omp barrier
-    if (idx_begin != idx_end) {
-      exclusive_inplace(host_res, loop_exec{},
-                        begin + idx_begin, begin + idx_end, f, init);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, loop_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
-  }
+  blocked_scan<true>(begin, distance(begin, end), begin, f, Value(v));
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -142,15 +173,18 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 inclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
   using std::distance;
-  ::std::copy(begin, end, out);
-  return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  blocked_scan<false>(
+      begin, distance(begin, end), out, f, Value(BinFn::identity()));
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 /*!
@@ -167,7 +201,7 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 exclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
@@ -175,8 +209,58 @@ exclusive(
     ValueT v)
 {
   using std::distance;
-  ::std::copy(begin, end, out);
-  return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  blocked_scan<true>(begin, distance(begin, end), out, f, Value(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief inclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <typename Policy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+inclusive_adapted(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  blocked_scan<false>(
+      begin, distance(begin, end), out, f, Value(BinFn::identity()));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <typename Policy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+exclusive_adapted(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  blocked_scan<true>(
+      begin, distance(begin, end), out, f, Value(BinFn::identity()));
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 }  // namespace scan
@@ -21,8 +21,12 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <climits>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include <omp.h>
 
@@ -33,6 +37,8 @@
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/radix_sort.hpp"
+#include "RAJA/util/sort.hpp"
 
 namespace RAJA
 {
@@ -184,6 +190,378 @@ void sort(Sorter sorter,
   }
 }
 
+
+/*!
+        \brief number of values of a before position k of the stable merge
+               of sorted ranges a of length na and b of length nb
+*/
+template <typename IterA, typename IterB, typename DiffT, typename Compare>
+inline DiffT merge_co_rank(DiffT k,
+                           IterA a,
+                           DiffT na,
+                           IterB b,
+                           DiffT nb,
+                           Compare comp)
+{
+  DiffT lo = (k > nb) ? k - nb : DiffT(0);
+  DiffT hi = (k < na) ? k : na;
+  while (lo < hi) {
+    const DiffT i = lo + (hi - lo) / 2;
+    // a[i] is before b[k-i-1] unless b[k-i-1] is less than it
+    if (!comp(b[k - i - 1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+        \brief move the values at positions [k_begin, k_end) of the stable
+               merge of sorted ranges a and b to out
+*/
+template <typename IterA, typename IterB, typename OutIter, typename DiffT,
+          typename Compare>
+inline void merge_part(DiffT k_begin,
+                       DiffT k_end,
+                       IterA a,
+                       DiffT na,
+                       IterB b,
+                       DiffT nb,
+                       OutIter out,
+                       Compare comp)
+{
+  DiffT i = merge_co_rank(k_begin, a, na, b, nb, comp);
+  DiffT j = k_begin - i;
+  const DiffT i_end = merge_co_rank(k_end, a, na, b, nb, comp);
+  const DiffT j_end = k_end - i_end;
+  for (DiffT k = k_begin; k < k_end; ++k) {
+    if (j < j_end && (i >= i_end || comp(b[j], a[i]))) {
+      out[k] = std::move(b[j]);
+      ++j;
+    } else {
+      out[k] = std::move(a[i]);
+      ++i;
+    }
+  }
+}
+
+/*!
+        \brief merge the sorted runs of src into dst, run r starts at
+               bounds(r) and a level merges runs r and r + 1 for even r
+
+        Each thread moves an equal part of the output, split between the
+        merges it overlaps by co-ranking, so a merge of two long runs is
+        shared by all threads.
+*/
+template <typename SrcIter, typename DstIter, typename Bounds,
+          typename Compare>
+inline void merge_level(SrcIter src,
+                        DstIter dst,
+                        RAJA::detail::IterDiff<SrcIter> n,
+                        int num_runs,
+                        Bounds bounds,
+                        Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<SrcIter>;
+
+  const diff_type num_threads = omp_get_num_threads();
+  const diff_type thread_id = omp_get_thread_num();
+  const diff_type o_begin = firstIndex(n, num_threads, thread_id);
+  const diff_type o_end = firstIndex(n, num_threads, thread_id + 1);
+
+  for (int r = 0; r < num_runs; r += 2) {
+    const diff_type a_begin = bounds(r);
+    const diff_type b_begin = bounds(std::min(r + 1, num_runs));
+    const diff_type b_end = bounds(std::min(r + 2, num_runs));
+    const diff_type k_begin = std::max(o_begin, a_begin);
+    const diff_type k_end = std::min(o_end, b_end);
+    if (k_begin < k_end) {
+      merge_part(k_begin - a_begin,
+                 k_end - a_begin,
+                 src + a_begin,
+                 b_begin - a_begin,
+                 src + b_begin,
+                 b_end - b_begin,
+                 dst + a_begin,
+                 comp);
+    }
+  }
+}
+
+/*!
+        \brief stable merge sort of the given range using comparison function
+
+        One buffer of the size of the range is allocated up front. Each
+        thread sorts a chunk of the range using its part of the buffer, then
+        the chunks are merged level by level alternating between the range
+        and the buffer, with every thread taking part in each level.
+*/
+template <typename Iter, typename Compare>
+inline
+void stable_sort(Iter begin,
+                 Iter end,
+                 Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  constexpr diff_type min_iterates_per_task = get_min_iterates_per_task();
+
+  const diff_type n = end - begin;
+
+  const diff_type max_threads = omp_get_max_threads();
+  const diff_type requested_num_threads = std::min(
+      (n + min_iterates_per_task - 1) / min_iterates_per_task, max_threads);
+
+  if (requested_num_threads <= 1) {
+    RAJA::detail::merge_sort(begin, end, comp);
+    return;
+  }
+
+  // Manage the lifetime of the buffer and objects constructed in the buffer
+  using buf_deleter_type = RAJA::FreeAlignedType<value_type, diff_type>;
+  buf_deleter_type buf_deleter;
+
+  std::unique_ptr<value_type, buf_deleter_type&> copy_buf(
+      RAJA::allocate_aligned_type<value_type>(RAJA::DATA_ALIGN,
+                                              n * sizeof(value_type)),
+      buf_deleter);
+
+  value_type* copyarr = copy_buf.get();
+
+  // check memory allocation worked
+  if (copyarr == nullptr) {
+    RAJA_ABORT_OR_THROW("stable_sort temporary memory allocation failed");
+  }
+
+  constexpr diff_type insertion_sort_cutoff = 16;
+
+#pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
+  {
+    const int num_threads = omp_get_num_threads();
+    const int thread_id = omp_get_thread_num();
+    auto chunk_begin = [=](int c) {
+      return firstIndex(n, static_cast<diff_type>(num_threads),
+                        static_cast<diff_type>(c));
+    };
+
+    // this thread sorts range [i_begin, i_end) with its part of the buffer
+    {
+      const diff_type i_begin = chunk_begin(thread_id);
+      const diff_type i_end = chunk_begin(thread_id + 1);
+      for (diff_type start = i_begin; start < i_end;
+           start += insertion_sort_cutoff) {
+        RAJA::detail::insertion_sort(
+            begin + start,
+            begin + std::min(start + insertion_sort_cutoff, i_end),
+            comp);
+      }
+      for (diff_type i = i_begin; i < i_end; ++i) {
+        new (&copyarr[i]) value_type(std::move(begin[i]));
+      }
+      RAJA::detail::merge_sort_levels(
+          begin + i_begin, i_end - i_begin, copyarr + i_begin, comp);
+    }
+
+    // merge the sorted chunks, alternating between the range and buffer
+    bool in_copy = false;
+    for (int width = 1; width < num_threads; width *= 2) {
+      const int num_runs = (num_threads + width - 1) / width;
+      auto bounds = [=](int r) {
+        return chunk_begin(std::min(r * width, num_threads));
+      };
+
+#pragma omp barrier
+
+      if (in_copy) {
+        merge_level(copyarr, begin, n, num_runs, bounds, comp);
+      } else {
+        merge_level(begin, copyarr, n, num_runs, bounds, comp);
+      }
+      in_copy = !in_copy;
+    }
+
+    if (in_copy) {
+#pragma omp barrier
+      const diff_type i_begin = chunk_begin(thread_id);
+      const diff_type i_end = chunk_begin(thread_id + 1);
+      std::move(copyarr + i_begin, copyarr + i_end, begin + i_begin);
+    }
+  }
+
+  // every value of the buffer was constructed by one of the threads
+  buf_deleter.size = n;
+}
+
+/*!
+        \brief radix sort of n keys, and values if V is not radix_keys_only,
+               in the order of Compare of bits [begin_bit, end_bit) of the
+               keys
+
+        Each thread counts and moves the values of one block of the range.
+*/
+template <typename K, typename V, typename Compare>
+inline void radix_sort(K* keys,
+                       V* vals,
+                       RAJA::Index_type n,
+                       Compare,
+                       int begin_bit = 0,
+                       int end_bit = sizeof(K) * CHAR_BIT)
+{
+  using RAJA::Index_type;
+  constexpr bool descending =
+      std::is_same<Compare, operators::greater<K>>::value;
+
+  const Index_type num_blocks = std::max(
+      Index_type(1),
+      std::min(static_cast<Index_type>(omp_get_max_threads()),
+               n / RAJA::detail::get_min_radix_sort_iterates()));
+
+  RAJA::detail::radix_sort<descending>(
+      keys, vals, n, num_blocks, begin_bit, end_bit, [=](auto&& body) {
+#pragma omp parallel for schedule(static) num_threads(static_cast<int>(num_blocks))
+        for (Index_type b = 0; b < num_blocks; ++b) {
+          body(b);
+        }
+      });
+}
+
+// this number is arbitrary
+constexpr int get_min_partition_iterates_per_thread() { return 4096; }
+
+/*!
+        \brief partition given range inplace using predicate function on
+               iterators, returns the number of elements for which the
+               predicate is true
+
+        Each thread partitions one block of the range with
+        RAJA::detail::partition. The false elements before the partition
+        point and the true elements after it are then swapped in parallel,
+        there are as many of each.
+*/
+template <typename Iter, typename Predicate>
+inline RAJA::detail::IterDiff<Iter> partition(Iter begin,
+                                              Iter end,
+                                              Predicate pred)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  const diff_type n = end - begin;
+  const diff_type num_blocks = std::max(
+      diff_type(1),
+      std::min(static_cast<diff_type>(omp_get_max_threads()),
+               n / get_min_partition_iterates_per_thread()));
+
+  if (num_blocks == 1) {
+    return RAJA::detail::partition(begin, end, pred) - begin;
+  }
+
+  auto block_begin = [=](diff_type b) { return firstIndex(n, num_blocks, b); };
+
+  // number of true elements of each block after partitioning it
+  std::vector<diff_type> counts(num_blocks);
+#pragma omp parallel for schedule(static) num_threads(static_cast<int>(num_blocks))
+  for (diff_type b = 0; b < num_blocks; ++b) {
+    Iter b_begin = begin + block_begin(b);
+    counts[b] = RAJA::detail::partition(b_begin, begin + block_begin(b+1), pred)
+                - b_begin;
+  }
+
+  diff_type num_true = 0;
+  for (diff_type b = 0; b < num_blocks; ++b) {
+    num_true += counts[b];
+  }
+
+  // number of misplaced false and true elements in the blocks before b
+  std::vector<diff_type> false_offsets(num_blocks+1, 0);
+  std::vector<diff_type> true_offsets(num_blocks+1, 0);
+  for (diff_type b = 0; b < num_blocks; ++b) {
+    const diff_type b_middle = block_begin(b) + counts[b];
+    false_offsets[b+1] = false_offsets[b] +
+        std::max(diff_type(0), std::min(block_begin(b+1), num_true) - b_middle);
+    true_offsets[b+1] = true_offsets[b] +
+        std::max(diff_type(0), b_middle - std::max(block_begin(b), num_true));
+  }
+  const diff_type num_misplaced = false_offsets[num_blocks];
+
+  // index of the misplaced element j in the block that contains it
+  auto misplaced = [&](std::vector<diff_type> const& offsets, diff_type j) {
+    const diff_type b = std::upper_bound(offsets.begin(), offsets.end(), j)
+                        - offsets.begin() - 1;
+    return std::make_pair(b, j - offsets[b]);
+  };
+
+#pragma omp parallel for schedule(static) num_threads(static_cast<int>(num_blocks))
+  for (diff_type j = 0; j < num_misplaced; ++j) {
+    auto f = misplaced(false_offsets, j);
+    auto t = misplaced(true_offsets, j);
+    RAJA::safe_iter_swap(
+        begin + (block_begin(f.first) + counts[f.first] + f.second),
+        begin + (std::max(block_begin(t.first), num_true) + t.second));
+  }
+
+  return num_true;
+}
+
+/*!
+        \brief partially sort given range using comparison function so nth
+               is the element it would be if the range were sorted
+
+        Quick select with parallel partitions, the partitions split the
+        range into the elements less than, equivalent to, and greater than
+        the pivot so ranges of equivalent elements finish early. Small
+        ranges and ranges that partition badly use RAJA::detail::intro_select.
+*/
+template <typename Iter, typename Compare>
+inline void nth_element(Iter begin,
+                        Iter nth,
+                        Iter end,
+                        Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  // set max depth to 2*lg(N)
+  unsigned depth = 2*RAJA::detail::ulog2(end - begin);
+
+  while (end - begin >= 2*get_min_partition_iterates_per_thread() &&
+         depth > 0) {
+    --depth;
+
+    // choose pivot with median of 3
+    const diff_type n = end - begin;
+    const value_type& a = begin[0];
+    const value_type& b = begin[n/2];
+    const value_type& c = begin[n-1];
+    const value_type pivot = comp(a, b)
+                                ? ( comp(b, c) ? b : ( comp(a, c) ? c : a ) )
+                                : ( comp(b, c) ? ( comp(a, c) ? a : c ) : b );
+
+    const diff_type num_less = detail::openmp::partition(begin, end,
+        [&](Iter it) { return comp(*it, pivot); });
+    if (nth - begin < num_less) {
+      end = begin + num_less;
+      continue;
+    }
+    begin += num_less;
+
+    // the pivot is in the range so this partition is never empty
+    const diff_type num_equiv = detail::openmp::partition(begin, end,
+        [&](Iter it) { return !comp(pivot, *it); });
+    if (nth - begin < num_equiv) {
+      return;
+    }
+    begin += num_equiv;
+  }
+
+  RAJA::detail::intro_select(begin, nth, end, comp);
+}
+
 } // namespace openmp
 
 } // namespace detail
@@ -193,7 +571,8 @@ void sort(Sorter sorter,
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort<Iter, Compare>>>
 unstable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -211,7 +590,8 @@ unstable(
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort<Iter, Compare>>>
 stable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -219,7 +599,7 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  detail::openmp::stable_sort(begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -229,7 +609,8 @@ stable(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>>
 unstable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -251,7 +632,8 @@ unstable_pairs(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>>
 stable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -263,7 +645,349 @@ stable_pairs(
   auto begin  = RAJA::zip(keys_begin, vals_begin);
   auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
   using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::stable_sort(begin, end, RAJA::compare_first<zip_ref>(comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of arithmetic values in ascending or
+               descending order with a radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort<Iter, Compare>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  if (end - begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    detail::openmp::stable_sort(begin, end, comp);
+  } else {
+    detail::openmp::radix_sort(begin,
+                               static_cast<RAJA::detail::radix_keys_only*>(nullptr),
+                               end - begin,
+                               comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of arithmetic values in ascending or
+               descending order with a radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort<Iter, Compare>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  if (end - begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    detail::openmp::stable_sort(begin, end, comp);
+  } else {
+    detail::openmp::radix_sort(begin,
+                               static_cast<RAJA::detail::radix_keys_only*>(nullptr),
+                               end - begin,
+                               comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of pairs with arithmetic keys in ascending
+               or descending order of the keys with a radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  if (keys_end - keys_begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::openmp::stable_sort(begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    detail::openmp::radix_sort(keys_begin, vals_begin, keys_end - keys_begin, comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys in ascending
+               or descending order of the keys with a radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  if (keys_end - keys_begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::openmp::stable_sort(begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    detail::openmp::radix_sort(keys_begin, vals_begin, keys_end - keys_begin, comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort each segment of given range using comparison function
+
+        Each thread sorts whole segments, dynamic scheduling balances
+        segments of different lengths.
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  const RAJA::Index_type num_segments = (offsets_end - offsets_begin) - 1;
+#pragma omp parallel for schedule(dynamic, 16)
+  for (RAJA::Index_type s = 0; s < num_segments; ++s) {
+    detail::StableSorter{}(begin + offsets_begin[s],
+                           begin + offsets_begin[s+1], comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort each segment of given range of pairs using
+               comparison function on keys
+
+        Each thread sorts whole segments, dynamic scheduling balances
+        segments of different lengths.
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter,
+    ValIter vals_begin,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  const RAJA::Index_type num_segments = (offsets_end - offsets_begin) - 1;
+#pragma omp parallel for schedule(dynamic, 16)
+  for (RAJA::Index_type s = 0; s < num_segments; ++s) {
+    detail::StableSorter{}(begin + offsets_begin[s],
+                           begin + offsets_begin[s+1],
+                           RAJA::compare_first<zip_ref>(comp));
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief partially sort given range using comparison function so nth
+               is the element it would be if the range were sorted
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+nth_element(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  detail::openmp::nth_element(begin, nth, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort the smallest elements of given range into [begin, middle)
+               using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+partial(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter middle,
+    Iter end,
+    Compare comp)
+{
+  detail::openmp::nth_element(begin, middle, end, comp);
+
+  return unstable(host_res, p, begin, middle, comp);
+}
+
+/*!
+        \brief write the permutation that stably sorts given range of keys
+               using comparison function, the keys are not modified
+
+        The indices are sorted with the parallel merge sort comparing the
+        keys they refer to, so only the indices are moved.
+*/
+template <typename ExecPolicy, typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+argsort(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    IdxIter perm_begin,
+    Compare comp)
+{
+  using I = RAJA::detail::IterVal<IdxIter>;
+  const RAJA::Index_type len = keys_end - keys_begin;
+#pragma omp parallel for schedule(static)
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    perm_begin[i] = static_cast<I>(i);
+  }
+  detail::openmp::stable_sort(perm_begin, perm_begin + len,
+                              RAJA::detail::compare_indirect(keys_begin, comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range using comparison function, the
+               comparison sort does not use the bit range
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort<Iter, Compare>>>
+stable_bits(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    int,
+    int,
+    Compare comp)
+{
+  return stable(host_res, p, begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range of arithmetic values in ascending or
+               descending order of bits [begin_bit, end_bit) of the values
+               with a radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort<Iter, Compare>>
+stable_bits(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    int begin_bit,
+    int end_bit,
+    Compare comp)
+{
+  if (end - begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    return stable(host_res, p, begin, end, comp);
+  }
+  detail::openmp::radix_sort(begin,
+                           static_cast<RAJA::detail::radix_keys_only*>(nullptr),
+                           end - begin,
+                           comp,
+                           begin_bit,
+                           end_bit);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+               keys, the comparison sort does not use the bit range
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>>
+stable_pairs_bits(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    int,
+    int,
+    Compare comp)
+{
+  return stable_pairs(host_res, p, keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys in
+               ascending or descending order of bits [begin_bit, end_bit) of
+               the keys with a radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>
+stable_pairs_bits(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    int begin_bit,
+    int end_bit,
+    Compare comp)
+{
+  if (keys_end - keys_begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    return stable_pairs(host_res, p, keys_begin, keys_end, vals_begin, comp);
+  }
+  detail::openmp::radix_sort(keys_begin, vals_begin, keys_end - keys_begin, comp,
+                           begin_bit, end_bit);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -31,6 +31,8 @@
 #include "RAJA/policy/openmp_target/forall.hpp"
 #include "RAJA/policy/openmp_target/reduce.hpp"
 #include "RAJA/policy/openmp_target/WorkGroup.hpp"
+#include "RAJA/policy/openmp_target/scan.hpp"
+#include "RAJA/policy/openmp_target/sort.hpp"
 
 
 #endif  // closing endif for if defined(RAJA_ENABLE_OPENMP) && defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -17,6 +17,7 @@
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp_target/reduce.hpp"
 
 namespace RAJA
 {
@@ -62,6 +63,8 @@ RAJA_INLINE resources::EventProxy<resources::Omp> forall_impl(resources::Omp omp
 // thread_limit(tperteam) unused due to XL seg fault (when tperteam != distance)
   auto i = distance_it;
 
+  // copy the initial values of batched target reducers
+  ::RAJA::omp::ReduceBatch::notifyLaunch();
 #pragma omp target teams distribute parallel for num_teams(numteams) \
     schedule(static, 1) map(to : body,begin_it)
   for (i = 0; i < distance_it; ++i) {
@@ -82,6 +85,8 @@ RAJA_INLINE resources::EventProxy<resources::Omp> forall_impl(resources::Omp omp
 
   RAJA_EXTRACT_BED_IT(iter);
 
+  // copy the initial values of batched target reducers
+  ::RAJA::omp::ReduceBatch::notifyLaunch();
 #pragma omp target teams distribute parallel for schedule(static, 1) \
     firstprivate(body,begin_it)
   for (decltype(distance_it) i = 0; i < distance_it; ++i) {
@@ -10,6 +10,8 @@
 
 #include "RAJA/pattern/kernel/internal.hpp"
 
+#include "RAJA/policy/openmp_target/reduce.hpp"
+
 namespace RAJA {
 namespace internal {
 
@@ -30,6 +32,9 @@ struct StatementExecutor<statement::Collapse<omp_target_parallel_collapse_exec,
 
     using RAJA::internal::thread_privatize;
     auto privatizer = thread_privatize(data);
+
+    // copy the initial values of batched target reducers
+    ::RAJA::omp::ReduceBatch::notifyLaunch();
 #pragma omp target teams distribute parallel for schedule(static, 1) \
     firstprivate(privatizer) collapse(2)
       for (auto i0 = (decltype(l0))0; i0 < l0; ++i0) {
@@ -66,6 +71,9 @@ struct StatementExecutor<statement::Collapse<omp_target_parallel_collapse_exec,
 
     using RAJA::internal::thread_privatize;
     auto privatizer = thread_privatize(data);
+
+    // copy the initial values of batched target reducers
+    ::RAJA::omp::ReduceBatch::notifyLaunch();
 #pragma omp target teams distribute parallel for schedule(static, 1) \
     firstprivate(privatizer) collapse(3)
       for (auto i0 = (decltype(l0))0; i0 < l0; ++i0) {
@@ -108,6 +116,9 @@ struct StatementExecutor<statement::Collapse<omp_target_parallel_collapse_exec,
 
     using RAJA::internal::thread_privatize;
     auto privatizer = thread_privatize(data);
+
+    // copy the initial values of batched target reducers
+    ::RAJA::omp::ReduceBatch::notifyLaunch();
 #pragma omp target teams distribute parallel for schedule(static, 1) \
     firstprivate(privatizer) collapse(4)
       for (auto i0 = (decltype(l0))0; i0 < l0; ++i0) {
@@ -63,6 +63,32 @@ struct omp_target_reduce
     : make_policy_pattern_platform_t<Policy::target_openmp, Pattern::reduce, Platform::omp_target> {
 };
 
+///
+/// Launch policy that runs the launch body on the teams of a target region,
+/// and the loop policies that split loops inside it over the teams and over
+/// the threads of a team
+///
+struct omp_target_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::target_openmp,
+                                            Pattern::region,
+                                            Launch::sync,
+                                            Platform::omp_target> {
+};
+
+struct omp_target_team_distribute
+    : make_policy_pattern_platform_t<Policy::target_openmp,
+                            Pattern::forall,
+                            Platform::omp_target,
+                            omp::Distribute> {
+};
+
+struct omp_target_thread_parallel_for
+    : make_policy_pattern_platform_t<Policy::target_openmp,
+                            Pattern::forall,
+                            Platform::omp_target,
+                            omp::Target> {
+};
+
 ///
 /// WorkGroup execution policies
 ///
@@ -83,6 +109,12 @@ using policy::omp::omp_target_parallel_for_exec_nt;
 using policy::omp::omp_target_reduce;
 using policy::omp::omp_target_parallel_collapse_exec;
 using policy::omp::omp_target_work;
+using policy::omp::omp_target_team_distribute;
+using policy::omp::omp_target_thread_parallel_for;
+namespace expt
+{
+  using policy::omp::omp_target_launch_t;
+}
 #endif
 
 } // closing brace for RAJA namespace
@@ -15,11 +15,15 @@
 //#include <cassert>  // Leaving out until XL is fixed 2/25/2019.
 
 #include <algorithm>
+#include <cstddef>
+#include <type_traits>
 
 #include <omp.h>
 
+#include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
@@ -63,6 +67,54 @@ struct maxloc
     }
   }
 };
+
+//! combine a thread's value into its team's slot, with an atomic update
+//! when the combiner has one so only threads of the same team contend
+template <typename Reducer, typename T, typename Enable = void>
+struct team_combine
+{
+  RAJA_HOST_DEVICE RAJA_INLINE static void combine(T &team_val, const T val)
+  {
+#pragma omp critical
+    Reducer{}(team_val, val);
+  }
+};
+
+template <typename T>
+struct team_combine<RAJA::reduce::sum<T>,
+                    T,
+                    typename std::enable_if<std::is_arithmetic<T>::value>::type>
+{
+  RAJA_HOST_DEVICE RAJA_INLINE static void combine(T &team_val, const T val)
+  {
+#pragma omp atomic update
+    team_val += val;
+  }
+};
+
+template <typename T>
+struct team_combine<RAJA::reduce::or_bit<T>,
+                    T,
+                    typename std::enable_if<std::is_integral<T>::value>::type>
+{
+  RAJA_HOST_DEVICE RAJA_INLINE static void combine(T &team_val, const T val)
+  {
+#pragma omp atomic update
+    team_val |= val;
+  }
+};
+
+template <typename T>
+struct team_combine<RAJA::reduce::and_bit<T>,
+                    T,
+                    typename std::enable_if<std::is_integral<T>::value>::type>
+{
+  RAJA_HOST_DEVICE RAJA_INLINE static void combine(T &team_val, const T val)
+  {
+#pragma omp atomic update
+    team_val &= val;
+  }
+};
 #pragma omp end declare target
 
 // Alias for clarity. Reduction size operates on number of omp teams.
@@ -84,6 +136,173 @@ struct Offload_Info
   }
 };
 
+/*!
+ * \brief Host and device storage shared by the per-team values of the live
+ *        target reducers.
+ *
+ * Reducers take a slot instead of allocating their own storage, so the
+ * initial values of the reducers created before a kernel are copied to the
+ * device together when the kernel is launched, and the first get() after a
+ * kernel copies back the results of every reducer at once. Values larger
+ * than value_bytes, or reducers on another device, use their own storage.
+ */
+class ReduceBatch
+{
+public:
+  //! largest value that fits in a slot
+  static constexpr size_t value_bytes = 32;
+  //! number of reducers that can share the batch
+  static constexpr int num_slots = 32;
+  static constexpr size_t slot_bytes = value_bytes * MaxNumTeams;
+
+  static ReduceBatch &get()
+  {
+    static ReduceBatch batch;
+    return batch;
+  }
+
+  ReduceBatch(const ReduceBatch &) = delete;
+  ReduceBatch &operator=(const ReduceBatch &) = delete;
+
+  ~ReduceBatch()
+  {
+    if (m_device) {
+      omp_target_free(m_device, m_info.deviceID);
+    }
+    delete[] m_host;
+  }
+
+  //! take a slot for a value of type T, returns -1 if none is available
+  template <typename T>
+  int acquire(Offload_Info &info)
+  {
+    if (sizeof(T) > value_bytes ||
+        alignof(T) > alignof(std::max_align_t)) {
+      return -1;
+    }
+    lock_guard<mutex> lock(m_mutex);
+    if (!m_host) {
+      m_info.hostID = info.hostID;
+      m_info.deviceID = info.deviceID;
+      m_device = reinterpret_cast<char *>(
+          omp_target_alloc(num_slots * slot_bytes, m_info.deviceID));
+      if (!m_device) {
+        return -1;
+      }
+      m_host = new char[num_slots * slot_bytes];
+    }
+    if (info.deviceID != m_info.deviceID || !m_device) {
+      return -1;
+    }
+    for (int s = 0; s < num_slots; ++s) {
+      if (!m_used[s]) {
+        m_used[s] = true;
+        m_pending[s] = true;
+        m_any_pending = true;
+        return s;
+      }
+    }
+    return -1;
+  }
+
+  //! return a slot, its contents are discarded
+  void release(int slot)
+  {
+    lock_guard<mutex> lock(m_mutex);
+    m_used[slot] = false;
+    m_pending[slot] = false;
+    m_live[slot] = false;
+  }
+
+  template <typename T>
+  T *host_slot(int slot)
+  {
+    return reinterpret_cast<T *>(m_host + slot * slot_bytes);
+  }
+
+  template <typename T>
+  T *device_slot(int slot)
+  {
+    return reinterpret_cast<T *>(m_device + slot * slot_bytes);
+  }
+
+  //! copy the initial values of new slots to the device, call on the host
+  //! before launching a kernel that may use target reducers
+  void launch()
+  {
+    lock_guard<mutex> lock(m_mutex);
+    ++m_launch_epoch;
+    if (!m_any_pending) {
+      return;
+    }
+    copy_runs(m_pending, m_info.deviceID, m_info.hostID, true);
+    for (int s = 0; s < num_slots; ++s) {
+      if (m_pending[s]) {
+        m_pending[s] = false;
+        m_live[s] = true;
+      }
+    }
+    m_any_pending = false;
+  }
+
+  //! copy the values of all slots used by kernels back to the host, unless
+  //! no kernel was launched since the last copy
+  void readBack()
+  {
+    lock_guard<mutex> lock(m_mutex);
+    if (m_read_epoch == m_launch_epoch) {
+      return;
+    }
+    copy_runs(m_live, m_info.hostID, m_info.deviceID, false);
+    m_read_epoch = m_launch_epoch;
+  }
+
+  //! launch hook for kernels that do not create a batch
+  static void notifyLaunch()
+  {
+    get().launch();
+  }
+
+private:
+  ReduceBatch() = default;
+
+  //! copy each run of consecutive flagged slots with one transfer
+  void copy_runs(const bool *flags, int dst_dev, int src_dev, bool to_device)
+  {
+    int s = 0;
+    while (s < num_slots) {
+      if (!flags[s]) {
+        ++s;
+        continue;
+      }
+      int e = s;
+      while (e < num_slots && flags[e]) {
+        ++e;
+      }
+      char *dst = (to_device ? m_device : m_host) + s * slot_bytes;
+      char *src = (to_device ? m_host : m_device) + s * slot_bytes;
+      if (omp_target_memcpy(dst, src, (e - s) * slot_bytes, 0, 0, dst_dev,
+                            src_dev) != 0) {
+        printf("Unable to copy reduction memory %s device\n",
+               to_device ? "to" : "from");
+        exit(1);
+      }
+      s = e;
+    }
+  }
+
+  mutex m_mutex;
+  Offload_Info m_info;
+  char *m_host{nullptr};
+  char *m_device{nullptr};
+  bool m_used[num_slots]{};
+  bool m_pending[num_slots]{};
+  bool m_live[num_slots]{};
+  bool m_any_pending{false};
+  unsigned long long m_launch_epoch{0};
+  unsigned long long m_read_epoch{0};
+};
+
 //! Reduction data for OpenMP Offload -- stores value, host pointer, and device
 //! pointer
 template <typename T>
@@ -92,20 +311,33 @@ struct Reduce_Data
   mutable T value;
   T *device;
   T *host;
+  //! slot in the ReduceBatch, or -1 if the storage is owned
+  int slot;
 
   //! disallow default constructor
   Reduce_Data() = delete;
 
   /*! \brief create from a default value and offload information
    *
-   *  allocates data on the host and device and initializes values to default
+   *  takes a slot in the ReduceBatch, whose initial values are copied to the
+   *  device at the next launch, or allocates data on the host and device,
+   *  and initializes values to default
    */
   Reduce_Data(T initValue, T identityValue, Offload_Info &info)
      : value(initValue),
-        device{reinterpret_cast<T *>(
-            omp_target_alloc(omp::MaxNumTeams * sizeof(T), info.deviceID))},
-        host{new T[omp::MaxNumTeams]}
-  {
+        device{nullptr},
+        host{nullptr},
+        slot{ReduceBatch::get().acquire<T>(info)}
+  {
+    if (slot >= 0) {
+      host = ReduceBatch::get().host_slot<T>(slot);
+      device = ReduceBatch::get().device_slot<T>(slot);
+      std::fill_n(host, omp::MaxNumTeams, identityValue);
+      return;
+    }
+    device = reinterpret_cast<T *>(
+        omp_target_alloc(omp::MaxNumTeams * sizeof(T), info.deviceID));
+    host = new T[omp::MaxNumTeams];
     if (!host) {
       printf("Unable to allocate space on host\n");
       exit(1);
@@ -126,6 +358,7 @@ struct Reduce_Data
 
   //! default copy constructor for POD
   Reduce_Data(const Reduce_Data &) = default;
+  Reduce_Data &operator=(const Reduce_Data &) = default;
 
   //! transfers from the host to the device -- exit() is called upon failure
   RAJA_INLINE void hostToDevice(Offload_Info &info)
@@ -146,6 +379,10 @@ struct Reduce_Data
   //! transfers from the device to the host -- exit() is called upon failure
   RAJA_INLINE void deviceToHost(Offload_Info &info)
   {
+    if (slot >= 0) {
+      ReduceBatch::get().readBack();
+      return;
+    }
     // precondition: host and device are valid pointers
     if (omp_target_memcpy(reinterpret_cast<void *>(host),
                           reinterpret_cast<void *>(device),
@@ -162,6 +399,13 @@ struct Reduce_Data
   //! frees all data from the offload information passed
   RAJA_INLINE void cleanup(Offload_Info &info)
   {
+    if (slot >= 0) {
+      ReduceBatch::get().release(slot);
+      slot = -1;
+      device = nullptr;
+      host = nullptr;
+      return;
+    }
     if (device) {
       omp_target_free(reinterpret_cast<void *>(device), info.deviceID);
       device = nullptr;
@@ -194,7 +438,9 @@ struct TargetReduce
   void reset(T init_val_, T identity_ = Reducer::identity())
   {
     operator T();
-    val.reset(identity_);
+    // storage was released by operator T, set it up for the next kernel
+    val = omp::Reduce_Data<T>(identity_, identity_, info);
+    info.isMapped = false;
     initVal = init_val_;
     finalVal = identity_;
   }
@@ -207,11 +453,8 @@ struct TargetReduce
   {
     //assert ( omp_get_num_teams() <= omp::MaxNumTeams );  // Leaving out until XL is fixed 2/25/2019.
     if (!omp_is_initial_device()) {
-#pragma omp critical
-      {
-        int tid = omp_get_team_num();
-        Reducer{}(val.device[tid], val.value);
-      }
+      int tid = omp_get_team_num();
+      omp::team_combine<Reducer, T>::combine(val.device[tid], val.value);
     }
   }
 #ifdef __ibmxl__ // TODO: implicit declare target doesn't pick this up
@@ -286,8 +529,13 @@ struct TargetReduceLoc
              T identity_ = Reducer::identity)
   {
     operator T();
-    val.reset(identity_);
-    loc.reset(init_local_);
+    // storage was released by operator T, set it up for the next kernel
+    val = omp::Reduce_Data<T>(identity_, identity_, info);
+    loc = omp::Reduce_Data<IndexType>(
+        init_local_,
+        IndexType(RAJA::reduce::detail::DefaultLoc<IndexType>().value()),
+        info);
+    info.isMapped = false;
     initVal = init_val_;
     finalVal = identity_;
     initLoc = reduce::detail::DefaultLoc<IndexType>().value();
@@ -522,6 +770,14 @@ public:
     parent::reduce(rhsVal, rhsLoc);
     return *this;
   }
+
+  //! enable minloc() with the components of a tuple IndexType
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  const self &minloc(T rhsVal, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    parent::reduce(rhsVal, IndexType(i0, i1, is...));
+    return *this;
+  }
 };
 
 
@@ -550,6 +806,46 @@ public:
     parent::reduce(rhsVal, rhsLoc);
     return *this;
   }
+
+  //! enable maxloc() with the components of a tuple IndexType
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  const self &maxloc(T rhsVal, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    parent::reduce(rhsVal, IndexType(i0, i1, is...));
+    return *this;
+  }
+};
+
+
+//! specialization of ReduceMulti for omp_target_reduce
+//  all values of a thread are combined into the team value together
+template <typename T>
+class ReduceMulti<omp_target_reduce, T>
+    : public TargetReduce<RAJA::reduce::multi<T>, T>
+{
+public:
+
+  using self = ReduceMulti<omp_target_reduce, T>;
+  using parent = TargetReduce<RAJA::reduce::multi<T>, T>;
+  using parent::parent;
+
+  //! reducer function; combines one value into each reduction, in order
+  template <typename... Args>
+  const self &reduce(Args const&... args) const
+  {
+    parent::reduce(T(args...));
+    return *this;
+  }
+
+  //! Get the calculated Ith reduced value
+  template <camp::idx_t I>
+  typename T::template element_type<I> get()
+  {
+    return parent::get().template get<I>();
+  }
+
+  //! Get all of the calculated reduced values
+  T get() { return parent::get(); }
 };
 
 
@@ -0,0 +1,402 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_openmp_target_HPP
+#define RAJA_scan_openmp_target_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include <iterator>
+#include <type_traits>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/policy/openmp_target/policy.hpp"
+
+namespace RAJA
+{
+
+namespace omp
+{
+
+namespace detail
+{
+
+//! Values each device thread scans on its own in target_scan
+static constexpr int TARGET_SCAN_CHUNK = 32;
+
+/*!
+        \brief device scan of n values from begin into out, which may be
+   the same as begin
+
+   The values are split in chunks of TARGET_SCAN_CHUNK. Each device thread
+   reduces one chunk, the chunk sums are scanned by calling target_scan on
+   them, and each thread then scans its chunk starting from the scanned sum
+   of the chunks before it. The inclusive scan needs no init or identity,
+   the exclusive scan starts from init. The iterators must be usable on the
+   device, so pointers must point to memory of the default device.
+*/
+template <bool Exclusive,
+          typename Iter,
+          typename OutIter,
+          typename DistanceT,
+          typename BinFn,
+          typename Value>
+void target_scan(int tperteam,
+                 Iter begin,
+                 DistanceT n,
+                 OutIter out,
+                 BinFn f,
+                 Value init)
+{
+  if (n <= 0) {
+    return;
+  }
+
+  const DistanceT chunk = TARGET_SCAN_CHUNK;
+
+  if (n <= chunk) {
+#pragma omp target firstprivate(begin, out, init, n)
+    {
+      Value acc = Exclusive ? init : begin[0];
+      for (DistanceT i = 0; i < n; ++i) {
+        if (Exclusive) {
+          Value v = begin[i];
+          out[i] = acc;
+          acc = f(acc, v);
+        } else {
+          if (i > 0) { acc = f(acc, begin[i]); }
+          out[i] = acc;
+        }
+      }
+    }
+    return;
+  }
+
+  const int did = omp_get_default_device();
+  const DistanceT nchunks = RAJA_DIVIDE_CEILING_INT(n, chunk);
+  Value* sums = static_cast<Value*>(
+      omp_target_alloc(nchunks * sizeof(Value), did));
+
+  auto numteams = RAJA_DIVIDE_CEILING_INT(nchunks, tperteam);
+
+#pragma omp target teams distribute parallel for num_teams(numteams) \
+    schedule(static, 1) is_device_ptr(sums) firstprivate(begin, n)
+  for (DistanceT c = 0; c < nchunks; ++c) {
+    const DistanceT b = c * chunk;
+    const DistanceT e = (b + chunk < n) ? b + chunk : n;
+    Value acc = begin[b];
+    for (DistanceT i = b + 1; i < e; ++i) {
+      acc = f(acc, begin[i]);
+    }
+    sums[c] = acc;
+  }
+
+  target_scan<false>(tperteam, sums, nchunks, sums, f, init);
+
+#pragma omp target teams distribute parallel for num_teams(numteams) \
+    schedule(static, 1) is_device_ptr(sums) firstprivate(begin, out, init, n)
+  for (DistanceT c = 0; c < nchunks; ++c) {
+    const DistanceT b = c * chunk;
+    const DistanceT e = (b + chunk < n) ? b + chunk : n;
+    if (Exclusive) {
+      Value acc = (c > 0) ? f(init, sums[c - 1]) : init;
+      for (DistanceT i = b; i < e; ++i) {
+        Value v = begin[i];
+        out[i] = acc;
+        acc = f(acc, v);
+      }
+    } else {
+      Value acc = (c > 0) ? f(sums[c - 1], begin[b]) : begin[b];
+      out[b] = acc;
+      for (DistanceT i = b + 1; i < e; ++i) {
+        acc = f(acc, begin[i]);
+        out[i] = acc;
+      }
+    }
+  }
+
+  omp_target_free(sums, did);
+}
+
+//! threads per team of the scan loops, capped as in forall
+template <size_t ThreadsPerTeam>
+constexpr int target_scan_threads()
+{
+  return (static_cast<int>(ThreadsPerTeam) > policy::omp::MAXNUMTHREADS)
+             ? policy::omp::MAXNUMTHREADS
+             : static_cast<int>(ThreadsPerTeam);
+}
+
+}  // namespace detail
+
+}  // namespace omp
+
+namespace impl
+{
+namespace scan
+{
+
+//
+// The scans run on the default device and return once they are done.
+//
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t ThreadsPerTeam, typename Iter, typename BinFn>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+inclusive_inplace(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  omp::detail::target_scan<false>(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, end - begin, begin, f, Value());
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t ThreadsPerTeam, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+exclusive_inplace(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  omp::detail::target_scan<true>(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, end - begin, begin, f, static_cast<Value>(v));
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <size_t ThreadsPerTeam, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+inclusive(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  omp::detail::target_scan<false>(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, end - begin, out, f, Value());
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <size_t ThreadsPerTeam,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+exclusive(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  omp::detail::target_scan<true>(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, end - begin, out, f, static_cast<Value>(v));
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief inclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <size_t ThreadsPerTeam, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+inclusive_adapted(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  omp::detail::target_scan<false>(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, end - begin, out, f, Value());
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <size_t ThreadsPerTeam, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+exclusive_adapted(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  omp::detail::target_scan<true>(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, end - begin, out, f, static_cast<Value>(BinFn::identity()));
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+//
+// omp_target_parallel_for_exec_nt leaves the threads per team to the
+// runtime, scan with the most threads per team the scans use.
+//
+using omp_target_scan_nt_exec =
+    omp_target_parallel_for_exec<static_cast<size_t>(policy::omp::MAXNUMTHREADS)>;
+
+template <typename Iter, typename BinFn>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+inclusive_inplace(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  return inclusive_inplace(omp_res, omp_target_scan_nt_exec{}, begin, end, f);
+}
+
+template <typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+exclusive_inplace(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  return exclusive_inplace(omp_res, omp_target_scan_nt_exec{}, begin, end, f, v);
+}
+
+template <typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+inclusive(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  return inclusive(omp_res, omp_target_scan_nt_exec{}, begin, end, out, f);
+}
+
+template <typename Iter, typename OutIter, typename BinFn, typename ValueT>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+exclusive(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  return exclusive(omp_res, omp_target_scan_nt_exec{}, begin, end, out, f, v);
+}
+
+template <typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+inclusive_adapted(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  return inclusive_adapted(omp_res, omp_target_scan_nt_exec{}, begin, end, out, f);
+}
+
+template <typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+resources::EventProxy<resources::Omp>
+exclusive_adapted(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  return exclusive_adapted(omp_res, omp_target_scan_nt_exec{}, begin, end, out, f);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TARGET_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,278 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_openmp_target_HPP
+#define RAJA_sort_openmp_target_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include <iterator>
+#include <type_traits>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/zip.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/policy/openmp_target/policy.hpp"
+#include "RAJA/policy/openmp_target/scan.hpp"
+
+namespace RAJA
+{
+
+namespace omp
+{
+
+namespace detail
+{
+
+/*!
+        \brief device bitonic sort of the n values from begin
+
+   Each step is one target loop over the values that compares and swaps
+   pairs of values. The first step of a merge compares each value of a
+   block with the mirrored value of the block, so every step sorts
+   ascending and the values past n, thought of as larger than all others,
+   are never swapped. If idx is not null the order of the values in the
+   range is kept in idx and used to order equal values, which makes the
+   sort stable. The iterators must be usable on the device, so pointers
+   must point to memory of the default device.
+*/
+template <typename Iter, typename DistanceT, typename Compare, typename IdxT>
+void target_bitonic_sort(int tperteam,
+                         Iter begin,
+                         DistanceT n,
+                         Compare comp,
+                         IdxT* idx)
+{
+  auto numteams = RAJA_DIVIDE_CEILING_INT(n, tperteam);
+
+  for (DistanceT k = 2; k / 2 < n; k *= 2) {
+    for (DistanceT j = k / 2; j > 0; j /= 2) {
+      const DistanceT mask = (j == k / 2) ? k - 1 : j;
+#pragma omp target teams distribute parallel for num_teams(numteams) \
+    schedule(static, 1) is_device_ptr(idx) firstprivate(begin, n, mask)
+      for (DistanceT i = 0; i < n; ++i) {
+        const DistanceT l = i ^ mask;
+        if (l > i && l < n) {
+          bool swap = comp(begin[l], begin[i]);
+          if (idx != nullptr && !swap && !comp(begin[i], begin[l])) {
+            swap = idx[l] < idx[i];
+          }
+          if (swap) {
+            RAJA::safe_iter_swap(begin + i, begin + l);
+            if (idx != nullptr) {
+              RAJA::safe_iter_swap(idx + i, idx + l);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+//! bitonic sort ordering equal values by their position in begin
+template <typename Iter, typename DistanceT, typename Compare>
+void target_stable_sort(int tperteam, Iter begin, DistanceT n, Compare comp)
+{
+  const int did = omp_get_default_device();
+  DistanceT* idx = static_cast<DistanceT*>(
+      omp_target_alloc(n * sizeof(DistanceT), did));
+
+  auto numteams = RAJA_DIVIDE_CEILING_INT(n, tperteam);
+#pragma omp target teams distribute parallel for num_teams(numteams) \
+    schedule(static, 1) is_device_ptr(idx)
+  for (DistanceT i = 0; i < n; ++i) {
+    idx[i] = i;
+  }
+
+  target_bitonic_sort(tperteam, begin, n, comp, idx);
+
+  omp_target_free(idx, did);
+}
+
+}  // namespace detail
+
+}  // namespace omp
+
+namespace impl
+{
+namespace sort
+{
+
+//
+// The sorts run on the default device and return once they are done.
+//
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <size_t ThreadsPerTeam, typename Iter, typename Compare>
+resources::EventProxy<resources::Omp>
+unstable(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using DistanceT = typename ::std::iterator_traits<Iter>::difference_type;
+  omp::detail::target_bitonic_sort(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, end - begin, comp, static_cast<DistanceT*>(nullptr));
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <size_t ThreadsPerTeam, typename Iter, typename Compare>
+resources::EventProxy<resources::Omp>
+stable(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  omp::detail::target_stable_sort(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, end - begin, comp);
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <size_t ThreadsPerTeam,
+          typename KeyIter, typename ValIter, typename Compare>
+resources::EventProxy<resources::Omp>
+unstable_pairs(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  using DistanceT = typename ::std::iterator_traits<KeyIter>::difference_type;
+  omp::detail::target_bitonic_sort(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, keys_end - keys_begin, RAJA::compare_first<zip_ref>(comp),
+      static_cast<DistanceT*>(nullptr));
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+   keys
+*/
+template <size_t ThreadsPerTeam,
+          typename KeyIter, typename ValIter, typename Compare>
+resources::EventProxy<resources::Omp>
+stable_pairs(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec<ThreadsPerTeam>&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  omp::detail::target_stable_sort(
+      omp::detail::target_scan_threads<ThreadsPerTeam>(),
+      begin, keys_end - keys_begin, RAJA::compare_first<zip_ref>(comp));
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+//
+// omp_target_parallel_for_exec_nt leaves the threads per team to the
+// runtime, sort with the most threads per team the sorts use.
+//
+using omp_target_sort_nt_exec =
+    omp_target_parallel_for_exec<static_cast<size_t>(policy::omp::MAXNUMTHREADS)>;
+
+template <typename Iter, typename Compare>
+resources::EventProxy<resources::Omp>
+unstable(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  return unstable(omp_res, omp_target_sort_nt_exec{}, begin, end, comp);
+}
+
+template <typename Iter, typename Compare>
+resources::EventProxy<resources::Omp>
+stable(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  return stable(omp_res, omp_target_sort_nt_exec{}, begin, end, comp);
+}
+
+template <typename KeyIter, typename ValIter, typename Compare>
+resources::EventProxy<resources::Omp>
+unstable_pairs(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  return unstable_pairs(omp_res, omp_target_sort_nt_exec{},
+                        keys_begin, keys_end, vals_begin, comp);
+}
+
+template <typename KeyIter, typename ValIter, typename Compare>
+resources::EventProxy<resources::Omp>
+stable_pairs(
+    resources::Omp omp_res,
+    const omp_target_parallel_for_exec_nt&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  return stable_pairs(omp_res, omp_target_sort_nt_exec{},
+                      keys_begin, keys_end, vals_begin, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TARGET_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,206 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the OpenMP target launch and loop
+ *          implementations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_openmp_target_HPP
+#define RAJA_pattern_teams_openmp_target_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/policy/openmp_target/policy.hpp"
+
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+//
+// The launch body runs on the initial thread of each team of an
+// omp target teams region, with as many teams as the Grid has and the
+// threads of the Grid as thread limit. Loops with omp_target_team_distribute
+// split their iterations over the teams, loops with
+// omp_target_thread_parallel_for run as a parallel loop on the threads of
+// the team, which ends with a barrier of the team. The dynamic shared
+// memory of the Grid is not supported.
+//
+template <>
+struct LaunchExecute<RAJA::expt::omp_target_launch_t> {
+
+
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    BODY launch_body = body;
+    LaunchContext launch_ctx = ctx;
+
+    const int numteams =
+        ctx.teams.value[0] * ctx.teams.value[1] * ctx.teams.value[2];
+    const int tperteam =
+        ctx.threads.value[0] * ctx.threads.value[1] * ctx.threads.value[2];
+
+#pragma omp target teams num_teams(numteams) thread_limit(tperteam) \
+    firstprivate(launch_ctx)
+    {
+      launch_body(launch_ctx);
+    }
+  }
+
+  template <typename BODY>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
+  {
+    exec(ctx, body);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+
+template <typename SEGMENT>
+struct LoopExecute<omp_target_team_distribute, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+
+    for (int i = omp_get_team_num(); i < len; i += omp_get_num_teams()) {
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int ij = omp_get_team_num(); ij < len0 * len1;
+         ij += omp_get_num_teams()) {
+      const int j = ij / len0;
+      const int i = ij - j * len0;
+      body(*(segment0.begin() + i), *(segment1.begin() + j));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int ijk = omp_get_team_num(); ijk < len0 * len1 * len2;
+         ijk += omp_get_num_teams()) {
+      const int k = ijk / (len0 * len1);
+      const int ij = ijk - k * (len0 * len1);
+      const int j = ij / len0;
+      const int i = ij - j * len0;
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           *(segment2.begin() + k));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopExecute<omp_target_thread_parallel_for, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+
+#pragma omp parallel for
+    for (int i = 0; i < len; i++) {
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp parallel for collapse(2)
+    for (int j = 0; j < len1; j++) {
+      for (int i = 0; i < len0; i++) {
+        body(*(segment0.begin() + i), *(segment1.begin() + j));
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp parallel for collapse(3)
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k));
+        }
+      }
+    }
+  }
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TARGET_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -25,6 +25,7 @@
 #endif
 
 #include "RAJA/policy/sequential/forall.hpp"
+#include "RAJA/policy/sequential/histogram.hpp"
 #include "RAJA/policy/sequential/kernel.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/policy/sequential/reduce.hpp"
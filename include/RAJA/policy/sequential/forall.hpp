@@ -29,9 +29,12 @@
 
 #include "RAJA/policy/sequential/policy.hpp"
 
+#include "RAJA/index/StaticRangeSegment.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/params/reduce.hpp"
 
 #include "RAJA/util/resource.hpp"
 
@@ -53,11 +56,8 @@ namespace sequential
 //////////////////////////////////////////////////////////////////////
 //
 
-template <typename Iterable, typename Func, typename Resource>
-RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
-                                                               const seq_exec &,
-                                                               Iterable &&iter,
-                                                               Func &&body)
+template <typename Iterable, typename Func>
+RAJA_INLINE void seq_loop(std::false_type, Iterable &&iter, Func &&body)
 {
   RAJA_EXTRACT_BED_IT(iter);
 
@@ -65,6 +65,47 @@ RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
   for (decltype(distance_it) i = 0; i < distance_it; ++i) {
     body(*(begin_it + i));
   }
+}
+
+///
+/// Ranges with compile time bounds are unrolled
+///
+template <typename Iterable, typename Func>
+RAJA_INLINE void seq_loop(std::true_type, Iterable &&iter, Func &&body)
+{
+  static_for_each(iter, body);
+}
+
+template <typename Iterable, typename Func, typename Resource>
+RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
+                                                               const seq_exec &,
+                                                               Iterable &&iter,
+                                                               Func &&body)
+{
+  seq_loop(type_traits::is_static_range<camp::decay<Iterable>>{},
+           std::forward<Iterable>(iter),
+           std::forward<Func>(body));
+  return resources::EventProxy<Resource>(res);
+}
+
+///
+/// Reduction parameters are accumulated in registers of the calling thread
+///
+template <typename Iterable, typename Func, typename Resource,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<Resource> forall_param_impl(
+    Resource res,
+    const seq_exec &,
+    Iterable &&iter,
+    camp::tuple<Params...> const &params,
+    Func &&body)
+{
+  auto vals = expt::detail::make_param_values(params);
+  forall_impl(res,
+              seq_exec{},
+              std::forward<Iterable>(iter),
+              expt::detail::make_param_body(std::forward<Func>(body), vals));
+  expt::detail::combine_params(params, vals);
   return resources::EventProxy<Resource>(res);
 }
 
@@ -108,6 +108,144 @@ stable_pairs(
       keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+        \brief stable sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  return RAJA::impl::sort::segmented(host_res, ::RAJA::loop_exec{},
+      begin, end, offsets_begin, offsets_end, comp);
+}
+
+/*!
+        \brief stable sort each segment of given range of pairs using
+               comparison function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  return RAJA::impl::sort::segmented_pairs(host_res, ::RAJA::loop_exec{},
+      keys_begin, keys_end, vals_begin, offsets_begin, offsets_end, comp);
+}
+
+/*!
+        \brief partially sort given range using comparison function so nth
+               is the element it would be if the range were sorted
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+nth_element(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  return RAJA::impl::sort::nth_element(host_res, ::RAJA::loop_exec{},
+      begin, nth, end, comp);
+}
+
+/*!
+        \brief sort the smallest elements of given range into [begin, middle)
+               using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+partial(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter middle,
+    Iter end,
+    Compare comp)
+{
+  return RAJA::impl::sort::partial(host_res, ::RAJA::loop_exec{},
+      begin, middle, end, comp);
+}
+
+/*!
+        \brief write the permutation that stably sorts given range of keys
+               using comparison function, the keys are not modified
+*/
+template <typename ExecPolicy, typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+argsort(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    IdxIter perm_begin,
+    Compare comp)
+{
+  return RAJA::impl::sort::argsort(host_res, ::RAJA::loop_exec{},
+      keys_begin, keys_end, perm_begin, comp);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+stable_bits(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    int begin_bit,
+    int end_bit,
+    Compare comp)
+{
+  return RAJA::impl::sort::stable_bits(host_res, ::RAJA::loop_exec{},
+      begin, end, begin_bit, end_bit, comp);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+               keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+stable_pairs_bits(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    int begin_bit,
+    int end_bit,
+    Compare comp)
+{
+  return RAJA::impl::sort::stable_pairs_bits(host_res, ::RAJA::loop_exec{},
+      keys_begin, keys_end, vals_begin, begin_bit, end_bit, comp);
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -18,6 +18,7 @@
 #ifndef RAJA_pattern_teams_sequential_HPP
 #define RAJA_pattern_teams_sequential_HPP
 
+#include "RAJA/index/StaticRangeSegment.hpp"
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 
@@ -64,6 +65,37 @@ struct LoopICountExecute<seq_exec, SEGMENT> {
   }
 };
 
+//
+// Ranges with compile time bounds are unrolled
+//
+template <typename T, T Begin, T End>
+struct LoopExecute<seq_exec, TypedStaticRangeSegment<T, Begin, End>> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TypedStaticRangeSegment<T, Begin, End> const &segment,
+      BODY const &body)
+  {
+    static_for_each(segment, body);
+  }
+};
+
+template <typename T, T Begin, T End>
+struct LoopICountExecute<seq_exec, TypedStaticRangeSegment<T, Begin, End>> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TypedStaticRangeSegment<T, Begin, End> const &segment,
+      BODY const &body)
+  {
+    static_for_each(segment, [&](T i) {
+      body(i, static_cast<int>(i - Begin));
+    });
+  }
+};
+
 }  // namespace expt
 
 }  // namespace RAJA
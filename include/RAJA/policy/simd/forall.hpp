@@ -37,6 +37,8 @@
 
 #include "RAJA/policy/simd/policy.hpp"
 
+#include "RAJA/pattern/params/reduce.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -62,6 +64,161 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   return RAJA::resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// Reduction parameters keep an accumulator per vector lane so the
+/// iterations of the vectorized loop never update the same accumulator
+///
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_param_impl(
+    RAJA::resources::Host host_res,
+    const simd_exec &,
+    Iterable &&iter,
+    camp::tuple<Params...> const &params,
+    Func &&loop_body)
+{
+  constexpr int lanes = 8;
+
+  auto vals = expt::detail::make_param_lane_values<lanes>(params);
+  auto body = expt::detail::make_param_body(std::forward<Func>(loop_body),
+                                            vals);
+
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  decltype(distance) i = 0;
+  for (; i + lanes <= distance; i += lanes) {
+    RAJA_SIMD
+    for (int l = 0; l < lanes; ++l) {
+      body(*(begin + i + l), l);
+    }
+  }
+  for (int l = 0; i + l < distance; ++l) {
+    body(*(begin + i + l), l);
+  }
+
+  expt::detail::combine_params(params, vals);
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
+namespace detail
+{
+
+//! iterations before the first index of iter that is a multiple of SimdLen
+template <int SimdLen, typename Iterator, typename Diff>
+RAJA_INLINE Diff simd_peel_count(Iterator begin, Diff distance, std::true_type)
+{
+  if (distance <= 0) {
+    return 0;
+  }
+  Diff rem = static_cast<Diff>(*begin % SimdLen);
+  if (rem < 0) {
+    rem += SimdLen;
+  }
+  Diff peel = (SimdLen - rem) % SimdLen;
+  return peel < distance ? peel : distance;
+}
+
+//! indices that are not integers, or loops that are not aligned, are not peeled
+template <int SimdLen, typename Iterator, typename Diff>
+RAJA_INLINE Diff simd_peel_count(Iterator, Diff, std::false_type)
+{
+  return 0;
+}
+
+template <int SimdLen, bool Aligned, typename Iterator, typename Diff>
+RAJA_INLINE Diff simd_peel_count(Iterator begin, Diff distance)
+{
+  using index_type = camp::decay<decltype(*begin)>;
+  return simd_peel_count<SimdLen>(
+      begin,
+      distance,
+      std::integral_constant<bool,
+                             Aligned && std::is_integral<index_type>::value>{});
+}
+
+}  // namespace detail
+
+///
+/// The main loop starts at an index that is a multiple of SimdLen, so the
+/// accesses of a body that indexes arrays aligned to SimdLen values are
+/// aligned, and runs a whole number of vectors
+///
+template <typename Iterable, typename Func, int SimdLen, bool Aligned>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host host_res,
+    const simd_len_exec<SimdLen, Aligned> &,
+    Iterable &&iter,
+    Func &&loop_body)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  using diff_type = decltype(distance);
+
+  const diff_type peel =
+      detail::simd_peel_count<SimdLen, Aligned>(begin, distance);
+  const diff_type main_end = peel + (distance - peel) / SimdLen * SimdLen;
+
+  for (diff_type i = 0; i < peel; ++i) {
+    loop_body(*(begin + i));
+  }
+  RAJA_SIMD_LEN(SimdLen)
+  for (diff_type i = peel; i < main_end; ++i) {
+    loop_body(*(begin + i));
+  }
+  for (diff_type i = main_end; i < distance; ++i) {
+    loop_body(*(begin + i));
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// Reduction parameters keep SimdLen accumulators, one per lane of a
+/// vector, as a reduction clause on the simd loop would
+///
+template <typename Iterable,
+          typename Func,
+          int SimdLen,
+          bool Aligned,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_param_impl(
+    RAJA::resources::Host host_res,
+    const simd_len_exec<SimdLen, Aligned> &,
+    Iterable &&iter,
+    camp::tuple<Params...> const &params,
+    Func &&loop_body)
+{
+  auto vals = expt::detail::make_param_lane_values<SimdLen>(params);
+  auto body = expt::detail::make_param_body(std::forward<Func>(loop_body),
+                                            vals);
+
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  using diff_type = decltype(distance);
+
+  const diff_type peel =
+      detail::simd_peel_count<SimdLen, Aligned>(begin, distance);
+
+  for (int l = 0; l < peel; ++l) {
+    body(*(begin + l), l);
+  }
+  diff_type i = peel;
+  for (; i + SimdLen <= distance; i += SimdLen) {
+    RAJA_SIMD_LEN(SimdLen)
+    for (int l = 0; l < SimdLen; ++l) {
+      body(*(begin + i + l), l);
+    }
+  }
+  for (int l = 0; i + l < distance; ++l) {
+    body(*(begin + i + l), l);
+  }
+
+  expt::detail::combine_params(params, vals);
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace simd
 
 }  // namespace policy
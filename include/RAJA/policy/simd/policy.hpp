@@ -44,11 +44,29 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+///
+/// simd_exec for a vector length of SimdLen iterations. The loop is split
+/// into a peeled prologue, that stops at the first index that is a multiple
+/// of SimdLen when Aligned, a main loop of whole vectors and a scalar
+/// epilogue, so the main loop needs no remainder or alignment checks.
+///
+template <int SimdLen, bool Aligned = true>
+struct simd_len_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                             Pattern::forall,
+                                                             Launch::undefined,
+                                                             Platform::host> {
+  static_assert(SimdLen > 0, "simd_len_exec SimdLen must be positive");
+
+  static constexpr int simdlen = SimdLen;
+  static constexpr bool aligned = Aligned;
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::simd_len_exec;
 
 }  // end of namespace RAJA
 
@@ -28,6 +28,13 @@ namespace RAJA
 namespace expt
 {
 
+/*!
+ * simd_exec as a thread loop policy of a host launch runs the threads of a
+ * team as lanes of a vectorized loop. Host launches run each thread loop
+ * to completion before the next statement, so teamSync falls between
+ * whole loops and each loop between two syncs vectorizes on its own. The
+ * multi-dimensional loops vectorize the first, fastest, dimension.
+ */
 template <typename SEGMENT>
 struct LoopExecute<simd_exec, SEGMENT> {
 
@@ -44,6 +51,50 @@ struct LoopExecute<simd_exec, SEGMENT> {
       body(*(segment.begin() + i));
     }
   }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int j = 0; j < len1; j++) {
+      RAJA_SIMD
+      for (int i = 0; i < len0; i++) {
+        body(*(segment0.begin() + i), *(segment1.begin() + j));
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k));
+        }
+      }
+    }
+  }
 };
 
 template <typename SEGMENT>
@@ -62,6 +113,95 @@ struct LoopICountExecute<simd_exec, SEGMENT> {
       body(*(segment.begin() + i), i);
     }
   }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int j = 0; j < len1; j++) {
+      RAJA_SIMD
+      for (int i = 0; i < len0; i++) {
+        body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k), i, j, k);
+        }
+      }
+    }
+  }
+};
+
+//Tile Execute + variants, the tiles run in order and the loops over
+//each tile vectorize
+
+template <typename SEGMENT>
+struct TileExecute<simd_exec, SEGMENT> {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_HOST_DEVICE RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+
+    for (int tx = 0; tx < len; tx += tile_size)
+    {
+      body(segment.slice(tx, tile_size));
+    }
+  }
+
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<simd_exec, SEGMENT> {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_HOST_DEVICE RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+
+    for (int tx = 0, bx=0; tx < len; tx += tile_size, bx++)
+    {
+      body(segment.slice(tx, tile_size), bx);
+    }
+  }
+
 };
 
 }  // namespace expt
@@ -0,0 +1,33 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for execution with the
+ *          parallel algorithms of the C++ standard library.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_stdpar_HPP
+#define RAJA_stdpar_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_STDPAR)
+
+#include "RAJA/policy/stdpar/forall.hpp"
+#include "RAJA/policy/stdpar/policy.hpp"
+#include "RAJA/policy/stdpar/scan.hpp"
+#include "RAJA/policy/stdpar/sort.hpp"
+
+#endif
+
+#endif  // closing endif for header file include guard
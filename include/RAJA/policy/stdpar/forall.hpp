@@ -0,0 +1,237 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for the parallel algorithms of the C++
+ *          standard library.
+ *
+ *          Loops are lowered onto std::for_each, and loops with reduction
+ *          parameters onto std::transform_reduce.
+ *
+ ******************************************************************************
+ */
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef RAJA_forall_stdpar_HPP
+#define RAJA_forall_stdpar_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_STDPAR)
+
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/reduce.hpp"
+#include "RAJA/policy/stdpar/policy.hpp"
+#include "RAJA/util/types.hpp"
+
+
+namespace RAJA
+{
+namespace policy
+{
+namespace stdpar
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Transform of std::transform_reduce, runs the loop body for one
+ *        index with accumulators of its own and returns them.
+ */
+template <typename Body, typename Params, typename Seq>
+struct ParamTransform;
+
+template <typename Body, typename... Params, camp::idx_t... Is>
+struct ParamTransform<Body, camp::tuple<Params...>, camp::idx_seq<Is...>> {
+  using values_type = expt::detail::param_values<Params...>;
+
+  Body body;
+
+  template <typename Idx>
+  RAJA_INLINE values_type operator()(Idx&& i) const
+  {
+    values_type vals(Params::identity()...);
+    body(std::forward<Idx>(i), camp::get<Is>(vals)...);
+    return vals;
+  }
+};
+
+/*!
+ * \brief Reduction of std::transform_reduce, combines the accumulators of
+ *        each parameter with its operator.
+ */
+template <typename Params, typename Seq>
+struct ParamCombine;
+
+template <typename... Params, camp::idx_t... Is>
+struct ParamCombine<camp::tuple<Params...>, camp::idx_seq<Is...>> {
+  using values_type = expt::detail::param_values<Params...>;
+
+  RAJA_INLINE values_type operator()(values_type a, values_type const& b) const
+  {
+    camp::sink((camp::get<Is>(a) = typename Params::op_type{}(camp::get<Is>(a),
+                                                              camp::get<Is>(b)),
+                0)...);
+    return a;
+  }
+};
+
+/*!
+ * \brief Runs loop_body of each value of iter with std::for_each over the
+ *        positions of iter, so any random access iterable can be used.
+ */
+template <typename ExecPolicy, typename Iterable, typename Func>
+RAJA_INLINE void stdpar_forall(ExecPolicy const& p,
+                               Iterable&& iter,
+                               Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  auto b = begin(iter);
+  using diff_type = decltype(distance(begin(iter), end(iter)));
+  TypedRangeSegment<diff_type> positions(0,
+                                         distance(begin(iter), end(iter)));
+  camp::decay<Func> body(std::forward<Func>(loop_body));
+  std::for_each(std_execution(p),
+                positions.begin(),
+                positions.end(),
+                [=](diff_type i) { body(b[i]); });
+}
+
+/*!
+ * \brief Runs loop_body of each value of iter with std::transform_reduce of
+ *        the accumulators of the reduction parameters, and combines the
+ *        result into their targets.
+ */
+template <typename ExecPolicy,
+          typename Iterable,
+          typename Func,
+          typename... Params>
+RAJA_INLINE void stdpar_forall_params(ExecPolicy const& p,
+                                      Iterable&& iter,
+                                      camp::tuple<Params...> const& params,
+                                      Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using Seq = camp::make_idx_seq_t<sizeof...(Params)>;
+  auto b = begin(iter);
+  using diff_type = decltype(distance(begin(iter), end(iter)));
+  TypedRangeSegment<diff_type> positions(0,
+                                         distance(begin(iter), end(iter)));
+  ParamTransform<camp::decay<Func>, camp::tuple<Params...>, Seq> transform{
+      std::forward<Func>(loop_body)};
+  auto vals = std::transform_reduce(std_execution(p),
+                                    positions.begin(),
+                                    positions.end(),
+                                    expt::detail::make_param_values(params),
+                                    ParamCombine<camp::tuple<Params...>, Seq>{},
+                                    [=](diff_type i) { return transform(b[i]); });
+  expt::detail::combine_params(params, vals);
+}
+
+}  // namespace detail
+
+/**
+ * @brief stdpar for implementation
+ *
+ * @param p stdpar tag
+ * @param iter any random access iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall runs std::for_each with std::execution::par over the
+ * positions of the iterable.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const stdpar_par_exec& p,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  detail::stdpar_forall(p, std::forward<Iterable>(iter),
+                        std::forward<Func>(loop_body));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/**
+ * @brief stdpar unsequenced for implementation
+ *
+ * This forall runs std::for_each with std::execution::par_unseq, so the
+ * loop body may also be vectorized, or run on a GPU by nvc++ -stdpar=gpu.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const stdpar_par_unseq_exec& p,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  detail::stdpar_forall(p, std::forward<Iterable>(iter),
+                        std::forward<Func>(loop_body));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// Reduction parameters are lowered onto std::transform_reduce, each index
+/// accumulates into values of its own that the algorithm combines
+///
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_param_impl(
+    resources::Host host_res,
+    const stdpar_par_exec& p,
+    Iterable&& iter,
+    camp::tuple<Params...> const& params,
+    Func&& loop_body)
+{
+  detail::stdpar_forall_params(p, std::forward<Iterable>(iter), params,
+                               std::forward<Func>(loop_body));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_param_impl(
+    resources::Host host_res,
+    const stdpar_par_unseq_exec& p,
+    Iterable&& iter,
+    camp::tuple<Params...> const& params,
+    Func&& loop_body)
+{
+  detail::stdpar_forall_params(p, std::forward<Iterable>(iter), params,
+                               std::forward<Func>(loop_body));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace stdpar
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_STDPAR)
+
+#endif  // closing endif for header file include guard
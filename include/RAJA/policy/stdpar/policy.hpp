@@ -0,0 +1,99 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA stdpar policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_stdpar_HPP
+#define policy_stdpar_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include <execution>
+
+namespace RAJA
+{
+namespace policy
+{
+namespace stdpar
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies, lowered onto the algorithms of the standard
+/// library with std::execution::par or std::execution::par_unseq, so the
+/// loops run on the parallel STL of the compiler, for example nvc++ with
+/// -stdpar or oneDPL.
+///
+/// A par_unseq loop body may be vectorized and must not take locks or
+/// allocate memory. Loops that do, for example with RAJA atomics that are
+/// lowered onto locks, use stdpar_par_exec.
+///
+struct stdpar_par_exec
+    : make_policy_pattern_launch_platform_t<Policy::stdpar,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+struct stdpar_par_unseq_exec
+    : make_policy_pattern_launch_platform_t<Policy::stdpar,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+using stdpar_exec = stdpar_par_unseq_exec;
+
+///
+/// Index set segment iteration policies
+///
+using stdpar_segit = stdpar_par_exec;
+
+namespace detail
+{
+
+//! the standard execution policy object of a stdpar policy
+inline constexpr std::execution::parallel_policy const& std_execution(
+    stdpar_par_exec const&)
+{
+  return std::execution::par;
+}
+
+inline constexpr std::execution::parallel_unsequenced_policy const&
+std_execution(stdpar_par_unseq_exec const&)
+{
+  return std::execution::par_unseq;
+}
+
+}  // namespace detail
+
+}  // namespace stdpar
+}  // namespace policy
+
+using policy::stdpar::stdpar_exec;
+using policy::stdpar::stdpar_par_exec;
+using policy::stdpar::stdpar_par_unseq_exec;
+using policy::stdpar::stdpar_segit;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,190 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations for the parallel
+*          algorithms of the C++ standard library.
+*
+******************************************************************************
+*/
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef RAJA_scan_stdpar_HPP
+#define RAJA_scan_stdpar_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_STDPAR)
+
+#include <execution>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/stdpar/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value, with std::inclusive_scan
+*/
+template <typename ExecPolicy, typename Iter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+inclusive_inplace(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  std::inclusive_scan(policy::stdpar::detail::std_execution(p),
+                      begin, end, begin, f);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value, with std::exclusive_scan
+*/
+template <typename ExecPolicy, typename Iter, typename BinFn, typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+exclusive_inplace(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    T v)
+{
+  using value_type = typename std::remove_reference<decltype(*begin)>::type;
+  std::exclusive_scan(policy::stdpar::detail::std_execution(p),
+                      begin, end, begin, static_cast<value_type>(v), f);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value, with std::inclusive_scan
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+inclusive(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  std::inclusive_scan(policy::stdpar::detail::std_execution(p),
+                      begin, end, out, f);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value, with std::exclusive_scan
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+exclusive(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using value_type = typename std::remove_reference<decltype(*out)>::type;
+  std::exclusive_scan(policy::stdpar::detail::std_execution(p),
+                      begin, end, out, static_cast<value_type>(v), f);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief inclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+inclusive_adapted(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  std::inclusive_scan(policy::stdpar::detail::std_execution(p),
+                      begin, end, out, f);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+exclusive_adapted(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using value_type = typename std::iterator_traits<Iter>::value_type;
+  std::exclusive_scan(policy::stdpar::detail::std_execution(p),
+                      begin, end, out, value_type(BinFn::identity()), f);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_STDPAR)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,355 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations for the parallel
+*          algorithms of the C++ standard library.
+*
+******************************************************************************
+*/
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef RAJA_sort_stdpar_HPP
+#define RAJA_sort_stdpar_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_STDPAR)
+
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/policy/stdpar/policy.hpp"
+#include "RAJA/policy/loop/sort.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/sort.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+/*!
+    \brief Functional that performs an unstable sort with the
+           given arguments, calls std::sort
+*/
+struct StdparUnstableSorter
+{
+  template < typename... Args >
+  RAJA_INLINE
+  void operator()(Args&&... args) const
+  {
+    std::sort(std::forward<Args>(args)...);
+  }
+};
+
+/*!
+    \brief Functional that performs a stable sort with the
+           given arguments, calls std::stable_sort
+*/
+struct StdparStableSorter
+{
+  template < typename... Args >
+  RAJA_INLINE
+  void operator()(Args&&... args) const
+  {
+    std::stable_sort(std::forward<Args>(args)...);
+  }
+};
+
+/*!
+        \brief write the identity permutation of len values to perm
+*/
+template <typename ExecPolicy, typename IdxIter>
+inline void stdpar_iota(const ExecPolicy& p,
+                        IdxIter perm,
+                        RAJA::Index_type len)
+{
+  using I = RAJA::detail::IterVal<IdxIter>;
+  TypedRangeSegment<RAJA::Index_type> positions(0, len);
+  std::for_each(policy::stdpar::detail::std_execution(p),
+                positions.begin(),
+                positions.end(),
+                [=](RAJA::Index_type i) { perm[i] = static_cast<I>(i); });
+}
+
+/*!
+        \brief sort given range of pairs using sorter and comparison function
+               on keys
+
+        The standard algorithms do not sort the proxy references of zip
+        iterators, so the permutation that sorts the keys is sorted and
+        the pairs are gathered through it into temporaries.
+*/
+template <typename Sorter, typename ExecPolicy, typename KeyIter,
+          typename ValIter, typename Compare>
+inline void stdpar_sort_pairs(Sorter sorter,
+                              const ExecPolicy& p,
+                              KeyIter keys_begin,
+                              KeyIter keys_end,
+                              ValIter vals_begin,
+                              Compare comp)
+{
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using V = RAJA::detail::IterVal<ValIter>;
+  auto const& exec = policy::stdpar::detail::std_execution(p);
+  const RAJA::Index_type len = keys_end - keys_begin;
+
+  std::vector<RAJA::Index_type> perm(len);
+  stdpar_iota(p, perm.data(), len);
+  sorter(exec, perm.begin(), perm.end(),
+         RAJA::detail::compare_indirect(keys_begin, comp));
+
+  std::vector<K> keys(len);
+  std::vector<V> vals(len);
+  RAJA::Index_type const* perm_ptr = perm.data();
+  K* keys_ptr = keys.data();
+  V* vals_ptr = vals.data();
+  TypedRangeSegment<RAJA::Index_type> positions(0, len);
+  std::for_each(exec, positions.begin(), positions.end(),
+                [=](RAJA::Index_type i) {
+                  keys_ptr[i] = keys_begin[perm_ptr[i]];
+                  vals_ptr[i] = vals_begin[perm_ptr[i]];
+                });
+
+  std::copy(exec, keys.begin(), keys.end(), keys_begin);
+  std::copy(exec, vals.begin(), vals.end(), vals_begin);
+}
+
+} // namespace detail
+
+/*!
+        \brief sort given range using comparison function, with std::sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  std::sort(policy::stdpar::detail::std_execution(p), begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range using comparison function, with
+               std::stable_sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  std::stable_sort(policy::stdpar::detail::std_execution(p), begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::stdpar_sort_pairs(detail::StdparUnstableSorter{}, p,
+                            keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::stdpar_sort_pairs(detail::StdparStableSorter{}, p,
+                            keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort each segment of given range using comparison function
+
+        Each segment is sorted by one iteration of std::for_each with
+        std::execution::par, as the sort of a segment is not vectorizable.
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  const RAJA::Index_type num_segments = (offsets_end - offsets_begin) - 1;
+  TypedRangeSegment<RAJA::Index_type> segments(0, num_segments);
+  std::for_each(std::execution::par, segments.begin(), segments.end(),
+                [=](RAJA::Index_type s) {
+                  detail::StableSorter{}(begin + offsets_begin[s],
+                                         begin + offsets_begin[s+1],
+                                         comp);
+                });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort each segment of given range of pairs using
+               comparison function on keys
+
+        Each segment is sorted by one iteration of std::for_each with
+        std::execution::par.
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter,
+    ValIter vals_begin,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  const RAJA::Index_type num_segments = (offsets_end - offsets_begin) - 1;
+  TypedRangeSegment<RAJA::Index_type> segments(0, num_segments);
+  std::for_each(std::execution::par, segments.begin(), segments.end(),
+                [=](RAJA::Index_type s) {
+                  detail::StableSorter{}(begin + offsets_begin[s],
+                                         begin + offsets_begin[s+1],
+                                         RAJA::compare_first<zip_ref>(comp));
+                });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief partially sort given range using comparison function so nth
+               is the element it would be if the range were sorted, with
+               std::nth_element
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+nth_element(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  std::nth_element(policy::stdpar::detail::std_execution(p),
+                   begin, nth, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort the smallest elements of given range into [begin, middle)
+               using comparison function, with std::partial_sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+partial(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter middle,
+    Iter end,
+    Compare comp)
+{
+  std::partial_sort(policy::stdpar::detail::std_execution(p),
+                    begin, middle, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief write the permutation that stably sorts given range of keys
+               using comparison function, the keys are not modified
+*/
+template <typename ExecPolicy, typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_stdpar_policy<ExecPolicy>>
+argsort(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    IdxIter perm_begin,
+    Compare comp)
+{
+  const RAJA::Index_type len = keys_end - keys_begin;
+  detail::stdpar_iota(p, perm_begin, len);
+
+  return stable(host_res, p, perm_begin, perm_begin + len,
+                RAJA::detail::compare_indirect(keys_begin, comp));
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_STDPAR)
+
+#endif  // closing endif for header file include guard
@@ -33,6 +33,7 @@
 
 #include "RAJA/util/basic_mempool.hpp"
 #include "RAJA/util/mutex.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/sycl/policy.hpp"
@@ -68,6 +69,16 @@ void setQueue(camp::resources::Resource* q);
 
 cl::sycl::queue* getQueue();
 
+//! The queue set with setQueue if there is one, else the queue of res
+inline cl::sycl::queue* getQueue(camp::resources::Sycl& res)
+{
+  cl::sycl::queue* q = getQueue();
+  if (q == NULL) {
+    q = res.get_queue();
+  }
+  return q;
+}
+
 }  // namespace detail
 
 }  // namespace sycl
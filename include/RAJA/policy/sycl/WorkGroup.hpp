@@ -0,0 +1,25 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA Vtable and WorkRunner constructs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sycl_WorkGroup_HPP
+#define RAJA_sycl_WorkGroup_HPP
+
+#include "RAJA/policy/sycl/WorkGroup/Vtable.hpp"
+#include "RAJA/policy/sycl/WorkGroup/WorkRunner.hpp"
+
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,48 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA workgroup Vtable.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sycl_WorkGroup_Vtable_HPP
+#define RAJA_sycl_WorkGroup_Vtable_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/policy/sycl/policy.hpp"
+
+#include "RAJA/policy/loop/WorkGroup/Vtable.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+* Populate and return a Vtable object, the loops are called on the host
+* as SYCL device code can not call through function pointers
+*/
+template < typename T, typename Vtable_T, size_t BLOCK_SIZE, bool Async >
+inline const Vtable_T* get_Vtable(sycl_work<BLOCK_SIZE, Async> const&)
+{
+  return get_Vtable<T, Vtable_T>(loop_work{});
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
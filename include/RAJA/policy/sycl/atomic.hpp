@@ -0,0 +1,323 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining atomic operations for SYCL.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_sycl_atomic_HPP
+#define RAJA_policy_sycl_atomic_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <type_traits>
+
+#include <CL/sycl.hpp>
+
+#include "RAJA/policy/loop/atomic.hpp"
+#include "RAJA/policy/sequential/atomic.hpp"
+#include "RAJA/policy/atomic_builtin.hpp"
+#if defined(RAJA_ENABLE_OPENMP)
+#include "RAJA/policy/openmp/atomic.hpp"
+#endif
+
+#include "RAJA/policy/sycl/policy.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Device scope, relaxed atomic reference to *acc.
+ *
+ * sycl::atomic_ref supports 32 and 64 bit integral and floating point
+ * types, and pointers, so these are the types supported by sycl_atomic.
+ */
+template <typename T>
+using sycl_atomic_ref_type =
+    cl::sycl::atomic_ref<T,
+                         cl::sycl::memory_order::relaxed,
+                         cl::sycl::memory_scope::device,
+                         cl::sycl::access::address_space::generic_space>;
+
+template <typename T>
+RAJA_INLINE sycl_atomic_ref_type<T> sycl_atomic_ref(T volatile *acc)
+{
+  return sycl_atomic_ref_type<T>(*const_cast<T*>(acc));
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicAdd(T volatile *acc, T value)
+{
+  return sycl_atomic_ref(acc).fetch_add(value);
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicSub(T volatile *acc, T value)
+{
+  return sycl_atomic_ref(acc).fetch_sub(value);
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicMin(T volatile *acc, T value)
+{
+  return sycl_atomic_ref(acc).fetch_min(value);
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicMax(T volatile *acc, T value)
+{
+  return sycl_atomic_ref(acc).fetch_max(value);
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicAnd(T volatile *acc, T value)
+{
+  return sycl_atomic_ref(acc).fetch_and(value);
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicOr(T volatile *acc, T value)
+{
+  return sycl_atomic_ref(acc).fetch_or(value);
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicXor(T volatile *acc, T value)
+{
+  return sycl_atomic_ref(acc).fetch_xor(value);
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicExchange(T volatile *acc, T value)
+{
+  return sycl_atomic_ref(acc).exchange(value);
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicCAS(T volatile *acc, T compare, T value)
+{
+  // compare_exchange_strong writes the old value into compare on failure
+  sycl_atomic_ref(acc).compare_exchange_strong(compare, value);
+  return compare;
+}
+
+/*!
+ * Generic impementation of any atomic 32-bit or 64-bit operator
+ * using a compare and swap loop, returns the old value
+ */
+template <typename T, typename OPER>
+RAJA_INLINE T sycl_atomic_CAS_oper(T volatile *acc, OPER &&oper)
+{
+  auto ref = sycl_atomic_ref(acc);
+  T old = ref.load();
+  while (!ref.compare_exchange_weak(old, oper(old))) {
+  }
+  return old;
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicInc(T volatile *acc)
+{
+  return sycl_atomic_ref(acc).fetch_add(T(1));
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicInc(T volatile *acc, T val)
+{
+  // See:
+  // http://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html#atomicinc
+  return sycl_atomic_CAS_oper(acc, [=](T old) {
+    return ((old >= val) ? T(0) : (old + T(1)));
+  });
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicDec(T volatile *acc)
+{
+  return sycl_atomic_ref(acc).fetch_sub(T(1));
+}
+
+template <typename T>
+RAJA_INLINE T sycl_atomicDec(T volatile *acc, T val)
+{
+  // See:
+  // http://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html#atomicdec
+  return sycl_atomic_CAS_oper(acc, [=](T old) {
+    return (((old == T(0)) | (old > val)) ? val : (old - T(1)));
+  });
+}
+
+}  // namespace detail
+
+
+/*!
+ * Catch-all policy passes off to sycl atomic_ref.
+ *
+ * These are atomic in sycl device code and use the host_policy otherwise
+ */
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicAdd(acc, value);
+#else
+  return RAJA::atomicAdd(host_policy{}, acc, value);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicSub(acc, value);
+#else
+  return RAJA::atomicSub(host_policy{}, acc, value);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicMin(acc, value);
+#else
+  return RAJA::atomicMin(host_policy{}, acc, value);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicMax(acc, value);
+#else
+  return RAJA::atomicMax(host_policy{}, acc, value);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(sycl_atomic_explicit<host_policy>, T volatile *acc, T val)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicInc(acc, val);
+#else
+  return RAJA::atomicInc(host_policy{}, acc, val);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(sycl_atomic_explicit<host_policy>, T volatile *acc)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicInc(acc);
+#else
+  return RAJA::atomicInc(host_policy{}, acc);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(sycl_atomic_explicit<host_policy>, T volatile *acc, T val)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicDec(acc, val);
+#else
+  return RAJA::atomicDec(host_policy{}, acc, val);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(sycl_atomic_explicit<host_policy>, T volatile *acc)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicDec(acc);
+#else
+  return RAJA::atomicDec(host_policy{}, acc);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicAnd(acc, value);
+#else
+  return RAJA::atomicAnd(host_policy{}, acc, value);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicOr(acc, value);
+#else
+  return RAJA::atomicOr(host_policy{}, acc, value);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicXor(acc, value);
+#else
+  return RAJA::atomicXor(host_policy{}, acc, value);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicExchange(acc, value);
+#else
+  return RAJA::atomicExchange(host_policy{}, acc, value);
+#endif
+}
+
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(sycl_atomic_explicit<host_policy>, T volatile *acc, T compare, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicCAS(acc, compare, value);
+#else
+  return RAJA::atomicCAS(host_policy{}, acc, compare, value);
+#endif
+}
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_SYCL
+#endif  // guard
@@ -0,0 +1,111 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for SYCL statement executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_sycl_kernel_Reduce_HPP
+#define RAJA_policy_sycl_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/kernel/Reduce.hpp"
+
+#include "RAJA/policy/sycl/kernel/internal.hpp"
+
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+
+//
+// Executor that handles reductions across a SYCL sub-group
+//
+template <typename Data,
+          template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct SyclStatementExecutor<Data,
+                             statement::Reduce<RAJA::sycl_subgroup_reduce,
+                                               ReduceOperator,
+                                               ParamId,
+                                               EnclosedStmts...>,
+                             Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  using enclosed_stmts_t = SyclStatementListExecutor<Data, stmt_list_t, Types>;
+
+
+  static
+  inline RAJA_DEVICE void exec(Data &data, cl::sycl::nd_item<3> item, bool thread_active)
+  {
+    // sub-group reduce on the specified parameter
+    auto value = data.template get_param<ParamId>();
+    using value_t = decltype(value);
+    const value_t ident = ReduceOperator<value_t>::identity();
+
+    // if this work item isn't active, just set it to the identity
+    if (!thread_active) {
+      value = ident;
+    }
+
+    // butterfly over the lanes of the sub-group, only combining values of
+    // lanes that exist in a partial sub-group
+    using combiner_t =
+        RAJA::reduce::detail::op_adapter<value_t, ReduceOperator>;
+    auto sg = item.get_sub_group();
+    const unsigned int lane = sg.get_local_id()[0];
+    const unsigned int sg_size = sg.get_local_range()[0];
+    const unsigned int max_size = sg.get_max_local_range()[0];
+    for (unsigned int mask = 1; mask < max_size; mask *= 2) {
+      value_t rhs = cl::sycl::permute_group_by_xor(sg, value, mask);
+      if ((lane ^ mask) < sg_size) {
+        combiner_t{}(value, rhs);
+      }
+    }
+
+    // execute enclosed statements, and mask off everyone but lane 0
+    thread_active = lane == 0;
+    if(thread_active){
+      // Only update to new value on root work item
+      data.template assign_param<ParamId>(value);
+    }
+    enclosed_stmts_t::exec(data, item, thread_active);
+  }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const &data)
+  {
+    // combine with enclosed statements
+    return enclosed_stmts_t::calculateDimensions(data);
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
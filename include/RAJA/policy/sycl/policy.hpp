@@ -25,6 +25,7 @@
 #include <CL/sycl.hpp>
 
 #include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/loop/policy.hpp"
 
 #include <cstddef>
 
@@ -76,12 +77,67 @@ struct sycl_reduce
     : make_policy_pattern_t<RAJA::Policy::sycl, RAJA::Pattern::reduce> {
 };
 
+template <size_t BLOCK_SIZE, bool Async = false>
+struct sycl_work : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::sycl,
+                       RAJA::Pattern::workgroup_exec,
+                       detail::get_launch<Async>::value,
+                       RAJA::Platform::sycl> {
+};
+
+struct sycl_synchronize : make_policy_pattern_launch_t<Policy::sycl,
+                                                        Pattern::synchronize,
+                                                        Launch::sync> {
+};
+
+/*!
+ * Sycl atomic policy for using sycl atomic_ref on the device and
+ * the provided host_policy on the host
+ */
+template<typename host_policy>
+struct sycl_atomic_explicit{};
+
+/*!
+ * Default sycl atomic policy uses sycl atomics on the device and non-atomics
+ * on the host
+ */
+using sycl_atomic = sycl_atomic_explicit<loop_atomic>;
+
+// Policy for RAJA::statement::Reduce that reduces work items in a sub-group
+// down to the first work item of the sub-group
+struct sycl_subgroup_reduce{};
+
+template <bool Async, int num_threads = 0>
+struct sycl_launch_t : public RAJA::make_policy_pattern_launch_platform_t<
+                           RAJA::Policy::sycl,
+                           RAJA::Pattern::region,
+                           detail::get_launch<Async>::value,
+                           RAJA::Platform::sycl> {
+};
+
 }  // namespace sycl
 }  // namespace policy
 
 using policy::sycl::sycl_exec;
 using policy::sycl::sycl_reduce;
 
+using policy::sycl::sycl_work;
+
+template <size_t BLOCK_SIZE>
+using sycl_work_async = policy::sycl::sycl_work<BLOCK_SIZE, true>;
+
+using policy::sycl::sycl_atomic;
+using policy::sycl::sycl_atomic_explicit;
+
+using policy::sycl::sycl_synchronize;
+
+using policy::sycl::sycl_subgroup_reduce;
+
+namespace expt
+{
+  using policy::sycl::sycl_launch_t;
+}
+
 /*!
  * Maps indices to SYCL global id
  * Optional WORK_GROUP_SIZE to 
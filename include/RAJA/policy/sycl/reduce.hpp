@@ -27,6 +27,7 @@
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/sycl/policy.hpp"
@@ -483,6 +484,14 @@ public:
     parent::reduce(rhsVal, rhsLoc);
     return *this;
   }
+
+  //! enable minloc() with the components of a tuple IndexType
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  const self &minloc(T rhsVal, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    parent::reduce(rhsVal, IndexType(i0, i1, is...));
+    return *this;
+  }
 };
 
 
@@ -511,8 +520,81 @@ public:
     parent::reduce(rhsVal, rhsLoc);
     return *this;
   }
+
+  //! enable maxloc() with the components of a tuple IndexType
+  template <typename Idx0, typename Idx1, typename... Idxs>
+  const self &maxloc(T rhsVal, Idx0 i0, Idx1 i1, Idxs... is) const
+  {
+    parent::reduce(rhsVal, IndexType(i0, i1, is...));
+    return *this;
+  }
 };
 
+//! specialization of ReduceSumArray for sycl_reduce
+//  bins are accumulated with device atomics like ReduceSum
+template <typename T, size_t N>
+class ReduceSumArray<sycl_reduce, T, N>
+{
+public:
+  using value_type = RAJA::reduce::array_value<T, N>;
+
+  ReduceSumArray() = delete;
+  ReduceSumArray(const ReduceSumArray &) = default;
+
+  //! initialize every bin to init_val
+  explicit ReduceSumArray(T init_val) : ReduceSumArray(value_type(init_val))
+  {
+  }
+
+  explicit ReduceSumArray(value_type const &init_vals)
+      : info(),
+        val(value_type(T(0)), value_type(T(0)), info),
+        initVal(init_vals),
+        finalVal(T(0))
+  {
+  }
+
+  //! add rhsVal to bin
+  const ReduceSumArray &add(size_t bin, T rhsVal) const
+  {
+#ifdef __SYCL_DEVICE_ONLY__
+    auto atm = cl::sycl::ext::oneapi::atomic_ref<T, cl::sycl::ext::oneapi::memory_order::relaxed, cl::sycl::ext::oneapi::memory_scope::device, cl::sycl::access::address_space::global_space>(val.device[0][bin]);
+    atm.fetch_add(rhsVal);
+    return *this;
+#else
+    val.device[0][bin] += rhsVal;
+    return *this;
+#endif
+  }
+
+  //! map result values back to host if not done already; return all bins
+  value_type get()
+  {
+    if (!info.isMapped) {
+      val.deviceToHost(info);
+
+      for (int i = 0; i < sycl::MaxNumTeams; ++i) {
+        val.value += val.host[i];
+      }
+      val.cleanup(info);
+      info.isMapped = true;
+    }
+    finalVal = initVal + val.value;
+    return finalVal;
+  }
+
+  //! get the reduced value of one bin
+  T get(size_t bin) { return get()[bin]; }
+
+  //! storage for reduction data (host ptr, device ptr, value)
+  sycl::Reduce_Data<value_type> val;
+
+private:
+  //! storage for offload information (host ID, device ID)
+  sycl::Offload_Info info;
+  value_type initVal;
+  value_type finalVal;
+};
 
 }  // namespace RAJA
 
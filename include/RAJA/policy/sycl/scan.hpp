@@ -0,0 +1,233 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_sycl_HPP
+#define RAJA_scan_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL) && defined(RAJA_ENABLE_ONEDPL)
+
+#include <iterator>
+#include <type_traits>
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+#include <oneapi/dpl/numeric>
+
+#include <CL/sycl.hpp>
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+namespace RAJA
+{
+
+namespace sycl
+{
+
+namespace detail
+{
+
+//! oneDPL device policy that runs on the queue used by sycl_res
+RAJA_INLINE
+auto make_dpl_policy(resources::Sycl& sycl_res)
+    -> decltype(::oneapi::dpl::execution::make_device_policy(
+        *getQueue(sycl_res)))
+{
+  return ::oneapi::dpl::execution::make_device_policy(*getQueue(sycl_res));
+}
+
+}  // namespace detail
+
+}  // namespace sycl
+
+namespace impl
+{
+namespace scan
+{
+
+//
+// The oneDPL algorithms return once the scan is done, so the Async
+// policies run synchronously.  The iterators must be usable on the device
+// of the queue, so pointers must point to USM allocations.
+//
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+inclusive_inplace(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    Function binary_op)
+{
+  ::oneapi::dpl::inclusive_scan(sycl::detail::make_dpl_policy(sycl_res),
+                                begin, end, begin, binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename Function,
+          typename TInit>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+exclusive_inplace(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    Function binary_op,
+    TInit init)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  ::oneapi::dpl::exclusive_scan(sycl::detail::make_dpl_policy(sycl_res),
+                                begin, end, begin, static_cast<T>(init),
+                                binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+inclusive(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  ::oneapi::dpl::inclusive_scan(sycl::detail::make_dpl_policy(sycl_res),
+                                begin, end, out, binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename T>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+exclusive(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op,
+    T init)
+{
+  ::oneapi::dpl::exclusive_scan(sycl::detail::make_dpl_policy(sycl_res),
+                                begin, end, out, init, binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief inclusive scan used by the scan based algorithms, the values of
+   begin are combined with binary_op and the results assigned to out[i]
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+inclusive_adapted(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  ::oneapi::dpl::inclusive_scan(sycl::detail::make_dpl_policy(sycl_res),
+                                begin, end, out, binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms, the values of
+   begin are combined with binary_op and the results assigned to out[i]
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+exclusive_adapted(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  using T = typename std::iterator_traits<InputIter>::value_type;
+  ::oneapi::dpl::exclusive_scan(sycl::detail::make_dpl_policy(sycl_res),
+                                begin, end, out,
+                                static_cast<T>(Function::identity()),
+                                binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL && RAJA_ENABLE_ONEDPL guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,137 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_sycl_HPP
+#define RAJA_sort_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL) && defined(RAJA_ENABLE_ONEDPL)
+
+#include <iterator>
+#include <type_traits>
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+
+#include <CL/sycl.hpp>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+#include "RAJA/policy/sycl/scan.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+//
+// The oneDPL sorts take any comparator and return once the sort is done,
+// so the Async policies run synchronously.  The iterators must be usable on
+// the device of the queue, so pointers must point to USM allocations.
+//
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+resources::EventProxy<resources::Sycl>
+unstable(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  ::oneapi::dpl::sort(sycl::detail::make_dpl_policy(sycl_res),
+                      begin, end, comp);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+resources::EventProxy<resources::Sycl>
+stable(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  ::oneapi::dpl::stable_sort(sycl::detail::make_dpl_policy(sycl_res),
+                             begin, end, comp);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename Compare>
+resources::EventProxy<resources::Sycl>
+unstable_pairs(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  ::oneapi::dpl::sort_by_key(sycl::detail::make_dpl_policy(sycl_res),
+                             keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+   keys
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename Compare>
+resources::EventProxy<resources::Sycl>
+stable_pairs(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  ::oneapi::dpl::stable_sort_by_key(sycl::detail::make_dpl_policy(sycl_res),
+                                    keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL && RAJA_ENABLE_ONEDPL guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,53 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Header file for SYCL synchronize method.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_synchronize_sycl_HPP
+#define RAJA_synchronize_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+
+namespace RAJA
+{
+
+namespace policy
+{
+
+namespace sycl
+{
+
+/*!
+ * \brief Wait for the work on the SYCL queue used by RAJA.
+ */
+RAJA_INLINE
+void synchronize_impl(const sycl_synchronize&)
+{
+  camp::resources::Sycl res = camp::resources::Sycl::get_default();
+  ::RAJA::sycl::detail::getQueue(res)->wait();
+}
+
+
+}  // end of namespace sycl
+}  // namespace policy
+}  // end of namespace RAJA
+
+#endif  // defined(RAJA_ENABLE_SYCL)
+
+#endif  // RAJA_synchronize_sycl_HPP
@@ -0,0 +1,481 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing user interface for RAJA::Teams::sycl
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_sycl_HPP
+#define RAJA_pattern_teams_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <CL/sycl.hpp>
+#include <type_traits>
+
+#include "RAJA/internal/fault_tolerance.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+/*!
+ * nd_range of a launch. The x extents of the teams and threads are SYCL
+ * dimension 2, which varies fastest in the linear id of a work-item, so
+ * sub-groups are made of consecutive x threads as warps are on CUDA.
+ */
+RAJA_INLINE
+cl::sycl::nd_range<3> sycl_launch_nd_range(Grid const &grid)
+{
+  const cl::sycl::range<3> local(grid.threads.value[2],
+                                 grid.threads.value[1],
+                                 grid.threads.value[0]);
+  const cl::sycl::range<3> global(grid.teams.value[2] * local[0],
+                                  grid.teams.value[1] * local[1],
+                                  grid.teams.value[0] * local[2]);
+  return cl::sycl::nd_range<3>(global, local);
+}
+
+//! Queue of a launch on sycl_res, or the queue set for RAJA
+RAJA_INLINE
+cl::sycl::queue *sycl_launch_queue(resources::Sycl &sycl_res)
+{
+  cl::sycl::queue *q = ::RAJA::sycl::detail::getQueue();
+  if (!q) {
+    q = sycl_res.get_queue();
+  }
+  return q;
+}
+
+//! Calls a loop body that was copied to device memory
+template <typename BODY>
+struct SyclLaunchBodyPtr {
+  BODY const *body;
+
+  void operator()(LaunchContext ctx) const { (*body)(ctx); }
+};
+
+/*!
+ * Submit body as a launch on grid to q. Each work-group gets local memory
+ * for the dynamic shared memory of the grid and for teamReduce.
+ */
+template <typename BODY>
+RAJA_INLINE void sycl_launch_submit(cl::sycl::queue *q,
+                                    LaunchContext const &ctx,
+                                    BODY const &body)
+{
+  const cl::sycl::nd_range<3> range = sycl_launch_nd_range(ctx);
+  const size_t shmem = ctx.shared_mem_size;
+
+  q->submit([&](cl::sycl::handler &h) {
+    cl::sycl::accessor<char,
+                       1,
+                       cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+        local_mem(cl::sycl::range<1>(shmem + LaunchContext::team_scratch_size),
+                  h);
+
+    // the sub-group size is detail::launch_warp_size in device code
+    h.parallel_for(range,
+                   [=](cl::sycl::nd_item<3> itm)
+                       [[intel::reqd_sub_group_size(16)]] {
+                     LaunchContext team_ctx(ctx);
+                     team_ctx.itm = &itm;
+                     team_ctx.shared_mem_ptr = local_mem.get_pointer().get();
+                     team_ctx.team_scratch_ptr =
+                         team_ctx.shared_mem_ptr + shmem;
+                     body(team_ctx);
+                   });
+  });
+}
+
+template <bool async, typename BODY>
+RAJA_INLINE void sycl_launch_body(cl::sycl::queue *q,
+                                  LaunchContext const &ctx,
+                                  BODY const &body,
+                                  std::true_type)
+{
+  sycl_launch_submit(q, ctx, body);
+  if (!async) {
+    q->wait();
+  }
+}
+
+/*!
+ * Kernel body is nontrivially copyable, create space on device and copy to
+ * it. Workaround until "is_device_copyable" is supported
+ */
+template <bool async, typename BODY>
+RAJA_INLINE void sycl_launch_body(cl::sycl::queue *q,
+                                  LaunchContext const &ctx,
+                                  BODY const &body,
+                                  std::false_type)
+{
+  BODY *body_ptr =
+      static_cast<BODY *>(cl::sycl::malloc_device(sizeof(BODY), *q));
+  q->memcpy(body_ptr, &body, sizeof(BODY)).wait();
+
+  sycl_launch_submit(q, ctx, SyclLaunchBodyPtr<BODY>{body_ptr});
+  q->wait();  // Need to wait for completion to free memory
+
+  cl::sycl::free(body_ptr, *q);
+}
+
+//! Launch body_in on sycl_res
+template <bool async, typename BODY_IN>
+RAJA_INLINE void sycl_launch(resources::Sycl &sycl_res,
+                             LaunchContext const &ctx,
+                             BODY_IN &&body_in)
+{
+  using BODY = camp::decay<BODY_IN>;
+
+  // Only launch kernel if we have something to iterate over
+  for (int d = 0; d < 3; ++d) {
+    if (ctx.teams.value[d] <= 0 || ctx.threads.value[d] <= 0) {
+      return;
+    }
+  }
+
+  cl::sycl::queue *q = sycl_launch_queue(sycl_res);
+
+  RAJA_FT_BEGIN;
+
+  sycl_launch_body<async>(q,
+                          ctx,
+                          static_cast<BODY const &>(body_in),
+                          std::is_trivially_copyable<BODY>{});
+
+  RAJA_FT_END;
+}
+
+}  // namespace detail
+
+template <bool async, int num_threads>
+struct LaunchExecute<RAJA::expt::sycl_launch_t<async, num_threads>> {
+
+  template <typename BODY_IN>
+  static void exec(LaunchContext const &ctx, BODY_IN &&body_in)
+  {
+    resources::Sycl sycl_res = resources::Sycl::get_default();
+    detail::sycl_launch<async>(sycl_res, ctx, std::forward<BODY_IN>(body_in));
+  }
+
+  template <typename BODY_IN>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY_IN &&body_in)
+  {
+    /*Get the concrete resource */
+    resources::Sycl sycl_res = res.get<RAJA::resources::Sycl>();
+    detail::sycl_launch<async>(sycl_res, ctx, std::forward<BODY_IN>(body_in));
+    return resources::EventProxy<resources::Resource>(res);
+  }
+};
+
+namespace detail
+{
+
+//! Index and stride of a SYCL work-group or local loop in dimension DIM
+template <bool GROUP, int DIM>
+struct SyclLaunchIndex {
+  static int index(LaunchContext const &ctx)
+  {
+    return GROUP ? static_cast<int>(ctx.itm->get_group(DIM))
+                 : static_cast<int>(ctx.itm->get_local_id(DIM));
+  }
+
+  static int stride(LaunchContext const &ctx)
+  {
+    return GROUP ? static_cast<int>(ctx.itm->get_group_range(DIM))
+                 : static_cast<int>(ctx.itm->get_local_range(DIM));
+  }
+};
+
+template <typename INDEX, typename SEGMENT, typename BODY>
+RAJA_INLINE void sycl_launch_loop(LaunchContext const &ctx,
+                                  SEGMENT const &segment,
+                                  BODY const &body,
+                                  bool direct)
+{
+  const int len = segment.end() - segment.begin();
+  const int stride = direct ? len : INDEX::stride(ctx);
+  for (int i = INDEX::index(ctx); i < len; i += stride) {
+    body(*(segment.begin() + i));
+  }
+}
+
+template <typename INDEX, typename SEGMENT, typename BODY>
+RAJA_INLINE void sycl_launch_loop_icount(LaunchContext const &ctx,
+                                         SEGMENT const &segment,
+                                         BODY const &body,
+                                         bool direct)
+{
+  const int len = segment.end() - segment.begin();
+  const int stride = direct ? len : INDEX::stride(ctx);
+  for (int i = INDEX::index(ctx); i < len; i += stride) {
+    body(*(segment.begin() + i), i);
+  }
+}
+
+template <typename INDEX, typename TILE_T, typename SEGMENT, typename BODY>
+RAJA_INLINE void sycl_launch_tile(LaunchContext const &ctx,
+                                  TILE_T tile_size,
+                                  SEGMENT const &segment,
+                                  BODY const &body,
+                                  bool direct)
+{
+  const int len = segment.end() - segment.begin();
+  const int stride = direct ? len : INDEX::stride(ctx) * tile_size;
+  for (int tx = INDEX::index(ctx) * tile_size; tx < len; tx += stride) {
+    body(segment.slice(tx, tile_size));
+  }
+}
+
+template <typename INDEX, typename TILE_T, typename SEGMENT, typename BODY>
+RAJA_INLINE void sycl_launch_tile_icount(LaunchContext const &ctx,
+                                         TILE_T tile_size,
+                                         SEGMENT const &segment,
+                                         BODY const &body,
+                                         bool direct)
+{
+  const int len = segment.end() - segment.begin();
+  const int stride = direct ? len : INDEX::stride(ctx) * tile_size;
+  for (int tx = INDEX::index(ctx) * tile_size; tx < len; tx += stride) {
+    body(segment.slice(tx, tile_size), tx / tile_size);
+  }
+}
+
+}  // namespace detail
+
+/*
+  SYCL local (thread) and group (team) loops. The loop policies are the
+  ones RAJA::kernel uses, and dimension 2 is the x dimension of Teams and
+  Threads.
+*/
+template <typename SEGMENT, int DIM>
+struct LoopExecute<sycl_local_012_loop<DIM>, SEGMENT> {
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_loop<detail::SyclLaunchIndex<false, DIM>>(
+        ctx, segment, body, false);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct LoopExecute<sycl_local_012_direct<DIM>, SEGMENT> {
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_loop<detail::SyclLaunchIndex<false, DIM>>(
+        ctx, segment, body, true);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct LoopExecute<sycl_group_012_loop<DIM>, SEGMENT> {
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_loop<detail::SyclLaunchIndex<true, DIM>>(
+        ctx, segment, body, false);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct LoopExecute<sycl_group_012_direct<DIM>, SEGMENT> {
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_loop<detail::SyclLaunchIndex<true, DIM>>(
+        ctx, segment, body, true);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct LoopICountExecute<sycl_local_012_loop<DIM>, SEGMENT> {
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_loop_icount<detail::SyclLaunchIndex<false, DIM>>(
+        ctx, segment, body, false);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct LoopICountExecute<sycl_local_012_direct<DIM>, SEGMENT> {
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_loop_icount<detail::SyclLaunchIndex<false, DIM>>(
+        ctx, segment, body, true);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct LoopICountExecute<sycl_group_012_loop<DIM>, SEGMENT> {
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_loop_icount<detail::SyclLaunchIndex<true, DIM>>(
+        ctx, segment, body, false);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct LoopICountExecute<sycl_group_012_direct<DIM>, SEGMENT> {
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_loop_icount<detail::SyclLaunchIndex<true, DIM>>(
+        ctx, segment, body, true);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct TileExecute<sycl_local_012_loop<DIM>, SEGMENT> {
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_tile<detail::SyclLaunchIndex<false, DIM>>(
+        ctx, tile_size, segment, body, false);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct TileExecute<sycl_local_012_direct<DIM>, SEGMENT> {
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_tile<detail::SyclLaunchIndex<false, DIM>>(
+        ctx, tile_size, segment, body, true);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct TileExecute<sycl_group_012_loop<DIM>, SEGMENT> {
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_tile<detail::SyclLaunchIndex<true, DIM>>(
+        ctx, tile_size, segment, body, false);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct TileExecute<sycl_group_012_direct<DIM>, SEGMENT> {
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_tile<detail::SyclLaunchIndex<true, DIM>>(
+        ctx, tile_size, segment, body, true);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct TileICountExecute<sycl_local_012_loop<DIM>, SEGMENT> {
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_tile_icount<detail::SyclLaunchIndex<false, DIM>>(
+        ctx, tile_size, segment, body, false);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct TileICountExecute<sycl_local_012_direct<DIM>, SEGMENT> {
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_tile_icount<detail::SyclLaunchIndex<false, DIM>>(
+        ctx, tile_size, segment, body, true);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct TileICountExecute<sycl_group_012_loop<DIM>, SEGMENT> {
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_tile_icount<detail::SyclLaunchIndex<true, DIM>>(
+        ctx, tile_size, segment, body, false);
+  }
+};
+
+template <typename SEGMENT, int DIM>
+struct TileICountExecute<sycl_group_012_direct<DIM>, SEGMENT> {
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    detail::sycl_launch_tile_icount<detail::SyclLaunchIndex<true, DIM>>(
+        ctx, tile_size, segment, body, true);
+  }
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_SYCL
+
+#endif  // RAJA_pattern_teams_sycl_HPP
@@ -20,6 +20,12 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <tbb/tbb.h>
+
 #include "RAJA/policy/tbb/policy.hpp"
 
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
@@ -75,6 +81,225 @@ struct WorkRunner<
         Args...>
 { };
 
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * a range of iterations at a time by one task
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldTbbRange
+{
+  template < typename segment_in, typename body_in >
+  HoldTbbRange(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()(index_type range_begin, index_type range_end,
+                              Args... args) const
+  {
+    auto begin = std::begin(m_segment);
+    for (index_type i = range_begin; i < range_end; ++i) {
+      m_body(begin[i], args...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Runs work in a storage container out of order as the tasks of a single
+ * tbb::task_group. Loops longer than the grain size are tasks of their
+ * own that split their range in half until it is no longer than the grain
+ * size, and runs of consecutive shorter loops are put together into one
+ * task, so work-stealing balances the load across all the loops.
+ *
+ * The tasks are made by the first run and kept for the later runs of the
+ * same work group.
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::tbb_work,
+        RAJA::policy::tbb::unordered_tbb_task_group,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::tbb_work;
+  using order_policy = RAJA::policy::tbb::unordered_tbb_task_group;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Host;
+
+  using vtable_type = Vtable<void, index_type, index_type, Args...>;
+
+  //! Ranges of the grain size made for each thread when the loops are long
+  static constexpr std::ptrdiff_t ranges_per_thread = 4;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner &&) = default;
+  WorkRunner& operator=(WorkRunner &&) = default;
+
+  // The type  that will hold the segment and loop body in work storage
+  template < typename ITERABLE, typename LOOP_BODY >
+  using holder_type = HoldTbbRange<ITERABLE, LOOP_BODY, index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host by the tasks
+  using vtable_exec_policy = exec_policy;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type<ITERABLE, LOOP_BODY>;
+
+    const std::ptrdiff_t len = std::distance(std::begin(iter), std::end(iter));
+
+    // Only enqueue if we have something to iterate over
+    if (len > 0) {
+
+      m_lengths.push_back(len);
+
+      storage.template emplace<holder>(
+          get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type, Args... args) const
+  {
+    per_run_storage run_storage{};
+
+    if (m_tasks.empty() && !m_lengths.empty()) {
+      build_tasks();
+    }
+
+    using value_type = typename WorkContainer::value_type;
+
+    auto begin = std::begin(storage);
+    const std::ptrdiff_t grain_size = m_grain_size;
+
+    ::tbb::task_group group;
+    for (task_type const& task : m_tasks) {
+      group.run([=, &group]() {
+        if (task.loop_end - task.loop_begin == 1) {
+          run_range<value_type>(group, begin, grain_size,
+                    task.loop_begin, 0, m_lengths[task.loop_begin], args...);
+        } else {
+          for (std::ptrdiff_t loop = task.loop_begin; loop < task.loop_end; ++loop) {
+            call<value_type>(begin, loop, 0, m_lengths[loop], args...);
+          }
+        }
+      });
+    }
+    group.wait();
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_lengths.clear();
+    m_tasks.clear();
+  }
+
+private:
+  // a single loop, or a run of consecutive short loops
+  struct task_type
+  {
+    std::ptrdiff_t loop_begin;
+    std::ptrdiff_t loop_end;
+  };
+
+  std::vector<std::ptrdiff_t> m_lengths;
+
+  // tasks of all the loops and the grain size, set by the first run
+  mutable std::vector<task_type> m_tasks;
+  mutable std::ptrdiff_t m_grain_size = 1;
+
+  template < typename value_type, typename Iterator >
+  static void call(Iterator begin, std::ptrdiff_t loop,
+                   std::ptrdiff_t range_begin, std::ptrdiff_t range_end,
+                   Args... args)
+  {
+    value_type::call(&begin[loop],
+                     static_cast<index_type>(range_begin),
+                     static_cast<index_type>(range_end),
+                     args...);
+  }
+
+  // run the range of a loop, putting the upper halves into the group as
+  // new tasks until the range is no longer than the grain size
+  template < typename value_type, typename Iterator >
+  static void run_range(::tbb::task_group& group, Iterator begin,
+                        std::ptrdiff_t grain_size, std::ptrdiff_t loop,
+                        std::ptrdiff_t range_begin, std::ptrdiff_t range_end,
+                        Args... args)
+  {
+    while (range_end - range_begin > grain_size) {
+      const std::ptrdiff_t range_mid = range_begin + (range_end - range_begin) / 2;
+      group.run([=, &group]() {
+        run_range<value_type>(group, begin, grain_size, loop,
+                              range_mid, range_end, args...);
+      });
+      range_end = range_mid;
+    }
+    call<value_type>(begin, loop, range_begin, range_end, args...);
+  }
+
+  //
+  // Size the grain from the total work and the number of threads, and
+  // group the loops shorter than it into tasks of about the grain size
+  //
+  void build_tasks() const
+  {
+    const std::ptrdiff_t num_loops = static_cast<std::ptrdiff_t>(m_lengths.size());
+    std::ptrdiff_t total_iterations = 0;
+    for (std::ptrdiff_t len : m_lengths) {
+      total_iterations += len;
+    }
+    const std::ptrdiff_t num_threads = ::tbb::this_task_arena::max_concurrency();
+    m_grain_size = std::max(std::ptrdiff_t(1),
+        (total_iterations + num_threads * ranges_per_thread - 1) /
+        (num_threads * ranges_per_thread));
+
+    std::ptrdiff_t loop = 0;
+    while (loop < num_loops) {
+      if (m_lengths[loop] >= m_grain_size) {
+        m_tasks.push_back(task_type{loop, loop + 1});
+        ++loop;
+      } else {
+        const std::ptrdiff_t loop_begin = loop;
+        std::ptrdiff_t task_iterations = 0;
+        while (loop < num_loops && m_lengths[loop] < m_grain_size &&
+               task_iterations < m_grain_size) {
+          task_iterations += m_lengths[loop];
+          ++loop;
+        }
+        m_tasks.push_back(task_type{loop_begin, loop});
+      }
+    }
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
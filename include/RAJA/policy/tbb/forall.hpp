@@ -137,6 +137,52 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// TBB parallel for affinity policy implementation
+///
+
+/**
+ * @brief TBB affinity for implementation
+ *
+ * @param tbb_for_affinity tbb tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall implements a TBB parallel_for loop over the specified iterable
+ * using an affinity_partitioner kept for the loop body type, so later runs
+ * of the same loop give the same iterations to the same threads where they
+ * can, and find their data in the caches of those threads.
+ */
+
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const tbb_for_affinity&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  static ::tbb::affinity_partitioner partitioner;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  ::tbb::parallel_for(
+      brange(0, dist),
+      [=](const brange& r) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        for (auto i = r.begin(); i != r.end(); ++i)
+          body(b[i]);
+      },
+      partitioner);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace tbb
 }  // namespace policy
 
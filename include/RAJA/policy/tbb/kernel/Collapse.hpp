@@ -0,0 +1,149 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for TBB collapsed kernel loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_collapse_HPP
+#define RAJA_policy_tbb_kernel_collapse_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Collapse.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Collapse policy that runs two or three loops as one tbb::parallel_for
+ * over a blocked_range2d or blocked_range3d, so the ranges TBB splits are
+ * tiles of the loops.  The loops of a tile run in the order of the ArgList,
+ * with the last loop innermost.
+ */
+struct tbb_collapse_exec
+    : make_policy_pattern_launch_platform_t<RAJA::Policy::tbb,
+                                            RAJA::Pattern::forall,
+                                            RAJA::Launch::undefined,
+                                            RAJA::Platform::host> {
+};
+
+namespace internal
+{
+
+/////////
+// Collapsing two loops
+/////////
+
+template <camp::idx_t Arg0, camp::idx_t Arg1, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Collapse<tbb_collapse_exec,
+                                             ArgList<Arg0, Arg1>,
+                                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using diff0 = segment_diff_type<Arg0, Data>;
+    using diff1 = segment_diff_type<Arg1, Data>;
+    const diff0 l0 = segment_length<Arg0>(data);
+    const diff1 l1 = segment_length<Arg1>(data);
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+
+    using brange = ::tbb::blocked_range2d<diff0, diff1>;
+    ::tbb::parallel_for(brange(0, l0, 0, l1), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(data);
+      auto& private_data = privatizer.get_priv();
+      for (diff0 i0 = r.rows().begin(); i0 < r.rows().end(); ++i0) {
+        private_data.template assign_offset<Arg0>(i0);
+        for (diff1 i1 = r.cols().begin(); i1 < r.cols().end(); ++i1) {
+          private_data.template assign_offset<Arg1>(i1);
+          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
+        }
+      }
+    });
+  }
+};
+
+
+/////////
+// Collapsing three loops
+/////////
+
+template <camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Collapse<tbb_collapse_exec,
+                                             ArgList<Arg0, Arg1, Arg2>,
+                                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using diff0 = segment_diff_type<Arg0, Data>;
+    using diff1 = segment_diff_type<Arg1, Data>;
+    using diff2 = segment_diff_type<Arg2, Data>;
+    const diff0 l0 = segment_length<Arg0>(data);
+    const diff1 l1 = segment_length<Arg1>(data);
+    const diff2 l2 = segment_length<Arg2>(data);
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+
+    using brange = ::tbb::blocked_range3d<diff0, diff1, diff2>;
+    ::tbb::parallel_for(brange(0, l0, 0, l1, 0, l2), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(data);
+      auto& private_data = privatizer.get_priv();
+      for (diff0 i0 = r.pages().begin(); i0 < r.pages().end(); ++i0) {
+        private_data.template assign_offset<Arg0>(i0);
+        for (diff1 i1 = r.rows().begin(); i1 < r.rows().end(); ++i1) {
+          private_data.template assign_offset<Arg1>(i1);
+          for (diff2 i2 = r.cols().begin(); i2 < r.cols().end(); ++i2) {
+            private_data.template assign_offset<Arg2>(i2);
+            execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
+          }
+        }
+      }
+    });
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
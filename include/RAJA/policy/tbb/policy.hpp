@@ -60,6 +60,20 @@ struct tbb_for_static : make_policy_pattern_launch_platform_t<Policy::tbb,
 
 using tbb_for_exec = tbb_for_static<>;
 
+///
+/// Runs the loop with a tbb::affinity_partitioner kept for each loop body
+/// type, so each loop in the code replays the mapping of its iterations to
+/// threads of its last run, which reuses the caches of the threads when the
+/// loop runs every timestep over the same data.  A loop must not run
+/// concurrently with itself, as they would share the partitioner.
+///
+struct tbb_for_affinity
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 /// Index set segment iteration policies
 ///
@@ -74,6 +88,27 @@ struct tbb_work : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                         Platform::host> {
 };
 
+///
+/// Runs the loops of a WorkGroup out of order as the tasks of one
+/// tbb::task_group, splitting long loops and grouping short ones.
+///
+struct unordered_tbb_task_group
+    : make_policy_pattern_platform_t<Policy::tbb,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
+
+///
+/// Launch policy, the launch body runs on the calling thread and its loops
+/// run in parallel with the TBB loop policies
+///
+struct tbb_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -91,12 +126,19 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
 }  // namespace tbb
 }  // namespace policy
 
+using policy::tbb::tbb_for_affinity;
 using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
 using policy::tbb::tbb_reduce;
 using policy::tbb::tbb_segit;
 using policy::tbb::tbb_work;
+using policy::tbb::unordered_tbb_task_group;
+
+namespace expt
+{
+  using policy::tbb::tbb_launch_t;
+}
 
 }  // namespace RAJA
 
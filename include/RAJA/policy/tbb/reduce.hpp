@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <tuple>
+#include <type_traits>
 
 #include <tbb/tbb.h>
 
@@ -34,6 +35,7 @@
 
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
+#include "RAJA/pattern/params/reduce.hpp"
 
 #include "RAJA/policy/tbb/policy.hpp"
 
@@ -86,6 +88,22 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(tbb_reduce, detail::ReduceTBB)
 
+namespace expt
+{
+namespace detail
+{
+
+//! reduction parameters of tbb loops are lowered onto tbb_reduce reducers
+template <typename ExecPol>
+struct param_reduce_policy<
+    ExecPol,
+    typename std::enable_if<type_traits::is_tbb_policy<ExecPol>::value>::type> {
+  using type = tbb_reduce;
+};
+
+}  // namespace detail
+}  // namespace expt
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_TBB guard
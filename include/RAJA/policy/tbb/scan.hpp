@@ -216,6 +216,62 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief inclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+inclusive_adapted(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  auto adapter = detail::scan_adapter_inclusive<
+      typename std::iterator_traits<Iter>::value_type,
+      Iter,
+      OutIter,
+      BinFn>{begin, out, f, BinFn::identity()};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief exclusive scan used by the scan based algorithms, the values of
+   begin are combined with f and the results assigned to out[i]
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+exclusive_adapted(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  auto adapter = detail::scan_adapter_exclusive<
+      typename std::iterator_traits<Iter>::value_type,
+      Iter,
+      OutIter,
+      BinFn>{begin, out, f, BinFn::identity()};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -21,6 +21,7 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <climits>
 #include <functional>
 #include <iterator>
 
@@ -33,6 +34,8 @@
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/radix_sort.hpp"
+#include "RAJA/util/sort.hpp"
 
 namespace RAJA
 {
@@ -129,6 +132,41 @@ void tbb_sort(Sorter sorter,
   }
 }
 
+/*!
+        \brief radix sort of n keys, and values if V is not radix_keys_only,
+               in the order of Compare of bits [begin_bit, end_bit) of the
+               keys
+
+        Each task counts and moves the values of one block of the range.
+*/
+template <typename K, typename V, typename Compare>
+inline void tbb_radix_sort(K* keys,
+                           V* vals,
+                           RAJA::Index_type n,
+                           Compare,
+                           int begin_bit = 0,
+                           int end_bit = sizeof(K) * CHAR_BIT)
+{
+  using RAJA::Index_type;
+  constexpr bool descending =
+      std::is_same<Compare, operators::greater<K>>::value;
+
+  const Index_type num_blocks = std::max(
+      Index_type(1),
+      std::min(static_cast<Index_type>(tbb::this_task_arena::max_concurrency()),
+               n / RAJA::detail::get_min_radix_sort_iterates()));
+
+  RAJA::detail::radix_sort<descending>(
+      keys, vals, n, num_blocks, begin_bit, end_bit, [=](auto&& body) {
+        tbb::parallel_for(tbb::blocked_range<Index_type>(0, num_blocks, 1),
+                          [&](const tbb::blocked_range<Index_type>& r) {
+                            for (Index_type b = r.begin(); b < r.end(); ++b) {
+                              body(b);
+                            }
+                          });
+      });
+}
+
 } // namespace detail
 
 /*!
@@ -136,7 +174,8 @@ void tbb_sort(Sorter sorter,
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_tbb_policy<ExecPolicy>>
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort<Iter, Compare>>>
 unstable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -154,7 +193,8 @@ unstable(
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_tbb_policy<ExecPolicy>>
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort<Iter, Compare>>>
 stable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -172,7 +212,8 @@ stable(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_tbb_policy<ExecPolicy>>
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>>
 unstable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -194,7 +235,8 @@ unstable_pairs(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_tbb_policy<ExecPolicy>>
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>>
 stable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -211,6 +253,350 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief sort given range of arithmetic values in ascending or
+               descending order with a radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort<Iter, Compare>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  if (end - begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    tbb::parallel_sort(begin, end, comp);
+  } else {
+    detail::tbb_radix_sort(begin,
+                           static_cast<RAJA::detail::radix_keys_only*>(nullptr),
+                           end - begin,
+                           comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of arithmetic values in ascending or
+               descending order with a radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort<Iter, Compare>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  if (end - begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    detail::tbb_sort(detail::StableSorter{}, begin, end, comp);
+  } else {
+    detail::tbb_radix_sort(begin,
+                           static_cast<RAJA::detail::radix_keys_only*>(nullptr),
+                           end - begin,
+                           comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of pairs with arithmetic keys in ascending
+               or descending order of the keys with a radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  if (keys_end - keys_begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::tbb_sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    detail::tbb_radix_sort(keys_begin, vals_begin, keys_end - keys_begin, comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys in ascending
+               or descending order of the keys with a radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  if (keys_end - keys_begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::tbb_sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    detail::tbb_radix_sort(keys_begin, vals_begin, keys_end - keys_begin, comp);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort each segment of given range using comparison function
+
+        Each task sorts whole segments.
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  const RAJA::Index_type num_segments = (offsets_end - offsets_begin) - 1;
+  tbb::parallel_for(tbb::blocked_range<RAJA::Index_type>(0, num_segments),
+                    [=](const tbb::blocked_range<RAJA::Index_type>& r) {
+                      for (RAJA::Index_type s = r.begin(); s < r.end(); ++s) {
+                        detail::StableSorter{}(begin + offsets_begin[s],
+                                               begin + offsets_begin[s+1],
+                                               comp);
+                      }
+                    });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort each segment of given range of pairs using
+               comparison function on keys
+
+        Each task sorts whole segments.
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter,
+    ValIter vals_begin,
+    OffsetIter offsets_begin,
+    OffsetIter offsets_end,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  const RAJA::Index_type num_segments = (offsets_end - offsets_begin) - 1;
+  tbb::parallel_for(tbb::blocked_range<RAJA::Index_type>(0, num_segments),
+                    [=](const tbb::blocked_range<RAJA::Index_type>& r) {
+                      for (RAJA::Index_type s = r.begin(); s < r.end(); ++s) {
+                        detail::StableSorter{}(begin + offsets_begin[s],
+                                               begin + offsets_begin[s+1],
+                                               RAJA::compare_first<zip_ref>(comp));
+                      }
+                    });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief partially sort given range using comparison function so nth
+               is the element it would be if the range were sorted,
+               uses a sequential intro select
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+nth_element(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter nth,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::intro_select(begin, nth, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort the smallest elements of given range into [begin, middle)
+               using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+partial(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter middle,
+    Iter end,
+    Compare comp)
+{
+  RAJA::detail::intro_select(begin, middle, end, comp);
+
+  return unstable(host_res, p, begin, middle, comp);
+}
+
+/*!
+        \brief write the permutation that stably sorts given range of keys
+               using comparison function, the keys are not modified
+*/
+template <typename ExecPolicy, typename KeyIter, typename IdxIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+argsort(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    IdxIter perm_begin,
+    Compare comp)
+{
+  using I = RAJA::detail::IterVal<IdxIter>;
+  const RAJA::Index_type len = keys_end - keys_begin;
+  tbb::parallel_for(tbb::blocked_range<RAJA::Index_type>(0, len),
+                    [=](tbb::blocked_range<RAJA::Index_type> const& r) {
+                      for (RAJA::Index_type i = r.begin(); i != r.end(); ++i) {
+                        perm_begin[i] = static_cast<I>(i);
+                      }
+                    });
+
+  return stable(host_res, p, perm_begin, perm_begin + len,
+                RAJA::detail::compare_indirect(keys_begin, comp));
+}
+
+/*!
+        \brief stable sort given range using comparison function, the
+               comparison sort does not use the bit range
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort<Iter, Compare>>>
+stable_bits(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    int,
+    int,
+    Compare comp)
+{
+  return stable(host_res, p, begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range of arithmetic values in ascending or
+               descending order of bits [begin_bit, end_bit) of the values
+               with a radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort<Iter, Compare>>
+stable_bits(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    int begin_bit,
+    int end_bit,
+    Compare comp)
+{
+  if (end - begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    return stable(host_res, p, begin, end, comp);
+  }
+  detail::tbb_radix_sort(begin,
+                       static_cast<RAJA::detail::radix_keys_only*>(nullptr),
+                       end - begin,
+                       comp,
+                       begin_bit,
+                       end_bit);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+               keys, the comparison sort does not use the bit range
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>>
+stable_pairs_bits(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    int,
+    int,
+    Compare comp)
+{
+  return stable_pairs(host_res, p, keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys in
+               ascending or descending order of bits [begin_bit, end_bit) of
+               the keys with a radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>,
+                      RAJA::detail::use_radix_sort_pairs<KeyIter, ValIter, Compare>>
+stable_pairs_bits(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    int begin_bit,
+    int end_bit,
+    Compare comp)
+{
+  if (keys_end - keys_begin < RAJA::detail::get_min_radix_sort_iterates()) {
+    return stable_pairs(host_res, p, keys_begin, keys_end, vals_begin, comp);
+  }
+  detail::tbb_radix_sort(keys_begin, vals_begin, keys_end - keys_begin, comp,
+                       begin_bit, end_bit);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
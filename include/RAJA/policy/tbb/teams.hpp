@@ -0,0 +1,254 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the TBB launch and loop
+ *          implementations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_tbb_HPP
+#define RAJA_pattern_teams_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <cstddef>
+#include <type_traits>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+//
+// The loops run ::tbb::parallel_for with the partitioner of the loop
+// policy: the static partitioner with the grain size of tbb_for_static, or
+// for tbb_for_affinity an affinity_partitioner kept for each instantiation,
+// and so for each loop body type.
+//
+template <size_t GrainSize, typename Range, typename Func>
+RAJA_INLINE void tbb_loop(RAJA::tbb_for_static<GrainSize> const&,
+                          Range const& range,
+                          Func const& func)
+{
+  ::tbb::parallel_for(range, func, RAJA::tbb_static_partitioner{});
+}
+
+template <typename Range, typename Func>
+RAJA_INLINE void tbb_loop(RAJA::tbb_for_affinity const&,
+                          Range const& range,
+                          Func const& func)
+{
+  static ::tbb::affinity_partitioner partitioner;
+  ::tbb::parallel_for(range, func, partitioner);
+}
+
+template <typename POLICY>
+struct tbb_grain_size {
+  static constexpr int value = 1;
+};
+
+template <size_t GrainSize>
+struct tbb_grain_size<RAJA::tbb_for_static<GrainSize>> {
+  static constexpr int value = static_cast<int>(GrainSize);
+};
+
+template <typename POLICY, typename SEGMENT, bool ICOUNT>
+struct TbbLoopExecute {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    using brange = ::tbb::blocked_range<int>;
+    const int grain = tbb_grain_size<POLICY>::value;
+    const int len = segment.end() - segment.begin();
+
+    tbb_loop(POLICY{}, brange(0, len, grain), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+      for (int i = r.begin(); i < r.end(); ++i) {
+        call(loop_body.get_priv(), has_icount{},
+             *(segment.begin() + i), i);
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    using brange = ::tbb::blocked_range2d<int>;
+    const int grain = tbb_grain_size<POLICY>::value;
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    // rows are the outer loop over segment1, as in the other backends
+    tbb_loop(POLICY{}, brange(0, len1, grain, 0, len0, grain),
+             [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+      for (int j = r.rows().begin(); j < r.rows().end(); ++j) {
+        for (int i = r.cols().begin(); i < r.cols().end(); ++i) {
+          call(loop_body.get_priv(), has_icount{},
+               *(segment0.begin() + i), *(segment1.begin() + j), i, j);
+        }
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    using brange = ::tbb::blocked_range3d<int>;
+    const int grain = tbb_grain_size<POLICY>::value;
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    tbb_loop(POLICY{},
+             brange(0, len2, grain, 0, len1, grain, 0, len0, grain),
+             [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+      for (int k = r.pages().begin(); k < r.pages().end(); ++k) {
+        for (int j = r.rows().begin(); j < r.rows().end(); ++j) {
+          for (int i = r.cols().begin(); i < r.cols().end(); ++i) {
+            call(loop_body.get_priv(), has_icount{},
+                 *(segment0.begin() + i),
+                 *(segment1.begin() + j),
+                 *(segment2.begin() + k),
+                 i, j, k);
+          }
+        }
+      }
+    });
+  }
+
+private:
+  using has_icount = std::integral_constant<bool, ICOUNT>;
+
+  // the loop bodies of LoopICountExecute also take the loop counts
+  template <typename BODY, typename I0>
+  static RAJA_INLINE void call(BODY& body, std::false_type, I0 i0, int)
+  {
+    body(i0);
+  }
+
+  template <typename BODY, typename I0>
+  static RAJA_INLINE void call(BODY& body, std::true_type, I0 i0, int c0)
+  {
+    body(i0, c0);
+  }
+
+  template <typename BODY, typename I0, typename I1>
+  static RAJA_INLINE void call(BODY& body, std::false_type,
+                               I0 i0, I1 i1, int, int)
+  {
+    body(i0, i1);
+  }
+
+  template <typename BODY, typename I0, typename I1>
+  static RAJA_INLINE void call(BODY& body, std::true_type,
+                               I0 i0, I1 i1, int c0, int c1)
+  {
+    body(i0, i1, c0, c1);
+  }
+
+  template <typename BODY, typename I0, typename I1, typename I2>
+  static RAJA_INLINE void call(BODY& body, std::false_type,
+                               I0 i0, I1 i1, I2 i2, int, int, int)
+  {
+    body(i0, i1, i2);
+  }
+
+  template <typename BODY, typename I0, typename I1, typename I2>
+  static RAJA_INLINE void call(BODY& body, std::true_type,
+                               I0 i0, I1 i1, I2 i2, int c0, int c1, int c2)
+  {
+    body(i0, i1, i2, c0, c1, c2);
+  }
+};
+
+}  // namespace detail
+
+
+template <>
+struct LaunchExecute<RAJA::expt::tbb_launch_t> {
+
+
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    body(ctx);
+  }
+
+  template <typename BODY>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
+  {
+    body(ctx);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+
+template <size_t GrainSize, typename SEGMENT>
+struct LoopExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbLoopExecute<tbb_for_static<GrainSize>, SEGMENT, false> {
+};
+
+template <size_t GrainSize, typename SEGMENT>
+struct LoopICountExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TbbLoopExecute<tbb_for_static<GrainSize>, SEGMENT, true> {
+};
+
+template <typename SEGMENT>
+struct LoopExecute<tbb_for_affinity, SEGMENT>
+    : detail::TbbLoopExecute<tbb_for_affinity, SEGMENT, false> {
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<tbb_for_affinity, SEGMENT>
+    : detail::TbbLoopExecute<tbb_for_affinity, SEGMENT, true> {
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
@@ -22,5 +22,6 @@
 
 #include "RAJA/policy/tensor/arch_impl.hpp"
 #include "RAJA/policy/tensor/policy.hpp"
+#include "RAJA/policy/tensor/dispatch.hpp"
 
 #endif  // closing endif for header file include guard
@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/util/half.hpp"
+
 namespace RAJA
 {
 
@@ -62,6 +64,18 @@ struct avx512_register {};
 #endif
 
 
+// AMX tiles are only used for matrix products, everything else runs on the
+// AVX512 registers, so AMX is never the default register
+#if defined(__AVX512F__) && defined(__AMX_TILE__) && defined(__AMX_BF16__)
+#define RAJA_TENSOR_ARCH_AMX
+
+/*!
+ * An AVX512 register whose bfloat16 matrix products run on AMX tiles
+ */
+struct amx_register {};
+#endif
+
+
 #ifdef __AVX2__
 struct avx2_register {};
 
@@ -80,6 +94,36 @@ struct avx_register {};
 #endif
 
 
+// SVE registers need a vector length fixed at compile time with
+// -msve-vector-bits, otherwise they can not be class members
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && \
+    (__ARM_FEATURE_SVE_BITS > 0)
+#define RAJA_TENSOR_ARCH_SVE
+
+/*!
+ * An ARM SVE vector register, with predicated partial operations
+ */
+struct sve_register {};
+
+#ifndef RAJA_TENSOR_REGISTER_TYPE
+#define RAJA_TENSOR_REGISTER_TYPE RAJA::expt::sve_register
+#endif
+#endif
+
+
+#ifdef __ARM_NEON
+
+/*!
+ * An ARM NEON 128-bit vector register
+ */
+struct neon_register {};
+
+#ifndef RAJA_TENSOR_REGISTER_TYPE
+#define RAJA_TENSOR_REGISTER_TYPE RAJA::expt::neon_register
+#endif
+#endif
+
+
 #ifdef RAJA_ENABLE_CUDA
 
 /*!
@@ -87,6 +131,12 @@ struct avx_register {};
  */
 struct cuda_warp_register {};
 
+/*!
+ * A CUDA warp distributed register whose matrices are kept in mma.sync
+ * fragments, so matrix products use the tensor cores
+ */
+struct cuda_mma_register {};
+
 #endif
 
 
@@ -98,6 +148,12 @@ struct cuda_warp_register {};
  */
 struct hip_wave_register {};
 
+/*!
+ * A HIP wavefront distributed register whose matrices are kept in MFMA
+ * fragments, so matrix products use the matrix cores
+ */
+struct hip_mfma_register {};
+
 #endif
 
 // The scalar register is always supported (doesn't require any SIMD/SIMT)
@@ -126,6 +182,10 @@ struct scalar_register {};
 #include "RAJA/policy/tensor/arch/avx512/traits.hpp"
 #endif
 
+#ifdef RAJA_TENSOR_ARCH_AMX
+#include "RAJA/policy/tensor/arch/amx/traits.hpp"
+#endif
+
 
 #ifdef __AVX2__
 #include "RAJA/policy/tensor/arch/avx2/traits.hpp"
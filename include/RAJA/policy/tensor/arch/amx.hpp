@@ -0,0 +1,30 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing tensor abstractions for AMX
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifdef RAJA_TENSOR_ARCH_AMX
+
+#ifndef RAJA_policy_tensor_arch_amx_HPP
+#define RAJA_policy_tensor_arch_amx_HPP
+
+#include<RAJA/policy/tensor/arch/amx/traits.hpp>
+#include<RAJA/policy/tensor/arch/amx/amx_tile_config.hpp>
+#include<RAJA/policy/tensor/arch/amx/amx_bfloat16.hpp>
+
+
+#endif
+
+#endif // RAJA_TENSOR_ARCH_AMX
@@ -0,0 +1,207 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining bfloat16 amx_register registers, and
+ *          the matrix products that run on AMX tiles.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifdef RAJA_TENSOR_ARCH_AMX
+
+#ifndef RAJA_policy_tensor_arch_amx_bfloat16_HPP
+#define RAJA_policy_tensor_arch_amx_bfloat16_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/half.hpp"
+#include "RAJA/pattern/tensor/internal/MatrixMatrixMultiply.hpp"
+#include "RAJA/policy/tensor/arch/amx/amx_tile_config.hpp"
+
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * Sixteen bfloat16 elements in float lanes, the AVX512 bfloat16 register.
+   *
+   * Everything but matrix products is done on AVX512; results of its
+   * operations convert back.
+   */
+  template<>
+  class Register<bfloat16_t, amx_register> :
+    public Register<bfloat16_t, avx512_register>
+  {
+    public:
+      using base_type = Register<bfloat16_t, avx512_register>;
+      using base_type::base_type;
+
+      RAJA_INLINE
+      Register(base_type const &c) : base_type(c) {}
+  };
+
+} // namespace expt
+
+
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Runs C += A * B on AMX for bfloat16 matrices whose registers are the
+   * consecutive 16 element segments of row-major MxK, KxN and MxN matrices.
+   *
+   * The operands are rounded to bfloat16 when they are spilled to the tile
+   * buffers; the accumulator stays in float, as it is in the registers.
+   */
+  template<camp::idx_t M, camp::idx_t K, camp::idx_t N, typename LMAT, typename RMAT, typename CMAT>
+  RAJA_INLINE
+  void amx_bf16_multiply_accumulate(LMAT const &A, RMAT const &B, CMAT &C)
+  {
+    AmxBf16Product<M, K, N> prod;
+
+    for(camp::idx_t r = 0;r < LMAT::s_num_registers;++ r){
+      A.get_register(r).store_packed(
+          reinterpret_cast<RAJA::expt::bfloat16_t *>(prod.a_segment(16*r)));
+    }
+    for(camp::idx_t r = 0;r < RMAT::s_num_registers;++ r){
+      B.get_register(r).store_packed(
+          reinterpret_cast<RAJA::expt::bfloat16_t *>(prod.b_segment(16*r)));
+    }
+    for(camp::idx_t r = 0;r < CMAT::s_num_registers;++ r){
+      C.get_register(r).get_wide().store_packed(prod.c_segment(16*r));
+    }
+
+    prod.multiply_accumulate();
+
+    for(camp::idx_t r = 0;r < CMAT::s_num_registers;++ r){
+      C.get_register(r).get_wide().load_packed(prod.c_segment(16*r));
+    }
+  }
+
+
+  /**
+   *
+   * Row-Major * Row-Major ==> Row-Major on AMX tiles
+   *
+   */
+  template<camp::idx_t N_SIZE, camp::idx_t M_SIZE, camp::idx_t M2_SIZE, camp::idx_t O_SIZE>
+  struct MatrixMatrixMultiplyHelper<
+  RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                   RAJA::expt::bfloat16_t,
+                   RAJA::expt::RowMajorLayout,
+                   camp::idx_seq<N_SIZE, M_SIZE>>,
+                   RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                    RAJA::expt::bfloat16_t,
+                    RAJA::expt::RowMajorLayout,
+                    camp::idx_seq<M2_SIZE, O_SIZE>> >
+    {
+
+      static_assert(M_SIZE == M2_SIZE, "Matrices are not compatible for multiplication");
+
+      using left_type = RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                                       RAJA::expt::bfloat16_t,
+                                       RAJA::expt::RowMajorLayout,
+                                       camp::idx_seq<N_SIZE, M_SIZE>>;
+
+      using right_type = RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                                        RAJA::expt::bfloat16_t,
+                                        RAJA::expt::RowMajorLayout,
+                                        camp::idx_seq<M_SIZE, O_SIZE>> ;
+
+      using result_type = RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                                         RAJA::expt::bfloat16_t,
+                                         RAJA::expt::RowMajorLayout,
+                                         camp::idx_seq<N_SIZE, O_SIZE>> ;
+
+      RAJA_INLINE
+      static
+      void multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
+      {
+        RAJA_TENSOR_STATS_INC(num_matrix_mm_multacc_row_row);
+        amx_bf16_multiply_accumulate<N_SIZE, M_SIZE, O_SIZE>(A, B, C);
+      }
+
+      RAJA_INLINE
+      static
+      void multiply(left_type const &A, right_type const &B, result_type &C){
+        C = result_type(0);
+        multiply_accumulate(A, B, C);
+      }
+  };
+
+
+  /**
+   *
+   * Column-Major * Column-Major ==> Column-Major on AMX tiles
+   *
+   * Column-major memory is the row-major transpose, so this computes
+   * C^T += B^T * A^T with the row-major product.
+   *
+   */
+  template<camp::idx_t N_SIZE, camp::idx_t M_SIZE, camp::idx_t M2_SIZE, camp::idx_t O_SIZE>
+  struct MatrixMatrixMultiplyHelper<
+  RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                   RAJA::expt::bfloat16_t,
+                   RAJA::expt::ColMajorLayout,
+                   camp::idx_seq<N_SIZE, M_SIZE>>,
+                   RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                    RAJA::expt::bfloat16_t,
+                    RAJA::expt::ColMajorLayout,
+                    camp::idx_seq<M2_SIZE, O_SIZE>> >
+    {
+
+      static_assert(M_SIZE == M2_SIZE, "Matrices are not compatible for multiplication");
+
+      using left_type = RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                                       RAJA::expt::bfloat16_t,
+                                       RAJA::expt::ColMajorLayout,
+                                       camp::idx_seq<N_SIZE, M_SIZE>>;
+
+      using right_type = RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                                        RAJA::expt::bfloat16_t,
+                                        RAJA::expt::ColMajorLayout,
+                                        camp::idx_seq<M_SIZE, O_SIZE>> ;
+
+      using result_type = RAJA::expt::TensorRegister<RAJA::expt::amx_register,
+                                         RAJA::expt::bfloat16_t,
+                                         RAJA::expt::ColMajorLayout,
+                                         camp::idx_seq<N_SIZE, O_SIZE>> ;
+
+      RAJA_INLINE
+      static
+      void multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
+      {
+        RAJA_TENSOR_STATS_INC(num_matrix_mm_multacc_col_col);
+        amx_bf16_multiply_accumulate<O_SIZE, M_SIZE, N_SIZE>(B, A, C);
+      }
+
+      RAJA_INLINE
+      static
+      void multiply(left_type const &A, right_type const &B, result_type &C){
+        C = result_type(0);
+        multiply_accumulate(A, B, C);
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+
+} // namespace RAJA
+
+
+#endif // Guard
+
+#endif // RAJA_TENSOR_ARCH_AMX
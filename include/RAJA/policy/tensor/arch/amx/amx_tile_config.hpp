@@ -0,0 +1,273 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the AMX tile configuration and the
+ *          bfloat16 tile product used by amx_register matrices.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifdef RAJA_TENSOR_ARCH_AMX
+
+#ifndef RAJA_policy_tensor_arch_amx_tile_config_HPP
+#define RAJA_policy_tensor_arch_amx_tile_config_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Include SIMD intrinsics header file
+#include <immintrin.h>
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * The 64 byte operand of ldtilecfg
+   */
+  struct alignas(64) AmxTileConfig
+  {
+      uint8_t palette_id;
+      uint8_t start_row;
+      uint8_t reserved[14];
+      uint16_t colsb[16];
+      uint8_t rows[16];
+  };
+
+  // tmm0 holds the float accumulator, tmm1 and tmm2 the bfloat16 operands
+  static constexpr camp::idx_t s_amx_tile_rows = 16;
+  static constexpr camp::idx_t s_amx_tile_bytes = 64;
+
+  /*!
+   * Whether the calling thread has loaded the RAJA tile configuration
+   */
+  RAJA_INLINE
+  bool &amx_tiles_configured()
+  {
+    static thread_local bool configured = false;
+    return configured;
+  }
+
+  /*!
+   * Asks the kernel for the AMX tile data state, once per process.
+   *
+   * Linux does not let a process use the tiles until it has requested them.
+   */
+  RAJA_INLINE
+  void amx_request_tile_data()
+  {
+#if defined(__linux__)
+    static const bool granted =
+        syscall(SYS_arch_prctl, 0x1023 /* ARCH_REQ_XCOMP_PERM */,
+                18 /* XFEATURE_XTILEDATA */) == 0;
+    if(!granted){
+      RAJA_ABORT_OR_THROW("RAJA: AMX tile data was not granted by the kernel");
+    }
+#endif
+  }
+
+  /*!
+   * Loads the tile configuration for the calling thread.
+   *
+   * All three tiles are configured at full size, 16 rows of 64 bytes, so a
+   * single configuration serves every matrix shape.
+   */
+  RAJA_INLINE
+  void amx_load_tile_config()
+  {
+    amx_request_tile_data();
+
+    AmxTileConfig cfg{};
+    cfg.palette_id = 1;
+    for(int t = 0;t < 3;++ t){
+      cfg.rows[t] = s_amx_tile_rows;
+      cfg.colsb[t] = s_amx_tile_bytes;
+    }
+    _tile_loadconfig(&cfg);
+
+    amx_tiles_configured() = true;
+  }
+
+  /*!
+   * Loads the tile configuration the first time a thread multiplies, so a
+   * kernel pays for ldtilecfg once and not once per product.
+   */
+  RAJA_INLINE
+  void amx_ensure_tile_config()
+  {
+    if(!amx_tiles_configured()){
+      amx_load_tile_config();
+    }
+  }
+
+  /*!
+   * Row-major operand buffers of one bfloat16 product,
+   * C(M x N) += A(M x K) * B(K x N).
+   *
+   * A is padded with zeros to a multiple of 32 columns and B is stored in
+   * the pair-interleaved (VNNI) layout that tdpbf16ps reads, with zero rows
+   * for the padding.
+   */
+  template<camp::idx_t M, camp::idx_t K, camp::idx_t N>
+  struct AmxBf16Product
+  {
+      static_assert(M % 16 == 0 && K % 16 == 0 && N % 16 == 0,
+          "AMX matrix products need dimensions that are multiples of 16");
+
+      static constexpr camp::idx_t s_k_pad = ((K + 31) / 32) * 32;
+
+      alignas(64) uint16_t a[M * s_k_pad];
+      alignas(64) uint16_t b[(s_k_pad / 2) * (2 * N)];
+      alignas(64) uint16_t b_rows[K * N];
+      alignas(64) float c[M * N];
+
+      RAJA_INLINE
+      AmxBf16Product()
+      {
+        // only the padding needs clearing, the rest is overwritten
+        for(camp::idx_t i = 0;i < M;++ i){
+          for(camp::idx_t k = K;k < s_k_pad;++ k){
+            a[i*s_k_pad + k] = 0;
+          }
+        }
+        for(camp::idx_t e = (K / 2) * (2 * N);e < (s_k_pad / 2) * (2 * N);++ e){
+          b[e] = 0;
+        }
+      }
+
+      //! Start of the 16 A elements at row-major offset e of an MxK matrix
+      RAJA_INLINE
+      uint16_t *a_segment(camp::idx_t e)
+      {
+        return a + (e / K) * s_k_pad + e % K;
+      }
+
+      //! Start of the 16 B elements at row-major offset e of a KxN matrix
+      RAJA_INLINE
+      uint16_t *b_segment(camp::idx_t e)
+      {
+        return b_rows + e;
+      }
+
+      //! Start of the 16 C elements at row-major offset e of an MxN matrix
+      RAJA_INLINE
+      float *c_segment(camp::idx_t e)
+      {
+        return c + e;
+      }
+
+      /*!
+       * Interleaves rows 2p and 2p+1 of B, so each 32-bit element of a VNNI
+       * row holds B(2p, n) in its low half and B(2p+1, n) in its high half.
+       */
+      RAJA_INLINE
+      void pack_b()
+      {
+        for(camp::idx_t p = 0;p < K / 2;++ p){
+          for(camp::idx_t j = 0;j < N;j += 16){
+            __m256i r0 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(b_rows + (2*p)*N + j));
+            __m256i r1 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(b_rows + (2*p+1)*N + j));
+            __m256i lo = _mm256_unpacklo_epi16(r0, r1);
+            __m256i hi = _mm256_unpackhi_epi16(r0, r1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(b + p*(2*N) + 2*j),
+                                _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(b + p*(2*N) + 2*j + 16),
+                                _mm256_permute2x128_si256(lo, hi, 0x31));
+          }
+        }
+      }
+
+      /*!
+       * Accumulates A*B into c, one 16x16 tile of C at a time
+       */
+      RAJA_INLINE
+      void multiply_accumulate()
+      {
+        pack_b();
+        amx_ensure_tile_config();
+
+        for(camp::idx_t i = 0;i < M;i += 16){
+          for(camp::idx_t j = 0;j < N;j += 16){
+            _tile_loadd(0, c + i*N + j, N*sizeof(float));
+            for(camp::idx_t k = 0;k < s_k_pad;k += 32){
+              _tile_loadd(1, a + i*s_k_pad + k, s_k_pad*sizeof(uint16_t));
+              _tile_loadd(2, b + (k/2)*(2*N) + 2*j, 2*N*sizeof(uint16_t));
+              _tile_dpbf16ps(0, 1, 2);
+            }
+            _tile_stored(0, c + i*N + j, N*sizeof(float));
+          }
+        }
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+
+
+namespace expt
+{
+
+  /*!
+   * Keeps the AMX tiles configured for the lifetime of the scope.
+   *
+   * amx_register products configure the tiles lazily on first use, and keep
+   * them configured for the rest of the thread. Placing one of these around
+   * a kernel instead loads the configuration up front and releases the tile
+   * state at the end, which is needed before other code that uses its own
+   * tile configuration runs on that thread.
+   */
+  class amx_tile_scope
+  {
+    public:
+      RAJA_INLINE
+      amx_tile_scope() : m_owner(!internal::expt::amx_tiles_configured())
+      {
+        if(m_owner){
+          internal::expt::amx_load_tile_config();
+        }
+      }
+
+      RAJA_INLINE
+      ~amx_tile_scope()
+      {
+        if(m_owner){
+          _tile_release();
+          internal::expt::amx_tiles_configured() = false;
+        }
+      }
+
+      amx_tile_scope(amx_tile_scope const &) = delete;
+      amx_tile_scope &operator=(amx_tile_scope const &) = delete;
+
+    private:
+      bool m_owner;
+  };
+
+}   // namespace expt
+
+} // namespace RAJA
+
+
+#endif // Guard
+
+#endif // RAJA_TENSOR_ARCH_AMX
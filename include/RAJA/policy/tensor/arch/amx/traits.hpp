@@ -0,0 +1,43 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA AMX register traits.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifdef RAJA_TENSOR_ARCH_AMX
+
+#ifndef RAJA_policy_tensor_arch_amx_traits_HPP
+#define RAJA_policy_tensor_arch_amx_traits_HPP
+
+namespace RAJA {
+namespace internal {
+namespace expt {
+
+  // bfloat16 elements are computed in the float lanes of an AVX512 register
+  template<>
+  struct RegisterTraits<RAJA::expt::amx_register, RAJA::expt::bfloat16_t>{
+      using element_type = RAJA::expt::bfloat16_t;
+      using register_policy = RAJA::expt::amx_register;
+      static constexpr camp::idx_t s_num_bits = 512;
+      static constexpr camp::idx_t s_num_elem = 16;
+      using int_element_type = int32_t;
+  };
+
+} // namespace internal
+} // namespace expt
+} // namespace RAJA
+
+#endif // guard
+
+#endif // RAJA_TENSOR_ARCH_AMX
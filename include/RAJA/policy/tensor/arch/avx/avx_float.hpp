@@ -296,6 +296,24 @@ namespace expt
             ));
       }
 
+      /*!
+       * @brief Square root of each element
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const {
+        return self_type(_mm256_sqrt_ps(m_value));
+      }
+
+      /*!
+       * @brief Rounds each element to the nearest integer, ties to even
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type round() const {
+        return self_type(_mm256_round_ps(m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      }
+
 
       /*!
        * @brief Sum the elements of this vector
@@ -61,6 +61,14 @@ namespace expt
             N >= 1 ? -1 : 0);
       }
 
+      RAJA_INLINE
+      __m256i createMask(mask_type const &mask) const {
+        // Expand the mask bits to lanes
+        __m256i lanes = _mm256_set_epi64x(8, 4, 2, 1);
+        __m256i bits = _mm256_and_si256(_mm256_set1_epi64x(mask.bits()), lanes);
+        return _mm256_cmpeq_epi64(bits, lanes);
+      }
+
       RAJA_INLINE
       __m256i createStridedOffsets(camp::idx_t stride) const {
         // Generate a strided offset list
@@ -137,9 +145,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &load_packed(element_type const *ptr){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_packed ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_packed);
         m_value = _mm256_loadu_pd(ptr);
         return *this;
       }
@@ -151,9 +157,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_packed_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_packed_n);
         m_value = _mm256_maskload_pd(ptr, createMask(N));
         return *this;
       }
@@ -164,9 +168,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &load_strided(element_type const *ptr, camp::idx_t stride){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided);
         m_value = _mm256_i64gather_pd(ptr,
                                       createStridedOffsets(stride),
                                       sizeof(element_type));
@@ -181,9 +183,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &load_strided_n(element_type const *ptr, camp::idx_t stride, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
         m_value = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
                                       ptr,
                                       createStridedOffsets(stride),
@@ -203,9 +203,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &gather(element_type const *ptr, int_vector_type offsets){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
         m_value = _mm256_i64gather_pd(ptr,
                                       offsets.get_register(),
                                       sizeof(element_type));
@@ -223,9 +221,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
         m_value = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
                                       ptr,
                                       offsets.get_register(),
@@ -241,9 +237,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type const &store_packed(element_type *ptr) const{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_packed ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_store_packed);
         _mm256_storeu_pd(ptr, m_value);
         return *this;
       }
@@ -254,9 +248,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_packed_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_store_packed_n);
         _mm256_maskstore_pd(ptr, createMask(N), m_value);
         return *this;
       }
@@ -267,9 +259,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_strided ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_store_strided);
         for(camp::idx_t i = 0;i < 4;++ i){
           ptr[i*stride] = m_value[i];
         }
@@ -283,9 +273,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_store_strided_n);
         for(camp::idx_t i = 0;i < N;++ i){
           ptr[i*stride] = m_value[i];
         }
@@ -382,6 +370,151 @@ namespace expt
             ));
       }
 
+      /*!
+       * @brief Square root of each element
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const {
+        return self_type(_mm256_sqrt_pd(m_value));
+      }
+
+      /*!
+       * @brief Rounds each element to the nearest integer, ties to even
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type round() const {
+        return self_type(_mm256_round_pd(m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_eq(self_type const &x) const {
+        return mask_type(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_EQ_OQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are not equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ne(self_type const &x) const {
+        return mask_type(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_NEQ_UQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_lt(self_type const &x) const {
+        return mask_type(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_LT_OQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_le(self_type const &x) const {
+        return mask_type(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_LE_OQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_gt(self_type const &x) const {
+        return mask_type(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_GT_OQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ge(self_type const &x) const {
+        return mask_type(_mm256_movemask_pd(_mm256_cmp_pd(m_value, x.m_value, _CMP_GE_OQ)));
+      }
+
+      /*!
+       * @brief Returns x in the lanes where mask is set, and this elsewhere
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type blend(mask_type const &mask, self_type const &x) const {
+        return self_type(_mm256_blendv_pd(m_value, x.m_value, _mm256_castsi256_pd(createMask(mask))));
+      }
+
+      /*!
+       * @brief Loads the lanes where mask is set, and zeroes the others
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_masked(element_type const *ptr, mask_type const &mask){
+        m_value = _mm256_maskload_pd(ptr, createMask(mask));
+        return *this;
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set, leaving the others untouched
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const {
+        _mm256_maskstore_pd(ptr, createMask(mask), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Multiplies each element by 2^n, where n holds integer values
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type ldexp(self_type const &n) const {
+        // n is clamped so that both halves of it are normal exponents,
+        // which still overflows to infinity and underflows to zero
+        __m256d n_clamped = _mm256_min_pd(_mm256_max_pd(n.m_value,
+            _mm256_set1_pd(-2000.0)), _mm256_set1_pd(2000.0));
+        __m128i n_int = _mm256_cvtpd_epi32(n_clamped);
+        __m128i n_1 = _mm_srai_epi32(n_int, 1);
+        __m128i n_2 = _mm_sub_epi32(n_int, n_1);
+        return self_type(_mm256_mul_pd(_mm256_mul_pd(m_value,
+            pow2(n_1)), pow2(n_2)));
+      }
+
+      /*!
+       * @brief Returns floor(log2(|x|)) of each element, for normal values
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type exponent() const {
+        // the biased exponent field, converted through the bits of 2^52
+        __m256i bits = _mm256_srli_epi64(_mm256_castpd_si256(m_value), 52);
+        bits = _mm256_and_si256(bits, _mm256_set1_epi64x(0x7ff));
+        bits = _mm256_or_si256(bits, _mm256_set1_epi64x(0x4330000000000000));
+        return self_type(_mm256_sub_pd(_mm256_castsi256_pd(bits),
+            _mm256_set1_pd(4503599627370496.0 + 1023.0)));
+      }
+
+    private:
+
+      // 2^k for k in [-1022, 1023]
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      __m256d pow2(__m128i k) {
+        __m256i biased = _mm256_cvtepi32_epi64(_mm_add_epi32(k, _mm_set1_epi32(1023)));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(biased, 52));
+      }
+
+    public:
+
 // only use FMA's if the compiler has them turned on
 #ifdef __FMA__
       RAJA_INLINE
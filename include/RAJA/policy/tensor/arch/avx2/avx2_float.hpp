@@ -65,6 +65,14 @@ namespace expt
             N >= 1 ? -1 : 0);
       }
 
+      RAJA_INLINE
+      __m256i createMask(mask_type const &mask) const {
+        // Expand the mask bits to lanes
+        __m256i lanes = _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+        __m256i bits = _mm256_and_si256(_mm256_set1_epi32(int(mask.bits())), lanes);
+        return _mm256_cmpeq_epi32(bits, lanes);
+      }
+
       RAJA_INLINE
       __m256i createStridedOffsets(camp::idx_t stride) const {
         // Generate a strided offset list
@@ -339,6 +347,149 @@ namespace expt
             ));
       }
 
+      /*!
+       * @brief Square root of each element
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const {
+        return self_type(_mm256_sqrt_ps(m_value));
+      }
+
+      /*!
+       * @brief Rounds each element to the nearest integer, ties to even
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type round() const {
+        return self_type(_mm256_round_ps(m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_eq(self_type const &x) const {
+        return mask_type(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_EQ_OQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are not equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ne(self_type const &x) const {
+        return mask_type(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_NEQ_UQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_lt(self_type const &x) const {
+        return mask_type(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_LT_OQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_le(self_type const &x) const {
+        return mask_type(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_LE_OQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_gt(self_type const &x) const {
+        return mask_type(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_GT_OQ)));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ge(self_type const &x) const {
+        return mask_type(_mm256_movemask_ps(_mm256_cmp_ps(m_value, x.m_value, _CMP_GE_OQ)));
+      }
+
+      /*!
+       * @brief Returns x in the lanes where mask is set, and this elsewhere
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type blend(mask_type const &mask, self_type const &x) const {
+        return self_type(_mm256_blendv_ps(m_value, x.m_value, _mm256_castsi256_ps(createMask(mask))));
+      }
+
+      /*!
+       * @brief Loads the lanes where mask is set, and zeroes the others
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_masked(element_type const *ptr, mask_type const &mask){
+        m_value = _mm256_maskload_ps(ptr, createMask(mask));
+        return *this;
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set, leaving the others untouched
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const {
+        _mm256_maskstore_ps(ptr, createMask(mask), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Multiplies each element by 2^n, where n holds integer values
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type ldexp(self_type const &n) const {
+        // n is clamped so that both halves of it are normal exponents,
+        // which still overflows to infinity and underflows to zero
+        __m256 n_clamped = _mm256_min_ps(_mm256_max_ps(n.m_value,
+            _mm256_set1_ps(-250.0f)), _mm256_set1_ps(250.0f));
+        __m256i n_int = _mm256_cvtps_epi32(n_clamped);
+        __m256i n_1 = _mm256_srai_epi32(n_int, 1);
+        __m256i n_2 = _mm256_sub_epi32(n_int, n_1);
+        return self_type(_mm256_mul_ps(_mm256_mul_ps(m_value,
+            pow2(n_1)), pow2(n_2)));
+      }
+
+      /*!
+       * @brief Returns floor(log2(|x|)) of each element, for normal values
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type exponent() const {
+        __m256i bits = _mm256_srli_epi32(_mm256_castps_si256(m_value), 23);
+        bits = _mm256_and_si256(bits, _mm256_set1_epi32(0xff));
+        return self_type(_mm256_sub_ps(_mm256_cvtepi32_ps(bits),
+            _mm256_set1_ps(127.0f)));
+      }
+
+    private:
+
+      // 2^k for k in [-126, 127]
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      __m256 pow2(__m256i k) {
+        __m256i biased = _mm256_add_epi32(k, _mm256_set1_epi32(127));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(biased, 23));
+      }
+
+    public:
+
 // only use FMA's if the compiler has them turned on
 #ifdef __FMA__
       RAJA_INLINE
@@ -205,9 +205,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &gather(element_type const *ptr, int_vector_type offsets){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
         m_value = _mm256_i64gather_epi64(reinterpret_cast<long long const *>(ptr),
                                       offsets.get_register(),
                                       sizeof(element_type));
@@ -225,9 +223,7 @@ namespace expt
        */
       RAJA_INLINE
       self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
-#ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
-#endif
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
         m_value = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
                                       reinterpret_cast<long long const *>(ptr),
                                       offsets.get_register(),
@@ -23,6 +23,7 @@
 #include<RAJA/policy/tensor/arch/avx512/avx512_int64.hpp>
 #include<RAJA/policy/tensor/arch/avx512/avx512_float.hpp>
 #include<RAJA/policy/tensor/arch/avx512/avx512_double.hpp>
+#include<RAJA/policy/tensor/arch/avx512/avx512_half.hpp>
 
 
 #endif // __AVX512F__
@@ -127,6 +127,16 @@ namespace expt
       Register(element_type const &c) : base_type(), m_value(_mm512_set1_ps(c)) {}
 
 
+      /*!
+       * @brief Returns underlying SIMD register.
+       */
+      RAJA_INLINE
+      constexpr
+      register_type get_register() const {
+        return m_value;
+      }
+
+
       /*!
        * @brief Load a full register from a stride-one memory location
        *
@@ -210,7 +220,7 @@ namespace expt
       RAJA_INLINE
       self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
 				// AVX512F
-				_mm512_i64scatter_ps(ptr,
+				_mm512_i32scatter_ps(ptr,
 				                     createStridedOffsets(stride),
 														 m_value,
 														 sizeof(element_type));
@@ -225,7 +235,7 @@ namespace expt
       RAJA_INLINE
       self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
 				// AVX512F
-				_mm512_mask_i64scatter_ps(ptr,
+				_mm512_mask_i32scatter_ps(ptr,
                            				createMask(N),
 				                          createStridedOffsets(stride),
 																	m_value,
@@ -233,6 +243,75 @@ namespace expt
         return *this;
       }
 
+      /*!
+       * @brief Generic gather operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather(element_type const *ptr, int_vector_type const &offsets){
+				// AVX512F
+        m_value = _mm512_i32gather_ps(offsets.get_register(),
+                                      ptr,
+                                      sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for n-length subvector.
+       *
+       * Lanes past N are zeroed, and their offsets are not dereferenced.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather_n(element_type const *ptr, int_vector_type const &offsets, camp::idx_t N){
+				// AVX512F
+        m_value = _mm512_mask_i32gather_ps(_mm512_setzero_ps(),
+                                      createMask(N),
+                                      offsets.get_register(),
+                                      ptr,
+                                      sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic scatter operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter(element_type *ptr, int_vector_type const &offsets) const {
+				// AVX512F
+				_mm512_i32scatter_ps(ptr,
+				                     offsets.get_register(),
+				                     m_value,
+				                     sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic scatter operation for n-length subvector.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter_n(element_type *ptr, int_vector_type const &offsets, camp::idx_t N) const {
+				// AVX512F
+				_mm512_mask_i32scatter_ps(ptr,
+				                          createMask(N),
+				                          offsets.get_register(),
+				                          m_value,
+				                          sizeof(element_type));
+        return *this;
+      }
+
       /*!
        * @brief Get scalar value from vector register
        * @param i Offset of scalar to get
@@ -300,6 +379,125 @@ namespace expt
         return self_type(_mm512_maskz_div_ps(createMask(N), m_value, b.m_value));
       }
 
+      /*!
+       * @brief Square root of each element
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const {
+        return self_type(_mm512_sqrt_ps(m_value));
+      }
+
+      /*!
+       * @brief Rounds each element to the nearest integer, ties to even
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type round() const {
+        return self_type(_mm512_roundscale_ps(m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_eq(self_type const &x) const {
+        return mask_type(_mm512_cmp_ps_mask(m_value, x.m_value, _CMP_EQ_OQ));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are not equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ne(self_type const &x) const {
+        return mask_type(_mm512_cmp_ps_mask(m_value, x.m_value, _CMP_NEQ_UQ));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_lt(self_type const &x) const {
+        return mask_type(_mm512_cmp_ps_mask(m_value, x.m_value, _CMP_LT_OQ));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_le(self_type const &x) const {
+        return mask_type(_mm512_cmp_ps_mask(m_value, x.m_value, _CMP_LE_OQ));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_gt(self_type const &x) const {
+        return mask_type(_mm512_cmp_ps_mask(m_value, x.m_value, _CMP_GT_OQ));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ge(self_type const &x) const {
+        return mask_type(_mm512_cmp_ps_mask(m_value, x.m_value, _CMP_GE_OQ));
+      }
+
+      /*!
+       * @brief Returns x in the lanes where mask is set, and this elsewhere
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type blend(mask_type const &mask, self_type const &x) const {
+        return self_type(_mm512_mask_blend_ps(__mmask16(mask.bits()), m_value, x.m_value));
+      }
+
+      /*!
+       * @brief Loads the lanes where mask is set, and zeroes the others
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_masked(element_type const *ptr, mask_type const &mask){
+        m_value = _mm512_maskz_loadu_ps(__mmask16(mask.bits()), ptr);
+        return *this;
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set, leaving the others untouched
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const {
+        _mm512_mask_storeu_ps(ptr, __mmask16(mask.bits()), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Multiplies each element by 2^n, where n holds integer values
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type ldexp(self_type const &n) const {
+        return self_type(_mm512_scalef_ps(m_value, n.m_value));
+      }
+
+      /*!
+       * @brief Returns floor(log2(|x|)) of each element, for normal values
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type exponent() const {
+        return self_type(_mm512_getexp_ps(m_value));
+      }
+
 // only use FMA's if the compiler has them turned on
 #ifdef __FMA__
       RAJA_INLINE
@@ -0,0 +1,190 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining AVX512 registers of half and bfloat16
+ *          elements that compute in float.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifdef __AVX512F__
+
+#ifndef RAJA_policy_vector_register_avx512_half_HPP
+#define RAJA_policy_vector_register_avx512_half_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/half.hpp"
+#include "RAJA/pattern/tensor/internal/WidenedRegister.hpp"
+
+// Include SIMD intrinsics header file
+#include <immintrin.h>
+
+
+namespace RAJA
+{
+namespace expt
+{
+  /*!
+   * Sixteen half elements, widened to one __m512 with vcvtph2ps and rounded
+   * back with vcvtps2ph.
+   */
+  template<>
+  class Register<half_t, avx512_register> :
+    public internal::expt::WidenedRegister<half_t, avx512_register>
+  {
+    public:
+      using base_type = internal::expt::WidenedRegister<half_t, avx512_register>;
+      using base_type::base_type;
+
+    private:
+      RAJA_INLINE
+      static
+      __mmask16 createMask(camp::idx_t N) {
+        return N >= 16 ? __mmask16(0xFFFF) : __mmask16((1u << N) - 1u);
+      }
+
+    public:
+
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr){
+        m_wide = wide_type(_mm512_cvtph_ps(
+            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr))));
+        return *this;
+      }
+
+      RAJA_INLINE
+      self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+        m_wide = wide_type(_mm512_cvtph_ps(
+            _mm256_maskz_loadu_epi16(createMask(N), ptr)));
+#else
+        base_type::load_packed_n(ptr, N);
+#endif
+        return *this;
+      }
+
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr) const{
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr),
+            _mm512_cvtps_ph(m_wide.get_register(),
+                            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        return *this;
+      }
+
+      RAJA_INLINE
+      self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+        _mm256_mask_storeu_epi16(ptr, createMask(N),
+            _mm512_cvtps_ph(m_wide.get_register(),
+                            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#else
+        base_type::store_packed_n(ptr, N);
+#endif
+        return *this;
+      }
+  };
+
+
+  /*!
+   * Sixteen bfloat16 elements, widened to one __m512 by shifting them into
+   * the upper half of each lane. They are rounded back with vcvtneps2bf16
+   * when AVX512-BF16 is available, which flushes denormals to zero, and with
+   * integer rounding otherwise.
+   */
+  template<>
+  class Register<bfloat16_t, avx512_register> :
+    public internal::expt::WidenedRegister<bfloat16_t, avx512_register>
+  {
+    public:
+      using base_type = internal::expt::WidenedRegister<bfloat16_t, avx512_register>;
+      using base_type::base_type;
+
+    private:
+      RAJA_INLINE
+      static
+      __mmask16 createMask(camp::idx_t N) {
+        return N >= 16 ? __mmask16(0xFFFF) : __mmask16((1u << N) - 1u);
+      }
+
+      RAJA_INLINE
+      static
+      __m512 widen(__m256i h) {
+        return _mm512_castsi512_ps(
+            _mm512_slli_epi32(_mm512_cvtepu16_epi32(h), 16));
+      }
+
+      RAJA_INLINE
+      static
+      __m256i narrow(__m512 w) {
+#ifdef __AVX512BF16__
+        return (__m256i)_mm512_cvtneps_pbh(w);
+#else
+        // round to nearest even, keeping nans quiet
+        __m512i x = _mm512_castps_si512(w);
+        __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(x, 16),
+                                       _mm512_set1_epi32(1));
+        __m512i r = _mm512_add_epi32(x, _mm512_add_epi32(lsb,
+                                       _mm512_set1_epi32(0x7fff)));
+        __mmask16 nan = _mm512_cmp_ps_mask(w, w, _CMP_UNORD_Q);
+        r = _mm512_mask_mov_epi32(r, nan,
+            _mm512_or_si512(x, _mm512_set1_epi32(0x00400000)));
+        return _mm512_cvtepi32_epi16(_mm512_srli_epi32(r, 16));
+#endif
+      }
+
+    public:
+
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr){
+        m_wide = wide_type(widen(
+            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr))));
+        return *this;
+      }
+
+      RAJA_INLINE
+      self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+        m_wide = wide_type(widen(_mm256_maskz_loadu_epi16(createMask(N), ptr)));
+#else
+        base_type::load_packed_n(ptr, N);
+#endif
+        return *this;
+      }
+
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr) const{
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr),
+                            narrow(m_wide.get_register()));
+        return *this;
+      }
+
+      RAJA_INLINE
+      self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+        _mm256_mask_storeu_epi16(ptr, createMask(N),
+                                 narrow(m_wide.get_register()));
+#else
+        base_type::store_packed_n(ptr, N);
+#endif
+        return *this;
+      }
+  };
+
+}   // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
+
+#endif //__AVX512F__
@@ -62,6 +62,25 @@ namespace expt {
       using int_element_type = int64_t;
   };
 
+  // 16-bit elements are computed in float lanes
+  template<>
+  struct RegisterTraits<RAJA::expt::avx512_register, RAJA::expt::half_t>{
+      using element_type = RAJA::expt::half_t;
+      using register_policy = RAJA::expt::avx512_register;
+      static constexpr camp::idx_t s_num_bits = 512;
+      static constexpr camp::idx_t s_num_elem = 16;
+      using int_element_type = int32_t;
+  };
+
+  template<>
+  struct RegisterTraits<RAJA::expt::avx512_register, RAJA::expt::bfloat16_t>{
+      using element_type = RAJA::expt::bfloat16_t;
+      using register_policy = RAJA::expt::avx512_register;
+      static constexpr camp::idx_t s_num_bits = 512;
+      static constexpr camp::idx_t s_num_elem = 16;
+      using int_element_type = int32_t;
+  };
+
 } // namespace internal
 } // namespace expt
 } // namespace RAJA
@@ -23,6 +23,8 @@
 
 #include<RAJA/policy/tensor/arch/cuda/traits.hpp>
 #include<RAJA/policy/tensor/arch/cuda/cuda_warp.hpp>
+#include<RAJA/policy/tensor/arch/cuda/cuda_warp_half.hpp>
+#include<RAJA/policy/tensor/arch/cuda/cuda_mma.hpp>
 
 
 #endif
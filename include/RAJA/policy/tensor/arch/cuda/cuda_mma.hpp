@@ -0,0 +1,189 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing CUDA matrix registers that multiply with
+ *          warp matrix (mma.sync) instructions
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/MmaMatrixRegisterImpl.hpp"
+
+#ifdef RAJA_ENABLE_CUDA
+
+#ifndef RAJA_policy_tensor_arch_cuda_cuda_mma_register_HPP
+#define RAJA_policy_tensor_arch_cuda_cuda_mma_register_HPP
+
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * Per lane register of cuda_mma_register matrices and vectors.
+   *
+   * This is the warp register; results of its operations convert back.
+   */
+  template<typename ELEMENT_TYPE>
+  class Register<ELEMENT_TYPE, cuda_mma_register> :
+    public Register<ELEMENT_TYPE, cuda_warp_register>
+  {
+    public:
+      using base_type = Register<ELEMENT_TYPE, cuda_warp_register>;
+      using base_type::base_type;
+
+      RAJA_DEVICE
+      RAJA_INLINE
+      Register(base_type const &c) : base_type(c) {}
+  };
+
+} // namespace expt
+
+
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Fragments of the m8n8k4 double precision mma.sync, with A row-major
+   * and B column-major.
+   *
+   * Lane l holds A(l/4, l%4), B(l%4, l/4) and C(l/4, 2*(l%4) + slot).
+   */
+  template<typename T>
+  struct CudaMmaM8N8K4Traits
+  {
+      static constexpr camp::idx_t s_tile_rows = 8;
+      static constexpr camp::idx_t s_tile_cols = 8;
+      static constexpr camp::idx_t s_tile_k = 4;
+      static constexpr camp::idx_t s_num_slots = 2;
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int c_row(int lane, camp::idx_t){ return lane >> 2; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int c_col(int lane, camp::idx_t slot){ return ((lane & 3) << 1) + slot; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int c_lane(int row, int col){ return (row << 2) + (col >> 1); }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr camp::idx_t c_slot(int, int col){ return col & 1; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int a_row(int lane){ return lane >> 2; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int a_k(int lane){ return lane & 3; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int a_lane(int row, int k){ return (row << 2) + k; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int b_k(int lane){ return lane & 3; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int b_col(int lane){ return lane >> 2; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int b_lane(int k, int col){ return (col << 2) + k; }
+  };
+
+  /*!
+   * Element types without a matching instruction use the m8n8k4 fragment
+   * layout with FMAs.
+   */
+  template<typename T>
+  struct MmaTraits<RAJA::expt::cuda_mma_register, T> :
+    public CudaMmaM8N8K4Traits<T>
+  {
+      RAJA_DEVICE
+      RAJA_INLINE
+      static
+      void mma(T a, T b, T (&c)[2]){
+        mma_fma_tile<CudaMmaM8N8K4Traits<T>,
+                     RAJA::expt::Register<T, RAJA::expt::cuda_warp_register>>(a, b, c);
+      }
+  };
+
+  /*!
+   * Double precision uses the sm_80 DMMA instruction when it is available.
+   */
+  template<>
+  struct MmaTraits<RAJA::expt::cuda_mma_register, double> :
+    public CudaMmaM8N8K4Traits<double>
+  {
+      RAJA_DEVICE
+      RAJA_INLINE
+      static
+      void mma(double a, double b, double (&c)[2]){
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+        asm volatile(
+            "mma.sync.aligned.m8n8k4.row.col.f64.f64.f64.f64 "
+            "{%0, %1}, {%2}, {%3}, {%0, %1};\n"
+            : "+d"(c[0]), "+d"(c[1])
+            : "d"(a), "d"(b));
+#else
+        mma_fma_tile<CudaMmaM8N8K4Traits<double>,
+                     RAJA::expt::Register<double, RAJA::expt::cuda_warp_register>>(a, b, c);
+#endif
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+
+
+namespace expt
+{
+
+  /*!
+   * Matrix register for cuda_mma_register, held in mma.sync accumulator
+   * fragments. Dimensions must be multiples of 8.
+   */
+  template<typename T, camp::idx_t ROW_ORD, camp::idx_t COL_ORD, camp::idx_t ROW_SIZE, camp::idx_t COL_SIZE>
+  class TensorRegister<cuda_mma_register, T, TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>> :
+    public RAJA::internal::expt::MmaMatrixRegisterBase<TensorRegister<cuda_mma_register, T, TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>>
+  {
+    public:
+      using self_type = TensorRegister<cuda_mma_register, T, TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>;
+      using base_type = RAJA::internal::expt::MmaMatrixRegisterBase<self_type>;
+      using element_type = T;
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      TensorRegister() : base_type() {}
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      TensorRegister(element_type c) : base_type(c) {}
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      TensorRegister(self_type const &c) : base_type(c) {}
+
+      using base_type::operator=;
+  };
+
+}   // namespace expt
+
+} // namespace RAJA
+
+
+#endif // Guard
+
+#endif // CUDA
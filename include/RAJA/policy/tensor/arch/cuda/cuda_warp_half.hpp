@@ -0,0 +1,249 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing SIMT distrubuted registers of half and
+ *          bfloat16 elements that compute in float for CUDA
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/half.hpp"
+#include "RAJA/pattern/tensor/internal/WidenedRegister.hpp"
+
+#ifdef RAJA_ENABLE_CUDA
+
+#ifndef RAJA_policy_tensor_arch_cuda_cuda_warp_half_register_HPP
+#define RAJA_policy_tensor_arch_cuda_cuda_warp_half_register_HPP
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Warp register of 16-bit elements, one float per lane.
+   *
+   * Each lane converts its own element on load and store, so these are as
+   * cheap as the float warp register's.
+   */
+  template<typename ELEMENT_TYPE>
+  class CudaWarpWidenedRegister :
+    public WidenedRegister<ELEMENT_TYPE, RAJA::expt::cuda_warp_register>
+  {
+    public:
+      using base_type = WidenedRegister<ELEMENT_TYPE, RAJA::expt::cuda_warp_register>;
+      using base_type::base_type;
+
+      using typename base_type::self_type;
+      using typename base_type::element_type;
+      using typename base_type::compute_type;
+      using typename base_type::wide_type;
+      using typename base_type::int_vector_type;
+
+    protected:
+      using base_type::m_wide;
+      using base_type::getThis;
+
+    public:
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      static
+      int get_lane() {
+        return wide_type::get_lane();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type &load_packed(element_type const *ptr){
+        m_wide.get_raw_value() = compute_type(ptr[get_lane()]);
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type &load_packed_n(element_type const *ptr, int N){
+        auto lane = get_lane();
+        m_wide.get_raw_value() = lane < N ? compute_type(ptr[lane]) : compute_type(0);
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type &load_strided(element_type const *ptr, int stride){
+        m_wide.get_raw_value() = compute_type(ptr[stride*get_lane()]);
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type &load_strided_n(element_type const *ptr, int stride, int N){
+        auto lane = get_lane();
+        m_wide.get_raw_value() = lane < N ? compute_type(ptr[stride*lane]) : compute_type(0);
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type &gather(element_type const *ptr, int_vector_type offsets){
+        m_wide.get_raw_value() = compute_type(ptr[offsets.get_raw_value()]);
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
+        m_wide.get_raw_value() = get_lane() < N ?
+            compute_type(ptr[offsets.get_raw_value()]) : compute_type(0);
+        return *getThis();
+      }
+
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type &segmented_load(element_type const *ptr, camp::idx_t segbits, camp::idx_t stride_inner, camp::idx_t stride_outer){
+        auto lane = get_lane();
+        auto seg = lane >> segbits;
+        auto i = lane & ((1<<segbits)-1);
+        m_wide.get_raw_value() = compute_type(ptr[seg*stride_outer + i*stride_inner]);
+        return *getThis();
+      }
+
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type &segmented_load_nm(element_type const *ptr, camp::idx_t segbits,
+          camp::idx_t stride_inner, camp::idx_t stride_outer,
+          camp::idx_t num_inner, camp::idx_t num_outer)
+      {
+        auto lane = get_lane();
+        auto seg = lane >> segbits;
+        auto i = lane & ((1<<segbits)-1);
+        m_wide.get_raw_value() = (seg >= num_outer || i >= num_inner) ?
+            compute_type(0) : compute_type(ptr[seg*stride_outer + i*stride_inner]);
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type const &store_packed(element_type *ptr) const{
+        ptr[get_lane()] = element_type(m_wide.get_raw_value());
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type const &store_packed_n(element_type *ptr, int N) const{
+        auto lane = get_lane();
+        if(lane < N){
+          ptr[lane] = element_type(m_wide.get_raw_value());
+        }
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type const &store_strided(element_type *ptr, int stride) const{
+        ptr[stride*get_lane()] = element_type(m_wide.get_raw_value());
+        return *getThis();
+      }
+
+      RAJA_INLINE
+      RAJA_DEVICE
+      self_type const &store_strided_n(element_type *ptr, int stride, int N) const{
+        auto lane = get_lane();
+        if(lane < N){
+          ptr[stride*lane] = element_type(m_wide.get_raw_value());
+        }
+        return *getThis();
+      }
+
+      template<typename T2>
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type const &scatter(element_type *ptr, T2 const &offsets) const {
+        ptr[offsets.get_raw_value()] = element_type(m_wide.get_raw_value());
+        return *getThis();
+      }
+
+      template<typename T2>
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type const &scatter_n(element_type *ptr, T2 const &offsets, camp::idx_t N) const {
+        if(get_lane() < N){
+          ptr[offsets.get_raw_value()] = element_type(m_wide.get_raw_value());
+        }
+        return *getThis();
+      }
+
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type const &segmented_store(element_type *ptr, camp::idx_t segbits, camp::idx_t stride_inner, camp::idx_t stride_outer) const {
+        auto lane = get_lane();
+        auto seg = lane >> segbits;
+        auto i = lane & ((1<<segbits)-1);
+        ptr[seg*stride_outer + i*stride_inner] = element_type(m_wide.get_raw_value());
+        return *getThis();
+      }
+
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type const &segmented_store_nm(element_type *ptr, camp::idx_t segbits,
+          camp::idx_t stride_inner, camp::idx_t stride_outer,
+          camp::idx_t num_inner, camp::idx_t num_outer) const
+      {
+        auto lane = get_lane();
+        auto seg = lane >> segbits;
+        auto i = lane & ((1<<segbits)-1);
+        if(!(seg >= num_outer || i >= num_inner)){
+          ptr[seg*stride_outer + i*stride_inner] = element_type(m_wide.get_raw_value());
+        }
+        return *getThis();
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+
+
+namespace expt
+{
+
+  template<>
+  class Register<half_t, cuda_warp_register> :
+    public internal::expt::CudaWarpWidenedRegister<half_t>
+  {
+    public:
+      using base_type = internal::expt::CudaWarpWidenedRegister<half_t>;
+      using base_type::base_type;
+  };
+
+  template<>
+  class Register<bfloat16_t, cuda_warp_register> :
+    public internal::expt::CudaWarpWidenedRegister<bfloat16_t>
+  {
+    public:
+      using base_type = internal::expt::CudaWarpWidenedRegister<bfloat16_t>;
+      using base_type::base_type;
+  };
+
+}   // namespace expt
+
+} // namespace RAJA
+
+
+#endif // Guard
+
+#endif // CUDA
@@ -23,6 +23,8 @@
 
 #include<RAJA/policy/tensor/arch/hip/traits.hpp>
 #include<RAJA/policy/tensor/arch/hip/hip_wave.hpp>
+#include<RAJA/policy/tensor/arch/hip/hip_wave_half.hpp>
+#include<RAJA/policy/tensor/arch/hip/hip_mfma.hpp>
 
 
 #endif
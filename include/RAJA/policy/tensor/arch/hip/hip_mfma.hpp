@@ -0,0 +1,191 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing HIP matrix registers that multiply with
+ *          wavefront matrix (MFMA) instructions
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/MmaMatrixRegisterImpl.hpp"
+
+#ifdef RAJA_ENABLE_HIP
+
+#ifndef RAJA_policy_tensor_arch_hip_hip_mfma_register_HPP
+#define RAJA_policy_tensor_arch_hip_hip_mfma_register_HPP
+
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * Per lane register of hip_mfma_register matrices and vectors.
+   *
+   * This is the wavefront register; results of its operations convert back.
+   */
+  template<typename ELEMENT_TYPE>
+  class Register<ELEMENT_TYPE, hip_mfma_register> :
+    public Register<ELEMENT_TYPE, hip_wave_register>
+  {
+    public:
+      using base_type = Register<ELEMENT_TYPE, hip_wave_register>;
+      using base_type::base_type;
+
+      RAJA_DEVICE
+      RAJA_INLINE
+      Register(base_type const &c) : base_type(c) {}
+  };
+
+} // namespace expt
+
+
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Fragments of the 16x16x4 double precision MFMA.
+   *
+   * Lane l holds A(l%16, l/16), B(l/16, l%16) and C(4*(l/16) + slot, l%16).
+   */
+  template<typename T>
+  struct HipMfma16x16x4Traits
+  {
+      static constexpr camp::idx_t s_tile_rows = 16;
+      static constexpr camp::idx_t s_tile_cols = 16;
+      static constexpr camp::idx_t s_tile_k = 4;
+      static constexpr camp::idx_t s_num_slots = 4;
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int c_row(int lane, camp::idx_t slot){ return ((lane >> 4) << 2) + slot; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int c_col(int lane, camp::idx_t){ return lane & 15; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int c_lane(int row, int col){ return ((row >> 2) << 4) + col; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr camp::idx_t c_slot(int row, int){ return row & 3; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int a_row(int lane){ return lane & 15; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int a_k(int lane){ return lane >> 4; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int a_lane(int row, int k){ return (k << 4) + row; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int b_k(int lane){ return lane >> 4; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int b_col(int lane){ return lane & 15; }
+
+      RAJA_HOST_DEVICE RAJA_INLINE static
+      constexpr int b_lane(int k, int col){ return (k << 4) + col; }
+  };
+
+  /*!
+   * Element types without a matching instruction use the 16x16x4 fragment
+   * layout with FMAs.
+   */
+  template<typename T>
+  struct MmaTraits<RAJA::expt::hip_mfma_register, T> :
+    public HipMfma16x16x4Traits<T>
+  {
+      RAJA_DEVICE
+      RAJA_INLINE
+      static
+      void mma(T a, T b, T (&c)[4]){
+        mma_fma_tile<HipMfma16x16x4Traits<T>,
+                     RAJA::expt::Register<T, RAJA::expt::hip_wave_register>>(a, b, c);
+      }
+  };
+
+  /*!
+   * Double precision uses the CDNA2 and later MFMA instruction when it is
+   * available.
+   */
+  template<>
+  struct MmaTraits<RAJA::expt::hip_mfma_register, double> :
+    public HipMfma16x16x4Traits<double>
+  {
+      RAJA_DEVICE
+      RAJA_INLINE
+      static
+      void mma(double a, double b, double (&c)[4]){
+#if defined(__gfx90a__) || defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__)
+        using double4_t = double __attribute__((ext_vector_type(4)));
+        double4_t acc = {c[0], c[1], c[2], c[3]};
+        acc = __builtin_amdgcn_mfma_f64_16x16x4f64(a, b, acc, 0, 0, 0);
+        c[0] = acc[0];
+        c[1] = acc[1];
+        c[2] = acc[2];
+        c[3] = acc[3];
+#else
+        mma_fma_tile<HipMfma16x16x4Traits<double>,
+                     RAJA::expt::Register<double, RAJA::expt::hip_wave_register>>(a, b, c);
+#endif
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+
+
+namespace expt
+{
+
+  /*!
+   * Matrix register for hip_mfma_register, held in MFMA accumulator
+   * fragments. Dimensions must be multiples of 16.
+   */
+  template<typename T, camp::idx_t ROW_ORD, camp::idx_t COL_ORD, camp::idx_t ROW_SIZE, camp::idx_t COL_SIZE>
+  class TensorRegister<hip_mfma_register, T, TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>> :
+    public RAJA::internal::expt::MmaMatrixRegisterBase<TensorRegister<hip_mfma_register, T, TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>>
+  {
+    public:
+      using self_type = TensorRegister<hip_mfma_register, T, TensorLayout<ROW_ORD, COL_ORD>, camp::idx_seq<ROW_SIZE, COL_SIZE>>;
+      using base_type = RAJA::internal::expt::MmaMatrixRegisterBase<self_type>;
+      using element_type = T;
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      TensorRegister() : base_type() {}
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      TensorRegister(element_type c) : base_type(c) {}
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      TensorRegister(self_type const &c) : base_type(c) {}
+
+      using base_type::operator=;
+  };
+
+}   // namespace expt
+
+} // namespace RAJA
+
+
+#endif // Guard
+
+#endif // HIP
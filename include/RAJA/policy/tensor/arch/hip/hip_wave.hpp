@@ -51,6 +51,8 @@ namespace expt
 
       using int_vector_type = Register<int64_t, hip_wave_register>;
 
+      using mask_type = typename base_type::mask_type;
+
 
 		private:
       element_type m_value;
@@ -541,6 +543,195 @@ namespace expt
         return get_lane() < N ? self_type(m_value / b.m_value) : self_type(element_type(0));
       }
 
+      /*
+       * Each lane's predicate is gathered into the mask with a ballot, so
+       * all lanes hold the same mask
+       */
+
+      /*!
+       * @brief Mask of the lanes that are equal to x
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      mask_type compare_eq(self_type const &x) const {
+        return mask_type(__ballot(m_value == x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are not equal to x
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      mask_type compare_ne(self_type const &x) const {
+        return mask_type(__ballot(m_value != x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than x
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      mask_type compare_lt(self_type const &x) const {
+        return mask_type(__ballot(m_value < x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than or equal to x
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      mask_type compare_le(self_type const &x) const {
+        return mask_type(__ballot(m_value <= x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than x
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      mask_type compare_gt(self_type const &x) const {
+        return mask_type(__ballot(m_value > x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than or equal to x
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      mask_type compare_ge(self_type const &x) const {
+        return mask_type(__ballot(m_value >= x.m_value));
+      }
+
+      /*!
+       * @brief Returns x in the lanes where mask is set, and this elsewhere
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type blend(mask_type const &mask, self_type const &x) const {
+        return mask.get(get_lane()) ? x : *this;
+      }
+
+      /*!
+       * @brief Loads the lanes where mask is set, and zeroes the others
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_masked(element_type const *ptr, mask_type const &mask){
+        auto lane = get_lane();
+
+        m_value = mask.get(lane) ? ptr[lane] : element_type(0);
+        return *this;
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set, leaving the others untouched
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const {
+        auto lane = get_lane();
+
+        if(mask.get(lane)){
+          ptr[lane] = m_value;
+        }
+        return *this;
+      }
+
+      /*
+       * Math functions, each lane computes its own value with the HIP
+       * device functions
+       */
+
+      /*!
+       * @brief Rounds to the nearest integer, ties to even
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type round() const
+      {
+        return self_type(::rint(m_value));
+      }
+
+      /*!
+       * @brief Multiplies by 2^n
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type ldexp(self_type const &n) const
+      {
+        return self_type(::ldexp(m_value, (int)n.m_value));
+      }
+
+      /*!
+       * @brief Returns floor(log2(|x|))
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type exponent() const
+      {
+        return self_type(element_type(::ilogb(m_value)));
+      }
+
+      /*!
+       * @brief Square root
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const
+      {
+        return self_type(::sqrt(m_value));
+      }
+
+      /*!
+       * @brief Exponential
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type exp() const
+      {
+        return self_type(::exp(m_value));
+      }
+
+      /*!
+       * @brief Natural logarithm
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type log() const
+      {
+        return self_type(::log(m_value));
+      }
+
+      /*!
+       * @brief Power, (*this)^y
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type pow(self_type const &y) const
+      {
+        return self_type(::pow(m_value, y.m_value));
+      }
+
+      /*!
+       * @brief Sine
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type sin() const
+      {
+        return self_type(::sin(m_value));
+      }
+
+      /*!
+       * @brief Cosine
+       */
+      RAJA_DEVICE
+      RAJA_INLINE
+      self_type cos() const
+      {
+        return self_type(::cos(m_value));
+      }
+
       /**
        * floats and doubles use the CUDA instrinsic FMA
        */
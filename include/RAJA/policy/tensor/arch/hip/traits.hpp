@@ -34,6 +34,15 @@ namespace expt {
       using int_element_type = int32_t;
   };
 
+  template<typename T>
+  struct RegisterTraits<RAJA::expt::hip_mfma_register, T>{
+      using element_type = T;
+      using register_policy = RAJA::expt::hip_mfma_register;
+      static constexpr camp::idx_t s_num_elem = 64;
+      static constexpr camp::idx_t s_num_bits = sizeof(T) * s_num_elem;
+      using int_element_type = int32_t;
+  };
+
 } // namespace internal
 } // namespace expt
 } // namespace RAJA
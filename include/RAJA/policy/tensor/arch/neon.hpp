@@ -0,0 +1,27 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing SIMD abstractions for ARM NEON
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifdef __ARM_NEON
+
+#include<RAJA/policy/tensor/arch/neon/traits.hpp>
+#include<RAJA/policy/tensor/arch/neon/neon_int32.hpp>
+#include<RAJA/policy/tensor/arch/neon/neon_int64.hpp>
+#include<RAJA/policy/tensor/arch/neon/neon_float.hpp>
+#include<RAJA/policy/tensor/arch/neon/neon_double.hpp>
+
+
+#endif // __ARM_NEON
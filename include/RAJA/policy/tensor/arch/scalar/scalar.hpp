@@ -461,6 +461,100 @@ namespace expt {
         return self_type(RAJA::min<element_type>(m_value, a.m_value));
       }
 
+      /*
+       * Math functions, which are the scalar std:: functions
+       */
+
+      /*!
+       * @brief Rounds to the nearest integer, ties to even
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type round() const
+      {
+        return self_type(std::nearbyint(m_value));
+      }
+
+      /*!
+       * @brief Multiplies by 2^n
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type ldexp(self_type const &n) const
+      {
+        return self_type(std::ldexp(m_value, (int)n.m_value));
+      }
+
+      /*!
+       * @brief Returns floor(log2(|x|))
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type exponent() const
+      {
+        return self_type(element_type(std::ilogb(m_value)));
+      }
+
+      /*!
+       * @brief Square root
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const
+      {
+        return self_type(std::sqrt(m_value));
+      }
+
+      /*!
+       * @brief Exponential
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type exp() const
+      {
+        return self_type(std::exp(m_value));
+      }
+
+      /*!
+       * @brief Natural logarithm
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type log() const
+      {
+        return self_type(std::log(m_value));
+      }
+
+      /*!
+       * @brief Power, (*this)^y
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type pow(self_type const &y) const
+      {
+        return self_type(std::pow(m_value, y.m_value));
+      }
+
+      /*!
+       * @brief Sine
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sin() const
+      {
+        return self_type(std::sin(m_value));
+      }
+
+      /*!
+       * @brief Cosine
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type cos() const
+      {
+        return self_type(std::cos(m_value));
+      }
+
 
 
   };
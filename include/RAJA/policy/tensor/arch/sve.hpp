@@ -0,0 +1,27 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing SIMD abstractions for ARM SVE
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifdef RAJA_TENSOR_ARCH_SVE
+
+#include<RAJA/policy/tensor/arch/sve/traits.hpp>
+#include<RAJA/policy/tensor/arch/sve/sve_int32.hpp>
+#include<RAJA/policy/tensor/arch/sve/sve_int64.hpp>
+#include<RAJA/policy/tensor/arch/sve/sve_float.hpp>
+#include<RAJA/policy/tensor/arch/sve/sve_double.hpp>
+
+
+#endif // RAJA_TENSOR_ARCH_SVE
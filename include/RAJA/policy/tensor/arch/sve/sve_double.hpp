@@ -0,0 +1,595 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a SIMD register abstraction.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifdef RAJA_TENSOR_ARCH_SVE
+
+#ifndef RAJA_policy_vector_register_sve_double_HPP
+#define RAJA_policy_vector_register_sve_double_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterBase.hpp"
+
+// Include SIMD intrinsics header file
+#include <arm_sve.h>
+#include <cmath>
+
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * SVE register of the vector length fixed at compile time by
+   * -msve-vector-bits, so it can be stored in a class, with the partial
+   * loads, stores and reductions done under a predicate.
+   */
+  template<>
+  class Register<double, sve_register> :
+    public internal::expt::RegisterBase<Register<double, sve_register>>
+  {
+    public:
+      using base_type = internal::expt::RegisterBase<Register<double, sve_register>>;
+
+      using register_policy = sve_register;
+      using self_type = Register<double, sve_register>;
+      using element_type = double;
+      using register_type = internal::expt::sve_float64_t;
+
+      using int_vector_type = Register<int64_t, sve_register>;
+
+    private:
+      register_type m_value;
+
+      RAJA_INLINE
+      static svbool_t createMask() {
+        // All lanes
+        return svptrue_b64();
+      }
+
+      RAJA_INLINE
+      static svbool_t createMask(camp::idx_t N) {
+        // The first N lanes
+        return svwhilelt_b64_s64(int64_t(0), int64_t(N));
+      }
+
+      RAJA_INLINE
+      static svuint64_t createLaneBits() {
+        // Lane i holds 1<<i
+        return svlsl_u64_x(createMask(), svdup_n_u64(1), svindex_u64(0, 1));
+      }
+
+      RAJA_INLINE
+      static svbool_t createMask(mask_type const &mask) {
+        // The lanes whose bit is set in mask
+        return svcmpne_n_u64(createMask(),
+            svand_n_u64_x(createMask(), createLaneBits(), mask.bits()), 0);
+      }
+
+      RAJA_INLINE
+      static mask_type createMaskBits(svbool_t p) {
+        // The bits of the lanes set in predicate p
+        return mask_type(svorv_u64(p, createLaneBits()));
+      }
+
+      RAJA_INLINE
+      static svint64_t createStridedOffsets(camp::idx_t stride) {
+        // Generate a strided offset list
+        return svindex_s64(0, int64_t(stride));
+      }
+
+    public:
+
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS / 64;
+
+      /*!
+       * @brief Default constructor, zeros register contents
+       */
+      RAJA_INLINE
+      Register() : m_value(svdup_n_f64(0)) {
+      }
+
+      /*!
+       * @brief Copy constructor from underlying simd register
+       */
+      RAJA_INLINE
+      explicit Register(register_type const &c) : m_value(c) {}
+
+
+      /*!
+       * @brief Copy constructor
+       */
+      RAJA_INLINE
+      Register(self_type const &c) : base_type(c), m_value(c.m_value) {}
+
+      /*!
+       * @brief Copy assignment constructor
+       */
+      RAJA_INLINE
+      self_type &operator=(self_type const &c){
+        m_value = c.m_value;
+        return *this;
+      }
+
+      /*!
+       * @brief Construct from scalar.
+       * Sets all elements to same value (broadcast).
+       */
+      RAJA_INLINE
+      Register(element_type const &c) : m_value(svdup_n_f64(c)) {}
+
+
+      /*!
+       * @brief Returns underlying SIMD register.
+       */
+      RAJA_INLINE
+      register_type get_register() const {
+        return m_value;
+      }
+
+
+
+      /*!
+       * @brief Load a full register from a stride-one memory location
+       *
+       */
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr){
+          RAJA_TENSOR_STATS_INC(num_vector_load_packed);
+        m_value = svld1_f64(createMask(), ptr);
+        return *this;
+      }
+
+      /*!
+       * @brief Partially load a register from a stride-one memory location given
+       *        a run-time number of elements.
+       *
+       */
+      RAJA_INLINE
+      self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
+          RAJA_TENSOR_STATS_INC(num_vector_load_packed_n);
+        m_value = svld1_f64(createMask(N), ptr);
+        return *this;
+      }
+
+      /*!
+       * @brief Gather a full register from a strided memory location
+       *
+       */
+      RAJA_INLINE
+      self_type &load_strided(element_type const *ptr, camp::idx_t stride){
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided);
+        m_value = svld1_gather_s64index_f64(createMask(), ptr,
+                                              createStridedOffsets(stride));
+        return *this;
+      }
+
+
+      /*!
+       * @brief Partially load a register from a stride-one memory location given
+       *        a run-time number of elements.
+       *
+       */
+      RAJA_INLINE
+      self_type &load_strided_n(element_type const *ptr, camp::idx_t stride, camp::idx_t N){
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
+        m_value = svld1_gather_s64index_f64(createMask(N), ptr,
+                                              createStridedOffsets(stride));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather(element_type const *ptr, int_vector_type const &offsets){
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
+        m_value = svld1_gather_s64index_f64(createMask(), ptr,
+                                              offsets.get_register());
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather_n(element_type const *ptr, int_vector_type const &offsets, camp::idx_t N){
+          RAJA_TENSOR_STATS_INC(num_vector_load_strided_n);
+        m_value = svld1_gather_s64index_f64(createMask(N), ptr,
+                                              offsets.get_register());
+        return *this;
+      }
+
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr) const{
+          RAJA_TENSOR_STATS_INC(num_vector_store_packed);
+        svst1_f64(createMask(), ptr, m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Store partial register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
+          RAJA_TENSOR_STATS_INC(num_vector_store_packed_n);
+        svst1_f64(createMask(N), ptr, m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Store entire register to strided memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
+          RAJA_TENSOR_STATS_INC(num_vector_store_strided);
+        svst1_scatter_s64index_f64(createMask(), ptr,
+                                     createStridedOffsets(stride), m_value);
+        return *this;
+      }
+
+
+      /*!
+       * @brief Store partial register to strided memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
+          RAJA_TENSOR_STATS_INC(num_vector_store_strided_n);
+        svst1_scatter_s64index_f64(createMask(N), ptr,
+                                     createStridedOffsets(stride), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Generic scatter operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter(element_type *ptr, int_vector_type const &offsets) const {
+        svst1_scatter_s64index_f64(createMask(), ptr,
+                                     offsets.get_register(), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Generic scatter operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter_n(element_type *ptr, int_vector_type const &offsets, camp::idx_t N) const {
+        svst1_scatter_s64index_f64(createMask(N), ptr,
+                                     offsets.get_register(), m_value);
+        return *this;
+      }
+
+
+
+      /*!
+       * @brief Get scalar value from vector register
+       * @param i Offset of scalar to get
+       * @return Returns scalar value at i
+       */
+      RAJA_INLINE
+      element_type get(camp::idx_t i) const
+      {
+        // the last of the first i+1 lanes
+        return svlastb_f64(createMask(i+1), m_value);
+      }
+
+
+      /*!
+       * @brief Set scalar value in vector register
+       * @param i Offset of scalar to set
+       * @param value Value of scalar to set
+       */
+      RAJA_INLINE
+      self_type &set(element_type value, camp::idx_t i)
+      {
+        svbool_t lane = svcmpeq_n_s64(createMask(), svindex_s64(0, 1), int64_t(i));
+        m_value = svsel_f64(lane, svdup_n_f64(value), m_value);
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &broadcast(element_type const &value){
+        m_value = svdup_n_f64(value);
+        return *this;
+      }
+
+      /*!
+       * @brief Extracts a scalar value and broadcasts to a new register
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type get_and_broadcast(int i) const {
+        return self_type(svdup_lane_f64(m_value, uint64_t(i)));
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &copy(self_type const &src){
+        m_value = src.m_value;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type add(self_type const &b) const {
+        return self_type(svadd_f64_x(createMask(), m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type subtract(self_type const &b) const {
+        return self_type(svsub_f64_x(createMask(), m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type multiply(self_type const &b) const {
+        return self_type(svmul_f64_x(createMask(), m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide(self_type const &b) const {
+        return self_type(svdiv_f64_x(createMask(), m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide_n(self_type const &b, camp::idx_t N) const {
+        // the lanes past N are zeroed, and not divided
+        return self_type(svdiv_f64_z(createMask(N), m_value, b.m_value));
+      }
+
+      /*!
+       * @brief Square root of each element
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type sqrt() const {
+        return self_type(svsqrt_f64_x(createMask(), m_value));
+      }
+
+      /*!
+       * @brief Rounds each element to the nearest integer, ties to even
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type round() const {
+        return self_type(svrintn_f64_x(createMask(), m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_eq(self_type const &x) const {
+        return createMaskBits(svcmpeq_f64(createMask(), m_value, x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are not equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ne(self_type const &x) const {
+        return createMaskBits(svcmpne_f64(createMask(), m_value, x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_lt(self_type const &x) const {
+        return createMaskBits(svcmplt_f64(createMask(), m_value, x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are less than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_le(self_type const &x) const {
+        return createMaskBits(svcmple_f64(createMask(), m_value, x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_gt(self_type const &x) const {
+        return createMaskBits(svcmpgt_f64(createMask(), m_value, x.m_value));
+      }
+
+      /*!
+       * @brief Mask of the lanes that are greater than or equal to x
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      mask_type compare_ge(self_type const &x) const {
+        return createMaskBits(svcmpge_f64(createMask(), m_value, x.m_value));
+      }
+
+      /*!
+       * @brief Returns x in the lanes where mask is set, and this elsewhere
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type blend(mask_type const &mask, self_type const &x) const {
+        return self_type(svsel_f64(createMask(mask), x.m_value, m_value));
+      }
+
+      /*!
+       * @brief Loads the lanes where mask is set, and zeroes the others
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &load_packed_masked(element_type const *ptr, mask_type const &mask){
+        m_value = svld1_f64(createMask(mask), ptr);
+        return *this;
+      }
+
+      /*!
+       * @brief Stores the lanes where mask is set, leaving the others untouched
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &store_packed_masked(element_type *ptr, mask_type const &mask) const {
+        svst1_f64(createMask(mask), ptr, m_value);
+        return *this;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type multiply_add(self_type const &b, self_type const &c) const
+      {
+        return self_type(svmad_f64_x(createMask(), m_value, b.m_value, c.m_value));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type multiply_subtract(self_type const &b, self_type const &c) const
+      {
+        return self_type(svnmsb_f64_x(createMask(), m_value, b.m_value, c.m_value));
+      }
+
+      /*!
+       * @brief Sum the elements of this vector
+       * @return Sum of the values of the vectors scalar elements
+       */
+      RAJA_INLINE
+      element_type sum() const
+      {
+        return element_type(svaddv_f64(createMask(), m_value));
+      }
+
+
+      /*!
+       * @brief Returns the largest element
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type max() const
+      {
+        return svmaxv_f64(createMask(), m_value);
+      }
+
+      /*!
+       * @brief Returns the largest element from first N lanes
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type max_n(camp::idx_t N) const
+      {
+        if(N <= 0){
+          return RAJA::operators::limits<double>::min();
+        }
+        return svmaxv_f64(createMask(N), m_value);
+      }
+
+      /*!
+       * @brief Returns element-wise largest values
+       * @return Vector of the element-wise max values
+       */
+      RAJA_INLINE
+      self_type vmax(self_type a) const
+      {
+        return self_type(svmax_f64_x(createMask(), m_value, a.m_value));
+      }
+
+      /*!
+       * @brief Returns the smallest element
+       * @return The smallest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type min() const
+      {
+        return svminv_f64(createMask(), m_value);
+      }
+
+      /*!
+       * @brief Returns the smallest element from first N lanes
+       * @return The smallest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type min_n(camp::idx_t N) const
+      {
+        if(N <= 0){
+          return RAJA::operators::limits<double>::max();
+        }
+        return svminv_f64(createMask(N), m_value);
+      }
+
+      /*!
+       * @brief Returns element-wise smallest values
+       * @return Vector of the element-wise min values
+       */
+      RAJA_INLINE
+      self_type vmin(self_type a) const
+      {
+        return self_type(svmin_f64_x(createMask(), m_value, a.m_value));
+      }
+  };
+
+
+}   // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
+
+#endif //RAJA_TENSOR_ARCH_SVE
@@ -0,0 +1,87 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing SIMD abstractions for ARM SVE
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifdef RAJA_TENSOR_ARCH_SVE
+
+#ifndef RAJA_policy_tensor_arch_sve_traits_HPP
+#define RAJA_policy_tensor_arch_sve_traits_HPP
+
+#include <arm_sve.h>
+
+
+namespace RAJA {
+namespace internal {
+namespace expt {
+
+  // SVE vector types of the length given to -msve-vector-bits, which unlike
+  // the length agnostic types may be class members
+  typedef svint32_t sve_int32_t
+      __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+  typedef svint64_t sve_int64_t
+      __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+  typedef svfloat32_t sve_float32_t
+      __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+  typedef svfloat64_t sve_float64_t
+      __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+
+
+  template<>
+  struct RegisterTraits<RAJA::expt::sve_register, int32_t>{
+      using element_type = int32_t;
+      using register_policy = RAJA::expt::sve_register;
+      static constexpr camp::idx_t s_num_bits = __ARM_FEATURE_SVE_BITS;
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS / 32;
+      using int_element_type = int32_t;
+  };
+
+  template<>
+  struct RegisterTraits<RAJA::expt::sve_register, int64_t>{
+      using element_type = int64_t;
+      using register_policy = RAJA::expt::sve_register;
+      static constexpr camp::idx_t s_num_bits = __ARM_FEATURE_SVE_BITS;
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS / 64;
+      using int_element_type = int64_t;
+  };
+
+  template<>
+  struct RegisterTraits<RAJA::expt::sve_register, float>{
+      using element_type = float;
+      using register_policy = RAJA::expt::sve_register;
+      static constexpr camp::idx_t s_num_bits = __ARM_FEATURE_SVE_BITS;
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS / 32;
+      using int_element_type = int32_t;
+  };
+
+  template<>
+  struct RegisterTraits<RAJA::expt::sve_register, double>{
+      using element_type = double;
+      using register_policy = RAJA::expt::sve_register;
+      static constexpr camp::idx_t s_num_bits = __ARM_FEATURE_SVE_BITS;
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS / 64;
+      using int_element_type = int64_t;
+  };
+
+} // namespace intenral
+} // namespace expt
+} // namespace RAJA
+
+
+#endif // guard
+
+
+
+#endif // RAJA_TENSOR_ARCH_SVE
@@ -35,6 +35,10 @@
 #include<RAJA/policy/tensor/arch/avx512.hpp>
 #endif
 
+#ifdef RAJA_TENSOR_ARCH_AMX
+#include<RAJA/policy/tensor/arch/amx.hpp>
+#endif
+
 
 #ifdef __AVX2__
 #include<RAJA/policy/tensor/arch/avx2.hpp>
@@ -45,6 +49,14 @@
 #include<RAJA/policy/tensor/arch/avx.hpp>
 #endif
 
+#ifdef RAJA_TENSOR_ARCH_SVE
+#include<RAJA/policy/tensor/arch/sve.hpp>
+#endif
+
+#ifdef __ARM_NEON
+#include<RAJA/policy/tensor/arch/neon.hpp>
+#endif
+
 #ifdef RAJA_ENABLE_CUDA
 #include<RAJA/policy/tensor/arch/cuda.hpp>
 #endif
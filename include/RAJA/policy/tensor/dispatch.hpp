@@ -0,0 +1,257 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for selecting tensor register policies at run time.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tensor_dispatch_HPP
+#define RAJA_policy_tensor_dispatch_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/tensor/arch.hpp"
+
+/*
+ * The default register is chosen from the flags a file is compiled with, so
+ * a binary that must run on several generations of CPUs is limited to the
+ * oldest one.  Runtime dispatch compiles the same kernels once per
+ * instruction set, and picks the best variant the CPU supports the first
+ * time a kernel is called.
+ *
+ * A kernel is a function template over the register policy, which is
+ * declared in a header:
+ *
+ *   template<typename REGISTER_POLICY>
+ *   void daxpy(double *y, double const *x, double a, int N);
+ *
+ *   RAJA_TENSOR_DISPATCH_DECLARE(daxpy)
+ *
+ * and defined in a source file that is added to a target with the
+ * raja_add_tensor_dispatch_sources() CMake function, which compiles it once
+ * for the target's flags and once for each of RAJA_TENSOR_DISPATCH_ISAS:
+ *
+ *   template<typename REGISTER_POLICY>
+ *   void daxpy(double *y, double const *x, double a, int N){
+ *     using vector_t = RAJA::expt::VectorRegister<double, REGISTER_POLICY>;
+ *     ...
+ *   }
+ *
+ *   RAJA_TENSOR_DISPATCH_DEFINE(daxpy)
+ *
+ * Callers then use the best variant through:
+ *
+ *   RAJA_TENSOR_DISPATCH(daxpy)(y, x, a, N);
+ *
+ * Each variant is instantiated with the default_register of its own flags,
+ * and no code compiled for a variant runs before the CPU has been checked.
+ */
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * Instruction sets that kernels can be dispatched to, in increasing order
+   * of preference
+   */
+  enum class RegisterISA : int
+  {
+    scalar = 0,
+    avx = 1,
+    avx2 = 2,
+    avx512 = 3
+  };
+
+  /*!
+   * Instruction set a register policy needs.
+   *
+   * Policies that are not dispatched at run time (NEON, SVE, the GPU
+   * registers) count as scalar, since they are only ever used by the
+   * variant compiled with the target's own flags.
+   */
+  template<typename REGISTER_POLICY>
+  struct RegisterPolicyISA
+  {
+      static constexpr RegisterISA value = RegisterISA::scalar;
+  };
+
+#ifdef __AVX__
+  template<>
+  struct RegisterPolicyISA<avx_register>
+  {
+      static constexpr RegisterISA value = RegisterISA::avx;
+  };
+#endif
+
+#ifdef __AVX2__
+  template<>
+  struct RegisterPolicyISA<avx2_register>
+  {
+      static constexpr RegisterISA value = RegisterISA::avx2;
+  };
+#endif
+
+#ifdef __AVX512F__
+  template<>
+  struct RegisterPolicyISA<avx512_register>
+  {
+      static constexpr RegisterISA value = RegisterISA::avx512;
+  };
+#endif
+
+
+  /*!
+   * Returns true if this CPU, and the OS, support register instruction set
+   * isa
+   */
+  RAJA_INLINE
+  bool cpuSupportsRegisterISA(RegisterISA isa)
+  {
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    switch(isa){
+      case RegisterISA::avx512:
+        return __builtin_cpu_supports("avx512f") &&
+               __builtin_cpu_supports("fma");
+      case RegisterISA::avx2:
+        return __builtin_cpu_supports("avx2") &&
+               __builtin_cpu_supports("fma");
+      case RegisterISA::avx:
+        return __builtin_cpu_supports("avx");
+      default:
+        return true;
+    }
+#else
+    return isa == RegisterISA::scalar;
+#endif
+  }
+
+
+  /*!
+   * Picks the most preferred kernel variant that this CPU supports.
+   *
+   * Each variant is given by a function returning the kernel, or nullptr if
+   * it was not built.  The base variant, compiled with the target's own
+   * flags, is always usable.
+   */
+  template<typename KERNEL_PTR>
+  KERNEL_PTR selectTensorDispatch(KERNEL_PTR (*base)(),
+                                  KERNEL_PTR (*avx2)(),
+                                  KERNEL_PTR (*avx512)())
+  {
+    if(avx512 != nullptr && cpuSupportsRegisterISA(RegisterISA::avx512)){
+      return avx512();
+    }
+    if(avx2 != nullptr && cpuSupportsRegisterISA(RegisterISA::avx2)){
+      return avx2();
+    }
+    return base();
+  }
+
+
+}  // namespace expt
+}  // namespace RAJA
+
+
+
+/*
+ * Variant the current file is compiled as, which is set for each copy of a
+ * source by raja_add_tensor_dispatch_sources()
+ */
+#ifndef RAJA_TENSOR_DISPATCH_VARIANT
+#define RAJA_TENSOR_DISPATCH_VARIANT base
+#endif
+
+#define RAJA_TENSOR_DISPATCH_GETTER_IMPL(NAME, VARIANT) NAME##_raja_tensor_##VARIANT
+#define RAJA_TENSOR_DISPATCH_GETTER(NAME, VARIANT) RAJA_TENSOR_DISPATCH_GETTER_IMPL(NAME, VARIANT)
+
+
+#ifdef RAJA_TENSOR_DISPATCH_HAVE_AVX2
+#define RAJA_TENSOR_DISPATCH_DECLARE_AVX2(NAME) \
+  NAME##_raja_tensor_ptr NAME##_raja_tensor_avx2();
+#define RAJA_TENSOR_DISPATCH_AVX2(NAME) &NAME##_raja_tensor_avx2
+#else
+#define RAJA_TENSOR_DISPATCH_DECLARE_AVX2(NAME)
+#define RAJA_TENSOR_DISPATCH_AVX2(NAME) nullptr
+#endif
+
+#ifdef RAJA_TENSOR_DISPATCH_HAVE_AVX512
+#define RAJA_TENSOR_DISPATCH_DECLARE_AVX512(NAME) \
+  NAME##_raja_tensor_ptr NAME##_raja_tensor_avx512();
+#define RAJA_TENSOR_DISPATCH_AVX512(NAME) &NAME##_raja_tensor_avx512
+#else
+#define RAJA_TENSOR_DISPATCH_DECLARE_AVX512(NAME)
+#define RAJA_TENSOR_DISPATCH_AVX512(NAME) nullptr
+#endif
+
+
+// The selection is left out of the instruction set variants, so that their
+// copy of it can never be the one the linker keeps
+#ifdef RAJA_TENSOR_DISPATCH_ISA_VARIANT
+#define RAJA_TENSOR_DISPATCH_DECLARE_SELECT(NAME)
+
+#define RAJA_TENSOR_DISPATCH_CHECK_VARIANT \
+  static_assert(RAJA::expt::RegisterPolicyISA<RAJA::expt::default_register>::value == \
+                RAJA::expt::RegisterISA::RAJA_TENSOR_DISPATCH_VARIANT, \
+                "The default register does not match the dispatch variant, " \
+                "check that the base flags do not already enable it");
+#else
+#define RAJA_TENSOR_DISPATCH_DECLARE_SELECT(NAME) \
+  inline NAME##_raja_tensor_ptr NAME##_raja_tensor_dispatch() \
+  { \
+    static NAME##_raja_tensor_ptr const kernel = \
+      RAJA::expt::selectTensorDispatch<NAME##_raja_tensor_ptr>( \
+          &NAME##_raja_tensor_base, \
+          RAJA_TENSOR_DISPATCH_AVX2(NAME), \
+          RAJA_TENSOR_DISPATCH_AVX512(NAME)); \
+    return kernel; \
+  }
+
+#define RAJA_TENSOR_DISPATCH_CHECK_VARIANT
+#endif
+
+
+/*!
+ * Declares the variants of kernel template NAME, and its dispatch
+ */
+#define RAJA_TENSOR_DISPATCH_DECLARE(NAME) \
+  using NAME##_raja_tensor_ptr = decltype(&NAME<RAJA::expt::scalar_register>); \
+  NAME##_raja_tensor_ptr NAME##_raja_tensor_base(); \
+  RAJA_TENSOR_DISPATCH_DECLARE_AVX2(NAME) \
+  RAJA_TENSOR_DISPATCH_DECLARE_AVX512(NAME) \
+  RAJA_TENSOR_DISPATCH_DECLARE_SELECT(NAME)
+
+/*!
+ * Defines the variant of kernel template NAME for the register of the flags
+ * the current file is compiled with
+ */
+#define RAJA_TENSOR_DISPATCH_DEFINE(NAME) \
+  RAJA_TENSOR_DISPATCH_CHECK_VARIANT \
+  NAME##_raja_tensor_ptr RAJA_TENSOR_DISPATCH_GETTER(NAME, RAJA_TENSOR_DISPATCH_VARIANT)() \
+  { \
+    return &NAME<RAJA::expt::default_register>; \
+  }
+
+/*!
+ * The best variant of kernel template NAME for this CPU
+ */
+#define RAJA_TENSOR_DISPATCH(NAME) NAME##_raja_tensor_dispatch()
+
+
+#endif
@@ -0,0 +1,209 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the array-of-structs-of-arrays layout.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AOSOALAYOUT_HPP
+#define RAJA_AOSOALAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/Layout.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief A mapping of (element, field) indices to array-of-structs-of-arrays
+ * storage.
+ *
+ * Elements are grouped in tiles of TILE_SIZE, and each tile stores its
+ * elements field by field, so that element i of field f is at:
+ *
+ *     (i / TILE_SIZE) * (TILE_SIZE * num_fields) + f * TILE_SIZE + i % TILE_SIZE
+ *
+ * A field of a tile is then TILE_SIZE contiguous values.  With TILE_SIZE the
+ * register width it is one packed load, and with TILE_SIZE a multiple of the
+ * warp size the threads of a warp access consecutive addresses, while the
+ * fields of an element stay close together as in an array of structs.
+ *
+ * For example, with 3 fields and tiles of 4:
+ *
+ *     AoSoALayout<4> layout(10, 3);
+ *
+ *     int lin1 = layout(1, 0);   // lin1 = 1
+ *     int lin2 = layout(1, 2);   // lin2 = 9
+ *     int lin3 = layout(5, 1);   // lin3 = 17
+ *
+ * The last tile is padded, and size() includes the padding, so a View of
+ * this layout needs size() values:
+ *
+ *     RAJA::View<double, AoSoALayout<4>> x(new double[layout.size()], layout);
+ *
+ * The element index is not affine, so tensor accesses go through
+ * tile_layout(), see RAJA::make_aosoa_tile_view.
+ */
+template <camp::idx_t TILE_SIZE, typename IdxLin = Index_type>
+struct AoSoALayout {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<2>;
+
+  /*!
+   * Layout of the same storage indexed by (tile, field, lane)
+   */
+  using tile_layout_type = Layout<3, IdxLin, 2>;
+
+  static_assert(TILE_SIZE > 0, "AoSoALayout tiles must not be empty");
+
+  static constexpr size_t n_dims = 2;
+  static constexpr IdxLin tile_size = TILE_SIZE;
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  IdxLin sizes[n_dims] = {0};
+
+
+  constexpr RAJA_INLINE AoSoALayout() = default;
+  constexpr RAJA_INLINE AoSoALayout(AoSoALayout const &) = default;
+  constexpr RAJA_INLINE AoSoALayout(AoSoALayout &&) = default;
+  RAJA_INLINE AoSoALayout &operator=(AoSoALayout const &) = default;
+  RAJA_INLINE AoSoALayout &operator=(AoSoALayout &&) = default;
+
+  /*!
+   * Construct a layout of num_elements elements with num_fields fields.
+   */
+  template <typename ElemSize, typename FieldSize>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr AoSoALayout(ElemSize num_elements,
+                                                     FieldSize num_fields)
+      : sizes{static_cast<IdxLin>(stripIndexType(num_elements)),
+              static_cast<IdxLin>(stripIndexType(num_fields))}
+  {
+  }
+
+  /*!
+   * Computes the linear space index of field of element.
+   *
+   * @param elem  Element index, which must not be negative
+   * @param field  Field index
+   * @return Linear space index.
+   */
+  template <typename Elem, typename Field>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin
+  operator()(Elem elem, Field field) const
+  {
+#if defined (RAJA_BOUNDS_CHECK_INTERNAL)
+    if(!(0 <= elem && elem < static_cast<Elem>(sizes[0])) ||
+       !(0 <= field && field < static_cast<Field>(sizes[1]))) {
+      printf("Error at index (%ld, %ld), not within bounds [0, %ld] x [0, %ld] \n",
+             static_cast<long int>(elem), static_cast<long int>(field),
+             static_cast<long int>(sizes[0] - 1), static_cast<long int>(sizes[1] - 1));
+      RAJA_ABORT_OR_THROW("Out of bounds error \n");
+    }
+#endif
+    return (IdxLin(elem) / tile_size) * (tile_size * sizes[1]) +
+           IdxLin(field) * tile_size +
+           IdxLin(elem) % tile_size;
+  }
+
+  /*!
+   * Given a linear-space index, compute the element and field indices.
+   *
+   * @param linear_index  Linear space index, which must not be negative and
+   *                      not in the padding of the last tile.
+   * @param elem  Element index to be assigned
+   * @param field  Field index to be assigned
+   */
+  template <typename Elem, typename Field>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Elem &&elem,
+                                              Field &&field) const
+  {
+    IdxLin tile_elems = tile_size * (sizes[1] ? sizes[1] : 1);
+    IdxLin tile = linear_index / tile_elems;
+    IdxLin in_tile = linear_index % tile_elems;
+
+    elem = (camp::decay<Elem>)(tile * tile_size + in_tile % tile_size);
+    field = (camp::decay<Field>)(in_tile / tile_size);
+  }
+
+  /*!
+   * Number of tiles, with the last one partially filled.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin num_tiles() const
+  {
+    return (sizes[0] + tile_size - 1) / tile_size;
+  }
+
+  /*!
+   * Size of the storage, including the padding of the last tile.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return num_tiles() * tile_size * sizes[1];
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size_noproj() const
+  {
+    return size();
+  }
+
+  /*!
+   * Layout of the same storage indexed by (tile, field, lane), where lanes
+   * are stride one.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr tile_layout_type tile_layout() const
+  {
+    return tile_layout_type(num_tiles(), sizes[1], tile_size);
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_size() const {
+    return sizes[DIM];
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_begin() const {
+    return 0;
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_stride() const {
+    static_assert(DIM < 0,
+        "AoSoALayout has no strides, use make_aosoa_tile_view for tensor accesses");
+    return 0;
+  }
+};
+
+template <camp::idx_t TILE_SIZE, typename IdxLin>
+constexpr size_t AoSoALayout<TILE_SIZE, IdxLin>::n_dims;
+template <camp::idx_t TILE_SIZE, typename IdxLin>
+constexpr IdxLin AoSoALayout<TILE_SIZE, IdxLin>::tile_size;
+template <camp::idx_t TILE_SIZE, typename IdxLin>
+constexpr ptrdiff_t AoSoALayout<TILE_SIZE, IdxLin>::stride_one_dim;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,174 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a layout wrapper that checks the
+ *          bounds of every index.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_CHECKEDLAYOUT_HPP
+#define RAJA_CHECKEDLAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdio>
+#include <type_traits>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Reports an out of bounds index.  Kept out of line, so that the checks
+ * only add a compare and a branch that is never taken to each access.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((noinline, cold))
+#endif
+RAJA_HOST_DEVICE inline void checked_layout_error(int dim,
+                                                  long int idx,
+                                                  long int begin,
+                                                  long int size)
+{
+  printf("Error at index %d, value %ld is not within bounds [%ld, %ld] \n",
+         dim, idx, begin, begin + size - 1);
+  RAJA_ABORT_OR_THROW("Out of bounds error \n");
+}
+
+}  // namespace detail
+
+
+/*!
+ * @brief A layout that checks every index against the bounds of LayoutType
+ * before mapping it.
+ *
+ * Bounds checks are otherwise only compiled in with RAJA_ENABLE_BOUNDS_CHECK,
+ * for all Views of a build.  CheckedLayout enables them for the Views of one
+ * type, which can be chosen per package or per data structure:
+ *
+ *     using checked_view = RAJA::View<double, RAJA::CheckedLayout<RAJA::Layout<2>>>;
+ *     checked_view A(ptr, N, M);
+ *     A(N, 0) = 1.0;   // reports dimension 0 and aborts, or throws
+ *
+ * or, for a package that turns checking on with its own flag:
+ *
+ *     using my_layout = RAJA::CheckedLayoutIf<MY_PACKAGE_CHECK, RAJA::Layout<2>>;
+ *
+ * Each access does one unsigned compare per dimension and a single branch,
+ * which is much cheaper than a sanitizer.  Views of unchecked layouts are
+ * not changed at all.  Dimensions of size zero are projections, and are not
+ * checked.
+ */
+template <typename LayoutType>
+struct CheckedLayout : public LayoutType {
+  using Base = LayoutType;
+  using IndexLinear = typename LayoutType::IndexLinear;
+
+  using LayoutType::LayoutType;
+
+  constexpr RAJA_INLINE CheckedLayout() = default;
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr CheckedLayout(LayoutType const &layout)
+      : LayoutType(layout)
+  {
+  }
+
+  /*!
+   * Conversion between checked layouts, such as to the offset layout of
+   * View::shift
+   */
+  template <typename OtherLayout>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr CheckedLayout(
+      CheckedLayout<OtherLayout> const &rhs)
+      : LayoutType(static_cast<OtherLayout const &>(rhs))
+  {
+  }
+
+  /*!
+   * Checks indices, and computes their linear space index.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE auto operator()(Indices... indices) const
+      -> decltype(std::declval<LayoutType const &>()(indices...))
+  {
+    check(camp::make_idx_seq_t<sizeof...(Indices)>{}, indices...);
+    return LayoutType::operator()(indices...);
+  }
+
+private:
+  template <camp::idx_t DIM, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE bool out_of_bounds(Idx idx) const
+  {
+    using lin_t = strip_index_type_t<IndexLinear>;
+    using unsigned_t = typename std::make_unsigned<lin_t>::type;
+
+    lin_t size = static_cast<lin_t>(stripIndexType(this->template get_dim_size<DIM>()));
+    lin_t begin = static_cast<lin_t>(stripIndexType(this->template get_dim_begin<DIM>()));
+
+    // negative offsets wrap around to large unsigned values
+    return size != 0 &&
+           static_cast<unsigned_t>(static_cast<lin_t>(stripIndexType(idx)) - begin) >=
+               static_cast<unsigned_t>(size);
+  }
+
+  template <camp::idx_t... Dims, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void check(camp::idx_seq<Dims...>,
+                                          Indices... indices) const
+  {
+    bool bad = RAJA::sum<int>(int(out_of_bounds<Dims>(indices))...) != 0;
+#if defined(__GNUC__) || defined(__clang__)
+    bad = __builtin_expect(bad, false);
+#endif
+    if (bad) {
+      report(camp::idx_seq<Dims...>{}, indices...);
+    }
+  }
+
+  template <camp::idx_t... Dims, typename... Indices>
+  RAJA_HOST_DEVICE void report(camp::idx_seq<Dims...>, Indices... indices) const
+  {
+    camp::sink((out_of_bounds<Dims>(indices)
+                    ? (detail::checked_layout_error(
+                           static_cast<int>(Dims),
+                           static_cast<long int>(stripIndexType(indices)),
+                           static_cast<long int>(stripIndexType(
+                               this->template get_dim_begin<Dims>())),
+                           static_cast<long int>(stripIndexType(
+                               this->template get_dim_size<Dims>()))),
+                       0)
+                    : 0)...);
+  }
+};
+
+/*!
+ * @brief CheckedLayout<LayoutType> when CHECK is true, and LayoutType
+ * itself otherwise
+ */
+template <bool CHECK, typename LayoutType>
+using CheckedLayoutIf =
+    typename std::conditional<CHECK, CheckedLayout<LayoutType>, LayoutType>::type;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,181 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a scatter of element values to nodes
+ *          without atomics, by colors of the elements.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ColoredScatter_HPP
+#define RAJA_util_ColoredScatter_HPP
+
+#include "RAJA/config.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief Element to node scatter that needs no atomics, for assembly of
+ *        node values from mesh elements.
+ *
+ * The constructor colors the elements with buildColorIndexSet so that no
+ * two elements of a color share a node.  The colors run one after the other
+ * and the elements of each color run with the given execution policy, so
+ * they may add to their nodes with plain updates, and the sums do not depend
+ * on the number of threads:
+ *
+ *     RAJA::ColoredScatter scatter(res, elem_nodes, num_elems, 4, num_nodes);
+ *
+ *     // node_force[elem_nodes[e*4 + j]] += elem_force[e*4 + j]
+ *     scatter.scatter_add<RAJA::omp_parallel_for_exec>(node_force, elem_force);
+ *
+ *     // any element body that only updates the nodes of element e
+ *     scatter.forall<RAJA::omp_parallel_for_exec>([=](RAJA::Index_type e) {
+ *       ...
+ *     });
+ *
+ * The connectivity is read on the host to color the elements, and a copy
+ * of it and the list segments of the colors are kept in the memory of the
+ * resource, so with a device resource and a gpu execution policy the scatter
+ * runs on the device.  On gpus the colors are a choice, atomic updates of a
+ * forall over all elements need no coloring and may be faster when few
+ * elements share a node.
+ */
+class ColoredScatter
+{
+public:
+  using iset_type = RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>;
+
+  /*!
+   * Elements with different numbers of nodes: the nodes of element e are
+   * elem_nodes[elem_node_offsets[e]] to elem_nodes[elem_node_offsets[e+1]-1]
+   */
+  ColoredScatter(camp::resources::Resource work_res,
+                 const RAJA::Index_type* elem_node_offsets,
+                 const RAJA::Index_type* elem_nodes,
+                 RAJA::Index_type num_elems,
+                 RAJA::Index_type num_nodes)
+      : m_resource(work_res), m_num_elems(num_elems)
+  {
+    init(elem_node_offsets, elem_nodes, num_nodes);
+  }
+
+  /*!
+   * Elements with nodes_per_elem nodes each: the nodes of element e are
+   * elem_nodes[e*nodes_per_elem] to elem_nodes[(e+1)*nodes_per_elem-1]
+   */
+  ColoredScatter(camp::resources::Resource work_res,
+                 const RAJA::Index_type* elem_nodes,
+                 RAJA::Index_type num_elems,
+                 RAJA::Index_type nodes_per_elem,
+                 RAJA::Index_type num_nodes)
+      : m_resource(work_res), m_num_elems(num_elems)
+  {
+    std::vector<RAJA::Index_type> offsets(num_elems + 1);
+    for (RAJA::Index_type e = 0; e <= num_elems; ++e) {
+      offsets[e] = e * nodes_per_elem;
+    }
+    init(offsets.data(), elem_nodes, num_nodes);
+  }
+
+  ColoredScatter(ColoredScatter const&) = delete;
+  ColoredScatter& operator=(ColoredScatter const&) = delete;
+
+  ~ColoredScatter()
+  {
+    m_resource.deallocate(m_offsets);
+    m_resource.deallocate(m_nodes);
+  }
+
+  //! The colors, one segment per color
+  iset_type const& colors() const { return m_colors; }
+
+  size_t num_colors() const { return m_colors.getNumSegments(); }
+
+  RAJA::Index_type num_elems() const { return m_num_elems; }
+
+  /*!
+   * Calls body(e) for every element e, with the elements of one color at a
+   * time run by ExecPolicy
+   */
+  template <typename ExecPolicy, typename Body>
+  void forall(Body&& body) const
+  {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, ExecPolicy>>(
+        m_colors, std::forward<Body>(body));
+  }
+
+  /*!
+   * Adds elem_values[k] to node_values[elem_nodes[k]] for every position k
+   * of the connectivity, which must be accessible by ExecPolicy
+   */
+  template <typename ExecPolicy, typename T>
+  void scatter_add(T* node_values, const T* elem_values) const
+  {
+    const RAJA::Index_type* offsets = m_offsets;
+    const RAJA::Index_type* nodes = m_nodes;
+    forall<ExecPolicy>([=] RAJA_HOST_DEVICE(RAJA::Index_type e) {
+      for (RAJA::Index_type k = offsets[e]; k < offsets[e + 1]; ++k) {
+        node_values[nodes[k]] += elem_values[k];
+      }
+    });
+  }
+
+private:
+  void init(const RAJA::Index_type* elem_node_offsets,
+            const RAJA::Index_type* elem_nodes,
+            RAJA::Index_type num_nodes)
+  {
+    RAJA::buildColorIndexSet(m_colors,
+                             m_resource,
+                             elem_node_offsets,
+                             elem_nodes,
+                             m_num_elems,
+                             num_nodes);
+
+    const RAJA::Index_type num_links = elem_node_offsets[m_num_elems];
+    m_offsets = m_resource.allocate<RAJA::Index_type>(m_num_elems + 1);
+    m_nodes = m_resource.allocate<RAJA::Index_type>(num_links);
+    m_resource.memcpy(m_offsets,
+                      elem_node_offsets,
+                      sizeof(RAJA::Index_type) * (m_num_elems + 1));
+    m_resource.memcpy(m_nodes,
+                      elem_nodes,
+                      sizeof(RAJA::Index_type) * num_links);
+    m_resource.wait();
+  }
+
+  camp::resources::Resource m_resource;
+  RAJA::Index_type m_num_elems;
+  iset_type m_colors;
+  RAJA::Index_type* m_offsets = nullptr;
+  RAJA::Index_type* m_nodes = nullptr;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -93,6 +93,46 @@ struct CombiningAdapter
 private:
   Lambda m_lambda;
   Layout m_layout;
+  camp::idx_t m_inner_dim;
+  StrippedIdxLin m_inner_size;
+
+  /*
+   * The dimension of the rows of the layout, with the smallest stride, and
+   * the number of indices in it
+   */
+  template < camp::idx_t... RangeInts >
+  RAJA_HOST_DEVICE inline void set_inner_dim(camp::idx_seq<RangeInts...>)
+  {
+    const StrippedIdxLin strides[] = {
+        stripIndexType(m_layout.template get_dim_stride<RangeInts>())...};
+    const StrippedIdxLin sizes[] = {
+        stripIndexType(m_layout.template get_dim_size<RangeInts>())...};
+    m_inner_dim = 0;
+    m_inner_size = sizeof...(RangeInts) ? sizes[0] : StrippedIdxLin(1);
+    for (camp::idx_t d = 1; d < camp::idx_t(sizeof...(RangeInts)); ++d) {
+      if (sizes[d] != 0 && (sizes[m_inner_dim] == 0 ||
+                            strides[d] < strides[m_inner_dim])) {
+        m_inner_dim = d;
+        m_inner_size = sizes[d];
+      }
+    }
+  }
+
+  template < camp::idx_t... RangeInts >
+  RAJA_HOST_DEVICE inline void call_row_helper(IndexLinear row,
+                                               camp::idx_seq<RangeInts...>) const
+  {
+    DimTuple indices;
+    m_layout.toIndices(static_cast<IndexLinear>(stripIndexType(row) * m_inner_size),
+                       camp::get<RangeInts>(indices)...);
+    const StrippedIdxLin first[] = {
+        static_cast<StrippedIdxLin>(stripIndexType(camp::get<RangeInts>(indices)))...};
+    const camp::idx_t inner = m_inner_dim;
+    for (StrippedIdxLin k = 0; k < m_inner_size; ++k) {
+      m_lambda(static_cast<camp::tuple_element_t<RangeInts, DimTuple>>(
+          first[RangeInts] + (RangeInts == inner ? k : StrippedIdxLin(0)))...);
+    }
+  }
 
   template < camp::idx_t... RangeInts >
   RAJA_HOST_DEVICE inline auto call_helper(IndexLinear linear_index,
@@ -124,6 +164,7 @@ public:
       : m_lambda(std::forward<C_Lambda>(lambda))
       , m_layout(std::forward<C_Layout>(layout))
   {
+    set_inner_dim(IndexRange());
   }
 
   /*!
@@ -163,6 +204,64 @@ public:
   {
     return RangeLinear(static_cast<IndexLinear>(0), size());
   }
+
+  /*!
+   * Call the lambda for every index of a row, the indices along the
+   * dimension with stride one with the others fixed.
+   *
+   * The indices of the row are converted from the linear index once, and
+   * the loop along it has no divides, so it can be vectorized.
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE void call_row(IndexLinear row) const
+  {
+    call_row_helper(row, IndexRange());
+  }
+
+  /*!
+   * Number of rows, the size divided by the size of the stride one
+   * dimension
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE IndexLinear num_rows() const
+  {
+    return m_inner_size ? static_cast<IndexLinear>(stripIndexType(size()) / m_inner_size)
+                        : static_cast<IndexLinear>(0);
+  }
+
+  /*!
+   * Callable object calling the lambda for all indices of a row, for use
+   * with getRowRange
+   */
+  struct Rows;
+
+  /*!
+   * Convenience methods to iterate over the layout by rows on the CPU,
+   * where the per index conversion costs more than the loop body:
+   *
+   *     RAJA::forall<policy>(adapter.getRowRange(), adapter.rows());
+   *
+   * On GPUs use getRange() and the adapter, which converts each index with
+   * the precomputed divisors of the layout.
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE RangeLinear getRowRange() const
+  {
+    return RangeLinear(static_cast<IndexLinear>(0), num_rows());
+  }
+  ///
+  RAJA_HOST_DEVICE RAJA_INLINE Rows rows() const
+  {
+    return Rows{*this};
+  }
+};
+
+template <typename Lambda, typename Layout_>
+struct CombiningAdapter<Lambda, Layout_>::Rows
+{
+  CombiningAdapter adapter;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(IndexLinear row) const
+  {
+    adapter.call_row(row);
+  }
 };
 
 /*!
@@ -0,0 +1,140 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining a compensated floating point sum.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_CompensatedSum_HPP
+#define RAJA_util_CompensatedSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace reduce
+{
+
+/*!
+ * \brief Floating point sum carrying a running compensation term.
+ *
+ * Values are added with the Kahan-Babuska (Neumaier) update, which keeps
+ * the rounding error of every addition in a separate compensation term, so
+ * the error of a long sum stays near one rounding of the result instead of
+ * growing with the number of terms. Combining two sums merges their
+ * (sum, compensation) pairs, so partial sums from threads and blocks keep
+ * their accuracy. It costs a few extra flops per addition and twice the
+ * storage, much less than reproducible_sum.
+ *
+ * The compensation is only kept if the compiler does not reassociate
+ * floating point operations, so do not use it with -ffast-math or similar.
+ */
+template <typename T>
+class compensated_sum
+{
+  static_assert(std::is_floating_point<T>::value,
+                "compensated_sum requires a floating point type");
+
+public:
+  using value_type = T;
+
+  RAJA_HOST_DEVICE
+  constexpr compensated_sum() : m_sum(0), m_comp(0) {}
+
+  RAJA_HOST_DEVICE
+  constexpr compensated_sum(T val) : m_sum(val), m_comp(0) {}
+
+  //! add a single value
+  RAJA_HOST_DEVICE
+  void deposit(T val)
+  {
+    const T t = m_sum + val;
+    if (magnitude(m_sum) >= magnitude(val)) {
+      m_comp += (m_sum - t) + val;
+    } else {
+      m_comp += (val - t) + m_sum;
+    }
+    m_sum = t;
+  }
+
+  //! add another sum
+  RAJA_HOST_DEVICE
+  compensated_sum& operator+=(compensated_sum const& rhs)
+  {
+    deposit(rhs.m_sum);
+    m_comp += rhs.m_comp;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  compensated_sum& operator+=(T rhs)
+  {
+    deposit(rhs);
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  friend compensated_sum operator+(compensated_sum lhs,
+                                   compensated_sum const& rhs)
+  {
+    lhs += rhs;
+    return lhs;
+  }
+
+  RAJA_HOST_DEVICE
+  friend bool operator==(compensated_sum const& lhs,
+                         compensated_sum const& rhs)
+  {
+    return lhs.m_sum == rhs.m_sum && lhs.m_comp == rhs.m_comp;
+  }
+
+  RAJA_HOST_DEVICE
+  friend bool operator!=(compensated_sum const& lhs,
+                         compensated_sum const& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //! the compensated result
+  RAJA_HOST_DEVICE
+  T value() const { return m_sum + m_comp; }
+
+  //! the running sum without the compensation
+  RAJA_HOST_DEVICE
+  T sum() const { return m_sum; }
+
+  //! the accumulated rounding error of the running sum
+  RAJA_HOST_DEVICE
+  T compensation() const { return m_comp; }
+
+  RAJA_HOST_DEVICE
+  explicit operator T() const { return value(); }
+
+private:
+  T m_sum;
+  T m_comp;
+
+  RAJA_HOST_DEVICE
+  static constexpr T magnitude(T val) { return val < T(0) ? -val : val; }
+};
+
+}  // namespace reduce
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,281 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a View pointer type that stores values
+ *          in a narrower type than they are accessed in.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_COMPRESSED_PTR_HPP
+#define RAJA_COMPRESSED_PTR_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "RAJA/util/half.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief Signed fixed point storage type, with FRAC_BITS of the bits of
+ * IntType after the binary point.
+ *
+ * Values convert from double rounding to nearest, and saturate at the
+ * limits of IntType.  All arithmetic is done in the type they convert to.
+ *
+ *     // values in [-1, 1) with a resolution of 2^-15
+ *     using q15_t = RAJA::fixed_point_t<std::int16_t, 15>;
+ */
+template <typename IntType, int FRAC_BITS>
+struct fixed_point_t {
+  static_assert(std::is_integral<IntType>::value && std::is_signed<IntType>::value,
+                "fixed_point_t stores values in a signed integral type");
+  static_assert(FRAC_BITS >= 0 &&
+                    FRAC_BITS < std::numeric_limits<IntType>::digits + 1,
+                "fixed_point_t has more fraction bits than IntType");
+
+  using int_type = IntType;
+
+  static constexpr int frac_bits = FRAC_BITS;
+
+  IntType bits;
+
+  fixed_point_t() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE fixed_point_t(double d) : bits(from_double(d))
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator double() const
+  {
+    return static_cast<double>(bits) / scale();
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE static fixed_point_t from_bits(IntType b)
+  {
+    fixed_point_t f;
+    f.bits = b;
+    return f;
+  }
+
+private:
+  RAJA_HOST_DEVICE RAJA_INLINE static constexpr double scale()
+  {
+    return static_cast<double>(std::uint64_t(1) << FRAC_BITS);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE static IntType from_double(double d)
+  {
+    constexpr double max_v = static_cast<double>(std::numeric_limits<IntType>::max());
+    constexpr double min_v = static_cast<double>(std::numeric_limits<IntType>::min());
+    double v = d * scale();
+    v = v < 0 ? v - 0.5 : v + 0.5;
+    // also maps nans to zero
+    return v >= max_v ? std::numeric_limits<IntType>::max()
+           : v <= min_v ? std::numeric_limits<IntType>::min()
+           : v == v ? static_cast<IntType>(v)
+           : IntType(0);
+  }
+};
+
+template <typename IntType, int FRAC_BITS>
+constexpr int fixed_point_t<IntType, FRAC_BITS>::frac_bits;
+
+
+/*!
+ * @brief Reference to a value of a CompressedPtr, which converts to
+ * ValueType when read and from ValueType when written.
+ */
+template <typename ValueType, typename StorageType>
+class CompressedRef
+{
+public:
+  using value_type = ValueType;
+  using storage_type = StorageType;
+
+private:
+  StorageType *m_ptr;
+
+public:
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr explicit CompressedRef(StorageType *ptr) : m_ptr(ptr) {}
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr CompressedRef(CompressedRef const &) = default;
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  ValueType get() const { return static_cast<ValueType>(*m_ptr); }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  operator ValueType() const { return get(); }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  CompressedRef const &operator=(ValueType v) const
+  {
+    *m_ptr = static_cast<StorageType>(v);
+    return *this;
+  }
+
+  //! Assigns the value of rhs, not the reference
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  CompressedRef const &operator=(CompressedRef const &rhs) const
+  {
+    return *this = rhs.get();
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  CompressedRef const &operator+=(ValueType v) const
+  {
+    return *this = get() + v;
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  CompressedRef const &operator-=(ValueType v) const
+  {
+    return *this = get() - v;
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  CompressedRef const &operator*=(ValueType v) const
+  {
+    return *this = get() * v;
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  CompressedRef const &operator/=(ValueType v) const
+  {
+    return *this = get() / v;
+  }
+};
+
+
+/*!
+ * @brief Pointer type for Views that store values as StorageType, and
+ *        present them as ValueType.
+ *
+ * Memory bound kernels move every value of a field each time they read it,
+ * and fields that tolerate less precision, such as material fractions, can
+ * be kept in float, RAJA::expt::half_t, RAJA::expt::bfloat16_t or a
+ * RAJA::fixed_point_t while the kernel computes in double:
+ *
+ *     using view_t = RAJA::View<double, RAJA::Layout<2>,
+ *                               RAJA::CompressedPtr<double, float>>;
+ *     view_t vf(float_data, N, M);
+ *
+ *     vf(i, j) = 0.5 * vf(i, j);   // loads float, computes and stores double
+ *
+ * or with the RAJA::CompressedView alias.  Values are converted with
+ * static_cast, which rounds, on every store.
+ *
+ * Accesses return a CompressedRef instead of a ValueType&, which supports
+ * reads, assignment and the compound assignments, but can not be bound to a
+ * ValueType&.  Tensor accesses are not supported; simd loops over compressed
+ * Views vectorize their conversions.  A const ValueType gives a read only
+ * View whose accesses return values.
+ */
+template <typename ValueType, typename StorageType>
+class CompressedPtr
+{
+public:
+  using value_type = typename std::remove_const<ValueType>::type;
+  using storage_type =
+      typename std::conditional<std::is_const<ValueType>::value,
+                                StorageType const,
+                                StorageType>::type;
+  using element_type = ValueType;
+
+  using reference =
+      typename std::conditional<std::is_const<ValueType>::value,
+                                value_type,
+                                CompressedRef<value_type, StorageType>>::type;
+
+  static_assert(!std::is_const<StorageType>::value,
+                "CompressedPtr takes const from ValueType");
+
+private:
+  storage_type *m_ptr;
+
+public:
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr CompressedPtr() : m_ptr(nullptr) {}
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr CompressedPtr(storage_type *ptr) : m_ptr(ptr) {}
+
+  /*!
+   * Conversion to a CompressedPtr of const data
+   */
+  template <typename U,
+            typename std::enable_if<
+                std::is_same<typename std::remove_const<U>::type, value_type>::value &&
+                    std::is_const<ValueType>::value,
+                bool>::type = true>
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr CompressedPtr(
+      CompressedPtr<U, StorageType> const &rhs)
+      : m_ptr(rhs.get())
+  {
+  }
+
+  /*!
+   * Returns the pointer to the stored values
+   */
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr storage_type *get() const { return m_ptr; }
+
+  template <typename IDX>
+  RAJA_HOST_DEVICE RAJA_INLINE reference operator[](IDX i) const
+  {
+    return make_reference(m_ptr + i);
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  reference operator*() const { return make_reference(m_ptr); }
+
+private:
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  static value_type make_reference(StorageType const *p)
+  {
+    return static_cast<value_type>(*p);
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  static CompressedRef<value_type, StorageType> make_reference(StorageType *p)
+  {
+    return CompressedRef<value_type, StorageType>(p);
+  }
+};
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,405 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining an open addressing hash map for
+ *          concurrent insertion inside RAJA loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ConcurrentHashMap_HPP
+#define RAJA_util_ConcurrentHashMap_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief Device copyable handle of the slots of a ConcurrentHashMap, used
+ *        to insert and find keys inside RAJA loops.
+ *
+ * Slots are claimed with atomicCAS on the key, and linear probing moves to
+ * the next slot when a slot holds another key.  Keys are never removed, so
+ * a key keeps its slot until the map is cleared or rehashed, and the slot
+ * index may be used as a dense id of the key, for example to number
+ * deduplicated nodes.
+ *
+ * The value of a new key is stored after its slot is claimed, so a find in
+ * the same loop as an insert may see the key before its value; loops that
+ * need the values of keys inserted by other threads should read them in a
+ * later loop, or use insert_or_add, which only uses atomics on the value.
+ */
+template <typename Key, typename Value, typename AtomicPolicy>
+class ConcurrentHashMapView
+{
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = size_t;
+
+  //! returned by insert when the map is full and by find when the key is
+  //  not in the map
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+  ConcurrentHashMapView() = default;
+
+  ConcurrentHashMapView(Key* keys,
+                        Value* values,
+                        size_type capacity,
+                        Key empty_key)
+      : m_keys(keys),
+        m_values(values),
+        m_mask(capacity - 1),
+        m_empty_key(empty_key)
+  {
+  }
+
+  RAJA_HOST_DEVICE size_type capacity() const { return m_mask + 1; }
+
+  RAJA_HOST_DEVICE Key empty_key() const { return m_empty_key; }
+
+  /*!
+   * Inserts key with value if key is not in the map, returns the slot of
+   * key, or npos if the map is full.  The value of a key that is already in
+   * the map is not changed.
+   */
+  RAJA_HOST_DEVICE size_type insert(Key key, Value const& value) const
+  {
+    bool inserted = false;
+    size_type slot = claim(key, inserted);
+    if (inserted) {
+      m_values[slot] = value;
+    }
+    return slot;
+  }
+
+  /*!
+   * Adds value to the value of key with AtomicPolicy, inserting key with a
+   * value of Value() first if key is not in the map.  Returns the slot of
+   * key, or npos if the map is full.
+   */
+  RAJA_HOST_DEVICE size_type insert_or_add(Key key, Value value) const
+  {
+    bool inserted = false;
+    size_type slot = claim(key, inserted);
+    if (slot != npos) {
+      RAJA::atomicAdd<AtomicPolicy>(&m_values[slot], value);
+    }
+    return slot;
+  }
+
+  //! The slot of key, or npos if key is not in the map
+  RAJA_HOST_DEVICE size_type find(Key key) const
+  {
+    size_type slot = hash(key) & m_mask;
+    for (size_type probe = 0; probe <= m_mask; ++probe) {
+      const Key k = load_key(slot);
+      if (k == key) {
+        return slot;
+      }
+      if (k == m_empty_key) {
+        return npos;
+      }
+      slot = (slot + 1) & m_mask;
+    }
+    return npos;
+  }
+
+  RAJA_HOST_DEVICE bool contains(Key key) const { return find(key) != npos; }
+
+  //! The key in slot, empty_key() if the slot is empty
+  RAJA_HOST_DEVICE Key key_at(size_type slot) const { return m_keys[slot]; }
+
+  RAJA_HOST_DEVICE Value& value_at(size_type slot) const
+  {
+    return m_values[slot];
+  }
+
+  RAJA_HOST_DEVICE bool occupied(size_type slot) const
+  {
+    return m_keys[slot] != m_empty_key;
+  }
+
+  //! Mixes the bits of key, the murmur3 64-bit finalizer
+  RAJA_HOST_DEVICE static size_type hash(Key key)
+  {
+    unsigned long long h = static_cast<unsigned long long>(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return static_cast<size_type>(h);
+  }
+
+private:
+  RAJA_HOST_DEVICE Key load_key(size_type slot) const
+  {
+    return static_cast<Key volatile*>(m_keys)[slot];
+  }
+
+  RAJA_HOST_DEVICE size_type claim(Key key, bool& inserted) const
+  {
+    size_type slot = hash(key) & m_mask;
+    for (size_type probe = 0; probe <= m_mask; ++probe) {
+      Key k = load_key(slot);
+      if (k == m_empty_key) {
+        k = RAJA::atomicCAS<AtomicPolicy>(&m_keys[slot], m_empty_key, key);
+        if (k == m_empty_key) {
+          inserted = true;
+          return slot;
+        }
+      }
+      if (k == key) {
+        return slot;
+      }
+      slot = (slot + 1) & m_mask;
+    }
+    return npos;
+  }
+
+  Key* m_keys = nullptr;
+  Value* m_values = nullptr;
+  size_type m_mask = 0;
+  Key m_empty_key = Key();
+};
+
+template <typename Key, typename Value, typename AtomicPolicy>
+constexpr typename ConcurrentHashMapView<Key, Value, AtomicPolicy>::size_type
+    ConcurrentHashMapView<Key, Value, AtomicPolicy>::npos;
+
+
+/*!
+ * @brief Open addressing hash map of integer keys whose slots may be filled
+ *        concurrently inside RAJA loops, with sizing done on the host
+ *        between loops.
+ *
+ * The slots are allocated from mempool, so with a device mempool and a gpu
+ * ExecPolicy and AtomicPolicy the map lives on the device.  ExecPolicy runs
+ * the loops of clear, size and rehash.  Loops insert and find through a
+ * view, which is copied into their lambdas:
+ *
+ *     using map_type = RAJA::ConcurrentHashMap<long, int,
+ *                                              RAJA::cuda_exec<256>,
+ *                                              RAJA::cuda_atomic,
+ *                                              RAJA::cuda::device_mempool_type>;
+ *     map_type nodes(2 * num_elems);
+ *
+ *     nodes.reserve(num_elems * 4);
+ *     auto view = nodes.view();
+ *     RAJA::forall<RAJA::cuda_exec<256>>(elems, [=] RAJA_DEVICE(int e) {
+ *       for (int j = 0; j < 4; ++j) {
+ *         view.insert(node_key(e, j), e);
+ *       }
+ *     });
+ *     size_t unique_nodes = nodes.size();
+ *
+ * The map holds at most max_load_factor * capacity() keys with short probe
+ * sequences; reserve rehashes on the host to keep the load below that, and
+ * insert returns npos when there is no free slot at all.  Keys must be
+ * integers of 4 or 8 bytes, and empty_key must not be used as a key.
+ * rehash moves the keys to new slots, so slot indices and views from before
+ * a rehash are not valid after it.
+ */
+template <typename Key,
+          typename Value,
+          typename ExecPolicy,
+          typename AtomicPolicy,
+          typename mempool = RAJA::basic_mempool::MemPool<
+              RAJA::basic_mempool::generic_allocator>>
+class ConcurrentHashMap
+{
+  static_assert(std::is_integral<Key>::value &&
+                    (sizeof(Key) == 4 || sizeof(Key) == 8),
+                "ConcurrentHashMap keys must be 4 or 8 byte integers");
+
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = size_t;
+  using view_type = ConcurrentHashMapView<Key, Value, AtomicPolicy>;
+
+  static constexpr size_type npos = view_type::npos;
+
+  static constexpr double max_load_factor = 0.5;
+
+  //! Empty map with at least capacity slots, rounded up to a power of two
+  explicit ConcurrentHashMap(
+      size_type capacity,
+      Key empty_key = std::numeric_limits<Key>::max())
+      : m_empty_key(empty_key)
+  {
+    allocate(round_capacity(capacity));
+    clear();
+  }
+
+  ConcurrentHashMap(ConcurrentHashMap const&) = delete;
+  ConcurrentHashMap& operator=(ConcurrentHashMap const&) = delete;
+
+  ~ConcurrentHashMap() { deallocate(); }
+
+  //! Handle used to insert and find keys inside loops, see
+  //  ConcurrentHashMapView
+  view_type view() const
+  {
+    return view_type(m_keys, m_values, m_capacity, m_empty_key);
+  }
+
+  size_type capacity() const { return m_capacity; }
+
+  Key empty_key() const { return m_empty_key; }
+
+  //! Removes all the keys, the values of the slots are set to Value()
+  void clear()
+  {
+    Key* keys = m_keys;
+    Value* values = m_values;
+    const Key empty_key = m_empty_key;
+    RAJA::forall<ExecPolicy>(
+        RAJA::TypedRangeSegment<size_type>(0, m_capacity),
+        [=] RAJA_HOST_DEVICE(size_type slot) {
+          keys[slot] = empty_key;
+          values[slot] = Value();
+        });
+  }
+
+  //! Number of keys in the map, counted with a loop over the slots
+  size_type size() const
+  {
+    view_type map = view();
+    size_type count = 0;
+    RAJA::forall<ExecPolicy>(
+        RAJA::TypedRangeSegment<size_type>(0, m_capacity),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&count),
+        [=] RAJA_HOST_DEVICE(size_type slot, size_type& c) {
+          c += map.occupied(slot) ? 1 : 0;
+        });
+    return count;
+  }
+
+  /*!
+   * Rehashes into a larger map if inserting num_new more keys could take
+   * the map past max_load_factor, returns true if it rehashed
+   */
+  bool reserve(size_type num_new)
+  {
+    const size_type needed = size() + num_new;
+    if (static_cast<double>(needed) <=
+        max_load_factor * static_cast<double>(m_capacity)) {
+      return false;
+    }
+    rehash(static_cast<size_type>(static_cast<double>(needed) /
+                                  max_load_factor) +
+           1);
+    return true;
+  }
+
+  /*!
+   * Moves the keys and values into new slots, at least capacity of them
+   * and enough for the keys in the map
+   */
+  void rehash(size_type capacity)
+  {
+    Key* old_keys = m_keys;
+    Value* old_values = m_values;
+    const size_type old_capacity = m_capacity;
+    const size_type num_keys = size();
+
+    allocate(round_capacity(capacity > num_keys ? capacity : num_keys));
+    clear();
+
+    view_type map = view();
+    const Key empty_key = m_empty_key;
+    RAJA::forall<ExecPolicy>(
+        RAJA::TypedRangeSegment<size_type>(0, old_capacity),
+        [=] RAJA_HOST_DEVICE(size_type slot) {
+          if (old_keys[slot] != empty_key) {
+            map.insert(old_keys[slot], old_values[slot]);
+          }
+        });
+
+    mempool::getInstance().free(old_keys);
+    mempool::getInstance().free(old_values);
+  }
+
+private:
+  static size_type round_capacity(size_type capacity)
+  {
+    size_type rounded = 1;
+    while (rounded < capacity) {
+      rounded <<= 1;
+    }
+    return rounded;
+  }
+
+  void allocate(size_type capacity)
+  {
+    m_keys = mempool::getInstance().template malloc<Key>(capacity);
+    m_values = mempool::getInstance().template malloc<Value>(capacity);
+    if (m_keys == nullptr || m_values == nullptr) {
+      throw std::bad_alloc();
+    }
+    m_capacity = capacity;
+  }
+
+  void deallocate()
+  {
+    mempool::getInstance().free(m_keys);
+    mempool::getInstance().free(m_values);
+    m_keys = nullptr;
+    m_values = nullptr;
+    m_capacity = 0;
+  }
+
+  Key* m_keys = nullptr;
+  Value* m_values = nullptr;
+  size_type m_capacity = 0;
+  Key m_empty_key;
+};
+
+template <typename Key,
+          typename Value,
+          typename ExecPolicy,
+          typename AtomicPolicy,
+          typename mempool>
+constexpr typename ConcurrentHashMap<Key,
+                                     Value,
+                                     ExecPolicy,
+                                     AtomicPolicy,
+                                     mempool>::size_type
+    ConcurrentHashMap<Key, Value, ExecPolicy, AtomicPolicy, mempool>::npos;
+
+template <typename Key,
+          typename Value,
+          typename ExecPolicy,
+          typename AtomicPolicy,
+          typename mempool>
+constexpr double
+    ConcurrentHashMap<Key, Value, ExecPolicy, AtomicPolicy, mempool>::
+        max_load_factor;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
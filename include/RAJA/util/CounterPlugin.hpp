@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Counter_Plugin_HPP
+#define RAJA_Counter_Plugin_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that counts hardware events of every host loop, kernel and
+   * launch with the Linux perf_event interface.
+   *
+   * The plugin is active when the environment variable RAJA_COUNTERS lists
+   * the events to count, separated by commas, or when init_plugins is given
+   * an options string "counters=<events>". The events are the perf names
+   * cycles, instructions, cache-references, cache-misses, branches,
+   * branch-misses, L1-dcache-load-misses, LLC-loads, LLC-load-misses and
+   * dTLB-load-misses, raw events written r<hex> as for perf, or default for
+   * cycles, instructions, cache-misses and LLC-load-misses.
+   *
+   * The events are counted on the thread that runs preLaunch and postLaunch,
+   * so the threads of OpenMP and TBB loops other than the calling thread are
+   * not counted. The counts are summed for each kernel name, launch site and
+   * policy and written at finalize() as CSV to the file named by
+   * RAJA_COUNTERS_FILE, raja-counters.csv by default.
+   */
+  class CounterPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    CounterPlugin();
+
+    void init(const RAJA::util::PluginOptions& p) override;
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! perf_event type and config of an event
+    struct Event {
+      std::string name;
+      uint32_t type;
+      uint64_t config;
+    };
+
+  private:
+    struct Aggregate {
+      size_t count{0};
+      size_t num_iterations{0};
+      size_t bytes{0};
+      size_t flops{0};
+      int64_t time_ns{0};
+      std::vector<uint64_t> values;
+    };
+
+    using Key = std::tuple<std::string, std::string, std::string>;
+
+    void configure(const std::string& events);
+
+    void write(const std::string& file) const;
+
+    bool m_active{false};
+    std::string m_file;
+    std::vector<Event> m_events;
+    //! changed by each configure, so threads reopen their counters
+    int m_generation{0};
+
+    std::mutex m_mutex;
+    std::map<Key, Aggregate> m_aggregates;
+  };  // end CounterPlugin class
+
+  void linkCounterPlugin();
+
+} // end namespace util
+} // end namespace RAJA
+
+#endif
@@ -0,0 +1,176 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a divisor with a precomputed
+ *          multiplier, to divide by a runtime constant without a divide
+ *          instruction.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_FastDivisor_HPP
+#define RAJA_util_FastDivisor_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! High half of the product of two 32-bit values
+RAJA_HOST_DEVICE RAJA_INLINE constexpr std::uint32_t mul_hi(std::uint32_t a,
+                                                           std::uint32_t b)
+{
+  return static_cast<std::uint32_t>((static_cast<std::uint64_t>(a) * b) >> 32);
+}
+
+//! High half of the product of two 64-bit values
+RAJA_HOST_DEVICE RAJA_INLINE std::uint64_t mul_hi(std::uint64_t a,
+                                                  std::uint64_t b)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __umul64hi(a, b);
+#elif defined(__SIZEOF_INT128__)
+  return static_cast<std::uint64_t>(
+      (static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+  const std::uint64_t a_lo = a & 0xffffffffu, a_hi = a >> 32;
+  const std::uint64_t b_lo = b & 0xffffffffu, b_hi = b >> 32;
+  const std::uint64_t lo_lo = a_lo * b_lo;
+  const std::uint64_t hi_lo = a_hi * b_lo;
+  const std::uint64_t lo_hi = a_lo * b_hi;
+  const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+  return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * @brief A positive divisor for non-negative values of an integer type,
+ * with the multiplier that replaces the division precomputed.
+ *
+ * n / d is computed as (t + ((n - t) >> 1)) >> (l - 1), with
+ * t = mul_hi(m, n), l = ceil(log2(d)) and
+ * m = floor(2^N * (2^l - d) / d) + 1 for the N bits of the unsigned type
+ * (Granlund and Montgomery, "Division by Invariant Integers using
+ * Multiplication"). This is one high multiply, a subtract, an add and two
+ * shifts, and is exact for every divisor and every non-negative value.
+ *
+ * Types of 32 bits or fewer use 32-bit arithmetic, larger types 64-bit.
+ */
+template <typename T>
+class FastDivisor
+{
+  static_assert(std::is_integral<T>::value,
+                "FastDivisor needs an integral type");
+
+public:
+  using value_type = T;
+  using unsigned_type = typename std::conditional<sizeof(T) <= 4,
+                                                  std::uint32_t,
+                                                  std::uint64_t>::type;
+
+  static constexpr int bits = 8 * sizeof(unsigned_type);
+
+  /*!
+   * Construct the divisor 1.
+   */
+  constexpr RAJA_INLINE FastDivisor() = default;
+
+  /*!
+   * Construct a divisor of d, which must be positive.
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr explicit FastDivisor(T d)
+      : m_divisor(d),
+        m_magic(compute_magic(static_cast<unsigned_type>(d),
+                              ceil_log2(static_cast<unsigned_type>(d)))),
+        m_shift1(ceil_log2(static_cast<unsigned_type>(d)) > 0 ? 1 : 0),
+        m_shift2(ceil_log2(static_cast<unsigned_type>(d)) > 0
+                     ? ceil_log2(static_cast<unsigned_type>(d)) - 1
+                     : 0)
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr T divisor() const
+  {
+    return m_divisor;
+  }
+
+  /*!
+   * The quotient n / d, for n >= 0.
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE T div(T n) const
+  {
+    const unsigned_type un = static_cast<unsigned_type>(n);
+    const unsigned_type t = detail::mul_hi(m_magic, un);
+    return static_cast<T>((t + ((un - t) >> m_shift1)) >> m_shift2);
+  }
+
+  /*!
+   * The remainder n % d, for n >= 0.
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE T mod(T n) const
+  {
+    return n - div(n) * m_divisor;
+  }
+
+private:
+  //! ceil(log2(d)), for d >= 1
+  RAJA_HOST_DEVICE static constexpr int ceil_log2(unsigned_type d)
+  {
+    int l = 0;
+    while (l < bits && (unsigned_type(1) << l) < d) {
+      ++l;
+    }
+    return l;
+  }
+
+  //! floor(2^bits * (2^l - d) / d) + 1, by long division
+  RAJA_HOST_DEVICE static constexpr unsigned_type compute_magic(
+      unsigned_type d,
+      int l)
+  {
+    if (d <= 1) {
+      return 1;
+    }
+    // 2^l - d, which is < d; wraps to the right value when l == bits
+    unsigned_type rem = (l < bits ? (unsigned_type(1) << l) : 0) - d;
+    unsigned_type quot = 0;
+    for (int b = 0; b < bits; ++b) {
+      const bool carry = (rem >> (bits - 1)) != 0;
+      rem <<= 1;
+      quot <<= 1;
+      if (carry || rem >= d) {
+        rem -= d;
+        quot |= 1;
+      }
+    }
+    return quot + 1;
+  }
+
+  T m_divisor = 1;
+  unsigned_type m_magic = 1;
+  int m_shift1 = 0;
+  int m_shift2 = 0;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
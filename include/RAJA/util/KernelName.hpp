@@ -0,0 +1,121 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining names passed to forall, kernel and launch
+ *          for profiling tools and plugins.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_KernelName_HPP
+#define RAJA_util_KernelName_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(RAJA_ENABLE_CUDA) && defined(RAJA_ENABLE_NV_TOOLS_EXT)
+#include "nvToolsExt.h"
+#endif
+
+#if defined(RAJA_ENABLE_HIP) && defined(RAJA_ENABLE_ROCTX)
+#include "roctx.h"
+#endif
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Name of a loop, passed to forall, kernel or launch.
+ *
+ * The name labels an NVTX or roctx range around the loop, when RAJA is
+ * built with RAJA_ENABLE_NV_TOOLS_EXT or RAJA_ENABLE_ROCTX, and is given to
+ * plugins in PluginContext::kernel_name. The string is not copied and must
+ * outlive the call. The bytes moved and flops done by the loop may be given
+ * too, which plugins get in PluginContext::bytes and PluginContext::flops.
+ */
+struct KernelName {
+  const char* name;
+  size_t bytes{0};
+  size_t flops{0};
+
+  constexpr explicit KernelName(const char* name_) : name(name_) {}
+
+  constexpr KernelName(const char* name_, size_t bytes_, size_t flops_)
+      : name(name_), bytes(bytes_), flops(flops_)
+  {
+  }
+};
+
+namespace detail
+{
+
+template <typename T>
+struct is_kernel_name : std::false_type {
+};
+
+template <>
+struct is_kernel_name<KernelName> : std::true_type {
+};
+
+}  // namespace detail
+
+}  // namespace expt
+
+namespace util
+{
+
+/*!
+ * \brief Profiler range labeled with a kernel name for the lifetime of the
+ *        object. Does nothing for a null name or without a profiler API.
+ */
+class ScopedKernelRange
+{
+public:
+  explicit ScopedKernelRange(const char* name) : m_name(name)
+  {
+    if (m_name) {
+#if defined(RAJA_ENABLE_CUDA) && defined(RAJA_ENABLE_NV_TOOLS_EXT)
+      nvtxRangePushA(m_name);
+#elif defined(RAJA_ENABLE_HIP) && defined(RAJA_ENABLE_ROCTX)
+      roctxRangePush(m_name);
+#endif
+    }
+  }
+
+  ScopedKernelRange(ScopedKernelRange const&) = delete;
+  ScopedKernelRange& operator=(ScopedKernelRange const&) = delete;
+
+  ~ScopedKernelRange()
+  {
+    if (m_name) {
+#if defined(RAJA_ENABLE_CUDA) && defined(RAJA_ENABLE_NV_TOOLS_EXT)
+      nvtxRangePop();
+#elif defined(RAJA_ENABLE_HIP) && defined(RAJA_ENABLE_ROCTX)
+      roctxRangePop();
+#endif
+    }
+  }
+
+private:
+  const char* m_name;
+};
+
+}  // namespace util
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -28,6 +28,7 @@
 
 #include "RAJA/internal/foldl.hpp"
 
+#include "RAJA/util/FastDivisor.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
 
@@ -82,6 +83,8 @@ public:
   IdxLin strides[n_dims] = {0};
   IdxLin inv_strides[n_dims] = {0};
   IdxLin inv_mods[n_dims] = {0};
+  FastDivisor<IdxLin> div_strides[n_dims];
+  FastDivisor<IdxLin> div_mods[n_dims];
 
 
   /*!
@@ -105,7 +108,9 @@ public:
             sizes[RangeInts] ? IdxLin(1) : IdxLin(0),
             sizes))...},
         inv_strides{(strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
-        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
+        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...},
+        div_strides{FastDivisor<IdxLin>(inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(inv_mods[RangeInts])...}
   {
     static_assert(n_dims == sizeof...(Types),
                   "number of dimensions must match");
@@ -121,7 +126,9 @@ public:
       : sizes{static_cast<IdxLin>(rhs.sizes[RangeInts])...},
         strides{static_cast<IdxLin>(rhs.strides[RangeInts])...},
         inv_strides{static_cast<IdxLin>(rhs.inv_strides[RangeInts])...},
-        inv_mods{static_cast<IdxLin>(rhs.inv_mods[RangeInts])...}
+        inv_mods{static_cast<IdxLin>(rhs.inv_mods[RangeInts])...},
+        div_strides{FastDivisor<IdxLin>(inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(inv_mods[RangeInts])...}
   {
   }
 
@@ -136,7 +143,9 @@ public:
       : sizes{sizes_in[RangeInts]...},
         strides{strides_in[RangeInts]...},
         inv_strides{(strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
-        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
+        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...},
+        div_strides{FastDivisor<IdxLin>(inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(inv_mods[RangeInts])...}
   {
   }
 
@@ -197,9 +206,11 @@ public:
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * The divisions use the divisors precomputed with the layout, so this
+   * operation requires 2n high multiplies instead of 2n integer divides.
    *
-   * @param linear_index  Linear space index to be converted to indices.
+   * @param linear_index  Linear space index to be converted to indices,
+   *                      which must not be negative.
    * @param indices  Variadic list of indices to be assigned, number must match
    *                 dimensionality of this layout.
    */
@@ -217,8 +228,8 @@ public:
 #endif
 
     camp::sink((indices =
-      (camp::decay<Indices>)((linear_index / inv_strides[RangeInts]) %
-                             inv_mods[RangeInts]))...);
+      (camp::decay<Indices>)(div_mods[RangeInts].mod(
+          div_strides[RangeInts].div(linear_index))))...);
   }
 
   /*!
@@ -270,6 +281,24 @@ public:
   IndexLinear get_dim_begin() const {
     return 0;
   }
+
+  /*!
+   * Layout of a box of sizes_in indices inside this layout, with the same
+   * strides, as used by View::sub_view.  The divisors of this layout are
+   * kept, and are still correct for the box, so unlike constructing a layout
+   * this computes none; toIndices of the box gives indices relative to it.
+   *
+   * Projected dimensions stay projected.
+   */
+  RAJA_INLINE LayoutBase_impl
+  sub_layout(const std::array<IdxLin, n_dims> &sizes_in) const
+  {
+    LayoutBase_impl ret(*this);
+    for (size_t i = 0; i < n_dims; ++i) {
+      ret.sizes[i] = sizes[i] ? sizes_in[i] : IdxLin(0);
+    }
+    return ret;
+  }
 };
 
 template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
@@ -367,9 +396,11 @@ struct TypedLayout<IdxLin, camp::tuple<DimTypes...>, StrideOne>
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * The divisions use the divisors precomputed with the layout, so this
+   * operation requires 2n high multiplies instead of 2n integer divides.
    *
-   * @param linear_index  Linear space index to be converted to indices.
+   * @param linear_index  Linear space index to be converted to indices,
+   *                      which must not be negative.
    * @param indices  Variadic list of indices to be assigned, number must match
    *                 dimensionality of this layout.
    */
@@ -67,6 +67,18 @@ namespace internal {
   using getStaticLayoutType = typename StaticLayoutHelper<Perm, Sizes>::type;
 
 
+  template<typename Perm, typename Sizes, typename Padding>
+  struct PaddedStaticLayoutHelper;
+
+  template<camp::idx_t ... Perm, Index_type ...Sizes, Index_type ...Padding>
+  struct PaddedStaticLayoutHelper<camp::idx_seq<Perm...>, SizeList<Sizes...>, SizeList<Padding...>>{
+      using type =  PaddedStaticLayout<camp::idx_seq<Perm...>, camp::idx_seq<Padding...>, Sizes...>;
+  };
+
+  template<typename Perm, typename Sizes, typename Padding>
+  using getPaddedStaticLayoutType = typename PaddedStaticLayoutHelper<Perm, Sizes, Padding>::type;
+
+
 
 }
 
@@ -81,6 +93,28 @@ using LocalArray =
     internal::TypedViewBase<ValueType, ValueType *, internal::getStaticLayoutType<Perm, Sizes>, internal::getDefaultIndexTypes<Perm> >;
 
 
+/*!
+ * Local arrays whose dimensions are stored with Padding, a SizeList of one
+ * padding per dimension.  Transposes through a power of two tile read one
+ * of its columns, and padding the stride one dimension puts the values of
+ * the column in different shared memory banks or cache sets:
+ *
+ *   using Tile = RAJA::PaddedLocalArray<double, RAJA::Perm<0, 1>,
+ *                                       RAJA::SizeList<32, 32>,
+ *                                       RAJA::SizeList<0, 1>>;
+ *
+ * The index space is that of Sizes, and the allocation includes the padding.
+ */
+template<typename ValueType, typename Perm, typename Sizes, typename Padding, typename... IndexTypes>
+using TypedPaddedLocalArray =
+    internal::TypedViewBase<ValueType, ValueType *, internal::getPaddedStaticLayoutType<Perm, Sizes, Padding>, camp::list<IndexTypes...> >;
+
+
+template<typename ValueType, typename Perm, typename Sizes, typename Padding>
+using PaddedLocalArray =
+    internal::TypedViewBase<ValueType, ValueType *, internal::getPaddedStaticLayoutType<Perm, Sizes, Padding>, internal::getDefaultIndexTypes<Perm> >;
+
+
 
 
 
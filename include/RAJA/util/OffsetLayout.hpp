@@ -145,7 +145,7 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
   RAJA_HOST_DEVICE
   constexpr
   IndexLinear get_dim_stride() const {
-    return base_.get_dim_stride();
+    return base_.template get_dim_stride<DIM>();
   }
 
   template<camp::idx_t DIM>
@@ -153,7 +153,7 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
   RAJA_HOST_DEVICE
   constexpr
   IndexLinear get_dim_size() const {
-    return base_.get_dim_size();
+    return base_.template get_dim_size<DIM>();
   }
 
   template<camp::idx_t DIM>
@@ -163,6 +163,16 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
   IndexLinear get_dim_begin() const {
     return offsets[DIM];
   }
+
+  /*!
+   * Zero based layout of a box of sizes_in indices inside this layout, with
+   * the same strides, see LayoutBase_impl::sub_layout
+   */
+  RAJA_INLINE Base
+  sub_layout(const std::array<IdxLin, sizeof...(RangeInts)> &sizes_in) const
+  {
+    return base_.sub_layout(sizes_in);
+  }
 };
 
 }  // namespace internal
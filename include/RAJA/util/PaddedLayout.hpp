@@ -0,0 +1,213 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining Layouts with padded strides, to avoid
+ *          cache set and memory bank conflicts
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PADDEDLAYOUT_HPP
+#define RAJA_PADDEDLAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/Permutations.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Layout of sizes, with the strides of storage_sizes in the order of
+ * permutation
+ */
+template <size_t Rank, typename IdxLin>
+Layout<Rank, IdxLin> make_storage_layout(
+    std::array<IdxLin, Rank> const &sizes,
+    std::array<IdxLin, Rank> const &storage_sizes,
+    std::array<camp::idx_t, Rank> const &permutation)
+{
+  std::array<IdxLin, Rank> strides;
+  IdxLin stride = 1;
+  for (size_t i = Rank; i-- > 0;) {
+    camp::idx_t dim = permutation[i];
+    // If the size of dimension i is zero, then the stride is zero
+    strides[dim] = sizes[dim] ? stride : 0;
+    stride *= sizes[dim] ? storage_sizes[dim] : 1;
+  }
+
+  auto ret = Layout<Rank, IdxLin>();
+  for (size_t i = 0; i < Rank; ++i) {
+    ret.sizes[i] = sizes[i];
+    ret.strides[i] = strides[i];
+    ret.inv_strides[i] = strides[i] ? strides[i] : 1;
+    // toIndices wraps each index at its storage size, so the padding of
+    // inner dimensions is skipped
+    ret.inv_mods[i] = sizes[i] ? storage_sizes[i] : 1;
+    ret.div_strides[i] = FastDivisor<IdxLin>(ret.inv_strides[i]);
+    ret.div_mods[i] = FastDivisor<IdxLin>(ret.inv_mods[i]);
+  }
+  return ret;
+}
+
+template <typename IdxLin>
+IdxLin padding_gcd(IdxLin a, IdxLin b)
+{
+  while (b != 0) {
+    IdxLin t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+}  // namespace detail
+
+
+/*!
+ * @brief Creates a Layout whose dimensions are stored with padding.
+ *
+ * Dimension i holds sizes[i] indices, but is stored as sizes[i]+padding[i]
+ * values, so only the strides of the dimensions outside it change.  Power
+ * of two extents put the rows of an array at addresses that map to the same
+ * cache sets or memory banks, and a column walk then evicts its own lines;
+ * one value of padding spreads the rows out:
+ *
+ *     // 1024x1024 array with rows of 1025 values
+ *     Layout<2> layout = make_padded_layout<2>({1024, 1024}, {0, 1});
+ *
+ *     // the same, with a permutation as in make_permuted_layout
+ *     Layout<2> layout = make_padded_layout({1024, 1024}, {0, 1},
+ *                                           as_array<PERM_IJ>::get());
+ *
+ * The padding is never indexed, and toIndices skips it.  size() is still
+ * the number of indices; allocate layout_storage_size(layout) values.
+ */
+template <size_t Rank, typename IdxLin = Index_type>
+auto make_padded_layout(std::array<IdxLin, Rank> sizes,
+                        std::array<IdxLin, Rank> padding,
+                        std::array<camp::idx_t, Rank> permutation)
+    -> Layout<Rank, IdxLin>
+{
+  std::array<IdxLin, Rank> storage_sizes;
+  for (size_t i = 0; i < Rank; ++i) {
+    storage_sizes[i] = sizes[i] + padding[i];
+  }
+  return detail::make_storage_layout(sizes, storage_sizes, permutation);
+}
+
+template <size_t Rank, typename IdxLin = Index_type>
+auto make_padded_layout(std::array<IdxLin, Rank> sizes,
+                        std::array<IdxLin, Rank> padding)
+    -> Layout<Rank, IdxLin>
+{
+  return make_padded_layout(sizes,
+                            padding,
+                            RAJA::as_array<camp::make_idx_seq_t<Rank>>::get());
+}
+
+
+/*!
+ * @brief Creates a Layout padded so that its strides do not conflict.
+ *
+ * Accesses conflict when their addresses differ by a multiple of period
+ * values: for a set associative cache that is its size divided by its
+ * associativity, and for GPU shared memory the number of banks.  Each
+ * dimension but the outermost is padded, from the stride one dimension out,
+ * until the stride outside it shares no more factors with period than
+ * align does, so strided walks touch as many sets or banks as they can.
+ *
+ * The stride one dimension is also padded to a multiple of align, which
+ * keeps rows aligned for vector loads.  For example, with 32 KiB 8-way L1
+ * caches and 64 byte lines:
+ *
+ *     // 4 KiB / 8 bytes = 512 doubles, rows aligned to 8 doubles
+ *     Layout<2> layout = make_conflict_free_layout({1024, 1024},
+ *                                                  as_array<PERM_IJ>::get(),
+ *                                                  512, 8);
+ *
+ * gives rows of 1032 values.  As with make_padded_layout, allocate
+ * layout_storage_size(layout) values.
+ *
+ * @param sizes  Sizes of the dimensions
+ * @param permutation  Striding order, as in make_permuted_layout
+ * @param conflict_period  Conflict period, in values
+ * @param conflict_align  Alignment of the stride one dimension, in values
+ */
+template <size_t Rank, typename IdxLin = Index_type>
+auto make_conflict_free_layout(std::array<IdxLin, Rank> sizes,
+                               std::array<camp::idx_t, Rank> permutation,
+                               Index_type conflict_period,
+                               Index_type conflict_align = 1)
+    -> Layout<Rank, IdxLin>
+{
+  std::array<IdxLin, Rank> storage_sizes = sizes;
+  IdxLin period = static_cast<IdxLin>(conflict_period);
+  IdxLin align = conflict_align < 1 ? IdxLin(1) : static_cast<IdxLin>(conflict_align);
+
+  if (period > 1) {
+    IdxLin limit = detail::padding_gcd(align, period);
+    IdxLin stride = 1;
+    for (size_t i = Rank; i-- > 1;) {
+      camp::idx_t dim = permutation[i];
+      // projected dimensions have no stride to pad
+      if (sizes[dim] == 0) {
+        continue;
+      }
+
+      IdxLin step = stride == 1 ? align : 1;
+      IdxLin extent = (sizes[dim] + step - 1) / step * step;
+      while (detail::padding_gcd(stride * extent, period) > limit) {
+        extent += step;
+      }
+
+      storage_sizes[dim] = extent;
+      stride *= extent;
+    }
+  }
+
+  return detail::make_storage_layout(sizes, storage_sizes, permutation);
+}
+
+
+/*!
+ * @brief Number of values a View of layout needs, including the padding of
+ * padded layouts.
+ *
+ * That is one more than the largest linear index, or size() for dense
+ * layouts.
+ */
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+RAJA_INLINE IdxLin layout_storage_size(
+    detail::LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim> const
+        &layout)
+{
+  IdxLin last = 0;
+  for (size_t i = 0; i < sizeof...(RangeInts); ++i) {
+    if (layout.sizes[i] > 0) {
+      last += (layout.sizes[i] - 1) * layout.strides[i];
+    }
+  }
+  return last + 1;
+}
+
+}  // namespace RAJA
+
+#endif
@@ -8,31 +8,201 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/KernelName.hpp"
+#include "RAJA/util/resource.hpp"
 
 namespace RAJA {
 namespace util {
 
 class KokkosPluginLoader;
 
+//! RAJA method that runs the loop of a PluginContext
+enum class KernelPattern { undefined, forall, kernel, launch, workgroup };
+
+//! Readable form of a typeid name, or the name if it can't be demangled
+inline std::string demangle(const char* name)
+{
+  if (name == nullptr) {
+    return std::string();
+  }
+#if defined(__GNUG__)
+  int status = 0;
+  char* readable = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status == 0 && readable != nullptr) {
+    std::string result(readable);
+    std::free(readable);
+    return result;
+  }
+#endif
+  return std::string(name);
+}
+
+/*!
+ * Description of a loop given to the plugins. Filling it in only copies
+ * sizes and static strings, so it costs next to nothing when no plugin is
+ * registered, and the policy name is only demangled when a plugin asks.
+ */
 struct PluginContext {
   public:
-    PluginContext(const Platform p) :
-      platform(p) {}
+    PluginContext(const Platform p, const char* name = nullptr) :
+      platform(p), kernel_name(name) {}
 
     Platform platform;
 
+    //! Name given to the loop with RAJA::expt::KernelName, or null
+    const char* kernel_name;
+
+    KernelPattern pattern{KernelPattern::undefined};
+
+    //! Iterations of the loop, the product of the segment lengths of a
+    //! kernel or the teams times threads of a launch, or 0 if unknown
+    size_t num_iterations{0};
+
+    //! typeid name of the execution policy, or null
+    const char* policy_name{nullptr};
+
+    //! typeid name of the loop body types, which differs for each lambda
+    //! and so names the launch site, or null
+    const char* launch_site{nullptr};
+
+    //! GPU blocks and threads of each dimension, for forall with a GPU
+    //! policy of static block size and for launch, or 0 if unknown
+    size_t teams[3] = {0, 0, 0};
+    size_t threads[3] = {0, 0, 0};
+
+    //! Bytes moved and flops done by the loop as declared by the user with
+    //! RAJA::expt::KernelName or RAJA::expt::Grid, or 0
+    size_t bytes{0};
+    size_t flops{0};
+
+    //! Demangled policy_name
+    std::string policy() const { return demangle(policy_name); }
+
+    //! Set the resource the loop runs on, which must outlive the context
+    template <typename Res>
+    void set_resource(Res& res)
+    {
+      m_resource = &res;
+      m_get_resource = &erase_resource<Res>;
+    }
+
+    bool has_resource() const { return m_resource != nullptr; }
+
+    //! Resource the loop runs on, only valid if has_resource()
+    resources::Resource get_resource() const
+    {
+      return m_get_resource(m_resource);
+    }
+
   private:
+    template <typename Res>
+    static resources::Resource erase_resource(void* res)
+    {
+      return resources::Resource{*static_cast<Res*>(res)};
+    }
+
+    void* m_resource{nullptr};
+    resources::Resource (*m_get_resource)(void*){nullptr};
+
     mutable uint64_t kID;
 
     friend class KokkosPluginLoader;
 };
 
 template<typename Policy>
-PluginContext make_context()
+PluginContext make_context(const char* name = nullptr)
+{
+  return PluginContext{detail::get_platform<Policy>::value, name};
+}
+
+//! Length of a range, for PluginContext::num_iterations
+template <typename Container>
+size_t iteration_count(Container const& c)
+{
+  using std::begin;
+  using std::end;
+  return static_cast<size_t>(std::distance(begin(c), end(c)));
+}
+
+//! Threads per block of a forall policy with a static block size, or 0
+template <typename Policy>
+struct gpu_block_size : std::integral_constant<size_t, 0> {
+};
+
+#if defined(RAJA_ENABLE_CUDA)
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async>
+struct gpu_block_size<
+    policy::cuda::cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>>
+    : std::integral_constant<size_t, BLOCK_SIZE> {
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+template <size_t BLOCK_SIZE, bool Async>
+struct gpu_block_size<policy::hip::hip_exec<BLOCK_SIZE, Async>>
+    : std::integral_constant<size_t, BLOCK_SIZE> {
+};
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+template <size_t BLOCK_SIZE, bool Async>
+struct gpu_block_size<policy::sycl::sycl_exec<BLOCK_SIZE, Async>>
+    : std::integral_constant<size_t, BLOCK_SIZE> {
+};
+#endif
+
+/*!
+ * Context of a loop of pattern with Body running num_iterations on the
+ * resource res, which carries the policy and loop body names for the
+ * plugins.
+ */
+template<typename Policy, typename Body, typename Res>
+PluginContext make_context(KernelPattern pattern,
+                           const char* name,
+                           size_t num_iterations,
+                           Res& res)
+{
+  PluginContext context{detail::get_platform<Policy>::value, name};
+  context.pattern = pattern;
+  context.num_iterations = num_iterations;
+  context.policy_name = typeid(Policy).name();
+  context.launch_site = typeid(Body).name();
+  context.set_resource(res);
+
+  constexpr size_t block_size = gpu_block_size<Policy>::value;
+  if (block_size != 0) {
+    context.threads[0] = block_size;
+    context.teams[0] = (num_iterations + block_size - 1) / block_size;
+  }
+  return context;
+}
+
+//! Context of a loop named with a KernelName, which may declare its bytes
+//! and flops
+template<typename Policy, typename Body, typename Res>
+PluginContext make_context(KernelPattern pattern,
+                           expt::KernelName const& name,
+                           size_t num_iterations,
+                           Res& res)
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  PluginContext context{
+      make_context<Policy, Body>(pattern, name.name, num_iterations, res)};
+  context.bytes = name.bytes;
+  context.flops = name.flops;
+  return context;
 }
 
 } // closing brace for util namespace
@@ -8,15 +8,35 @@
 #ifndef RAJA_Plugin_Linker_HPP
 #define RAJA_Plugin_Linker_HPP
 
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
 #include "RAJA/util/RuntimePluginLoader.hpp"
 #include "RAJA/util/KokkosPluginLoader.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_TIMING_PLUGIN)
+#include "RAJA/util/TimingPlugin.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_COUNTER_PLUGIN)
+#include "RAJA/util/CounterPlugin.hpp"
+#endif
 
 namespace {
   namespace anonymous_RAJA {
     struct pluginLinker {
       inline pluginLinker() {
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
         (void)RAJA::util::linkRuntimePluginLoader();
         (void)RAJA::util::linkKokkosPluginLoader();
+#endif
+#if defined(RAJA_ENABLE_TIMING_PLUGIN)
+        (void)RAJA::util::linkTimingPlugin();
+#endif
+#if defined(RAJA_ENABLE_COUNTER_PLUGIN)
+        (void)RAJA::util::linkCounterPlugin();
+#endif
       }
     } pluginLinker;
   }
@@ -37,6 +37,10 @@ class PluginStrategy
 
 using PluginRegistry = Registry<PluginStrategy>;
 
+//! Set when the first plugin is constructed, which the plugin hooks of the
+//! loops check inline before walking the PluginRegistry
+extern RAJASHAREDDLL_API bool plugins_registered;
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
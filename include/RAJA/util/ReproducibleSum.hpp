@@ -0,0 +1,275 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining an order independent floating point sum.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ReproducibleSum_HPP
+#define RAJA_util_ReproducibleSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace reduce
+{
+
+/*!
+ * \brief Floating point sum that does not depend on the order of addition.
+ *
+ * Every value added is split into 32 bit chunks of a fixed point integer
+ * wide enough to hold any finite T exactly, so addition and combination are
+ * exact integer operations and are associative and commutative. Any
+ * partitioning of a sum over threads, blocks, or ranks produces the same
+ * bits. The result is rounded to T only when value() is called, always from
+ * the same normalized representation.
+ *
+ * Each chunk is stored in 64 bits so carries are only propagated every
+ * max_pending additions. Infinities and NaNs are tracked separately and
+ * follow the usual IEEE rules in the result.
+ */
+template <typename T>
+class reproducible_sum
+{
+  static_assert(std::is_floating_point<T>::value &&
+                    std::numeric_limits<T>::radix == 2,
+                "reproducible_sum requires a binary floating point type");
+
+  using limits = std::numeric_limits<T>;
+
+public:
+  using value_type = T;
+
+  //! bits held by each chunk once normalized
+  static constexpr int chunk_bits = 32;
+
+  //! exponent of the lowest bit of the fixed point integer
+  static constexpr int min_exponent = limits::min_exponent - limits::digits;
+
+  //! number of chunks, one extra for carries out of the largest values
+  static constexpr int num_chunks =
+      (limits::max_exponent - limits::min_exponent + limits::digits +
+       chunk_bits - 1) / chunk_bits + 1;
+
+  //! additions allowed before carries must be propagated
+  static constexpr std::int64_t max_pending = std::int64_t(1) << 30;
+
+  RAJA_HOST_DEVICE
+  reproducible_sum() { clear(); }
+
+  RAJA_HOST_DEVICE
+  reproducible_sum(T val)
+  {
+    clear();
+    deposit(val);
+  }
+
+  //! add a single value
+  RAJA_HOST_DEVICE
+  void deposit(T val)
+  {
+    if (val == T(0)) return;
+    if (!(val - val == T(0))) {
+      m_special |= (val != val) ? special_nan
+                 : (val > T(0)) ? special_pos_inf : special_neg_inf;
+      return;
+    }
+    if (m_pending >= max_pending) normalize();
+
+    int exp = 0;
+    T frac = std::frexp(val, &exp);
+    std::int64_t mant =
+        static_cast<std::int64_t>(std::ldexp(frac, limits::digits));
+    exp -= limits::digits;
+    if (exp < min_exponent) {
+      // subnormal, the low bits being shifted out are all zero
+      mant /= std::int64_t(1) << (min_exponent - exp);
+      exp = min_exponent;
+    }
+
+    const int pos = exp - min_exponent;
+    const int c = pos / chunk_bits;
+    const int s = pos % chunk_bits;
+    const bool negative = mant < 0;
+    const std::uint64_t u = static_cast<std::uint64_t>(negative ? -mant : mant);
+    const std::uint64_t mask = (std::uint64_t(1) << chunk_bits) - 1;
+
+    std::int64_t piece[3];
+    piece[0] = static_cast<std::int64_t>((u << s) & mask);
+    piece[1] = static_cast<std::int64_t>((u >> (chunk_bits - s)) & mask);
+    piece[2] = s ? static_cast<std::int64_t>(u >> (2 * chunk_bits - s)) : 0;
+    for (int i = 0; i < 3; ++i) {
+      m_chunk[c + i] += negative ? -piece[i] : piece[i];
+    }
+    ++m_pending;
+  }
+
+  //! add another sum
+  RAJA_HOST_DEVICE
+  reproducible_sum& operator+=(reproducible_sum const& rhs)
+  {
+    if (m_pending + rhs.m_pending > max_pending) {
+      normalize();
+      reproducible_sum tmp(rhs);
+      tmp.normalize();
+      add_chunks(tmp);
+    } else {
+      add_chunks(rhs);
+    }
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  reproducible_sum& operator+=(T rhs)
+  {
+    deposit(rhs);
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  friend reproducible_sum operator+(reproducible_sum lhs,
+                                    reproducible_sum const& rhs)
+  {
+    lhs += rhs;
+    return lhs;
+  }
+
+  //! compare the exact values, independent of the carry state
+  RAJA_HOST_DEVICE
+  friend bool operator==(reproducible_sum const& lhs,
+                         reproducible_sum const& rhs)
+  {
+    if (lhs.m_special != rhs.m_special) return false;
+    reproducible_sum diff(lhs);
+    diff.negate();
+    diff += rhs;
+    diff.normalize();
+    for (int i = 0; i < num_chunks; ++i) {
+      if (diff.m_chunk[i] != 0) return false;
+    }
+    return true;
+  }
+
+  RAJA_HOST_DEVICE
+  friend bool operator!=(reproducible_sum const& lhs,
+                         reproducible_sum const& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //! round the exact sum to T
+  RAJA_HOST_DEVICE
+  T value() const
+  {
+    if ((m_special & special_nan) ||
+        (m_special == (special_pos_inf | special_neg_inf))) {
+      return limits::quiet_NaN();
+    }
+    if (m_special & special_pos_inf) return limits::infinity();
+    if (m_special & special_neg_inf) return -limits::infinity();
+
+    reproducible_sum tmp(*this);
+    tmp.normalize();
+    const bool negative = tmp.m_chunk[num_chunks - 1] < 0;
+    if (negative) {
+      tmp.negate();
+      tmp.normalize();
+    }
+    // chunks are now all in [0, 2^chunk_bits), accumulate from the top so
+    // the lower chunks only affect rounding
+    T result = T(0);
+    for (int i = num_chunks - 1; i >= 0; --i) {
+      if (tmp.m_chunk[i] != 0) {
+        result += std::ldexp(static_cast<T>(tmp.m_chunk[i]),
+                             min_exponent + i * chunk_bits);
+      }
+    }
+    return negative ? -result : result;
+  }
+
+  RAJA_HOST_DEVICE
+  explicit operator T() const { return value(); }
+
+private:
+  static constexpr int special_nan = 1;
+  static constexpr int special_pos_inf = 2;
+  static constexpr int special_neg_inf = 4;
+
+  std::int64_t m_chunk[num_chunks];
+  std::int64_t m_pending;
+  int m_special;
+
+  RAJA_HOST_DEVICE
+  void clear()
+  {
+    for (int i = 0; i < num_chunks; ++i) {
+      m_chunk[i] = 0;
+    }
+    m_pending = 0;
+    m_special = 0;
+  }
+
+  RAJA_HOST_DEVICE
+  void add_chunks(reproducible_sum const& rhs)
+  {
+    for (int i = 0; i < num_chunks; ++i) {
+      m_chunk[i] += rhs.m_chunk[i];
+    }
+    m_pending += rhs.m_pending;
+    m_special |= rhs.m_special;
+  }
+
+  RAJA_HOST_DEVICE
+  void negate()
+  {
+    for (int i = 0; i < num_chunks; ++i) {
+      m_chunk[i] = -m_chunk[i];
+    }
+    m_special = ((m_special & special_pos_inf) ? special_neg_inf : 0) |
+                ((m_special & special_neg_inf) ? special_pos_inf : 0) |
+                (m_special & special_nan);
+  }
+
+  //! propagate carries so every chunk but the top is in [0, 2^chunk_bits)
+  RAJA_HOST_DEVICE
+  void normalize()
+  {
+    const std::int64_t base = std::int64_t(1) << chunk_bits;
+    for (int i = 0; i < num_chunks - 1; ++i) {
+      std::int64_t carry = m_chunk[i] / base;
+      std::int64_t rem = m_chunk[i] - carry * base;
+      if (rem < 0) {
+        rem += base;
+        carry -= 1;
+      }
+      m_chunk[i] = rem;
+      m_chunk[i + 1] += carry;
+    }
+    m_pending = 1;
+  }
+};
+
+}  // namespace reduce
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,231 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a pool of resources that are handed out
+ *          round-robin or by key.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ResourcePool_HPP
+#define RAJA_util_ResourcePool_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#if defined(RAJA_CUDA_ACTIVE)
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+#if defined(RAJA_HIP_ACTIVE)
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#endif
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace resources
+{
+
+namespace detail
+{
+
+/*!
+ * Creates and destroys the resources of a pool. Resources without streams
+ * are all the default resource.
+ */
+template <typename Res>
+struct ResourcePoolTraits {
+  static Res create(int, int) { return Res::get_default(); }
+
+  static void destroy(Res&) {}
+};
+
+#if defined(RAJA_CUDA_ACTIVE)
+template <>
+struct ResourcePoolTraits<Cuda> {
+  static Cuda create(int device, int priority)
+  {
+    int old_device;
+    cudaErrchk(cudaGetDevice(&old_device));
+    cudaErrchk(cudaSetDevice(device));
+
+    int least, greatest;
+    cudaErrchk(cudaDeviceGetStreamPriorityRange(&least, &greatest));
+    // greater priorities are lower numbers
+    priority = std::min(std::max(priority, greatest), least);
+
+    cudaStream_t stream;
+    cudaErrchk(cudaStreamCreateWithPriority(&stream, cudaStreamNonBlocking,
+                                            priority));
+
+    cudaErrchk(cudaSetDevice(old_device));
+    return Cuda::CudaFromStream(stream, device);
+  }
+
+  static void destroy(Cuda& r)
+  {
+    cudaErrchk(cudaStreamSynchronize(r.get_stream()));
+    cudaErrchk(cudaStreamDestroy(r.get_stream()));
+  }
+};
+#endif
+
+#if defined(RAJA_HIP_ACTIVE)
+template <>
+struct ResourcePoolTraits<Hip> {
+  static Hip create(int device, int priority)
+  {
+    int old_device;
+    hipErrchk(hipGetDevice(&old_device));
+    hipErrchk(hipSetDevice(device));
+
+    int least, greatest;
+    hipErrchk(hipDeviceGetStreamPriorityRange(&least, &greatest));
+    // greater priorities are lower numbers
+    priority = std::min(std::max(priority, greatest), least);
+
+    hipStream_t stream;
+    hipErrchk(hipStreamCreateWithPriority(&stream, hipStreamNonBlocking,
+                                          priority));
+
+    hipErrchk(hipSetDevice(old_device));
+    return Hip::HipFromStream(stream, device);
+  }
+
+  static void destroy(Hip& r)
+  {
+    hipErrchk(hipStreamSynchronize(r.get_stream()));
+    hipErrchk(hipStreamDestroy(r.get_stream()));
+  }
+};
+#endif
+
+}  // namespace detail
+
+/*!
+ * @brief Pool of resources of type Res, created once and handed out
+ *        round-robin or by key, so independent kernels can be spread over
+ *        several streams without creating streams as they are launched.
+ *
+ * For CUDA and HIP each resource of the pool has its own non-blocking
+ * stream on one device, created with the given priority clamped to the
+ * range of the device, where lower numbers are greater priorities:
+ *
+ *     RAJA::resources::ResourcePool<RAJA::resources::Cuda> pool(4);
+ *
+ *     for (int p = 0; p < num_patches; ++p) {
+ *       RAJA::forall<RAJA::cuda_exec_async<256>>(pool.get(),
+ *                                                patch_range(p), body);
+ *     }
+ *     pool.wait();
+ *
+ * get(key) always returns the same resource for a key, so that a sequence
+ * of dependent kernels with the same key runs in order on one stream.
+ * Resources of other types are all the default resource of that type.
+ *
+ * The streams are destroyed with the pool, after they finish, so the
+ * resources handed out must not be used once the pool is destroyed.
+ */
+template <typename Res>
+class ResourcePool
+{
+public:
+  using resource_type = Res;
+
+  static constexpr size_t default_size = 4;
+
+  explicit ResourcePool(size_t size = default_size,
+                        int priority = 0,
+                        int device = current_device())
+      : m_next(0)
+  {
+    size = size > 0 ? size : 1;
+    m_resources.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+      m_resources.push_back(
+          detail::ResourcePoolTraits<Res>::create(device, priority));
+    }
+  }
+
+  ResourcePool(ResourcePool const&) = delete;
+  ResourcePool& operator=(ResourcePool const&) = delete;
+
+  ~ResourcePool()
+  {
+    for (auto& r : m_resources) {
+      detail::ResourcePoolTraits<Res>::destroy(r);
+    }
+  }
+
+  size_t size() const { return m_resources.size(); }
+
+  //! the next resource of the pool, from any thread
+  Res get()
+  {
+    return m_resources[m_next.fetch_add(1, std::memory_order_relaxed) %
+                       m_resources.size()];
+  }
+
+  //! the resource for key, the same one for every call with key
+  Res get(size_t key) const { return m_resources[key % m_resources.size()]; }
+
+  //! wait on the host for the work on all resources of the pool
+  void wait()
+  {
+    for (auto& r : m_resources) {
+      r.wait();
+    }
+  }
+
+  //! make the work enqueued on r from now on wait for all resources
+  template <typename OtherRes>
+  OtherRes& join(OtherRes& r)
+  {
+    for (auto& p : m_resources) {
+      Event e = p.get_event_erased();
+      r.wait_for(&e);
+    }
+    return r;
+  }
+
+private:
+  std::vector<Res> m_resources;
+  std::atomic<size_t> m_next;
+
+  static int current_device()
+  {
+    int device = 0;
+#if defined(RAJA_CUDA_ACTIVE)
+    if (std::is_same<Res, Cuda>::value) {
+      cudaErrchk(cudaGetDevice(&device));
+    }
+#endif
+#if defined(RAJA_HIP_ACTIVE)
+    if (std::is_same<Res, Hip>::value) {
+      hipErrchk(hipGetDevice(&device));
+    }
+#endif
+    return device;
+  }
+};
+
+}  // namespace resources
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,137 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a View pointer type with non-aliasing
+ *          and alignment guarantees.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_RESTRICT_PTR_HPP
+#define RAJA_RESTRICT_PTR_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdint>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief Pointer type for Views whose data is not aliased by any other
+ *        View or pointer, and is aligned to ALIGN bytes.
+ *
+ * A View holds its data in a member, and the compiler can not tell that the
+ * data of two Views never overlaps, or how it is aligned, which it can for
+ * __restrict__ function arguments and aligned allocations.  Loops over Views
+ * are then vectorized with runtime alias checks and peeled for alignment, or
+ * not at all.
+ *
+ * RestrictPtr keeps the pointer RAJA_RESTRICT, and returns every access
+ * through __builtin_assume_aligned, so that Views perform like raw pointers:
+ *
+ *     using view_t = RAJA::View<double, RAJA::Layout<2>,
+ *                               RAJA::RestrictPtr<double, RAJA::DATA_ALIGN>>;
+ *
+ * or with the RAJA::RestrictView alias.
+ *
+ * These are promises to the compiler: the data of a RestrictPtr may only be
+ * accessed through it while it is used, and must be aligned to ALIGN.  The
+ * alignment is checked when bounds checking is enabled.
+ */
+template <typename T, size_t ALIGN = alignof(T)>
+class RestrictPtr
+{
+public:
+  using element_type = T;
+
+  static constexpr size_t alignment = ALIGN;
+
+  static_assert(ALIGN >= alignof(T) && (ALIGN & (ALIGN - 1)) == 0,
+                "RestrictPtr alignment must be a power of two, and at least "
+                "the alignment of T");
+
+private:
+  T *RAJA_RESTRICT m_ptr;
+
+public:
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr RestrictPtr() : m_ptr(nullptr) {}
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  RestrictPtr(T *ptr) : m_ptr(ptr)
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    if (reinterpret_cast<uintptr_t>(ptr) % ALIGN != 0) {
+      printf("Error! Pointer %p is not aligned to %ld bytes. \n",
+             static_cast<void const *>(ptr), static_cast<long int>(ALIGN));
+      RAJA_ABORT_OR_THROW("Alignment error \n");
+    }
+#endif
+  }
+
+  /*!
+   * Conversion from a RestrictPtr to less qualified data, such as to const
+   */
+  template <typename U,
+            size_t UALIGN,
+            typename std::enable_if<std::is_convertible<U *, T *>::value &&
+                                        (UALIGN >= ALIGN),
+                                    bool>::type = true>
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr RestrictPtr(
+      RestrictPtr<U, UALIGN> const &rhs)
+      : m_ptr(rhs.get())
+  {
+  }
+
+  /*!
+   * Returns the pointer, with its alignment known to the compiler
+   */
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  T *get() const
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<T *>(__builtin_assume_aligned(m_ptr, ALIGN));
+#else
+    return m_ptr;
+#endif
+  }
+
+  template <typename IDX>
+  RAJA_HOST_DEVICE RAJA_INLINE T &operator[](IDX i) const
+  {
+    return get()[i];
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  T &operator*() const { return *get(); }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  operator T *() const { return get(); }
+};
+
+template <typename T, size_t ALIGN>
+constexpr size_t RestrictPtr<T, ALIGN>::alignment;
+
+}  // namespace RAJA
+
+#endif
@@ -9,6 +9,9 @@
 #define RAJA_Runtime_Plugin_Loader_HPP
 
 #include <memory>
+#include <mutex>
+#include <set>
+#include <string>
 #include <vector>
 
 #include "RAJA/util/PluginOptions.hpp"
@@ -17,6 +20,23 @@
 namespace RAJA {
 namespace util {
 
+  /*!
+   * Loads the plugins of the RAJA_PLUGINS path, a shared object or a
+   * directory of them, the first time a hook is called or init_plugins is
+   * called, so runs that launch no kernels touch no plugin files. The
+   * environment also selects
+   *
+   *   RAJA_PLUGINS_EAGER=1      load when the program starts instead
+   *   RAJA_PLUGINS_MANIFEST=f   read the plugin paths from file f instead
+   *                             of the directory, writing f from the
+   *                             directory if it does not exist
+   *   RAJA_PLUGINS_BROADCAST=1  with MPI, find the paths on rank 0 of
+   *                             MPI_COMM_WORLD and broadcast them; every rank
+   *                             must then make its first RAJA launch, or
+   *                             call init_plugins, after MPI_Init
+   *
+   * Plugins not loaded by finalize are never loaded.
+   */
   class RuntimePluginLoader : public RAJA::util::PluginStrategy
   {
     using Parent = RAJA::util::PluginStrategy;
@@ -38,12 +58,24 @@ namespace util {
 
   private:
 
+    void loadPlugins();
+
     void initPlugin(const std::string &path);
     
     void initDirectory(const std::string &path);
 
+    void findPlugins(const std::string &path, std::vector<std::string> &paths);
+
     std::vector<std::unique_ptr<Parent>> plugins;
 
+    // RAJA_PLUGINS, loaded by loadPlugins on the first hook
+    std::string env_path;
+
+    std::once_flag env_loaded;
+
+    // shared objects already opened, which are not loaded twice
+    std::set<std::string> loaded_paths;
+
   };  // end RuntimePluginLoader class
 
   void linkRuntimePluginLoader();
@@ -0,0 +1,247 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a counter with one shard per host
+ *          thread, for counters updated by all threads.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ShardedCounter_HPP
+#define RAJA_util_ShardedCounter_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <new>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief Counter for values that all host threads add to, such as work
+ *        counters, with a shard of the count per thread on its own cache
+ *        line.
+ *
+ * Threads add to the shard of their OpenMP thread number, so they do not
+ * contend on a single cache line, and get() adds up the shards:
+ *
+ *     RAJA::ShardedCounter<long> work(0);
+ *
+ *     RAJA::forall<RAJA::omp_parallel_for_exec>(range, [=](int i) {
+ *       if (needs_work(i)) {
+ *         RAJA::atomicInc<RAJA::auto_atomic>(work);
+ *       }
+ *     });
+ *
+ *     long total = work.get();
+ *
+ * The atomic functions take a ShardedCounter in place of a pointer, and
+ * return nothing, as no thread sees the total while the others add to it;
+ * counters that hand out unique values, such as queue tails, need an atomic
+ * on a single value instead.  Shards are updated with atomics, so nested
+ * parallel regions whose threads share a thread number stay correct.
+ *
+ * Copies, such as lambda captures, refer to the shards of the original and
+ * must not outlive it.
+ */
+template <typename T>
+class ShardedCounter
+{
+public:
+  using value_type = T;
+
+  static constexpr size_t line_bytes = static_cast<size_t>(RAJA::DATA_ALIGN);
+  static constexpr size_t stride =
+      (sizeof(T) + line_bytes - 1) / line_bytes * line_bytes;
+
+  //! Counter starting at init_val, with a shard per host thread by default
+  explicit ShardedCounter(T init_val = T(), int num_shards = default_shards())
+      : m_num_shards(num_shards > 0 ? num_shards : 1),
+        m_data(RAJA::allocate_aligned_type<char>(line_bytes,
+                                                  stride * m_num_shards)),
+        m_owner(true)
+  {
+    if (m_data == nullptr) {
+      throw std::bad_alloc();
+    }
+    for (int s = 0; s < m_num_shards; ++s) {
+      new (m_data + s * stride) T(s == 0 ? init_val : T());
+    }
+  }
+
+  //! copies refer to the shards of other
+  ShardedCounter(ShardedCounter const& other)
+      : m_num_shards(other.m_num_shards), m_data(other.m_data), m_owner(false)
+  {
+  }
+
+  ShardedCounter& operator=(ShardedCounter const&) = delete;
+
+  ~ShardedCounter()
+  {
+    if (m_owner) {
+      for (int s = 0; s < m_num_shards; ++s) {
+        shard(s).~T();
+      }
+      RAJA::free_aligned(m_data);
+    }
+  }
+
+  int num_shards() const { return m_num_shards; }
+
+  //! Adds value to the shard of the calling thread
+  RAJA_INLINE void add(T value) const
+  {
+    T& s = shard(this_shard());
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic
+#endif
+    s += value;
+  }
+
+  //! The count, the sum of the shards
+  T get() const
+  {
+    T total = shard(0);
+    for (int s = 1; s < m_num_shards; ++s) {
+      total += shard(s);
+    }
+    return total;
+  }
+
+  operator T() const { return get(); }
+
+  //! Sets the count to val, while no thread adds to it
+  void reset(T val = T()) const
+  {
+    for (int s = 0; s < m_num_shards; ++s) {
+      shard(s) = s == 0 ? val : T();
+    }
+  }
+
+private:
+  static int default_shards()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  RAJA_INLINE int this_shard() const
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    return omp_get_thread_num() % m_num_shards;
+#else
+    return 0;
+#endif
+  }
+
+  RAJA_INLINE T& shard(int s) const
+  {
+    return *reinterpret_cast<T*>(m_data + s * stride);
+  }
+
+  int m_num_shards;
+  char* m_data;
+  bool m_owner;
+};
+
+
+/*!
+ * Atomics on a ShardedCounter, for the host atomic policies, add to the
+ * shard of the calling thread
+ */
+template <typename Policy, typename T>
+RAJA_INLINE void atomicAdd(Policy, ShardedCounter<T> const& counter,
+                           typename ShardedCounter<T>::value_type value)
+{
+  counter.add(value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicSub(Policy, ShardedCounter<T> const& counter,
+                           typename ShardedCounter<T>::value_type value)
+{
+  counter.add(-value);
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicInc(Policy, ShardedCounter<T> const& counter)
+{
+  counter.add(T(1));
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE void atomicDec(Policy, ShardedCounter<T> const& counter)
+{
+  counter.add(T(-1));
+}
+
+
+/*!
+ * @brief Atomic add to a sharded counter
+ * @param counter Counter to add value to
+ * @param value Value to add to counter
+ */
+template <typename Policy, typename T>
+RAJA_INLINE void atomicAdd(ShardedCounter<T> const& counter,
+                           typename ShardedCounter<T>::value_type value)
+{
+  RAJA::atomicAdd(Policy{}, counter, value);
+}
+
+/*!
+ * @brief Atomic subtract from a sharded counter
+ * @param counter Counter to subtract value from
+ * @param value Value to subtract from counter
+ */
+template <typename Policy, typename T>
+RAJA_INLINE void atomicSub(ShardedCounter<T> const& counter,
+                           typename ShardedCounter<T>::value_type value)
+{
+  RAJA::atomicSub(Policy{}, counter, value);
+}
+
+/*!
+ * @brief Atomic increment of a sharded counter
+ * @param counter Counter to increment
+ */
+template <typename Policy, typename T>
+RAJA_INLINE void atomicInc(ShardedCounter<T> const& counter)
+{
+  RAJA::atomicInc(Policy{}, counter);
+}
+
+/*!
+ * @brief Atomic decrement of a sharded counter
+ * @param counter Counter to decrement
+ */
+template <typename Policy, typename T>
+RAJA_INLINE void atomicDec(ShardedCounter<T> const& counter)
+{
+  RAJA::atomicDec(Policy{}, counter);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
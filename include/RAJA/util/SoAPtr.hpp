@@ -63,6 +63,24 @@ public:
     return *this;
   }
 
+  //! allocate for use on stream, see MemPool::stream_malloc
+  template <typename Stream>
+  SoAPtr& allocate(size_t size, Stream stream)
+  {
+    mem = mempool::getInstance().template stream_malloc<value_type>(size,
+                                                                    stream);
+    return *this;
+  }
+
+  //! deallocate in stream order, see MemPool::stream_free
+  template <typename Stream>
+  SoAPtr& deallocate(Stream stream)
+  {
+    mempool::getInstance().stream_free(mem, stream);
+    mem = nullptr;
+    return *this;
+  }
+
   RAJA_HOST_DEVICE bool allocated() const { return mem != nullptr; }
 
   RAJA_HOST_DEVICE value_type get(size_t i) const { return mem[i]; }
@@ -106,6 +124,28 @@ public:
     return *this;
   }
 
+  //! allocate for use on stream, see MemPool::stream_malloc
+  template <typename Stream>
+  SoAPtr& allocate(size_t size, Stream stream)
+  {
+    mem = mempool::getInstance().template stream_malloc<first_type>(size,
+                                                                    stream);
+    mem_idx = mempool::getInstance().template stream_malloc<second_type>(
+        size, stream);
+    return *this;
+  }
+
+  //! deallocate in stream order, see MemPool::stream_free
+  template <typename Stream>
+  SoAPtr& deallocate(Stream stream)
+  {
+    mempool::getInstance().stream_free(mem, stream);
+    mem = nullptr;
+    mempool::getInstance().stream_free(mem_idx, stream);
+    mem_idx = nullptr;
+    return *this;
+  }
+
   RAJA_HOST_DEVICE bool allocated() const { return mem != nullptr; }
 
   RAJA_HOST_DEVICE value_type get(size_t i) const
@@ -0,0 +1,226 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining asynchronous copies on resources, and a
+ *          double-buffered pipeline that stages host data to a device in
+ *          chunks while the chunk before it is computed on.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_StagingPipeline_HPP
+#define RAJA_util_StagingPipeline_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#if defined(RAJA_CUDA_ACTIVE)
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#endif
+
+#if defined(RAJA_HIP_ACTIVE)
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#endif
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief Copies bytes from src to dst in the order of the work on r.
+ *
+ * On CUDA and HIP resources the copy is asynchronous on the stream of r, in
+ * any direction, and overlaps with the host only when host memory is
+ * pinned. On the host resource it is done before returning. Like the
+ * patterns, the returned proxy gives an Event if one is needed:
+ *
+ *     RAJA::resources::Event e = RAJA::copy_async(res, d_ptr, h_ptr, bytes);
+ */
+template <typename Res>
+resources::EventProxy<Res> copy_async(Res r,
+                                      void* dst,
+                                      const void* src,
+                                      size_t bytes)
+{
+  r.memcpy(dst, src, bytes);
+  return resources::EventProxy<Res>(r);
+}
+
+namespace detail
+{
+
+//! Host staging memory that copies on resources of type Res can overlap
+template <typename Res>
+struct StagingHostMemory {
+  static void* allocate(size_t bytes) { return ::operator new(bytes); }
+
+  static void deallocate(void* ptr) { ::operator delete(ptr); }
+};
+
+#if defined(RAJA_CUDA_ACTIVE)
+template <>
+struct StagingHostMemory<resources::Cuda> {
+  static void* allocate(size_t bytes)
+  {
+    return cuda::pinned_mempool_type::getInstance().template malloc<char>(bytes);
+  }
+
+  static void deallocate(void* ptr)
+  {
+    cuda::pinned_mempool_type::getInstance().free(ptr);
+  }
+};
+#endif
+
+#if defined(RAJA_HIP_ACTIVE)
+template <>
+struct StagingHostMemory<resources::Hip> {
+  static void* allocate(size_t bytes)
+  {
+    return hip::pinned_mempool_type::getInstance().template malloc<char>(bytes);
+  }
+
+  static void deallocate(void* ptr)
+  {
+    hip::pinned_mempool_type::getInstance().free(ptr);
+  }
+};
+#endif
+
+}  // namespace detail
+
+/*!
+ * @brief Processes host arrays larger than device memory in chunks, with
+ *        the copy of each chunk to the device overlapping the work on the
+ *        chunk before it.
+ *
+ * Each chunk is copied by the host into one of two pinned buffers from the
+ * pinned mempool, copied asynchronously on copy_res into one of two device
+ * buffers, and handed to the body on compute_res once its copy is done:
+ *
+ *     struct scale_chunk {
+ *       double* out;
+ *
+ *       void operator()(RAJA::resources::Cuda res, double* chunk,
+ *                       size_t begin, size_t len) const
+ *       {
+ *         double* o = out + begin;
+ *         RAJA::forall<RAJA::cuda_exec_async<256>>(res,
+ *             RAJA::TypedRangeSegment<size_t>(0, len),
+ *             [=] RAJA_DEVICE (size_t i) { o[i] = 2.0 * chunk[i]; });
+ *       }
+ *     };
+ *
+ *     RAJA::StagingPipeline<RAJA::resources::Cuda, double>
+ *         pipeline(copy_res, compute_res, 1 << 24);
+ *
+ *     pipeline.run(h_data, n, scale_chunk{d_out});
+ *
+ * The body is a functor, since CUDA device lambdas can not be defined in
+ * another lambda. The body must launch its work on the resource it is given, and must be
+ * done with the chunk when that work is done, since the buffer is reused
+ * two chunks later. The copies only overlap the work when the two
+ * resources are on different streams, for example from a ResourcePool.
+ * run returns once the last chunk is enqueued, and the proxy it returns
+ * gives an Event for the work on all chunks; the host data may be changed
+ * as soon as run returns.
+ */
+template <typename Res, typename T>
+class StagingPipeline
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "StagingPipeline values must be trivially copyable");
+
+public:
+  using resource_type = Res;
+  using value_type = T;
+
+  static constexpr int num_buffers = 2;
+
+  StagingPipeline(Res copy_res, Res compute_res, size_t chunk_size)
+      : m_copy_res(copy_res),
+        m_compute_res(compute_res),
+        m_chunk_size(chunk_size > 0 ? chunk_size : 1),
+        m_copied{m_copy_res.get_event_erased(), m_copy_res.get_event_erased()},
+        m_computed{m_compute_res.get_event_erased(),
+                   m_compute_res.get_event_erased()}
+  {
+    for (int b = 0; b < num_buffers; ++b) {
+      m_host[b] = static_cast<T*>(
+          detail::StagingHostMemory<Res>::allocate(m_chunk_size * sizeof(T)));
+      m_device[b] = m_compute_res.template allocate<T>(m_chunk_size);
+    }
+  }
+
+  StagingPipeline(StagingPipeline const&) = delete;
+  StagingPipeline& operator=(StagingPipeline const&) = delete;
+
+  ~StagingPipeline()
+  {
+    for (int b = 0; b < num_buffers; ++b) {
+      m_copied[b].wait();
+      m_computed[b].wait();
+      m_compute_res.deallocate(m_device[b]);
+      detail::StagingHostMemory<Res>::deallocate(m_host[b]);
+    }
+  }
+
+  size_t chunk_size() const { return m_chunk_size; }
+
+  /*!
+   * Calls body(compute_res, chunk, begin, len) for each chunk of the n
+   * values of src, where chunk is a device copy of src[begin, begin+len)
+   */
+  template <typename BODY>
+  resources::EventProxy<Res> run(T const* src, size_t n, BODY&& body)
+  {
+    int b = 0;
+    for (size_t begin = 0; begin < n; begin += m_chunk_size) {
+      const size_t len = std::min(m_chunk_size, n - begin);
+
+      // the copy out of this pinned buffer two chunks ago is done
+      m_copied[b].wait();
+      std::memcpy(m_host[b], src + begin, len * sizeof(T));
+
+      // and so is the work on this device buffer
+      m_copy_res.wait_for(&m_computed[b]);
+      copy_async(m_copy_res, m_device[b], m_host[b], len * sizeof(T));
+      m_copied[b] = m_copy_res.get_event_erased();
+
+      m_compute_res.wait_for(&m_copied[b]);
+      body(m_compute_res, m_device[b], begin, len);
+      m_computed[b] = m_compute_res.get_event_erased();
+
+      b = (b + 1) % num_buffers;
+    }
+    return resources::EventProxy<Res>(m_compute_res);
+  }
+
+private:
+  Res m_copy_res;
+  Res m_compute_res;
+  size_t m_chunk_size;
+  T* m_host[num_buffers];
+  T* m_device[num_buffers];
+  resources::Event m_copied[num_buffers];
+  resources::Event m_computed[num_buffers];
+};
+
+}  // namespace RAJA
+
+#endif
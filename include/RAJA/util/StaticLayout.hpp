@@ -152,6 +152,14 @@ struct StaticLayoutBase_impl<IdxLin,
     return camp::seq_at<DIM, sizes>::value;
   }
 
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_begin() const {
+    return 0;
+  }
+
 };
 
 template <typename IdxLin, IdxLin N, IdxLin Idx, IdxLin... Sizes>
@@ -245,7 +253,23 @@ struct TypedStaticLayoutImpl<Layout, camp::list<DimTypes...>> {
   RAJA_HOST_DEVICE
   constexpr
   IndexLinear get_dim_stride() const {
-    return Layout{}.get_dim_stride();
+    return Layout{}.template get_dim_stride<DIM>();
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_size() const {
+    return Layout{}.template get_dim_size<DIM>();
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_begin() const {
+    return 0;
   }
 
   RAJA_INLINE
@@ -259,6 +283,71 @@ struct StaticLayoutMaker
   using type = StaticLayoutBase_impl<IdxLin, Indexes, Sizes, strides>;
 };
 
+
+/*!
+ * StaticLayout whose strides are those of StorageSizes, the sizes with their
+ * padding.  The size is that of the padded storage, which is what the local
+ * array allocations use.
+ */
+template <typename IdxLin, typename Range, typename Sizes, typename Strides,
+          typename StorageSizes>
+struct PaddedStaticLayoutBase_impl;
+
+template <typename IdxLin,
+          typename Range,
+          typename Sizes,
+          typename Strides,
+          IdxLin... StorageSizes>
+struct PaddedStaticLayoutBase_impl<IdxLin,
+                                   Range,
+                                   Sizes,
+                                   Strides,
+                                   camp::int_seq<IdxLin, StorageSizes...>>
+    : public StaticLayoutBase_impl<IdxLin, Range, Sizes, Strides> {
+
+  using storage_sizes = camp::int_seq<IdxLin, StorageSizes...>;
+
+  // Multiply together all of the padded sizes,
+  // replacing 1 for any zero-sized dimensions
+  static constexpr IdxLin s_size =
+      RAJA::product<IdxLin>((StorageSizes == IdxLin(0) ? IdxLin(1) : StorageSizes)...);
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr PaddedStaticLayoutBase_impl() {}
+
+  /*!
+   * Computes the size of the storage, including the padding.
+   *
+   * @return Number of values to allocate
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr IdxLin size()
+  {
+    return s_size;
+  }
+};
+
+template <typename Perm, typename IdxLin, typename Sizes, typename Padding, typename Indexes>
+struct PaddedStaticLayoutMaker;
+
+template <typename Perm, typename IdxLin, IdxLin... Sizes, camp::idx_t... Pads, typename Indexes>
+struct PaddedStaticLayoutMaker<Perm,
+                               IdxLin,
+                               camp::int_seq<IdxLin, Sizes...>,
+                               camp::idx_seq<Pads...>,
+                               Indexes>
+{
+  static_assert(sizeof...(Sizes) == sizeof...(Pads),
+                "PaddedStaticLayout needs one padding per dimension");
+
+  // projected dimensions stay projected
+  using storage_sizes = camp::int_seq<IdxLin, (Sizes > 0 ? Sizes + IdxLin(Pads) : IdxLin(0))...>;
+  using strides = typename detail::StrideCalculator<IdxLin, Indexes, Perm, storage_sizes>::strides;
+  using type = PaddedStaticLayoutBase_impl<IdxLin,
+                                           Indexes,
+                                           camp::int_seq<IdxLin, Sizes...>,
+                                           strides,
+                                           storage_sizes>;
+};
+
 }  // namespace detail
 
 
@@ -277,6 +366,31 @@ template <typename Perm, typename IdxLin, typename TypeList, camp::idx_t... Size
 using TypedStaticLayout =
     detail::TypedStaticLayoutImpl<StaticLayoutT<Perm, IdxLin, Sizes...>, TypeList>;
 
+/*!
+ * @brief A StaticLayout with Padding, a camp::idx_seq, added to the storage
+ * of each dimension.
+ *
+ * Only the strides change, the index space is still Sizes. Padding the
+ * stride one dimension of a power of two tile moves its columns to
+ * different shared memory banks or cache sets:
+ *
+ *     // 32x32 tile with rows of 33 values
+ *     using tile_layout = PaddedStaticLayout<PERM_IJ, camp::idx_seq<0, 1>, 32, 32>;
+ *
+ * size() is the number of values of the padded storage, here 32*33.
+ */
+template <typename Perm, typename IdxLin, typename Padding, camp::idx_t... Sizes>
+using PaddedStaticLayoutT = typename detail::PaddedStaticLayoutMaker<
+    Perm,
+    IdxLin,
+    camp::int_seq<IdxLin, Sizes...>,
+    Padding,
+    camp::make_int_seq_t<IdxLin, sizeof...(Sizes)>
+    >::type;
+
+template <typename Perm, typename Padding, camp::idx_t... Sizes>
+using PaddedStaticLayout = PaddedStaticLayoutT<Perm, camp::idx_t, Padding, Sizes...>;
+
 
 }  // namespace RAJA
 
@@ -0,0 +1,253 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a View pointer type whose stores
+ *          bypass the caches.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_STREAMING_PTR_HPP
+#define RAJA_STREAMING_PTR_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Types written with non-temporal stores, others are stored normally
+template <typename T>
+struct is_streamable
+    : std::integral_constant<bool,
+                             std::is_arithmetic<T>::value &&
+                                 (sizeof(T) == 4 || sizeof(T) == 8)> {
+};
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void streaming_store(T *ptr,
+                                                  T const &value,
+                                                  std::false_type)
+{
+  *ptr = value;
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void streaming_store(T *ptr,
+                                                  T const &value,
+                                                  std::true_type)
+{
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDA_ARCH__)
+  // st.global.cs, the store of __stcs, for any 4 or 8 byte type
+  if (sizeof(T) == 4) {
+    std::uint32_t bits;
+    memcpy(&bits, &value, sizeof(T));
+    asm volatile("st.global.cs.u32 [%0], %1;" ::"l"(ptr), "r"(bits)
+                 : "memory");
+  } else {
+    std::uint64_t bits;
+    memcpy(&bits, &value, sizeof(T));
+    asm volatile("st.global.cs.u64 [%0], %1;" ::"l"(ptr), "l"(bits)
+                 : "memory");
+  }
+#elif defined(__clang__)
+  // vectorizes to movntpd and friends on x86, and is a nt store on AMD GPUs
+  __builtin_nontemporal_store(value, ptr);
+#elif defined(__SSE2__)
+  if (sizeof(T) == 4) {
+    int bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    _mm_stream_si32(reinterpret_cast<int *>(ptr), bits);
+  } else {
+#if defined(__x86_64__)
+    long long bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    _mm_stream_si64(reinterpret_cast<long long *>(ptr), bits);
+#else
+    *ptr = value;
+#endif
+  }
+#else
+  *ptr = value;
+#endif
+}
+
+//! Orders the non-temporal stores of this thread before later stores
+template <typename Res>
+RAJA_INLINE void streaming_fence(Res const &)
+{
+  // device stores are ordered by the end of the kernel
+}
+
+RAJA_INLINE void streaming_fence(resources::Host const &)
+{
+#if defined(__SSE2__)
+  _mm_sfence();
+#endif
+}
+
+}  // namespace detail
+
+
+/*!
+ * @brief Reference to a value of a StreamingPtr, which reads normally and
+ * writes with a non-temporal store.
+ */
+template <typename T>
+class StreamingRef
+{
+public:
+  using value_type = T;
+
+private:
+  T *m_ptr;
+
+public:
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr explicit StreamingRef(T *ptr) : m_ptr(ptr) {}
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr StreamingRef(StreamingRef const &) = default;
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  T get() const { return *m_ptr; }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  operator T() const { return get(); }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  StreamingRef const &operator=(T const &v) const
+  {
+    detail::streaming_store(m_ptr, v, detail::is_streamable<T>{});
+    return *this;
+  }
+
+  //! Assigns the value of rhs, not the reference
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  StreamingRef const &operator=(StreamingRef const &rhs) const
+  {
+    return *this = rhs.get();
+  }
+};
+
+
+/*!
+ * @brief Pointer type for Views of arrays that are written once and not
+ *        read again soon, whose stores bypass the caches.
+ *
+ * A normal store first reads the cache line it writes, and leaves it in the
+ * cache, which for a large output array costs a read of every line and
+ * evicts data the code will use again.  Non-temporal stores do neither:
+ *
+ *     using view_t = RAJA::View<double, RAJA::Layout<2>,
+ *                               RAJA::StreamingPtr<double>>;
+ *     view_t out(out_data, N, M);
+ *
+ *     out(i, j) = f(i, j);   // streams the value to memory
+ *
+ * or with the RAJA::StreamingView alias.  Stores are st.global.cs on CUDA,
+ * and non-temporal stores on the host and on HIP devices, which vectorize
+ * to movntpd and friends with clang.  4 and 8 byte arithmetic types are
+ * streamed, others are stored normally.  CUDA data must be in global memory.
+ *
+ * forall ends with a store fence on the host, so the values are visible to
+ * other threads once it returns.  Reads are normal loads, and accesses
+ * return a StreamingRef, which supports reads and assignment; read-modify-
+ * write Views should use plain pointers.  A const T gives a View whose
+ * accesses are plain loads.
+ */
+template <typename T>
+class StreamingPtr
+{
+public:
+  using element_type = T;
+
+  using reference =
+      typename std::conditional<std::is_const<T>::value,
+                                T &,
+                                StreamingRef<T>>::type;
+
+private:
+  T *m_ptr;
+
+public:
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr StreamingPtr() : m_ptr(nullptr) {}
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr StreamingPtr(T *ptr) : m_ptr(ptr) {}
+
+  /*!
+   * Conversion from a StreamingPtr to less qualified data, such as to const
+   */
+  template <typename U,
+            typename std::enable_if<std::is_convertible<U *, T *>::value,
+                                    bool>::type = true>
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr StreamingPtr(
+      StreamingPtr<U> const &rhs)
+      : m_ptr(rhs.get())
+  {
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr T *get() const { return m_ptr; }
+
+  template <typename IDX>
+  RAJA_HOST_DEVICE RAJA_INLINE reference operator[](IDX i) const
+  {
+    return make_reference(m_ptr + i);
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  reference operator*() const { return make_reference(m_ptr); }
+
+private:
+  using value_type = typename std::remove_const<T>::type;
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  static value_type const &make_reference(value_type const *p) { return *p; }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  static StreamingRef<value_type> make_reference(value_type *p)
+  {
+    return StreamingRef<value_type>(p);
+  }
+};
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,307 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the tile-major layout.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_TILEDLAYOUT_HPP
+#define RAJA_TILEDLAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/Layout.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Range, camp::idx_t TILE_SIZE, bool MORTON, typename IdxLin>
+struct TiledLayout_impl;
+
+template <camp::idx_t... RangeInts,
+          camp::idx_t TILE_SIZE,
+          bool MORTON,
+          typename IdxLin>
+struct TiledLayout_impl<camp::idx_seq<RangeInts...>, TILE_SIZE, MORTON, IdxLin> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<sizeof...(RangeInts)>;
+
+  static_assert(TILE_SIZE > 0, "TiledLayout tiles must not be empty");
+  static_assert(!MORTON || (TILE_SIZE & (TILE_SIZE - 1)) == 0,
+                "Morton ordered tiles must have a power of two size");
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+  static constexpr IdxLin tile_size = TILE_SIZE;
+  static constexpr bool morton = MORTON;
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  //! Number of values in a tile, TILE_SIZE^n_dims
+  static constexpr IdxLin tile_elems =
+      RAJA::product<IdxLin>((RangeInts >= 0 ? IdxLin(TILE_SIZE) : IdxLin(1))...);
+
+  IdxLin sizes[n_dims] = {0};
+  IdxLin tiles[n_dims] = {0};
+
+
+  constexpr RAJA_INLINE TiledLayout_impl() = default;
+  constexpr RAJA_INLINE TiledLayout_impl(TiledLayout_impl const &) = default;
+  constexpr RAJA_INLINE TiledLayout_impl(TiledLayout_impl &&) = default;
+  RAJA_INLINE TiledLayout_impl &operator=(TiledLayout_impl const &) = default;
+  RAJA_INLINE TiledLayout_impl &operator=(TiledLayout_impl &&) = default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr TiledLayout_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        tiles{((static_cast<IdxLin>(stripIndexType(ns)) + tile_size - 1) /
+               tile_size)...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if(!(0<=idx && idx < static_cast<Idx>(sizes[N])))
+    {
+      printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+             static_cast<int>(N), static_cast<long int>(idx),
+             static_cast<long int>(sizes[N] - 1));
+      RAJA_ABORT_OR_THROW("Out of bounds error \n");
+    }
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes the linear space index of indices: the row major index of
+   * their tile times tile_elems, plus their offset in the tile.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout, which
+   *                 must not be negative
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin
+  operator()(Indices... indices) const
+  {
+#if defined (RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(indices...);
+#endif
+    IdxLin const idx[n_dims] = {static_cast<IdxLin>(stripIndexType(indices))...};
+
+    IdxLin tile = 0;
+    for (size_t d = 0; d < n_dims; ++d) {
+      tile = tile * tiles[d] + idx[d] / tile_size;
+    }
+
+    return tile * tile_elems + in_tile_offset(idx);
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices,
+   *                      which must not be negative and not in the padding
+   *                      of a partial tile.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    IdxLin idx[n_dims];
+    in_tile_indices(linear_index % tile_elems, idx);
+
+    IdxLin tile = linear_index / tile_elems;
+    for (size_t d = n_dims; d-- > 0;) {
+      IdxLin num = tiles[d] ? tiles[d] : IdxLin(1);
+      idx[d] += (tile % num) * tile_size;
+      tile /= num;
+    }
+
+    camp::sink((indices = (camp::decay<Indices>)(idx[RangeInts]))...);
+  }
+
+  /*!
+   * Total number of tiles, some of which may be partially filled.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin num_tiles() const
+  {
+    return RAJA::product<IdxLin>(tiles[RangeInts]...);
+  }
+
+  /*!
+   * Size of the storage, including the padding of partial tiles.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return num_tiles() * tile_elems;
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size_noproj() const
+  {
+    return size();
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_size() const {
+    return sizes[DIM];
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_begin() const {
+    return 0;
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_stride() const {
+    static_assert(DIM < 0, "TiledLayout has no strides");
+    return 0;
+  }
+
+private:
+  //! log2 of t, for powers of two
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr IdxLin log2(IdxLin t)
+  {
+    return t <= 1 ? IdxLin(0) : IdxLin(1) + log2(t / 2);
+  }
+
+  //! Bits of each index in a Morton ordered tile
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr IdxLin tile_bits()
+  {
+    return log2(tile_size);
+  }
+
+  /*
+   * Offset in the tile, row major or with the bits of the indices
+   * interleaved, the last dimension in the lowest bits
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin
+  in_tile_offset(IdxLin const (&idx)[n_dims]) const
+  {
+    IdxLin offset = 0;
+    if (MORTON) {
+      for (IdxLin b = 0; b < tile_bits(); ++b) {
+        for (size_t d = 0; d < n_dims; ++d) {
+          offset |= (((idx[d] % tile_size) >> b) & IdxLin(1))
+                    << (b * IdxLin(n_dims) + IdxLin(n_dims - 1 - d));
+        }
+      }
+    } else {
+      for (size_t d = 0; d < n_dims; ++d) {
+        offset = offset * tile_size + idx[d] % tile_size;
+      }
+    }
+    return offset;
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE void in_tile_indices(IdxLin offset,
+                                                    IdxLin (&idx)[n_dims]) const
+  {
+    if (MORTON) {
+      for (size_t d = 0; d < n_dims; ++d) {
+        idx[d] = 0;
+      }
+      for (IdxLin b = 0; b < tile_bits(); ++b) {
+        for (size_t d = 0; d < n_dims; ++d) {
+          idx[d] |= ((offset >> (b * IdxLin(n_dims) + IdxLin(n_dims - 1 - d))) & IdxLin(1)) << b;
+        }
+      }
+    } else {
+      for (size_t d = n_dims; d-- > 0;) {
+        idx[d] = offset % tile_size;
+        offset /= tile_size;
+      }
+    }
+  }
+};
+
+template <camp::idx_t... RangeInts, camp::idx_t TILE_SIZE, bool MORTON, typename IdxLin>
+constexpr size_t TiledLayout_impl<camp::idx_seq<RangeInts...>, TILE_SIZE, MORTON, IdxLin>::n_dims;
+template <camp::idx_t... RangeInts, camp::idx_t TILE_SIZE, bool MORTON, typename IdxLin>
+constexpr IdxLin TiledLayout_impl<camp::idx_seq<RangeInts...>, TILE_SIZE, MORTON, IdxLin>::tile_size;
+template <camp::idx_t... RangeInts, camp::idx_t TILE_SIZE, bool MORTON, typename IdxLin>
+constexpr IdxLin TiledLayout_impl<camp::idx_seq<RangeInts...>, TILE_SIZE, MORTON, IdxLin>::tile_elems;
+template <camp::idx_t... RangeInts, camp::idx_t TILE_SIZE, bool MORTON, typename IdxLin>
+constexpr ptrdiff_t TiledLayout_impl<camp::idx_seq<RangeInts...>, TILE_SIZE, MORTON, IdxLin>::stride_one_dim;
+
+}  // namespace detail
+
+
+/*!
+ * @brief A mapping of n-dimensional indices to tile-major storage.
+ *
+ * The index space is split in tiles of TILE_SIZE in every dimension, and
+ * each tile is TILE_SIZE^n_dims contiguous values.  Neighbors in every
+ * direction are then close in memory, which a stencil on a row major array
+ * only has in its last dimension:
+ *
+ *     // 3-d mesh in 8x8x8 tiles of 512 values
+ *     TiledLayout<3, 8> layout(Nx, Ny, Nz);
+ *     RAJA::View<double, TiledLayout<3, 8>> u(new double[layout.size()], layout);
+ *
+ * The tiles are in row major order, and the values inside a tile are row
+ * major or, with MORTON, in Morton (Z) order, which also keeps sub-tiles
+ * together; Morton tiles must have a power of two size.  Partial tiles
+ * are padded, and size() includes the padding.
+ *
+ * Kernel Tile statements with tile_fixed<TILE_SIZE> over ranges starting
+ * at zero visit exactly the storage tiles, one contiguous block each:
+ *
+ *     statement::Tile<0, tile_fixed<layout_t::tile_size>, loop_exec, ...>
+ *
+ * The indices are not strided, so the layout does not support tensor
+ * accesses or View::shift.
+ */
+template <size_t n_dims,
+          camp::idx_t TILE_SIZE,
+          bool MORTON = false,
+          typename IdxLin = Index_type>
+using TiledLayout =
+    detail::TiledLayout_impl<camp::make_idx_seq_t<n_dims>, TILE_SIZE, MORTON, IdxLin>;
+
+/*!
+ * @brief TiledLayout with Morton ordered tiles
+ */
+template <size_t n_dims, camp::idx_t TILE_SIZE, typename IdxLin = Index_type>
+using MortonTiledLayout = TiledLayout<n_dims, TILE_SIZE, true, IdxLin>;
+
+}  // namespace RAJA
+
+#endif
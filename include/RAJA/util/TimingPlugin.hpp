@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Timing_Plugin_HPP
+#define RAJA_Timing_Plugin_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that times every loop, kernel and launch.
+   *
+   * The plugin is active when the environment variable RAJA_TIMING_FILE
+   * names the file to write at finalize(). The file is JSON if its name ends
+   * with ".json" and CSV otherwise.
+   *
+   * Each launch records the host wall time between preLaunch and postLaunch,
+   * and for CUDA and HIP loops with a resource the time between two events
+   * recorded on its stream. Records go to a ring buffer, and when it is full
+   * they are added to aggregates keyed by kernel name, launch site and
+   * policy, with the count, iterations, total, min and max times and a
+   * histogram of the host times in powers of two nanoseconds. Events are
+   * only waited on when their records are aggregated. Kernel names must stay
+   * valid until then.
+   */
+  class TimingPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    //! Records in the ring buffer, and pairs of events for device timing
+    static constexpr size_t ring_size = 1024;
+
+    //! Buckets of the histogram, bucket b holds times in [2^b, 2^(b+1)) ns
+    static constexpr int num_buckets = 40;
+
+    TimingPlugin();
+
+    ~TimingPlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    struct Record {
+      const char* kernel_name;
+      const char* launch_site;
+      const char* policy_name;
+      Platform platform;
+      size_t num_iterations;
+      int64_t host_ns;
+      //! index of the events of the record, or -1 without device timing
+      int event;
+    };
+
+    struct Aggregate {
+      Platform platform{Platform::undefined};
+      size_t count{0};
+      size_t num_iterations{0};
+      int64_t host_total{0};
+      int64_t host_min{0};
+      int64_t host_max{0};
+      size_t device_count{0};
+      double device_total_ms{0.0};
+      double device_min_ms{0.0};
+      double device_max_ms{0.0};
+      size_t histogram[num_buckets] = {};
+    };
+
+    using Key = std::tuple<std::string, std::string, std::string>;
+
+    int startEvent(const RAJA::util::PluginContext& p);
+
+    void stopEvent(const RAJA::util::PluginContext& p, int event);
+
+    double eventMilliseconds(int event);
+
+    void flush();
+
+    void write(const std::string& file) const;
+
+    bool m_active{false};
+    std::string m_file;
+
+    std::mutex m_mutex;
+    std::vector<Record> m_ring;
+    size_t m_next_event{0};
+    std::vector<void*> m_events;
+    std::map<Key, Aggregate> m_aggregates;
+  };  // end TimingPlugin class
+
+  void linkTimingPlugin();
+
+} // end namespace util
+} // end namespace RAJA
+
+#endif
@@ -25,8 +25,13 @@
 #include "RAJA/pattern/atomic.hpp"
 #include "RAJA/pattern/tensor.hpp"
 
+#include "RAJA/util/CheckedLayout.hpp"
+#include "RAJA/util/CompressedPtr.hpp"
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/RestrictPtr.hpp"
+#include "RAJA/util/StreamingPtr.hpp"
+#include "RAJA/util/ViewDimIterator.hpp"
 
 namespace RAJA
 {
@@ -68,6 +73,12 @@ namespace internal
     using type = RAJA::TypedOffsetLayout<IdxLin,camp::tuple<DimTypes...>>;
   };
 
+  template<typename layout>
+  struct add_offset<RAJA::CheckedLayout<layout>>
+  {
+    using type = RAJA::CheckedLayout<typename add_offset<layout>::type>;
+  };
+
 
 
 
@@ -90,6 +101,50 @@ namespace internal
     };
 
 
+    /*
+     * Pointer type of the non-const View of a const View
+     */
+    template<typename PointerType>
+    struct NonConstPointer {
+        using type = typename std::add_pointer<typename std::remove_const<
+            typename std::remove_pointer<PointerType>::type>::type>::type;
+    };
+
+    template<typename T, size_t ALIGN>
+    struct NonConstPointer<RestrictPtr<T, ALIGN>> {
+        using type = RestrictPtr<typename std::remove_const<T>::type, ALIGN>;
+    };
+
+    template<typename T, typename S>
+    struct NonConstPointer<CompressedPtr<T, S>> {
+        using type = CompressedPtr<typename std::remove_const<T>::type, S>;
+    };
+
+    template<typename T>
+    struct NonConstPointer<StreamingPtr<T>> {
+        using type = StreamingPtr<typename std::remove_const<T>::type>;
+    };
+
+
+    /*
+     * Type returned by a scalar access through PointerType
+     */
+    template<typename PointerType, typename ElementType>
+    struct ViewPointerReference {
+        using type = ElementType &;
+    };
+
+    template<typename T, typename S, typename ElementType>
+    struct ViewPointerReference<CompressedPtr<T, S>, ElementType> {
+        using type = typename CompressedPtr<T, S>::reference;
+    };
+
+    template<typename T, typename ElementType>
+    struct ViewPointerReference<StreamingPtr<T>, ElementType> {
+        using type = typename StreamingPtr<T>::reference;
+    };
+
+
 
   } // namespace detail
 
@@ -162,7 +217,7 @@ namespace internal
   template<typename ... Args, typename ElementType, typename PointerType, typename LinIdx, camp::idx_t StrideOneDim>
   struct ViewReturnHelper<camp::idx_seq<>, camp::list<Args...>, ElementType, PointerType, LinIdx, StrideOneDim>
   {
-      using return_type = ElementType &;
+      using return_type = typename ViewPointerReference<PointerType, ElementType>::type;
 
       template<typename LayoutType>
       RAJA_INLINE
@@ -346,8 +401,7 @@ class ViewBase {
     using layout_type = LayoutType;
     using linear_index_type = typename layout_type::IndexLinear;
     using nc_value_type = typename std::remove_const<value_type>::type;
-    using nc_pointer_type = typename std::add_pointer<typename std::remove_const<
-        typename std::remove_pointer<pointer_type>::type>::type>::type;
+    using nc_pointer_type = typename detail::NonConstPointer<pointer_type>::type;
 
     using Self = ViewBase<value_type, pointer_type, layout_type>;
     using NonConstView = ViewBase<nc_value_type, nc_pointer_type, layout_type>;
@@ -497,6 +551,90 @@ class ViewBase {
     }
 
 
+    /*!
+     * Returns an iterator along dimension DIM, starting at the element at
+     * args, which replaces the layout computation of each access in a loop
+     * over DIM by an add
+     *
+     * @see RAJA::ViewDimIterator
+     */
+    template <camp::idx_t DIM, typename... Args>
+    RAJA_HOST_DEVICE
+    RAJA_INLINE
+    ViewDimIterator<value_type, linear_index_type, DIM == layout_type::stride_one_dim>
+    dim_iterator(Args... args) const
+    {
+      static_assert(DIM >= 0 && DIM < (camp::idx_t)layout_type::n_dims,
+          "dim_iterator dimension out of range");
+      return ViewDimIterator<value_type, linear_index_type, DIM == layout_type::stride_one_dim>(
+          &m_data[stripIndexType(m_layout(args...))],
+          m_layout.template get_dim_stride<DIM>());
+    }
+
+
+
+    /*!
+     * Returns a zero based View of the box [begin, end) of this View, which
+     * is its data offset to begin with the same strides.  Nothing is
+     * allocated and no layout divisors are computed, so this is cheap enough
+     * to create per patch or per step.
+     *
+     * The layout must provide sub_layout, as RAJA::Layout and
+     * RAJA::OffsetLayout do.
+     */
+    template <size_t n_dims = layout_type::n_dims, typename IdxLin = linear_index_type>
+    RAJA_INLINE
+    auto sub_view(const std::array<IdxLin, n_dims>& begin,
+                  const std::array<IdxLin, n_dims>& end) const
+      -> ViewBase<value_type, value_type *,
+                  camp::decay<decltype(m_layout.sub_layout(
+                      std::declval<std::array<linear_index_type, n_dims> const&>()))>>
+    {
+      static_assert(n_dims==layout_type::n_dims, "Dimension mismatch in view sub_view");
+
+      std::array<linear_index_type, n_dims> sizes;
+      for (size_t i = 0; i < n_dims; ++i) {
+        sizes[i] = static_cast<linear_index_type>(end[i] - begin[i]);
+      }
+
+      return {&m_data[stripIndexType(linear_at(begin, camp::make_idx_seq_t<n_dims>{}))],
+              m_layout.sub_layout(sizes)};
+    }
+
+    /*!
+     * Returns a zero based View of this View without ghost layers of
+     * ghosts[i] indices at both ends of each dimension i
+     */
+    template <size_t n_dims = layout_type::n_dims, typename IdxLin = linear_index_type>
+    RAJA_INLINE
+    auto interior(const std::array<IdxLin, n_dims>& ghosts) const
+      -> decltype(sub_view(ghosts, ghosts))
+    {
+      std::array<IdxLin, n_dims> begin, end;
+      get_bounds(begin, end, camp::make_idx_seq_t<n_dims>{});
+      for (size_t i = 0; i < n_dims; ++i) {
+        begin[i] += ghosts[i];
+        end[i] -= ghosts[i];
+      }
+      return sub_view(begin, end);
+    }
+
+    /*!
+     * Returns a zero based View of the indices [begin, end) of dimension dim
+     * of this View, with all of the other dimensions, such as a face slab
+     */
+    template <size_t n_dims = layout_type::n_dims, typename IdxLin = linear_index_type>
+    RAJA_INLINE
+    auto slab(size_t dim, IdxLin begin, IdxLin end) const
+      -> decltype(sub_view(std::declval<std::array<IdxLin, n_dims> const&>(),
+                           std::declval<std::array<IdxLin, n_dims> const&>()))
+    {
+      std::array<IdxLin, n_dims> sub_begin, sub_end;
+      get_bounds(sub_begin, sub_end, camp::make_idx_seq_t<n_dims>{});
+      sub_begin[dim] = begin;
+      sub_end[dim] = end;
+      return sub_view(sub_begin, sub_end);
+    }
 
     template <size_t n_dims = layout_type::n_dims, typename IdxLin = linear_index_type>
     RAJA_INLINE
@@ -510,6 +648,26 @@ class ViewBase {
       return ShiftedView(m_data, shift_layout);
     }
 
+  private:
+    template <typename IdxLin, camp::idx_t... Dims>
+    RAJA_INLINE
+    linear_index_type linear_at(const std::array<IdxLin, sizeof...(Dims)>& idx,
+                                camp::idx_seq<Dims...>) const
+    {
+      return m_layout(idx[Dims]...);
+    }
+
+    template <typename IdxLin, camp::idx_t... Dims>
+    RAJA_INLINE
+    void get_bounds(std::array<IdxLin, sizeof...(Dims)>& begin,
+                    std::array<IdxLin, sizeof...(Dims)>& end,
+                    camp::idx_seq<Dims...>) const
+    {
+      camp::sink((begin[Dims] = static_cast<IdxLin>(
+                      m_layout.template get_dim_begin<Dims>()))...);
+      camp::sink((end[Dims] = begin[Dims] + static_cast<IdxLin>(
+                      m_layout.template get_dim_size<Dims>()))...);
+    }
 };
 
 
@@ -533,8 +691,7 @@ class TypedViewBase<ValueType, PointerType, LayoutType, camp::list<IndexTypes...
     using layout_type = LayoutType;
     using linear_index_type = typename layout_type::IndexLinear;
     using nc_value_type = typename std::remove_const<value_type>::type;
-    using nc_pointer_type = typename std::add_pointer<typename std::remove_const<
-        typename std::remove_pointer<pointer_type>::type>::type>::type;
+    using nc_pointer_type = typename detail::NonConstPointer<pointer_type>::type;
 
     using Base = ViewBase<ValueType, PointerType, LayoutType>;
     using Self = TypedViewBase<value_type, pointer_type, layout_type, camp::list<IndexTypes...> >;
@@ -576,6 +733,16 @@ class TypedViewBase<ValueType, PointerType, LayoutType, camp::list<IndexTypes...
     }
 
 
+    template <camp::idx_t DIM, typename... Args>
+    RAJA_HOST_DEVICE
+    RAJA_INLINE
+    ViewDimIterator<value_type, linear_index_type, DIM == layout_type::stride_one_dim>
+    dim_iterator(Args... args) const
+    {
+      return Base::template dim_iterator<DIM>(match_typed_view_arg<IndexTypes>(args)...);
+    }
+
+
 
     template <size_t n_dims = sizeof...(IndexTypes), typename IdxLin = linear_index_type>
     RAJA_INLINE
@@ -24,8 +24,11 @@
 
 #include "RAJA/pattern/atomic.hpp"
 
+#include "RAJA/util/AoSoALayout.hpp"
+#include "RAJA/util/CheckedLayout.hpp"
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
 #include "RAJA/util/TypedViewBase.hpp"
 
 namespace RAJA
@@ -46,6 +49,12 @@ struct add_offset<RAJA::TypedLayout<IdxLin,camp::tuple<DimTypes...>>>
   using type = RAJA::TypedOffsetLayout<IdxLin,camp::tuple<DimTypes...>>;
 };
 
+template<typename layout>
+struct add_offset<RAJA::CheckedLayout<layout>>
+{
+  using type = RAJA::CheckedLayout<typename add_offset<layout>::type>;
+};
+
 template <typename ValueType,
           typename LayoutType,
           typename PointerType = ValueType *>
@@ -58,8 +67,88 @@ template <typename ValueType, typename LayoutType, typename... IndexTypes>
 using TypedView =
     internal::TypedViewBase<ValueType, ValueType *, LayoutType, camp::list<IndexTypes...> >;
 
+/*!
+ * Views that check the bounds of every access, see RAJA::CheckedLayout
+ */
+template <typename ValueType,
+          typename LayoutType,
+          typename PointerType = ValueType *>
+using CheckedView =
+    internal::ViewBase<ValueType, PointerType, CheckedLayout<LayoutType>>;
 
+template <typename ValueType, typename LayoutType, typename... IndexTypes>
+using TypedCheckedView =
+    internal::TypedViewBase<ValueType, ValueType *, CheckedLayout<LayoutType>, camp::list<IndexTypes...> >;
 
+/*!
+ * Views whose data is not aliased, and is aligned to ALIGN bytes, see
+ * RAJA::RestrictPtr
+ */
+template <typename ValueType,
+          typename LayoutType,
+          size_t ALIGN = alignof(ValueType)>
+using RestrictView =
+    internal::ViewBase<ValueType, RestrictPtr<ValueType, ALIGN>, LayoutType>;
+
+template <typename ValueType, typename LayoutType, size_t ALIGN, typename... IndexTypes>
+using TypedRestrictView =
+    internal::TypedViewBase<ValueType, RestrictPtr<ValueType, ALIGN>, LayoutType, camp::list<IndexTypes...> >;
+
+/*!
+ * Views that store values as StorageType and access them as ValueType, see
+ * RAJA::CompressedPtr
+ */
+template <typename ValueType, typename StorageType, typename LayoutType>
+using CompressedView =
+    internal::ViewBase<ValueType, CompressedPtr<ValueType, StorageType>, LayoutType>;
+
+template <typename ValueType, typename StorageType, typename LayoutType, typename... IndexTypes>
+using TypedCompressedView =
+    internal::TypedViewBase<ValueType, CompressedPtr<ValueType, StorageType>, LayoutType, camp::list<IndexTypes...> >;
+
+/*!
+ * Views whose stores are non-temporal, for arrays that are written once and
+ * not read again soon, see RAJA::StreamingPtr
+ */
+template <typename ValueType, typename LayoutType>
+using StreamingView =
+    internal::ViewBase<ValueType, StreamingPtr<ValueType>, LayoutType>;
+
+template <typename ValueType, typename LayoutType, typename... IndexTypes>
+using TypedStreamingView =
+    internal::TypedViewBase<ValueType, StreamingPtr<ValueType>, LayoutType, camp::list<IndexTypes...> >;
+
+
+
+
+
+/*!
+ * @brief Returns a View of the storage of an AoSoALayout View indexed by
+ * (tile, field, lane).
+ *
+ * The lanes are stride one, so a tensor index over the lanes of a tile is a
+ * packed load or store:
+ *
+ *     using vec_t = RAJA::expt::VectorRegister<double>;
+ *     using idx_t = RAJA::expt::VectorIndex<int, vec_t>;
+ *
+ *     RAJA::View<double, RAJA::AoSoALayout<vec_t::s_num_elem>> x(ptr, N, F);
+ *     auto x_tiles = RAJA::make_aosoa_tile_view(x);
+ *
+ *     x_tiles(t, f, idx_t::all()) *= 2.0;
+ *
+ * and on GPUs the threads of a warp can take the lanes of a tile.
+ */
+template <typename ValueType, typename PointerType, camp::idx_t TILE_SIZE,
+          typename IdxLin>
+RAJA_INLINE RAJA_HOST_DEVICE
+View<ValueType, typename AoSoALayout<TILE_SIZE, IdxLin>::tile_layout_type, PointerType>
+make_aosoa_tile_view(
+    internal::ViewBase<ValueType, PointerType, AoSoALayout<TILE_SIZE, IdxLin>> const &view)
+{
+  return View<ValueType, typename AoSoALayout<TILE_SIZE, IdxLin>::tile_layout_type, PointerType>(
+      view.get_data(), view.get_layout().tile_layout());
+}
 
 
 template <typename IndexType, typename ValueType>
@@ -232,6 +321,86 @@ struct MultiView {
   }
 };
 
+// A MultiView over a compile-time number of arrays, whose pointers are held
+// in the MultiView itself instead of in an array-of-pointers.
+//
+// Captured by a lambda, the pointer table is copied with it, so on GPUs it
+// is passed in the kernel parameters, which are read through the constant
+// cache, and an access does not first load its pointer from global memory.
+// When the array index is known at compile time, as in an unrolled loop over
+// the arrays, the pointers stay in registers. The arrays are given by an
+// array of NumArrays pointers, which is only read in the constructor.
+template <typename ValueType,
+          typename LayoutType,
+          RAJA::Index_type NumArrays,
+          RAJA::Index_type P2Pidx = 0>
+struct FixedMultiView {
+  using value_type = ValueType;
+  using pointer_type = ValueType *;
+  using layout_type = LayoutType;
+  using nc_value_type = camp::decay<value_type>;
+  using nc_pointer_type = nc_value_type *;
+  using NonConstView = FixedMultiView<nc_value_type, layout_type, NumArrays, P2Pidx>;
+
+  static_assert(NumArrays > 0, "FixedMultiView must have at least one array");
+
+  static constexpr RAJA::Index_type num_arrays = NumArrays;
+
+  layout_type const layout;
+  pointer_type data[NumArrays];
+
+  template <typename... Args>
+  RAJA_INLINE FixedMultiView(pointer_type const *data_ptrs, Args... dim_sizes)
+      : layout(dim_sizes...)
+  {
+    set_data(data_ptrs);
+  }
+
+  RAJA_INLINE FixedMultiView(pointer_type const *data_ptrs, layout_type &&layout)
+      : layout(layout)
+  {
+    set_data(data_ptrs);
+  }
+
+  RAJA_INLINE constexpr FixedMultiView(FixedMultiView const &) = default;
+  RAJA_INLINE constexpr FixedMultiView(FixedMultiView &&) = default;
+
+  template <bool IsConstView = std::is_const<value_type>::value>
+  RAJA_INLINE FixedMultiView(
+      typename std::enable_if<IsConstView, NonConstView>::type const &rhs)
+      : layout(rhs.layout)
+  {
+    set_data(rhs.data);
+  }
+
+  template <typename PtrType>
+  RAJA_INLINE void set_data(PtrType const *data_ptrs)
+  {
+    for (RAJA::Index_type i = 0; i < NumArrays; ++i) {
+      data[i] = data_ptrs[i];
+    }
+  }
+
+  // Moving the position of the index into the pointer table
+  // is set by P2Pidx, which is defaulted to 0.
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Args... ar) const
+  {
+    auto pidx = stripIndexType( camp::get<P2Pidx>( camp::forward_as_tuple( ar... ) ) );
+
+    if ( pidx < 0 || pidx >= NumArrays )
+    {
+      RAJA_ABORT_OR_THROW( "Index out of range while accessing array of pointers.\n" );
+    }
+
+    auto idx = stripIndexType( removenth<LayoutType, P2Pidx>( layout, camp::forward_as_tuple( ar... ) ) );
+    return data[pidx][idx];
+  }
+};
+
+template <typename ValueType, typename LayoutType, RAJA::Index_type NumArrays, RAJA::Index_type P2Pidx>
+constexpr RAJA::Index_type FixedMultiView<ValueType, LayoutType, NumArrays, P2Pidx>::num_arrays;
+
 template <typename ViewType, typename AtomicPolicy = RAJA::auto_atomic>
 struct AtomicViewWrapper {
   using base_type = ViewType;
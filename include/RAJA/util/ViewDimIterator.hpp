@@ -0,0 +1,195 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining an iterator along one dimension of a
+ *          View.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_VIEW_DIM_ITERATOR_HPP
+#define RAJA_VIEW_DIM_ITERATOR_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief Iterator along one dimension of a View, returned by
+ * View::dim_iterator<DIM>(indices...).
+ *
+ * Every View access computes the dot product of its indices with the layout
+ * strides.  In an inner loop only one index changes, and the iterator keeps
+ * the address of the current element and the stride of that dimension, so
+ * each access is an add instead:
+ *
+ *     RAJA::View<double, RAJA::Layout<3>> psi(data, Ng, Nd, Nz);
+ *
+ *     auto psi_z = psi.dim_iterator<2>(g, d, 0);
+ *     for (int z = 0; z < Nz; ++z) {
+ *       sum += psi_z[z];              // psi(g, d, z)
+ *     }
+ *
+ * When the layout declares DIM as its stride one dimension, as
+ * Layout<3, Index_type, 2> above would and StaticLayouts do, STRIDE_ONE is
+ * true and the stride is not read at all, so the loop is the same as one
+ * over a raw pointer.
+ *
+ * The iterator does not check bounds.
+ */
+template <typename ValueType, typename IdxLin, bool STRIDE_ONE>
+class ViewDimIterator
+{
+public:
+  using value_type = typename std::remove_const<ValueType>::type;
+  using difference_type = IdxLin;
+  using pointer = ValueType *;
+  using reference = ValueType &;
+  using iterator_category = std::random_access_iterator_tag;
+
+  using Self = ViewDimIterator<ValueType, IdxLin, STRIDE_ONE>;
+
+  static constexpr bool stride_one = STRIDE_ONE;
+
+private:
+  pointer m_ptr;
+  IdxLin m_stride;
+
+public:
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr ViewDimIterator() : m_ptr(nullptr), m_stride(1) {}
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr ViewDimIterator(pointer ptr, IdxLin stride)
+      : m_ptr(ptr), m_stride(STRIDE_ONE ? IdxLin(1) : stride)
+  {
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr IdxLin stride() const { return STRIDE_ONE ? IdxLin(1) : m_stride; }
+
+  /*!
+   * Address of the current element
+   */
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr pointer get() const { return m_ptr; }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr reference operator*() const { return *m_ptr; }
+
+  /*!
+   * Element k along the dimension, relative to the current element
+   */
+  template <typename IDX>
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr reference operator[](IDX k) const
+  {
+    return m_ptr[IdxLin(stripIndexType(k)) * stride()];
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  Self &operator++()
+  {
+    m_ptr += stride();
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  Self operator++(int)
+  {
+    Self tmp(*this);
+    m_ptr += stride();
+    return tmp;
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  Self &operator--()
+  {
+    m_ptr -= stride();
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  Self operator--(int)
+  {
+    Self tmp(*this);
+    m_ptr -= stride();
+    return tmp;
+  }
+
+  template <typename IDX>
+  RAJA_HOST_DEVICE RAJA_INLINE Self &operator+=(IDX k)
+  {
+    m_ptr += IdxLin(stripIndexType(k)) * stride();
+    return *this;
+  }
+
+  template <typename IDX>
+  RAJA_HOST_DEVICE RAJA_INLINE Self &operator-=(IDX k)
+  {
+    m_ptr -= IdxLin(stripIndexType(k)) * stride();
+    return *this;
+  }
+
+  template <typename IDX>
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr Self operator+(IDX k) const
+  {
+    return Self(m_ptr + IdxLin(stripIndexType(k)) * stride(), m_stride);
+  }
+
+  template <typename IDX>
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr Self operator-(IDX k) const
+  {
+    return Self(m_ptr - IdxLin(stripIndexType(k)) * stride(), m_stride);
+  }
+
+  /*!
+   * Number of elements between two iterators along the same dimension
+   */
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr difference_type operator-(Self const &rhs) const
+  {
+    return difference_type(m_ptr - rhs.m_ptr) / stride();
+  }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr bool operator==(Self const &rhs) const { return m_ptr == rhs.m_ptr; }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  constexpr bool operator!=(Self const &rhs) const { return m_ptr != rhs.m_ptr; }
+};
+
+template <typename ValueType, typename IdxLin, bool STRIDE_ONE>
+constexpr bool ViewDimIterator<ValueType, IdxLin, STRIDE_ONE>::stride_one;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,127 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for asynchronous copies from global to shared memory.
+ *
+ *          On CUDA devices of compute capability 8.0 and newer the copies
+ *          use cp.async, so the loads of a tile are in flight while the
+ *          threads work on the tile staged before it. Elsewhere the copies
+ *          are plain loads and stores, and the commit and wait calls do
+ *          nothing.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_async_copy_HPP
+#define RAJA_util_async_copy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+#if defined(RAJA_ENABLE_CUDA) && defined(__CUDA_ARCH__) && \
+    (__CUDA_ARCH__ >= 800) && (CUDART_VERSION >= 11000)
+#define RAJA_ASYNC_COPY_CP_ASYNC
+#endif
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+//! Sizes cp.async copies in one instruction
+template <typename T>
+struct is_async_copyable
+    : std::integral_constant<bool,
+                             std::is_trivially_copyable<T>::value &&
+                                 (sizeof(T) == 4 || sizeof(T) == 8 ||
+                                  sizeof(T) == 16)> {
+};
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy_impl(T* dst,
+                                                  T const* src,
+                                                  std::false_type)
+{
+  *dst = *src;
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy_impl(T* dst,
+                                                  T const* src,
+                                                  std::true_type)
+{
+#if defined(RAJA_ASYNC_COPY_CP_ASYNC)
+  const unsigned shared_dst =
+      static_cast<unsigned>(__cvta_generic_to_shared(dst));
+  asm volatile("cp.async.ca.shared.global [%0], [%1], %2;\n" ::"r"(shared_dst),
+               "l"(src),
+               "n"(sizeof(T)));
+#else
+  *dst = *src;
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Start copying *src in global memory to *dst in shared memory.
+ *
+ * The copy is complete for the calling thread after the async_copy_wait
+ * that covers its group. Other threads of the block see it after a
+ * synchronization that follows that wait. Types of 4, 8 or 16 bytes that
+ * are aligned to their size are copied asynchronously where supported.
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy(T* dst, T const* src)
+{
+  detail::async_copy_impl(dst, src, detail::is_async_copyable<T>{});
+}
+
+/*!
+ * \brief End the group of copies started by the calling thread since the
+ *        last commit.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy_commit()
+{
+#if defined(RAJA_ASYNC_COPY_CP_ASYNC)
+  asm volatile("cp.async.commit_group;\n" ::);
+#endif
+}
+
+/*!
+ * \brief Wait until at most Pending of the groups committed by the calling
+ *        thread are still in flight.
+ *
+ * With one group per stage of a pipeline of S stages, async_copy_wait<S-1>
+ * waits for the oldest stage only.
+ */
+template <int Pending>
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy_wait()
+{
+  static_assert(Pending >= 0, "Pending must not be negative");
+#if defined(RAJA_ASYNC_COPY_CP_ASYNC)
+  asm volatile("cp.async.wait_group %0;\n" ::"n"(Pending));
+#endif
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
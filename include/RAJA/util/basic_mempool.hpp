@@ -18,12 +18,25 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <atomic>
 #include <cassert>
+#include <climits>
 #include <cstddef>
 #include <cstdio>
+#include <cstdint>
 #include <cstdlib>
+#include <deque>
+#include <iterator>
 #include <list>
 #include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#define RAJA_BASIC_MEMPOOL_HAVE_MMAP
+#endif
 
 #include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
@@ -48,6 +61,13 @@ namespace detail
  * get/give are the primary calls used by class MemPool to get aligned memory
  * from the pool or give it back
  *
+ * When size classes are enabled small requests are rounded up to a power of
+ * two and served from slabs carved out of the map based free space. Each slab
+ * holds blocks of a single size class and keeps a stack of its free blocks so
+ * get/give of small blocks are O(1) and do not allocate host memory once the
+ * slab exists. The book-keeping for slabs lives on the host, so it is safe to
+ * use with memory that is not host accessible. Larger requests use the map
+ * based free space directly.
  *
  ******************************************************************************
  */
@@ -59,16 +79,47 @@ public:
   using used_type = std::map<void*, void*>;
   using used_value_type = typename used_type::value_type;
 
-  MemoryArena(void* ptr, size_t size)
+  //! smallest size class, in bytes, 2^min_size_class_shift
+  static const size_t min_size_class_shift = 4;
+  //! largest size class, in bytes, 2^max_size_class_shift
+  static const size_t max_size_class_shift = 12;
+  static const size_t num_size_classes =
+      max_size_class_shift - min_size_class_shift + 1;
+  //! size and alignment of the slabs used to hold size class blocks
+  static const size_t slab_bytes = 64ull * 1024ull;
+
+  MemoryArena(void* ptr, size_t size, bool use_size_classes = false)
     : m_allocation{ ptr, static_cast<char*>(ptr)+size },
       m_free_space(),
-      m_used_space()
+      m_used_space(),
+      m_use_size_classes(use_size_classes),
+      m_slabs(),
+      m_unused_slab_slots(),
+      m_slab_lookup(),
+      m_slab_lookup_base(0),
+      m_num_slab_blocks_used(0),
+      m_bytes_in_use(0),
+      m_num_allocations(0)
   {
      m_free_space[ptr] = static_cast<char*>(ptr)+size ;
     if (m_allocation.begin == nullptr) {
       fprintf(stderr, "Attempt to create MemoryArena with no memory");
       std::abort();
     }
+    for (size_t c = 0; c < num_size_classes; ++c) {
+      m_partial_slabs[c] = invalid_slab;
+    }
+    if (m_use_size_classes) {
+      // one lookup entry per slab_bytes aligned window of the allocation
+      m_slab_lookup_base =
+          reinterpret_cast<std::uintptr_t>(m_allocation.begin) &
+          ~static_cast<std::uintptr_t>(slab_bytes - 1);
+      const std::uintptr_t end =
+          reinterpret_cast<std::uintptr_t>(m_allocation.end);
+      m_slab_lookup.assign((end - m_slab_lookup_base + slab_bytes - 1) /
+                               slab_bytes,
+                           static_cast<size_t>(invalid_slab));
+    }
   }
 
   MemoryArena(MemoryArena const&) = delete;
@@ -83,11 +134,286 @@ public:
            static_cast<char*>(m_allocation.begin);
   }
 
-  bool unused() { return m_used_space.empty(); }
+  bool unused()
+  {
+    // slabs sit in used space even when all of their blocks are free
+    return m_num_slab_blocks_used == 0 &&
+           m_used_space.size() == m_slabs.size() - m_unused_slab_slots.size();
+  }
+
+  bool uses_size_classes() const { return m_use_size_classes; }
+
+  //! get the size class that serves nbytes with the given alignment,
+  //  returns false if the request is too large for the size classes
+  static bool get_size_class(size_t nbytes, size_t alignment, size_t& class_id)
+  {
+    size_t bytes = (nbytes > alignment) ? nbytes : alignment;
+    if (bytes > (size_t(1) << max_size_class_shift)) {
+      return false;
+    }
+    size_t shift = min_size_class_shift;
+    while ((size_t(1) << shift) < bytes) {
+      ++shift;
+    }
+    class_id = shift - min_size_class_shift;
+    return true;
+  }
+
+  static size_t size_class_bytes(size_t class_id)
+  {
+    return size_t(1) << (class_id + min_size_class_shift);
+  }
+
+  //! check if ptr is a block in use in this arena, if so get its size
+  bool size_of(void* ptr, size_t& nbytes)
+  {
+    if (m_allocation.begin <= ptr && ptr < m_allocation.end) {
+      if (m_use_size_classes) {
+        size_t slab_id = m_slab_lookup[lookup_index(ptr)];
+        if (slab_id != invalid_slab) {
+          nbytes = m_slabs[slab_id].block_bytes;
+          return true;
+        }
+      }
+      used_type::iterator found = m_used_space.find(ptr);
+      if (found != m_used_space.end()) {
+        nbytes = static_cast<size_t>(static_cast<char*>(found->second) -
+                                     static_cast<char*>(found->first));
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! check if ptr is a size class block in use, if so get its size class
+  bool size_class_of(void* ptr, size_t& class_id)
+  {
+    if (m_use_size_classes && m_allocation.begin <= ptr &&
+        ptr < m_allocation.end) {
+      size_t slab_id = m_slab_lookup[lookup_index(ptr)];
+      if (slab_id != invalid_slab) {
+        class_id = m_slabs[slab_id].class_id;
+        return true;
+      }
+    }
+    return false;
+  }
 
   void* get_allocation() { return m_allocation.begin; }
 
+  //! bytes in blocks handed out by get, including size class rounding
+  size_t bytes_in_use() const { return m_bytes_in_use; }
+
+  //! number of blocks handed out by get
+  size_t num_allocations() const { return m_num_allocations; }
+
+  //! call func(nbytes, count) for the free blocks in this arena
+  template <typename func_type>
+  void for_each_free_block(func_type&& func) const
+  {
+    for (const free_value_type& chunk : m_free_space) {
+      func(static_cast<size_t>(static_cast<char*>(chunk.second) -
+                               static_cast<char*>(chunk.first)),
+           size_t(1));
+    }
+    for (const size_class_slab& slab : m_slabs) {
+      if (slab.begin != nullptr && !slab.free_blocks.empty()) {
+        func(slab.block_bytes, slab.free_blocks.size());
+      }
+    }
+  }
+
   void* get(size_t nbytes, size_t alignment)
+  {
+    size_t class_id;
+    if (m_use_size_classes && get_size_class(nbytes, alignment, class_id)) {
+      void* ptr_out = get_block(class_id);
+      if (ptr_out != nullptr) {
+        m_bytes_in_use += size_class_bytes(class_id);
+        ++m_num_allocations;
+        return ptr_out;
+      }
+    }
+    void* ptr_out = get_chunk(nbytes, alignment);
+    if (ptr_out != nullptr) {
+      m_bytes_in_use += nbytes;
+      ++m_num_allocations;
+    }
+    return ptr_out;
+  }
+
+  bool give(void* ptr)
+  {
+    if (m_allocation.begin <= ptr && ptr < m_allocation.end) {
+
+      if (m_use_size_classes) {
+        size_t slab_id = m_slab_lookup[lookup_index(ptr)];
+        if (slab_id != invalid_slab) {
+          m_bytes_in_use -= m_slabs[slab_id].block_bytes;
+          --m_num_allocations;
+          give_block(slab_id, ptr);
+          return true;
+        }
+      }
+
+      m_bytes_in_use -= give_chunk(ptr);
+      --m_num_allocations;
+
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+private:
+  static const size_t invalid_slab = ~static_cast<size_t>(0);
+
+  struct memory_chunk {
+    void* begin;
+    void* end;
+  };
+
+  struct size_class_slab {
+    char* begin;
+    size_t class_id;
+    size_t block_bytes;
+    // links in the list of slabs of this size class with free blocks
+    size_t prev;
+    size_t next;
+    // stack of free block indices, capacity is reserved on slab creation
+    std::vector<unsigned> free_blocks;
+    std::vector<bool> block_used;
+  };
+
+  size_t lookup_index(void* ptr) const
+  {
+    return (reinterpret_cast<std::uintptr_t>(ptr) - m_slab_lookup_base) /
+           slab_bytes;
+  }
+
+  void link_partial_slab(size_t slab_id)
+  {
+    size_class_slab& slab = m_slabs[slab_id];
+    size_t& head = m_partial_slabs[slab.class_id];
+    slab.prev = invalid_slab;
+    slab.next = head;
+    if (head != invalid_slab) {
+      m_slabs[head].prev = slab_id;
+    }
+    head = slab_id;
+  }
+
+  void unlink_partial_slab(size_t slab_id)
+  {
+    size_class_slab& slab = m_slabs[slab_id];
+    if (slab.prev != invalid_slab) {
+      m_slabs[slab.prev].next = slab.next;
+    } else {
+      m_partial_slabs[slab.class_id] = slab.next;
+    }
+    if (slab.next != invalid_slab) {
+      m_slabs[slab.next].prev = slab.prev;
+    }
+    slab.prev = invalid_slab;
+    slab.next = invalid_slab;
+  }
+
+  size_t add_slab(size_t class_id)
+  {
+    void* ptr = get_chunk(slab_bytes, slab_bytes);
+    if (ptr == nullptr) {
+      return invalid_slab;
+    }
+
+    size_t slab_id;
+    if (!m_unused_slab_slots.empty()) {
+      slab_id = m_unused_slab_slots.back();
+      m_unused_slab_slots.pop_back();
+    } else {
+      slab_id = m_slabs.size();
+      m_slabs.emplace_back();
+    }
+
+    size_class_slab& slab = m_slabs[slab_id];
+    slab.begin = static_cast<char*>(ptr);
+    slab.class_id = class_id;
+    slab.block_bytes = size_class_bytes(class_id);
+
+    // push blocks in reverse so blocks are handed out in address order
+    const size_t num_blocks = slab_bytes / slab.block_bytes;
+    slab.free_blocks.resize(num_blocks);
+    for (size_t i = 0; i < num_blocks; ++i) {
+      slab.free_blocks[i] = static_cast<unsigned>(num_blocks - 1 - i);
+    }
+    slab.block_used.assign(num_blocks, false);
+
+    m_slab_lookup[lookup_index(ptr)] = slab_id;
+    link_partial_slab(slab_id);
+
+    return slab_id;
+  }
+
+  void remove_slab(size_t slab_id)
+  {
+    size_class_slab& slab = m_slabs[slab_id];
+    unlink_partial_slab(slab_id);
+    m_slab_lookup[lookup_index(slab.begin)] = invalid_slab;
+    give_chunk(slab.begin);
+    slab.begin = nullptr;
+    m_unused_slab_slots.push_back(slab_id);
+  }
+
+  void* get_block(size_t class_id)
+  {
+    size_t slab_id = m_partial_slabs[class_id];
+    if (slab_id == invalid_slab) {
+      slab_id = add_slab(class_id);
+      if (slab_id == invalid_slab) {
+        return nullptr;
+      }
+    }
+
+    size_class_slab& slab = m_slabs[slab_id];
+    const size_t block = slab.free_blocks.back();
+    slab.free_blocks.pop_back();
+    slab.block_used[block] = true;
+    ++m_num_slab_blocks_used;
+
+    if (slab.free_blocks.empty()) {
+      unlink_partial_slab(slab_id);
+    }
+
+    return slab.begin + block * slab.block_bytes;
+  }
+
+  void give_block(size_t slab_id, void* ptr)
+  {
+    size_class_slab& slab = m_slabs[slab_id];
+    const size_t offset = static_cast<size_t>(static_cast<char*>(ptr) -
+                                              slab.begin);
+    const size_t block = offset / slab.block_bytes;
+
+    if (offset % slab.block_bytes != 0 || !slab.block_used[block]) {
+      fprintf(stderr, "Invalid free %p", ptr);
+      std::abort();
+    }
+
+    slab.block_used[block] = false;
+    slab.free_blocks.push_back(static_cast<unsigned>(block));
+    --m_num_slab_blocks_used;
+
+    const size_t num_blocks = slab_bytes / slab.block_bytes;
+    if (slab.free_blocks.size() == 1) {
+      link_partial_slab(slab_id);
+    } else if (slab.free_blocks.size() == num_blocks &&
+               (m_partial_slabs[slab.class_id] != slab_id ||
+                slab.next != invalid_slab)) {
+      // keep one slab with free blocks per size class, release the rest
+      remove_slab(slab_id);
+    }
+  }
+
+  void* get_chunk(size_t nbytes, size_t alignment)
   {
     void* ptr_out = nullptr;
     if (capacity() >= nbytes) {
@@ -116,34 +442,28 @@ public:
     return ptr_out;
   }
 
-  bool give(void* ptr)
+  //! returns the size of the chunk given back
+  size_t give_chunk(void* ptr)
   {
-    if (m_allocation.begin <= ptr && ptr < m_allocation.end) {
-
-      used_type::iterator found = m_used_space.find(ptr);
+    size_t nbytes = 0;
+    used_type::iterator found = m_used_space.find(ptr);
 
-      if (found != m_used_space.end()) {
+    if (found != m_used_space.end()) {
 
-        add_free_chunk(found->first, found->second);
+      nbytes = static_cast<size_t>(static_cast<char*>(found->second) -
+                                   static_cast<char*>(found->first));
 
-        m_used_space.erase(found);
+      add_free_chunk(found->first, found->second);
 
-      } else {
-        fprintf(stderr, "Invalid free %p", ptr);
-        std::abort();
-      }
+      m_used_space.erase(found);
 
-      return true;
     } else {
-      return false;
+      fprintf(stderr, "Invalid free %p", ptr);
+      std::abort();
     }
-  }
 
-private:
-  struct memory_chunk {
-    void* begin;
-    void* end;
-  };
+    return nbytes;
+  }
 
   void add_free_chunk(void* begin, void* end)
   {
@@ -237,153 +557,949 @@ private:
   memory_chunk m_allocation;
   free_type m_free_space;
   used_type m_used_space;
-};
 
-} /* end namespace detail */
+  bool m_use_size_classes;
+  std::vector<size_class_slab> m_slabs;
+  std::vector<size_t> m_unused_slab_slots;
+  std::vector<size_t> m_slab_lookup;
+  std::uintptr_t m_slab_lookup_base;
+  size_t m_partial_slabs[num_size_classes];
+  size_t m_num_slab_blocks_used;
+  size_t m_bytes_in_use;
+  size_t m_num_allocations;
+};
 
 
-/*! \class MemPool
+/*! \class ThreadCache
  ******************************************************************************
  *
- * \brief  MemPool pre-allocates a large chunk of memory and provides generic
- * malloc/free for the user to allocate aligned data within the pool
- *
- * MemPool uses MemoryArena to do the heavy lifting of maintaining access to
- * the used/free space.
- *
- * MemPool provides an example generic_allocator which can guide more
- *specialized
- * allocators. The following are some examples
- *
- * using device_mempool_type = basic_mempool::MemPool<cuda::DeviceAllocator>;
- * using device_zeroed_mempool_type =
- *basic_mempool::MemPool<cuda::DeviceZeroedAllocator>;
- * using pinned_mempool_type = basic_mempool::MemPool<cuda::PinnedAllocator>;
- *
- * The user provides the specialized allocator, for example :
- * struct DeviceAllocator {
- *
- *  // returns a valid pointer on success, nullptr on failure
- *  void* malloc(size_t nbytes)
- *  {
- *    void* ptr;
- *    cudaErrchk(cudaMalloc(&ptr, nbytes));
- *    return ptr;
- *  }
+ * \brief  ThreadCache holds blocks for a single thread in front of a MemPool
  *
- *  // returns true on success, false on failure
- *  bool free(void* ptr)
- *  {
- *    cudaErrchk(cudaFree(ptr));
- *    return true;
- *  }
- * };
+ * Each size class has a magazine of blocks that can be handed out without
+ * taking the pool lock. Frees are collected in a pending buffer and moved
+ * into the magazines, or returned to the arenas, in batches by the pool.
  *
+ * The cache lock is only contended when the pool drains the cache.
  *
  ******************************************************************************
  */
-template <typename allocator_t>
-class MemPool
+struct ThreadCache
 {
-public:
-  using allocator_type = allocator_t;
+  static const size_t magazine_size = 32;
+  static const size_t refill_size = magazine_size / 2;
+  static const size_t pending_size = 32;
 
-  static inline MemPool<allocator_t>& getInstance()
+  ThreadCache() : m_num_pending(0), m_orphaned(false)
   {
-    static MemPool<allocator_t> pool{};
-    return pool;
+    for (size_t c = 0; c < MemoryArena::num_size_classes; ++c) {
+      m_num_blocks[c] = 0;
+    }
   }
 
-  static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
-
-  MemPool()
-      : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc()
+  bool get(size_t class_id, void*& ptr)
   {
+    if (m_num_blocks[class_id] > 0) {
+      ptr = m_blocks[class_id][--m_num_blocks[class_id]];
+      return true;
+    }
+    return false;
   }
 
-  ~MemPool()
+  bool put(size_t class_id, void* ptr)
   {
-    // With static objects like MemPool, cudaErrorCudartUnloading is a possible
-    // error with cudaFree
-    // So no more cuda calls here
+    if (m_num_blocks[class_id] < magazine_size) {
+      m_blocks[class_id][m_num_blocks[class_id]++] = ptr;
+      return true;
+    }
+    return false;
   }
 
-
-  void free_chunks()
+  bool defer(void* ptr)
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
-
-    while (!m_arenas.empty()) {
-      void* allocation_ptr = m_arenas.front().get_allocation();
-      m_alloc.free(allocation_ptr);
-      m_arenas.pop_front();
+    if (m_num_pending < pending_size) {
+      m_pending[m_num_pending++] = ptr;
+      return true;
     }
+    return false;
   }
 
-  size_t arena_size()
-  {
 #if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
+  omp::mutex m_mutex;
 #endif
 
-    return m_default_arena_size;
-  }
+  void* m_blocks[MemoryArena::num_size_classes][magazine_size];
+  size_t m_num_blocks[MemoryArena::num_size_classes];
+  void* m_pending[pending_size];
+  size_t m_num_pending;
+  // set when the owning thread exits or the pool is destroyed
+  bool m_orphaned;
+};
 
-  size_t arena_size(size_t new_size)
-  {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
 
-    size_t prev_size = m_default_arena_size;
-    m_default_arena_size = new_size;
-    return prev_size;
-  }
+template <typename... Ts>
+struct make_void {
+  using type = void;
+};
 
-  template <typename T>
-  T* malloc(size_t nTs, size_t alignment = alignof(T))
+/*! \class StreamOrderedFrees
+ ******************************************************************************
+ *
+ * \brief  StreamOrderedFrees holds blocks freed by work on a stream until the
+ * work enqueued on that stream before the free completes
+ *
+ * This is a no-op for allocators that do not support stream ordered
+ * deallocation, see the specialization below.
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t, typename = void>
+class StreamOrderedFrees
+{
+public:
+  template <typename free_func>
+  bool reclaim(allocator_t&, free_func&&)
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
-
-    const size_t size = nTs * sizeof(T);
-    void* ptr = nullptr;
-    arena_container_type::iterator end = m_arenas.end();
-    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
-         ++iter) {
-      ptr = iter->get(size, alignment);
-      if (ptr != nullptr) {
-        break;
-      }
-    }
-
-    if (ptr == nullptr) {
-      const size_t alloc_size =
-          std::max(size + alignment, m_default_arena_size);
-      void* arena_ptr = m_alloc.malloc(alloc_size);
-      if (arena_ptr != nullptr) {
-        m_arenas.emplace_front(arena_ptr, alloc_size);
-        ptr = m_arenas.front().get(size, alignment);
-      }
-    }
-
-    return static_cast<T*>(ptr);
+    return false;
   }
 
-  void free(const void* cptr)
+  template <typename free_func>
+  void synchronize(allocator_t&, free_func&&)
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+  }
+
+  size_t bytes() const { return 0; }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  StreamOrderedFrees for allocators that provide streams and events
+ *
+ * The allocator provides the following to support stream ordered frees
+ *
+ *  using stream_type = ...;
+ *  using event_type = ...;
+ *  event_type create_event();
+ *  void destroy_event(event_type);
+ *  void record_event(event_type, stream_type);
+ *  bool event_complete(event_type);
+ *  void synchronize_event(event_type);
+ *
+ * Blocks may be reused by work on the stream they were freed on right away,
+ * they are only returned to the arenas for use by other streams once the
+ * event recorded when they were freed completes.
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t>
+class StreamOrderedFrees<allocator_t,
+                         typename make_void<
+                             typename allocator_t::stream_type,
+                             typename allocator_t::event_type>::type>
+{
+public:
+  using stream_type = typename allocator_t::stream_type;
+  using event_type = typename allocator_t::event_type;
+
+  void defer(allocator_t& alloc,
+             void* ptr,
+             size_t nbytes,
+             stream_type stream)
+  {
+    event_type event;
+    if (!m_unused_events.empty()) {
+      event = m_unused_events.back();
+      m_unused_events.pop_back();
+    } else {
+      event = alloc.create_event();
+    }
+    alloc.record_event(event, stream);
+    get_stream_frees(stream).push_back(pending_free{ptr, nbytes, event});
+  }
+
+  //! reuse a block freed on stream that fits nbytes with alignment
+  bool reuse(size_t nbytes, size_t alignment, stream_type stream, void*& ptr)
+  {
+    for (stream_frees& sf : m_streams) {
+      if (sf.stream == stream) {
+        for (auto iter = sf.frees.rbegin(); iter != sf.frees.rend(); ++iter) {
+          // avoid wasting more than half of a reused block
+          if (nbytes <= iter->nbytes && iter->nbytes / 2 <= nbytes &&
+              reinterpret_cast<std::uintptr_t>(iter->ptr) % alignment == 0) {
+            ptr = iter->ptr;
+            m_unused_events.push_back(iter->event);
+            sf.frees.erase(std::next(iter).base());
+            return true;
+          }
+        }
+        break;
+      }
+    }
+    return false;
+  }
+
+  //! give blocks whose events completed to free_fn
+  template <typename free_func>
+  bool reclaim(allocator_t& alloc, free_func&& free_fn)
+  {
+    bool reclaimed = false;
+    for (stream_frees& sf : m_streams) {
+      // events on a stream complete in order
+      while (!sf.frees.empty() && alloc.event_complete(sf.frees.front().event)) {
+        free_fn(sf.frees.front().ptr);
+        m_unused_events.push_back(sf.frees.front().event);
+        sf.frees.pop_front();
+        reclaimed = true;
+      }
+    }
+    return reclaimed;
+  }
+
+  //! wait for all events then give all blocks to free_fn
+  template <typename free_func>
+  void synchronize(allocator_t& alloc, free_func&& free_fn)
+  {
+    for (stream_frees& sf : m_streams) {
+      while (!sf.frees.empty()) {
+        alloc.synchronize_event(sf.frees.front().event);
+        free_fn(sf.frees.front().ptr);
+        m_unused_events.push_back(sf.frees.front().event);
+        sf.frees.pop_front();
+      }
+    }
+    m_streams.clear();
+    while (!m_unused_events.empty()) {
+      alloc.destroy_event(m_unused_events.back());
+      m_unused_events.pop_back();
+    }
+  }
+
+  //! bytes in blocks waiting for their events
+  size_t bytes() const
+  {
+    size_t nbytes = 0;
+    for (const stream_frees& sf : m_streams) {
+      for (const pending_free& pf : sf.frees) {
+        nbytes += pf.nbytes;
+      }
+    }
+    return nbytes;
+  }
+
+private:
+  struct pending_free {
+    void* ptr;
+    size_t nbytes;
+    event_type event;
+  };
+
+  struct stream_frees {
+    stream_type stream;
+    std::deque<pending_free> frees;
+  };
+
+  std::deque<pending_free>& get_stream_frees(stream_type stream)
+  {
+    for (stream_frees& sf : m_streams) {
+      if (sf.stream == stream) {
+        return sf.frees;
+      }
+    }
+    m_streams.push_back(stream_frees{stream, std::deque<pending_free>{}});
+    return m_streams.back().frees;
+  }
+
+  std::vector<stream_frees> m_streams;
+  std::vector<event_type> m_unused_events;
+};
+
+} /* end namespace detail */
+
+
+/*! \class MemPoolStats
+ ******************************************************************************
+ *
+ * \brief  MemPoolStats holds a snapshot of the usage of a MemPool, see
+ * MemPool::get_stats
+ *
+ ******************************************************************************
+ */
+struct MemPoolStats {
+  //! free_block_histogram bin i counts free blocks of [2^i, 2^(i+1)) bytes
+  static const size_t num_histogram_bins = sizeof(size_t) * CHAR_BIT;
+
+  //! number of arenas and bytes allocated from the allocator for them
+  size_t num_arenas = 0;
+  size_t bytes_reserved = 0;
+  //! bytes and number of blocks handed out by the arenas, this includes
+  //  blocks held by thread caches and pending stream ordered frees
+  size_t bytes_in_use = 0;
+  size_t num_allocations = 0;
+  //! highest bytes_in_use since creation or reset_peak_bytes_in_use
+  size_t peak_bytes_in_use = 0;
+  //! bytes in blocks held by thread caches and pending stream ordered frees
+  size_t bytes_cached = 0;
+  //! bytes in free blocks and the size of the largest free block
+  size_t bytes_free = 0;
+  size_t largest_free_block = 0;
+  size_t free_block_histogram[num_histogram_bins] = {};
+
+  //! fraction of the free bytes not in the largest free block
+  double fragmentation() const
+  {
+    return (bytes_free == 0) ? 0.0
+                             : 1.0 - static_cast<double>(largest_free_block) /
+                                         static_cast<double>(bytes_free);
+  }
+
+  void add_free_blocks(size_t nbytes, size_t count)
+  {
+    if (nbytes == 0 || count == 0) {
+      return;
+    }
+    size_t bin = 0;
+    while ((nbytes >> bin) > 1) {
+      ++bin;
+    }
+    free_block_histogram[bin] += count;
+    bytes_free += nbytes * count;
+    if (nbytes > largest_free_block) {
+      largest_free_block = nbytes;
+    }
+  }
+};
+
+/*! \class MemPool
+ ******************************************************************************
+ *
+ * \brief  MemPool pre-allocates a large chunk of memory and provides generic
+ * malloc/free for the user to allocate aligned data within the pool
+ *
+ * MemPool uses MemoryArena to do the heavy lifting of maintaining access to
+ * the used/free space. Optionally arenas serve small allocations from power
+ * of two size classes, see size_classes(bool).
+ *
+ * Optionally each thread gets a ThreadCache of small blocks in front of the
+ * pool, see thread_caches(bool). With thread caches enabled the pool lock is
+ * only taken when a thread cache misses or fills up. The caches only hold
+ * blocks from size class slabs, so enabling them also enables size classes.
+ *
+ * Allocators that provide streams and events, see detail::StreamOrderedFrees,
+ * also support stream_malloc and stream_free. Memory given to stream_free is
+ * not handed to work on another stream until the work already enqueued on the
+ * freeing stream completes.
+ *
+ * get_stats reports the memory reserved and in use by the pool, and
+ * free_unused_chunks gives arenas with no blocks in use back to the allocator.
+ *
+ * MemPool provides an example generic_allocator which can guide more
+ *specialized
+ * allocators. The following are some examples
+ *
+ * using device_mempool_type = basic_mempool::MemPool<cuda::DeviceAllocator>;
+ * using device_zeroed_mempool_type =
+ *basic_mempool::MemPool<cuda::DeviceZeroedAllocator>;
+ * using pinned_mempool_type = basic_mempool::MemPool<cuda::PinnedAllocator>;
+ *
+ * The user provides the specialized allocator, for example :
+ * struct DeviceAllocator {
+ *
+ *  // returns a valid pointer on success, nullptr on failure
+ *  void* malloc(size_t nbytes)
+ *  {
+ *    void* ptr;
+ *    cudaErrchk(cudaMalloc(&ptr, nbytes));
+ *    return ptr;
+ *  }
+ *
+ *  // returns true on success, false on failure
+ *  bool free(void* ptr)
+ *  {
+ *    cudaErrchk(cudaFree(ptr));
+ *    return true;
+ *  }
+ * };
+ *
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t>
+class MemPool
+{
+public:
+  using allocator_type = allocator_t;
+
+  static inline MemPool<allocator_t>& getInstance()
+  {
+    static MemPool<allocator_t> pool{};
+    return pool;
+  }
+
+  static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
+
+  MemPool()
+      : m_arenas(),
+        m_default_arena_size(default_default_arena_size),
+        m_use_size_classes(false),
+        m_use_thread_caches(false),
+        m_id(next_id()),
+        m_thread_caches(),
+        m_bytes_in_use(0),
+        m_peak_bytes_in_use(0),
+        m_alloc(),
+        m_stream_frees()
+  {
+  }
+
+  ~MemPool()
+  {
+    // With static objects like MemPool, cudaErrorCudartUnloading is a possible
+    // error with cudaFree
+    // So no more cuda calls here
+
+    // threads may still reference their caches, detach them from this pool
+    for (auto& cache : m_thread_caches) {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> cache_lock(cache->m_mutex);
+#endif
+      cache->m_orphaned = true;
+    }
+  }
+
+
+  void free_chunks()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    drain_thread_caches();
+
+    m_stream_frees.synchronize(m_alloc, [&](void* ptr) { free_impl(ptr); });
+
+    while (!m_arenas.empty()) {
+      void* allocation_ptr = m_arenas.front().get_allocation();
+      m_alloc.free(allocation_ptr);
+      m_arenas.pop_front();
+    }
+    m_bytes_in_use = 0;
+  }
+
+  //! give arenas with no blocks in use back to the allocator,
+  //  returns the number of bytes released
+  size_t free_unused_chunks()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    // blocks held by thread caches or completed stream ordered frees would
+    // otherwise keep their arenas alive
+    drain_thread_caches();
+    m_stream_frees.reclaim(m_alloc, [&](void* p) { free_impl(p); });
+
+    size_t released = 0;
+    arena_container_type::iterator iter = m_arenas.begin();
+    while (iter != m_arenas.end()) {
+      if (iter->unused()) {
+        released += iter->capacity();
+        m_alloc.free(iter->get_allocation());
+        iter = m_arenas.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    return released;
+  }
+
+  //! get usage statistics for this pool
+  MemPoolStats get_stats()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    MemPoolStats stats;
+    stats.num_arenas = m_arenas.size();
+    stats.peak_bytes_in_use = m_peak_bytes_in_use;
+
+    for (detail::MemoryArena& arena : m_arenas) {
+      stats.bytes_reserved += arena.capacity();
+      stats.bytes_in_use += arena.bytes_in_use();
+      stats.num_allocations += arena.num_allocations();
+      arena.for_each_free_block([&](size_t nbytes, size_t count) {
+        stats.add_free_blocks(nbytes, count);
+      });
+    }
+
+    stats.bytes_cached = m_stream_frees.bytes();
+    for (auto& cache : m_thread_caches) {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> cache_lock(cache->m_mutex);
+#endif
+      for (size_t c = 0; c < detail::MemoryArena::num_size_classes; ++c) {
+        stats.bytes_cached += cache->m_num_blocks[c] *
+                              detail::MemoryArena::size_class_bytes(c);
+      }
+      for (size_t i = 0; i < cache->m_num_pending; ++i) {
+        for (detail::MemoryArena& arena : m_arenas) {
+          size_t nbytes;
+          if (arena.size_of(cache->m_pending[i], nbytes)) {
+            stats.bytes_cached += nbytes;
+            break;
+          }
+        }
+      }
+    }
+
+    return stats;
+  }
+
+  //! reset peak_bytes_in_use to the current bytes in use
+  void reset_peak_bytes_in_use()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    m_peak_bytes_in_use = m_bytes_in_use;
+  }
+
+  size_t arena_size()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    return m_default_arena_size;
+  }
+
+  size_t arena_size(size_t new_size)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    size_t prev_size = m_default_arena_size;
+    m_default_arena_size = new_size;
+    return prev_size;
+  }
+
+  bool size_classes()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    return m_use_size_classes;
+  }
+
+  //! enable or disable size classes for arenas allocated after this call,
+  //  off by default so existing pools keep their exact chunk accounting
+  bool size_classes(bool enable)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    bool prev_enable = m_use_size_classes;
+    m_use_size_classes = enable;
+    return prev_enable;
+  }
+
+  bool thread_caches()
+  {
+    return m_use_thread_caches.load(std::memory_order_relaxed);
+  }
+
+  //! enable or disable per thread caches, disabling drains all caches,
+  //  enabling also enables size classes as the caches only hold blocks
+  //  from size class slabs
+  bool thread_caches(bool enable)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    bool prev_enable = m_use_thread_caches.exchange(enable);
+    if (enable) {
+      m_use_size_classes = true;
+    } else {
+      drain_thread_caches();
+    }
+    return prev_enable;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    const size_t size = nTs * sizeof(T);
+
+    if (m_use_thread_caches.load(std::memory_order_relaxed)) {
+      size_t class_id;
+      if (detail::MemoryArena::get_size_class(size, alignment, class_id)) {
+        return static_cast<T*>(cached_malloc(class_id));
+      }
+      return static_cast<T*>(uncached_malloc(size, alignment));
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    return static_cast<T*>(malloc_impl(size, alignment));
+  }
+
+  void free(const void* cptr)
+  {
+    void* ptr = const_cast<void*>(cptr);
+
+    if (m_use_thread_caches.load(std::memory_order_relaxed)) {
+      cached_free(ptr);
+      return;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    free_impl(ptr);
+  }
+
+  //! allocate memory for use by work on stream,
+  //  may reuse memory freed on stream whose work has not completed
+  template <typename T, typename A = allocator_t>
+  T* stream_malloc(size_t nTs,
+                   typename A::stream_type stream,
+                   size_t alignment = alignof(T))
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    m_stream_frees.reclaim(m_alloc, [&](void* p) { free_impl(p); });
+
+    const size_t size = nTs * sizeof(T);
+    void* ptr = nullptr;
+    if (!m_stream_frees.reuse(size, alignment, stream, ptr)) {
+      ptr = malloc_impl(size, alignment);
+    }
+    return static_cast<T*>(ptr);
+  }
+
+  //! free memory used by work on stream, the memory is not given to work on
+  //  other streams until the work enqueued on stream before this completes
+  template <typename A = allocator_t>
+  void stream_free(const void* cptr, typename A::stream_type stream)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    m_stream_frees.reclaim(m_alloc, [&](void* p) { free_impl(p); });
 
     void* ptr = const_cast<void*>(cptr);
+    size_t nbytes = 0;
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
+      if (iter->size_of(ptr, nbytes)) {
+        m_stream_frees.defer(m_alloc, ptr, nbytes, stream);
+        return;
+      }
+    }
+    fprintf(stderr, "Unknown pointer %p", ptr);
+  }
+
+private:
+  using arena_container_type = std::list<detail::MemoryArena>;
+  using thread_cache_ptr = std::shared_ptr<detail::ThreadCache>;
+
+  //! thread local list of the caches a thread uses, one per pool
+  struct thread_cache_registry {
+    std::vector<std::pair<size_t, thread_cache_ptr>> m_caches;
+
+    ~thread_cache_registry()
+    {
+      for (auto& entry : m_caches) {
+#if defined(RAJA_ENABLE_OPENMP)
+        lock_guard<omp::mutex> cache_lock(entry.second->m_mutex);
+#endif
+        entry.second->m_orphaned = true;
+      }
+    }
+  };
+
+  static size_t next_id()
+  {
+    static std::atomic<size_t> s_next_id{0};
+    return s_next_id++;
+  }
+
+  //! get this thread's cache for this pool, creating it on first use
+  detail::ThreadCache* get_thread_cache()
+  {
+    static thread_local thread_cache_registry registry;
+
+    for (auto& entry : registry.m_caches) {
+      if (entry.first == m_id) {
+        return entry.second.get();
+      }
+    }
+
+    thread_cache_ptr cache = std::make_shared<detail::ThreadCache>();
+    registry.m_caches.emplace_back(m_id, cache);
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    // reclaim the blocks held by caches of threads that have exited
+    remove_orphaned_thread_caches();
+    m_thread_caches.push_back(cache);
+
+    return cache.get();
+  }
+
+  void* cached_malloc(size_t class_id)
+  {
+    detail::ThreadCache* cache = get_thread_cache();
+    void* ptr = nullptr;
+
+    {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> cache_lock(cache->m_mutex);
+#endif
+      if (cache->get(class_id, ptr)) {
+        return ptr;
+      }
+    }
+
+    // miss, take the pool lock before the cache lock to match other paths
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+    lock_guard<omp::mutex> cache_lock(cache->m_mutex);
+#endif
+
+    const size_t nbytes = detail::MemoryArena::size_class_bytes(class_id);
+
+    // caches disabled since the caller checked, do not refill a cache that
+    // has already been drained
+    if (!m_use_thread_caches.load(std::memory_order_acquire)) {
+      drain_thread_cache(*cache);
+      return malloc_impl(nbytes, nbytes);
+    }
+
+    flush_pending(*cache);
+
+    if (!cache->get(class_id, ptr)) {
+      ptr = malloc_impl(nbytes, nbytes);
+      // only fill the magazine with slab blocks, a block from an arena
+      // without size classes would go back to the arena when freed
+      size_t ptr_class_id;
+      if (ptr != nullptr && size_class_of(ptr, ptr_class_id)) {
+        for (size_t i = 1; i < detail::ThreadCache::refill_size; ++i) {
+          void* extra = malloc_impl(nbytes, nbytes);
+          if (extra == nullptr) {
+            break;
+          }
+          cache->put(class_id, extra);
+        }
+      }
+    }
+
+    return ptr;
+  }
+
+  void* uncached_malloc(size_t size, size_t alignment)
+  {
+    detail::ThreadCache* cache = get_thread_cache();
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+    lock_guard<omp::mutex> cache_lock(cache->m_mutex);
+#endif
+
+    // large blocks freed by this thread may be waiting in the pending buffer
+    if (m_use_thread_caches.load(std::memory_order_acquire)) {
+      flush_pending(*cache);
+    } else {
+      drain_thread_cache(*cache);
+    }
+
+    return malloc_impl(size, alignment);
+  }
+
+  void cached_free(void* ptr)
+  {
+    detail::ThreadCache* cache = get_thread_cache();
+
+    {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> cache_lock(cache->m_mutex);
+#endif
+      // re-check under the cache lock, thread_caches(false) sets the flag
+      // before it takes each cache lock to drain, so a block deferred here
+      // is either seen by the drain or not deferred at all
+      if (m_use_thread_caches.load(std::memory_order_acquire) &&
+          cache->defer(ptr)) {
+        return;
+      }
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+    lock_guard<omp::mutex> cache_lock(cache->m_mutex);
+#endif
+
+    if (m_use_thread_caches.load(std::memory_order_acquire)) {
+      flush_pending(*cache);
+      cache->defer(ptr);
+    } else {
+      // caches were disabled, return the block and anything still parked
+      drain_thread_cache(*cache);
+      free_impl(ptr);
+    }
+  }
+
+  //! move pending frees into the magazines or back to the arenas,
+  //  requires the pool lock and the cache lock
+  void flush_pending(detail::ThreadCache& cache)
+  {
+    for (size_t i = 0; i < cache.m_num_pending; ++i) {
+      void* ptr = cache.m_pending[i];
+      size_t class_id;
+      if (!size_class_of(ptr, class_id) || !cache.put(class_id, ptr)) {
+        free_impl(ptr);
+      }
+    }
+    cache.m_num_pending = 0;
+  }
+
+  //! get the size class of a block from a slab of any arena,
+  //  requires the pool lock
+  bool size_class_of(void* ptr, size_t& class_id)
+  {
+    arena_container_type::iterator end = m_arenas.end();
+    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
+         ++iter) {
+      if (iter->size_class_of(ptr, class_id)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! return all blocks held by a cache to the arenas,
+  //  requires the pool lock and the cache lock
+  void drain_thread_cache(detail::ThreadCache& cache)
+  {
+    for (size_t i = 0; i < cache.m_num_pending; ++i) {
+      free_impl(cache.m_pending[i]);
+    }
+    cache.m_num_pending = 0;
+    for (size_t c = 0; c < detail::MemoryArena::num_size_classes; ++c) {
+      void* ptr;
+      while (cache.get(c, ptr)) {
+        free_impl(ptr);
+      }
+    }
+  }
+
+  //! requires the pool lock
+  void drain_thread_caches()
+  {
+    for (auto& cache : m_thread_caches) {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> cache_lock(cache->m_mutex);
+#endif
+      drain_thread_cache(*cache);
+    }
+  }
+
+  //! requires the pool lock
+  void remove_orphaned_thread_caches()
+  {
+    auto iter = m_thread_caches.begin();
+    while (iter != m_thread_caches.end()) {
+      bool orphaned;
+      {
+#if defined(RAJA_ENABLE_OPENMP)
+        lock_guard<omp::mutex> cache_lock((*iter)->m_mutex);
+#endif
+        orphaned = (*iter)->m_orphaned;
+        if (orphaned) {
+          drain_thread_cache(**iter);
+        }
+      }
+      if (orphaned) {
+        iter = m_thread_caches.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+
+  //! requires the pool lock
+  void* malloc_impl(size_t size, size_t alignment)
+  {
+    void* ptr = get_from_arenas(size, alignment);
+
+    // try again with memory from completed stream ordered frees
+    if (ptr == nullptr &&
+        m_stream_frees.reclaim(m_alloc, [&](void* p) { free_impl(p); })) {
+      ptr = get_from_arenas(size, alignment);
+    }
+
+    if (ptr == nullptr) {
+      const size_t alloc_size =
+          std::max(size + alignment, m_default_arena_size);
+      void* arena_ptr = m_alloc.malloc(alloc_size);
+      if (arena_ptr != nullptr) {
+        m_arenas.emplace_front(arena_ptr, alloc_size, m_use_size_classes);
+        ptr = m_arenas.front().get(size, alignment);
+        add_bytes_in_use(m_arenas.front().bytes_in_use());
+      }
+    }
+
+    return ptr;
+  }
+
+  //! requires the pool lock
+  void* get_from_arenas(size_t size, size_t alignment)
+  {
+    void* ptr = nullptr;
+    arena_container_type::iterator end = m_arenas.end();
+    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
+         ++iter) {
+      const size_t prev_bytes = iter->bytes_in_use();
+      ptr = iter->get(size, alignment);
+      if (ptr != nullptr) {
+        add_bytes_in_use(iter->bytes_in_use() - prev_bytes);
+        break;
+      }
+    }
+    return ptr;
+  }
+
+  //! requires the pool lock
+  void add_bytes_in_use(size_t nbytes)
+  {
+    m_bytes_in_use += nbytes;
+    if (m_bytes_in_use > m_peak_bytes_in_use) {
+      m_peak_bytes_in_use = m_bytes_in_use;
+    }
+  }
+
+  //! requires the pool lock
+  void free_impl(void* ptr)
+  {
+    arena_container_type::iterator end = m_arenas.end();
+    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
+         ++iter) {
+      const size_t prev_bytes = iter->bytes_in_use();
       if (iter->give(ptr)) {
+        m_bytes_in_use -= prev_bytes - iter->bytes_in_use();
         ptr = nullptr;
         break;
       }
@@ -393,16 +1509,20 @@ public:
     }
   }
 
-private:
-  using arena_container_type = std::list<detail::MemoryArena>;
-
 #if defined(RAJA_ENABLE_OPENMP)
   omp::mutex m_mutex;
 #endif
 
   arena_container_type m_arenas;
   size_t m_default_arena_size;
+  bool m_use_size_classes;
+  std::atomic<bool> m_use_thread_caches;
+  const size_t m_id;
+  std::vector<thread_cache_ptr> m_thread_caches;
+  size_t m_bytes_in_use;
+  size_t m_peak_bytes_in_use;
   allocator_t m_alloc;
+  detail::StreamOrderedFrees<allocator_t> m_stream_frees;
 };
 
 //! example allocator for basic_mempool using malloc/free
@@ -419,6 +1539,147 @@ struct generic_allocator {
   }
 };
 
+/*! \class huge_page_allocator
+ ******************************************************************************
+ *
+ * \brief  example allocator for basic_mempool that backs arenas with huge
+ * pages to reduce TLB misses on large host temporaries
+ *
+ * Allocations first try explicit huge pages of huge_page_bytes() (2MiB by
+ * default, 1GiB if set and configured on the system), then regular pages
+ * aligned to huge_page_bytes() and advised for transparent huge pages, then
+ * fall back to malloc where neither is available.
+ *
+ ******************************************************************************
+ */
+struct huge_page_allocator {
+
+  //! kind of memory an allocation is backed by
+  enum struct backing { explicit_huge_pages, transparent_huge_pages, malloc };
+
+  //! get the huge page size used for new allocations
+  static size_t huge_page_bytes() { return s_huge_page_bytes(); }
+
+  //! set the huge page size used for new allocations, returns the old size
+  static size_t huge_page_bytes(size_t bytes)
+  {
+    return s_huge_page_bytes().exchange(bytes);
+  }
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    void* ptr = nullptr;
+    size_t len = nbytes;
+    backing kind = backing::malloc;
+#if defined(RAJA_BASIC_MEMPOOL_HAVE_MMAP)
+    const size_t page = huge_page_bytes();
+    len = (nbytes + page - 1) / page * page;
+#if defined(MAP_HUGETLB)
+    {
+      int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+      int log2_page = 0;
+      while ((size_t(1) << log2_page) < page) ++log2_page;
+      flags |= (log2_page << MAP_HUGE_SHIFT);
+#endif
+      void* mem = mmap(nullptr, len, PROT_READ | PROT_WRITE, flags, -1, 0);
+      if (mem != MAP_FAILED) {
+        ptr = mem;
+        kind = backing::explicit_huge_pages;
+      }
+    }
+#endif
+#if defined(MADV_HUGEPAGE)
+    if (!ptr) {
+      // over map so the range can be trimmed to a huge page boundary
+      const size_t map_len = len + page;
+      void* mem = mmap(nullptr,
+                       map_len,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS,
+                       -1,
+                       0);
+      if (mem != MAP_FAILED) {
+        char* raw = static_cast<char*>(mem);
+        char* begin = raw + (page - reinterpret_cast<uintptr_t>(raw) % page) %
+                                page;
+        char* end = begin + len;
+        if (begin != raw) munmap(raw, begin - raw);
+        if (end != raw + map_len) munmap(end, raw + map_len - end);
+        madvise(begin, len, MADV_HUGEPAGE);
+        ptr = begin;
+        kind = backing::transparent_huge_pages;
+      }
+    }
+#endif
+#endif
+    if (!ptr) {
+      ptr = std::malloc(nbytes);
+      len = nbytes;
+      kind = backing::malloc;
+    }
+    if (ptr) {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(m_mutex);
+#endif
+      m_allocations.emplace(ptr, allocation{len, kind});
+    }
+    return ptr;
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    allocation info;
+    {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(m_mutex);
+#endif
+      auto iter = m_allocations.find(ptr);
+      if (iter == m_allocations.end()) return false;
+      info = iter->second;
+      m_allocations.erase(iter);
+    }
+    if (info.kind == backing::malloc) {
+      std::free(ptr);
+      return true;
+    }
+#if defined(RAJA_BASIC_MEMPOOL_HAVE_MMAP)
+    return munmap(ptr, info.nbytes) == 0;
+#else
+    return false;
+#endif
+  }
+
+  //! get the kind of memory backing an allocation made by this allocator
+  backing backing_of(const void* ptr) const
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    auto iter = m_allocations.find(const_cast<void*>(ptr));
+    return iter != m_allocations.end() ? iter->second.kind : backing::malloc;
+  }
+
+private:
+  struct allocation {
+    size_t nbytes;
+    backing kind;
+  };
+
+  static std::atomic<size_t>& s_huge_page_bytes()
+  {
+    static std::atomic<size_t> bytes{size_t(2) * 1024 * 1024};
+    return bytes;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  mutable omp::mutex m_mutex;
+#endif
+  std::map<void*, allocation> m_allocations;
+};
+
 } /* end namespace basic_mempool */
 
 } /* end namespace RAJA */
@@ -0,0 +1,253 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for C++20 coroutine awaitables that suspend until the
+ *          work of a pattern or a reducer on a resource is done.
+ *
+ *          The awaitables are only defined when the compiler supports
+ *          coroutines, in which case RAJA_HAS_COROUTINES is defined.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_coroutine_HPP
+#define RAJA_util_coroutine_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define RAJA_HAS_COROUTINES
+#endif
+#endif
+
+#if defined(RAJA_HAS_COROUTINES)
+
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * @brief Resumes coroutines suspended on events once the events complete.
+ *
+ * Nothing is resumed on its own: the host threads of the task runtime call
+ * poll() between tasks, and each call resumes, on the calling thread, the
+ * coroutines whose events have completed since. The events are checked
+ * without blocking, so a few host threads can interleave many pipelines
+ * that wait on devices. Coroutines may be suspended and polled from any
+ * thread.
+ */
+class EventPoller
+{
+public:
+  EventPoller() = default;
+
+  EventPoller(EventPoller const&) = delete;
+  EventPoller& operator=(EventPoller const&) = delete;
+
+  //! resume handle from poll() once event completes
+  void add(resources::Event event, std::coroutine_handle<> handle)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_waiting.push_back(waiter{std::move(event), handle});
+  }
+
+  //! resume the coroutines whose events are complete, returns how many
+  size_t poll()
+  {
+    std::vector<std::coroutine_handle<>> ready;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      size_t kept = 0;
+      for (size_t w = 0; w < m_waiting.size(); ++w) {
+        if (m_waiting[w].event.check()) {
+          ready.push_back(m_waiting[w].handle);
+        } else {
+          if (kept != w) {
+            m_waiting[kept] = std::move(m_waiting[w]);
+          }
+          ++kept;
+        }
+      }
+      m_waiting.erase(m_waiting.begin() + kept, m_waiting.end());
+    }
+    // resumed without the lock, as they may suspend again on this poller
+    for (auto handle : ready) {
+      handle.resume();
+    }
+    return ready.size();
+  }
+
+  //! number of coroutines that are suspended
+  size_t pending() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_waiting.size();
+  }
+
+  //! poll until no coroutine is suspended
+  void drain()
+  {
+    while (pending() > 0) {
+      if (poll() == 0) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  //! the poller the awaitables use when none is given
+  static EventPoller& get_default()
+  {
+    static EventPoller poller;
+    return poller;
+  }
+
+private:
+  struct waiter {
+    resources::Event event;
+    std::coroutine_handle<> handle;
+  };
+
+  mutable std::mutex m_mutex;
+  std::vector<waiter> m_waiting;
+};
+
+/*!
+ * Awaitable for an event, which does not suspend if the event is already
+ * complete
+ */
+class EventAwaitable
+{
+public:
+  EventAwaitable(resources::Event event, EventPoller& poller)
+      : m_event(std::move(event)), m_poller(&poller)
+  { }
+
+  bool await_ready() const { return m_event.check(); }
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    m_poller->add(m_event, handle);
+  }
+
+  void await_resume() const {}
+
+private:
+  resources::Event m_event;
+  EventPoller* m_poller;
+};
+
+/*!
+ * @brief Suspends the calling coroutine until event completes.
+ *
+ * The event may be an Event or the EventProxy returned by forall, kernel,
+ * launch, sort, scan and the other patterns that take a resource:
+ *
+ *     co_await RAJA::expt::when_done(
+ *         RAJA::forall<RAJA::cuda_exec_async<256>>(res, range, body));
+ *
+ * The coroutine is resumed by a call to poll() on poller.
+ */
+template <typename E>
+EventAwaitable when_done(E event,
+                         EventPoller& poller = EventPoller::get_default())
+{
+  resources::Event e = std::move(event);
+  return EventAwaitable(std::move(e), poller);
+}
+
+namespace detail
+{
+
+template <typename Reducer, typename = void>
+struct reducer_has_event : std::false_type {
+};
+
+template <typename Reducer>
+struct reducer_has_event<
+    Reducer,
+    decltype(void(std::declval<Reducer&>().get_event()))> : std::true_type {
+};
+
+}  // namespace detail
+
+/*!
+ * Awaitable for the value of a reducer. Reducers without events, such as
+ * the host reducers, have their value when the pattern returns.
+ */
+template <typename Reducer>
+class ReducerAwaitable
+{
+public:
+  ReducerAwaitable(Reducer& reducer, EventPoller& poller)
+      : m_reducer(&reducer), m_poller(&poller)
+  { }
+
+  bool await_ready() { return ready(detail::reducer_has_event<Reducer>{}); }
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    m_poller->add(*m_event, handle);
+  }
+
+  auto await_resume() { return m_reducer->get(); }
+
+private:
+  Reducer* m_reducer;
+  EventPoller* m_poller;
+  std::optional<resources::Event> m_event;
+
+  bool ready(std::true_type)
+  {
+    m_event.emplace(m_reducer->get_event());
+    return m_event->check();
+  }
+
+  bool ready(std::false_type) { return true; }
+};
+
+/*!
+ * @brief Suspends the calling coroutine until the value of reducer is
+ *        available, and gives the value:
+ *
+ *     RAJA::ReduceSum<RAJA::cuda_reduce, double> sum(0.0);
+ *     RAJA::forall<RAJA::cuda_exec_async<256>>(res, range, body);
+ *     double s = co_await RAJA::expt::when_ready(sum);
+ *
+ * The reducer must outlive the suspension.
+ */
+template <typename Reducer>
+ReducerAwaitable<Reducer> when_ready(
+    Reducer& reducer,
+    EventPoller& poller = EventPoller::get_default())
+{
+  return ReducerAwaitable<Reducer>(reducer, poller);
+}
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif  // RAJA_HAS_COROUTINES
+
+#endif
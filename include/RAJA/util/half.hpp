@@ -0,0 +1,189 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining 16-bit half and bfloat16 storage types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_half_HPP
+#define RAJA_util_half_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/TypeConvert.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! IEEE binary16 bits of f, rounded to nearest even
+RAJA_HOST_DEVICE RAJA_INLINE std::uint16_t float_to_half_bits(float f)
+{
+  std::uint32_t x = RAJA::util::reinterp_A_as_B<float, std::uint32_t>(f);
+  const std::uint32_t sign = (x >> 16) & 0x8000u;
+  x &= 0x7fffffffu;
+
+  // inf and nan, keeping nans quiet
+  if (x >= 0x7f800000u) {
+    return static_cast<std::uint16_t>(sign | 0x7c00u |
+                                      (x > 0x7f800000u ? 0x0200u : 0u));
+  }
+  // too large, rounds to inf
+  if (x >= 0x47800000u) {
+    return static_cast<std::uint16_t>(sign | 0x7c00u);
+  }
+  // below the smallest normal half
+  if (x < 0x38800000u) {
+    // at most half the smallest subnormal, rounds to zero
+    if (x <= 0x33000000u) {
+      return static_cast<std::uint16_t>(sign);
+    }
+    const std::uint32_t m = (x & 0x007fffffu) | 0x00800000u;
+    const int shift = 126 - static_cast<int>(x >> 23);
+    std::uint32_t r = m >> shift;
+    const std::uint32_t rem = m & ((1u << shift) - 1u);
+    const std::uint32_t halfway = 1u << (shift - 1);
+    if (rem > halfway || (rem == halfway && (r & 1u))) {
+      ++r;
+    }
+    return static_cast<std::uint16_t>(sign | r);
+  }
+  // normal, a carry out of the mantissa moves into the exponent
+  x += 0x0fffu + ((x >> 13) & 1u);
+  x -= 112u << 23;
+  return static_cast<std::uint16_t>(sign | (x >> 13));
+}
+
+//! float value of IEEE binary16 bits h
+RAJA_HOST_DEVICE RAJA_INLINE float half_bits_to_float(std::uint16_t h)
+{
+  const std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+  std::uint32_t e = (h >> 10) & 0x1fu;
+  std::uint32_t m = h & 0x03ffu;
+  std::uint32_t x;
+  if (e == 0x1fu) {
+    x = sign | 0x7f800000u | (m << 13);
+  } else if (e == 0u) {
+    if (m == 0u) {
+      x = sign;
+    } else {
+      // subnormal half, normal float
+      e = 113u;
+      while ((m & 0x0400u) == 0u) {
+        m <<= 1;
+        --e;
+      }
+      x = sign | (e << 23) | ((m & 0x03ffu) << 13);
+    }
+  } else {
+    x = sign | ((e + 112u) << 23) | (m << 13);
+  }
+  return RAJA::util::reinterp_A_as_B<std::uint32_t, float>(x);
+}
+
+//! bfloat16 bits of f, rounded to nearest even
+RAJA_HOST_DEVICE RAJA_INLINE std::uint16_t float_to_bfloat16_bits(float f)
+{
+  const std::uint32_t x = RAJA::util::reinterp_A_as_B<float, std::uint32_t>(f);
+  if ((x & 0x7fffffffu) > 0x7f800000u) {
+    return static_cast<std::uint16_t>((x >> 16) | 0x0040u);
+  }
+  return static_cast<std::uint16_t>((x + 0x7fffu + ((x >> 16) & 1u)) >> 16);
+}
+
+//! float value of bfloat16 bits h
+RAJA_HOST_DEVICE RAJA_INLINE float bfloat16_bits_to_float(std::uint16_t h)
+{
+  return RAJA::util::reinterp_A_as_B<std::uint32_t, float>(
+      static_cast<std::uint32_t>(h) << 16);
+}
+
+}  // namespace detail
+
+namespace expt
+{
+
+/*!
+ * @brief IEEE binary16 storage type.
+ *
+ * Values convert to and from float, rounding to nearest even, and all
+ * arithmetic is done in float. The tensor registers for half keep their
+ * values in float registers and only round when they are stored.
+ */
+struct half_t
+{
+  std::uint16_t bits;
+
+  half_t() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE half_t(float f)
+      : bits(RAJA::detail::float_to_half_bits(f))
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator float() const
+  {
+    return RAJA::detail::half_bits_to_float(bits);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE static half_t from_bits(std::uint16_t b)
+  {
+    half_t h;
+    h.bits = b;
+    return h;
+  }
+};
+
+/*!
+ * @brief bfloat16 storage type, the upper half of a float.
+ *
+ * Values convert to and from float, rounding to nearest even, and all
+ * arithmetic is done in float.
+ */
+struct bfloat16_t
+{
+  std::uint16_t bits;
+
+  bfloat16_t() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE bfloat16_t(float f)
+      : bits(RAJA::detail::float_to_bfloat16_bits(f))
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator float() const
+  {
+    return RAJA::detail::bfloat16_bits_to_float(bits);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE static bfloat16_t from_bits(std::uint16_t b)
+  {
+    bfloat16_t h;
+    h.bits = b;
+    return h;
+  }
+};
+
+static_assert(sizeof(half_t) == 2, "half_t must be 16 bits");
+static_assert(sizeof(bfloat16_t) == 2, "bfloat16_t must be 16 bits");
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
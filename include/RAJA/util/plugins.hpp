@@ -9,6 +9,7 @@
 #define RAJA_plugins_HPP
 
 #include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
@@ -21,6 +22,18 @@
 namespace RAJA {
 namespace util {
 
+/*!
+ * True if any plugin is registered. The loops call the plugin hooks for
+ * every launch, so with no plugins they only pay for this check. Building
+ * with RAJA_ENABLE_PLUGIN_HOOKS off removes the hooks altogether.
+ */
+RAJA_INLINE
+bool
+plugins_active()
+{
+  return plugins_registered;
+}
+
 template <typename T>
 RAJA_INLINE auto trigger_updates_before(T&& item)
   -> typename std::remove_reference<T>::type
@@ -32,48 +45,72 @@ RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGIN_HOOKS)
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preCapture(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGIN_HOOKS)
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->postCapture(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGIN_HOOKS)
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preLaunch(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGIN_HOOKS)
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->postLaunch(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
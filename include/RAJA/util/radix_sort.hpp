@@ -0,0 +1,401 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the host LSD radix sort used by the parallel
+*          host back-ends, and the key functions of the device radix select.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_radix_sort_HPP
+#define RAJA_util_radix_sort_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! unsigned type with the bits of a radix sort key of the given size
+template <size_t Size>
+struct radix_bits;
+
+template <>
+struct radix_bits<1> {
+  using type = std::uint8_t;
+};
+
+template <>
+struct radix_bits<2> {
+  using type = std::uint16_t;
+};
+
+template <>
+struct radix_bits<4> {
+  using type = std::uint32_t;
+};
+
+template <>
+struct radix_bits<8> {
+  using type = std::uint64_t;
+};
+
+/*!
+    \brief maps keys of type T to unsigned integers with the same order,
+    false_type if T can not be radix sorted
+*/
+template <typename T, typename Enable = void>
+struct radix_key : std::false_type {
+};
+
+template <typename T>
+struct radix_key<T,
+                 typename std::enable_if<std::is_integral<T>::value &&
+                                         sizeof(T) <= 8>::type>
+    : std::true_type {
+  using bits_type = typename radix_bits<sizeof(T)>::type;
+
+  RAJA_HOST_DEVICE static bits_type to_bits(T key)
+  {
+    bits_type bits = static_cast<bits_type>(key);
+    if (std::is_signed<T>::value) {
+      bits ^= bits_type(1) << (sizeof(T) * CHAR_BIT - 1);
+    }
+    return bits;
+  }
+};
+
+template <typename T>
+struct radix_key<T,
+                 typename std::enable_if<
+                     std::is_floating_point<T>::value &&
+                     std::numeric_limits<T>::is_iec559 &&
+                     (sizeof(T) == 4 || sizeof(T) == 8)>::type>
+    : std::true_type {
+  using bits_type = typename radix_bits<sizeof(T)>::type;
+
+  RAJA_HOST_DEVICE static bits_type to_bits(T key)
+  {
+    // -0.0 and 0.0 compare equal so they must keep their order
+    if (key == T(0)) {
+      key = T(0);
+    }
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(T));
+    const bits_type sign = bits_type(1) << (sizeof(T) * CHAR_BIT - 1);
+    return (bits & sign) ? static_cast<bits_type>(~bits) : (bits | sign);
+  }
+};
+
+/*!
+    \brief true if a range of Iter sorted with Compare is radix sorted by
+    the host back-ends, which is for pointers to arithmetic keys sorted by
+    operators::less or operators::greater
+*/
+template <typename Iter, typename Compare>
+struct use_radix_sort
+    : concepts::all_of<
+          std::is_pointer<Iter>,
+          radix_key<IterVal<Iter>>,
+          concepts::any_of<
+              camp::is_same<Compare, operators::less<IterVal<Iter>>>,
+              camp::is_same<Compare, operators::greater<IterVal<Iter>>>>> {
+};
+
+/*!
+    \brief true if pairs of KeyIter and ValIter sorted with Compare are
+    radix sorted by the host back-ends, the values are copied as bytes
+*/
+template <typename KeyIter, typename ValIter, typename Compare>
+struct use_radix_sort_pairs
+    : concepts::all_of<
+          use_radix_sort<KeyIter, Compare>,
+          std::is_pointer<ValIter>,
+          std::is_trivially_copyable<IterVal<ValIter>>> {
+};
+
+//! value type of a radix sort of keys without values
+struct radix_keys_only {
+};
+
+// these numbers are arbitrary
+constexpr int get_radix_sort_digit_bits() { return 8; }
+constexpr Index_type get_radix_sort_scatter_buffer() { return 16; }
+constexpr Index_type get_min_radix_sort_iterates() { return 4096; }
+
+/*!
+    \brief bits of key ordered like the keys of an ascending, or descending,
+    sort
+*/
+template <bool Descending, typename K>
+RAJA_HOST_DEVICE RAJA_INLINE typename radix_key<K>::bits_type radix_ordered_bits(
+    K key)
+{
+  auto bits = radix_key<K>::to_bits(key);
+  if (Descending) {
+    bits = static_cast<decltype(bits)>(~bits);
+  }
+  return bits;
+}
+
+//! digit of key at shift, the digits of descending sorts are inverted
+template <bool Descending, typename K>
+RAJA_INLINE Index_type radix_digit(K key, int shift)
+{
+  constexpr Index_type mask = (Index_type(1) << get_radix_sort_digit_bits()) - 1;
+  return static_cast<Index_type>(radix_ordered_bits<Descending>(key) >> shift) & mask;
+}
+
+/*!
+    \brief move the keys and values of [i_begin, i_end) to their positions
+    in the pass, starting at offsets[d] for digit d
+
+    The values are gathered in small per digit buffers in cache and written
+    a buffer at a time, so each write to dst fills whole cache lines instead
+    of touching a different line for every value.
+*/
+template <bool Descending, bool HasVals, typename K, typename V>
+RAJA_INLINE void radix_scatter(K const* src_k,
+                               V const* src_v,
+                               K* dst_k,
+                               V* dst_v,
+                               Index_type i_begin,
+                               Index_type i_end,
+                               int shift,
+                               Index_type* offsets,
+                               K* buf_k,
+                               V* buf_v,
+                               Index_type* fill)
+{
+  constexpr Index_type num_buckets = Index_type(1)
+                                     << get_radix_sort_digit_bits();
+  constexpr Index_type width = get_radix_sort_scatter_buffer();
+
+  std::fill(fill, fill + num_buckets, Index_type(0));
+
+  for (Index_type i = i_begin; i < i_end; ++i) {
+    const Index_type d = radix_digit<Descending>(src_k[i], shift);
+    Index_type& f = fill[d];
+    buf_k[d * width + f] = src_k[i];
+    if (HasVals) {
+      buf_v[d * width + f] = src_v[i];
+    }
+    if (++f == width) {
+      std::copy(buf_k + d * width, buf_k + (d + 1) * width, dst_k + offsets[d]);
+      if (HasVals) {
+        std::copy(
+            buf_v + d * width, buf_v + (d + 1) * width, dst_v + offsets[d]);
+      }
+      offsets[d] += width;
+      f = 0;
+    }
+  }
+
+  for (Index_type d = 0; d < num_buckets; ++d) {
+    std::copy(buf_k + d * width, buf_k + d * width + fill[d], dst_k + offsets[d]);
+    if (HasVals) {
+      std::copy(
+          buf_v + d * width, buf_v + d * width + fill[d], dst_v + offsets[d]);
+    }
+  }
+}
+
+/*!
+    \brief digit at shift of the candidates of a radix select, the keys whose
+    bits under prefix_mask are prefix, and -1 for other keys
+*/
+template <bool Descending, typename K>
+struct radix_select_digit {
+  using bits_type = typename radix_key<K>::bits_type;
+
+  bits_type prefix;
+  bits_type prefix_mask;
+  int shift;
+
+  RAJA_HOST_DEVICE int operator()(K key) const
+  {
+    constexpr bits_type mask = (bits_type(1) << get_radix_sort_digit_bits()) - 1;
+    const bits_type bits = radix_ordered_bits<Descending>(key);
+    return ((bits & prefix_mask) == prefix)
+               ? static_cast<int>((bits >> shift) & mask)
+               : -1;
+  }
+};
+
+/*!
+    \brief true for keys whose bits under prefix_mask are less than prefix,
+    or equal to prefix if Equal, in the order of an ascending or descending
+    sort
+*/
+template <bool Descending, bool Equal, typename K>
+struct radix_select_partition {
+  using bits_type = typename radix_key<K>::bits_type;
+
+  bits_type prefix;
+  bits_type prefix_mask;
+
+  RAJA_HOST_DEVICE bool operator()(K key) const
+  {
+    const bits_type bits = radix_ordered_bits<Descending>(key) & prefix_mask;
+    return Equal ? bits == prefix : bits < prefix;
+  }
+};
+
+template <typename T>
+using radix_buffer = std::unique_ptr<T, RAJA::FreeAligned>;
+
+template <typename T>
+RAJA_INLINE radix_buffer<T> make_radix_buffer(Index_type len)
+{
+  radix_buffer<T> buf(RAJA::allocate_aligned_type<T>(
+      RAJA::DATA_ALIGN, static_cast<size_t>(len) * sizeof(T)));
+  if (len > 0 && buf.get() == nullptr) {
+    RAJA_ABORT_OR_THROW("radix_sort temporary memory allocation failed");
+  }
+  return buf;
+}
+
+/*!
+    \brief stable LSD radix sort of n keys, and values if V is not
+    radix_keys_only, in ascending or descending order
+
+    The range is split into num_blocks blocks. A pass over a digit counts
+    the digits of each block, scans the counts so each block knows where its
+    values of each digit go, and then moves the values of each block to the
+    other array. for_each_block(body) must call body(b) for every block b
+    and may do so in parallel. Passes over digits that are the same for all
+    keys are skipped, only the digits of bits [begin_bit, end_bit) of the
+    keys are sorted.
+*/
+template <bool Descending, typename K, typename V, typename ForEachBlock>
+inline void radix_sort(K* keys,
+                       V* vals,
+                       Index_type n,
+                       Index_type num_blocks,
+                       int begin_bit,
+                       int end_bit,
+                       ForEachBlock&& for_each_block)
+{
+  constexpr bool has_vals = !std::is_same<V, radix_keys_only>::value;
+  constexpr int digit_bits = get_radix_sort_digit_bits();
+  constexpr Index_type num_buckets = Index_type(1) << digit_bits;
+  constexpr Index_type width = get_radix_sort_scatter_buffer();
+
+  if (n <= 1) {
+    return;
+  }
+
+  radix_buffer<K> copy_k = make_radix_buffer<K>(n);
+  radix_buffer<V> copy_v = make_radix_buffer<V>(has_vals ? n : 0);
+  radix_buffer<K> scatter_k =
+      make_radix_buffer<K>(num_blocks * num_buckets * width);
+  radix_buffer<V> scatter_v =
+      make_radix_buffer<V>(has_vals ? num_blocks * num_buckets * width : 0);
+  std::vector<Index_type> counts(num_blocks * num_buckets);
+  std::vector<Index_type> fills(num_blocks * num_buckets);
+
+  auto block_begin = [=](Index_type b) { return firstIndex(n, num_blocks, b); };
+
+  K* src_k = keys;
+  V* src_v = vals;
+  K* dst_k = copy_k.get();
+  V* dst_v = copy_v.get();
+
+  for (int shift = begin_bit; shift < end_bit; shift += digit_bits) {
+
+    for_each_block([&](Index_type b) {
+      Index_type* c = &counts[b * num_buckets];
+      std::fill(c, c + num_buckets, Index_type(0));
+      for (Index_type i = block_begin(b); i < block_begin(b + 1); ++i) {
+        ++c[radix_digit<Descending>(src_k[i], shift)];
+      }
+    });
+
+    // skip the pass if every key has the same digit
+    bool same_digit = false;
+    for (Index_type d = 0; d < num_buckets && !same_digit; ++d) {
+      Index_type total = 0;
+      for (Index_type b = 0; b < num_blocks; ++b) {
+        total += counts[b * num_buckets + d];
+      }
+      same_digit = (total == n);
+    }
+    if (same_digit) {
+      continue;
+    }
+
+    // the values of digit d of block b go after those of smaller digits and
+    // of digit d in blocks before b
+    Index_type offset = 0;
+    for (Index_type d = 0; d < num_buckets; ++d) {
+      for (Index_type b = 0; b < num_blocks; ++b) {
+        const Index_type c = counts[b * num_buckets + d];
+        counts[b * num_buckets + d] = offset;
+        offset += c;
+      }
+    }
+
+    for_each_block([&](Index_type b) {
+      radix_scatter<Descending, has_vals>(
+          src_k,
+          src_v,
+          dst_k,
+          dst_v,
+          block_begin(b),
+          block_begin(b + 1),
+          shift,
+          &counts[b * num_buckets],
+          scatter_k.get() + b * num_buckets * width,
+          scatter_v.get() + (has_vals ? b * num_buckets * width : 0),
+          &fills[b * num_buckets]);
+    });
+
+    std::swap(src_k, dst_k);
+    std::swap(src_v, dst_v);
+  }
+
+  if (src_k != keys) {
+    for_each_block([&](Index_type b) {
+      std::copy(src_k + block_begin(b), src_k + block_begin(b + 1),
+                keys + block_begin(b));
+      if (has_vals) {
+        std::copy(src_v + block_begin(b), src_v + block_begin(b + 1),
+                  vals + block_begin(b));
+      }
+    });
+  }
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
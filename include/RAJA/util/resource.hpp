@@ -20,6 +20,7 @@
 #ifndef RAJA_resource_HPP
 #define RAJA_resource_HPP
 
+#include "camp/camp.hpp"
 #include "camp/resource.hpp"
 #if defined(RAJA_CUDA_ACTIVE)
 #include "RAJA/policy/cuda/policy.hpp"
@@ -82,6 +83,11 @@ namespace RAJA
   struct get_resource<ExecPolicy<ISetIter, cuda_exec_explicit<BlockSize, BlocksPerSM, Async>>>{
     using type = camp::resources::Cuda;
   };
+
+  template<size_t BlockSize, size_t ItemsPerThread, bool Async>
+  struct get_resource<cuda_scan_exec_explicit<BlockSize, ItemsPerThread, Async>>{
+    using type = camp::resources::Cuda;
+  };
 #endif
 
 #if defined(RAJA_HIP_ACTIVE)
@@ -99,9 +105,19 @@ namespace RAJA
   struct get_resource<ExecPolicy<ISetIter, hip_exec<BlockSize, Async>>>{
     using type = camp::resources::Hip;
   };
+
+  template<size_t BlockSize, size_t ItemsPerThread, bool Async>
+  struct get_resource<hip_scan_exec_explicit<BlockSize, ItemsPerThread, Async>>{
+    using type = camp::resources::Hip;
+  };
 #endif
 
 #if defined(RAJA_ENABLE_SYCL)
+  template<>
+  struct get_resource_from_platform<Platform::sycl>{
+    using type = camp::resources::Sycl;
+  };
+
   template<size_t BlockSize, bool Async>
   struct get_resource<sycl_exec<BlockSize, Async>>{
     using type = camp::resources::Sycl;
@@ -140,6 +156,44 @@ namespace RAJA
   };
 #endif
 
+  namespace detail
+  {
+    template<typename Res, typename E>
+    int wait_for_event(Res &r, E &&event)
+    {
+      Event e = std::forward<E>(event);
+      r.wait_for(&e);
+      return 0;
+    }
+  } // end namespace detail
+
+  /*!
+   * \brief Makes the work launched on r from now on wait for events.
+   *
+   * The events may be Events, or the EventProxy returned by a pattern. A
+   * CUDA or HIP resource waits on its stream for events of the same
+   * back-end, with cudaStreamWaitEvent or hipStreamWaitEvent, and the
+   * OpenMP target resource with task dependencies, so the host is not
+   * blocked; other events are waited for on the host. Work on the host
+   * resource has completed when the pattern returns, so its events never
+   * block.
+   *
+   * r is returned, so a dependency can be passed to any pattern that takes
+   * a resource:
+   *
+   *   auto e1 = RAJA::forall<cuda_exec_async<256>>(res1, seg, body1);
+   *   auto e2 = RAJA::forall<cuda_exec_async<256>>(res2, seg, body2);
+   *
+   *   RAJA::forall<cuda_exec_async<256>>(
+   *       RAJA::resources::wait_for(res3, e1, e2), seg, body3);
+   */
+  template<typename Res, typename... Events>
+  Res &wait_for(Res &r, Events... events)
+  {
+    camp::sink(detail::wait_for_event(r, std::move(events))...);
+    return r;
+  }
+
   } // end namespace resources
 
   namespace type_traits
@@ -337,6 +337,53 @@ struct intro_sort_insertion_sort_cutoff
   static constexpr size_t get() { return 16; }
 };
 
+/*!
+    \brief partition given range inplace around a median of 3 pivot using
+    comparison function, returns the pivot in its sorted position.
+    The range must have at least 3 elements.
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE
+Iter
+quick_partition(Iter begin,
+                Iter end,
+                Compare comp)
+{
+  using RAJA::safe_iter_swap;
+
+  // choose pivot with median of 3
+  Iter mid = begin + (end - begin)/2;
+  Iter last = end-1;
+  Iter pivot = comp(*begin, *mid)
+                  ? ( comp(*mid, *last)
+                         ? mid
+                         : ( comp(*begin, *last)
+                                ? last
+                                : begin ) )
+                  : ( comp(*mid, *last)
+                         ? ( comp(*begin, *last)
+                                ? begin
+                                : last )
+                         : mid );
+
+  // swap pivot to last
+  if (pivot != last) {
+    safe_iter_swap(pivot, last);
+    pivot = last;
+  }
+
+  // partition
+  mid = detail::partition(begin, last, [&](Iter it){ return comp(*it, *pivot); });
+
+  // swap pivot to sorted position
+  if (mid != pivot) {
+    safe_iter_swap(mid, pivot);
+    pivot = mid;
+  }
+
+  return pivot;
+}
+
 /*!
     \brief unstable intro sort given range inplace using comparison function
     and using O(N*lg(N)) comparisons and O(lg(N)) memory, with limited depth.
@@ -349,7 +396,6 @@ intro_sort_depth(Iter begin,
                  Compare comp,
                  unsigned depth)
 {
-  using RAJA::safe_iter_swap;
   using diff_type = ::RAJA::detail::IterDiff<Iter>;
 
   diff_type N = end - begin;
@@ -374,36 +420,8 @@ intro_sort_depth(Iter begin,
 
   } else {
 
-    // use quick sort
-    // choose pivot with median of 3 (N >= insertion_sort_cutoff)
-    Iter mid = begin + N/2;
-    Iter last = end-1;
-    Iter pivot = comp(*begin, *mid)
-                    ? ( comp(*mid, *last)
-                           ? mid
-                           : ( comp(*begin, *last)
-                                  ? last
-                                  : begin ) )
-                    : ( comp(*mid, *last)
-                           ? ( comp(*begin, *last)
-                                  ? begin
-                                  : last )
-                           : mid );
-
-    // swap pivot to last
-    if (pivot != last) {
-      safe_iter_swap(pivot, last);
-      pivot = last;
-    }
-
-    // partition
-    mid = partition(begin, last, [&](Iter it){ return comp(*it, *pivot); });
-
-    // swap pivot to sorted position
-    if (mid != pivot) {
-      safe_iter_swap(mid, pivot);
-      pivot = mid;
-    }
+    // use quick sort (N >= insertion_sort_cutoff)
+    Iter pivot = detail::quick_partition(begin, end, comp);
 
     // recurse to sort first and second parts, ignoring already sorted pivot
     // by construction pivot is always in the range [begin, last]
@@ -438,6 +456,76 @@ intro_sort(Iter begin,
   detail::intro_sort_depth(begin, end, comp, max_depth);
 }
 
+/*!
+    \brief unstable intro select given range inplace using comparison function
+    so nth is the element it would be if the range were sorted, no element
+    before nth is greater and no element after nth is less,
+    using O(N) comparisons on average, O(N*lg(N)) at worst, and O(1) memory
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE inline
+void
+intro_select(Iter begin,
+             Iter nth,
+             Iter end,
+             Compare comp)
+{
+  using diff_type = ::RAJA::detail::IterDiff<Iter>;
+
+  if (nth == end) {
+    return;
+  }
+
+  // cutoff to use insertion sort
+  constexpr diff_type insertion_sort_cutoff =
+      static_cast<diff_type>(intro_sort_insertion_sort_cutoff::get());
+
+  // set max depth to 2*lg(N)
+  unsigned depth = 2*detail::ulog2(end - begin);
+
+  // quick select, keeping the part that contains nth
+  while (end - begin >= insertion_sort_cutoff) {
+
+    if (depth == 0) {
+
+      // use heap sort if too many partitions were unbalanced
+      detail::heap_sort(begin, end, comp);
+      return;
+    }
+    --depth;
+
+    Iter pivot = detail::quick_partition(begin, end, comp);
+
+    if (pivot == nth) {
+      return;
+    } else if (nth < pivot) {
+      end = pivot;
+    } else {
+      begin = RAJA::next(pivot);
+    }
+  }
+
+  // use insertion sort for small ranges
+  detail::insertion_sort(begin, end, comp);
+}
+
+/*!
+    \brief unstable partial sort given range inplace using comparison function
+    so [begin, middle) holds the smallest elements in sorted order,
+    using intro select followed by intro sort of [begin, middle)
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE inline
+void
+partial_sort(Iter begin,
+             Iter middle,
+             Iter end,
+             Compare comp)
+{
+  detail::intro_select(begin, middle, end, comp);
+  detail::intro_sort(begin, middle, comp);
+}
+
 /*!
     \brief merge a range with midpoint using comparison function
     with local range/2 copy
@@ -580,6 +668,72 @@ merge_like_std( Iter1 first1,
   return;
 }
 
+/*!
+    \brief bottom up merges of the sorted 16-element chunks of a range of
+    len values held in copyarr, the sorted values are moved to begin
+
+    copyarr is used as the second array of the merges, so no memory is
+    allocated.
+*/
+template <typename Iter, typename CopyIter, typename Compare>
+RAJA_INLINE
+void
+merge_sort_levels(Iter begin,
+                  RAJA::detail::IterDiff<Iter> len,
+                  CopyIter copyarr,
+                  Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  // min helper
+  auto minlam = [] (diff_type a, diff_type b) {return (a < b) ? a : b;};
+
+  bool copyvalid = true;
+  //for ( diff_type midpoint = 1; midpoint < len; midpoint *= 2 )  // O(log n) loop
+  for ( diff_type midpoint = 16; midpoint < len; midpoint *= 2 )  // O(log n) loop
+  {
+    for ( diff_type start = 0; start < len; start += midpoint * 2 )  // O(n) merging loop (can be parallelized)
+    {
+      diff_type finish = minlam( start + midpoint * 2, len );
+      if ( finish > len )
+      {
+        RAJA_ABORT_OR_THROW( "merge_sort invalid finish point" );  // sanity check
+      }
+
+      if ( start + midpoint >= len )
+      {
+        // copy sorted remainder over
+        if ( copyvalid )
+        {
+          std::move( copyarr + start, copyarr + finish, begin + start );
+        }
+        else
+        {
+          std::move( begin + start, begin + finish, copyarr + start );
+        }
+        break;  // skip merge if no second half exists
+      }
+
+      if ( copyvalid )  // switch arrays per level of merging to avoid copying back to copyarr
+      {
+        detail::merge_like_std( copyarr + start, copyarr + start + midpoint, copyarr + start + midpoint, copyarr + finish, begin + start, comp );
+      }
+      else
+      {
+        detail::merge_like_std( begin + start, begin + start + midpoint, begin + start + midpoint, begin + finish, copyarr + start, comp );
+      }
+    }
+
+    copyvalid = !copyvalid; // switch arrays per level of merging to avoid copying back to copyarr
+  }
+
+  // update copy if necessary
+  if ( copyvalid )
+  {
+    std::move( copyarr, copyarr + len, begin );
+  }
+}
+
 /*!
     \brief stable merge sort given range inplace using comparison function
     and using O(N*lg(N)) comparisons and O(N) memory
@@ -639,50 +793,7 @@ merge_sort(Iter begin,
       new(&copyarr[cc]) value_type(std::move(begin[cc]));
     }
 
-    bool copyvalid = true;
-    //for ( diff_type midpoint = 1; midpoint < len; midpoint *= 2 )  // O(log n) loop
-    for ( diff_type midpoint = 16; midpoint < len; midpoint *= 2 )  // O(log n) loop
-    {
-      for ( diff_type start = 0; start < len; start += midpoint * 2 )  // O(n) merging loop (can be parallelized)
-      {
-        diff_type finish = minlam( start + midpoint * 2, len );
-        if ( finish > len )
-        {
-          RAJA_ABORT_OR_THROW( "merge_sort invalid finish point" );  // sanity check
-        }
-
-        if ( start + midpoint >= len )
-        {
-          // copy sorted remainder over
-          if ( copyvalid )
-          {
-            std::move( copyarr + start, copyarr + finish, begin + start );
-          }
-          else
-          {
-            std::move( begin + start, begin + finish, copyarr + start );
-          }
-          break;  // skip merge if no second half exists
-        }
-
-        if ( copyvalid )  // switch arrays per level of merging to avoid copying back to copyarr
-        {
-          detail::merge_like_std( copyarr + start, copyarr + start + midpoint, copyarr + start + midpoint, copyarr + finish, begin + start, comp );
-        }
-        else
-        {
-          detail::merge_like_std( begin + start, begin + start + midpoint, begin + start + midpoint, begin + finish, copyarr + start, comp );
-        }
-      }
-
-      copyvalid = !copyvalid; // switch arrays per level of merging to avoid copying back to copyarr
-    }
-
-    // update copy if necessary
-    if ( copyvalid )
-    {
-      std::move( copyarr, copyarr + len, begin );
-    }
+    detail::merge_sort_levels( begin, len, copyarr, comp );
   }
   //else
   //{
@@ -693,6 +804,32 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief comparison function that compares indices by the keys they
+    refer to, used to sort a permutation without moving the keys
+*/
+template <typename KeyIter, typename Compare>
+struct CompareIndirect
+{
+  KeyIter keys;
+  Compare comp;
+
+  template <typename Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE
+  bool operator()(Idx const& lhs, Idx const& rhs) const
+  {
+    return comp(keys[lhs], keys[rhs]);
+  }
+};
+
+template <typename KeyIter, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE
+CompareIndirect<KeyIter, Compare>
+compare_indirect(KeyIter keys, Compare comp)
+{
+  return CompareIndirect<KeyIter, Compare>{keys, comp};
+}
+
 }  // namespace detail
 
 /*!
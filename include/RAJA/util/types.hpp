@@ -39,6 +39,13 @@ namespace RAJA
 ///
 enum IndexOwnership { Unowned, Owned };
 
+///
+/// Enumeration used to indicate whether a segment that copies its indices
+/// waits for the copy to finish (CopySync) or returns after enqueuing it
+/// on the segment resource (CopyAsync).
+///
+enum IndexCopy { CopySync, CopyAsync };
+
 ///
 /// Type use for all loop indexing in RAJA constructs.
 ///
@@ -0,0 +1,83 @@
+###############################################################################
+# Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+# and other RAJA project contributors. See the RAJA/LICENSE file for details.
+#
+# SPDX-License-Identifier: (BSD-3-Clause)
+################################################################################
+
+set(_raja_tensor_dispatch_dir ${CMAKE_CURRENT_LIST_DIR})
+
+##
+## Instruction sets that tensor kernels are compiled for, on top of the
+## flags of the target they are added to
+##
+if (NOT DEFINED RAJA_TENSOR_DISPATCH_ISAS)
+  if (CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|i.86" AND
+      CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang|Intel")
+    set(RAJA_TENSOR_DISPATCH_ISAS avx2 avx512)
+  else ()
+    set(RAJA_TENSOR_DISPATCH_ISAS "")
+  endif ()
+endif ()
+
+set(_raja_tensor_dispatch_flags_avx2 -mavx2 -mfma)
+set(_raja_tensor_dispatch_flags_avx512 -mavx512f -mfma)
+
+##
+## raja_add_tensor_dispatch_sources(TARGET <target> SOURCES <files> [ISAS <isas>])
+##
+## Adds sources defining kernels with RAJA_TENSOR_DISPATCH_DEFINE to target,
+## compiled once with the target's flags and once more for each instruction
+## set, which RAJA_TENSOR_DISPATCH chooses between at run time.
+##
+## The base copies are added first, so that for inline functions that all
+## copies share the linker keeps the one that runs on every CPU.
+##
+function(raja_add_tensor_dispatch_sources)
+  set(options )
+  set(singleValueArgs TARGET)
+  set(multiValueArgs SOURCES ISAS)
+
+  cmake_parse_arguments(arg
+    "${options}" "${singleValueArgs}" "${multiValueArgs}" ${ARGN})
+
+  if (NOT arg_ISAS)
+    set(arg_ISAS ${RAJA_TENSOR_DISPATCH_ISAS})
+  endif ()
+
+  set(_variant_dir ${CMAKE_CURRENT_BINARY_DIR}/${arg_TARGET}_tensor_dispatch)
+
+  foreach (_variant base ${arg_ISAS})
+    if (NOT _variant STREQUAL "base" AND
+        NOT DEFINED _raja_tensor_dispatch_flags_${_variant})
+      message(FATAL_ERROR "Unknown tensor dispatch instruction set: ${_variant}")
+    endif ()
+
+    foreach (_source ${arg_SOURCES})
+      get_filename_component(RAJA_TENSOR_DISPATCH_SOURCE ${_source} ABSOLUTE)
+      get_filename_component(_name ${_source} NAME_WE)
+
+      set(_variant_source ${_variant_dir}/${_name}.${_variant}.cpp)
+      configure_file(
+        ${_raja_tensor_dispatch_dir}/RAJATensorDispatchVariant.cpp.in
+        ${_variant_source})
+
+      if (_variant STREQUAL "base")
+        set_source_files_properties(${_variant_source} PROPERTIES
+          COMPILE_DEFINITIONS "RAJA_TENSOR_DISPATCH_VARIANT=base")
+      else ()
+        set_source_files_properties(${_variant_source} PROPERTIES
+          COMPILE_DEFINITIONS "RAJA_TENSOR_DISPATCH_VARIANT=${_variant};RAJA_TENSOR_DISPATCH_ISA_VARIANT"
+          COMPILE_OPTIONS "${_raja_tensor_dispatch_flags_${_variant}}")
+      endif ()
+
+      target_sources(${arg_TARGET} PRIVATE ${_variant_source})
+    endforeach ()
+
+    if (NOT _variant STREQUAL "base")
+      string(TOUPPER ${_variant} _variant_upper)
+      target_compile_definitions(${arg_TARGET}
+        PRIVATE RAJA_TENSOR_DISPATCH_HAVE_${_variant_upper})
+    endif ()
+  endforeach ()
+endfunction()
@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Plugin labeling every forall, kernel, launch and WorkGroup run with an
+// NVTX (CUDA), roctx (HIP) or ITT (VTune) range, built as the shared library
+// raja_annotation_plugin for the RuntimePluginLoader:
+//
+//   RAJA_PLUGINS=<prefix>/lib/libraja_annotation_plugin.so ./my_app
+//
+// Ranges are named with the KernelName of the loop, or with the pattern and
+// the demangled loop body type of the launch site. The names are made once
+// per launch site and thread, and without an attached profiler the range
+// calls of these APIs return at once.
+//
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+#include <string>
+#include <unordered_map>
+
+#if defined(RAJA_ENABLE_ITT)
+#include <ittnotify.h>
+#endif
+
+namespace {
+
+// the labels of the launch sites seen by this thread
+thread_local std::unordered_map<const char*, std::string> site_labels;
+
+const char* pattern_name(RAJA::util::KernelPattern pattern)
+{
+  switch (pattern) {
+    case RAJA::util::KernelPattern::forall: return "forall ";
+    case RAJA::util::KernelPattern::kernel: return "kernel ";
+    case RAJA::util::KernelPattern::launch: return "launch ";
+    case RAJA::util::KernelPattern::workgroup: return "workgroup ";
+    default: return "";
+  }
+}
+
+const char* label(const RAJA::util::PluginContext& p)
+{
+  if (p.kernel_name != nullptr) {
+    return p.kernel_name;
+  }
+  if (p.launch_site == nullptr) {
+    return "RAJA";
+  }
+  std::string& l = site_labels[p.launch_site];
+  if (l.empty()) {
+    l = pattern_name(p.pattern) + RAJA::util::demangle(p.launch_site);
+  }
+  return l.c_str();
+}
+
+// RAJA labels named loops itself when built with a profiler API, so
+// those only get an ITT range here
+bool labeled_by_raja(const RAJA::util::PluginContext& p)
+{
+#if (defined(RAJA_ENABLE_CUDA) && defined(RAJA_ENABLE_NV_TOOLS_EXT)) || \
+    (defined(RAJA_ENABLE_HIP) && defined(RAJA_ENABLE_ROCTX))
+  return p.kernel_name != nullptr;
+#else
+  RAJA_UNUSED_VAR(p);
+  return false;
+#endif
+}
+
+}  // namespace
+
+class AnnotationPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  AnnotationPlugin()
+  {
+#if defined(RAJA_ENABLE_ITT)
+    m_domain = __itt_domain_create("RAJA");
+#endif
+  }
+
+  void preLaunch(const RAJA::util::PluginContext& p) override
+  {
+    const char* name = label(p);
+
+    if (!labeled_by_raja(p)) {
+#if defined(RAJA_ENABLE_CUDA) && defined(RAJA_ENABLE_NV_TOOLS_EXT)
+      nvtxRangePushA(name);
+#elif defined(RAJA_ENABLE_HIP) && defined(RAJA_ENABLE_ROCTX)
+      roctxRangePush(name);
+#endif
+    }
+
+#if defined(RAJA_ENABLE_ITT)
+    if (m_domain != nullptr && m_domain->flags) {
+      __itt_task_begin(m_domain, __itt_null, __itt_null, handle(name));
+    }
+#endif
+    RAJA_UNUSED_VAR(name);
+  }
+
+  void postLaunch(const RAJA::util::PluginContext& p) override
+  {
+#if defined(RAJA_ENABLE_ITT)
+    if (m_domain != nullptr && m_domain->flags) {
+      __itt_task_end(m_domain);
+    }
+#endif
+
+    if (!labeled_by_raja(p)) {
+#if defined(RAJA_ENABLE_CUDA) && defined(RAJA_ENABLE_NV_TOOLS_EXT)
+      nvtxRangePop();
+#elif defined(RAJA_ENABLE_HIP) && defined(RAJA_ENABLE_ROCTX)
+      roctxRangePop();
+#endif
+    }
+  }
+
+private:
+#if defined(RAJA_ENABLE_ITT)
+  // ITT string handles live as long as the process, one for each label.
+  // Kernel names may be in reused buffers, so they are looked up by value.
+  static __itt_string_handle* handle(const char* name)
+  {
+    thread_local std::unordered_map<std::string, __itt_string_handle*> handles;
+    __itt_string_handle*& h = handles[name];
+    if (h == nullptr) {
+      h = __itt_string_handle_create(name);
+    }
+    return h;
+  }
+
+  __itt_domain* m_domain{nullptr};
+#endif
+};
+
+// Dynamically loading plugin.
+extern "C" RAJA::util::PluginStrategy *getPlugin()
+{
+  return new AnnotationPlugin;
+}
@@ -0,0 +1,157 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Plugin opening a Caliper region for every named forall, kernel and
+// launch, built as the shared library raja_caliper_plugin for the
+// RuntimePluginLoader:
+//
+//   RAJA_PLUGINS=<prefix>/lib/libraja_caliper_plugin.so \
+//   CALI_CONFIG=runtime-report ./my_app
+//
+// The region is named with the KernelName of the loop and carries the
+// attributes raja.pattern, raja.policy, raja.platform and raja.iterations,
+// so Caliper can group the region time by policy. With Adiak, init_plugins
+// records the RAJA version and back-ends as run metadata, which needs the
+// application to have called adiak_init.
+//
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+#include <string>
+#include <unordered_map>
+
+#include <caliper/cali.h>
+
+#if defined(RAJA_ENABLE_ADIAK)
+#include <adiak.h>
+#endif
+
+namespace {
+
+// the demangled policy names seen by this thread, by typeid name
+thread_local std::unordered_map<const char*, std::string> policy_names;
+
+const char* policy_label(const RAJA::util::PluginContext& p)
+{
+  if (p.policy_name == nullptr) {
+    return "";
+  }
+  std::string& l = policy_names[p.policy_name];
+  if (l.empty()) {
+    l = p.policy();
+  }
+  return l.c_str();
+}
+
+const char* pattern_label(RAJA::util::KernelPattern pattern)
+{
+  switch (pattern) {
+    case RAJA::util::KernelPattern::forall: return "forall";
+    case RAJA::util::KernelPattern::kernel: return "kernel";
+    case RAJA::util::KernelPattern::launch: return "launch";
+    case RAJA::util::KernelPattern::workgroup: return "workgroup";
+    default: return "undefined";
+  }
+}
+
+const char* platform_label(RAJA::Platform platform)
+{
+  switch (platform) {
+    case RAJA::Platform::host: return "host";
+    case RAJA::Platform::cuda: return "cuda";
+    case RAJA::Platform::omp_target: return "omp_target";
+    case RAJA::Platform::hip: return "hip";
+    case RAJA::Platform::sycl: return "sycl";
+    default: return "undefined";
+  }
+}
+
+}  // namespace
+
+class CaliperPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  CaliperPlugin()
+  {
+    m_pattern = cali_create_attribute("raja.pattern", CALI_TYPE_STRING,
+                                      CALI_ATTR_DEFAULT);
+    m_policy = cali_create_attribute("raja.policy", CALI_TYPE_STRING,
+                                     CALI_ATTR_DEFAULT);
+    m_platform = cali_create_attribute("raja.platform", CALI_TYPE_STRING,
+                                       CALI_ATTR_DEFAULT);
+    m_iterations = cali_create_attribute("raja.iterations", CALI_TYPE_INT,
+                                         CALI_ATTR_ASVALUE);
+  }
+
+  void init(const RAJA::util::PluginOptions& RAJA_UNUSED_ARG(p)) override
+  {
+#if defined(RAJA_ENABLE_ADIAK)
+    const std::string version = std::to_string(RAJA_VERSION_MAJOR) + "." +
+                                std::to_string(RAJA_VERSION_MINOR) + "." +
+                                std::to_string(RAJA_VERSION_PATCHLEVEL);
+    adiak_namevalue("raja_version", adiak_general, nullptr, "%s",
+                    version.c_str());
+
+    std::string backends("seq");
+#if defined(RAJA_ENABLE_OPENMP)
+    backends += ",openmp";
+#endif
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+    backends += ",openmp_target";
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    backends += ",tbb";
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+    backends += ",cuda";
+#endif
+#if defined(RAJA_ENABLE_HIP)
+    backends += ",hip";
+#endif
+#if defined(RAJA_ENABLE_SYCL)
+    backends += ",sycl";
+#endif
+    adiak_namevalue("raja_backends", adiak_general, nullptr, "%s",
+                    backends.c_str());
+#endif
+  }
+
+  void preLaunch(const RAJA::util::PluginContext& p) override
+  {
+    if (p.kernel_name == nullptr) return;
+
+    cali_begin_region(p.kernel_name);
+    cali_begin_string(m_pattern, pattern_label(p.pattern));
+    cali_begin_string(m_policy, policy_label(p));
+    cali_begin_string(m_platform, platform_label(p.platform));
+    cali_begin_int(m_iterations, static_cast<int>(p.num_iterations));
+  }
+
+  void postLaunch(const RAJA::util::PluginContext& p) override
+  {
+    if (p.kernel_name == nullptr) return;
+
+    cali_end(m_iterations);
+    cali_end(m_platform);
+    cali_end(m_policy);
+    cali_end(m_pattern);
+    cali_end_region(p.kernel_name);
+  }
+
+private:
+  cali_id_t m_pattern;
+  cali_id_t m_policy;
+  cali_id_t m_platform;
+  cali_id_t m_iterations;
+};
+
+// Dynamically loading plugin.
+extern "C" RAJA::util::PluginStrategy *getPlugin()
+{
+  return new CaliperPlugin;
+}
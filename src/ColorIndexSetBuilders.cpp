@@ -0,0 +1,228 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the graph coloring index set builder.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <cstdint>
+#include <vector>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+namespace
+{
+
+//
+// Random but reproducible priority of an element for Jones-Plassmann
+// coloring, ties are broken by element index.
+//
+inline std::uint64_t colorPriority(RAJA::Index_type elem)
+{
+  std::uint64_t x = static_cast<std::uint64_t>(elem) + 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+inline bool colorPrecedes(RAJA::Index_type a, RAJA::Index_type b)
+{
+  const std::uint64_t pa = colorPriority(a);
+  const std::uint64_t pb = colorPriority(b);
+  return pa > pb || (pa == pb && a < b);
+}
+
+}  // namespace
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with one segment per color of the element
+ * conflict graph, where two elements conflict when they share a node.
+ *
+ ******************************************************************************
+ */
+void buildColorIndexSet(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const elem_node_offsets,
+    const RAJA::Index_type* const elem_nodes,
+    RAJA::Index_type num_elems,
+    RAJA::Index_type num_nodes)
+{
+  if (num_elems <= 0) return;
+
+  //
+  // Inverse node to element connectivity, elements of each node are in
+  // increasing order.
+  //
+  std::vector<RAJA::Index_type> node_elem_offsets(num_nodes + 1, 0);
+  for (RAJA::Index_type e = 0; e < num_elems; ++e) {
+    for (RAJA::Index_type k = elem_node_offsets[e];
+         k < elem_node_offsets[e + 1];
+         ++k) {
+      ++node_elem_offsets[elem_nodes[k] + 1];
+    }
+  }
+  for (RAJA::Index_type n = 0; n < num_nodes; ++n) {
+    node_elem_offsets[n + 1] += node_elem_offsets[n];
+  }
+
+  std::vector<RAJA::Index_type> node_elems(node_elem_offsets[num_nodes]);
+  {
+    std::vector<RAJA::Index_type> pos(node_elem_offsets.begin(),
+                                      node_elem_offsets.end() - 1);
+    for (RAJA::Index_type e = 0; e < num_elems; ++e) {
+      for (RAJA::Index_type k = elem_node_offsets[e];
+           k < elem_node_offsets[e + 1];
+           ++k) {
+        node_elems[pos[elem_nodes[k]]++] = e;
+      }
+    }
+  }
+
+  //
+  // Jones-Plassmann coloring. In each round the uncolored elements that
+  // precede all of their uncolored neighbors are selected; they are not
+  // neighbors of each other, so they take the smallest color free among
+  // their neighbors at the same time.
+  //
+  std::vector<int> colors(num_elems, -1);
+  std::vector<char> selected(num_elems, 0);
+
+  std::vector<RAJA::Index_type> work(num_elems);
+  for (RAJA::Index_type e = 0; e < num_elems; ++e) {
+    work[e] = e;
+  }
+
+  int num_colors = 0;
+
+  while (!work.empty()) {
+    const RAJA::Index_type num_work =
+        static_cast<RAJA::Index_type>(work.size());
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (RAJA::Index_type w = 0; w < num_work; ++w) {
+      const RAJA::Index_type e = work[w];
+      bool is_max = true;
+      for (RAJA::Index_type k = elem_node_offsets[e];
+           is_max && k < elem_node_offsets[e + 1];
+           ++k) {
+        const RAJA::Index_type n = elem_nodes[k];
+        for (RAJA::Index_type j = node_elem_offsets[n];
+             j < node_elem_offsets[n + 1];
+             ++j) {
+          const RAJA::Index_type other = node_elems[j];
+          if (other != e && colors[other] < 0 && colorPrecedes(other, e)) {
+            is_max = false;
+            break;
+          }
+        }
+      }
+      selected[e] = is_max;
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel reduction(max : num_colors)
+#endif
+    {
+      // Colors of the neighbors of the element numbered by stamp
+      std::vector<RAJA::Index_type> used;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (RAJA::Index_type w = 0; w < num_work; ++w) {
+        const RAJA::Index_type e = work[w];
+        if (!selected[e]) continue;
+
+        for (RAJA::Index_type k = elem_node_offsets[e];
+             k < elem_node_offsets[e + 1];
+             ++k) {
+          const RAJA::Index_type n = elem_nodes[k];
+          for (RAJA::Index_type j = node_elem_offsets[n];
+               j < node_elem_offsets[n + 1];
+               ++j) {
+            const int c = colors[node_elems[j]];
+            if (c < 0) continue;
+            if (static_cast<std::size_t>(c) >= used.size()) {
+              used.resize(c + 1, -1);
+            }
+            used[c] = e;
+          }
+        }
+
+        int c = 0;
+        while (static_cast<std::size_t>(c) < used.size() && used[c] == e) {
+          ++c;
+        }
+        colors[e] = c;
+        if (c + 1 > num_colors) num_colors = c + 1;
+      }
+    }
+
+    RAJA::Index_type num_left = 0;
+    for (RAJA::Index_type w = 0; w < num_work; ++w) {
+      if (!selected[work[w]]) work[num_left++] = work[w];
+    }
+    work.resize(num_left);
+  }
+
+  //
+  // Gather the elements of each color in increasing order for locality.
+  //
+  std::vector<RAJA::Index_type> color_offsets(num_colors + 1, 0);
+  for (RAJA::Index_type e = 0; e < num_elems; ++e) {
+    ++color_offsets[colors[e] + 1];
+  }
+  for (int c = 0; c < num_colors; ++c) {
+    color_offsets[c + 1] += color_offsets[c];
+  }
+
+  std::vector<RAJA::Index_type> color_elems(num_elems);
+  {
+    std::vector<RAJA::Index_type> pos(color_offsets.begin(),
+                                      color_offsets.end() - 1);
+    for (RAJA::Index_type e = 0; e < num_elems; ++e) {
+      color_elems[pos[colors[e]]++] = e;
+    }
+  }
+
+  for (int c = 0; c < num_colors; ++c) {
+    const RAJA::Index_type begin = color_offsets[c];
+    const RAJA::Index_type end = color_offsets[c + 1];
+    if (color_elems[end - 1] - color_elems[begin] == end - begin - 1) {
+      iset.push_back(RAJA::RangeSegment(color_elems[begin],
+                                        color_elems[end - 1] + 1));
+    } else {
+      iset.push_back(RAJA::ListSegment(&color_elems[begin],
+                                       end - begin,
+                                       work_res));
+    }
+  }
+}
+
+}  // namespace RAJA
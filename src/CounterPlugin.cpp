@@ -0,0 +1,318 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/CounterPlugin.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using Event = RAJA::util::CounterPlugin::Event;
+
+// counts of the events at preLaunch of a launch that has not finished
+struct Open {
+  std::chrono::steady_clock::time_point start;
+  std::vector<uint64_t> values;
+};
+
+// counters of one thread, a perf_event group led by the first event
+struct ThreadCounters {
+  int generation{-1};
+  std::vector<int> fds;
+  //! index in the plugin events of each opened counter
+  std::vector<size_t> events;
+  std::vector<Open> open;
+
+  ~ThreadCounters() { close_all(); }
+
+  void close_all()
+  {
+#if defined(__linux__)
+    for (int fd : fds) {
+      close(fd);
+    }
+#endif
+    fds.clear();
+    events.clear();
+  }
+
+  void open_all(std::vector<Event> const& all, int gen)
+  {
+    close_all();
+    generation = gen;
+#if defined(__linux__)
+    for (size_t e = 0; e < all.size(); ++e) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = all[e].type;
+      attr.config = all[e].config;
+      attr.disabled = fds.empty() ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+
+      const int group = fds.empty() ? -1 : fds[0];
+      const int fd = static_cast<int>(
+          syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+      if (fd < 0) {
+        fprintf(stderr, "[CounterPlugin]: Could not count %s: %s\n",
+                all[e].name.c_str(), strerror(errno));
+        continue;
+      }
+      fds.push_back(fd);
+      events.push_back(e);
+    }
+    if (!fds.empty()) {
+      ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#else
+    RAJA_UNUSED_VAR(all);
+#endif
+  }
+
+  // counts of all events, 0 for the events that could not be opened
+  std::vector<uint64_t> read_all(size_t num_events) const
+  {
+    std::vector<uint64_t> values(num_events, 0);
+#if defined(__linux__)
+    if (fds.empty()) return values;
+
+    std::vector<uint64_t> buf(1 + fds.size());
+    const ssize_t want = static_cast<ssize_t>(buf.size() * sizeof(uint64_t));
+    if (read(fds[0], buf.data(), want) == want) {
+      for (size_t c = 0; c < fds.size() && c < buf[0]; ++c) {
+        values[events[c]] = buf[1 + c];
+      }
+    }
+#endif
+    return values;
+  }
+};
+
+thread_local ThreadCounters thread_counters;
+
+// events by their perf names
+bool parse_event(std::string const& name, Event& event)
+{
+#if defined(__linux__)
+  struct Named {
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+  };
+  const uint64_t read_miss = PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                             PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+  const uint64_t read_access = PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                               PERF_COUNT_HW_CACHE_RESULT_ACCESS << 16;
+  const Named named[] = {
+      {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {"cache-references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+      {"cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      {"branches", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+      {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+      {"L1-dcache-load-misses", PERF_TYPE_HW_CACHE,
+       PERF_COUNT_HW_CACHE_L1D | read_miss},
+      {"LLC-loads", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | read_access},
+      {"LLC-load-misses", PERF_TYPE_HW_CACHE,
+       PERF_COUNT_HW_CACHE_LL | read_miss},
+      {"dTLB-load-misses", PERF_TYPE_HW_CACHE,
+       PERF_COUNT_HW_CACHE_DTLB | read_miss}};
+
+  for (Named const& n : named) {
+    if (name == n.name) {
+      event = Event{name, n.type, n.config};
+      return true;
+    }
+  }
+
+  if (name.size() > 1 && name[0] == 'r') {
+    char* end = nullptr;
+    const uint64_t config = std::strtoull(name.c_str() + 1, &end, 16);
+    if (end != nullptr && *end == '\0') {
+      event = Event{name, PERF_TYPE_RAW, config};
+      return true;
+    }
+  }
+#else
+  RAJA_UNUSED_VAR(name);
+  RAJA_UNUSED_VAR(event);
+#endif
+  return false;
+}
+
+// quote a field for CSV, doubling the quotes in it
+std::string csv(const std::string& s)
+{
+  std::string result("\"");
+  for (char c : s) {
+    if (c == '"') result += '"';
+    result += c;
+  }
+  return result + "\"";
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+CounterPlugin::CounterPlugin()
+{
+  char* file = getenv("RAJA_COUNTERS_FILE");
+  m_file = (file != nullptr && *file != '\0') ? file : "raja-counters.csv";
+
+  char* env = getenv("RAJA_COUNTERS");
+  if (env == nullptr || *env == '\0') {
+    return;
+  }
+  configure(env);
+}
+
+void CounterPlugin::init(const RAJA::util::PluginOptions& p)
+{
+  const std::string prefix("counters=");
+  if (p.str.compare(0, prefix.size(), prefix) == 0) {
+    configure(p.str.substr(prefix.size()));
+  }
+}
+
+void CounterPlugin::configure(const std::string& events)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.clear();
+  m_aggregates.clear();
+  ++m_generation;
+
+  auto add = [&](std::string const& name) {
+    Event event;
+    if (parse_event(name, event)) {
+      m_events.push_back(event);
+    } else {
+      fprintf(stderr, "[CounterPlugin]: Unknown event %s\n", name.c_str());
+    }
+  };
+
+  std::stringstream ss(events);
+  for (std::string name; std::getline(ss, name, ',');) {
+    if (name == "default") {
+      for (const char* d :
+           {"cycles", "instructions", "cache-misses", "LLC-load-misses"}) {
+        add(d);
+      }
+    } else if (!name.empty()) {
+      add(name);
+    }
+  }
+  m_active = !m_events.empty();
+}
+
+void CounterPlugin::preLaunch(const RAJA::util::PluginContext& p)
+{
+  // device kernels run off the host thread, so only host ones are counted
+  if (!m_active || p.platform != Platform::host) return;
+
+  if (thread_counters.generation != m_generation) {
+    thread_counters.open_all(m_events, m_generation);
+  }
+
+  thread_counters.open.push_back(
+      Open{std::chrono::steady_clock::now(),
+           thread_counters.read_all(m_events.size())});
+}
+
+void CounterPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (!m_active || p.platform != Platform::host ||
+      thread_counters.open.empty()) {
+    return;
+  }
+
+  std::vector<uint64_t> values = thread_counters.read_all(m_events.size());
+  const auto stop = std::chrono::steady_clock::now();
+  Open const& open = thread_counters.open.back();
+
+  const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      stop - open.start).count();
+  for (size_t e = 0; e < values.size() && e < open.values.size(); ++e) {
+    values[e] -= open.values[e];
+  }
+  thread_counters.open.pop_back();
+
+  Key key{p.kernel_name ? p.kernel_name : "",
+          demangle(p.launch_site),
+          p.policy()};
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Aggregate& a = m_aggregates[key];
+  a.values.resize(values.size(), 0);
+  ++a.count;
+  a.num_iterations += p.num_iterations;
+  a.bytes += p.bytes;
+  a.flops += p.flops;
+  a.time_ns += ns;
+  for (size_t e = 0; e < values.size(); ++e) {
+    a.values[e] += values[e];
+  }
+}
+
+void CounterPlugin::finalize()
+{
+  if (!m_active) return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  write(m_file);
+}
+
+void CounterPlugin::write(const std::string& file) const
+{
+  std::ofstream out(file);
+  if (!out) {
+    perror("[CounterPlugin]: Could not open counter file");
+    return;
+  }
+
+  out << "kernel_name,launch_site,policy,count,iterations,bytes,flops,time_ns";
+  for (Event const& e : m_events) {
+    out << "," << e.name;
+  }
+  out << "\n";
+
+  for (auto const& entry : m_aggregates) {
+    Aggregate const& a = entry.second;
+    out << csv(std::get<0>(entry.first)) << ","
+        << csv(std::get<1>(entry.first)) << ","
+        << csv(std::get<2>(entry.first)) << ","
+        << a.count << "," << a.num_iterations << ","
+        << a.bytes << "," << a.flops << "," << a.time_ns;
+    for (uint64_t v : a.values) {
+      out << "," << v;
+    }
+    out << "\n";
+  }
+}
+
+void linkCounterPlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::CounterPlugin> P("CounterPlugin", "Count hardware events of RAJA loops and kernels.");
@@ -53,6 +53,12 @@ cudaInfo tl_status;
 //! State of raja cuda stream synchronization for cuda reducer objects
 std::unordered_map<cudaStream_t, bool> g_stream_info_map;
 
+//! Managed memory ranges registered with a preferred location
+std::vector<ManagedRange> g_managed_ranges;
+
+//! Number of registered ranges waiting to be prefetched
+std::atomic<size_t> g_num_pending_prefetches{0};
+
 
 }  // namespace detail
 
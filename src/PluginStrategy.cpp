@@ -12,7 +12,9 @@ RAJA_INSTANTIATE_REGISTRY(PluginRegistry);
 namespace RAJA {
 namespace util {
 
-PluginStrategy::PluginStrategy() = default;
+bool plugins_registered = false;
+
+PluginStrategy::PluginStrategy() { plugins_registered = true; }
 
 void PluginStrategy::init(const PluginOptions&) { }
 
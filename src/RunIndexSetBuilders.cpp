@@ -0,0 +1,172 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the index set builder that splits an index
+ *          array into runs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+namespace
+{
+
+//
+// Positions in indices_in where a run of consecutive indices starts, found
+// by each thread for its block of the array and then compacted in order.
+//
+std::vector<RAJA::Index_type> findRunStarts(
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length)
+{
+  std::vector<RAJA::Index_type> starts;
+
+#if defined(RAJA_ENABLE_OPENMP)
+  std::vector<RAJA::Index_type> counts(omp_get_max_threads() + 1, 0);
+
+#pragma omp parallel
+  {
+    const int t = omp_get_thread_num();
+    const int nt = omp_get_num_threads();
+    const RAJA::Index_type lo = (length * t) / nt;
+    const RAJA::Index_type hi = (length * (t + 1)) / nt;
+
+    RAJA::Index_type count = 0;
+    for (RAJA::Index_type i = lo; i < hi; ++i) {
+      if (i == 0 || indices_in[i] != indices_in[i - 1] + 1) ++count;
+    }
+    counts[t + 1] = count;
+
+#pragma omp barrier
+#pragma omp single
+    {
+      for (int s = 0; s < nt; ++s) {
+        counts[s + 1] += counts[s];
+      }
+      starts.resize(counts[nt]);
+    }
+
+    RAJA::Index_type pos = counts[t];
+    for (RAJA::Index_type i = lo; i < hi; ++i) {
+      if (i == 0 || indices_in[i] != indices_in[i - 1] + 1) {
+        starts[pos++] = i;
+      }
+    }
+  }
+#else
+  for (RAJA::Index_type i = 0; i < length; ++i) {
+    if (i == 0 || indices_in[i] != indices_in[i - 1] + 1) {
+      starts.push_back(i);
+    }
+  }
+#endif
+
+  return starts;
+}
+
+}  // namespace
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with Range segments for the runs of consecutive
+ * indices and List segments for the indices between them.
+ *
+ ******************************************************************************
+ */
+void buildIndexSetRuns(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length,
+    RAJA::Index_type range_align)
+{
+  if (length <= 0) return;
+
+  if (range_align < 1) range_align = 1;
+  if (range_min_length < 1) range_min_length = 1;
+
+  const std::vector<RAJA::Index_type> run_starts =
+      findRunStarts(indices_in, length);
+  const RAJA::Index_type num_runs =
+      static_cast<RAJA::Index_type>(run_starts.size());
+
+  //
+  // Position where the range of each run begins, the values before it that
+  // are not aligned go to the list before the range. Runs without a range
+  // begin their range at their end.
+  //
+  std::vector<RAJA::Index_type> range_starts(num_runs);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (RAJA::Index_type r = 0; r < num_runs; ++r) {
+    const RAJA::Index_type begin = run_starts[r];
+    const RAJA::Index_type end = (r + 1 < num_runs) ? run_starts[r + 1]
+                                                    : length;
+    const RAJA::Index_type rem =
+        ((indices_in[begin] % range_align) + range_align) % range_align;
+    const RAJA::Index_type head = (range_align - rem) % range_align;
+
+    range_starts[r] =
+        (end - begin - head >= range_min_length) ? begin + head : end;
+  }
+
+  //
+  // Emit the segments in the order of the input, the values between two
+  // ranges are contiguous in the input array and make one list.
+  //
+  RAJA::Index_type list_begin = 0;
+  for (RAJA::Index_type r = 0; r < num_runs; ++r) {
+    const RAJA::Index_type end = (r + 1 < num_runs) ? run_starts[r + 1]
+                                                    : length;
+    const RAJA::Index_type range_begin = range_starts[r];
+    if (range_begin == end) continue;
+
+    if (range_begin > list_begin) {
+      iset.push_back(ListSegment(&indices_in[list_begin],
+                                 range_begin - list_begin,
+                                 work_res));
+    }
+    iset.push_back(RangeSegment(indices_in[range_begin],
+                                indices_in[range_begin] + end - range_begin));
+    list_begin = end;
+  }
+
+  if (length > list_begin) {
+    iset.push_back(ListSegment(&indices_in[list_begin],
+                               length - list_begin,
+                               work_res));
+  }
+}
+
+}  // namespace RAJA
@@ -7,9 +7,21 @@
 
 #include "RAJA/util/RuntimePluginLoader.hpp"
 
+#include "RAJA/config.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
 #ifndef _WIN32
 #include <dlfcn.h>
 #include <dirent.h>
+#include <unistd.h>
+#endif
+
+#if defined(RAJA_ENABLE_MPI)
+#include <mpi.h>
 #endif
 
 RAJA_INLINE
@@ -19,6 +31,66 @@ isSharedObject(const std::string& filename)
   return (filename.size() > 3 && !filename.compare(filename.size() - 3, 3, ".so"));
 }
 
+static
+bool
+envFlag(const char* name)
+{
+  char *env = ::getenv(name);
+  return nullptr != env && std::strcmp(env, "0") != 0;
+}
+
+// Read the plugin paths of a manifest, one per line.
+static
+bool
+readManifest(const std::string& manifest, std::vector<std::string>& paths)
+{
+  std::ifstream in(manifest);
+  if (!in)
+  {
+    return false;
+  }
+  std::string line;
+  while (std::getline(in, line))
+  {
+    if (!line.empty())
+    {
+      paths.push_back(line);
+    }
+  }
+  return true;
+}
+
+// Write the manifest to a temporary file and rename it into place, so a
+// process reading it never sees part of it.
+static
+void
+writeManifest(const std::string& manifest, const std::vector<std::string>& paths)
+{
+  #ifndef _WIN32
+  const std::string tmp = manifest + ".tmp." + std::to_string(::getpid());
+  {
+    std::ofstream out(tmp);
+    if (!out)
+    {
+      printf("[RuntimePluginLoader]: could not write manifest %s\n", manifest.c_str());
+      return;
+    }
+    for (auto const& path : paths)
+    {
+      out << path << '\n';
+    }
+  }
+  if (std::rename(tmp.c_str(), manifest.c_str()) != 0)
+  {
+    perror("[RuntimePluginLoader]: Could not rename plugin manifest");
+    std::remove(tmp.c_str());
+  }
+  #else
+  RAJA_UNUSED_ARG(manifest);
+  RAJA_UNUSED_ARG(paths);
+  #endif
+}
+
 namespace RAJA {
 namespace util {
   
@@ -29,11 +101,90 @@ RuntimePluginLoader::RuntimePluginLoader()
   {
     return;
   }
-  initDirectory(std::string(env));
+  env_path = env;
+  if (envFlag("RAJA_PLUGINS_EAGER"))
+  {
+    loadPlugins();
+  }
+}
+
+// Load the plugins of RAJA_PLUGINS, once, from the manifest if there is
+// one, and with MPI from the list found on rank 0.
+void RuntimePluginLoader::loadPlugins()
+{
+  std::call_once(env_loaded, [this]() {
+    if (env_path.empty())
+    {
+      return;
+    }
+
+    char *env = ::getenv("RAJA_PLUGINS_MANIFEST");
+    const std::string manifest = (nullptr == env) ? "" : env;
+
+    bool root = true;
+#if defined(RAJA_ENABLE_MPI)
+    int mpi_init = 0;
+    int mpi_final = 0;
+    MPI_Initialized(&mpi_init);
+    MPI_Finalized(&mpi_final);
+    const bool broadcast =
+        mpi_init && !mpi_final && envFlag("RAJA_PLUGINS_BROADCAST");
+    if (broadcast)
+    {
+      int rank = 0;
+      MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+      root = (rank == 0);
+    }
+#endif
+
+    std::vector<std::string> paths;
+    if (root)
+    {
+      if (manifest.empty() || !readManifest(manifest, paths))
+      {
+        findPlugins(env_path, paths);
+        if (!manifest.empty())
+        {
+          writeManifest(manifest, paths);
+        }
+      }
+    }
+
+#if defined(RAJA_ENABLE_MPI)
+    if (broadcast)
+    {
+      std::string joined;
+      for (auto const& path : paths)
+      {
+        joined += path + '\n';
+      }
+      unsigned long len = joined.size();
+      MPI_Bcast(&len, 1, MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
+      joined.resize(len);
+      MPI_Bcast(&joined[0], static_cast<int>(len), MPI_CHAR, 0, MPI_COMM_WORLD);
+
+      if (!root)
+      {
+        size_t begin = 0;
+        for (size_t end = joined.find('\n'); end != std::string::npos;
+             begin = end + 1, end = joined.find('\n', begin))
+        {
+          paths.push_back(joined.substr(begin, end - begin));
+        }
+      }
+    }
+#endif
+
+    for (auto const& path : paths)
+    {
+      initPlugin(path);
+    }
+  });
 }
 
 void RuntimePluginLoader::init(const RAJA::util::PluginOptions& p)
 {
+  loadPlugins();
   initDirectory(p.str);
   for (auto &plugin : plugins)
   {
@@ -43,6 +194,7 @@ void RuntimePluginLoader::init(const RAJA::util::PluginOptions& p)
 
 void RuntimePluginLoader::preCapture(const RAJA::util::PluginContext& p)
 {
+  loadPlugins();
   for (auto &plugin : plugins)
   {
     plugin->preCapture(p);
@@ -51,6 +203,7 @@ void RuntimePluginLoader::preCapture(const RAJA::util::PluginContext& p)
 
 void RuntimePluginLoader::postCapture(const RAJA::util::PluginContext& p)
 {
+  loadPlugins();
   for (auto &plugin : plugins)
   {
     plugin->postCapture(p);
@@ -59,6 +212,7 @@ void RuntimePluginLoader::postCapture(const RAJA::util::PluginContext& p)
 
 void RuntimePluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 {
+  loadPlugins();
   for (auto &plugin : plugins)
   {
     plugin->preLaunch(p);
@@ -67,6 +221,7 @@ void RuntimePluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 
 void RuntimePluginLoader::postLaunch(const RAJA::util::PluginContext& p)
 {
+  loadPlugins();
   for (auto &plugin : plugins)
   {
     plugin->postLaunch(p);
@@ -75,6 +230,9 @@ void RuntimePluginLoader::postLaunch(const RAJA::util::PluginContext& p)
 
 void RuntimePluginLoader::finalize()
 {
+  // plugins that were never loaded are not loaded to be finalized, and are
+  // not loaded by hooks after finalize, which may be after MPI_Finalize
+  std::call_once(env_loaded, []() {});
   for (auto &plugin : plugins)
   {
     plugin->finalize();
@@ -86,10 +244,16 @@ void RuntimePluginLoader::finalize()
 void RuntimePluginLoader::initPlugin(const std::string &path)
 {
   #ifndef _WIN32
+  if (!loaded_paths.insert(path).second)
+  {
+    return;
+  }
+
   void *plugin = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
   if (!plugin)
   {
     printf("[RuntimePluginLoader]: dlopen failed: %s\n", dlerror());
+    return;
   }
 
   RuntimePluginLoader::Parent *(*getPlugin)() = (RuntimePluginLoader::Parent * (*)()) dlsym(plugin, "getPlugin");
@@ -109,11 +273,24 @@ void RuntimePluginLoader::initPlugin(const std::string &path)
 
 // Initialize all plugins in a directory specified by 'path'.
 void RuntimePluginLoader::initDirectory(const std::string &path)
+{
+  std::vector<std::string> paths;
+  findPlugins(path, paths);
+  for (auto const& plugin : paths)
+  {
+    initPlugin(plugin);
+  }
+}
+
+// Append the shared object 'path', or the shared objects in the directory
+// 'path', to 'paths'.
+void RuntimePluginLoader::findPlugins(const std::string &path,
+                                      std::vector<std::string> &paths)
 {
   #ifndef _WIN32
   if (isSharedObject(path))
   {
-    initPlugin(path);
+    paths.push_back(path);
     return;
   }
   
@@ -126,7 +303,7 @@ void RuntimePluginLoader::initDirectory(const std::string &path)
     {
       if (isSharedObject(std::string(file->d_name)))
       {
-        initPlugin(path + "/" + file->d_name);
+        paths.push_back(path + "/" + file->d_name);
       }
     }
     closedir(dir);
@@ -137,6 +314,7 @@ void RuntimePluginLoader::initDirectory(const std::string &path)
   }
   #else
   RAJA_UNUSED_ARG(path);
+  RAJA_UNUSED_ARG(paths);
   #endif
 }
 
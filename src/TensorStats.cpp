@@ -6,128 +6,226 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "RAJA/pattern/tensor/stats.hpp"
-#include <stdio.h>
-
-int RAJA::tensor_stats::indent = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_copy = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_copy_ctor = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_broadcast_ctor = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_load_packed = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_packed_n = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_strided = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_strided_n = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_store_packed = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_packed_n = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_strided = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_strided_n = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_broadcast = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_get = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_set = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_add = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_subtract = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_multiply = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_divide = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_fma = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_fms = 0;
-
-camp::idx_t RAJA::tensor_stats::num_vector_sum = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_max = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_min = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_vmax = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_vmin = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_dot = 0;
-
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_mult_row_row = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_multacc_row_row = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_mult_col_col = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_multacc_col_col = 0;
-
-void RAJA::tensor_stats::resetVectorStats(){
-  num_vector_copy = 0;
-  num_vector_copy_ctor = 0;
-  num_vector_broadcast_ctor = 0;
-
-  num_vector_load_packed = 0;
-  num_vector_load_packed_n = 0;
-  num_vector_load_strided = 0;
-  num_vector_load_strided_n = 0;
-  num_vector_store_packed = 0;
-  num_vector_store_packed_n = 0;
-  num_vector_store_strided = 0;
-  num_vector_store_strided_n = 0;
-
-  num_vector_broadcast = 0;
-
-  num_vector_get = 0;
-  num_vector_set = 0;
-
-  num_vector_add = 0;
-  num_vector_subtract = 0;
-  num_vector_multiply = 0;
-  num_vector_divide = 0;
-
-  num_vector_fma = 0;
-  num_vector_fms = 0;
-  num_vector_sum = 0;
-  num_vector_max = 0;
-  num_vector_min = 0;
-  num_vector_vmax = 0;
-  num_vector_vmin = 0;
-  num_vector_dot = 0;
-
-  num_matrix_mm_mult_row_row = 0;
-  num_matrix_mm_multacc_row_row = 0;
-  num_matrix_mm_mult_col_col = 0;
-  num_matrix_mm_multacc_col_col = 0;
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace RAJA
+{
+namespace expt
+{
+namespace tensor_stats
+{
+
+namespace
+{
+
+struct registry
+{
+  std::mutex mutex;
+  std::vector<detail::thread_counters *> threads;
+  counts retired;
+  std::vector<std::pair<std::string, counts>> kernels;
+};
+
+registry &get_registry()
+{
+  static registry r;
+  return r;
 }
 
-#define PRINT_STAT(STAT) if(STAT){printf("  %-32s   %ld\n", #STAT, STAT);}
+const char *const s_counter_names[num_counters] = {
+#define RAJA_TENSOR_STATS_NAME(NAME) #NAME,
+    RAJA_TENSOR_STATS_COUNTERS(RAJA_TENSOR_STATS_NAME)
+#undef RAJA_TENSOR_STATS_NAME
+};
 
-void RAJA::tensor_stats::printVectorStats(){
+camp::idx_t percent(camp::idx_t part, camp::idx_t whole)
+{
+  return whole ? (100 * part) / whole : 0;
+}
 
-  printf("RAJA SIMD Register Statistics:\n");
+}  // namespace
 
-  PRINT_STAT(num_vector_copy);
-  PRINT_STAT(num_vector_copy_ctor);
-  PRINT_STAT(num_vector_broadcast_ctor);
 
-  PRINT_STAT(num_vector_load_packed);
-  PRINT_STAT(num_vector_load_packed_n);
-  PRINT_STAT(num_vector_load_strided);
-  PRINT_STAT(num_vector_load_strided_n);
-  PRINT_STAT(num_vector_store_packed);
-  PRINT_STAT(num_vector_store_packed_n);
-  PRINT_STAT(num_vector_store_strided);
-  PRINT_STAT(num_vector_store_strided_n);
+detail::thread_counters::thread_counters()
+{
+  for (int c = 0; c < num_counters; ++c) {
+    value[c].store(0, std::memory_order_relaxed);
+  }
+  registry &r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.threads.push_back(this);
+}
 
-  PRINT_STAT(num_vector_broadcast);
-  PRINT_STAT(num_vector_get);
-  PRINT_STAT(num_vector_set);
+detail::thread_counters::~thread_counters()
+{
+  registry &r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (int c = 0; c < num_counters; ++c) {
+    r.retired[c] += value[c].load(std::memory_order_relaxed);
+  }
+  r.threads.erase(std::remove(r.threads.begin(), r.threads.end(), this),
+                  r.threads.end());
+}
 
-  PRINT_STAT(num_vector_add);
-  PRINT_STAT(num_vector_subtract);
-  PRINT_STAT(num_vector_multiply);
-  PRINT_STAT(num_vector_divide);
 
-  PRINT_STAT(num_vector_fma);
-  PRINT_STAT(num_vector_fms);
-  PRINT_STAT(num_vector_sum);
-  PRINT_STAT(num_vector_max);
-  PRINT_STAT(num_vector_min);
-  PRINT_STAT(num_vector_vmax);
-  PRINT_STAT(num_vector_vmin);
-  PRINT_STAT(num_vector_dot);
+const char *counter_name(int c)
+{
+  return (c >= 0 && c < num_counters) ? s_counter_names[c] : "unknown";
+}
+
+counts host_counts()
+{
+  registry &r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  counts total = r.retired;
+  for (detail::thread_counters *t : r.threads) {
+    for (int c = 0; c < num_counters; ++c) {
+      total[c] += t->value[c].load(std::memory_order_relaxed);
+    }
+  }
+  return total;
+}
+
+void reset_host_counts()
+{
+  registry &r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.retired = counts();
+  for (detail::thread_counters *t : r.threads) {
+    for (int c = 0; c < num_counters; ++c) {
+      t->value[c].store(0, std::memory_order_relaxed);
+    }
+  }
+}
 
-  PRINT_STAT(num_matrix_mm_mult_row_row);
-  PRINT_STAT(num_matrix_mm_multacc_row_row);
-  PRINT_STAT(num_matrix_mm_mult_col_col);
-  PRINT_STAT(num_matrix_mm_multacc_col_col);
 
+void print(counts const &c, const char *kernel_name, FILE *out)
+{
+  if (kernel_name) {
+    fprintf(out, "RAJA SIMD Register Statistics for %s:\n", kernel_name);
+  } else {
+    fprintf(out, "RAJA SIMD Register Statistics:\n");
+  }
+
+  for (int i = 0; i < num_counters; ++i) {
+    if (c[i]) {
+      fprintf(out, "  %-32s   %ld\n", s_counter_names[i], (long)c[i]);
+    }
+  }
+
+  // how many loads and stores missed the packed full fast path
+  camp::idx_t vec_loads = c[num_vector_load_packed] +
+                          c[num_vector_load_packed_n] +
+                          c[num_vector_load_strided] +
+                          c[num_vector_load_strided_n] +
+                          c[num_vector_gather] + c[num_vector_gather_n];
+  camp::idx_t vec_stores = c[num_vector_store_packed] +
+                           c[num_vector_store_packed_n] +
+                           c[num_vector_store_strided] +
+                           c[num_vector_store_strided_n] +
+                           c[num_vector_scatter] + c[num_vector_scatter_n];
+  camp::idx_t mat_loads = c[num_matrix_load_packed] +
+                          c[num_matrix_load_packed_nm] +
+                          c[num_matrix_load_strided] +
+                          c[num_matrix_load_strided_nm];
+  camp::idx_t mat_stores = c[num_matrix_store_packed] +
+                           c[num_matrix_store_packed_nm] +
+                           c[num_matrix_store_strided] +
+                           c[num_matrix_store_strided_nm];
+
+  if (vec_loads) {
+    fprintf(out,
+            "  vector loads:   %ld, %ld%% strided, %ld%% partial, %ld%% "
+            "gather\n",
+            (long)vec_loads,
+            (long)percent(c[num_vector_load_strided] +
+                              c[num_vector_load_strided_n],
+                          vec_loads),
+            (long)percent(c[num_vector_load_packed_n] +
+                              c[num_vector_load_strided_n] +
+                              c[num_vector_gather_n],
+                          vec_loads),
+            (long)percent(c[num_vector_gather] + c[num_vector_gather_n],
+                          vec_loads));
+  }
+  if (vec_stores) {
+    fprintf(out,
+            "  vector stores:  %ld, %ld%% strided, %ld%% partial, %ld%% "
+            "scatter\n",
+            (long)vec_stores,
+            (long)percent(c[num_vector_store_strided] +
+                              c[num_vector_store_strided_n],
+                          vec_stores),
+            (long)percent(c[num_vector_store_packed_n] +
+                              c[num_vector_store_strided_n] +
+                              c[num_vector_scatter_n],
+                          vec_stores),
+            (long)percent(c[num_vector_scatter] + c[num_vector_scatter_n],
+                          vec_stores));
+  }
+  if (mat_loads) {
+    fprintf(out,
+            "  matrix loads:   %ld, %ld%% strided, %ld%% partial\n",
+            (long)mat_loads,
+            (long)percent(c[num_matrix_load_strided] +
+                              c[num_matrix_load_strided_nm],
+                          mat_loads),
+            (long)percent(c[num_matrix_load_packed_nm] +
+                              c[num_matrix_load_strided_nm],
+                          mat_loads));
+  }
+  if (mat_stores) {
+    fprintf(out,
+            "  matrix stores:  %ld, %ld%% strided, %ld%% partial\n",
+            (long)mat_stores,
+            (long)percent(c[num_matrix_store_strided] +
+                              c[num_matrix_store_strided_nm],
+                          mat_stores),
+            (long)percent(c[num_matrix_store_packed_nm] +
+                              c[num_matrix_store_strided_nm],
+                          mat_stores));
+  }
 }
+
+
+void record_kernel(const char *kernel_name, counts const &c)
+{
+  registry &r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (auto &k : r.kernels) {
+    if (k.first == kernel_name) {
+      k.second += c;
+      return;
+    }
+  }
+  r.kernels.emplace_back(kernel_name, c);
+}
+
+void print_kernel_report(FILE *out)
+{
+  std::vector<std::pair<std::string, counts>> kernels;
+  {
+    registry &r = get_registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    kernels = r.kernels;
+  }
+  for (auto const &k : kernels) {
+    print(k.second, k.first.c_str(), out);
+  }
+}
+
+void reset_kernel_report()
+{
+  registry &r = get_registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.kernels.clear();
+}
+
+}  // namespace tensor_stats
+}  // namespace expt
+}  // namespace RAJA
@@ -0,0 +1,134 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the kernel tile size tuning cache.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "RAJA/pattern/kernel/TileTuner.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+TileTuningCache::TileTuningCache(int trials)
+    : m_trials(trials > 0 ? trials : 1)
+{
+}
+
+const std::vector<camp::idx_t>* TileTuningCache::find(
+    std::string const& key) const
+{
+  auto it = m_chosen.find(key);
+  return it == m_chosen.end() ? nullptr : &it->second;
+}
+
+int TileTuningCache::nextTrial(std::string const& key, int num_candidates)
+{
+  auto it = m_tuning.find(key);
+  if (it == m_tuning.end() || num_candidates <= 0) {
+    return 0;
+  }
+  return it->second.runs % num_candidates;
+}
+
+void TileTuningCache::recordTrial(std::string const& key,
+                                  int num_candidates,
+                                  std::vector<camp::idx_t> const& sizes,
+                                  double seconds)
+{
+  auto it = m_tuning.find(key);
+  if (it == m_tuning.end()) {
+    it = m_tuning.emplace(key, Trials{0, seconds, sizes}).first;
+  }
+
+  Trials& t = it->second;
+  if (seconds < t.best_seconds) {
+    t.best_seconds = seconds;
+    t.best_sizes = sizes;
+  }
+  ++t.runs;
+
+  if (t.runs >= num_candidates * m_trials) {
+    m_chosen[key] = t.best_sizes;
+    m_tuning.erase(it);
+  }
+}
+
+void TileTuningCache::insert(std::string const& key,
+                             std::vector<camp::idx_t> const& sizes)
+{
+  m_chosen[key] = sizes;
+  m_tuning.erase(key);
+}
+
+bool TileTuningCache::load(std::string const& filename)
+{
+  std::ifstream in(filename);
+  if (!in) {
+    return false;
+  }
+
+  // one key per line, quoted, followed by its tile sizes
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream is(line);
+    std::string key;
+    if (!(is >> std::quoted(key))) {
+      continue;
+    }
+    std::vector<camp::idx_t> sizes;
+    camp::idx_t size;
+    while (is >> size) {
+      sizes.push_back(size);
+    }
+    if (!sizes.empty()) {
+      insert(key, sizes);
+    }
+  }
+  return true;
+}
+
+bool TileTuningCache::save(std::string const& filename) const
+{
+  std::ofstream out(filename);
+  if (!out) {
+    return false;
+  }
+
+  for (auto const& entry : m_chosen) {
+    out << std::quoted(entry.first);
+    for (camp::idx_t size : entry.second) {
+      out << ' ' << size;
+    }
+    out << '\n';
+  }
+  return static_cast<bool>(out);
+}
+
+void TileTuningCache::clear()
+{
+  m_chosen.clear();
+  m_tuning.clear();
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
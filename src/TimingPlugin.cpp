@@ -0,0 +1,379 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/TimingPlugin.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#if defined(RAJA_ENABLE_CUDA)
+#include <cuda_runtime.h>
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include <hip/hip_runtime.h>
+#endif
+
+namespace {
+
+// launches of each thread that are between preLaunch and postLaunch, nested
+// launches are timed on their own
+thread_local std::vector<std::pair<std::chrono::steady_clock::time_point, int>>
+    open_launches;
+
+// quote a field for CSV, doubling the quotes in it
+std::string csv(const std::string& s)
+{
+  std::string result("\"");
+  for (char c : s) {
+    if (c == '"') result += '"';
+    result += c;
+  }
+  return result + "\"";
+}
+
+// quote a string for JSON
+std::string json(const std::string& s)
+{
+  std::string result("\"");
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+      result += buf;
+    } else {
+      result += c;
+    }
+  }
+  return result + "\"";
+}
+
+const char* platform_name(RAJA::Platform p)
+{
+  switch (p) {
+    case RAJA::Platform::host: return "host";
+    case RAJA::Platform::cuda: return "cuda";
+    case RAJA::Platform::omp_target: return "omp_target";
+    case RAJA::Platform::hip: return "hip";
+    case RAJA::Platform::sycl: return "sycl";
+    default: return "undefined";
+  }
+}
+
+int bucket(int64_t ns, int num_buckets)
+{
+  int b = 0;
+  while (ns > 1 && b < num_buckets - 1) {
+    ns >>= 1;
+    ++b;
+  }
+  return b;
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+constexpr size_t TimingPlugin::ring_size;
+constexpr int TimingPlugin::num_buckets;
+
+TimingPlugin::TimingPlugin()
+{
+  char* env = getenv("RAJA_TIMING_FILE");
+  if (env == nullptr || *env == '\0') {
+    return;
+  }
+  m_active = true;
+  m_file = env;
+  m_ring.reserve(ring_size);
+}
+
+TimingPlugin::~TimingPlugin()
+{
+#if defined(RAJA_ENABLE_CUDA)
+  for (size_t e = 0; e < m_events.size(); e += 2) {
+    cudaEventDestroy(static_cast<cudaEvent_t>(m_events[e]));
+    cudaEventDestroy(static_cast<cudaEvent_t>(m_events[e + 1]));
+  }
+#elif defined(RAJA_ENABLE_HIP)
+  for (size_t e = 0; e < m_events.size(); e += 2) {
+    hipEventDestroy(static_cast<hipEvent_t>(m_events[e]));
+    hipEventDestroy(static_cast<hipEvent_t>(m_events[e + 1]));
+  }
+#endif
+}
+
+void TimingPlugin::preLaunch(const RAJA::util::PluginContext& p)
+{
+  if (!m_active) return;
+
+  const int event = startEvent(p);
+  open_launches.emplace_back(clock::now(), event);
+}
+
+void TimingPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (!m_active || open_launches.empty()) return;
+
+  const auto stop = clock::now();
+  const auto open = open_launches.back();
+  open_launches.pop_back();
+
+  stopEvent(p, open.second);
+
+  Record record{p.kernel_name,
+                p.launch_site,
+                p.policy_name,
+                p.platform,
+                p.num_iterations,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    stop - open.first).count(),
+                open.second};
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_ring.size() == ring_size) {
+    flush();
+  }
+  m_ring.push_back(record);
+}
+
+void TimingPlugin::finalize()
+{
+  if (!m_active) return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  flush();
+  write(m_file);
+}
+
+int TimingPlugin::startEvent(const RAJA::util::PluginContext& p)
+{
+  if (!p.has_resource()) return -1;
+
+#if defined(RAJA_ENABLE_CUDA)
+  if (p.platform == Platform::cuda) {
+    auto res = p.get_resource();
+    auto* cuda = res.try_get<resources::Cuda>();
+    if (cuda == nullptr) return -1;
+
+    int event;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_next_event == ring_size) {
+        flush();
+      }
+      event = static_cast<int>(m_next_event++);
+      if (m_events.size() <= 2 * static_cast<size_t>(event)) {
+        cudaEvent_t start, stop;
+        cudaEventCreate(&start);
+        cudaEventCreate(&stop);
+        m_events.push_back(start);
+        m_events.push_back(stop);
+      }
+    }
+    cudaEventRecord(static_cast<cudaEvent_t>(m_events[2 * event]),
+                    cuda->get_stream());
+    return event;
+  }
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+  if (p.platform == Platform::hip) {
+    auto res = p.get_resource();
+    auto* hip = res.try_get<resources::Hip>();
+    if (hip == nullptr) return -1;
+
+    int event;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_next_event == ring_size) {
+        flush();
+      }
+      event = static_cast<int>(m_next_event++);
+      if (m_events.size() <= 2 * static_cast<size_t>(event)) {
+        hipEvent_t start, stop;
+        hipEventCreate(&start);
+        hipEventCreate(&stop);
+        m_events.push_back(start);
+        m_events.push_back(stop);
+      }
+    }
+    hipEventRecord(static_cast<hipEvent_t>(m_events[2 * event]),
+                   hip->get_stream());
+    return event;
+  }
+#endif
+
+  return -1;
+}
+
+void TimingPlugin::stopEvent(const RAJA::util::PluginContext& p, int event)
+{
+  if (event < 0) return;
+
+#if defined(RAJA_ENABLE_CUDA)
+  if (p.platform == Platform::cuda) {
+    auto res = p.get_resource();
+    cudaEventRecord(static_cast<cudaEvent_t>(m_events[2 * event + 1]),
+                    res.get<resources::Cuda>().get_stream());
+  }
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+  if (p.platform == Platform::hip) {
+    auto res = p.get_resource();
+    hipEventRecord(static_cast<hipEvent_t>(m_events[2 * event + 1]),
+                   res.get<resources::Hip>().get_stream());
+  }
+#endif
+
+  RAJA_UNUSED_VAR(p);
+}
+
+double TimingPlugin::eventMilliseconds(int event)
+{
+  float ms = 0.0f;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaEventSynchronize(static_cast<cudaEvent_t>(m_events[2 * event + 1]));
+  cudaEventElapsedTime(&ms,
+                       static_cast<cudaEvent_t>(m_events[2 * event]),
+                       static_cast<cudaEvent_t>(m_events[2 * event + 1]));
+#elif defined(RAJA_ENABLE_HIP)
+  hipEventSynchronize(static_cast<hipEvent_t>(m_events[2 * event + 1]));
+  hipEventElapsedTime(&ms,
+                      static_cast<hipEvent_t>(m_events[2 * event]),
+                      static_cast<hipEvent_t>(m_events[2 * event + 1]));
+#else
+  RAJA_UNUSED_VAR(event);
+#endif
+  return static_cast<double>(ms);
+}
+
+// called with m_mutex held, adds the records of the ring buffer to the
+// aggregates and reuses the events
+void TimingPlugin::flush()
+{
+  for (Record const& r : m_ring) {
+    Key key{r.kernel_name ? r.kernel_name : "",
+            demangle(r.launch_site),
+            demangle(r.policy_name)};
+    Aggregate& a = m_aggregates[key];
+
+    if (a.count == 0) {
+      a.platform = r.platform;
+      a.host_min = r.host_ns;
+      a.host_max = r.host_ns;
+    } else {
+      a.host_min = std::min(a.host_min, r.host_ns);
+      a.host_max = std::max(a.host_max, r.host_ns);
+    }
+    ++a.count;
+    a.num_iterations += r.num_iterations;
+    a.host_total += r.host_ns;
+    ++a.histogram[bucket(r.host_ns, num_buckets)];
+
+    if (r.event >= 0) {
+      const double ms = eventMilliseconds(r.event);
+      if (a.device_count == 0) {
+        a.device_min_ms = ms;
+        a.device_max_ms = ms;
+      } else {
+        a.device_min_ms = std::min(a.device_min_ms, ms);
+        a.device_max_ms = std::max(a.device_max_ms, ms);
+      }
+      ++a.device_count;
+      a.device_total_ms += ms;
+    }
+  }
+
+  m_ring.clear();
+  m_next_event = 0;
+}
+
+void TimingPlugin::write(const std::string& file) const
+{
+  std::ofstream out(file);
+  if (!out) {
+    perror("[TimingPlugin]: Could not open timing file");
+    return;
+  }
+
+  const bool as_json = file.size() > 5 &&
+                       !file.compare(file.size() - 5, 5, ".json");
+
+  if (as_json) {
+    out << "[\n";
+  } else {
+    out << "kernel_name,launch_site,policy,platform,count,iterations,"
+           "host_total_ns,host_min_ns,host_max_ns,device_count,"
+           "device_total_ms,device_min_ms,device_max_ms,histogram\n";
+  }
+
+  bool first = true;
+  for (auto const& entry : m_aggregates) {
+    Aggregate const& a = entry.second;
+
+    // histogram as bucket:count pairs of the buckets that are not empty
+    std::string histogram;
+    for (int b = 0; b < num_buckets; ++b) {
+      if (a.histogram[b] == 0) continue;
+      if (!histogram.empty()) histogram += as_json ? "," : " ";
+      if (as_json) {
+        histogram += "\"" + std::to_string(b) + "\":" +
+                     std::to_string(a.histogram[b]);
+      } else {
+        histogram += std::to_string(b) + ":" + std::to_string(a.histogram[b]);
+      }
+    }
+
+    if (as_json) {
+      out << (first ? "" : ",\n")
+          << "  {\"kernel_name\":" << json(std::get<0>(entry.first))
+          << ",\"launch_site\":" << json(std::get<1>(entry.first))
+          << ",\"policy\":" << json(std::get<2>(entry.first))
+          << ",\"platform\":\"" << platform_name(a.platform) << "\""
+          << ",\"count\":" << a.count
+          << ",\"iterations\":" << a.num_iterations
+          << ",\"host_total_ns\":" << a.host_total
+          << ",\"host_min_ns\":" << a.host_min
+          << ",\"host_max_ns\":" << a.host_max
+          << ",\"device_count\":" << a.device_count
+          << ",\"device_total_ms\":" << a.device_total_ms
+          << ",\"device_min_ms\":" << a.device_min_ms
+          << ",\"device_max_ms\":" << a.device_max_ms
+          << ",\"histogram\":{" << histogram << "}}";
+    } else {
+      out << csv(std::get<0>(entry.first)) << ","
+          << csv(std::get<1>(entry.first)) << ","
+          << csv(std::get<2>(entry.first)) << ","
+          << platform_name(a.platform) << ","
+          << a.count << "," << a.num_iterations << ","
+          << a.host_total << "," << a.host_min << "," << a.host_max << ","
+          << a.device_count << "," << a.device_total_ms << ","
+          << a.device_min_ms << "," << a.device_max_ms << ","
+          << histogram << "\n";
+    }
+    first = false;
+  }
+
+  if (as_json) {
+    out << "\n]\n";
+  }
+}
+
+void linkTimingPlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::TimingPlugin> P("TimingPlugin", "Time RAJA loops and kernels.");
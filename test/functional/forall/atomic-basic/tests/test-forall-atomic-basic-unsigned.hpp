@@ -87,6 +87,10 @@ void ForallAtomicBasicUnsignedTestImpl( IdxType seglimit )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   test_array[0] = (T)0;
   test_array[1] = (T)0;
 
@@ -107,6 +111,10 @@ void ForallAtomicBasicUnsignedTestImpl( IdxType seglimit )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   EXPECT_EQ((T)4, check_array[0]);
   EXPECT_EQ((T)13, check_array[1]);
 
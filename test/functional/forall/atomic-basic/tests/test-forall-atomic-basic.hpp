@@ -88,6 +88,10 @@ void ForallAtomicBasicTestImpl( IdxType seglimit )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   // use atomic add to reduce the array
   test_array[0] = (T)0;
   test_array[1] = (T)seglimit;
@@ -121,6 +125,10 @@ void ForallAtomicBasicTestImpl( IdxType seglimit )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   EXPECT_EQ((T)seglimit, check_array[0]);
   EXPECT_EQ((T)0, check_array[1]);
   EXPECT_EQ((T)0, check_array[2]);
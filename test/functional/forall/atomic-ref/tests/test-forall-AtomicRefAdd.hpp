@@ -105,6 +105,9 @@ void testAtomicRefAdd(RAJA::TypedRangeSegment<IdxType> seg,
 #if defined(RAJA_ENABLE_HIP)
   hipErrchk(hipDeviceSynchronize());
 #endif
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
 
   work_res.memcpy( hcount, count, sizeof(T) );
   work_res.memcpy( hlist, list, sizeof(T) * N );
@@ -118,6 +121,10 @@ void testAtomicRefAdd(RAJA::TypedRangeSegment<IdxType> seg,
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   EXPECT_EQ(countop.final, hcount[0]);
   for (IdxType i = 0; i < seg.size(); i++) {
     EXPECT_LE(countop.min, hlist[i]);
@@ -156,6 +163,10 @@ void ForallAtomicRefAddTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   testAtomicRefAdd<ExecPolicy, AtomicPolicy, IdxType, T, 
                      PreIncCountOp  >(seg, count, list, hit, hcount, hlist, hhit, work_res, N);
   testAtomicRefAdd<ExecPolicy, AtomicPolicy, IdxType, T, 
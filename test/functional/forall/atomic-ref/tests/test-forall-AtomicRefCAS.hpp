@@ -98,6 +98,9 @@ testAtomicRefCASOp(RAJA::TypedRangeSegment<IdxType> seg, T* count, T* list,
 #if defined(RAJA_ENABLE_HIP)
   hipErrchk(hipDeviceSynchronize());
 #endif
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
 
   work_res.memcpy( hcount, count, sizeof(T) );
   work_res.memcpy( hlist, list, sizeof(T) * N );
@@ -138,6 +141,10 @@ void ForallAtomicRefCASTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   testAtomicRefCASOp<ExecPolicy, AtomicPolicy, IdxType, T, 
                        CASOtherOp                  >(seg, count, list, hcount, hlist, work_res, N);
   testAtomicRefCASOp<ExecPolicy, AtomicPolicy, IdxType, T, 
@@ -100,6 +100,9 @@ testAtomicRefLoadStoreOp(RAJA::TypedRangeSegment<IdxType> seg, T* count, T* list
 #if defined(RAJA_ENABLE_HIP)
   hipErrchk(hipDeviceSynchronize());
 #endif
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
 
   work_res.memcpy( hcount, count, sizeof(T) );
   work_res.memcpy( hlist, list, sizeof(T) * N );
@@ -140,6 +143,10 @@ void ForallAtomicRefLoadStoreTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   testAtomicRefLoadStoreOp<ExecPolicy, AtomicPolicy, IdxType, T, 
                        LoadOtherOp     >(seg, count, list, hcount, hlist, work_res, N);
   testAtomicRefLoadStoreOp<ExecPolicy, AtomicPolicy, IdxType, T, 
@@ -160,6 +160,9 @@ testAtomicRefLogicalOp(RAJA::TypedRangeSegment<IdxType> seg, T* count, T* list,
 #if defined(RAJA_ENABLE_HIP)
   hipErrchk(hipDeviceSynchronize());
 #endif
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
 
   work_res.memcpy( hcount, count, sizeof(T) );
   work_res.memcpy( hlist, list, sizeof(T) * N );
@@ -200,6 +203,10 @@ void ForallAtomicRefLogicalTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   // Note: These integral tests require return type conditional overloading 
   //       of testAtomicRefLogicalOp
   testAtomicRefLogicalOp<ExecPolicy, AtomicPolicy, IdxType, T, 
@@ -100,6 +100,9 @@ testAtomicRefMinMaxOp(RAJA::TypedRangeSegment<IdxType> seg, T* count, T* list,
 #if defined(RAJA_ENABLE_HIP)
   hipErrchk(hipDeviceSynchronize());
 #endif
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
 
   work_res.memcpy( hcount, count, sizeof(T) );
   work_res.memcpy( hlist, list, sizeof(T) * N );
@@ -140,6 +143,10 @@ void ForallAtomicRefMinMaxTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   testAtomicRefMinMaxOp<ExecPolicy, AtomicPolicy, IdxType, T, 
                        MaxEqOtherOp   >(seg, count, list, hcount, hlist, work_res, N);
   testAtomicRefMinMaxOp<ExecPolicy, AtomicPolicy, IdxType, T, 
@@ -102,6 +102,9 @@ void testAtomicRefSub(RAJA::TypedRangeSegment<IdxType> seg,
 #if defined(RAJA_ENABLE_HIP)
   hipErrchk(hipDeviceSynchronize());
 #endif
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
 
   work_res.memcpy( hcount, count, sizeof(T) );
   work_res.memcpy( hlist, list, sizeof(T) * N );
@@ -145,6 +148,10 @@ void ForallAtomicRefSubTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   testAtomicRefSub<ExecPolicy, AtomicPolicy, IdxType, T, 
                      PreDecCountOp  >(seg, count, list, hit, hcount, hlist, hhit, work_res, N);
   testAtomicRefSub<ExecPolicy, AtomicPolicy, IdxType, T, 
@@ -47,6 +47,10 @@ void ForallAtomicOutOfBoundsMultiViewTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   // PASS_REGEX: Negative index while accessing array of pointers
 
   // use atomic add to reduce the array
@@ -73,6 +77,10 @@ void ForallAtomicOutOfBoundsMultiViewTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   work_res.deallocate( actualsource );
   work_res.deallocate( source );
   work_res.deallocate( actualdest );
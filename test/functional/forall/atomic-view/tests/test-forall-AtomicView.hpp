@@ -38,6 +38,10 @@ void ForallAtomicViewTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   RAJA::forall<RAJA::seq_exec>(seg,
                                [=](IdxType i) { hsource[i] = (T)1; });
 
@@ -70,6 +74,10 @@ void ForallAtomicViewTestImpl( IdxType N )
   hipErrchk(hipDeviceSynchronize());
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+  RAJA::synchronize<RAJA::sycl_synchronize>();
+#endif
+
   for (IdxType i = 0; i < N / 2; ++i) {
     EXPECT_EQ((T)2, check_array[i]);
   }
@@ -0,0 +1,154 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BASIC_REDUCEMULTI_HPP__
+#define __TEST_FORALL_BASIC_REDUCEMULTI_HPP__
+
+#include <cstdlib>
+#include <ctime>
+#include <numeric>
+#include <vector>
+
+template <typename IDX_TYPE, typename DATA_TYPE,
+          typename SEG_TYPE,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceMultiBasicTestImpl(const SEG_TYPE& seg,
+                                    const std::vector<IDX_TYPE>& seg_idx,
+                                    camp::resources::Resource working_res)
+{
+  IDX_TYPE data_len = seg_idx[seg_idx.size() - 1] + 1;
+  IDX_TYPE idx_len = static_cast<IDX_TYPE>( seg_idx.size() );
+
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+  const DATA_TYPE sum_init = 5;
+  const DATA_TYPE min_init = modval + 1;
+  const DATA_TYPE max_init = -1;
+
+  for (IDX_TYPE i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  DATA_TYPE ref_sum = sum_init;
+  DATA_TYPE ref_min = min_init;
+  DATA_TYPE ref_max = max_init;
+  int ref_count = 0;
+  for (IDX_TYPE i = 0; i < idx_len; ++i) {
+    ref_sum += test_array[ seg_idx[i] ];
+    ref_min = RAJA_MIN(test_array[ seg_idx[i] ], ref_min);
+    ref_max = RAJA_MAX(test_array[ seg_idx[i] ], ref_max);
+    ref_count += 1;
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * data_len);
+
+  using values_type =
+      RAJA::reduce::multi_value<RAJA::reduce::sum<DATA_TYPE>,
+                                RAJA::reduce::min<DATA_TYPE>,
+                                RAJA::reduce::max<DATA_TYPE>,
+                                RAJA::reduce::sum<int>>;
+
+  RAJA::ReduceMulti<REDUCE_POLICY, values_type> stats(
+      values_type(sum_init, min_init, max_init, 0));
+
+  RAJA::forall<EXEC_POLICY>(seg, [=] RAJA_HOST_DEVICE(IDX_TYPE idx) {
+    stats.reduce( working_array[idx], working_array[idx],
+                  working_array[idx], 1 );
+  });
+
+  ASSERT_EQ(static_cast<DATA_TYPE>(stats.template get<0>()), ref_sum);
+  ASSERT_EQ(static_cast<DATA_TYPE>(stats.template get<1>()), ref_min);
+  ASSERT_EQ(static_cast<DATA_TYPE>(stats.template get<2>()), ref_max);
+  ASSERT_EQ(stats.template get<3>(), ref_count);
+
+  stats.reset(values_type(0, min_init, max_init, 0));
+  ASSERT_EQ(static_cast<DATA_TYPE>(stats.template get<0>()), DATA_TYPE(0));
+  ASSERT_EQ(stats.template get<3>(), 0);
+
+  DATA_TYPE factor = 2;
+  RAJA::forall<EXEC_POLICY>(seg, [=] RAJA_HOST_DEVICE(IDX_TYPE idx) {
+    stats.reduce( working_array[idx] * factor, working_array[idx] * factor,
+                  working_array[idx] * factor, 1 );
+  });
+
+  ASSERT_EQ(static_cast<DATA_TYPE>(stats.template get<0>()),
+            (ref_sum - sum_init) * factor);
+  ASSERT_EQ(static_cast<DATA_TYPE>(stats.template get<1>()), ref_min * factor);
+  ASSERT_EQ(static_cast<DATA_TYPE>(stats.template get<2>()), ref_max * factor);
+  ASSERT_EQ(stats.template get<3>(), ref_count);
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+TYPED_TEST_SUITE_P(ForallReduceMultiBasicTest);
+template <typename T>
+class ForallReduceMultiBasicTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallReduceMultiBasicTest, ReduceMultiBasicForall)
+{
+  using IDX_TYPE      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<3>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::vector<IDX_TYPE> seg_idx;
+
+// Range segment tests
+  RAJA::TypedRangeSegment<IDX_TYPE> r1( 0, 28 );
+  RAJA::getIndices(seg_idx, r1);
+  ForallReduceMultiBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r1, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r2( 3, 642 );
+  RAJA::getIndices(seg_idx, r2);
+  ForallReduceMultiBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r2, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r3( 0, 2057 );
+  RAJA::getIndices(seg_idx, r3);
+  ForallReduceMultiBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r3, seg_idx, working_res);
+
+// Range-stride segment tests
+  seg_idx.clear();
+  RAJA::TypedRangeStrideSegment<IDX_TYPE> r4( 3, 1029, 3 );
+  RAJA::getIndices(seg_idx, r4);
+  ForallReduceMultiBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeStrideSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r4, seg_idx, working_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceMultiBasicTest,
+                            ReduceMultiBasicForall);
+
+#endif  // __TEST_FORALL_BASIC_REDUCEMULTI_HPP__
@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BASIC_REDUCESUMARRAY_HPP__
+#define __TEST_FORALL_BASIC_REDUCESUMARRAY_HPP__
+
+#include <cstdlib>
+#include <ctime>
+#include <numeric>
+#include <vector>
+
+template <typename IDX_TYPE, typename DATA_TYPE,
+          typename SEG_TYPE,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceSumArrayBasicTestImpl(const SEG_TYPE& seg,
+                                       const std::vector<IDX_TYPE>& seg_idx,
+                                       camp::resources::Resource working_res)
+{
+  constexpr size_t num_bins = 16;
+
+  IDX_TYPE data_len = seg_idx[seg_idx.size() - 1] + 1;
+  IDX_TYPE idx_len = static_cast<IDX_TYPE>( seg_idx.size() );
+
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+  const DATA_TYPE init_val = 5;
+
+  for (IDX_TYPE i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  std::vector<DATA_TYPE> ref_sums(num_bins, init_val);
+  for (IDX_TYPE i = 0; i < idx_len; ++i) {
+    IDX_TYPE idx = seg_idx[i];
+    ref_sums[idx % num_bins] += test_array[idx];
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * data_len);
+
+  RAJA::ReduceSumArray<REDUCE_POLICY, DATA_TYPE, num_bins> sums(init_val);
+
+  RAJA::forall<EXEC_POLICY>(seg, [=] RAJA_HOST_DEVICE(IDX_TYPE idx) {
+    sums.add(idx % num_bins, working_array[idx]);
+  });
+
+  for (size_t b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(static_cast<DATA_TYPE>(sums.get(b)), ref_sums[b]);
+  }
+
+  sums.reset(DATA_TYPE(0));
+  for (size_t b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(static_cast<DATA_TYPE>(sums.get(b)), DATA_TYPE(0));
+  }
+
+  DATA_TYPE factor = 2;
+  RAJA::forall<EXEC_POLICY>(seg, [=] RAJA_HOST_DEVICE(IDX_TYPE idx) {
+    sums.add(idx % num_bins, working_array[idx] * factor);
+  });
+
+  auto all_sums = sums.get();
+  for (size_t b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(static_cast<DATA_TYPE>(all_sums[b]),
+              (ref_sums[b] - init_val) * factor);
+  }
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+TYPED_TEST_SUITE_P(ForallReduceSumArrayBasicTest);
+template <typename T>
+class ForallReduceSumArrayBasicTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallReduceSumArrayBasicTest, ReduceSumArrayBasicForall)
+{
+  using IDX_TYPE      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<3>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::vector<IDX_TYPE> seg_idx;
+
+// Range segment tests
+  RAJA::TypedRangeSegment<IDX_TYPE> r1( 0, 28 );
+  RAJA::getIndices(seg_idx, r1);
+  ForallReduceSumArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                    RAJA::TypedRangeSegment<IDX_TYPE>,
+                                    EXEC_POLICY, REDUCE_POLICY>(
+                                      r1, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r2( 3, 642 );
+  RAJA::getIndices(seg_idx, r2);
+  ForallReduceSumArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                    RAJA::TypedRangeSegment<IDX_TYPE>,
+                                    EXEC_POLICY, REDUCE_POLICY>(
+                                      r2, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r3( 0, 2057 );
+  RAJA::getIndices(seg_idx, r3);
+  ForallReduceSumArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                    RAJA::TypedRangeSegment<IDX_TYPE>,
+                                    EXEC_POLICY, REDUCE_POLICY>(
+                                      r3, seg_idx, working_res);
+
+// Range-stride segment tests
+  seg_idx.clear();
+  RAJA::TypedRangeStrideSegment<IDX_TYPE> r4( 3, 1029, 3 );
+  RAJA::getIndices(seg_idx, r4);
+  ForallReduceSumArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                    RAJA::TypedRangeStrideSegment<IDX_TYPE>,
+                                    EXEC_POLICY, REDUCE_POLICY>(
+                                      r4, seg_idx, working_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceSumArrayBasicTest,
+                            ReduceSumArrayBasicForall);
+
+#endif  // __TEST_FORALL_BASIC_REDUCESUMARRAY_HPP__
@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BITMASKSEGMENT_HPP__
+#define __TEST_FORALL_BITMASKSEGMENT_HPP__
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+//
+// Set bit b of the mask when (b % period) < active, runs of set bits
+// separated by empty words for large periods.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallBitMaskSegmentTestImpl(RAJA::Index_type offset,
+                                  RAJA::Index_type num_bits,
+                                  RAJA::Index_type period,
+                                  RAJA::Index_type active)
+{
+  using WordT = std::uint32_t;
+  constexpr RAJA::Index_type word_bits = 32;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  RAJA::Index_type num_words = (num_bits + word_bits - 1) / word_bits;
+  if ( num_words == 0 ) {
+    num_words = 1;
+  }
+
+  //
+  // Bits past num_bits are set to check that they are ignored.
+  //
+  std::vector<WordT> mask(num_words, ~WordT(0));
+  for (RAJA::Index_type b = 0; b < num_bits; ++b) {
+    if ((b % period) >= active) {
+      mask[b / word_bits] &= ~(WordT(1) << (b % word_bits));
+    }
+  }
+
+  WordT* working_mask = working_res.allocate<WordT>(num_words);
+  working_res.memcpy(working_mask, &mask[0], sizeof(WordT) * num_words);
+
+  RAJA::TypedBitMaskSegment<INDEX_TYPE, WordT> seg(working_mask,
+                                                   offset,
+                                                   num_bits);
+
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = static_cast<size_t>(offset + num_bits + word_bits);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  memset(static_cast<void*>(test_array), 0, sizeof(INDEX_TYPE) * data_len);
+
+  working_res.memcpy(working_array, test_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (RAJA::Index_type b = 0; b < num_bits; ++b) {
+    if ((b % period) < active) {
+      test_array[offset + b] = static_cast<INDEX_TYPE>(offset + b);
+    }
+  }
+
+  RAJA::forall<EXEC_POLICY>(seg, [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+    working_array[RAJA::stripIndexType(idx)] = idx;
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+  working_res.deallocate(working_mask);
+}
+
+
+TYPED_TEST_SUITE_P(ForallBitMaskSegmentTest);
+template <typename T>
+class ForallBitMaskSegmentTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallBitMaskSegmentTest, BitMaskSegmentForall)
+{
+  using INDEX_TYPE       = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // test empty mask
+  ForallBitMaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(0, 0, 1, 1);
+
+  ForallBitMaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(0, 37, 1, 1);
+
+  ForallBitMaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(3, 1000, 3, 1);
+
+  ForallBitMaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(5, 1000, 200, 40);
+
+  ForallBitMaskSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(0, 2049, 7, 0);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallBitMaskSegmentTest,
+                            BitMaskSegmentForall);
+
+#endif  // __TEST_FORALL_BITMASKSEGMENT_HPP__
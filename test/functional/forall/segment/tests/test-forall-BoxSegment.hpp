@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BOXSEGMENT_HPP__
+#define __TEST_FORALL_BOXSEGMENT_HPP__
+
+#include <array>
+#include <cstring>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallBoxSegmentTestImpl(RAJA::Index_type nx,
+                              RAJA::Index_type ny,
+                              RAJA::Index_type nz,
+                              RAJA::Index_type margin,
+                              bool permuted)
+{
+  RAJA::Layout<3> layout(nx, ny, nz);
+  if (permuted) {
+    layout = RAJA::make_permuted_layout({{nx, ny, nz}},
+                                        RAJA::as_array<RAJA::PERM_KJI>::get());
+  }
+
+  std::array<RAJA::Index_type, 3> lower{{margin, margin, margin}};
+  std::array<RAJA::Index_type, 3> upper{{nx - margin, ny - margin, nz - margin}};
+
+  RAJA::TypedBoxSegment<3, INDEX_TYPE> box(layout, lower, upper);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = static_cast<size_t>(nx * ny * nz);
+  if ( data_len == 0 ) {
+    data_len = 1;
+  }
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  memset(static_cast<void*>(test_array), 0, sizeof(INDEX_TYPE) * data_len);
+
+  working_res.memcpy(working_array, test_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (RAJA::Index_type i = lower[0]; i < upper[0]; ++i) {
+    for (RAJA::Index_type j = lower[1]; j < upper[1]; ++j) {
+      for (RAJA::Index_type k = lower[2]; k < upper[2]; ++k) {
+        const RAJA::Index_type idx = layout(i, j, k);
+        test_array[idx] = static_cast<INDEX_TYPE>(idx);
+      }
+    }
+  }
+
+  RAJA::forall<EXEC_POLICY>(box, [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+    working_array[RAJA::stripIndexType(idx)] = idx;
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallBoxSegmentTest);
+template <typename T>
+class ForallBoxSegmentTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallBoxSegmentTest, BoxSegmentForall)
+{
+  using INDEX_TYPE       = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // test empty box
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(2, 2, 2, 1, false);
+
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(3, 4, 5, 0, false);
+
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(12, 9, 17, 2, false);
+
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(12, 9, 17, 2, true);
+
+  ForallBoxSegmentTestImpl<INDEX_TYPE, WORKING_RESOURCE, EXEC_POLICY>(20, 20, 20, 3, false);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallBoxSegmentTest,
+                            BoxSegmentForall);
+
+#endif  // __TEST_FORALL_BOXSEGMENT_HPP__
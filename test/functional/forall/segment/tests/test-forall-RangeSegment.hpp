@@ -10,6 +10,7 @@
 
 #include <numeric>
 #include <cstring>
+#include <limits>
 
 template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
 void ForallRangeSegmentTestImpl(INDEX_TYPE first, INDEX_TYPE last)
@@ -68,6 +69,196 @@ void ForallRangeSegmentTestImpl(INDEX_TYPE first, INDEX_TYPE last)
                                        test_array);
 }
 
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallRangeSegmentHintTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(RAJA::stripIndexType(first), RAJA::stripIndexType(last));
+  INDEX_TYPE N = static_cast<INDEX_TYPE>(r1.end() - r1.begin());
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = RAJA::stripIndexType(N);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  const INDEX_TYPE rbegin = *r1.begin();
+
+  std::iota(test_array, test_array + RAJA::stripIndexType(N), rbegin);
+
+  RAJA::forall<EXEC_POLICY>(r1, RAJA::expt::Grain(13),
+    [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+    working_array[RAJA::stripIndexType(idx - rbegin)] = idx;
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(test_array[RAJA::stripIndexType(i)], check_array[RAJA::stripIndexType(i)]);
+  }
+
+  // irregular cost, every 16th iteration is expensive
+  RAJA::forall<EXEC_POLICY>(r1,
+    RAJA::expt::Cost([=](INDEX_TYPE idx) {
+      return (RAJA::stripIndexType(idx) % 16 == 0) ? 100.0 : 1.0;
+    }),
+    [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+    working_array[RAJA::stripIndexType(idx - rbegin)] += idx;
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(test_array[RAJA::stripIndexType(i)] + test_array[RAJA::stripIndexType(i)],
+              check_array[RAJA::stripIndexType(i)]);
+  }
+
+  // memory bound loop on one hardware thread per core
+  RAJA::forall<EXEC_POLICY>(r1,
+    RAJA::expt::Affinity(RAJA::expt::Bind::spread, RAJA::expt::Smt::one_per_core),
+    [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+    working_array[RAJA::stripIndexType(idx - rbegin)] -= idx;
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(test_array[RAJA::stripIndexType(i)], check_array[RAJA::stripIndexType(i)]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallRangeSegmentFusedTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(RAJA::stripIndexType(first), RAJA::stripIndexType(last));
+  INDEX_TYPE N = static_cast<INDEX_TYPE>(r1.end() - r1.begin());
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+  INDEX_TYPE* shift_working_array;
+  INDEX_TYPE* shift_check_array;
+  INDEX_TYPE* shift_test_array;
+
+  size_t data_len = RAJA::stripIndexType(N);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &shift_working_array,
+                                     &shift_check_array,
+                                     &shift_test_array);
+
+  const INDEX_TYPE rbegin = *r1.begin();
+
+  std::iota(test_array, test_array + RAJA::stripIndexType(N), rbegin);
+
+  // the second body reads the first at the same index, the third body
+  // reads other indices so it follows a barrier
+  RAJA::expt::forall_fused<EXEC_POLICY>(r1,
+    [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+      working_array[RAJA::stripIndexType(idx - rbegin)] = idx;
+    },
+    [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+      working_array[RAJA::stripIndexType(idx - rbegin)] += idx;
+    },
+    RAJA::expt::FuseBarrier{},
+    [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+      const size_t k = RAJA::stripIndexType(idx - rbegin);
+      shift_working_array[k] = working_array[(k + 1) % data_len];
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+  working_res.memcpy(shift_check_array, shift_working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i] + test_array[i], check_array[i]);
+    ASSERT_EQ(check_array[(i + 1) % data_len], shift_check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       shift_working_array,
+                                       shift_check_array,
+                                       shift_test_array);
+}
+
+//! a capture larger than RAJA_CUDA_MAX_BODY_ARG_BYTES
+struct ForallLargeCapture {
+  static constexpr int size = 600;
+  int values[size];
+};
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallRangeSegmentLargeBodyTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(RAJA::stripIndexType(first), RAJA::stripIndexType(last));
+  INDEX_TYPE N = static_cast<INDEX_TYPE>(r1.end() - r1.begin());
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = RAJA::stripIndexType(N);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  ForallLargeCapture capture;
+  for (int k = 0; k < ForallLargeCapture::size; ++k) {
+    capture.values[k] = k % 7;
+  }
+
+  const INDEX_TYPE rbegin = *r1.begin();
+
+  for (size_t i = 0; i < data_len; i++) {
+    test_array[i] = static_cast<INDEX_TYPE>(
+        capture.values[i % ForallLargeCapture::size]);
+  }
+
+  RAJA::forall<EXEC_POLICY>(r1, [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+    const size_t k = RAJA::stripIndexType(idx - rbegin);
+    working_array[k] = static_cast<INDEX_TYPE>(
+        capture.values[k % ForallLargeCapture::size]);
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
 
 TYPED_TEST_SUITE_P(ForallRangeSegmentTest);
 template <typename T>
@@ -92,6 +283,24 @@ void runNegativeTests()
   ForallRangeSegmentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(-5), INDEX_TYPE(5));
 }
 
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY,
+  typename std::enable_if<(sizeof(RAJA::strip_index_type_t<INDEX_TYPE>) <= sizeof(int))>::type* = nullptr>
+void runWideOffsetTests()
+{
+}
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY,
+  typename std::enable_if<(sizeof(RAJA::strip_index_type_t<INDEX_TYPE>) > sizeof(int))>::type* = nullptr>
+void runWideOffsetTests()
+{
+  using value_type = RAJA::strip_index_type_t<INDEX_TYPE>;
+  const value_type int_max = std::numeric_limits<int>::max();
+
+  // ranges ending at and crossing the largest int
+  ForallRangeSegmentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(int_max - 100), INDEX_TYPE(int_max));
+  ForallRangeSegmentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(int_max - 100), INDEX_TYPE(int_max + 100));
+}
+
 
 TYPED_TEST_P(ForallRangeSegmentTest, RangeSegmentForall)
 {
@@ -107,9 +316,45 @@ TYPED_TEST_P(ForallRangeSegmentTest, RangeSegmentForall)
   ForallRangeSegmentTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1), INDEX_TYPE(32000));
 
   runNegativeTests<INDEX_TYPE, WORKING_RES, EXEC_POLICY>();
+  runWideOffsetTests<INDEX_TYPE, WORKING_RES, EXEC_POLICY>();
+}
+
+TYPED_TEST_P(ForallRangeSegmentTest, RangeSegmentHintForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallRangeSegmentHintTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(0), INDEX_TYPE(27));
+  ForallRangeSegmentHintTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1), INDEX_TYPE(2047));
+  ForallRangeSegmentHintTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1), INDEX_TYPE(32000));
+}
+
+TYPED_TEST_P(ForallRangeSegmentTest, RangeSegmentFusedForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallRangeSegmentFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(0), INDEX_TYPE(27));
+  ForallRangeSegmentFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1), INDEX_TYPE(2047));
+  ForallRangeSegmentFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1), INDEX_TYPE(32000));
+}
+
+TYPED_TEST_P(ForallRangeSegmentTest, RangeSegmentLargeBodyForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallRangeSegmentLargeBodyTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(0), INDEX_TYPE(27));
+  ForallRangeSegmentLargeBodyTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1), INDEX_TYPE(32000));
 }
 
 REGISTER_TYPED_TEST_SUITE_P(ForallRangeSegmentTest,
-                            RangeSegmentForall);
+                            RangeSegmentForall,
+                            RangeSegmentHintForall,
+                            RangeSegmentFusedForall,
+                            RangeSegmentLargeBodyForall);
 
 #endif  // __TEST_FORALL_RANGESEGMENT_HPP__
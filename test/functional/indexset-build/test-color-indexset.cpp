@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the graph coloring index set builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+//
+// Check that the segments of iset hold each element once, in increasing
+// order, and that the elements of a segment have no node in common.
+//
+static void checkColoring(
+    const RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    const std::vector<RAJA::Index_type>& offsets,
+    const std::vector<RAJA::Index_type>& nodes,
+    RAJA::Index_type num_elems,
+    RAJA::Index_type num_nodes)
+{
+  ASSERT_EQ(iset.getLength(), num_elems);
+
+  std::vector<int> elem_count(num_elems, 0);
+  std::vector<int> node_seg(num_nodes, -1);
+
+  for (int s = 0; s < static_cast<int>(iset.getNumSegments()); ++s) {
+    std::vector<RAJA::Index_type> elems;
+    iset.segmentCall(s, [&](const auto& seg) {
+      for (auto e : seg) {
+        elems.push_back(e);
+      }
+    });
+
+    for (size_t i = 0; i < elems.size(); ++i) {
+      const RAJA::Index_type e = elems[i];
+      if (i > 0) {
+        ASSERT_LT(elems[i - 1], e);
+      }
+      ++elem_count[e];
+      for (RAJA::Index_type k = offsets[e]; k < offsets[e + 1]; ++k) {
+        ASSERT_NE(node_seg[nodes[k]], s);
+        node_seg[nodes[k]] = s;
+      }
+    }
+  }
+
+  for (RAJA::Index_type e = 0; e < num_elems; ++e) {
+    ASSERT_EQ(elem_count[e], 1);
+  }
+}
+
+TEST(IndexSetBuild, ColorQuadMesh)
+{
+  const RAJA::Index_type nx = 37;
+  const RAJA::Index_type ny = 23;
+  const RAJA::Index_type num_elems = nx * ny;
+  const RAJA::Index_type num_nodes = (nx + 1) * (ny + 1);
+
+  std::vector<RAJA::Index_type> offsets(1, 0);
+  std::vector<RAJA::Index_type> nodes;
+  for (RAJA::Index_type j = 0; j < ny; ++j) {
+    for (RAJA::Index_type i = 0; i < nx; ++i) {
+      const RAJA::Index_type n0 = j * (nx + 1) + i;
+      nodes.push_back(n0);
+      nodes.push_back(n0 + 1);
+      nodes.push_back(n0 + nx + 1);
+      nodes.push_back(n0 + nx + 2);
+      offsets.push_back(static_cast<RAJA::Index_type>(nodes.size()));
+    }
+  }
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+
+  RAJA::buildColorIndexSet(
+      iset, res, &offsets[0], &nodes[0], num_elems, num_nodes);
+
+  //
+  // Each node has at most 4 elements, so a greedy coloring uses at most
+  // 1 + 8 colors (the number of elements sharing a node with an element).
+  //
+  ASSERT_GE(iset.getNumSegments(), 4u);
+  ASSERT_LE(iset.getNumSegments(), 9u);
+
+  checkColoring(iset, offsets, nodes, num_elems, num_nodes);
+}
+
+TEST(IndexSetBuild, ColorMixedElements)
+{
+  //
+  // Elements with different numbers of nodes, including elements with no
+  // common node that become one range segment.
+  //
+  std::vector<RAJA::Index_type> offsets = {0, 3, 5, 9, 10, 11, 12};
+  std::vector<RAJA::Index_type> nodes = {0, 1, 2,  2, 3,  3, 4, 5, 0,  6,
+                                         7,  8};
+  const RAJA::Index_type num_elems = 6;
+  const RAJA::Index_type num_nodes = 9;
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+
+  RAJA::buildColorIndexSet(
+      iset, res, &offsets[0], &nodes[0], num_elems, num_nodes);
+
+  //
+  // Elements 0, 1 and 2 share nodes pairwise and need three colors.
+  //
+  ASSERT_EQ(iset.getNumSegments(), 3u);
+
+  checkColoring(iset, offsets, nodes, num_elems, num_nodes);
+}
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the colored element to node scatter.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+//
+// Quad mesh of nx x ny elements, 4 nodes per element.
+//
+static std::vector<RAJA::Index_type> quadMesh(RAJA::Index_type nx,
+                                              RAJA::Index_type ny)
+{
+  std::vector<RAJA::Index_type> nodes;
+  for (RAJA::Index_type j = 0; j < ny; ++j) {
+    for (RAJA::Index_type i = 0; i < nx; ++i) {
+      const RAJA::Index_type n0 = j * (nx + 1) + i;
+      nodes.push_back(n0);
+      nodes.push_back(n0 + 1);
+      nodes.push_back(n0 + nx + 1);
+      nodes.push_back(n0 + nx + 2);
+    }
+  }
+  return nodes;
+}
+
+template <typename ExecPolicy>
+static void checkScatterAdd()
+{
+  const RAJA::Index_type nx = 19;
+  const RAJA::Index_type ny = 13;
+  const RAJA::Index_type num_elems = nx * ny;
+  const RAJA::Index_type num_nodes = (nx + 1) * (ny + 1);
+
+  std::vector<RAJA::Index_type> nodes = quadMesh(nx, ny);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::ColoredScatter scatter(res, &nodes[0], num_elems, 4, num_nodes);
+
+  ASSERT_EQ(scatter.num_elems(), num_elems);
+  ASSERT_EQ(scatter.colors().getLength(), num_elems);
+  ASSERT_GE(scatter.num_colors(), 4u);
+
+  std::vector<double> elem_values(nodes.size());
+  for (size_t k = 0; k < elem_values.size(); ++k) {
+    elem_values[k] = static_cast<double>(k % 7) + 0.25;
+  }
+
+  std::vector<double> expected(num_nodes, 0.0);
+  for (size_t k = 0; k < nodes.size(); ++k) {
+    expected[nodes[k]] += elem_values[k];
+  }
+
+  std::vector<double> node_values(num_nodes, 0.0);
+  scatter.scatter_add<ExecPolicy>(&node_values[0], &elem_values[0]);
+
+  for (RAJA::Index_type n = 0; n < num_nodes; ++n) {
+    ASSERT_DOUBLE_EQ(node_values[n], expected[n]);
+  }
+
+  std::vector<int> elem_count(num_elems, 0);
+  int* counts = &elem_count[0];
+  scatter.forall<ExecPolicy>([=](RAJA::Index_type e) { ++counts[e]; });
+  for (RAJA::Index_type e = 0; e < num_elems; ++e) {
+    ASSERT_EQ(elem_count[e], 1);
+  }
+}
+
+TEST(ColoredScatter, ScatterAddSeq)
+{
+  checkScatterAdd<RAJA::seq_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ColoredScatter, ScatterAddOpenMP)
+{
+  checkScatterAdd<RAJA::omp_parallel_for_exec>();
+}
+#endif
+
+TEST(ColoredScatter, MixedElements)
+{
+  std::vector<RAJA::Index_type> offsets = {0, 3, 5, 9, 10};
+  std::vector<RAJA::Index_type> nodes = {0, 1, 2,  2, 3,  3, 4, 5, 0,  6};
+  const RAJA::Index_type num_elems = 4;
+  const RAJA::Index_type num_nodes = 7;
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::ColoredScatter scatter(
+      res, &offsets[0], &nodes[0], num_elems, num_nodes);
+
+  ASSERT_EQ(scatter.num_colors(), 3u);
+
+  std::vector<int> elem_values(nodes.size(), 1);
+  std::vector<int> node_values(num_nodes, 0);
+  scatter.scatter_add<RAJA::seq_exec>(&node_values[0], &elem_values[0]);
+
+  std::vector<int> expected = {2, 1, 2, 2, 1, 1, 1};
+  for (RAJA::Index_type n = 0; n < num_nodes; ++n) {
+    ASSERT_EQ(node_values[n], expected[n]);
+  }
+}
@@ -0,0 +1,138 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the index set segment dependency graph
+/// builder and the execution of index sets with a dependency graph.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+TEST(IndexSetBuild, DepGraphOverlap)
+{
+  camp::resources::Resource res{camp::resources::Host()};
+
+  std::vector<RAJA::Index_type> idx0 = {5, 6};
+  std::vector<RAJA::Index_type> idx1 = {2, 3};
+  std::vector<RAJA::Index_type> idx2 = {6, 7, 0};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 3));
+  iset.push_back(RAJA::ListSegment(idx0, res));
+  iset.push_back(RAJA::ListSegment(idx1, res));
+  iset.push_back(RAJA::ListSegment(idx2, res));
+
+  RAJA::IndexSetDepGraph graph;
+  RAJA::buildIndexSetDepGraph(graph, iset);
+
+  ASSERT_EQ(graph.getNumSegments(), 4);
+  ASSERT_EQ(graph.getNumPredecessors(0), 0);
+  ASSERT_EQ(graph.getNumPredecessors(1), 0);
+  ASSERT_EQ(graph.getNumPredecessors(2), 1);
+  ASSERT_EQ(graph.getNumPredecessors(3), 2);
+
+  ASSERT_EQ(graph.getNumSuccessors(0), 2);
+  ASSERT_EQ(graph.getSuccessors(0)[0], 2);
+  ASSERT_EQ(graph.getSuccessors(0)[1], 3);
+  ASSERT_EQ(graph.getNumSuccessors(1), 1);
+  ASSERT_EQ(graph.getSuccessors(1)[0], 3);
+
+  //
+  // With an offset of 3, index 5 of segment 1 is 3 away from index 2 of
+  // segment 0, and its index 6 from index 3 of segment 2.
+  //
+  const RAJA::Index_type offset = 3;
+  RAJA::buildIndexSetDepGraph(graph, iset, &offset, 1);
+
+  ASSERT_EQ(graph.getNumPredecessors(0), 0);
+  ASSERT_EQ(graph.getNumPredecessors(1), 1);
+  ASSERT_EQ(graph.getNumPredecessors(2), 2);
+  ASSERT_EQ(graph.getNumPredecessors(3), 3);
+  ASSERT_EQ(graph.getNumDependencies(), 6);
+}
+
+//
+// Wavefront sweep over a 2-D grid split into blocks, each point depends on
+// the point to its left and the point above it.
+//
+template <typename EXEC_POLICY>
+void testDepGraphSweep()
+{
+  constexpr RAJA::Index_type bs = 8;
+  constexpr RAJA::Index_type nb = 6;
+  constexpr RAJA::Index_type n = bs * nb;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  for (RAJA::Index_type bi = 0; bi < nb; ++bi) {
+    for (RAJA::Index_type bj = 0; bj < nb; ++bj) {
+      for (RAJA::Index_type i = 0; i < bs; ++i) {
+        const RAJA::Index_type row = (bi * bs + i) * n;
+        iset.push_back(RAJA::RangeSegment(row + bj * bs, row + bj * bs + bs));
+      }
+    }
+  }
+
+  const RAJA::Index_type offsets[2] = {1, n};
+  RAJA::IndexSetDepGraph graph;
+  RAJA::buildIndexSetDepGraph(graph, iset, offsets, 2);
+
+  std::vector<double> ref(n * n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    for (RAJA::Index_type j = 0; j < n; ++j) {
+      ref[i * n + j] = 1.0 + (i > 0 ? ref[(i - 1) * n + j] : 0.0) +
+                       (j > 0 ? ref[i * n + j - 1] : 0.0);
+      ref[i * n + j] *= 0.5;
+    }
+  }
+
+  std::vector<double> test(n * n, 0.0);
+  double* a = &test[0];
+
+  RAJA::forall<EXEC_POLICY>(RAJA::make_dep_graph_index_set(iset, graph),
+                            [=](RAJA::Index_type idx) {
+    const RAJA::Index_type i = idx / n;
+    const RAJA::Index_type j = idx % n;
+    a[idx] = 0.5 * (1.0 + (i > 0 ? a[idx - n] : 0.0) +
+                    (j > 0 ? a[idx - 1] : 0.0));
+  });
+
+  for (RAJA::Index_type i = 0; i < n * n; ++i) {
+    ASSERT_EQ(test[i], ref[i]);
+  }
+
+  std::vector<int> count(n * n, 0);
+  int* c = &count[0];
+
+  RAJA::forall_Icount<EXEC_POLICY>(
+      RAJA::make_dep_graph_index_set(iset, graph),
+      [=](RAJA::Index_type icount, RAJA::Index_type) { c[icount] += 1; });
+
+  for (RAJA::Index_type i = 0; i < n * n; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+}
+
+TEST(IndexSetBuild, DepGraphSweepSequential)
+{
+  testDepGraphSweep<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::simd_exec>>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetBuild, DepGraphSweepOpenMP)
+{
+  testDepGraphSweep<
+      RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>();
+  testDepGraphSweep<
+      RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit, RAJA::loop_exec>>();
+}
+#endif
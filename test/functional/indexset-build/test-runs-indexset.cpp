@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the index set builder that splits an
+/// index array into runs.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <numeric>
+#include <vector>
+
+//
+// Create index vector containing indices:
+// {0, 1, ..., 15,  17, 18,  20, 21, ..., 27,  29,  30, 31}
+//
+static std::vector<RAJA::Index_type> makeRunsIndices()
+{
+  std::vector<RAJA::Index_type> indices(16);
+  std::iota(indices.begin(), indices.end(), 0);
+
+  indices.push_back(17);
+  indices.push_back(18);
+
+  for (RAJA::Index_type i = 20; i < 28; ++i) {
+    indices.push_back(i);
+  }
+
+  indices.push_back(29);
+  indices.push_back(30);
+  indices.push_back(31);
+
+  return indices;
+}
+
+TEST(IndexSetBuild, Runs)
+{
+  using RSType = RAJA::RangeSegment;
+  using LSType = RAJA::ListSegment;
+
+  std::vector<RAJA::Index_type> indices = makeRunsIndices();
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+
+  RAJA::buildIndexSetRuns(iset,
+                          res,
+                          &indices[0],
+                          static_cast<RAJA::Index_type>(indices.size()),
+                          4);
+
+  ASSERT_EQ(iset.getLength(), indices.size());
+
+  ASSERT_EQ(iset.size(), 4);
+
+  const RSType& s0 = iset.getSegment<const RSType>(0);
+  ASSERT_EQ(s0.size(), 16);
+  ASSERT_EQ(*s0.begin(), 0);
+
+  const LSType& s1 = iset.getSegment<const LSType>(1);
+  ASSERT_EQ(s1.size(), 2);
+  ASSERT_EQ(*s1.begin(), 17);
+
+  const RSType& s2 = iset.getSegment<const RSType>(2);
+  ASSERT_EQ(s2.size(), 8);
+  ASSERT_EQ(*s2.begin(), 20);
+
+  const LSType& s3 = iset.getSegment<const LSType>(3);
+  ASSERT_EQ(s3.size(), 3);
+  ASSERT_EQ(*s3.begin(), 29);
+}
+
+TEST(IndexSetBuild, RunsAligned)
+{
+  using RSType = RAJA::RangeSegment;
+  using LSType = RAJA::ListSegment;
+
+  std::vector<RAJA::Index_type> indices = makeRunsIndices();
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+
+  RAJA::buildIndexSetRuns(iset,
+                          res,
+                          &indices[0],
+                          static_cast<RAJA::Index_type>(indices.size()),
+                          4,
+                          8);
+
+  ASSERT_EQ(iset.getLength(), indices.size());
+
+  ASSERT_EQ(iset.size(), 4);
+
+  const RSType& s0 = iset.getSegment<const RSType>(0);
+  ASSERT_EQ(s0.size(), 16);
+  ASSERT_EQ(*s0.begin(), 0);
+
+  //
+  // The values of the run starting at 20 before the aligned value 24 are
+  // gathered with the run before it.
+  //
+  const LSType& s1 = iset.getSegment<const LSType>(1);
+  ASSERT_EQ(s1.size(), 6);
+  ASSERT_EQ(*s1.begin(), 17);
+
+  const RSType& s2 = iset.getSegment<const RSType>(2);
+  ASSERT_EQ(s2.size(), 4);
+  ASSERT_EQ(*s2.begin(), 24);
+
+  const LSType& s3 = iset.getSegment<const LSType>(3);
+  ASSERT_EQ(s3.size(), 3);
+  ASSERT_EQ(*s3.begin(), 29);
+}
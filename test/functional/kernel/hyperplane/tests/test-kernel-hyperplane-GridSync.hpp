@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_HYPERPLANE_GRIDSYNC_HPP__
+#define __TEST_KERNEL_HYPERPLANE_GRIDSYNC_HPP__
+
+//
+// Each point is one more than the largest of its i, j and k predecessors,
+// which are on the previous hyperplane. The sweep gives i + j + k + 1 at
+// every point only when no block runs ahead of a block it depends on.
+//
+template <typename WORKING_RES, typename EXEC_POLICY>
+void KernelHyperplaneGridSyncTestImpl(const int ilen, const int jlen, const int klen)
+{
+  camp::resources::Resource work_res{WORKING_RES::get_default()};
+
+  int* work_array;
+  int* check_array;
+  int* test_array;
+
+  const int array_length = ilen * jlen * klen;
+
+  allocateForallTestData<int>(array_length,
+                              work_res,
+                              &work_array,
+                              &check_array,
+                              &test_array);
+
+  for (int n = 0; n < array_length; ++n) {
+    test_array[n] = 0;
+  }
+
+  work_res.memcpy(work_array, test_array, sizeof(int) * array_length);
+
+  RAJA::View<int, RAJA::Layout<3>> work_view(work_array, ilen, jlen, klen);
+
+  RAJA::kernel<EXEC_POLICY>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, ilen),
+                       RAJA::TypedRangeSegment<int>(0, jlen),
+                       RAJA::TypedRangeSegment<int>(0, klen)),
+      [=] RAJA_HOST_DEVICE(int i, int j, int k) {
+        int prev = 0;
+        if (i > 0 && work_view(i - 1, j, k) > prev) {
+          prev = work_view(i - 1, j, k);
+        }
+        if (j > 0 && work_view(i, j - 1, k) > prev) {
+          prev = work_view(i, j - 1, k);
+        }
+        if (k > 0 && work_view(i, j, k - 1) > prev) {
+          prev = work_view(i, j, k - 1);
+        }
+        work_view(i, j, k) = prev + 1;
+      });
+
+  work_res.memcpy(check_array, work_array, sizeof(int) * array_length);
+
+  RAJA::View<int, RAJA::Layout<3>> check_view(check_array, ilen, jlen, klen);
+
+  for (int i = 0; i < ilen; ++i) {
+    for (int j = 0; j < jlen; ++j) {
+      for (int k = 0; k < klen; ++k) {
+        ASSERT_EQ(check_view(i, j, k), i + j + k + 1);
+      }
+    }
+  }
+
+  deallocateForallTestData<int>(work_res,
+                                work_array,
+                                check_array,
+                                test_array);
+}
+
+
+TYPED_TEST_SUITE_P(KernelHyperplaneGridSyncTest);
+template <typename T>
+class KernelHyperplaneGridSyncTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelHyperplaneGridSyncTest, HyperplaneGridSyncKernel)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  // a single block, then many blocks that depend on each other
+  KernelHyperplaneGridSyncTestImpl<WORKING_RES, EXEC_POLICY>(10, 1, 32);
+  KernelHyperplaneGridSyncTestImpl<WORKING_RES, EXEC_POLICY>(10, 24, 16);
+  KernelHyperplaneGridSyncTestImpl<WORKING_RES, EXEC_POLICY>(33, 17, 5);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelHyperplaneGridSyncTest,
+                            HyperplaneGridSyncKernel);
+
+#endif  // __TEST_KERNEL_HYPERPLANE_GRIDSYNC_HPP__
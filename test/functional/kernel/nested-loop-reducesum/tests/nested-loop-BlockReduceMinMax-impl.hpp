@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __NESTED_LOOP_BLOCK_REDUCE_MIN_MAX_IMPL_HPP__
+#define __NESTED_LOOP_BLOCK_REDUCE_MIN_MAX_IMPL_HPP__
+
+#include <numeric>
+
+template<typename EXEC_POL, bool USE_RESOURCE,
+         typename SEGMENTS,
+         typename PARAMS,
+         typename WORKING_RES,
+         typename... Args>
+typename std::enable_if< USE_RESOURCE >::type call_kernel(SEGMENTS&& segs, PARAMS&& params, WORKING_RES work_res, Args&&... args) {
+  RAJA::kernel_param_resource<EXEC_POL>( segs, params, work_res, args...);
+}
+
+template<typename EXEC_POL, bool USE_RESOURCE,
+         typename SEGMENTS,
+         typename PARAMS,
+         typename WORKING_RES,
+         typename... Args>
+typename std::enable_if< !USE_RESOURCE >::type call_kernel(SEGMENTS&& segs, PARAMS&& params, WORKING_RES, Args&&... args) {
+  RAJA::kernel_param<EXEC_POL>( segs, params, args...);
+}
+
+//
+//
+// Define list of nested loop types the Block Min/Max test supports.
+//
+//
+using BlockReduceMinMaxSupportedLoopTypeList = camp::list<
+  DEPTH_1_REDUCEMINMAX,
+  DEVICE_DEPTH_1_REDUCEMINMAX,
+  SYCL_DEPTH_1_REDUCEMINMAX
+  >;
+
+//
+//
+// Min and max of values that are all positive (min) or all negative (max),
+// so a block with inactive threads padded with value_t() instead of the
+// operator identity gives 0 instead of the expected result.
+//
+//
+template <typename WORKING_RES, typename EXEC_POLICY, typename REDUCE_POL, bool USE_RESOURCE>
+void KernelNestedLoopTest(const DEPTH_1_REDUCEMINMAX&, const int N){
+
+  WORKING_RES work_res{WORKING_RES::get_default()};
+  camp::resources::Resource erased_work_res{work_res};
+
+  // Allocate Tests Data
+  int * work_array;
+  int * check_array;
+  int * test_array;
+
+  allocateForallTestData<int>(N,
+                              erased_work_res,
+                              &work_array,
+                              &check_array,
+                              &test_array);
+
+  // Initialize Data, 1 to N
+  std::iota(test_array, test_array + RAJA::stripIndexType(N), 1);
+
+  erased_work_res.memcpy(work_array, test_array, sizeof(int) * RAJA::stripIndexType(N));
+
+  RAJA::ReduceMin<REDUCE_POL, int> workmin(N + 1);
+  RAJA::ReduceMax<REDUCE_POL, int> workmax(-(N + 1));
+
+  // Calculate Working data
+  call_kernel<EXEC_POLICY, USE_RESOURCE>(
+    RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+    RAJA::make_tuple<int, int>(0, 0),
+
+    // Resource
+    work_res,
+
+    // lambda 0, runs for every active index
+    [=] RAJA_HOST_DEVICE (RAJA::Index_type i, int & minval, int & maxval) {
+       minval = work_array[i];
+       maxval = -work_array[i];
+    },
+
+    // lambda 1, (min reduction) only runs on the root thread of a block
+    [=] RAJA_HOST_DEVICE (int & minval) {
+       workmin.min(minval);
+    },
+
+    // lambda 2, (max reduction) only runs on the root thread of a block
+    [=] RAJA_HOST_DEVICE (int & maxval) {
+       workmax.max(maxval);
+    }
+
+  );
+
+  ASSERT_EQ(workmin.get(), 1);
+  ASSERT_EQ(workmax.get(), -1);
+
+  deallocateForallTestData<int>(erased_work_res,
+                                work_array,
+                                check_array,
+                                test_array);
+}
+
+// DEVICE_ and SYCL_ execution policies use the above DEPTH_1_REDUCEMINMAX test.
+template <typename WORKING_RES, typename EXEC_POLICY, typename REDUCE_POL, bool USE_RESOURCE, typename... Args>
+void KernelNestedLoopTest(const DEVICE_DEPTH_1_REDUCEMINMAX&, Args... args){
+  KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, REDUCE_POL, USE_RESOURCE>(DEPTH_1_REDUCEMINMAX(), args...);
+}
+
+template <typename WORKING_RES, typename EXEC_POLICY, typename REDUCE_POL, bool USE_RESOURCE, typename... Args>
+void KernelNestedLoopTest(const SYCL_DEPTH_1_REDUCEMINMAX&, Args... args){
+  KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, REDUCE_POL, USE_RESOURCE>(DEPTH_1_REDUCEMINMAX(), args...);
+}
+
+//
+//
+// Defining the Kernel Loop structure for Block Min/Max Nested Loop Tests.
+//
+//
+template<typename POLICY_TYPE, typename REDUCE_POL, typename POLICY_DATA>
+struct BlockMinMaxNestedLoopExec;
+
+template<typename REDUCE_POL, typename POLICY_DATA>
+struct BlockMinMaxNestedLoopExec<DEPTH_1_REDUCEMINMAX, REDUCE_POL, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::For<0, typename camp::at<POLICY_DATA, camp::num<0>>::type, RAJA::statement::Lambda<0>,
+        RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::operators::minimum, RAJA::statement::Param<0>,
+          RAJA::statement::Lambda<1, RAJA::Params<0>>
+        >,
+        RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::operators::maximum, RAJA::statement::Param<1>,
+          RAJA::statement::Lambda<2, RAJA::Params<1>>
+        >
+      >
+    >;
+};
+
+#if defined(RAJA_ENABLE_CUDA) or defined(RAJA_ENABLE_HIP)
+
+// The tile is wider than the last block of indices, so the threads past the
+// end of the segment reach the Reduce statements inactive.
+template<typename REDUCE_POL, typename POLICY_DATA>
+struct BlockMinMaxNestedLoopExec<DEVICE_DEPTH_1_REDUCEMINMAX, REDUCE_POL, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::DEVICE_KERNEL<
+        RAJA::statement::Tile<0, RAJA::tile_fixed<256>, typename camp::at<POLICY_DATA, camp::num<0>>::type,
+          RAJA::statement::For<0, typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::statement::Lambda<0>,
+            RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<2>>::type, RAJA::operators::minimum, RAJA::statement::Param<0>,
+              RAJA::statement::Lambda<1, RAJA::Params<0>>
+            >,
+            RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<2>>::type, RAJA::operators::maximum, RAJA::statement::Param<1>,
+              RAJA::statement::Lambda<2, RAJA::Params<1>>
+            >
+          >
+        >
+      > // end DEVICE_KERNEL
+    >;
+};
+
+#endif  // RAJA_ENABLE_CUDA or RAJA_ENABLE_HIP
+
+#if defined(RAJA_ENABLE_SYCL)
+
+template<typename REDUCE_POL, typename POLICY_DATA>
+struct BlockMinMaxNestedLoopExec<SYCL_DEPTH_1_REDUCEMINMAX, REDUCE_POL, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::SyclKernel<
+        RAJA::statement::Tile<0, RAJA::tile_fixed<256>, typename camp::at<POLICY_DATA, camp::num<0>>::type,
+          RAJA::statement::For<0, typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::statement::Lambda<0>,
+            RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<2>>::type, RAJA::operators::minimum, RAJA::statement::Param<0>,
+              RAJA::statement::Lambda<1, RAJA::Params<0>>
+            >,
+            RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<2>>::type, RAJA::operators::maximum, RAJA::statement::Param<1>,
+              RAJA::statement::Lambda<2, RAJA::Params<1>>
+            >
+          >
+        >
+      > // end SyclKernel
+    >;
+};
+
+#endif  // RAJA_ENABLE_SYCL
+
+#endif  // __NESTED_LOOP_BLOCK_REDUCE_MIN_MAX_IMPL_HPP__
@@ -0,0 +1,46 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_RESOURCE_NESTED_LOOP_BLOCK_REDUCE_MIN_MAX_HPP__
+#define __TEST_KERNEL_RESOURCE_NESTED_LOOP_BLOCK_REDUCE_MIN_MAX_HPP__
+
+#include "nested-loop-BlockReduceMinMax-impl.hpp"
+
+//
+//
+// Setup the Nested Loop Block Min/Max g-tests.
+//
+//
+TYPED_TEST_SUITE_P(KernelNestedLoopBlockReduceMinMaxTest);
+template <typename T>
+class KernelNestedLoopBlockReduceMinMaxTest : public ::testing::Test {};
+
+TYPED_TEST_P(KernelNestedLoopBlockReduceMinMaxTest, NestedLoopBlockMinMaxKernel) {
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using REDUCE_POL = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POL_DATA = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // Attain the loop depth type from execpol data.
+  using LOOP_TYPE = typename EXEC_POL_DATA::LoopType;
+
+  // Get List of loop exec policies.
+  using LOOP_POLS = typename EXEC_POL_DATA::type;
+
+  // Build proper basic kernel exec policy type.
+  using EXEC_POLICY = typename BlockMinMaxNestedLoopExec<LOOP_TYPE, REDUCE_POL, LOOP_POLS>::type;
+
+  constexpr bool USE_RES = true;
+
+  // One partial block, then several blocks with a partial last block.
+  KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, REDUCE_POL, USE_RES>(LOOP_TYPE(), 200);
+  KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, REDUCE_POL, USE_RES>(LOOP_TYPE(), 1000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelNestedLoopBlockReduceMinMaxTest,
+                            NestedLoopBlockMinMaxKernel);
+
+#endif  // __TEST_KERNEL_RESOURCE_NESTED_LOOP_BLOCK_REDUCE_MIN_MAX_HPP__
@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_SEGMENTED_HPP__
+#define __TEST_SCAN_SEGMENTED_HPP__
+
+#include <numeric>
+#include <vector>
+
+template <typename T>
+::testing::AssertionResult check_segmented(const std::vector<T>& expected,
+                                           const T* actual)
+{
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanSegmentedTestImpl(int N,
+                           int head_stride,
+                           typename OP_TYPE::result_type offset)
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  int* work_flags = working_res.allocate<int>(N);
+  int* host_flags = host_res.allocate<int>(N);
+
+  std::iota(host_in, host_in + N, 1);
+  for (int i = 0; i < N; ++i) {
+    host_flags[i] = (i % head_stride == 3) ? 1 : 0;
+  }
+  if (N > 0) {
+    host_flags[0] = 0;  // the first segment also starts without a flag
+  }
+
+  std::vector<T> inclusive(N);
+  std::vector<T> exclusive(N);
+  std::vector<T> reduced;
+  T agg = OP_TYPE::identity();
+  for (int i = 0; i < N; ++i) {
+    if (i > 0 && host_flags[i]) {
+      reduced.push_back(agg);
+      agg = OP_TYPE::identity();
+    }
+    exclusive[i] = OP_TYPE()(offset, agg);
+    agg = OP_TYPE()(agg, host_in[i]);
+    inclusive[i] = agg;
+  }
+  if (N > 0) {
+    reduced.push_back(agg);
+  }
+
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.memcpy(work_flags, host_flags, sizeof(int) * N);
+
+  // inclusive scan without resource
+  RAJA::inclusive_scan_segmented<EXEC_POLICY>(RAJA::make_span(work_in, N),
+                                              RAJA::make_span(work_flags, N),
+                                              RAJA::make_span(work_out, N),
+                                              OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_segmented(inclusive, host_out));
+
+  // exclusive scan with resource
+  RAJA::exclusive_scan_segmented<EXEC_POLICY>(res,
+                                              RAJA::make_span(work_in, N),
+                                              RAJA::make_span(work_flags, N),
+                                              RAJA::make_span(work_out, N),
+                                              OP_TYPE{},
+                                              offset);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_segmented(exclusive, host_out));
+
+  // reduction with resource
+  RAJA::reduce_segmented<EXEC_POLICY>(res,
+                                      RAJA::make_span(work_in, N),
+                                      RAJA::make_span(work_flags, N),
+                                      RAJA::make_span(work_out, N),
+                                      OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * reduced.size());
+  res.wait();
+
+  ASSERT_TRUE(check_segmented(reduced, host_out));
+
+  // in-place inclusive scan
+  RAJA::inclusive_scan_segmented<EXEC_POLICY>(res,
+                                              RAJA::make_span(work_in, N),
+                                              RAJA::make_span(work_flags, N),
+                                              RAJA::make_span(work_in, N),
+                                              OP_TYPE{});
+
+  res.memcpy(host_out, work_in, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_segmented(inclusive, host_out));
+
+  working_res.deallocate(work_flags);
+  host_res.deallocate(host_flags);
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanSegmentedTest);
+template <typename T>
+class ScanSegmentedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanSegmentedTest, ScanSegmented)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+  using T = typename OP_TYPE::result_type;
+
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(0, 7, OP_TYPE::identity());
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(357, 7, OP_TYPE::identity());
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(357, 1000, T(15));
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(32000, 13, T(2));
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(32000, 3001, OP_TYPE::identity());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanSegmentedTest,
+                            ScanSegmented);
+
+#endif // __TEST_SCAN_SEGMENTED_HPP__
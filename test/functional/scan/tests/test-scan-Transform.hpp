@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_TRANSFORM_HPP__
+#define __TEST_SCAN_TRANSFORM_HPP__
+
+#include <vector>
+
+template <typename T>
+::testing::AssertionResult check_transform(const std::vector<T>& expected,
+                                           const T* actual)
+{
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanTransformTestImpl(int N, typename OP_TYPE::result_type offset)
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  auto transform = [=] RAJA_HOST_DEVICE (int i) { return T((i * 5) % 17); };
+
+  std::vector<T> inclusive(N);
+  std::vector<T> exclusive(N);
+  T agg = OP_TYPE::identity();
+  for (int i = 0; i < N; ++i) {
+    exclusive[i] = OP_TYPE()(offset, agg);
+    agg = OP_TYPE()(agg, transform(i));
+    inclusive[i] = agg;
+  }
+
+  // inclusive scan of an index range without resource
+  RAJA::inclusive_scan_transform<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, N),
+                                              RAJA::make_span(work_out, N),
+                                              transform,
+                                              OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_transform(inclusive, host_out));
+
+  // exclusive scan of an index range with resource
+  RAJA::exclusive_scan_transform<EXEC_POLICY>(res,
+                                              RAJA::TypedRangeSegment<int>(0, N),
+                                              RAJA::make_span(work_out, N),
+                                              transform,
+                                              OP_TYPE{},
+                                              offset);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_transform(exclusive, host_out));
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanTransformTest);
+template <typename T>
+class ScanTransformTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanTransformTest, ScanTransform)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+  using T = typename OP_TYPE::result_type;
+
+  ScanTransformTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(0, OP_TYPE::identity());
+  ScanTransformTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(357, T(15));
+  ScanTransformTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(32000, OP_TYPE::identity());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanTransformTest,
+                            ScanTransform);
+
+#endif // __TEST_SCAN_TRANSFORM_HPP__
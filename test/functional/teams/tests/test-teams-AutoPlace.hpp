@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_AUTOPLACE_HPP__
+#define __TEST_TEAMS_AUTOPLACE_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsAutoPlaceTestImpl(int N, int M)
+{
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*M,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  const bool on_host =
+      working_res.get_platform() == camp::resources::Platform::host;
+  const bool has_device = RAJA::expt::launch_has_device<LAUNCH_POLICY>::value;
+
+  RAJA::expt::Grid grid(RAJA::expt::Teams(N), RAJA::expt::Threads(M));
+
+  // fix the threshold so AUTO runs where the working data lives
+  RAJA::expt::AutoPlaceModel& model = RAJA::expt::auto_place_model<LAUNCH_POLICY>();
+  const RAJA::Index_type threshold = model.threshold;
+
+  model.threshold = std::numeric_limits<RAJA::Index_type>::max();
+  ASSERT_EQ(RAJA::expt::HOST, RAJA::expt::select_place<LAUNCH_POLICY>(grid));
+  ASSERT_EQ(has_device ? RAJA::expt::DEVICE : RAJA::expt::HOST,
+            RAJA::expt::select_place<LAUNCH_POLICY>(grid, RAJA::expt::Residency::device));
+
+  model.threshold = 0;
+  ASSERT_EQ(has_device ? RAJA::expt::DEVICE : RAJA::expt::HOST,
+            RAJA::expt::select_place<LAUNCH_POLICY>(grid));
+
+  model.threshold = on_host ? std::numeric_limits<RAJA::Index_type>::max() : 0;
+
+  RAJA::expt::launch<LAUNCH_POLICY>(RAJA::expt::AUTO, grid,
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+            RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, M), [&](int c) {
+              working_array[c + M*r] = r * M + c;
+            });
+          });
+        });
+
+  model.threshold = threshold;
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N*M);
+
+  for (int i = 0; i < N*M; ++i) {
+    ASSERT_EQ(i, check_array[i]);
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsAutoPlaceTest);
+template <typename T>
+class TeamsAutoPlaceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsAutoPlaceTest, AutoPlaceTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsAutoPlaceTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(4, 8);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsAutoPlaceTest,
+                            AutoPlaceTeams);
+
+#endif  // __TEST_TEAMS_AUTOPLACE_HPP__
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_BATCH_HPP__
+#define __TEST_TEAMS_BATCH_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsBatchTestImpl(int N, int num_launches, size_t max_launches)
+{
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  const int threads = 32;
+  const int teams = (N - 1) / threads + 1;
+
+  for (int i = 0; i < N; ++i) {
+    test_array[i] = 0;
+  }
+  working_res.memcpy(working_array, test_array, sizeof(int) * N);
+
+  {
+    RAJA::expt::LaunchBatch<LAUNCH_POLICY> batch(working_res, max_launches);
+
+    for (int k = 0; k < num_launches; ++k) {
+
+      // every fifth launch has other teams, so it can not join the batch
+      const int launch_teams = (k % 5 == 4) ? 2 * teams : teams;
+
+      batch.launch(RAJA::expt::Grid(RAJA::expt::Teams(launch_teams),
+                                    RAJA::expt::Threads(threads)),
+          [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+            RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, launch_teams), [&](int t) {
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, threads), [&](int tx) {
+                    const int i = t * threads + tx;
+                    if (i < N) {
+                      // depends on the order of the launches
+                      working_array[i] = 2 * working_array[i] + (k % 3);
+                    }
+                  });
+              });
+          });
+    }
+
+    ASSERT_LE(batch.size(), max_launches);
+    batch.wait();
+    ASSERT_EQ(batch.size(), size_t(0));
+  }
+
+  int expected = 0;
+  for (int k = 0; k < num_launches; ++k) {
+    expected = 2 * expected + (k % 3);
+  }
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(expected, check_array[i]);
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsBatchTest);
+template <typename T>
+class TeamsBatchTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsBatchTest, BatchTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsBatchTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(100, 20, 64);
+  // flushes when the batch is full
+  TeamsBatchTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(100, 20, 3);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsBatchTest,
+                            BatchTeams);
+
+#endif  // __TEST_TEAMS_BATCH_HPP__
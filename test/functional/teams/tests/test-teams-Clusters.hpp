@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_CLUSTERS_HPP__
+#define __TEST_TEAMS_CLUSTERS_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsClustersTestImpl(int N)
+{
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  // one row of values for each team, then the cluster size of each team
+  allocateForallTestData<int>(N*N + N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(N), RAJA::expt::Threads(N),
+                     RAJA::expt::Clusters(2)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                RAJA_TEAM_SHARED int s_A[1024];
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    s_A[c] = r * N + c;
+                });
+
+                ctx.clusterSync();
+
+                // read the shared memory of the other team of the cluster
+                const int size = ctx.clusterSize();
+                const int rank = ctx.clusterRank();
+                int* s_other = ctx.clusterSharedMemory(s_A, size > 1 ? rank ^ 1 : rank);
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    working_array[c + N*r] = s_other[c];
+                    if (c == 0) working_array[N*N + r] = size;
+                });
+
+                // the other team may still read s_A
+                ctx.clusterSync();
+
+              });  // loop r
+        });  // outer lambda
+
+
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * (N*N + N));
+
+  for(int r = 0; r < N; ++r) {
+    const int size = check_array[N*N + r];
+    ASSERT_TRUE(size == 1 || size == 2);
+    const int other = size > 1 ? r ^ 1 : r;
+    for (int c = 0; c < N; c++) {
+      ASSERT_EQ(other * N + c, check_array[c + r*N]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsClustersTest);
+template <typename T>
+class TeamsClustersTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsClustersTest, ClustersTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsClustersTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(32);
+  TeamsClustersTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(100);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsClustersTest,
+                            ClustersTeams);
+
+#endif  // __TEST_TEAMS_CLUSTERS_HPP__
@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_GRID_SYNC_HPP__
+#define __TEST_TEAMS_GRID_SYNC_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsGridSyncTestImpl(int N)
+{
+  // cooperative launches, whose grid may hold fewer blocks than teams
+#if defined(RAJA_ENABLE_CUDA)
+  using COOP_POLICY = RAJA::expt::LaunchPolicy<typename LAUNCH_POLICY::host_policy_t,
+                                               RAJA::expt::cuda_launch_cooperative_t<false>>;
+  using COOP_TEAM_POLICY = RAJA::expt::LoopPolicy<typename TEAM_POLICY::host_policy_t,
+                                                  RAJA::cuda_block_x_loop>;
+#elif defined(RAJA_ENABLE_HIP)
+  using COOP_POLICY = RAJA::expt::LaunchPolicy<typename LAUNCH_POLICY::host_policy_t,
+                                               RAJA::expt::hip_launch_cooperative_t<false>>;
+  using COOP_TEAM_POLICY = RAJA::expt::LoopPolicy<typename TEAM_POLICY::host_policy_t,
+                                                  RAJA::hip_block_x_loop>;
+#else
+  using COOP_POLICY = LAUNCH_POLICY;
+  using COOP_TEAM_POLICY = TEAM_POLICY;
+#endif
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(2*N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+
+  RAJA::expt::launch<COOP_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(N), RAJA::expt::Threads(32)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<COOP_TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, 1), [&](int) {
+                    working_array[r] = r + 1;
+                });
+              });
+
+          ctx.gridSync();
+
+          //read the values written by other teams
+          RAJA::expt::loop<COOP_TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, 1), [&](int) {
+                    working_array[N + r] = working_array[(r + 1) % N];
+                });
+              });
+        });  // outer lambda
+
+
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * 2*N);
+
+  for (int r = 0; r < N; ++r) {
+    ASSERT_EQ((r + 1) % N + 1, check_array[N + r]);
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsGridSyncTest);
+template <typename T>
+class TeamsGridSyncTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsGridSyncTest, GridSyncTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsGridSyncTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(10);
+  // more teams than can be resident at once
+  TeamsGridSyncTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(100000);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsGridSyncTest,
+                            GridSyncTeams);
+
+#endif  // __TEST_TEAMS_GRID_SYNC_HPP__
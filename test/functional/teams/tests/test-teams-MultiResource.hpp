@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_MULTI_RESOURCE_HPP__
+#define __TEST_TEAMS_MULTI_RESOURCE_HPP__
+
+#include <vector>
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsMultiResourceTestImpl(int N, int num_res)
+{
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  working_res.memset(working_array, 0, sizeof(int) * N*N);
+  working_res.wait();
+
+  std::vector<RAJA::resources::Resource> resources;
+  for (int i = 0; i < num_res; ++i) {
+    resources.push_back(RAJA::resources::Resource{WORKING_RES{}});
+  }
+
+  std::vector<RAJA::resources::Event> events =
+    RAJA::expt::launch<LAUNCH_POLICY>(resources,
+      RAJA::expt::Grid(RAJA::expt::Teams(N), RAJA::expt::Threads(N)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx,
+                             RAJA::TypedRangeSegment<int> teams) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, teams, [&](int r) {
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    working_array[c + N*r] += r * N + c + 1;
+                });
+
+              });  // loop r
+        });  // outer lambda
+
+  ASSERT_EQ(static_cast<size_t>(num_res), events.size());
+  for (auto& e : events) {
+    e.wait();
+  }
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N*N);
+
+  // every team ran exactly once
+  for (int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; c++) {
+      ASSERT_EQ(r * N + c + 1, check_array[c + r*N]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsMultiResourceTest);
+template <typename T>
+class TeamsMultiResourceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsMultiResourceTest, MultiResourceTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsMultiResourceTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(10, 1);
+  TeamsMultiResourceTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(10, 3);
+  // more resources than teams
+  TeamsMultiResourceTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(2, 4);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsMultiResourceTest,
+                            MultiResourceTeams);
+
+#endif  // __TEST_TEAMS_MULTI_RESOURCE_HPP__
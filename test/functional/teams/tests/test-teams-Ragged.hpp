@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_RAGGED_HPP__
+#define __TEST_TEAMS_RAGGED_HPP__
+
+#include <vector>
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsRaggedTestImpl(int N)
+{
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  // row r has (3 * r) % 7 positions, so some rows are empty
+  std::vector<int> offsets(N + 1, 0);
+  for (int r = 0; r < N; ++r) {
+    offsets[r + 1] = offsets[r] + (3 * r) % 7;
+  }
+  const int nnz = offsets[N];
+  std::vector<int> indices(nnz);
+  for (int k = 0; k < nnz; ++k) {
+    indices[k] = (5 * k) % N;
+  }
+
+  int* d_offsets = working_res.allocate<int>(N + 1);
+  int* d_indices = working_res.allocate<int>(nnz);
+  working_res.memcpy(d_offsets, offsets.data(), sizeof(int) * (N + 1));
+  working_res.memcpy(d_indices, indices.data(), sizeof(int) * nnz);
+
+  RAJA::TypedRaggedSegment<int> nbrs(d_offsets, d_indices, N, nnz);
+
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(2*nnz,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(4), RAJA::expt::Threads(16)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                RAJA::expt::loop_ragged<THREAD_POLICY>(ctx, nbrs, r, [&](int k, int n) {
+                    working_array[k] = 1000 * r + n;
+                });
+
+              });  // loop r
+
+          RAJA::expt::loop_ragged_balanced<TEAM_POLICY>(ctx, nbrs, 4, [&](RAJA::Index_type r) {
+
+                RAJA::expt::loop_ragged<THREAD_POLICY>(ctx, nbrs, r, [&](int k, int n) {
+                    working_array[nnz + k] = 1000 * static_cast<int>(r) + n;
+                });
+
+              });  // loop parts
+        });  // outer lambda
+
+
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * 2*nnz);
+
+  for (int r = 0; r < N; ++r) {
+    for (int k = offsets[r]; k < offsets[r + 1]; ++k) {
+      ASSERT_EQ(1000 * r + indices[k], check_array[k]);
+      ASSERT_EQ(1000 * r + indices[k], check_array[nnz + k]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+
+  working_res.deallocate(d_offsets);
+  working_res.deallocate(d_indices);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsRaggedTest);
+template <typename T>
+class TeamsRaggedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsRaggedTest, RaggedTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsRaggedTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(37);
+  TeamsRaggedTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(200);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsRaggedTest,
+                            RaggedTeams);
+
+#endif  // __TEST_TEAMS_RAGGED_HPP__
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_SIMD_THREADS_HPP__
+#define __TEST_TEAMS_SIMD_THREADS_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsSimdThreadsTestImpl(int N)
+{
+  // thread loops run as simd loops on the host
+#if defined(RAJA_DEVICE_ACTIVE)
+  using SIMD_POLICY = RAJA::expt::LoopPolicy<RAJA::simd_exec,
+                                             typename THREAD_POLICY::device_policy_t>;
+#else
+  using SIMD_POLICY = RAJA::expt::LoopPolicy<RAJA::simd_exec>;
+#endif
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(N), RAJA::expt::Threads(N)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                RAJA_TEAM_SHARED int s_A[1024];
+
+                RAJA::expt::loop_icount<SIMD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c, int ic) {
+                    s_A[c] = r * N + ic;
+                });
+
+                ctx.teamSync();
+
+                //read the values written by other threads of the team
+                RAJA::expt::loop<SIMD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    working_array[c + N*r] = s_A[N - 1 - c];
+                });
+
+              });  // loop r
+        });  // outer lambda
+
+
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N*N);
+
+  for(int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; c++) {
+      ASSERT_EQ(r * N + (N - 1 - c), check_array[c + r*N]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsSimdThreadsTest);
+template <typename T>
+class TeamsSimdThreadsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsSimdThreadsTest, SimdThreadsTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsSimdThreadsTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(32);
+  TeamsSimdThreadsTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(100);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsSimdThreadsTest,
+                            SimdThreadsTeams);
+
+#endif  // __TEST_TEAMS_SIMD_THREADS_HPP__
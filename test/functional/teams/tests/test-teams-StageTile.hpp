@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_STAGE_TILE_HPP__
+#define __TEST_TEAMS_STAGE_TILE_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsStageTileTestImpl(int R, int K)
+{
+  constexpr int T = 8;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(R*K + R,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  for (int i = 0; i < R*K; ++i) {
+    test_array[i] = (37 * i) % 101;
+  }
+  for (int r = 0; r < R; ++r) {
+    test_array[R*K + r] = 0;
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(int) * (R*K + R));
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+  RAJA::View<int, RAJA::Layout<2>> A(working_array, R, K);
+  int* sums = working_array + R*K;
+
+  const int num_row_tiles = (R + T - 1) / T;
+  const int num_tiles = (K + T - 1) / T;
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(num_row_tiles), RAJA::expt::Threads(T)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, num_row_tiles), [&](int rt) {
+
+            RAJA_TEAM_SHARED RAJA::expt::StagedTiles<int, T, T, 2> As;
+
+            const int r0 = rt * T;
+            const int rows = R - r0 < T ? R - r0 : T;
+
+            auto cols = [=](int k) {
+              return k >= num_tiles ? 0 : (K - k * T < T ? K - k * T : T);
+            };
+
+            RAJA::expt::stage_tile<THREAD_POLICY, RAJA::loop_exec>(
+                ctx, As.tile(0), T, A, r0, 0, rows, cols(0));
+
+            for (int k = 0; k < num_tiles; ++k) {
+              RAJA::expt::stage_tile<THREAD_POLICY, RAJA::loop_exec>(
+                  ctx, As.tile(k + 1), T, A, r0, (k + 1) * T,
+                  cols(k + 1) > 0 ? rows : 0, cols(k + 1));
+              RAJA::expt::stage_wait<2>(ctx);
+
+              int* tile = As.tile(k);
+              RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, rows), [&](int r) {
+                for (int c = 0; c < cols(k); ++c) {
+                  sums[r0 + r] += tile[r * T + c];
+                }
+              });
+
+              ctx.teamSync();
+            }
+
+          });
+        });
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * (R*K + R));
+
+  for (int r = 0; r < R; ++r) {
+    int ref = 0;
+    for (int c = 0; c < K; ++c) {
+      ref += test_array[r*K + c];
+    }
+    ASSERT_EQ(ref, check_array[R*K + r]);
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsStageTileTest);
+template <typename T>
+class TeamsStageTileTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsStageTileTest, StageTileTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsStageTileTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(64, 100);
+  TeamsStageTileTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(13, 8);
+  TeamsStageTileTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(5, 3);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsStageTileTest,
+                            StageTileTeams);
+
+#endif  // __TEST_TEAMS_STAGE_TILE_HPP__
@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_TEAM_REDUCE_HPP__
+#define __TEST_TEAMS_TEAM_REDUCE_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsTeamReduceTestImpl(int N, int T, int M)
+{
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  RAJA::expt::TeamReduceSum<long> sum(working_res, 0);
+  RAJA::expt::TeamReduceMin<int> min(working_res, N*M);
+  RAJA::expt::TeamReduceMax<int> max(working_res, -1);
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(N), RAJA::expt::Threads(T)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                int part = 0;
+                int part_min = N*M;
+                int part_max = -1;
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, M), [&](int c) {
+                    const int val = r * M + c;
+                    part += val;
+                    part_min = val < part_min ? val : part_min;
+                    part_max = val > part_max ? val : part_max;
+                });
+
+                const int team_sum =
+                    ctx.teamReduce(part, RAJA::operators::plus<int>{}, 0);
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, 1), [&](int) {
+                    working_array[r] = team_sum;
+                });
+
+                sum.combine(ctx, part);
+                min.combine(ctx, part_min);
+                max.combine(ctx, part_max);
+
+              });  // loop r
+        });  // outer lambda
+
+
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N);
+
+  for (int r = 0; r < N; ++r) {
+    ASSERT_EQ(r * M * M + M * (M - 1) / 2, check_array[r]);
+  }
+
+  const long total = static_cast<long>(N) * M;
+  ASSERT_EQ(total * (total - 1) / 2, sum.get());
+  ASSERT_EQ(0, min.get());
+  ASSERT_EQ(N * M - 1, max.get());
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsTeamReduceTest);
+template <typename T>
+class TeamsTeamReduceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsTeamReduceTest, TeamReduceTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  // a team size that is a multiple of the warp size and one that is not
+  TeamsTeamReduceTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(8, 64, 1000);
+  TeamsTeamReduceTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(8, 100, 1000);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsTeamReduceTest,
+                            TeamReduceTeams);
+
+#endif  // __TEST_TEAMS_TEAM_REDUCE_HPP__
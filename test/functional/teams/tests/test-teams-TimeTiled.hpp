@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_TIME_TILED_HPP__
+#define __TEST_TEAMS_TIME_TILED_HPP__
+
+#include <vector>
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsTimeTiledTestImpl(int N, int radius, int space_tile, int time_tile, int num_steps)
+{
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(2*N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  // ghost points at both ends hold the same values in both arrays
+  for (int i = 0; i < N; ++i) {
+    test_array[i] = test_array[N + i] = (37 * i) % 101;
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(int) * 2*N);
+
+  // reference, one step at a time
+  std::vector<int> ref(test_array, test_array + 2*N);
+  for (int t = 0; t < num_steps; ++t) {
+    const int* src = &ref[(t % 2) * N];
+    int* dst = &ref[((t + 1) % 2) * N];
+    for (int i = radius; i < N - radius; ++i) {
+      int v = t;
+      for (int k = -radius; k <= radius; ++k) {
+        v += (k + radius + 1) * src[i + k];
+      }
+      dst[i] = v % 9973;
+    }
+  }
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+  RAJA::expt::launch_time_tiled<LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(
+    select_cpu_or_gpu, 64,
+    RAJA::TypedRangeSegment<int>(radius, N - radius),
+    num_steps,
+    RAJA::expt::TimeTiling(radius, space_tile, time_tile),
+    [=] RAJA_HOST_DEVICE(RAJA::Index_type t, int i) {
+      const int* src = working_array + (t % 2) * N;
+      int* dst = working_array + ((t + 1) % 2) * N;
+      int v = static_cast<int>(t);
+      for (int k = -radius; k <= radius; ++k) {
+        v += (k + radius + 1) * src[i + k];
+      }
+      dst[i] = v % 9973;
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * 2*N);
+
+  for (int i = 0; i < 2*N; ++i) {
+    ASSERT_EQ(ref[i], check_array[i]);
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsTimeTiledTest);
+template <typename T>
+class TeamsTimeTiledTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsTimeTiledTest, TimeTiledTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsTimeTiledTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(1000, 1, 64, 8, 21);
+  TeamsTimeTiledTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(1000, 2, 16, 8, 9);
+  TeamsTimeTiledTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(101, 1, 200, 4, 7);
+  TeamsTimeTiledTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(101, 0, 10, 4, 7);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsTimeTiledTest,
+                            TimeTiledTeams);
+
+#endif  // __TEST_TEAMS_TIME_TILED_HPP__
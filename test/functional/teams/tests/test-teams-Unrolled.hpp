@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_UNROLLED_HPP__
+#define __TEST_TEAMS_UNROLLED_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsUnrolledTestImpl(int N, int M)
+{
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(2*N*M,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(N), RAJA::expt::Threads(16)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                // four partial sums per thread, kept in registers
+                RAJA::expt::tile_register<THREAD_POLICY, 4>(ctx, RAJA::RangeSegment(0, M),
+                  [&](RAJA::expt::RegisterBlock<RAJA::Index_type, 4> const &blk) {
+                    int acc[4] = {0, 0, 0, 0};
+                    for (int j = 0; j <= r; ++j) {
+                      blk.for_each([&](int k, RAJA::Index_type c) { acc[k] += c + 1; });
+                    }
+                    blk.for_each([&](int k, RAJA::Index_type c) {
+                      working_array[c + M*r] = acc[k];
+                    });
+                });
+
+                RAJA::expt::loop_unrolled<THREAD_POLICY, 3>(ctx, RAJA::RangeSegment(0, M),
+                  [&](RAJA::Index_type c) {
+                    working_array[N*M + c + M*r] = r * M + static_cast<int>(c);
+                });
+
+              });  // loop r
+        });  // outer lambda
+
+
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * 2*N*M);
+
+  for (int r = 0; r < N; ++r) {
+    for (int c = 0; c < M; c++) {
+      ASSERT_EQ((r + 1) * (c + 1), check_array[c + M*r]);
+      ASSERT_EQ(r * M + c, check_array[N*M + c + M*r]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsUnrolledTest);
+template <typename T>
+class TeamsUnrolledTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsUnrolledTest, UnrolledTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  // lengths that are and are not multiples of the block sizes
+  TeamsUnrolledTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(8, 96);
+  TeamsUnrolledTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(8, 103);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsUnrolledTest,
+                            UnrolledTeams);
+
+#endif  // __TEST_TEAMS_UNROLLED_HPP__
@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_WARP_COLLECTIVES_HPP__
+#define __TEST_TEAMS_WARP_COLLECTIVES_HPP__
+
+// number of values written by each thread
+constexpr int num_warp_results = 6;
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsWarpCollectivesTestImpl(int N)
+{
+  // a multiple of the warp size of every back-end
+  constexpr int T = 64;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(num_warp_results*N*T,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(N), RAJA::expt::Threads(T)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, T), [&](int t) {
+
+                    const int val = t + 1;
+                    int* out = &working_array[num_warp_results*(t + T*r)];
+
+                    out[0] = ctx.warpSize();
+                    out[1] = ctx.warpReduce(val, RAJA::operators::plus<int>{});
+                    out[2] = ctx.warpInclusiveScan(val, RAJA::operators::plus<int>{});
+                    out[3] = ctx.warpExclusiveScan(val, RAJA::operators::plus<int>{}, 0);
+                    out[4] = ctx.warpBroadcast(val, ctx.warpSize() - 1);
+
+                    unsigned long long mask = ctx.warpBallot(t % 2 == 0);
+                    int count = 0;
+                    for (; mask != 0; mask &= mask - 1) {
+                      ++count;
+                    }
+                    out[5] = count;
+                });
+
+              });  // loop r
+        });  // outer lambda
+
+
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * num_warp_results*N*T);
+
+  const int warp_size = check_array[0];
+  ASSERT_GE(warp_size, 1);
+  ASSERT_EQ(T % warp_size, 0);
+
+  for (int r = 0; r < N; ++r) {
+    for (int t = 0; t < T; ++t) {
+      const int* out = &check_array[num_warp_results*(t + T*r)];
+      const int lane = t % warp_size;
+      const int first = t - lane + 1;
+      const int last = first + warp_size - 1;
+
+      int even = 0;
+      for (int l = t - lane; l <= last - 1; ++l) {
+        even += (l % 2 == 0) ? 1 : 0;
+      }
+
+      ASSERT_EQ(warp_size, out[0]);
+      ASSERT_EQ((first + last) * warp_size / 2, out[1]);
+      ASSERT_EQ((first + t + 1) * (lane + 1) / 2, out[2]);
+      ASSERT_EQ(out[2] - (t + 1), out[3]);
+      ASSERT_EQ(last, out[4]);
+      ASSERT_EQ(even, out[5]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsWarpCollectivesTest);
+template <typename T>
+class TeamsWarpCollectivesTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsWarpCollectivesTest, WarpCollectivesTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsWarpCollectivesTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(4);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsWarpCollectivesTest,
+                            WarpCollectivesTeams);
+
+#endif  // __TEST_TEAMS_WARP_COLLECTIVES_HPP__
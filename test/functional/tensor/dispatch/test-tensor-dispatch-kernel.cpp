@@ -0,0 +1,33 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-tensor-dispatch-kernel.hpp"
+
+template<typename REGISTER_POLICY>
+int tensor_dispatch_daxpy(double *y, double const *x, double a, int N)
+{
+  using register_t = RAJA::expt::Register<double, REGISTER_POLICY>;
+
+  int i = 0;
+  for(;i + register_t::s_num_elem <= N; i += register_t::s_num_elem){
+    register_t x_reg, y_reg;
+    x_reg.load_packed(x + i);
+    y_reg.load_packed(y + i);
+    x_reg.multiply_add(register_t(a), y_reg).store_packed(y + i);
+  }
+
+  if(i < N){
+    register_t x_reg, y_reg;
+    x_reg.load_packed_n(x + i, N - i);
+    y_reg.load_packed_n(y + i, N - i);
+    x_reg.multiply_add(register_t(a), y_reg).store_packed_n(y + i, N - i);
+  }
+
+  return (int)RAJA::expt::RegisterPolicyISA<REGISTER_POLICY>::value;
+}
+
+RAJA_TENSOR_DISPATCH_DEFINE(tensor_dispatch_daxpy)
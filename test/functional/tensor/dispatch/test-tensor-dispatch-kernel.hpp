@@ -0,0 +1,21 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TENSOR_DISPATCH_KERNEL_HPP__
+#define __TEST_TENSOR_DISPATCH_KERNEL_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+/*
+ * y += a*x, returning the instruction set it was compiled for
+ */
+template<typename REGISTER_POLICY>
+int tensor_dispatch_daxpy(double *y, double const *x, double a, int N);
+
+RAJA_TENSOR_DISPATCH_DECLARE(tensor_dispatch_daxpy)
+
+#endif
@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for runtime dispatch of tensor kernels.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "test-tensor-dispatch-kernel.hpp"
+
+#include <vector>
+
+TEST(TensorDispatch, Daxpy)
+{
+  using RAJA::expt::RegisterISA;
+
+  // the best variant that was built and that this CPU supports
+  RegisterISA expected =
+    RAJA::expt::RegisterPolicyISA<RAJA::expt::default_register>::value;
+#ifdef RAJA_TENSOR_DISPATCH_HAVE_AVX2
+  if(RAJA::expt::cpuSupportsRegisterISA(RegisterISA::avx2)){
+    expected = RegisterISA::avx2;
+  }
+#endif
+#ifdef RAJA_TENSOR_DISPATCH_HAVE_AVX512
+  if(RAJA::expt::cpuSupportsRegisterISA(RegisterISA::avx512)){
+    expected = RegisterISA::avx512;
+  }
+#endif
+
+  // with a partial last register
+  int const N = 37;
+
+  std::vector<double> x(N), y(N);
+  for(int i = 0;i < N;++ i){
+    x[i] = i;
+    y[i] = 2*i + 1;
+  }
+
+  int isa = RAJA_TENSOR_DISPATCH(tensor_dispatch_daxpy)(y.data(), x.data(), 3.0, N);
+
+  ASSERT_EQ((int)expected, isa);
+
+  for(int i = 0;i < N;++ i){
+    ASSERT_EQ(double(5*i + 1), y[i]);
+  }
+
+  // the choice is made once
+  ASSERT_EQ(RAJA_TENSOR_DISPATCH(tensor_dispatch_daxpy),
+            RAJA_TENSOR_DISPATCH(tensor_dispatch_daxpy));
+}
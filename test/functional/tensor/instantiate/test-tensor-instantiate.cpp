@@ -0,0 +1,160 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests of the tensor registers RAJA instantiates
+/// with RAJA_ENABLE_TENSOR_INSTANTIATIONS, and of the eval types of the
+/// expressions built on them.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <type_traits>
+#include <vector>
+
+//
+// The full width vectors of the default register are in the instantiated
+// set, so with RAJA_ENABLE_TENSOR_INSTANTIATIONS this uses the members the
+// RAJA library holds.  Arithmetic and comparisons evaluate to the vector
+// and its mask, and a select of them gives the values of a scalar loop for
+// every partial length.
+//
+template <typename T>
+void InstantiatedVectorTestImpl()
+{
+  using vector_t = RAJA::expt::VectorRegister<T>;
+  using mask_t = typename vector_t::mask_type;
+  using idx_t = RAJA::VectorIndex<int, vector_t>;
+
+  static constexpr camp::idx_t N = vector_t::s_num_elem;
+
+  std::vector<T> x_vec(N), y_vec(N), z_vec(N);
+  RAJA::View<T, RAJA::Layout<1>> x(x_vec.data(), N);
+  RAJA::View<T, RAJA::Layout<1>> y(y_vec.data(), N);
+  RAJA::View<T, RAJA::Layout<1>> z(z_vec.data(), N);
+
+  for (camp::idx_t i = 0; i < N; ++i) {
+    x_vec[i] = T(i % 3) - T(1);
+    y_vec[i] = T(N / 2 - i);
+  }
+
+  auto all = idx_t::all();
+
+  static_assert(std::is_same<typename decltype(x(all) + y(all))::eval_type,
+                             vector_t>::value, "");
+  static_assert(std::is_same<typename decltype(x(all) - y(all))::eval_type,
+                             vector_t>::value, "");
+  static_assert(std::is_same<typename decltype(x(all) < y(all))::eval_type,
+                             mask_t>::value, "");
+  static_assert(std::is_same<typename decltype(x(all) == T(0))::eval_type,
+                             mask_t>::value, "");
+  static_assert(std::is_same<typename decltype(x(all) + y(all) >= x(all))::eval_type,
+                             mask_t>::value, "");
+
+  for (camp::idx_t n = 0; n <= N; ++n) {
+    for (camp::idx_t i = 0; i < N; ++i) {
+      z_vec[i] = T(-7);
+    }
+
+    auto part = idx_t::range(0, n);
+    z(part) = RAJA::expt::select(x(part) < y(part),
+                                 x(part) * y(part) + y(part),
+                                 y(part) - x(part));
+
+    for (camp::idx_t i = 0; i < N; ++i) {
+      T expected = T(-7);
+      if (i < n) {
+        expected = x_vec[i] < y_vec[i] ? x_vec[i] * y_vec[i] + y_vec[i]
+                                       : y_vec[i] - x_vec[i];
+      }
+      ASSERT_EQ(expected, z_vec[i]) << "n " << n << " index " << i;
+    }
+  }
+}
+
+//
+// The square matrices of the default register, in both layouts, are in the
+// instantiated set too.  Sums and differences evaluate to the matrix and
+// comparisons to its mask, and products and sums of products give the
+// values of a scalar loop.
+//
+template <typename T, typename LAYOUT>
+void InstantiatedMatrixTestImpl()
+{
+  using matrix_t = RAJA::expt::SquareMatrixRegister<T, LAYOUT>;
+  using mask_t = typename matrix_t::mask_type;
+
+  static constexpr camp::idx_t N = matrix_t::s_num_rows;
+
+  std::vector<T> a_vec(N*N), b_vec(N*N), c_vec(N*N);
+  RAJA::View<T, RAJA::Layout<2>> a(a_vec.data(), N, N);
+  RAJA::View<T, RAJA::Layout<2>> b(b_vec.data(), N, N);
+  RAJA::View<T, RAJA::Layout<2>> c(c_vec.data(), N, N);
+
+  for (camp::idx_t i = 0; i < N; ++i) {
+    for (camp::idx_t j = 0; j < N; ++j) {
+      a(i, j) = T((i + 2 * j) % 5) - T(2);
+      b(i, j) = T((3 * i + j) % 4) - T(1);
+    }
+  }
+
+  auto rows = RAJA::RowIndex<int, matrix_t>::all();
+  auto cols = RAJA::ColIndex<int, matrix_t>::all();
+
+  static_assert(std::is_same<typename decltype(a(rows, cols) + b(rows, cols))::eval_type,
+                             matrix_t>::value, "");
+  static_assert(std::is_same<typename decltype(a(rows, cols) - b(rows, cols))::eval_type,
+                             matrix_t>::value, "");
+  static_assert(std::is_same<typename decltype(a(rows, cols) < b(rows, cols))::eval_type,
+                             mask_t>::value, "");
+
+  c(rows, cols) = a(rows, cols) * b(rows, cols);
+
+  for (camp::idx_t i = 0; i < N; ++i) {
+    for (camp::idx_t j = 0; j < N; ++j) {
+      T expected(0);
+      for (camp::idx_t k = 0; k < N; ++k) {
+        expected += a(i, k) * b(k, j);
+      }
+      ASSERT_EQ(expected, c(i, j)) << "i " << i << " j " << j;
+    }
+  }
+
+  c(rows, cols) = a(rows, cols) * b(rows, cols) + a(rows, cols) - b(rows, cols);
+
+  for (camp::idx_t i = 0; i < N; ++i) {
+    for (camp::idx_t j = 0; j < N; ++j) {
+      T expected = a(i, j) - b(i, j);
+      for (camp::idx_t k = 0; k < N; ++k) {
+        expected += a(i, k) * b(k, j);
+      }
+      ASSERT_EQ(expected, c(i, j)) << "i " << i << " j " << j;
+    }
+  }
+}
+
+TEST(TensorInstantiate, VectorFloat)
+{
+  InstantiatedVectorTestImpl<float>();
+}
+
+TEST(TensorInstantiate, VectorDouble)
+{
+  InstantiatedVectorTestImpl<double>();
+}
+
+TEST(TensorInstantiate, MatrixFloat)
+{
+  InstantiatedMatrixTestImpl<float, RAJA::expt::RowMajorLayout>();
+  InstantiatedMatrixTestImpl<float, RAJA::expt::ColMajorLayout>();
+}
+
+TEST(TensorInstantiate, MatrixDouble)
+{
+  InstantiatedMatrixTestImpl<double, RAJA::expt::RowMajorLayout>();
+  InstantiatedMatrixTestImpl<double, RAJA::expt::ColMajorLayout>();
+}
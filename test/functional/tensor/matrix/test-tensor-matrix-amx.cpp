@@ -0,0 +1,168 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the bfloat16 matrix products of the
+/// amx_register policy.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+#ifdef RAJA_TENSOR_ARCH_AMX
+
+#include <cpuid.h>
+
+// AMX-TILE and AMX-BF16 are bits 24 and 22 of cpuid leaf 7 edx
+static bool cpuSupportsAmxBf16()
+{
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)){
+    return false;
+  }
+  return (edx & (1u << 24)) && (edx & (1u << 22));
+}
+
+using RAJA::expt::bfloat16_t;
+
+// small integers, so the bfloat16 products and their float sums are exact
+// whatever order the tiles accumulate in
+static float amxA(int i, int k) { return float((i + 2*k) % 5 - 2); }
+static float amxB(int k, int j) { return float((3*k + j) % 7 - 3); }
+static float amxC(int i, int j) { return float((i + j) % 3); }
+
+//
+// A*B, A*B+C and C+=A*B on AMX tiles match a float loop and the same
+// products of AVX512 registers, for a K that fills the tiles and one that
+// is padded.
+//
+template<typename LAYOUT, camp::idx_t M, camp::idx_t K, camp::idx_t N>
+void AmxMatrixMultiplyTestImpl()
+{
+  using A_t = RAJA::expt::RectMatrixRegister<bfloat16_t, LAYOUT, M, K, RAJA::expt::amx_register>;
+  using B_t = RAJA::expt::RectMatrixRegister<bfloat16_t, LAYOUT, K, N, RAJA::expt::amx_register>;
+  using C_t = RAJA::expt::RectMatrixRegister<bfloat16_t, LAYOUT, M, N, RAJA::expt::amx_register>;
+
+  using refA_t = RAJA::expt::RectMatrixRegister<bfloat16_t, LAYOUT, M, K, RAJA::expt::avx512_register>;
+  using refB_t = RAJA::expt::RectMatrixRegister<bfloat16_t, LAYOUT, K, N, RAJA::expt::avx512_register>;
+  using refC_t = RAJA::expt::RectMatrixRegister<bfloat16_t, LAYOUT, M, N, RAJA::expt::avx512_register>;
+
+  A_t A;
+  B_t B;
+  C_t C;
+  refA_t refA;
+  refB_t refB;
+  refC_t refC;
+  for(camp::idx_t i = 0;i < M;++ i){
+    for(camp::idx_t k = 0;k < K;++ k){
+      A.set(bfloat16_t(amxA(i, k)), i, k);
+      refA.set(bfloat16_t(amxA(i, k)), i, k);
+    }
+  }
+  for(camp::idx_t k = 0;k < K;++ k){
+    for(camp::idx_t j = 0;j < N;++ j){
+      B.set(bfloat16_t(amxB(k, j)), k, j);
+      refB.set(bfloat16_t(amxB(k, j)), k, j);
+    }
+  }
+  for(camp::idx_t i = 0;i < M;++ i){
+    for(camp::idx_t j = 0;j < N;++ j){
+      C.set(bfloat16_t(amxC(i, j)), i, j);
+      refC.set(bfloat16_t(amxC(i, j)), i, j);
+    }
+  }
+
+  std::vector<float> ref(M*N);
+  for(camp::idx_t i = 0;i < M;++ i){
+    for(camp::idx_t j = 0;j < N;++ j){
+      float sum = 0.0f;
+      for(camp::idx_t k = 0;k < K;++ k){
+        sum += amxA(i, k) * amxB(k, j);
+      }
+      ref[i*N + j] = sum;
+    }
+  }
+
+  C_t P = A.matrix_multiply(B);
+  C_t Q = A.matrix_multiply_add(B, C);
+  C_t R = C;
+  A.matrix_multiply_accumulate(R, B);
+
+  refC_t refP = refA.matrix_multiply(refB);
+  refC_t refQ = refA.matrix_multiply_add(refB, refC);
+
+  for(camp::idx_t i = 0;i < M;++ i){
+    for(camp::idx_t j = 0;j < N;++ j){
+      ASSERT_EQ(ref[i*N + j], float(P.get(i, j))) << i << "," << j;
+      ASSERT_EQ(ref[i*N + j] + amxC(i, j), float(Q.get(i, j))) << i << "," << j;
+      ASSERT_EQ(ref[i*N + j] + amxC(i, j), float(R.get(i, j))) << i << "," << j;
+      ASSERT_EQ(float(refP.get(i, j)), float(P.get(i, j))) << i << "," << j;
+      ASSERT_EQ(float(refQ.get(i, j)), float(Q.get(i, j))) << i << "," << j;
+    }
+  }
+}
+
+TEST(TensorMatrixAmx, RowMajorMultiply)
+{
+  // nothing runs on cpus without AMX
+  if(!cpuSupportsAmxBf16()){
+    return;
+  }
+  AmxMatrixMultiplyTestImpl<RAJA::expt::RowMajorLayout, 16, 32, 16>();
+  AmxMatrixMultiplyTestImpl<RAJA::expt::RowMajorLayout, 16, 16, 16>();
+  AmxMatrixMultiplyTestImpl<RAJA::expt::RowMajorLayout, 32, 32, 16>();
+}
+
+TEST(TensorMatrixAmx, ColMajorMultiply)
+{
+  // nothing runs on cpus without AMX
+  if(!cpuSupportsAmxBf16()){
+    return;
+  }
+  AmxMatrixMultiplyTestImpl<RAJA::expt::ColMajorLayout, 16, 32, 16>();
+  AmxMatrixMultiplyTestImpl<RAJA::expt::ColMajorLayout, 16, 16, 16>();
+  AmxMatrixMultiplyTestImpl<RAJA::expt::ColMajorLayout, 16, 32, 32>();
+}
+
+//
+// A scope configures the tiles up front and releases them at its end,
+// products outside of it configure the tiles again on first use.
+//
+TEST(TensorMatrixAmx, TileScope)
+{
+  // nothing runs on cpus without AMX
+  if(!cpuSupportsAmxBf16()){
+    return;
+  }
+  using RAJA::internal::expt::amx_tiles_configured;
+
+  AmxMatrixMultiplyTestImpl<RAJA::expt::RowMajorLayout, 16, 32, 16>();
+  ASSERT_TRUE(amx_tiles_configured());
+
+  // a scope inside configured tiles does not release them
+  {
+    RAJA::expt::amx_tile_scope scope;
+    ASSERT_TRUE(amx_tiles_configured());
+  }
+  ASSERT_TRUE(amx_tiles_configured());
+
+  _tile_release();
+  amx_tiles_configured() = false;
+
+  {
+    RAJA::expt::amx_tile_scope scope;
+    ASSERT_TRUE(amx_tiles_configured());
+    AmxMatrixMultiplyTestImpl<RAJA::expt::RowMajorLayout, 16, 32, 16>();
+  }
+  ASSERT_FALSE(amx_tiles_configured());
+
+  AmxMatrixMultiplyTestImpl<RAJA::expt::ColMajorLayout, 16, 32, 16>();
+  ASSERT_TRUE(amx_tiles_configured());
+}
+
+#endif
@@ -16,12 +16,16 @@ using TensorMatrixTypes = ::testing::Types<
 #ifdef RAJA_ENABLE_CUDA
     RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 8,4, RAJA::cuda_warp_register>,
     RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 8,8, RAJA::cuda_warp_register>,
+    RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 8,8, RAJA::cuda_mma_register>,
+    RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 16,8, RAJA::cuda_mma_register>,
 #endif
 
 #ifdef RAJA_ENABLE_HIP
     RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 16,8, RAJA::hip_wave_register>,
     RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 8,8, RAJA::hip_wave_register>,
     RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 8,16, RAJA::hip_wave_register>,
+    RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 16,16, RAJA::hip_mfma_register>,
+    RAJA::RectMatrixRegister<MatrixElementType, TensorMatrixLayoutType, 32,16, RAJA::hip_mfma_register>,
 #endif
 
 
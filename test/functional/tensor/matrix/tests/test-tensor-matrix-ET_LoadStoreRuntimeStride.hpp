@@ -0,0 +1,134 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_MATRIX_ET_LoadStoreRuntimeStride_HPP__
+#define __TEST_TESNOR_MATRIX_ET_LoadStoreRuntimeStride_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+//
+// Views with run time layouts, whose stride one dimension is only known
+// when the expression is built.  A row-major padded view has unit stride
+// columns, and a permuted view unit stride rows, so each copy between them
+// takes the packed path on one side and the strided path on the other, for
+// full and partial matrices.
+//
+template <typename MATRIX_TYPE>
+void ET_LoadStoreRuntimeStrideImpl()
+{
+
+  using matrix_t = MATRIX_TYPE;
+  using policy_t = typename matrix_t::register_policy;
+  using element_t = typename matrix_t::element_type;
+
+  static constexpr camp::idx_t R = matrix_t::s_num_rows;
+  static constexpr camp::idx_t C = matrix_t::s_num_columns;
+  static constexpr camp::idx_t pad = 3;
+
+  RAJA::Layout<2> padded_layout =
+      RAJA::make_padded_layout<2>({{R, C}}, {{0, pad}});
+  RAJA::Layout<2> permuted_layout =
+      RAJA::make_permuted_layout<2>({{R, C}},
+                                    RAJA::as_array<RAJA::PERM_JI>::get());
+
+  // alloc data1 - padded row-major source
+  std::vector<element_t> data1_vec(R*(C+pad));
+  RAJA::View<element_t, RAJA::Layout<2>> data1_h(data1_vec.data(), padded_layout);
+
+  element_t *data1_ptr = tensor_malloc<policy_t>(data1_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data1_d(data1_ptr, padded_layout);
+
+  // alloc data2 - column-major copy
+  std::vector<element_t> data2_vec(R*C);
+  RAJA::View<element_t, RAJA::Layout<2>> data2_h(data2_vec.data(), permuted_layout);
+
+  element_t *data2_ptr = tensor_malloc<policy_t>(data2_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data2_d(data2_ptr, permuted_layout);
+
+  // alloc data3 - padded row-major copy back
+  std::vector<element_t> data3_vec(R*(C+pad));
+  RAJA::View<element_t, RAJA::Layout<2>> data3_h(data3_vec.data(), padded_layout);
+
+  element_t *data3_ptr = tensor_malloc<policy_t>(data3_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data3_d(data3_ptr, padded_layout);
+
+
+  for(camp::idx_t i = 0;i < R*(C+pad); ++ i){
+    data1_vec[i] = element_t(-2);
+  }
+  for(camp::idx_t i = 0;i < R; ++ i){
+    for(camp::idx_t j = 0;j < C; ++ j){
+      data1_h(i,j) = i*C+j;
+    }
+  }
+  tensor_copy_to_device<policy_t>(data1_ptr, data1_vec);
+
+
+  for(camp::idx_t n_size = 0;n_size <= R; ++ n_size){
+    for(camp::idx_t m_size = 0;m_size <= C; ++ m_size){
+
+      for(camp::idx_t i = 0;i < R*C; ++ i){
+        data2_vec[i] = element_t(-1);
+      }
+      for(camp::idx_t i = 0;i < R*(C+pad); ++ i){
+        data3_vec[i] = element_t(-1);
+      }
+      tensor_copy_to_device<policy_t>(data2_ptr, data2_vec);
+      tensor_copy_to_device<policy_t>(data3_ptr, data3_vec);
+
+      tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+        auto rows = RAJA::RowIndex<int, matrix_t>::range(0, n_size);
+        auto cols = RAJA::ColIndex<int, matrix_t>::range(0, m_size);
+
+        data2_d(rows, cols) = data1_d(rows, cols);
+        data3_d(rows, cols) = data2_d(rows, cols);
+      });
+
+      tensor_copy_to_host<policy_t>(data2_vec, data2_ptr);
+      tensor_copy_to_host<policy_t>(data3_vec, data3_ptr);
+
+      for(camp::idx_t i = 0;i < R; ++ i){
+        for(camp::idx_t j = 0;j < C; ++ j){
+          if(i < n_size && j < m_size){
+            ASSERT_SCALAR_EQ(data1_h(i,j), data2_h(i,j));
+            ASSERT_SCALAR_EQ(data1_h(i,j), data3_h(i,j));
+          }
+          else{
+            ASSERT_SCALAR_EQ(element_t(-1), data2_h(i,j));
+            ASSERT_SCALAR_EQ(element_t(-1), data3_h(i,j));
+          }
+        }
+      }
+
+      // the padding is never written
+      for(camp::idx_t i = 0;i < R; ++ i){
+        for(camp::idx_t j = C;j < C+pad; ++ j){
+          ASSERT_SCALAR_EQ(element_t(-1), data3_vec[i*(C+pad)+j]);
+        }
+      }
+
+    }
+  }
+
+
+  //
+  // Free data
+  //
+  tensor_free<policy_t>(data1_ptr);
+  tensor_free<policy_t>(data2_ptr);
+  tensor_free<policy_t>(data3_ptr);
+}
+
+
+
+TYPED_TEST_P(TestTensorMatrix, ET_LoadStoreRuntimeStride)
+{
+  ET_LoadStoreRuntimeStrideImpl<TypeParam>();
+}
+
+
+#endif
@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_MATRIX_ET_MatrixMatrixMultiplyBlocked_HPP__
+#define __TEST_TESNOR_MATRIX_ET_MatrixMatrixMultiplyBlocked_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename MATRIX_TYPE>
+void ET_MatrixMatrixMultiplyBlockedImpl()
+{
+
+  using matrix_t = MATRIX_TYPE;
+  using policy_t = typename matrix_t::register_policy;
+  using element_t = typename matrix_t::element_type;
+
+
+  using A_matrix_t = matrix_t;
+  using B_matrix_t = typename matrix_t::transpose_type;
+  using C_matrix_t = typename matrix_t::product_type;
+
+  // large enough to be cache blocked, with several k-blocks and edge tiles
+  static constexpr camp::idx_t T = RAJA::max<camp::idx_t>(matrix_t::s_num_rows, matrix_t::s_num_columns);
+  camp::idx_t const M = 80 + T + 3;
+  camp::idx_t const N = 2*T + 3;
+  camp::idx_t const K = 256 + T + 3;
+
+  //
+  // Allocate Row-Major Data
+  //
+
+  std::vector<element_t> data1_vec(M*K);
+  RAJA::View<element_t, RAJA::Layout<2>> data1_h(data1_vec.data(), M, K);
+
+  element_t *data1_ptr = tensor_malloc<policy_t>(data1_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data1_d(data1_ptr, M, K);
+
+
+  std::vector<element_t> data2_vec(K*N);
+  RAJA::View<element_t, RAJA::Layout<2>> data2_h(data2_vec.data(), K, N);
+
+  element_t *data2_ptr = tensor_malloc<policy_t>(data2_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data2_d(data2_ptr, K, N);
+
+
+  std::vector<element_t> data3_vec(M*N);
+  RAJA::View<element_t, RAJA::Layout<2>> data3_h(data3_vec.data(), M, N);
+
+  element_t *data3_ptr = tensor_malloc<policy_t>(data3_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data3_d(data3_ptr, M, N);
+
+
+  // small integers keep every sum exact
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t k = 0;k < K; ++ k){
+      data1_h(i,k) = (i+2*k)%5;
+    }
+  }
+  for(camp::idx_t k = 0;k < K; ++ k){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      data2_h(k,j) = (3*k+j)%4;
+    }
+  }
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      data3_h(i,j) = (i+j)%3;
+    }
+  }
+
+  tensor_copy_to_device<policy_t>(data1_ptr, data1_vec);
+  tensor_copy_to_device<policy_t>(data2_ptr, data2_vec);
+  tensor_copy_to_device<policy_t>(data3_ptr, data3_vec);
+
+
+  //
+  // Do Operation: C += A*B over offset ranges, then C = A*B
+  //
+  camp::idx_t const r0 = 1;
+  camp::idx_t const c0 = 2;
+  camp::idx_t const k0 = 3;
+
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    auto A_rows = RAJA::RowIndex<int, A_matrix_t>::range(r0, M);
+    auto A_cols = RAJA::ColIndex<int, A_matrix_t>::range(k0, K);
+
+    auto B_rows = RAJA::RowIndex<int, B_matrix_t>::range(k0, K);
+    auto B_cols = RAJA::ColIndex<int, B_matrix_t>::range(c0, N);
+
+    auto C_rows = RAJA::RowIndex<int, C_matrix_t>::range(r0, M);
+    auto C_cols = RAJA::ColIndex<int, C_matrix_t>::range(c0, N);
+
+    data3_d(C_rows, C_cols) += data1_d(A_rows, A_cols) * data2_d(B_rows, B_cols);
+
+  });
+
+  tensor_copy_to_host<policy_t>(data3_vec, data3_ptr);
+
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      element_t expected = (i+j)%3;
+      if(i >= r0 && j >= c0){
+        for(camp::idx_t k = k0;k < K; ++ k){
+          expected += data1_h(i,k)*data2_h(k,j);
+        }
+      }
+
+      ASSERT_SCALAR_EQ(expected, data3_h(i,j));
+    }
+  }
+
+
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    auto A_rows = RAJA::RowIndex<int, A_matrix_t>::all();
+    auto A_cols = RAJA::ColIndex<int, A_matrix_t>::all();
+
+    auto B_rows = RAJA::RowIndex<int, B_matrix_t>::all();
+    auto B_cols = RAJA::ColIndex<int, B_matrix_t>::all();
+
+    auto C_rows = RAJA::RowIndex<int, C_matrix_t>::all();
+    auto C_cols = RAJA::ColIndex<int, C_matrix_t>::all();
+
+    data3_d(C_rows, C_cols) = data1_d(A_rows, A_cols) * data2_d(B_rows, B_cols);
+
+  });
+
+  tensor_copy_to_host<policy_t>(data3_vec, data3_ptr);
+
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      element_t expected(0);
+      for(camp::idx_t k = 0;k < K; ++ k){
+        expected += data1_h(i,k)*data2_h(k,j);
+      }
+
+      ASSERT_SCALAR_EQ(expected, data3_h(i,j));
+    }
+  }
+
+
+  //
+  // Free data
+  //
+  tensor_free<policy_t>(data1_ptr);
+  tensor_free<policy_t>(data2_ptr);
+  tensor_free<policy_t>(data3_ptr);
+
+}
+
+
+
+TYPED_TEST_P(TestTensorMatrix, ET_MatrixMatrixMultiplyBlocked)
+{
+  ET_MatrixMatrixMultiplyBlockedImpl<TypeParam>();
+}
+
+
+#endif
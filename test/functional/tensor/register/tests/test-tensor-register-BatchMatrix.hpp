@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_REGISTER_BatchMatrix_HPP__
+#define __TEST_TESNOR_REGISTER_BatchMatrix_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename REGISTER_TYPE>
+void BatchMatrixImpl()
+{
+  using register_t = REGISTER_TYPE;
+  using element_t = typename register_t::element_type;
+  using policy_t = typename register_t::register_policy;
+
+  using A_batch_t = RAJA::expt::BatchMatrix<element_t, 3, 4, policy_t>;
+  using B_batch_t = RAJA::expt::BatchMatrix<element_t, 4, 2, policy_t>;
+  using C_batch_t = RAJA::expt::BatchMatrix<element_t, 3, 2, policy_t>;
+
+  using A_layout_t = typename A_batch_t::layout_type;
+  using B_layout_t = typename B_batch_t::layout_type;
+  using C_layout_t = typename C_batch_t::layout_type;
+
+  static constexpr camp::idx_t num_elem = register_t::s_num_elem;
+
+  // several groups, the last one partial
+  camp::idx_t const num_batch = 2*num_elem + 3;
+  camp::idx_t const num_groups = A_layout_t::num_groups(num_batch);
+
+  // Allocate contiguous matrices, and their interleaved copies
+  std::vector<element_t> a_vec(num_batch*12);
+  std::vector<element_t> b_vec(num_batch*8);
+  std::vector<element_t> c_vec(num_batch*6);
+
+  std::vector<element_t> a_batch_vec(A_layout_t::size(num_batch));
+  std::vector<element_t> b_batch_vec(B_layout_t::size(num_batch));
+  std::vector<element_t> c_batch_vec(C_layout_t::size(num_batch));
+
+  for(camp::idx_t b = 0;b < num_batch; ++ b){
+    for(camp::idx_t e = 0;e < 12; ++ e){
+      a_vec[b*12 + e] = (element_t)((b+e)%5 + NO_OPT_RAND);
+    }
+    for(camp::idx_t e = 0;e < 8; ++ e){
+      b_vec[b*8 + e] = (element_t)((2*b+e)%3 + NO_OPT_RAND);
+    }
+  }
+
+  A_layout_t::interleave(a_vec.data(), a_batch_vec.data(), num_batch);
+  B_layout_t::interleave(b_vec.data(), b_batch_vec.data(), num_batch);
+
+  // the layout helpers are inverses
+  std::vector<element_t> a_check_vec(num_batch*12);
+  A_layout_t::deinterleave(a_batch_vec.data(), a_check_vec.data(), num_batch);
+  for(camp::idx_t i = 0;i < num_batch*12; ++ i){
+    ASSERT_SCALAR_EQ(a_vec[i], a_check_vec[i]);
+  }
+
+  element_t *a_dptr = tensor_malloc<policy_t>(a_batch_vec);
+  element_t *b_dptr = tensor_malloc<policy_t>(b_batch_vec);
+  element_t *c_dptr = tensor_malloc<policy_t>(c_batch_vec);
+
+  tensor_copy_to_device<policy_t>(a_dptr, a_batch_vec);
+  tensor_copy_to_device<policy_t>(b_dptr, b_batch_vec);
+
+
+  // C = A*B, computed along a few different paths
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    for(camp::idx_t g = 0;g < num_groups; ++ g){
+      A_batch_t a;
+      a.load_group(a_dptr, g, num_batch);
+
+      B_batch_t b;
+      b.load_group(b_dptr, g, num_batch);
+
+      C_batch_t ab = a.transpose().transpose() * b;
+
+      C_batch_t c = a.multiply_accumulate(b, ab) - ab;
+      c = c + ab.scale(element_t(2)) - ab*element_t(2);
+
+      c.store_group(c_dptr, g, num_batch);
+    }
+
+  });
+
+  tensor_copy_to_host<policy_t>(c_batch_vec, c_dptr);
+
+  C_layout_t::deinterleave(c_batch_vec.data(), c_vec.data(), num_batch);
+
+  for(camp::idx_t b = 0;b < num_batch; ++ b){
+    for(camp::idx_t i = 0;i < 3; ++ i){
+      for(camp::idx_t j = 0;j < 2; ++ j){
+        element_t expected(0);
+        for(camp::idx_t k = 0;k < 4; ++ k){
+          expected += a_vec[b*12 + i*4 + k] * b_vec[b*8 + k*2 + j];
+        }
+        ASSERT_SCALAR_EQ(expected, c_vec[b*6 + i*2 + j]);
+      }
+    }
+  }
+
+
+  tensor_free<policy_t>(a_dptr);
+  tensor_free<policy_t>(b_dptr);
+  tensor_free<policy_t>(c_dptr);
+}
+
+
+
+TYPED_TEST_P(TestTensorRegister, BatchMatrix)
+{
+  BatchMatrixImpl<TypeParam>();
+}
+
+
+#endif
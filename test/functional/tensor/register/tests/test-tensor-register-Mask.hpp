@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_REGISTER_Mask_HPP__
+#define __TEST_TESNOR_REGISTER_Mask_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename REGISTER_TYPE>
+void MaskImpl()
+{
+  using register_t = REGISTER_TYPE;
+  using element_t = typename register_t::element_type;
+  using policy_t = typename register_t::register_policy;
+
+  static constexpr camp::idx_t num_elem = register_t::s_num_elem;
+
+  // a takes the values 0, 1 and 2, so it is less, equal and greater than b
+  std::vector<element_t> a_vec(num_elem);
+  std::vector<element_t> b_vec(num_elem);
+  for(camp::idx_t i = 0;i < num_elem; ++ i){
+    a_vec[i] = (element_t)(i%3);
+    b_vec[i] = (element_t)(1);
+  }
+
+  // comparison results, as 0/1 lanes of each of the 6 operators
+  std::vector<element_t> cmp_vec(6*num_elem);
+
+  // select, blend, masked load and masked store results
+  std::vector<element_t> sel_vec(4*num_elem);
+  for(camp::idx_t i = 0;i < 4*num_elem; ++ i){
+    sel_vec[i] = (element_t)(-1);
+  }
+
+  // any, all, none and count of a few masks
+  std::vector<element_t> red_vec(8);
+
+  element_t *a_ptr = tensor_malloc<policy_t>(a_vec);
+  element_t *b_ptr = tensor_malloc<policy_t>(b_vec);
+  element_t *cmp_ptr = tensor_malloc<policy_t>(cmp_vec);
+  element_t *sel_ptr = tensor_malloc<policy_t>(sel_vec);
+  element_t *red_ptr = tensor_malloc<policy_t>(red_vec);
+
+  tensor_copy_to_device<policy_t>(a_ptr, a_vec);
+  tensor_copy_to_device<policy_t>(b_ptr, b_vec);
+  tensor_copy_to_device<policy_t>(sel_ptr, sel_vec);
+
+
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+    register_t a;
+    a.load_packed(a_ptr);
+
+    register_t b;
+    b.load_packed(b_ptr);
+
+    typename register_t::mask_type m[6] = {
+      a == b, a != b, a < b, a <= element_t(1), a > b, a >= element_t(1)};
+
+    register_t one(element_t(1));
+    for(camp::idx_t c = 0;c < 6; ++ c){
+      register_t(element_t(0)).blend(m[c], one).store_packed(cmp_ptr + c*num_elem);
+    }
+
+    // a where a < b, and b elsewhere
+    RAJA::expt::select(m[2], a, b).store_packed(sel_ptr);
+
+    // a where a > b, and b elsewhere
+    b.blend(m[4], a).store_packed(sel_ptr + num_elem);
+
+    register_t l;
+    l.load_packed_masked(a_ptr, m[4]);
+    l.store_packed(sel_ptr + 2*num_elem);
+
+    a.store_packed_masked(sel_ptr + 3*num_elem, m[2]);
+
+    red_ptr[0] = element_t(m[2].any());
+    red_ptr[1] = element_t((m[2] | m[5]).all());
+    red_ptr[2] = element_t((m[2] & m[5]).none());
+    red_ptr[3] = element_t(~m[2] == m[5]);
+    red_ptr[4] = element_t(m[2].count());
+    red_ptr[5] = element_t(m[4].count());
+    red_ptr[6] = element_t((m[0] ^ m[1]).all());
+    red_ptr[7] = element_t(m[0].all());
+  });
+
+  tensor_copy_to_host<policy_t>(cmp_vec, cmp_ptr);
+  tensor_copy_to_host<policy_t>(sel_vec, sel_ptr);
+  tensor_copy_to_host<policy_t>(red_vec, red_ptr);
+
+
+  camp::idx_t num_lt = 0;
+  camp::idx_t num_gt = 0;
+  for(camp::idx_t i = 0;i < num_elem; ++ i){
+    element_t a = a_vec[i];
+    element_t b = b_vec[i];
+
+    ASSERT_SCALAR_EQ(cmp_vec[i],            element_t(a == b));
+    ASSERT_SCALAR_EQ(cmp_vec[num_elem+i],   element_t(a != b));
+    ASSERT_SCALAR_EQ(cmp_vec[2*num_elem+i], element_t(a < b));
+    ASSERT_SCALAR_EQ(cmp_vec[3*num_elem+i], element_t(a <= b));
+    ASSERT_SCALAR_EQ(cmp_vec[4*num_elem+i], element_t(a > b));
+    ASSERT_SCALAR_EQ(cmp_vec[5*num_elem+i], element_t(a >= b));
+
+    ASSERT_SCALAR_EQ(sel_vec[i],            a < b ? a : b);
+    ASSERT_SCALAR_EQ(sel_vec[num_elem+i],   a > b ? a : b);
+    ASSERT_SCALAR_EQ(sel_vec[2*num_elem+i], a > b ? a : element_t(0));
+    ASSERT_SCALAR_EQ(sel_vec[3*num_elem+i], a < b ? a : element_t(-1));
+
+    num_lt += a < b;
+    num_gt += a > b;
+  }
+
+  ASSERT_SCALAR_EQ(red_vec[0], element_t(num_lt > 0));
+  ASSERT_SCALAR_EQ(red_vec[1], element_t(1));
+  ASSERT_SCALAR_EQ(red_vec[2], element_t(1));
+  ASSERT_SCALAR_EQ(red_vec[3], element_t(1));
+  ASSERT_SCALAR_EQ(red_vec[4], element_t(num_lt));
+  ASSERT_SCALAR_EQ(red_vec[5], element_t(num_gt));
+  ASSERT_SCALAR_EQ(red_vec[6], element_t(1));
+  ASSERT_SCALAR_EQ(red_vec[7], element_t(0));
+
+
+  tensor_free<policy_t>(a_ptr);
+  tensor_free<policy_t>(b_ptr);
+  tensor_free<policy_t>(cmp_ptr);
+  tensor_free<policy_t>(sel_ptr);
+  tensor_free<policy_t>(red_ptr);
+}
+
+
+
+TYPED_TEST_P(TestTensorRegister, Mask)
+{
+  MaskImpl<TypeParam>();
+}
+
+
+#endif
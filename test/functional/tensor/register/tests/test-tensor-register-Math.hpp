@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_REGISTER_Math_HPP__
+#define __TEST_TESNOR_REGISTER_Math_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+// the math functions are only defined for floating point registers
+template <typename REGISTER_TYPE>
+typename std::enable_if<std::numeric_limits<typename REGISTER_TYPE::element_type>::is_integer>::type
+MathImpl()
+{
+}
+
+template <typename REGISTER_TYPE>
+typename std::enable_if<!std::numeric_limits<typename REGISTER_TYPE::element_type>::is_integer>::type
+MathImpl()
+{
+  using register_t = REGISTER_TYPE;
+  using element_t = typename register_t::element_type;
+  using policy_t = typename register_t::register_policy;
+
+  static constexpr camp::idx_t num_elem = register_t::s_num_elem;
+
+  // Allocate
+
+  std::vector<element_t> input0_vec(num_elem);
+  element_t *input0_hptr = input0_vec.data();
+  element_t *input0_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  std::vector<element_t> input1_vec(num_elem);
+  element_t *input1_hptr = input1_vec.data();
+  element_t *input1_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  std::vector<element_t> output_vec(7*num_elem);
+  element_t *output_dptr = tensor_malloc<policy_t, element_t>(7*num_elem);
+
+
+  // Initialize input data, x in (0, 8] and y in [-4, 4]
+  for(camp::idx_t i = 0;i < num_elem; ++ i){
+    input0_hptr[i] = (element_t)(8.0*(i+1)/num_elem/NO_OPT_RAND);
+    input1_hptr[i] = (element_t)(4.0 - 8.0*i/num_elem*NO_OPT_RAND/2.0);
+  }
+
+  tensor_copy_to_device<policy_t>(input0_dptr, input0_vec);
+  tensor_copy_to_device<policy_t>(input1_dptr, input1_vec);
+
+
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    register_t x;
+    x.load_packed(input0_dptr);
+
+    register_t y;
+    y.load_packed(input1_dptr);
+
+    x.sqrt().store_packed(output_dptr);
+    y.exp().store_packed(output_dptr + num_elem);
+    x.log().store_packed(output_dptr + 2*num_elem);
+    x.pow(y).store_packed(output_dptr + 3*num_elem);
+    y.sin().store_packed(output_dptr + 4*num_elem);
+    y.cos().store_packed(output_dptr + 5*num_elem);
+    y.round().store_packed(output_dptr + 6*num_elem);
+  });
+
+  tensor_copy_to_host<policy_t>(output_vec, output_dptr);
+
+  // a few ulp, and more for pow whose error grows with |y log(x)|
+  element_t const eps = std::numeric_limits<element_t>::epsilon();
+
+  for(camp::idx_t  lane = 0;lane < num_elem;++ lane){
+    element_t x = input0_vec[lane];
+    element_t y = input1_vec[lane];
+
+    element_t expected[7] = {
+      std::sqrt(x),
+      std::exp(y),
+      std::log(x),
+      std::pow(x, y),
+      std::sin(y),
+      std::cos(y),
+      std::nearbyint(y)
+    };
+
+    for(camp::idx_t f = 0;f < 7;++ f){
+      ASSERT_NEAR(expected[f], output_vec[f*num_elem + lane],
+                  (f == 3 ? 64 : 8)*eps*RAJA::max<element_t>(std::abs(expected[f]), 1));
+    }
+  }
+
+
+  tensor_free<policy_t>(input0_dptr);
+  tensor_free<policy_t>(input1_dptr);
+  tensor_free<policy_t>(output_dptr);
+}
+
+
+
+TYPED_TEST_P(TestTensorRegister, Math)
+{
+  MathImpl<TypeParam>();
+}
+
+
+#endif
@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_REGISTER_SellMultiply_HPP__
+#define __TEST_TESNOR_REGISTER_SellMultiply_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename REGISTER_TYPE>
+void SellMultiplyImpl()
+{
+  using register_t = REGISTER_TYPE;
+  using element_t = typename register_t::element_type;
+  using policy_t = typename register_t::register_policy;
+
+  using sell_t = RAJA::expt::SellMatrix<element_t, policy_t>;
+  using index_t = typename sell_t::index_type;
+
+  static constexpr camp::idx_t num_elem = register_t::s_num_elem;
+
+  // several slices, the last one partial
+  index_t const num_rows = 3*num_elem + 2;
+
+  // rows of 0 to 5 elements, so slices need padding
+  std::vector<index_t> row_ptr(num_rows+1);
+  std::vector<index_t> col;
+  std::vector<element_t> val;
+
+  row_ptr[0] = 0;
+  for(index_t i = 0;i < num_rows; ++ i){
+    index_t len = (5*i + 3) % 6;
+    for(index_t k = 0;k < len; ++ k){
+      col.push_back((7*i + 3*k) % num_rows);
+      val.push_back((element_t)((i + k) % 5 + 1));
+    }
+    row_ptr[i+1] = col.size();
+  }
+
+  std::vector<element_t> x_vec(num_rows);
+  for(index_t i = 0;i < num_rows; ++ i){
+    x_vec[i] = (element_t)(i % 3 + NO_OPT_RAND);
+  }
+
+
+  for(index_t sigma : {index_t(1), index_t(2*num_elem)}){
+
+    index_t const num_slices = sell_t::num_slices(num_rows);
+    index_t const size = sell_t::storage_size(num_rows, row_ptr.data(), sigma);
+
+    std::vector<index_t> slice_offsets_vec(num_slices+1);
+    std::vector<index_t> rows_vec(num_slices*num_elem);
+    std::vector<index_t> cols_vec(size);
+    std::vector<element_t> values_vec(size);
+
+    sell_t::from_csr(num_rows, row_ptr.data(), col.data(), val.data(), sigma,
+                     slice_offsets_vec.data(), rows_vec.data(),
+                     cols_vec.data(), values_vec.data());
+
+    ASSERT_EQ(slice_offsets_vec[num_slices], size);
+
+    index_t *slice_offsets_dptr = tensor_malloc<policy_t>(slice_offsets_vec);
+    index_t *rows_dptr = tensor_malloc<policy_t>(rows_vec);
+    index_t *cols_dptr = tensor_malloc<policy_t>(cols_vec);
+    element_t *values_dptr = tensor_malloc<policy_t>(values_vec);
+    element_t *x_dptr = tensor_malloc<policy_t>(x_vec);
+
+    std::vector<element_t> y_vec(num_rows);
+    element_t *y_dptr = tensor_malloc<policy_t>(y_vec);
+
+    tensor_copy_to_device<policy_t>(slice_offsets_dptr, slice_offsets_vec);
+    tensor_copy_to_device<policy_t>(rows_dptr, rows_vec);
+    tensor_copy_to_device<policy_t>(cols_dptr, cols_vec);
+    tensor_copy_to_device<policy_t>(values_dptr, values_vec);
+    tensor_copy_to_device<policy_t>(x_dptr, x_vec);
+
+
+    tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+      sell_t A(num_rows, slice_offsets_dptr, rows_dptr, cols_dptr, values_dptr);
+
+      A.multiply(x_dptr, y_dptr);
+
+    });
+
+    tensor_copy_to_host<policy_t>(y_vec, y_dptr);
+
+    for(index_t i = 0;i < num_rows; ++ i){
+      element_t expected(0);
+      for(index_t k = row_ptr[i];k < row_ptr[i+1]; ++ k){
+        expected += val[k] * x_vec[col[k]];
+      }
+      ASSERT_SCALAR_EQ(expected, y_vec[i]);
+    }
+
+
+    tensor_free<policy_t>(slice_offsets_dptr);
+    tensor_free<policy_t>(rows_dptr);
+    tensor_free<policy_t>(cols_dptr);
+    tensor_free<policy_t>(values_dptr);
+    tensor_free<policy_t>(x_dptr);
+    tensor_free<policy_t>(y_dptr);
+  }
+}
+
+
+
+TYPED_TEST_P(TestTensorRegister, SellMultiply)
+{
+  SellMultiplyImpl<TypeParam>();
+}
+
+
+#endif
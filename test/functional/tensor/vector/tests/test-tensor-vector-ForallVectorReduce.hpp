@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_VECTOR_ForallVectorReduce_HPP__
+#define __TEST_TESNOR_VECTOR_ForallVectorReduce_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename VECTOR_TYPE>
+void ForallVectorReduceImpl()
+{
+
+  using vector_t = VECTOR_TYPE;
+  using element_t = typename vector_t::element_type;
+
+
+  int N = 10*vector_t::s_num_elem+1;
+
+  // small integers, so every summation order gives the same result
+  element_t *A = new element_t[N];
+  element_t *B = new element_t[N];
+  for(int i = 0;i < N; ++ i){
+    A[i] = (element_t)((i*7)%13 - 4 + NO_OPT_ZERO);
+    B[i] = (element_t)((i*5)%11 - 3 + NO_OPT_ZERO);
+  }
+
+  RAJA::View<element_t, RAJA::Layout<1>> X(A, N);
+  RAJA::View<element_t, RAJA::Layout<1>> Y(B, N);
+
+
+  using idx_t = RAJA::VectorIndex<int, vector_t>;
+
+  // whole vector, and a subrange whose ends are not register aligned
+  for(int start : {0, 1, N/2}){
+
+    auto some = idx_t::range(start, N);
+
+    element_t sum = 0, dot = 0, sum_expr = 0;
+    element_t vmin = A[start], vmax = A[start];
+    for(int i = start;i < N;++ i){
+      sum += A[i];
+      dot += A[i]*B[i];
+      sum_expr += 2*A[i] + B[i];
+      vmin = RAJA::min<element_t>(vmin, A[i]);
+      vmax = RAJA::max<element_t>(vmax, A[i]);
+    }
+
+    ASSERT_SCALAR_EQ(sum, X[some].sum());
+    ASSERT_SCALAR_EQ(vmin, X[some].min());
+    ASSERT_SCALAR_EQ(vmax, X[some].max());
+    ASSERT_SCALAR_EQ(dot, X[some].dot(Y[some]));
+    ASSERT_SCALAR_EQ(dot, (X[some]*Y[some]).sum());
+    ASSERT_SCALAR_EQ(sum_expr, (2*X[some] + Y[some]).sum());
+  }
+
+  // a range shorter than one register only has a partial tile
+  auto few = idx_t::range(3, 5);
+  ASSERT_SCALAR_EQ(element_t(A[3]+A[4]), X[few].sum());
+  ASSERT_SCALAR_EQ(RAJA::max<element_t>(A[3], A[4]), X[few].max());
+
+
+  delete[] A;
+  delete[] B;
+}
+
+
+
+TYPED_TEST_P(TestTensorVector, ForallVectorReduce)
+{
+  ForallVectorReduceImpl<TypeParam>();
+}
+
+
+#endif
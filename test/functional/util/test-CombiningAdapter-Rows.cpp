@@ -0,0 +1,69 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for iterating CombiningAdapters by rows.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/Span.hpp"
+#include "RAJA/util/CombiningAdapter.hpp"
+
+#include <array>
+#include <vector>
+
+template < typename Perm, typename IndexType >
+void test_CombiningAdapterRows_3D(IndexType ibegin0, IndexType iend0,
+                                  IndexType ibegin1, IndexType iend1,
+                                  IndexType ibegin2, IndexType iend2)
+{
+  using std::begin; using std::end;
+  RAJA::TypedRangeSegment<IndexType> seg0(ibegin0, iend0);
+  RAJA::TypedRangeSegment<IndexType> seg1(ibegin1, iend1);
+  RAJA::TypedRangeSegment<IndexType> seg2(ibegin2, iend2);
+
+  using idx3 = std::array<IndexType, 3>;
+  std::vector<idx3> by_index;
+  std::vector<idx3> by_row;
+
+  auto index_adapter = RAJA::make_PermutedCombiningAdapter<Perm>(
+      [&](IndexType i0, IndexType i1, IndexType i2) {
+        by_index.push_back(idx3{{i0, i1, i2}});
+      }, seg0, seg1, seg2);
+
+  auto row_adapter = RAJA::make_PermutedCombiningAdapter<Perm>(
+      [&](IndexType i0, IndexType i1, IndexType i2) {
+        by_row.push_back(idx3{{i0, i1, i2}});
+      }, seg0, seg1, seg2);
+
+  auto range = index_adapter.getRange();
+  for (auto idx = begin(range); idx != end(range); ++idx) {
+    index_adapter(*idx);
+  }
+
+  auto row_range = row_adapter.getRowRange();
+  auto rows = row_adapter.rows();
+  for (auto row = begin(row_range); row != end(row_range); ++row) {
+    rows(*row);
+  }
+
+  // rows visit the same indices in the same order
+  ASSERT_EQ(by_index.size(), by_row.size());
+  for (size_t i = 0; i < by_index.size(); ++i) {
+    ASSERT_EQ(by_index[i], by_row[i]);
+  }
+}
+
+TEST(CombiningAdapter, testRows)
+{
+  test_CombiningAdapterRows_3D<RAJA::PERM_IJK, int>(0, 0, 0, 4, 0, 5);
+  test_CombiningAdapterRows_3D<RAJA::PERM_IJK, int>(0, 3, 0, 4, 0, 5);
+  test_CombiningAdapterRows_3D<RAJA::PERM_KJI, int>(0, 3, 0, 4, 0, 5);
+  test_CombiningAdapterRows_3D<RAJA::PERM_JKI, long>(-3, 5, 2, 3, -4, 1);
+  test_CombiningAdapterRows_3D<RAJA::PERM_IKJ, long>(4, 13, -2, 7, 1, 2);
+}
@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA workgroup run chaining.
+///
+
+#ifndef __TEST_WORKGROUP_CHAIN__
+#define __TEST_WORKGROUP_CHAIN__
+
+#include "RAJA_test-workgroup.hpp"
+#include "RAJA_test-forall-data.hpp"
+
+
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename Allocator,
+          typename WORKING_RES
+          >
+void testWorkGroupChain(int N)
+{
+  using WorkGroupPolicy = RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy,
+                                                RAJA::ragged_array_of_objects>;
+
+  using WorkPool_type = RAJA::WorkPool<WorkGroupPolicy, int, RAJA::xargs<>, Allocator>;
+  using WorkGroup_type = RAJA::WorkGroup<WorkGroupPolicy, int, RAJA::xargs<>, Allocator>;
+  using WorkSite_type = RAJA::WorkSite<WorkGroupPolicy, int, RAJA::xargs<>, Allocator>;
+
+  WORKING_RES res_first = WORKING_RES::get_default();
+  WORKING_RES res_second;
+  camp::resources::Resource working_res{res_first};
+
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N, working_res,
+                              &working_array, &check_array, &test_array);
+
+  for (int i = 0; i < N; i++) {
+    test_array[i] = i;
+  }
+  res_first.memcpy(working_array, test_array, sizeof(int) * N);
+
+  WorkPool_type pool_first(Allocator{});
+  WorkPool_type pool_second(Allocator{});
+
+  pool_first.enqueue(RAJA::TypedRangeSegment<int>(0, N),
+      [=] RAJA_HOST_DEVICE (int i) {
+    working_array[i] += 1;
+  });
+  pool_second.enqueue(RAJA::TypedRangeSegment<int>(0, N),
+      [=] RAJA_HOST_DEVICE (int i) {
+    working_array[i] *= 2;
+  });
+
+  WorkGroup_type group_first = pool_first.instantiate();
+  WorkGroup_type group_second = pool_second.instantiate();
+
+  // the second group runs on another resource after the first finishes
+  WorkSite_type site_first = group_first.run(res_first);
+  WorkSite_type site_second = group_second.run_after(site_first, res_second);
+
+  site_second.synchronize();
+
+  ASSERT_TRUE(site_first.query());
+  ASSERT_TRUE(site_second.query());
+
+  res_second.memcpy(check_array, working_array, sizeof(int) * N);
+
+  for (int i = 0; i < N; i++) {
+    ASSERT_EQ((test_array[i] + 1) * 2, check_array[i]);
+  }
+
+  deallocateForallTestData<int>(working_res,
+                                working_array, check_array, test_array);
+}
+
+
+template <typename T>
+class WorkGroupBasicChainFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(WorkGroupBasicChainFunctionalTest);
+
+
+TYPED_TEST_P(WorkGroupBasicChainFunctionalTest, BasicWorkGroupChain)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<2>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  testWorkGroupChain< ExecPolicy, OrderPolicy, Allocator, WORKING_RESOURCE >(16);
+  testWorkGroupChain< ExecPolicy, OrderPolicy, Allocator, WORKING_RESOURCE >(1000);
+}
+
+#endif  //__TEST_WORKGROUP_CHAIN__
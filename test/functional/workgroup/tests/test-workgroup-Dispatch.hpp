@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA workgroup direct dispatch.
+///
+
+#ifndef __TEST_WORKGROUP_DISPATCH__
+#define __TEST_WORKGROUP_DISPATCH__
+
+#include "RAJA_test-workgroup.hpp"
+#include "RAJA_test-forall-data.hpp"
+
+
+struct WorkGroupDispatchAdd
+{
+  int* array;
+  int val;
+
+  RAJA_HOST_DEVICE void operator()(int i) const
+  {
+    array[i] += i + val;
+  }
+};
+
+struct WorkGroupDispatchScale
+{
+  int* array;
+  int val;
+
+  RAJA_HOST_DEVICE void operator()(int i) const
+  {
+    array[i] *= val;
+  }
+};
+
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename Allocator,
+          typename WORKING_RES
+          >
+void testWorkGroupDispatch(int N)
+{
+  using DispatchPolicy = RAJA::direct_dispatch<
+                  camp::list<RAJA::TypedRangeSegment<int>, WorkGroupDispatchAdd>,
+                  camp::list<RAJA::TypedRangeSegment<int>, WorkGroupDispatchScale>
+                >;
+
+  using WorkGroupPolicy = RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy,
+                                                RAJA::ragged_array_of_objects,
+                                                DispatchPolicy>;
+
+  using WorkPool_type = RAJA::WorkPool<WorkGroupPolicy, int, RAJA::xargs<>, Allocator>;
+  using WorkGroup_type = RAJA::WorkGroup<WorkGroupPolicy, int, RAJA::xargs<>, Allocator>;
+  using WorkSite_type = RAJA::WorkSite<WorkGroupPolicy, int, RAJA::xargs<>, Allocator>;
+
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(2 * N, working_res,
+                              &working_array, &check_array, &test_array);
+
+  for (int i = 0; i < 2 * N; i++) {
+    test_array[i] = 1;
+  }
+  res.memcpy(working_array, test_array, sizeof(int) * 2 * N);
+
+  WorkPool_type pool(Allocator{});
+
+  // the two halves of the array each get one loop of each type
+  pool.enqueue(RAJA::TypedRangeSegment<int>(0, N),
+               WorkGroupDispatchAdd{working_array, 3});
+  pool.enqueue(RAJA::TypedRangeSegment<int>(N, 2 * N),
+               WorkGroupDispatchScale{working_array, 5});
+
+  WorkGroup_type group = pool.instantiate();
+
+  WorkSite_type site = group.run(res);
+
+  auto e = site.get_resource().get_event();
+  e.wait();
+
+  res.memcpy(check_array, working_array, sizeof(int) * 2 * N);
+
+  for (int i = 0; i < N; i++) {
+    ASSERT_EQ(test_array[i] + i + 3, check_array[i]);
+  }
+  for (int i = N; i < 2 * N; i++) {
+    ASSERT_EQ(test_array[i] * 5, check_array[i]);
+  }
+
+  deallocateForallTestData<int>(working_res,
+                                working_array, check_array, test_array);
+}
+
+
+template <typename T>
+class WorkGroupBasicDispatchFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(WorkGroupBasicDispatchFunctionalTest);
+
+
+TYPED_TEST_P(WorkGroupBasicDispatchFunctionalTest, BasicWorkGroupDispatch)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<2>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  testWorkGroupDispatch< ExecPolicy, OrderPolicy, Allocator, WORKING_RESOURCE >(16);
+  testWorkGroupDispatch< ExecPolicy, OrderPolicy, Allocator, WORKING_RESOURCE >(1000);
+}
+
+#endif  //__TEST_WORKGROUP_DISPATCH__
@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA workgroup nested enqueue.
+///
+
+#ifndef __TEST_WORKGROUP_NEST__
+#define __TEST_WORKGROUP_NEST__
+
+#include "RAJA_test-workgroup.hpp"
+#include "RAJA_test-forall-data.hpp"
+
+
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename Allocator,
+          typename WORKING_RES
+          >
+void testWorkGroupNest(int ni, int nj, int nk)
+{
+  using WorkPool_type = RAJA::WorkPool<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy,
+                                        RAJA::ragged_array_of_objects>,
+                  int,
+                  RAJA::xargs<>,
+                  Allocator
+                >;
+
+  using WorkGroup_type = RAJA::WorkGroup<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy,
+                                        RAJA::ragged_array_of_objects>,
+                  int,
+                  RAJA::xargs<>,
+                  Allocator
+                >;
+
+  using WorkSite_type = RAJA::WorkSite<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy,
+                                        RAJA::ragged_array_of_objects>,
+                  int,
+                  RAJA::xargs<>,
+                  Allocator
+                >;
+
+  const int N = ni * nj * nk;
+
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N, working_res,
+                              &working_array, &check_array, &test_array);
+
+  int* working_array3;
+  int* check_array3;
+  int* test_array3;
+
+  allocateForallTestData<int>(N, working_res,
+                              &working_array3, &check_array3, &test_array3);
+
+  for (int i = 0; i < N; i++) {
+    test_array[i] = 0;
+  }
+  res.memcpy(working_array, test_array, sizeof(int) * N);
+  res.memcpy(working_array3, test_array, sizeof(int) * N);
+
+  WorkPool_type pool(Allocator{});
+
+  // 2-D nest of segments that do not start at 0, j fastest
+  pool.enqueue(RAJA::make_tuple(RAJA::TypedRangeSegment<int>(1, ni + 1),
+                                RAJA::TypedRangeSegment<int>(2, nj + 2)),
+      [=] RAJA_HOST_DEVICE (int i, int j) {
+    working_array[(i - 1) * nj + (j - 2)] += (i - 1) * nj + (j - 2) + 1;
+  });
+
+  // 3-D nest with i fastest
+  pool.enqueue(RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, ni),
+                                RAJA::TypedRangeSegment<int>(0, nj),
+                                RAJA::TypedRangeSegment<int>(0, nk)),
+               RAJA::PERM_KJI{},
+      [=] RAJA_HOST_DEVICE (int i, int j, int k) {
+    working_array3[(k * nj + j) * ni + i] += i + 10 * j + 100 * k + 1;
+  });
+
+  // an empty nest is not enqueued
+  pool.enqueue(RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, ni),
+                                RAJA::TypedRangeSegment<int>(0, 0)),
+      [=] RAJA_HOST_DEVICE (int, int) {
+    working_array[0] = -1;
+  });
+
+  ASSERT_EQ(pool.num_loops(), (size_t)((ni * nj > 0 ? 1 : 0) + (N > 0 ? 1 : 0)));
+
+  WorkGroup_type group = pool.instantiate();
+
+  WorkSite_type site = group.run(res);
+
+  auto e = site.get_resource().get_event();
+  e.wait();
+
+  res.memcpy(check_array, working_array, sizeof(int) * N);
+  res.memcpy(check_array3, working_array3, sizeof(int) * N);
+
+  for (int i = 0; i < ni * nj; i++) {
+    ASSERT_EQ(i + 1, check_array[i]);
+  }
+  for (int k = 0; k < nk; k++) {
+    for (int j = 0; j < nj; j++) {
+      for (int i = 0; i < ni; i++) {
+        ASSERT_EQ(i + 10 * j + 100 * k + 1, check_array3[(k * nj + j) * ni + i]);
+      }
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                                working_array3, check_array3, test_array3);
+  deallocateForallTestData<int>(working_res,
+                                working_array, check_array, test_array);
+}
+
+
+template <typename T>
+class WorkGroupBasicNestFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(WorkGroupBasicNestFunctionalTest);
+
+
+TYPED_TEST_P(WorkGroupBasicNestFunctionalTest, BasicWorkGroupNest)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<2>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  testWorkGroupNest< ExecPolicy, OrderPolicy, Allocator, WORKING_RESOURCE >(3, 5, 7);
+  testWorkGroupNest< ExecPolicy, OrderPolicy, Allocator, WORKING_RESOURCE >(17, 33, 2);
+}
+
+#endif  //__TEST_WORKGROUP_NEST__
@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA workgroup pack plans.
+///
+
+#ifndef __TEST_WORKGROUP_PACKPLAN__
+#define __TEST_WORKGROUP_PACKPLAN__
+
+#include "RAJA_test-workgroup.hpp"
+#include "RAJA_test-forall-data.hpp"
+
+#include <vector>
+
+
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename Allocator,
+          typename WORKING_RES
+          >
+void testWorkGroupPackPlan(int N, int len0, int len1)
+{
+  using PackPlan_type = RAJA::PackPlan<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy,
+                                        RAJA::ragged_array_of_objects>,
+                  int,
+                  int,
+                  Allocator
+                >;
+
+  using WorkGroup_type = typename PackPlan_type::workgroup_type;
+  using WorkSite_type = typename PackPlan_type::worksite_type;
+
+  ASSERT_GE(N, 2 * len0);
+  ASSERT_GE(N, 2 * len1);
+
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+
+  // two variables, message 0 has lists of both of them and message 1 a list
+  // of the first, packed and unpacked at the same indices
+  int* var0;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N, working_res, &var0, &check_array, &test_array);
+
+  int* var1 = working_res.allocate<int>(N);
+
+  std::vector<int> lists(2 * len0 + len1);
+  int* pack_list0   = lists.data();
+  int* unpack_list0 = lists.data() + len0;
+  int* list1        = lists.data() + 2 * len0;
+  for (int i = 0; i < len0; ++i) {
+    pack_list0[i]   = 2 * i;
+    unpack_list0[i] = N - 1 - 2 * i;
+  }
+  for (int i = 0; i < len1; ++i) {
+    list1[i] = 2 * i + 1;
+  }
+
+  int* working_lists = working_res.allocate<int>(lists.size());
+  res.memcpy(working_lists, lists.data(), sizeof(int) * lists.size());
+
+  std::vector<int> ref0(N), ref1(N);
+  for (int i = 0; i < N; ++i) {
+    ref0[i] = i;
+    ref1[i] = N + i;
+  }
+  res.memcpy(var0, ref0.data(), sizeof(int) * N);
+  res.memcpy(var1, ref1.data(), sizeof(int) * N);
+
+  PackPlan_type plan(Allocator{});
+
+  plan.add_message();
+  plan.add_list(var0, working_lists, working_lists + len0, len0);
+  plan.add_list(var1, working_lists, working_lists + len0, len0);
+  plan.add_message();
+  plan.add_list(var0, working_lists + 2 * len0, len1);
+
+  ASSERT_EQ(plan.num_messages(), size_t(2));
+  ASSERT_EQ(plan.num_lists(), size_t(3));
+  ASSERT_EQ(plan.buffer_size(), size_t(2 * len0 + len1));
+  ASSERT_EQ(plan.message_offset(0), size_t(0));
+  ASSERT_EQ(plan.message_size(0), size_t(2 * len0));
+  ASSERT_EQ(plan.message_offset(1), size_t(2 * len0));
+  ASSERT_EQ(plan.message_size(1), size_t(len1));
+
+  const size_t buffer_size = plan.buffer_size();
+  int* send_buffer = working_res.allocate<int>(buffer_size);
+  int* recv_buffer = working_res.allocate<int>(buffer_size);
+
+  WorkGroup_type group_pack = plan.make_pack_group(send_buffer);
+  WorkGroup_type group_unpack = plan.make_unpack_group(recv_buffer);
+
+  {
+    WorkSite_type site = group_pack.run(res);
+    site.get_resource().get_event().wait();
+  }
+
+  // stands in for the communication
+  res.memcpy(recv_buffer, send_buffer, sizeof(int) * buffer_size);
+  res.wait();
+
+  {
+    WorkSite_type site = group_unpack.run(res);
+    site.get_resource().get_event().wait();
+  }
+
+  std::vector<int> packed;
+  for (int i = 0; i < len0; ++i) packed.push_back(ref0[pack_list0[i]]);
+  for (int i = 0; i < len0; ++i) packed.push_back(ref1[pack_list0[i]]);
+  for (int i = 0; i < len1; ++i) packed.push_back(ref0[list1[i]]);
+
+  for (int i = 0; i < len0; ++i) ref0[unpack_list0[i]] = packed[i];
+  for (int i = 0; i < len0; ++i) ref1[unpack_list0[i]] = packed[len0 + i];
+  for (int i = 0; i < len1; ++i) ref0[list1[i]] = packed[2 * len0 + i];
+
+  res.memcpy(check_array, var0, sizeof(int) * N);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(ref0[i], check_array[i]);
+  }
+  res.memcpy(check_array, var1, sizeof(int) * N);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(ref1[i], check_array[i]);
+  }
+
+  working_res.deallocate(recv_buffer);
+  working_res.deallocate(send_buffer);
+  working_res.deallocate(working_lists);
+  working_res.deallocate(var1);
+
+  deallocateForallTestData<int>(working_res, var0, check_array, test_array);
+}
+
+
+template <typename T>
+class WorkGroupBasicPackPlanFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(WorkGroupBasicPackPlanFunctionalTest);
+
+
+TYPED_TEST_P(WorkGroupBasicPackPlanFunctionalTest, BasicWorkGroupPackPlan)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<2>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  testWorkGroupPackPlan< ExecPolicy, OrderPolicy, Allocator, WORKING_RESOURCE >(64, 8, 5);
+  testWorkGroupPackPlan< ExecPolicy, OrderPolicy, Allocator, WORKING_RESOURCE >(1024, 300, 0);
+}
+
+#endif  //__TEST_WORKGROUP_PACKPLAN__
@@ -32,6 +32,9 @@ using SequentialAtomicPols =
               RAJA::hip_atomic_explicit<RAJA::builtin_atomic>,
 #endif
 #endif
+              RAJA::scoped_atomic<RAJA::seq_atomic,
+                                  RAJA::atomic_scope::system,
+                                  RAJA::atomic_order::seq_cst>,
               RAJA::seq_atomic
             >;
 
@@ -83,6 +86,10 @@ using CudaAtomicPols =
               RAJA::cuda_atomic_explicit<RAJA::omp_atomic>,
 #endif
 #endif
+              RAJA::cuda_warp_atomic,
+              RAJA::scoped_atomic<RAJA::cuda_atomic,
+                                  RAJA::atomic_scope::device,
+                                  RAJA::atomic_order::acq_rel>,
               RAJA::cuda_atomic
             >;
 #endif  // RAJA_ENABLE_CUDA
@@ -99,10 +106,29 @@ using HipAtomicPols =
                RAJA::hip_atomic_explicit<RAJA::omp_atomic>,
 #endif
 #endif
+               RAJA::hip_warp_atomic,
+               RAJA::scoped_atomic<RAJA::hip_atomic,
+                                   RAJA::atomic_scope::device,
+                                   RAJA::atomic_order::acq_rel>,
                RAJA::hip_atomic
             >;
 #endif  // RAJA_ENABLE_HIP
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclAtomicPols =
+  camp::list<
+#if defined(RAJA_TEST_EXHAUSTIVE)
+               RAJA::auto_atomic,
+               RAJA::sycl_atomic_explicit<RAJA::seq_atomic>,
+               RAJA::sycl_atomic_explicit<RAJA::builtin_atomic>,
+#if defined(RAJA_ENABLE_OPENMP)
+               RAJA::sycl_atomic_explicit<RAJA::omp_atomic>,
+#endif
+#endif
+               RAJA::sycl_atomic
+            >;
+#endif  // RAJA_ENABLE_SYCL
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetAtomicPols = OpenMPAtomicPols;
 #endif
@@ -30,6 +30,10 @@ using OpenMPResourceList = HostResourceList;
 using TBBResourceList = HostResourceList;
 #endif
 
+#if defined(RAJA_ENABLE_STDPAR)
+using StdparResourceList = HostResourceList;
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 using CudaResourceList = camp::list<camp::resources::Cuda>;
 #endif
@@ -42,4 +46,8 @@ using OpenMPTargetResourceList = camp::list<camp::resources::Omp>;
 using HipResourceList = camp::list<camp::resources::Hip>;
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclResourceList = camp::list<camp::resources::Sycl>;
+#endif
+
 #endif // __RAJA_test_camp_HPP__
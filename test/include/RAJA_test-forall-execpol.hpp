@@ -18,7 +18,8 @@
 // Sequential execution policy types
 using SequentialForallExecPols = camp::list< RAJA::seq_exec,
                                              RAJA::loop_exec,
-                                             RAJA::simd_exec >;
+                                             RAJA::simd_exec,
+                                             RAJA::simd_len_exec<4> >;
 
 //
 // Sequential execution policy types for reduction and atomic tests.
@@ -38,6 +39,9 @@ using OpenMPForallExecPols =
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
 
+              , RAJA::omp_parallel_for_steal_exec< >
+              , RAJA::omp_parallel_for_steal_exec<4>
+
 #if defined(RAJA_TEST_EXHAUSTIVE)
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<4>
@@ -110,6 +114,14 @@ using TBBForallAtomicExecPols = TBBForallExecPols;
 
 #endif
 
+#if defined(RAJA_ENABLE_STDPAR)
+using StdparForallExecPols = camp::list< RAJA::stdpar_par_exec,
+                                         RAJA::stdpar_par_unseq_exec >;
+
+using StdparForallReduceExecPols = StdparForallExecPols;
+
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetForallExecPols =
   camp::list< RAJA::omp_target_parallel_for_exec<8>,
@@ -124,7 +136,9 @@ using OpenMPTargetForallAtomicExecPols = OpenMPTargetForallExecPols;
 #if defined(RAJA_ENABLE_CUDA)
 using CudaForallExecPols = camp::list< RAJA::cuda_exec<128>,
                                        RAJA::cuda_exec<256>,
-                                       RAJA::cuda_exec_explicit<256,2> >;
+                                       RAJA::cuda_exec_explicit<256,2>,
+                                       RAJA::cuda_scan_exec<256>,
+                                       RAJA::cuda_exec_grid_stride<256, 4> >;
 
 using CudaForallReduceExecPols = CudaForallExecPols;
 
@@ -134,7 +148,9 @@ using CudaForallAtomicExecPols = CudaForallExecPols;
 
 #if defined(RAJA_ENABLE_HIP)
 using HipForallExecPols = camp::list< RAJA::hip_exec<128>,
-                                      RAJA::hip_exec<256>  >;
+                                      RAJA::hip_exec<256>,
+                                      RAJA::hip_scan_exec<256>,
+                                      RAJA::hip_exec_grid_stride<256, 4>  >;
 
 using HipForallReduceExecPols = HipForallExecPols;
 
@@ -142,4 +158,14 @@ using HipForallAtomicExecPols = HipForallExecPols;
 
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclForallExecPols = camp::list< RAJA::sycl_exec<128>,
+                                       RAJA::sycl_exec<256> >;
+
+using SyclForallReduceExecPols = SyclForallExecPols;
+
+using SyclForallAtomicExecPols = SyclForallExecPols;
+
+#endif
+
 #endif  // __RAJA_test_forall_execpol_HPP__
@@ -31,11 +31,15 @@ using OpenMPForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_chunk_segit<4>, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_chunk_segit<4>, RAJA::simd_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
 
 using OpenMPForallIndexSetReduceExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_chunk_segit<4>, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
 #endif
 
@@ -81,7 +85,9 @@ using OpenMPTargetForallIndexSetReduceExecPols =
 #if defined(RAJA_ENABLE_CUDA)
 using CudaForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec<128>>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec<256>> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec<256>>,
+              RAJA::ExecPolicy<RAJA::cuda_single_launch_segit,
+                               RAJA::cuda_exec<256>> >;
 
 using CudaForallIndexSetReduceExecPols = CudaForallIndexSetExecPols;
 #endif
@@ -89,7 +95,9 @@ using CudaForallIndexSetReduceExecPols = CudaForallIndexSetExecPols;
 #if defined(RAJA_ENABLE_HIP)
 using HipForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit, RAJA::hip_exec<128>>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::hip_exec<256>> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::hip_exec<256>>,
+              RAJA::ExecPolicy<RAJA::hip_single_launch_segit,
+                               RAJA::hip_exec<256>> >;
 
 using HipForallIndexSetReduceExecPols = HipForallIndexSetExecPols;
 #endif
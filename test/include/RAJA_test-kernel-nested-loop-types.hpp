@@ -15,6 +15,7 @@
 #endif
 
 struct DEPTH_1_REDUCESUM {};
+struct DEPTH_1_REDUCEMINMAX {};
 struct DEPTH_2 {};
 struct DEPTH_2_COLLAPSE {};
 struct DEPTH_3 {};
@@ -24,6 +25,7 @@ struct DEPTH_3_COLLAPSE_SEQ_OUTER {};
 struct DEPTH_3_REDUCESUM {};
 struct DEPTH_3_REDUCESUM_SEQ_INNER {};
 struct DEPTH_3_REDUCESUM_SEQ_OUTER {};
+struct DEVICE_DEPTH_1_REDUCEMINMAX {};
 struct DEVICE_DEPTH_1_REDUCESUM {};
 struct DEVICE_DEPTH_1_REDUCESUM_WARP {};
 struct DEVICE_DEPTH_1_REDUCESUM_WARPDIRECT_TILE {};
@@ -38,6 +40,7 @@ struct DEVICE_DEPTH_3_REDUCESUM {};
 struct DEVICE_DEPTH_3_REDUCESUM_SEQ_INNER {};
 struct DEVICE_DEPTH_3_REDUCESUM_SEQ_OUTER {};
 struct DEVICE_DEPTH_3_REDUCESUM_WARPREDUCE {};
+struct SYCL_DEPTH_1_REDUCEMINMAX {};
 
 
 //
@@ -32,6 +32,12 @@ using OpenMPReducePols =
 using TBBReducePols = camp::list< RAJA::tbb_reduce >;
 #endif
 
+#if defined(RAJA_ENABLE_STDPAR)
+// stdpar has no reducer objects, only its reduction parameter tests are
+// built and they do not use the reduce policy
+using StdparReducePols = camp::list< RAJA::seq_reduce >;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetReducePols =
   camp::list< RAJA::omp_target_reduce >;
@@ -45,4 +51,8 @@ using CudaReducePols = camp::list< RAJA::cuda_reduce >;
 using HipReducePols = camp::list< RAJA::hip_reduce >;
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclReducePols = camp::list< RAJA::sycl_reduce >;
+#endif
+
 #endif  // __RAJA_test_reducepol_HPP__
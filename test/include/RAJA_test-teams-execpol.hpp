@@ -41,6 +41,17 @@ using seq_hip_policies = camp::list<
 using Sequential_launch_policies = camp::list<
          seq_hip_policies
          >;
+
+#elif defined(RAJA_ENABLE_SYCL)
+// teams and threads in x map to SYCL dimension 2
+using seq_sycl_policies = camp::list<
+  RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t,RAJA::expt::sycl_launch_t<false>>,
+  RAJA::expt::LoopPolicy<RAJA::loop_exec, RAJA::sycl_group_2_direct>,
+  RAJA::expt::LoopPolicy<RAJA::loop_exec,RAJA::sycl_local_2_loop>>;
+
+using Sequential_launch_policies = camp::list<
+         seq_sycl_policies
+         >;
 #else
 using Sequential_launch_policies = camp::list<
         camp::list<
@@ -82,6 +93,18 @@ using omp_hip_policies = camp::list<
 using OpenMP_launch_policies = camp::list<
          omp_hip_policies
          >;
+
+#elif defined(RAJA_ENABLE_SYCL)
+
+using omp_sycl_policies = camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t,RAJA::expt::sycl_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::omp_parallel_for_exec, RAJA::sycl_group_2_direct>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec,RAJA::sycl_local_2_loop>
+  >;
+
+using OpenMP_launch_policies = camp::list<
+         omp_sycl_policies
+         >;
 #else
 using OpenMP_launch_policies = camp::list<
         camp::list<
@@ -112,5 +135,28 @@ using Hip_launch_policies = camp::list<
         >;
 #endif // RAJA_ENABLE_HIP
 
+#if defined(RAJA_ENABLE_SYCL)
+using Sycl_launch_policies = camp::list<
+         seq_sycl_policies
+#if defined(RAJA_ENABLE_OPENMP)
+         , omp_sycl_policies
+#endif
+        >;
+#endif // RAJA_ENABLE_SYCL
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+// there is no device launch place for OpenMP target, so the target launch
+// is the host policy and launches run at HOST
+using omp_target_policies = camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_target_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::omp_target_team_distribute>,
+         RAJA::expt::LoopPolicy<RAJA::omp_target_thread_parallel_for>
+  >;
+
+using OpenMPTarget_launch_policies = camp::list<
+         omp_target_policies
+        >;
+#endif // RAJA_ENABLE_TARGET_OPENMP
+
 
 #endif  // __RAJA_test_teams_execpol_HPP__
@@ -62,6 +62,11 @@ struct TensorTestHelper<RAJA::cuda_warp_register>
 
     static constexpr bool is_device = true;
 };
+
+template<>
+struct TensorTestHelper<RAJA::cuda_mma_register> :
+  public TensorTestHelper<RAJA::cuda_warp_register>
+{};
 #endif
 
 
@@ -98,6 +103,11 @@ struct TensorTestHelper<RAJA::hip_wave_register>
 
     static constexpr bool is_device = true;
 };
+
+template<>
+struct TensorTestHelper<RAJA::hip_mfma_register> :
+  public TensorTestHelper<RAJA::hip_wave_register>
+{};
 #endif
 
 
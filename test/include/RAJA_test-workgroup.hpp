@@ -324,7 +324,9 @@ using SequentialStoragePolicyList =
     camp::list<
                 RAJA::array_of_pointers,
                 RAJA::ragged_array_of_objects,
-                RAJA::constant_stride_array_of_objects
+                RAJA::constant_stride_array_of_objects,
+                RAJA::device_ragged_array_of_objects,
+                RAJA::device_constant_stride_array_of_objects
               >;
 
 #if defined(RAJA_ENABLE_TBB)
@@ -333,17 +335,28 @@ using TBBExecPolicyList =
                 RAJA::tbb_work
               >;
 using TBBOrderedPolicyList = SequentialOrderedPolicyList;
-using TBBOrderPolicyList   = SequentialOrderPolicyList;
+using TBBOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_tbb_task_group
+              >;
 using TBBStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPExecPolicyList =
     camp::list<
-                RAJA::omp_work
+                RAJA::omp_work,
+                RAJA::omp_work_steal
               >;
 using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_omp_chunk_queue
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
@@ -373,7 +386,9 @@ using CudaOrderPolicyList   =
     camp::list<
                 RAJA::ordered,
                 RAJA::reverse_ordered,
-                RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average
+                RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+                RAJA::unordered_cuda_persistent_block_queue,
+                RAJA::unordered_cuda_persistent_chunk_queue
               >;
 using CudaStoragePolicyList = SequentialStoragePolicyList;
 #endif
@@ -393,11 +408,31 @@ using HipOrderPolicyList   =
                 RAJA::reverse_ordered
 #if defined(RAJA_ENABLE_HIP_INDIRECT_FUNCTION_CALL)
               , RAJA::unordered_hip_loop_y_block_iter_x_threadblock_average
+              , RAJA::unordered_hip_persistent_block_queue
+              , RAJA::unordered_hip_persistent_chunk_queue
 #endif
               >;
 using HipStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclExecPolicyList =
+    camp::list<
+                #if defined(RAJA_TEST_EXHAUSTIVE)
+                RAJA::sycl_work_async<256>,
+                #endif
+                RAJA::sycl_work<256>
+              >;
+using SyclOrderedPolicyList = SequentialOrderedPolicyList;
+// there is no unordered runner for sycl_work
+using SyclOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered
+              >;
+using SyclStoragePolicyList = SequentialStoragePolicyList;
+#endif
+
 
 //
 // Memory resource Allocator types
@@ -422,6 +457,10 @@ using CudaAllocatorList = camp::list<typename detail::ResourceAllocator<camp::re
 using HipAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Hip>::template std_allocator<char>>;
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Sycl>::template std_allocator<char>>;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Omp>::template std_allocator<char>>;
 #endif
@@ -16,6 +16,11 @@ struct CounterData
   RAJA::Platform launch_platform_active = RAJA::Platform::undefined;
   int            launch_counter_pre     = 0;
   int            launch_counter_post    = 0;
+  const char*    launch_kernel_name     = nullptr;
+  RAJA::util::KernelPattern launch_pattern = RAJA::util::KernelPattern::undefined;
+  size_t         launch_num_iterations  = 0;
+  size_t         launch_bytes           = 0;
+  size_t         launch_flops           = 0;
 };
 
 // note the use of a pointer here to allow different types of memory
@@ -192,6 +192,58 @@ void PluginForAllIcountIdxSetTestImpl()
   plugin_test_resource->deallocate(data);
 }
 
+// test with a named forall
+template <typename ExecPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginForAllNamedTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  const char* name = "plugin-forall-named";
+
+  for (int i = 0; i < 10; i++) {
+
+    RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(i,i+1),
+      RAJA::expt::KernelName(name, 16, 2),
+      PluginTestCallable{data}
+    );
+
+    CounterData loop_data;
+    plugin_test_resource->memcpy(&loop_data, &data[i], sizeof(CounterData));
+    ASSERT_EQ(loop_data.capture_platform_active, PLATFORM);
+    ASSERT_EQ(loop_data.capture_counter_pre,     i+1);
+    ASSERT_EQ(loop_data.capture_counter_post,    i);
+    ASSERT_EQ(loop_data.launch_platform_active, PLATFORM);
+    ASSERT_EQ(loop_data.launch_counter_pre,     i+1);
+    ASSERT_EQ(loop_data.launch_counter_post,    i);
+  }
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     10);
+  ASSERT_EQ(plugin_data.launch_counter_post,    10);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     name);
+  ASSERT_EQ(plugin_data.launch_pattern,         RAJA::util::KernelPattern::forall);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  1u);
+  ASSERT_EQ(plugin_data.launch_bytes,           16u);
+  ASSERT_EQ(plugin_data.launch_flops,           2u);
+
+  RAJA::forall<ExecPolicy>(
+    RAJA::RangeSegment(0,1),
+    PluginTestCallable{data}
+  );
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_kernel_name, nullptr);
+  ASSERT_EQ(plugin_data.launch_bytes,       0u);
+
+  plugin_test_resource->deallocate(data);
+}
+
 TYPED_TEST_SUITE_P(PluginForallTest);
 template <typename T>
 class PluginForallTest : public ::testing::Test
@@ -234,10 +286,20 @@ TYPED_TEST_P(PluginForallTest, PluginForAllIcountIdxSet)
   PluginForAllIcountIdxSetTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginForallTest, PluginForAllNamed)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginForAllNamedTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginForallTest,
                             PluginForall,
                             PluginForAllICount,
                             PluginForAllIdxSet,
-                            PluginForAllIcountIdxSet);
+                            PluginForAllIcountIdxSet,
+                            PluginForAllNamed);
 
 #endif  //__TEST_PLUGIN_FORALL_HPP__
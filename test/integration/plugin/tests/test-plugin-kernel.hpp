@@ -59,6 +59,45 @@ void PluginKernelTestImpl()
   plugin_test_resource->deallocate(data);
 }
 
+// test with a named kernel
+template <typename KernelPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginKernelNamedTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  const char* name = "plugin-kernel-named";
+
+  for (int i = 0; i < 10; i++) {
+
+    RAJA::kernel<KernelPolicy>(
+      RAJA::expt::KernelName(name),
+      RAJA::make_tuple(RAJA::RangeSegment(i,i+1)),
+      PluginTestCallable{data}
+    );
+
+    CounterData loop_data;
+    plugin_test_resource->memcpy(&loop_data, &data[i], sizeof(CounterData));
+    ASSERT_EQ(loop_data.capture_platform_active, PLATFORM);
+    ASSERT_EQ(loop_data.launch_platform_active, PLATFORM);
+    ASSERT_EQ(loop_data.launch_counter_pre,     i+1);
+    ASSERT_EQ(loop_data.launch_counter_post,    i);
+  }
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     10);
+  ASSERT_EQ(plugin_data.launch_counter_post,    10);
+  ASSERT_EQ(plugin_data.launch_kernel_name,     name);
+  ASSERT_EQ(plugin_data.launch_pattern,         RAJA::util::KernelPattern::kernel);
+  ASSERT_EQ(plugin_data.launch_num_iterations,  1u);
+
+  plugin_test_resource->deallocate(data);
+}
+
 
 TYPED_TEST_SUITE_P(PluginKernelTest);
 template <typename T>
@@ -75,7 +114,17 @@ TYPED_TEST_P(PluginKernelTest, PluginKernel)
   PluginKernelTestImpl<KernelPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginKernelTest, PluginKernelNamed)
+{
+  using KernelPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginKernelNamedTestImpl<KernelPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginKernelTest,
-                            PluginKernel);
+                            PluginKernel,
+                            PluginKernelNamed);
 
 #endif  //__TEST_PLUGIN_KERNEL_HPP__
@@ -41,6 +41,11 @@ struct SetupPluginVars
     data.launch_platform_active = RAJA::Platform::undefined;
     data.launch_counter_pre     = 0;
     data.launch_counter_post    = 0;
+    data.launch_kernel_name     = nullptr;
+    data.launch_pattern         = RAJA::util::KernelPattern::undefined;
+    data.launch_num_iterations  = 0;
+    data.launch_bytes           = 0;
+    data.launch_flops           = 0;
 
     m_test_resource.memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
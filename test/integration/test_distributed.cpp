@@ -0,0 +1,220 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include "RAJA_test-workgroup.hpp"
+
+#include <mpi.h>
+
+#include <vector>
+
+// The tests run on however many ranks they are launched with, the results
+// are checked against the global index space on every rank.
+
+class MPIEnvironment : public ::testing::Environment
+{
+public:
+  void SetUp() override
+  {
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (!initialized) {
+      MPI_Init(nullptr, nullptr);
+    }
+  }
+
+  void TearDown() override { MPI_Finalize(); }
+};
+
+static ::testing::Environment* const mpi_env =
+    ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+
+using partition_type = RAJA::expt::BlockPartition<int>;
+
+using workgroup_policy = RAJA::WorkGroupPolicy<RAJA::seq_work,
+                                               RAJA::ordered,
+                                               RAJA::ragged_array_of_objects>;
+
+using Allocator = typename detail::ResourceAllocator<
+    camp::resources::Host>::template std_allocator<char>;
+
+using halo_type =
+    RAJA::expt::HaloExchange<workgroup_policy, double, int, Allocator>;
+
+// owned value of global index g
+static double global_value(int v, int g) { return 1000.0 * v + g; }
+
+// value left in the ghosts without a neighbor
+static constexpr double no_neighbor = -1.0;
+
+template <typename IndexSet>
+static void count_indices(IndexSet const& iset, std::vector<int>& counts)
+{
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](int i) { counts[i] += 1; });
+}
+
+static void checkPartition(int global_size, int halo_width)
+{
+  partition_type part(MPI_COMM_WORLD, global_size, halo_width);
+
+  const int rank = part.rank();
+  const int size = part.size();
+  const int h = part.halo_width();
+  const int n = part.num_owned();
+
+  ASSERT_EQ(global_size, part.global_size());
+  ASSERT_EQ(n + 2 * h, part.local_size());
+
+  // the blocks are consecutive, cover the index space and differ in size by
+  // at most one
+  std::vector<int> begins(size);
+  std::vector<int> owned(size);
+  int begin = part.global_begin();
+  MPI_Allgather(&begin, 1, MPI_INT, begins.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  MPI_Allgather(&n, 1, MPI_INT, owned.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  ASSERT_EQ(0, begins[0]);
+  for (int p = 0; p + 1 < size; ++p) {
+    ASSERT_EQ(begins[p] + owned[p], begins[p + 1]);
+    ASSERT_GE(owned[p], owned[p + 1]);
+    ASSERT_LE(owned[p] - owned[p + 1], 1);
+  }
+  ASSERT_EQ(global_size, begins[size - 1] + owned[size - 1]);
+
+  ASSERT_EQ(rank > 0 ? rank - 1 : MPI_PROC_NULL, part.lower_neighbor());
+  ASSERT_EQ(rank + 1 < size ? rank + 1 : MPI_PROC_NULL, part.upper_neighbor());
+
+  for (int i = 0; i < part.local_size(); ++i) {
+    ASSERT_EQ(i, part.to_local(part.to_global(i)));
+  }
+  ASSERT_EQ(begin, part.to_global(h));
+
+  // owned is the interior and boundary, each owned index once, and the
+  // stencils of width h of the interior read no ghosts
+  std::vector<int> interior(part.local_size(), 0);
+  std::vector<int> boundary(part.local_size(), 0);
+  std::vector<int> all(part.local_size(), 0);
+  count_indices(part.interior(), interior);
+  count_indices(part.boundary(), boundary);
+  count_indices(part.owned(), all);
+
+  for (int i = 0; i < part.local_size(); ++i) {
+    const bool is_owned = i >= h && i < n + h;
+    ASSERT_EQ(is_owned ? 1 : 0, all[i]);
+    ASSERT_EQ(all[i], interior[i] + boundary[i]);
+    if (interior[i] > 0) {
+      ASSERT_GE(i - h, h);
+      ASSERT_LT(i + h, n + h);
+    }
+    if (is_owned && i - h >= h && i + h < n + h) {
+      ASSERT_EQ(1, interior[i]);
+    }
+  }
+}
+
+TEST(DistributedTest, BlockPartition)
+{
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  checkPartition(103 * size, 0);
+  checkPartition(103 * size, 1);
+  checkPartition(103 * size + 1, 3);
+  checkPartition(4 * size - 1, 2);
+  checkPartition(3 * size, 3);
+}
+
+static void checkHaloExchange(int global_size, int halo_width)
+{
+  partition_type part(MPI_COMM_WORLD, global_size, halo_width);
+
+  const int h = part.halo_width();
+  const int n = part.num_owned();
+
+  std::vector<double> u(part.local_size(), no_neighbor);
+  std::vector<double> v(part.local_size(), no_neighbor);
+  for (int i = h; i < n + h; ++i) {
+    u[i] = global_value(0, part.to_global(i));
+    v[i] = global_value(1, part.to_global(i));
+  }
+
+  halo_type halo(part, {u.data(), v.data()}, Allocator{});
+
+  // exchange twice to check the exchange can be reused
+  for (int rep = 0; rep < 2; ++rep) {
+    halo.start();
+    halo.finish();
+
+    for (int i = 0; i < part.local_size(); ++i) {
+      const int g = part.to_global(i);
+      const bool has_value = (i >= h && i < n + h) ||
+                             (i < h && part.lower_neighbor() != MPI_PROC_NULL) ||
+                             (i >= n + h && part.upper_neighbor() != MPI_PROC_NULL);
+      ASSERT_EQ(has_value ? global_value(0, g) : no_neighbor, u[i]);
+      ASSERT_EQ(has_value ? global_value(1, g) : no_neighbor, v[i]);
+    }
+  }
+}
+
+TEST(DistributedTest, HaloExchange)
+{
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  checkHaloExchange(50 * size, 1);
+  checkHaloExchange(50 * size + 3, 4);
+  checkHaloExchange(2 * size, 2);
+  checkHaloExchange(7 * size, 0);
+}
+
+static void checkHaloForall(int global_size, int radius)
+{
+  partition_type part(MPI_COMM_WORLD, global_size, radius);
+
+  const int n = part.num_owned();
+
+  std::vector<double> u(part.local_size(), no_neighbor);
+  std::vector<double> out(part.local_size(), 0.0);
+  for (int i = radius; i < n + radius; ++i) {
+    u[i] = global_value(0, part.to_global(i));
+  }
+
+  halo_type halo(part, {u.data()}, Allocator{});
+
+  const double* u_ptr = u.data();
+  double* out_ptr = out.data();
+  RAJA::expt::halo_forall<RAJA::seq_exec>(halo, [=](int i) {
+    double s = 0.0;
+    for (int k = -radius; k <= radius; ++k) {
+      s += (k + radius + 1) * u_ptr[i + k];
+    }
+    out_ptr[i] = s;
+  });
+
+  for (int i = radius; i < n + radius; ++i) {
+    const int g = part.to_global(i);
+    double ref = 0.0;
+    for (int k = -radius; k <= radius; ++k) {
+      const bool in_range = g + k >= 0 && g + k < global_size;
+      ref += (k + radius + 1) * (in_range ? global_value(0, g + k) : no_neighbor);
+    }
+    ASSERT_EQ(ref, out[i]);
+  }
+}
+
+TEST(DistributedTest, HaloForall)
+{
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  checkHaloForall(40 * size + 1, 1);
+  checkHaloForall(40 * size, 3);
+  checkHaloForall(2 * size, 2);
+}
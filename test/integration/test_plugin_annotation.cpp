@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include "RAJA_test-workgroup.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The annotation plugin is loaded from RAJA_PLUGINS.  Without a profiler
+// attached its ranges are not observable, so the tests check that every
+// pattern, named or not, runs through it with the loop bodies intact, and
+// that the plugin was loaded.
+
+using workgroup_policy = RAJA::WorkGroupPolicy<RAJA::seq_work,
+                                               RAJA::ordered,
+                                               RAJA::ragged_array_of_objects>;
+
+using Allocator = typename detail::ResourceAllocator<
+    camp::resources::Host>::template std_allocator<char>;
+
+static void checkValues(std::vector<int> const& a, int value)
+{
+  for (size_t i = 0; i < a.size(); ++i) {
+    ASSERT_EQ(value, a[i]) << "index " << i;
+  }
+}
+
+TEST(PluginTestAnnotation, Patterns)
+{
+  const char* plugins = getenv("RAJA_PLUGINS");
+  const char* manifest = getenv("RAJA_PLUGINS_MANIFEST");
+  ASSERT_NE(plugins, nullptr);
+  ASSERT_NE(manifest, nullptr);
+
+  // nothing is loaded before the first launch
+  std::remove(manifest);
+
+  constexpr int N = 100;
+  std::vector<int> a(N, -1);
+  int* a_ptr = a.data();
+
+  // named, and unnamed so that the label is made from the launch site
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                               RAJA::expt::KernelName("annotation_forall"),
+                               [=](int i) { a_ptr[i] = 1; });
+  checkValues(a, 1);
+
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                                 [=](int i) { a_ptr[i] = 2 + rep; });
+    checkValues(a, 2 + rep);
+  }
+
+  // a name in a buffer that is reused for the next name
+  std::string name;
+  for (int rep = 0; rep < 3; ++rep) {
+    name = "annotation_buffer_" + std::to_string(rep);
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                                 RAJA::expt::KernelName(name.c_str()),
+                                 [=](int i) { a_ptr[i] = 10 + rep; });
+    checkValues(a, 10 + rep);
+  }
+
+  using kernel_policy = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::For<1, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>>>>;
+
+  RAJA::kernel<kernel_policy>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, 10), RAJA::RangeSegment(0, 10)),
+      [=](int i, int j) { a_ptr[10 * i + j] = 20; });
+  checkValues(a, 20);
+
+  using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>;
+  using loop_policy = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+  RAJA::expt::launch<launch_policy>(
+      RAJA::expt::Grid(RAJA::expt::Teams(1), RAJA::expt::Threads(1),
+                       "annotation_launch"),
+      [=](RAJA::expt::LaunchContext ctx) {
+        RAJA::expt::loop<loop_policy>(ctx, RAJA::RangeSegment(0, N),
+                                      [&](int i) { a_ptr[i] = 30; });
+      });
+  checkValues(a, 30);
+
+  RAJA::expt::launch<launch_policy>(
+      RAJA::expt::Grid(RAJA::expt::Teams(1), RAJA::expt::Threads(1)),
+      [=](RAJA::expt::LaunchContext ctx) {
+        RAJA::expt::loop<loop_policy>(ctx, RAJA::RangeSegment(0, N),
+                                      [&](int i) { a_ptr[i] = 31; });
+      });
+  checkValues(a, 31);
+
+  {
+    RAJA::WorkPool<workgroup_policy, int, RAJA::xargs<>, Allocator>
+        pool(Allocator{});
+    pool.enqueue(RAJA::TypedRangeSegment<int>(0, N / 2),
+                 [=](int i) { a_ptr[i] = 40; });
+    pool.enqueue(RAJA::TypedRangeSegment<int>(N / 2, N),
+                 [=](int i) { a_ptr[i] = 40; });
+    auto group = pool.instantiate();
+    auto site = group.run();
+  }
+  checkValues(a, 40);
+
+  std::ifstream in(manifest);
+  ASSERT_TRUE(in.good());
+
+  std::string line;
+  ASSERT_TRUE(static_cast<bool>(std::getline(in, line)));
+  ASSERT_EQ(line, std::string(plugins));
+}
+
+// every thread keeps its own labels of the launch sites
+TEST(PluginTestAnnotation, Threads)
+{
+  constexpr int num_threads = 4;
+  constexpr int N = 1000;
+
+  std::vector<std::vector<int>> a(num_threads, std::vector<int>(N, -1));
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&a, t]() {
+      int* a_ptr = a[t].data();
+      for (int rep = 0; rep < 50; ++rep) {
+        RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                                     [=](int i) { a_ptr[i] = t + rep; });
+        RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                                     RAJA::expt::KernelName("annotation_threads"),
+                                     [=](int i) { a_ptr[i] += 1; });
+      }
+    });
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+
+  for (int t = 0; t < num_threads; ++t) {
+    checkValues(a[t], t + 50);
+  }
+}
@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <caliper/Caliper.h>
+
+#include <string>
+
+// The Caliper plugin is loaded from RAJA_PLUGINS.  The loop bodies read the
+// innermost values of the region and the raja attributes on their thread's
+// blackboard, which the plugin sets for named loops only.
+
+namespace {
+
+struct Annotations {
+  std::string region;
+  std::string pattern;
+  std::string platform;
+  std::string policy;
+  long long iterations = -1;
+};
+
+std::string current_string(const char* name)
+{
+  cali::Caliper c;
+  cali::Attribute attr = c.get_attribute(name);
+  if (attr == cali::Attribute::invalid) {
+    return "";
+  }
+  cali::Entry e = c.get(attr);
+  return e.empty() ? "" : e.value().to_string();
+}
+
+Annotations current_annotations()
+{
+  Annotations a;
+  a.region = current_string("region");
+  a.pattern = current_string("raja.pattern");
+  a.platform = current_string("raja.platform");
+  a.policy = current_string("raja.policy");
+  const std::string iterations = current_string("raja.iterations");
+  if (!iterations.empty()) {
+    a.iterations = std::stoll(iterations);
+  }
+  return a;
+}
+
+}  // namespace
+
+TEST(PluginTestCaliper, Forall)
+{
+  constexpr int N = 37;
+  Annotations seen;
+  Annotations* seen_ptr = &seen;
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                               RAJA::expt::KernelName("caliper_forall"),
+                               [=](int i) {
+                                 if (i == 0) *seen_ptr = current_annotations();
+                               });
+
+  ASSERT_EQ("caliper_forall", seen.region);
+  ASSERT_EQ("forall", seen.pattern);
+  ASSERT_EQ("host", seen.platform);
+  ASSERT_NE(std::string::npos, seen.policy.find("seq_exec"));
+  ASSERT_EQ(N, seen.iterations);
+
+  // the regions and attributes are closed after the loop
+  Annotations after = current_annotations();
+  ASSERT_EQ("", after.region);
+  ASSERT_EQ("", after.pattern);
+  ASSERT_EQ(-1, after.iterations);
+
+  // unnamed loops get no region
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    if (i == 0) *seen_ptr = current_annotations();
+  });
+  ASSERT_EQ("", seen.region);
+  ASSERT_EQ("", seen.pattern);
+}
+
+TEST(PluginTestCaliper, NestedPatterns)
+{
+  Annotations inner;
+  Annotations outer;
+  Annotations* inner_ptr = &inner;
+  Annotations* outer_ptr = &outer;
+
+  using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>;
+
+  RAJA::expt::launch<launch_policy>(
+      RAJA::expt::Grid(RAJA::expt::Teams(2), RAJA::expt::Threads(3),
+                       "caliper_launch"),
+      [=](RAJA::expt::LaunchContext) {
+        *outer_ptr = current_annotations();
+
+        using kernel_policy = RAJA::KernelPolicy<
+            RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>>;
+
+        RAJA::kernel<kernel_policy>(
+            RAJA::expt::KernelName("caliper_kernel"),
+            RAJA::make_tuple(RAJA::RangeSegment(0, 1)),
+            [=](int) { *inner_ptr = current_annotations(); });
+      });
+
+  ASSERT_EQ("caliper_launch", outer.region);
+  ASSERT_EQ("launch", outer.pattern);
+  ASSERT_EQ(6, outer.iterations);
+
+  ASSERT_EQ("caliper_kernel", inner.region);
+  ASSERT_EQ("kernel", inner.pattern);
+
+  Annotations after = current_annotations();
+  ASSERT_EQ("", after.region);
+  ASSERT_EQ("", after.pattern);
+}
@@ -0,0 +1,55 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// The counts depend on the machine and are 0 where perf_event can't be
+// used, so only the rows and the declared sizes are checked.
+TEST(PluginTestCounter, Aggregates)
+{
+  const char* file = getenv("RAJA_COUNTERS_FILE");
+  ASSERT_NE(file, nullptr);
+
+  double* a = new double[100];
+
+  for (int n = 0; n < 3; ++n) {
+    RAJA::forall<RAJA::seq_exec>(
+        RAJA::RangeSegment(0, 100),
+        RAJA::expt::KernelName("counter_fill", 800, 0),
+        [=](int i) { a[i] = 1.0; });
+  }
+
+  RAJA::util::finalize_plugins();
+
+  delete[] a;
+
+  std::ifstream in(file);
+  ASSERT_TRUE(in.good());
+
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(in, line);) {
+    lines.push_back(line);
+  }
+
+  ASSERT_EQ(lines.size(), 2u);
+  EXPECT_EQ(lines[0],
+            "kernel_name,launch_site,policy,count,iterations,bytes,flops,"
+            "time_ns,cycles,instructions");
+
+  // count, iterations and bytes follow the three quoted names
+  const std::string& row = lines[1];
+  EXPECT_EQ(row.find("\"counter_fill\""), 0u);
+  size_t pos = 0;
+  for (int q = 0; q < 6; ++q) pos = row.find('"', pos) + 1;
+  EXPECT_EQ(row.compare(pos, 11, ",3,300,2400"), 0);
+}
@@ -0,0 +1,38 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+TEST(PluginTestFinalizeUnloaded, NotLoaded)
+{
+  const char* manifest = getenv("RAJA_PLUGINS_MANIFEST");
+  ASSERT_NE(manifest, nullptr);
+
+  std::remove(manifest);
+
+  // finalize before any launch does not load the plugins, so the plugin
+  // directory is not scanned and no manifest is written
+  RAJA::util::finalize_plugins();
+
+  std::ifstream in(manifest);
+  ASSERT_FALSE(in.good());
+
+  // nor are they loaded by launches after finalize, the plugin would throw
+  int* a = new int[10];
+
+  ASSERT_NO_THROW({
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                                 [=](int i) { a[i] = 0; });
+  });
+
+  delete[] a;
+}
@@ -0,0 +1,44 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+TEST(PluginTestManifest, LazyLoad)
+{
+  const char* plugins = getenv("RAJA_PLUGINS");
+  const char* manifest = getenv("RAJA_PLUGINS_MANIFEST");
+  ASSERT_NE(plugins, nullptr);
+  ASSERT_NE(manifest, nullptr);
+
+  // nothing is loaded before the first launch, so the manifest of an
+  // earlier run can still be removed
+  std::remove(manifest);
+
+  int* a = new int[10];
+
+  // the plugin throws in preLaunch
+  ASSERT_ANY_THROW({
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                                 [=](int i) { a[i] = 0; });
+  });
+
+  delete[] a;
+
+  std::ifstream in(manifest);
+  ASSERT_TRUE(in.good());
+
+  std::string line;
+  ASSERT_TRUE(static_cast<bool>(std::getline(in, line)));
+  ASSERT_EQ(line, std::string(plugins));
+  ASSERT_FALSE(static_cast<bool>(std::getline(in, line)));
+}
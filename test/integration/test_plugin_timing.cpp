@@ -0,0 +1,67 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST(PluginTestTiming, Aggregates)
+{
+  const char* file = getenv("RAJA_TIMING_FILE");
+  ASSERT_NE(file, nullptr);
+
+  int* a = new int[10];
+
+  // more launches than the ring buffer holds, so records are aggregated
+  // before finalize
+  for (int n = 0; n < 1500; ++n) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                                 RAJA::expt::KernelName("timing_zero"),
+                                 [=](int i) { a[i] = 0; });
+  }
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 5),
+                               RAJA::expt::KernelName("timing_one"),
+                               [=](int i) { a[i] = 1; });
+
+  RAJA::util::finalize_plugins();
+
+  delete[] a;
+
+  std::ifstream in(file);
+  ASSERT_TRUE(in.good());
+
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(in, line);) {
+    lines.push_back(line);
+  }
+
+  ASSERT_EQ(lines.size(), 3u);
+  EXPECT_EQ(lines[0].find("kernel_name,launch_site,policy"), 0u);
+
+  // rows are ordered by kernel name, with the count and iterations after the
+  // three quoted names and the platform
+  auto field = [](std::string const& line, int f) {
+    size_t pos = 0;
+    for (int q = 0; q < 6; ++q) pos = line.find('"', pos) + 1;
+    pos = line.find(',', pos) + 1;
+    for (int s = 0; s < f; ++s) pos = line.find(',', pos) + 1;
+    return line.substr(pos, line.find(',', pos) - pos);
+  };
+
+  EXPECT_EQ(lines[1].find("\"timing_one\""), 0u);
+  EXPECT_EQ(field(lines[1], 1), "1");
+  EXPECT_EQ(field(lines[1], 2), "5");
+
+  EXPECT_EQ(lines[2].find("\"timing_zero\""), 0u);
+  EXPECT_EQ(field(lines[2], 1), "1500");
+  EXPECT_EQ(field(lines[2], 2), "15000");
+}
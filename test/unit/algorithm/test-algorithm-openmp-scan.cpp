@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the cache blocked OpenMP scans across
+/// their tile and round boundaries.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+//
+// Scan lengths below the thread count, within one tile, at the end of a
+// round of one tile per thread, and over rounds with a short last round
+// match the sequential scans, in place and out of place.
+//
+template <typename T, typename OP>
+void OpenMPScanTestImpl(int num_threads, T init)
+{
+  const int tile = std::max(
+      static_cast<int>(RAJA::SCAN_TILE_BYTES / sizeof(T)), 1);
+  const int round = tile * num_threads;
+  const int lens[] = {0, 1, num_threads - 1, num_threads + 1, tile - 1, tile,
+                      tile + 1, round, round + 1, 2 * round + 17};
+
+  const int old_threads = omp_get_max_threads();
+  omp_set_num_threads(num_threads);
+
+  for (int N : lens) {
+    std::vector<T> in(N);
+    for (int i = 0; i < N; ++i) {
+      in[i] = static_cast<T>((i * 37) % 11 - 5);
+    }
+
+    std::vector<T> ref_inc(N);
+    std::vector<T> ref_exc(N);
+    T agg = OP::identity();
+    T exc = init;
+    for (int i = 0; i < N; ++i) {
+      ref_exc[i] = exc;
+      agg = OP()(agg, in[i]);
+      exc = OP()(exc, in[i]);
+      ref_inc[i] = agg;
+    }
+
+    std::vector<T> out(N, T(-99));
+    RAJA::inclusive_scan<RAJA::omp_parallel_for_exec>(
+        RAJA::make_span(static_cast<const T*>(in.data()), N),
+        RAJA::make_span(out.data(), N),
+        OP{});
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(ref_inc[i], out[i]) << "inclusive N " << N << " index " << i;
+    }
+
+    std::vector<T> out_exc(N, T(-99));
+    RAJA::exclusive_scan<RAJA::omp_parallel_for_exec>(
+        RAJA::make_span(static_cast<const T*>(in.data()), N),
+        RAJA::make_span(out_exc.data(), N),
+        OP{},
+        init);
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(ref_exc[i], out_exc[i])
+          << "exclusive N " << N << " index " << i;
+    }
+
+    std::vector<T> x(in);
+    RAJA::inclusive_scan_inplace<RAJA::omp_parallel_for_exec>(
+        RAJA::make_span(x.data(), N), OP{});
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(ref_inc[i], x[i])
+          << "inclusive in place N " << N << " index " << i;
+    }
+
+    x = in;
+    RAJA::exclusive_scan_inplace<RAJA::omp_parallel_for_exec>(
+        RAJA::make_span(x.data(), N), OP{}, init);
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(ref_exc[i], x[i])
+          << "exclusive in place N " << N << " index " << i;
+    }
+  }
+
+  omp_set_num_threads(old_threads);
+}
+
+TEST(OpenMPScanTest, PlusInt)
+{
+  for (int p : {1, 3, 4}) {
+    OpenMPScanTestImpl<int, RAJA::operators::plus<int>>(p, 7);
+  }
+}
+
+TEST(OpenMPScanTest, PlusDouble)
+{
+  for (int p : {1, 3, 4}) {
+    OpenMPScanTestImpl<double, RAJA::operators::plus<double>>(p, 0.5);
+  }
+}
+
+TEST(OpenMPScanTest, MaximumInt)
+{
+  for (int p : {1, 3, 4}) {
+    OpenMPScanTestImpl<int, RAJA::operators::maximum<int>>(p, -100);
+  }
+}
+
+#endif
@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the parallel merge of the OpenMP stable
+/// sorts.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+// comparators that are not operators::less or operators::greater, so the
+// sorts merge instead of radix sorting
+struct KeyLess {
+  bool operator()(int a, int b) const { return a < b; }
+};
+
+struct KeyGreater {
+  bool operator()(int a, int b) const { return a > b; }
+};
+
+struct Record {
+  int key;
+  int tag;
+};
+
+struct RecordLess {
+  bool operator()(Record const& a, Record const& b) const
+  {
+    return a.key < b.key;
+  }
+};
+
+static int mergeKey(int i, int num_keys)
+{
+  return static_cast<int>((7919LL * i + 13) % num_keys);
+}
+
+//
+// Thread counts that give odd numbers of runs in a merge level, and lengths
+// from one chunk per thread to many, with few distinct keys so the order of
+// equal keys is checked.
+//
+static const int merge_threads[] = {2, 3, 5, 8};
+
+template <typename Body>
+static void forMergeCases(Body body)
+{
+  const int old_threads = omp_get_max_threads();
+  for (int p : merge_threads) {
+    omp_set_num_threads(p);
+    const int lens[] = {128 * p - 1, 128 * p, 128 * p + 1, 1000, 100003};
+    for (int N : lens) {
+      for (int num_keys : {1, 7, 1000}) {
+        body(p, N, num_keys);
+      }
+    }
+  }
+  omp_set_num_threads(old_threads);
+}
+
+TEST(OpenMPStableSortTest, Records)
+{
+  forMergeCases([](int p, int N, int num_keys) {
+    std::vector<Record> x(N);
+    for (int i = 0; i < N; ++i) {
+      x[i] = Record{mergeKey(i, num_keys), i};
+    }
+    std::vector<Record> ref(x);
+    std::stable_sort(ref.begin(), ref.end(), RecordLess{});
+
+    RAJA::stable_sort<RAJA::omp_parallel_for_exec>(
+        RAJA::make_span(x.data(), N), RecordLess{});
+
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(ref[i].key, x[i].key)
+          << "threads " << p << " N " << N << " index " << i;
+      ASSERT_EQ(ref[i].tag, x[i].tag)
+          << "threads " << p << " N " << N << " index " << i;
+    }
+  });
+}
+
+template <typename Compare>
+static void checkStableSortPairs(int p, int N, int num_keys)
+{
+  std::vector<int> keys(N);
+  std::vector<std::string> vals(N);
+  std::vector<int> order(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = mergeKey(i, num_keys);
+    vals[i] = std::to_string(i);
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return Compare{}(keys[a], keys[b]);
+  });
+
+  RAJA::stable_sort_pairs<RAJA::omp_parallel_for_exec>(
+      RAJA::make_span(keys.data(), N),
+      RAJA::make_span(vals.data(), N),
+      Compare{});
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(mergeKey(order[i], num_keys), keys[i])
+        << "threads " << p << " N " << N << " index " << i;
+    ASSERT_EQ(std::to_string(order[i]), vals[i])
+        << "threads " << p << " N " << N << " index " << i;
+  }
+}
+
+TEST(OpenMPStableSortTest, PairsAscending)
+{
+  forMergeCases(checkStableSortPairs<KeyLess>);
+}
+
+TEST(OpenMPStableSortTest, PairsDescending)
+{
+  forMergeCases(checkStableSortPairs<KeyGreater>);
+}
+
+#endif
@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the radix sorts of arithmetic keys of
+/// the OpenMP and TBB sorts.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/radix_sort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+//
+// Signed keys with negative values and the extremes of the type, with few
+// distinct values so the order of equal keys is checked. Floating point keys include
+// -0.0 and 0.0, which compare equal, infinities and subnormals. Unsigned 64
+// bit keys leave the high bits unused, as Morton codes do, so passes with
+// one digit are skipped.
+//
+template <typename K>
+K radixKey(int i, int num_keys, std::true_type /*is_integral*/)
+{
+  const long long v = (7919LL * i + 13) % num_keys;
+  if (!std::is_signed<K>::value) {
+    return static_cast<K>(v << 3);
+  }
+  if (i % 101 == 3) {
+    return std::numeric_limits<K>::max();
+  }
+  if (i % 103 == 5) {
+    return std::numeric_limits<K>::lowest();
+  }
+  return static_cast<K>(v - num_keys / 2);
+}
+
+template <typename K>
+K radixKey(int i, int num_keys, std::false_type /*is_integral*/)
+{
+  switch (i % 97) {
+    case 1:  return K(-0.0);
+    case 2:  return K(0.0);
+    case 3:  return std::numeric_limits<K>::infinity();
+    case 4:  return -std::numeric_limits<K>::infinity();
+    case 5:  return std::numeric_limits<K>::denorm_min();
+    case 6:  return -std::numeric_limits<K>::denorm_min();
+    case 7:  return std::numeric_limits<K>::lowest();
+    default: break;
+  }
+  const long long v = (7919LL * i + 13) % num_keys;
+  return static_cast<K>(v - num_keys / 2) * K(0.25);
+}
+
+template <typename K>
+K radixKey(int i, int num_keys)
+{
+  return radixKey<K>(i, num_keys, std::is_integral<K>{});
+}
+
+template <typename K>
+bool sameBits(K a, K b)
+{
+  return std::memcmp(&a, &b, sizeof(K)) == 0;
+}
+
+//
+// Lengths on both sides of the smallest radix sorted length are sorted with
+// sort, stable_sort, sort_pairs and stable_sort_pairs and compared with
+// std::stable_sort. Equal keys keep their order in the stable sorts, bit
+// for bit so -0.0 and 0.0 are checked too.
+//
+template <typename ExecPolicy, typename K, typename Compare>
+void RadixSortTestImpl()
+{
+  const int min_radix = static_cast<int>(
+      RAJA::detail::get_min_radix_sort_iterates());
+  const int lens[] = {min_radix - 1, min_radix, min_radix + 1, 100003};
+
+  for (int N : lens) {
+    for (int num_keys : {2, 50, 100000}) {
+      std::vector<K> keys(N);
+      std::vector<int> order(N);
+      for (int i = 0; i < N; ++i) {
+        keys[i] = radixKey<K>(i, num_keys);
+        order[i] = i;
+      }
+      std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return Compare{}(keys[a], keys[b]);
+      });
+
+      std::vector<K> x(keys);
+      RAJA::sort<ExecPolicy>(RAJA::make_span(x.data(), N), Compare{});
+      for (int i = 0; i < N; ++i) {
+        ASSERT_TRUE(keys[order[i]] == x[i]) << "sort N " << N << " index " << i;
+      }
+
+      x = keys;
+      RAJA::stable_sort<ExecPolicy>(RAJA::make_span(x.data(), N), Compare{});
+      for (int i = 0; i < N; ++i) {
+        ASSERT_TRUE(sameBits(keys[order[i]], x[i]))
+            << "stable_sort N " << N << " index " << i;
+      }
+
+      x = keys;
+      std::vector<int> vals(N);
+      for (int i = 0; i < N; ++i) {
+        vals[i] = i;
+      }
+      RAJA::sort_pairs<ExecPolicy>(RAJA::make_span(x.data(), N),
+                                   RAJA::make_span(vals.data(), N),
+                                   Compare{});
+      std::vector<bool> seen(N, false);
+      for (int i = 0; i < N; ++i) {
+        ASSERT_TRUE(keys[order[i]] == x[i])
+            << "sort_pairs N " << N << " index " << i;
+        ASSERT_TRUE(vals[i] >= 0 && vals[i] < N);
+        ASSERT_FALSE(seen[vals[i]]);
+        seen[vals[i]] = true;
+        ASSERT_TRUE(sameBits(keys[vals[i]], x[i]))
+            << "sort_pairs N " << N << " index " << i;
+      }
+
+      x = keys;
+      for (int i = 0; i < N; ++i) {
+        vals[i] = i;
+      }
+      RAJA::stable_sort_pairs<ExecPolicy>(RAJA::make_span(x.data(), N),
+                                          RAJA::make_span(vals.data(), N),
+                                          Compare{});
+      for (int i = 0; i < N; ++i) {
+        ASSERT_TRUE(sameBits(keys[order[i]], x[i]))
+            << "stable_sort_pairs N " << N << " index " << i;
+        ASSERT_EQ(order[i], vals[i])
+            << "stable_sort_pairs N " << N << " index " << i;
+      }
+    }
+  }
+}
+
+template <typename ExecPolicy, typename K>
+void RadixSortBothOrdersTestImpl()
+{
+  static_assert(RAJA::detail::use_radix_sort<K*, RAJA::operators::less<K>>::value,
+                "keys must be radix sorted");
+  RadixSortTestImpl<ExecPolicy, K, RAJA::operators::less<K>>();
+  RadixSortTestImpl<ExecPolicy, K, RAJA::operators::greater<K>>();
+}
+
+#define RAJA_RADIX_SORT_TESTS(SUITE, POLICY)                               \
+  TEST(SUITE, Int32) { RadixSortBothOrdersTestImpl<POLICY, int32_t>(); }   \
+  TEST(SUITE, Int8) { RadixSortBothOrdersTestImpl<POLICY, int8_t>(); }     \
+  TEST(SUITE, Uint64) { RadixSortBothOrdersTestImpl<POLICY, uint64_t>(); } \
+  TEST(SUITE, Int64) { RadixSortBothOrdersTestImpl<POLICY, int64_t>(); }   \
+  TEST(SUITE, Float) { RadixSortBothOrdersTestImpl<POLICY, float>(); }     \
+  TEST(SUITE, Double) { RadixSortBothOrdersTestImpl<POLICY, double>(); }
+
+#if defined(RAJA_ENABLE_OPENMP)
+RAJA_RADIX_SORT_TESTS(OpenMPRadixSortTest, RAJA::omp_parallel_for_exec)
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+RAJA_RADIX_SORT_TESTS(TBBRadixSortTest, RAJA::tbb_for_exec)
+#endif
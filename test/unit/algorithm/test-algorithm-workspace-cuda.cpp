@@ -0,0 +1,66 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the cuda sort and scan workspace.
+///
+
+#include "tests/test-algorithm-workspace.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaWorkspace = RAJA::cuda::AlgorithmWorkspace;
+
+TEST(CudaAlgorithmWorkspaceTest, Reuse)
+{
+  WorkspaceReuseTestImpl<CudaWorkspace, camp::resources::Cuda>(
+      [](CudaWorkspace::key_type const& key, size_t& nbytes) {
+        return RAJA::cuda::detail::find_temp_storage_bytes(key, nbytes);
+      });
+}
+
+TEST(CudaAlgorithmWorkspaceTest, Slots)
+{
+  WorkspaceSlotsTestImpl<CudaWorkspace, camp::resources::Cuda>();
+}
+
+TEST(CudaAlgorithmWorkspaceTest, SortThenScan)
+{
+  WorkspaceAlgorithmsTestImpl<CudaWorkspace,
+                              RAJA::cuda_exec<256>,
+                              camp::resources::Cuda>(1000);
+  WorkspaceAlgorithmsTestImpl<CudaWorkspace,
+                              RAJA::cuda_exec<256>,
+                              camp::resources::Cuda>(1 << 16);
+}
+
+TEST(CudaAlgorithmWorkspaceTest, InplaceScan)
+{
+  using policy = RAJA::cuda_exec<256>;
+  WorkspaceInplaceScanTestImpl<CudaWorkspace, policy, camp::resources::Cuda>(
+      static_cast<int>(256 * RAJA::policy::cuda::SCAN_ITEMS_PER_THREAD),
+      [](int len) {
+        return RAJA::cuda::scan_inplace_storage_bytes<policy, int>(len);
+      });
+}
+
+TEST(CudaAlgorithmWorkspaceTest, InplaceScanLargeType)
+{
+  using policy = RAJA::cuda_exec<1024>;
+
+  // one value per thread fits in the look-back scan tiles
+  ASSERT_GT((RAJA::cuda::scan_inplace_storage_bytes<policy, ScanValue<2>>(1)),
+            size_t(0));
+  WorkspaceLargeTypeScanTestImpl<policy, camp::resources::Cuda, ScanValue<2>>(
+      3 * 1024 + 5);
+
+  // too large for the tiles, scanned by the vendor library
+  ASSERT_EQ((RAJA::cuda::scan_inplace_storage_bytes<policy, ScanValue<4>>(1)),
+            size_t(0));
+  WorkspaceLargeTypeScanTestImpl<policy, camp::resources::Cuda, ScanValue<4>>(
+      3 * 1024 + 5);
+}
+#endif
@@ -0,0 +1,66 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the hip sort and scan workspace.
+///
+
+#include "tests/test-algorithm-workspace.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+using HipWorkspace = RAJA::hip::AlgorithmWorkspace;
+
+TEST(HipAlgorithmWorkspaceTest, Reuse)
+{
+  WorkspaceReuseTestImpl<HipWorkspace, camp::resources::Hip>(
+      [](HipWorkspace::key_type const& key, size_t& nbytes) {
+        return RAJA::hip::detail::find_temp_storage_bytes(key, nbytes);
+      });
+}
+
+TEST(HipAlgorithmWorkspaceTest, Slots)
+{
+  WorkspaceSlotsTestImpl<HipWorkspace, camp::resources::Hip>();
+}
+
+TEST(HipAlgorithmWorkspaceTest, SortThenScan)
+{
+  WorkspaceAlgorithmsTestImpl<HipWorkspace,
+                              RAJA::hip_exec<256>,
+                              camp::resources::Hip>(1000);
+  WorkspaceAlgorithmsTestImpl<HipWorkspace,
+                              RAJA::hip_exec<256>,
+                              camp::resources::Hip>(1 << 16);
+}
+
+TEST(HipAlgorithmWorkspaceTest, InplaceScan)
+{
+  using policy = RAJA::hip_exec<256>;
+  WorkspaceInplaceScanTestImpl<HipWorkspace, policy, camp::resources::Hip>(
+      static_cast<int>(256 * RAJA::policy::hip::SCAN_ITEMS_PER_THREAD),
+      [](int len) {
+        return RAJA::hip::scan_inplace_storage_bytes<policy, int>(len);
+      });
+}
+
+TEST(HipAlgorithmWorkspaceTest, InplaceScanLargeType)
+{
+  using policy = RAJA::hip_exec<1024>;
+
+  // one value per thread fits in the look-back scan tiles
+  ASSERT_GT((RAJA::hip::scan_inplace_storage_bytes<policy, ScanValue<2>>(1)),
+            size_t(0));
+  WorkspaceLargeTypeScanTestImpl<policy, camp::resources::Hip, ScanValue<2>>(
+      3 * 1024 + 5);
+
+  // too large for the tiles, scanned by the vendor library
+  ASSERT_EQ((RAJA::hip::scan_inplace_storage_bytes<policy, ScanValue<4>>(1)),
+            size_t(0));
+  WorkspaceLargeTypeScanTestImpl<policy, camp::resources::Hip, ScanValue<4>>(
+      3 * 1024 + 5);
+}
+#endif
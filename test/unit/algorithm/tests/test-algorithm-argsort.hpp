@@ -0,0 +1,156 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA argsort and gather
+///
+
+#ifndef __TEST_ALGORITHM_ARGSORT_HPP__
+#define __TEST_ALGORITHM_ARGSORT_HPP__
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using ArgsortKeyTypeList = camp::list<int, double>;
+
+using SequentialArgsortExecPols = camp::list<RAJA::seq_exec,
+                                             RAJA::loop_exec>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPArgsortExecPols = camp::list<RAJA::omp_parallel_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBArgsortExecPols = camp::list<RAJA::tbb_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_STDPAR)
+using StdparArgsortExecPols = camp::list<RAJA::stdpar_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaArgsortExecPols = camp::list<RAJA::cuda_exec<128>>;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using HipArgsortExecPols = camp::list<RAJA::hip_exec<128>>;
+#endif
+
+template <typename T>
+::testing::AssertionResult check_argsort(const std::vector<T>& expected,
+                                         const T* actual)
+{
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename K>
+void ArgsortTestImpl(int N, int num_distinct)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  K* work_keys = working_res.allocate<K>(N);
+  K* work_out = working_res.allocate<K>(N);
+  int* work_perm = working_res.allocate<int>(N);
+  K* host_keys = host_res.allocate<K>(N);
+  int* host_perm = host_res.allocate<int>(N);
+
+  // few distinct keys so the stability of the permutation is checked
+  std::vector<K> keys(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<K>((i * 7919) % num_distinct - num_distinct / 2);
+  }
+
+  std::vector<int> ascending(N);
+  std::iota(ascending.begin(), ascending.end(), 0);
+  std::vector<int> descending(ascending);
+  std::stable_sort(ascending.begin(), ascending.end(),
+                   [&](int a, int b) { return keys[a] < keys[b]; });
+  std::stable_sort(descending.begin(), descending.end(),
+                   [&](int a, int b) { return keys[a] > keys[b]; });
+
+  std::vector<K> sorted(N);
+  for (int i = 0; i < N; ++i) {
+    sorted[i] = keys[ascending[i]];
+  }
+
+  res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+
+  // argsort without resource
+  RAJA::argsort<EXEC_POLICY>(RAJA::make_span(work_keys, N),
+                             RAJA::make_span(work_perm, N));
+
+  res.memcpy(host_perm, work_perm, sizeof(int) * N);
+  res.memcpy(host_keys, work_keys, sizeof(K) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_argsort(ascending, host_perm));
+  ASSERT_TRUE(check_argsort(keys, host_keys));
+
+  // gather the keys with the permutation
+  RAJA::gather<EXEC_POLICY>(res,
+                            RAJA::make_span(work_keys, N),
+                            RAJA::make_span(work_perm, N),
+                            RAJA::make_span(work_out, N));
+
+  res.memcpy(host_keys, work_out, sizeof(K) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_argsort(sorted, host_keys));
+
+  // argsort descending with resource
+  RAJA::argsort<EXEC_POLICY>(res,
+                             RAJA::make_span(work_keys, N),
+                             RAJA::make_span(work_perm, N),
+                             RAJA::operators::greater<K>{});
+
+  res.memcpy(host_perm, work_perm, sizeof(int) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_argsort(descending, host_perm));
+
+  working_res.deallocate(work_keys);
+  working_res.deallocate(work_out);
+  working_res.deallocate(work_perm);
+  host_res.deallocate(host_keys);
+  host_res.deallocate(host_perm);
+}
+
+
+TYPED_TEST_SUITE_P(ArgsortUnitTest);
+template <typename T>
+class ArgsortUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ArgsortUnitTest, Argsort)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using K                = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ArgsortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(0, 1);
+  ArgsortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(1, 1);
+  ArgsortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(357, 5);
+  ArgsortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(10000, 10000);
+  ArgsortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(100000, 101);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ArgsortUnitTest,
+                            Argsort);
+
+#endif // __TEST_ALGORITHM_ARGSORT_HPP__
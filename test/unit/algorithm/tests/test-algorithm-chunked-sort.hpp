@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA chunked_sort
+///
+
+#ifndef __TEST_ALGORITHM_CHUNKED_SORT_HPP__
+#define __TEST_ALGORITHM_CHUNKED_SORT_HPP__
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using ChunkedSortKeyTypeList = camp::list<int, double>;
+
+using SequentialChunkedSortExecPols = camp::list<RAJA::seq_exec>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPChunkedSortExecPols = camp::list<RAJA::omp_parallel_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBChunkedSortExecPols = camp::list<RAJA::tbb_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaChunkedSortExecPols = camp::list<RAJA::cuda_exec<128>>;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using HipChunkedSortExecPols = camp::list<RAJA::hip_exec<128>>;
+#endif
+
+template <typename T>
+::testing::AssertionResult check_chunked_sort(const std::vector<T>& expected,
+                                              const std::vector<T>& actual)
+{
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename K>
+void ChunkedSortTestImpl(size_t N, size_t chunk_size, size_t num_resources)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  std::vector<WORKING_RES> resources(num_resources, res);
+
+  std::vector<K> keys(N);
+  for (size_t i = 0; i < N; ++i) {
+    keys[i] = static_cast<K>(static_cast<long>((i * 7919) % 1009) - 504);
+  }
+
+  std::vector<K> ascending(keys);
+  std::sort(ascending.begin(), ascending.end());
+  std::vector<K> descending(keys);
+  std::sort(descending.begin(), descending.end(), std::greater<K>{});
+
+  // out of place, the sorted chunks are left in data
+  std::vector<K> data(keys);
+  std::vector<K> out(N);
+  RAJA::expt::chunked_sort<EXEC_POLICY>(resources, data.data(), out.data(),
+                                        N, chunk_size);
+
+  ASSERT_TRUE(check_chunked_sort(ascending, out));
+  for (size_t begin = 0; begin < N; begin += chunk_size) {
+    const size_t end = std::min(N, begin + chunk_size);
+    ASSERT_TRUE(std::is_sorted(data.begin() + begin, data.begin() + end));
+  }
+
+  // in place, descending
+  data = keys;
+  RAJA::expt::chunked_sort<EXEC_POLICY>(resources, data.data(), N,
+                                        chunk_size,
+                                        RAJA::operators::greater<K>{});
+
+  ASSERT_TRUE(check_chunked_sort(descending, data));
+}
+
+
+TYPED_TEST_SUITE_P(ChunkedSortUnitTest);
+template <typename T>
+class ChunkedSortUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ChunkedSortUnitTest, ChunkedSort)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using K                = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ChunkedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(0, 16, 1);
+  ChunkedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(1, 16, 1);
+  ChunkedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(100, 1000, 2);
+  ChunkedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(1000, 1000, 1);
+  ChunkedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(10000, 1000, 1);
+  ChunkedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(10357, 1000, 3);
+  ChunkedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(5000, 7, 2);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ChunkedSortUnitTest,
+                            ChunkedSort);
+
+#endif // __TEST_ALGORITHM_CHUNKED_SORT_HPP__
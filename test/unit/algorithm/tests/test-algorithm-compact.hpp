@@ -0,0 +1,155 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA copy_if, partition_copy and
+/// unique_copy
+///
+
+#ifndef __TEST_ALGORITHM_COMPACT_HPP__
+#define __TEST_ALGORITHM_COMPACT_HPP__
+
+#include <vector>
+
+using CompactValueTypeList = camp::list<int, double>;
+
+template <typename T>
+struct CompactSelect {
+  RAJA_HOST_DEVICE bool operator()(T val) const
+  {
+    return static_cast<int>(val) % 3 != 0;
+  }
+};
+
+template <typename T>
+::testing::AssertionResult check_compact(const std::vector<T>& expected,
+                                         const T* actual)
+{
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void CompactTestImpl(int N)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T* work_in = working_res.allocate<T>(N);
+  T* work_out = working_res.allocate<T>(N);
+  T* work_rejected = working_res.allocate<T>(N);
+  int* work_count = working_res.allocate<int>(1);
+  T* host_in = host_res.allocate<T>(N);
+  T* host_out = host_res.allocate<T>(N);
+  int* host_count = host_res.allocate<int>(1);
+
+  // runs of three equal values, a third of the values are not selected
+  for (int i = 0; i < N; ++i) {
+    host_in[i] = static_cast<T>((i / 4) * 5 + (i % 4 == 3 ? 1 : 0));
+  }
+
+  std::vector<T> selected;
+  std::vector<T> rejected;
+  std::vector<T> unique;
+  for (int i = 0; i < N; ++i) {
+    if (CompactSelect<T>{}(host_in[i])) {
+      selected.push_back(host_in[i]);
+    } else {
+      rejected.push_back(host_in[i]);
+    }
+    if (i == 0 || host_in[i - 1] != host_in[i]) {
+      unique.push_back(host_in[i]);
+    }
+  }
+
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  // copy_if without resource
+  RAJA::copy_if<EXEC_POLICY>(RAJA::make_span(work_in, N),
+                             RAJA::make_span(work_out, N),
+                             work_count,
+                             CompactSelect<T>{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_EQ(static_cast<size_t>(host_count[0]), selected.size());
+  ASSERT_TRUE(check_compact(selected, host_out));
+
+  // partition_copy with resource
+  RAJA::partition_copy<EXEC_POLICY>(res,
+                                    RAJA::make_span(work_in, N),
+                                    RAJA::make_span(work_out, N),
+                                    RAJA::make_span(work_rejected, N),
+                                    work_count,
+                                    CompactSelect<T>{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_EQ(static_cast<size_t>(host_count[0]), selected.size());
+  ASSERT_TRUE(check_compact(selected, host_out));
+
+  res.memcpy(host_out, work_rejected, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_compact(rejected, host_out));
+
+  // unique_copy with resource
+  RAJA::unique_copy<EXEC_POLICY>(res,
+                                 RAJA::make_span(work_in, N),
+                                 RAJA::make_span(work_out, N),
+                                 work_count);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_EQ(static_cast<size_t>(host_count[0]), unique.size());
+  ASSERT_TRUE(check_compact(unique, host_out));
+
+  working_res.deallocate(work_in);
+  working_res.deallocate(work_out);
+  working_res.deallocate(work_rejected);
+  working_res.deallocate(work_count);
+  host_res.deallocate(host_in);
+  host_res.deallocate(host_out);
+  host_res.deallocate(host_count);
+}
+
+
+TYPED_TEST_SUITE_P(CompactUnitTest);
+template <typename T>
+class CompactUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactUnitTest, Compact)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using T                = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  CompactTestImpl<EXEC_POLICY, WORKING_RESOURCE, T>(0);
+  CompactTestImpl<EXEC_POLICY, WORKING_RESOURCE, T>(1);
+  CompactTestImpl<EXEC_POLICY, WORKING_RESOURCE, T>(357);
+  CompactTestImpl<EXEC_POLICY, WORKING_RESOURCE, T>(32000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactUnitTest,
+                            Compact);
+
+#endif // __TEST_ALGORITHM_COMPACT_HPP__
@@ -0,0 +1,126 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA histogram
+///
+
+#ifndef __TEST_ALGORITHM_HISTOGRAM_HPP__
+#define __TEST_ALGORITHM_HISTOGRAM_HPP__
+
+#include <vector>
+
+using HistogramCountTypeList = camp::list<int, unsigned long long, double>;
+
+//! bin of a value, values that are multiples of 7 have no bin
+struct HistogramBin {
+  int num_bins;
+
+  RAJA_HOST_DEVICE int operator()(int val) const
+  {
+    return val % 7 == 0 ? -1 : (val * 13) % num_bins;
+  }
+};
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename CountT>
+void HistogramTestImpl(int N, int num_bins)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  int* work_in = working_res.allocate<int>(N > 0 ? N : 1);
+  CountT* work_bins = working_res.allocate<CountT>(num_bins);
+  int* host_in = host_res.allocate<int>(N > 0 ? N : 1);
+  CountT* host_bins = host_res.allocate<CountT>(num_bins);
+
+  // the first bins are counted much more often than the others
+  for (int i = 0; i < N; ++i) {
+    host_in[i] = (i % 4 == 0) ? i : (i % 3);
+  }
+
+  std::vector<CountT> expected(num_bins, CountT(1));
+  for (int i = 0; i < N; ++i) {
+    const int bin = HistogramBin{num_bins}(host_in[i]);
+    if (bin >= 0) {
+      expected[bin] += CountT(1);
+    }
+  }
+
+  // counts are added to the bins
+  for (int b = 0; b < num_bins; ++b) {
+    host_bins[b] = CountT(1);
+  }
+
+  res.memcpy(work_in, host_in, sizeof(int) * N);
+  res.memcpy(work_bins, host_bins, sizeof(CountT) * num_bins);
+
+  // histogram of values without resource
+  RAJA::histogram<EXEC_POLICY>(RAJA::make_span(work_in, N),
+                               work_bins,
+                               num_bins,
+                               HistogramBin{num_bins});
+
+  res.memcpy(host_bins, work_bins, sizeof(CountT) * num_bins);
+  res.wait();
+
+  for (int b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(host_bins[b], expected[b]) << "bin " << b;
+  }
+
+  // histogram of indices with resource
+  for (int i = 0; i < N; ++i) {
+    const int bin = HistogramBin{num_bins}(i);
+    if (bin >= 0) {
+      expected[bin] += CountT(1);
+    }
+  }
+
+  RAJA::histogram<EXEC_POLICY>(res,
+                               RAJA::TypedRangeSegment<int>(0, N),
+                               work_bins,
+                               num_bins,
+                               HistogramBin{num_bins});
+
+  res.memcpy(host_bins, work_bins, sizeof(CountT) * num_bins);
+  res.wait();
+
+  for (int b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(host_bins[b], expected[b]) << "bin " << b;
+  }
+
+  working_res.deallocate(work_in);
+  working_res.deallocate(work_bins);
+  host_res.deallocate(host_in);
+  host_res.deallocate(host_bins);
+}
+
+
+TYPED_TEST_SUITE_P(HistogramUnitTest);
+template <typename T>
+class HistogramUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(HistogramUnitTest, Histogram)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using CountT           = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  HistogramTestImpl<EXEC_POLICY, WORKING_RESOURCE, CountT>(0, 5);
+  HistogramTestImpl<EXEC_POLICY, WORKING_RESOURCE, CountT>(1, 5);
+  HistogramTestImpl<EXEC_POLICY, WORKING_RESOURCE, CountT>(357, 5);
+  HistogramTestImpl<EXEC_POLICY, WORKING_RESOURCE, CountT>(32000, 64);
+  // more bins than fit in gpu shared memory
+  HistogramTestImpl<EXEC_POLICY, WORKING_RESOURCE, CountT>(32000, 100000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(HistogramUnitTest,
+                            Histogram);
+
+#endif // __TEST_ALGORITHM_HISTOGRAM_HPP__
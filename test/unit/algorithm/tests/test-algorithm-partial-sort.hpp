@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA partial_sort and nth_element
+///
+
+#ifndef __TEST_ALGORITHM_PARTIAL_SORT_HPP__
+#define __TEST_ALGORITHM_PARTIAL_SORT_HPP__
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using PartialSortKeyTypeList = camp::list<int, double>;
+
+using SequentialPartialSortExecPols = camp::list<RAJA::seq_exec,
+                                                 RAJA::loop_exec>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPPartialSortExecPols = camp::list<RAJA::omp_parallel_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBPartialSortExecPols = camp::list<RAJA::tbb_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_STDPAR)
+using StdparPartialSortExecPols = camp::list<RAJA::stdpar_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaPartialSortExecPols = camp::list<RAJA::cuda_exec<128>>;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using HipPartialSortExecPols = camp::list<RAJA::hip_exec<128>>;
+#endif
+
+template <typename T>
+::testing::AssertionResult check_partial_sort(const std::vector<T>& sorted,
+                                              const T* actual,
+                                              int N,
+                                              int k)
+{
+  for (int i = 0; i < k; ++i) {
+    if (actual[i] != sorted[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << sorted[i] << " (at index " << i
+             << ")";
+    }
+  }
+  // the remaining values must be the remaining values of the sorted input
+  std::vector<T> rest(actual + k, actual + N);
+  std::sort(rest.begin(), rest.end());
+  for (int i = k; i < N; ++i) {
+    if (rest[i - k] != sorted[i]) {
+      return ::testing::AssertionFailure()
+             << rest[i - k] << " != " << sorted[i] << " (at sorted index "
+             << i << " after the first " << k << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename T, typename Compare>
+::testing::AssertionResult check_nth_element(const std::vector<T>& sorted,
+                                             const T* actual,
+                                             int N,
+                                             int nth,
+                                             Compare comp)
+{
+  if (actual[nth] != sorted[nth]) {
+    return ::testing::AssertionFailure()
+           << actual[nth] << " != " << sorted[nth] << " (at nth " << nth
+           << ")";
+  }
+  for (int i = 0; i < N; ++i) {
+    if ((i < nth && comp(actual[nth], actual[i])) ||
+        (i > nth && comp(actual[i], actual[nth]))) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " at index " << i << " is on the wrong side of "
+             << actual[nth] << " (at nth " << nth << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename K>
+void PartialSortTestImpl(int N, int num_distinct)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  K* work_keys = working_res.allocate<K>(N);
+  K* host_keys = host_res.allocate<K>(N);
+
+  // negative values check the bit order of the device radix select
+  std::vector<K> keys(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<K>((i * 7919) % num_distinct - num_distinct / 2);
+  }
+
+  std::vector<K> ascending(keys);
+  std::sort(ascending.begin(), ascending.end());
+  std::vector<K> descending(keys);
+  std::sort(descending.begin(), descending.end(), std::greater<K>());
+
+  for (int k : {0, 1, N / 3, N - 1, N}) {
+    if (k < 0 || k > N) continue;
+
+    // partial sort without resource
+    res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+    RAJA::partial_sort<EXEC_POLICY>(RAJA::make_span(work_keys, N), k);
+
+    res.memcpy(host_keys, work_keys, sizeof(K) * N);
+    res.wait();
+
+    ASSERT_TRUE(check_partial_sort(ascending, host_keys, N, k));
+
+    if (k < N) {
+      // nth element descending with resource
+      res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+      RAJA::nth_element<EXEC_POLICY>(res,
+                                     RAJA::make_span(work_keys, N),
+                                     k,
+                                     RAJA::operators::greater<K>{});
+
+      res.memcpy(host_keys, work_keys, sizeof(K) * N);
+      res.wait();
+
+      ASSERT_TRUE(check_nth_element(descending, host_keys, N, k,
+                                    std::greater<K>()));
+    }
+  }
+
+  working_res.deallocate(work_keys);
+  host_res.deallocate(host_keys);
+}
+
+
+TYPED_TEST_SUITE_P(PartialSortUnitTest);
+template <typename T>
+class PartialSortUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(PartialSortUnitTest, PartialSort)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using K                = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PartialSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(0, 1);
+  PartialSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(1, 1);
+  PartialSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(357, 5);
+  PartialSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(10000, 10000);
+  PartialSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(100000, 1001);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PartialSortUnitTest,
+                            PartialSort);
+
+#endif // __TEST_ALGORITHM_PARTIAL_SORT_HPP__
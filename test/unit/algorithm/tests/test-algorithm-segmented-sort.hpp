@@ -0,0 +1,180 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA sort_segmented and
+/// sort_pairs_segmented
+///
+
+#ifndef __TEST_ALGORITHM_SEGMENTED_SORT_HPP__
+#define __TEST_ALGORITHM_SEGMENTED_SORT_HPP__
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using SegmentedSortKeyTypeList = camp::list<int, double>;
+
+using SequentialSegmentedSortExecPols = camp::list<RAJA::seq_exec,
+                                                   RAJA::loop_exec>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPSegmentedSortExecPols = camp::list<RAJA::omp_parallel_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBSegmentedSortExecPols = camp::list<RAJA::tbb_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_STDPAR)
+using StdparSegmentedSortExecPols = camp::list<RAJA::stdpar_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaSegmentedSortExecPols = camp::list<RAJA::cuda_exec<128>>;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using HipSegmentedSortExecPols = camp::list<RAJA::hip_exec<128>>;
+#endif
+
+template <typename T>
+::testing::AssertionResult check_segmented_sort(const std::vector<T>& expected,
+                                                const T* actual)
+{
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename K>
+void SegmentedSortTestImpl(int num_segments, int max_segment_len)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  // segments of lengths 0 to max_segment_len-1
+  std::vector<int> offsets(num_segments + 1, 0);
+  for (int s = 0; s < num_segments; ++s) {
+    offsets[s + 1] = offsets[s] + (s * 7) % max_segment_len;
+  }
+  const int N = offsets[num_segments];
+
+  K* work_keys = working_res.allocate<K>(N);
+  int* work_vals = working_res.allocate<int>(N);
+  int* work_offsets = working_res.allocate<int>(num_segments + 1);
+  K* host_keys = host_res.allocate<K>(N);
+  int* host_vals = host_res.allocate<int>(N);
+
+  // few distinct keys so the stability of the pairs is checked
+  std::vector<K> keys(N);
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<K>((i * 37) % 11);
+    vals[i] = i;
+  }
+
+  std::vector<K> ascending(keys);
+  std::vector<K> descending(keys);
+  std::vector<int> ascending_vals(N);
+  for (int s = 0; s < num_segments; ++s) {
+    std::vector<std::pair<K, int>> seg;
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      seg.emplace_back(keys[i], vals[i]);
+    }
+    std::stable_sort(seg.begin(), seg.end(),
+                     [](std::pair<K, int> const& a, std::pair<K, int> const& b) {
+                       return a.first < b.first;
+                     });
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      ascending[i] = seg[i - offsets[s]].first;
+      ascending_vals[i] = seg[i - offsets[s]].second;
+    }
+    std::sort(descending.begin() + offsets[s],
+              descending.begin() + offsets[s + 1],
+              std::greater<K>());
+  }
+
+  res.memcpy(work_offsets, offsets.data(), sizeof(int) * (num_segments + 1));
+
+  // sort without resource
+  res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+  RAJA::sort_segmented<EXEC_POLICY>(
+      RAJA::make_span(work_keys, N),
+      RAJA::make_span(work_offsets, num_segments + 1));
+
+  res.memcpy(host_keys, work_keys, sizeof(K) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_segmented_sort(ascending, host_keys));
+
+  // sort descending with resource
+  res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+  RAJA::sort_segmented<EXEC_POLICY>(
+      res,
+      RAJA::make_span(work_keys, N),
+      RAJA::make_span(work_offsets, num_segments + 1),
+      RAJA::operators::greater<K>{});
+
+  res.memcpy(host_keys, work_keys, sizeof(K) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_segmented_sort(descending, host_keys));
+
+  // sort pairs with resource
+  res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+  res.memcpy(work_vals, vals.data(), sizeof(int) * N);
+  RAJA::sort_pairs_segmented<EXEC_POLICY>(
+      res,
+      RAJA::make_span(work_keys, N),
+      RAJA::make_span(work_vals, N),
+      RAJA::make_span(work_offsets, num_segments + 1));
+
+  res.memcpy(host_keys, work_keys, sizeof(K) * N);
+  res.memcpy(host_vals, work_vals, sizeof(int) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_segmented_sort(ascending, host_keys));
+  ASSERT_TRUE(check_segmented_sort(ascending_vals, host_vals));
+
+  working_res.deallocate(work_keys);
+  working_res.deallocate(work_vals);
+  working_res.deallocate(work_offsets);
+  host_res.deallocate(host_keys);
+  host_res.deallocate(host_vals);
+}
+
+
+TYPED_TEST_SUITE_P(SegmentedSortUnitTest);
+template <typename T>
+class SegmentedSortUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SegmentedSortUnitTest, SegmentedSort)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using K                = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  SegmentedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(0, 1);
+  SegmentedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(1, 100);
+  SegmentedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(357, 13);
+  SegmentedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(2000, 64);
+  SegmentedSortTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(10, 3001);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedSortUnitTest,
+                            SegmentedSort);
+
+#endif // __TEST_ALGORITHM_SEGMENTED_SORT_HPP__
@@ -0,0 +1,171 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA stable_sort_bits and
+/// stable_sort_pairs_bits
+///
+
+#ifndef __TEST_ALGORITHM_SORT_BITS_HPP__
+#define __TEST_ALGORITHM_SORT_BITS_HPP__
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <utility>
+#include <vector>
+
+using SortBitsKeyTypeList = camp::list<unsigned int, unsigned long long>;
+
+using SequentialSortBitsExecPols = camp::list<RAJA::seq_exec,
+                                              RAJA::loop_exec>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPSortBitsExecPols = camp::list<RAJA::omp_parallel_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBSortBitsExecPols = camp::list<RAJA::tbb_for_exec>;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaSortBitsExecPols = camp::list<RAJA::cuda_exec<128>>;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using HipSortBitsExecPols = camp::list<RAJA::hip_exec<128>>;
+#endif
+
+template <typename T>
+::testing::AssertionResult check_sort_bits(const std::vector<T>& expected,
+                                           const T* actual)
+{
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename K>
+void SortBitsTestImpl(int N, int begin_bit, int end_bit)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  K* work_keys = working_res.allocate<K>(N);
+  int* work_vals = working_res.allocate<int>(N);
+  K* host_keys = host_res.allocate<K>(N);
+  int* host_vals = host_res.allocate<int>(N);
+
+  // the keys only differ in [begin_bit, end_bit), bits below are all set
+  const int num_bits = static_cast<int>(sizeof(K) * CHAR_BIT);
+  const K high = (end_bit == num_bits) ? K(~K(0)) : K((K(1) << end_bit) - 1);
+  const K low = (begin_bit == 0) ? K(0) : K((K(1) << begin_bit) - 1);
+  std::vector<K> keys(N);
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    const K hash = static_cast<K>((i % 1009) * 2654435761ull * 0x9E3779B97F4A7C15ull);
+    keys[i] = (hash & high & ~low) | low;
+    vals[i] = i;
+  }
+
+  std::vector<std::pair<K, int>> expected(N);
+  for (int i = 0; i < N; ++i) {
+    expected[i] = std::make_pair(keys[i], vals[i]);
+  }
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](std::pair<K, int> const& a, std::pair<K, int> const& b) {
+                     return a.first > b.first;
+                   });
+  std::vector<K> descending(N);
+  std::vector<int> descending_vals(N);
+  for (int i = 0; i < N; ++i) {
+    descending[i] = expected[i].first;
+    descending_vals[i] = expected[i].second;
+  }
+  std::vector<K> ascending(keys);
+  std::sort(ascending.begin(), ascending.end());
+
+  // sort without resource
+  res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+  RAJA::stable_sort_bits<EXEC_POLICY>(RAJA::make_span(work_keys, N),
+                                      begin_bit, end_bit);
+
+  res.memcpy(host_keys, work_keys, sizeof(K) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_sort_bits(ascending, host_keys));
+
+  // sort pairs descending with resource
+  res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+  res.memcpy(work_vals, vals.data(), sizeof(int) * N);
+  RAJA::stable_sort_pairs_bits<EXEC_POLICY>(res,
+                                            RAJA::make_span(work_keys, N),
+                                            RAJA::make_span(work_vals, N),
+                                            begin_bit, end_bit,
+                                            RAJA::operators::greater<K>{});
+
+  res.memcpy(host_keys, work_keys, sizeof(K) * N);
+  res.memcpy(host_vals, work_vals, sizeof(int) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_sort_bits(descending, host_keys));
+  ASSERT_TRUE(check_sort_bits(descending_vals, host_vals));
+
+  // sort with the bit range of the largest key
+  res.memcpy(work_keys, keys.data(), sizeof(K) * N);
+  RAJA::stable_sort_bits<EXEC_POLICY>(res,
+                                      RAJA::make_span(work_keys, N),
+                                      0, RAJA::radix_end_bit(high));
+
+  res.memcpy(host_keys, work_keys, sizeof(K) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_sort_bits(ascending, host_keys));
+
+  working_res.deallocate(work_keys);
+  working_res.deallocate(work_vals);
+  host_res.deallocate(host_keys);
+  host_res.deallocate(host_vals);
+}
+
+
+TYPED_TEST_SUITE_P(SortBitsUnitTest);
+template <typename T>
+class SortBitsUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SortBitsUnitTest, SortBits)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using K                = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  const int num_bits = static_cast<int>(sizeof(K) * CHAR_BIT);
+
+  ASSERT_EQ(RAJA::radix_end_bit(K(0)), 0);
+  ASSERT_EQ(RAJA::radix_end_bit(K(255)), 8);
+  ASSERT_EQ(RAJA::radix_end_bit(K(256)), 9);
+  ASSERT_EQ(RAJA::radix_end_bit(K(~K(0))), num_bits);
+
+  SortBitsTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(0, 0, num_bits);
+  SortBitsTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(357, 0, 12);
+  SortBitsTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(10000, 3, num_bits);
+  SortBitsTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(100000, 0, std::min(40, num_bits));
+  SortBitsTestImpl<EXEC_POLICY, WORKING_RESOURCE, K>(100000, 7, 21);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SortBitsUnitTest,
+                            SortBits);
+
+#endif // __TEST_ALGORITHM_SORT_BITS_HPP__
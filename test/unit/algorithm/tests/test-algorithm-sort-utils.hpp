@@ -83,6 +83,18 @@ struct PolicySynchronize<RAJA::hip_exec<BLOCK_SIZE, Async>>
 };
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+// partial specialization for sycl_exec
+template < size_t BLOCK_SIZE, bool Async >
+struct PolicySynchronize<RAJA::sycl_exec<BLOCK_SIZE, Async>>
+{
+  void synchronize()
+  {
+    if (Async) { RAJA::synchronize<RAJA::sycl_synchronize>(); }
+  }
+};
+#endif
+
 
 template <typename Res,
           typename pairs_category,
@@ -111,6 +111,28 @@ using TBBSortSorters =
 
 #endif
 
+#if defined(RAJA_ENABLE_STDPAR)
+
+using StdparSortSorters =
+  camp::list<
+              PolicySort<RAJA::stdpar_par_exec>,
+              PolicySort<RAJA::stdpar_par_unseq_exec>,
+              PolicySortPairs<RAJA::stdpar_exec>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+using OpenMPTargetSortSorters =
+  camp::list<
+              PolicySort<RAJA::omp_target_parallel_for_exec<256>>,
+              PolicySortPairs<RAJA::omp_target_parallel_for_exec<256>>,
+              PolicySort<RAJA::omp_target_parallel_for_exec_nt>
+            >;
+
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using CudaSortSorters =
@@ -132,5 +154,15 @@ using HipSortSorters =
 
 #endif
 
+#if defined(RAJA_ENABLE_SYCL) && defined(RAJA_ENABLE_ONEDPL)
+
+using SyclSortSorters =
+  camp::list<
+              PolicySort<RAJA::sycl_exec<128>>,
+              PolicySortPairs<RAJA::sycl_exec<128>>
+            >;
+
+#endif
+
 #endif //__TEST_UNIT_ALGORITHM_SORT_HPP__
 
@@ -111,6 +111,28 @@ using TBBStableSortSorters =
 
 #endif
 
+#if defined(RAJA_ENABLE_STDPAR)
+
+using StdparStableSortSorters =
+  camp::list<
+              PolicyStableSort<RAJA::stdpar_par_exec>,
+              PolicyStableSort<RAJA::stdpar_par_unseq_exec>,
+              PolicyStableSortPairs<RAJA::stdpar_exec>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+using OpenMPTargetStableSortSorters =
+  camp::list<
+              PolicyStableSort<RAJA::omp_target_parallel_for_exec<256>>,
+              PolicyStableSortPairs<RAJA::omp_target_parallel_for_exec<256>>,
+              PolicyStableSort<RAJA::omp_target_parallel_for_exec_nt>
+            >;
+
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using CudaStableSortSorters =
@@ -132,4 +154,14 @@ using HipStableSortSorters =
 
 #endif
 
+#if defined(RAJA_ENABLE_SYCL) && defined(RAJA_ENABLE_ONEDPL)
+
+using SyclStableSortSorters =
+  camp::list<
+              PolicyStableSort<RAJA::sycl_exec<128>>,
+              PolicyStableSortPairs<RAJA::sycl_exec<128>>
+            >;
+
+#endif
+
 #endif // __TEST_UNIT_ALGORITHM_STABLE_SORT_HPP__
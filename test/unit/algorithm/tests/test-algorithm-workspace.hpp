@@ -0,0 +1,330 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for the AlgorithmWorkspace that holds the
+/// temporary storage of GPU sorts and scans across calls.
+///
+
+#ifndef __TEST_ALGORITHM_WORKSPACE__
+#define __TEST_ALGORITHM_WORKSPACE__
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+//
+// A slot is kept while requests fit in it on the same stream, and the
+// cached temporary storage bytes are looked up by the whole key and outlive
+// release(). Nested workspaces hide the cache of the outer one.
+//
+template <typename Workspace, typename Res, typename FindBytes>
+void WorkspaceReuseTestImpl(FindBytes find_bytes)
+{
+  Res res = Res::get_default();
+  auto stream = res.get_stream();
+
+  Workspace ws;
+
+  void* p0 = ws.get_buffer(0, 1024, stream);
+  ASSERT_NE(p0, nullptr);
+  ASSERT_EQ(p0, ws.get_buffer(0, 1024, stream));
+  ASSERT_EQ(p0, ws.get_buffer(0, 16, stream));
+
+  void* p1 = ws.get_buffer(0, 1 << 20, stream);
+  ASSERT_NE(p1, nullptr);
+  ASSERT_EQ(p1, ws.get_buffer(0, 1 << 20, stream));
+  ASSERT_EQ(p1, ws.get_buffer(0, 1024, stream));
+
+  ws.reserve(1 << 21, stream);
+  void* p2 = ws.get_buffer(0, 1 << 21, stream);
+  ASSERT_EQ(p2, ws.get_buffer(0, 1 << 20, stream));
+
+  using alg = typename Workspace::algorithm;
+  auto key = Workspace::template make_key<int>(alg::sort_keys, 100);
+
+  size_t nbytes = 0;
+  ASSERT_FALSE(ws.find_temp_storage_bytes(key, nbytes));
+  ws.cache_temp_storage_bytes(key, 77);
+  ASSERT_TRUE(ws.find_temp_storage_bytes(key, nbytes));
+  ASSERT_EQ(nbytes, 77u);
+
+  // every part of the key is compared
+  ASSERT_FALSE(ws.find_temp_storage_bytes(
+      Workspace::template make_key<int>(alg::sort_pairs, 100), nbytes));
+  ASSERT_FALSE(ws.find_temp_storage_bytes(
+      Workspace::template make_key<int>(alg::sort_keys, 101), nbytes));
+  ASSERT_FALSE(ws.find_temp_storage_bytes(
+      Workspace::template make_key<double>(alg::sort_keys, 100), nbytes));
+  ASSERT_FALSE(ws.find_temp_storage_bytes(
+      Workspace::template make_key<int>(alg::sort_keys, 100, 0, 16), nbytes));
+
+  ws.release();
+  ASSERT_TRUE(ws.find_temp_storage_bytes(key, nbytes));
+  ASSERT_EQ(nbytes, 77u);
+  ASSERT_NE(ws.get_buffer(0, 1024, stream), nullptr);
+
+  // the innermost workspace is the current one
+  ASSERT_TRUE(find_bytes(key, nbytes));
+  {
+    Workspace inner;
+    ASSERT_FALSE(find_bytes(key, nbytes));
+    inner.cache_temp_storage_bytes(key, 5);
+    ASSERT_TRUE(find_bytes(key, nbytes));
+    ASSERT_EQ(nbytes, 5u);
+  }
+  ASSERT_TRUE(find_bytes(key, nbytes));
+  ASSERT_EQ(nbytes, 77u);
+}
+
+//
+// Every one of the num_buffers slots holds its own buffer, and a request
+// that does not fit a slot, or is on another stream, replaces only that
+// slot.
+//
+template <typename Workspace, typename Res>
+void WorkspaceSlotsTestImpl()
+{
+  ASSERT_EQ(static_cast<size_t>(Workspace::num_buffers), 3u);
+
+  Res res = Res::get_default();
+  auto stream = res.get_stream();
+
+  Workspace ws;
+
+  void* b[Workspace::num_buffers];
+  for (size_t s = 0; s < Workspace::num_buffers; ++s) {
+    b[s] = ws.get_buffer(s, 256 * (s + 1), stream);
+    ASSERT_NE(b[s], nullptr);
+    for (size_t t = 0; t < s; ++t) {
+      ASSERT_NE(b[s], b[t]);
+    }
+  }
+
+  // too large for slot 2
+  void* big = ws.get_buffer(2, 1 << 20, stream);
+  ASSERT_NE(big, nullptr);
+  ASSERT_EQ(b[0], ws.get_buffer(0, 256, stream));
+  ASSERT_EQ(b[1], ws.get_buffer(1, 512, stream));
+  ASSERT_EQ(big, ws.get_buffer(2, 768, stream));
+
+  Res other{};
+  if (other.get_stream() != stream) {
+    void* moved = ws.get_buffer(1, 512, other.get_stream());
+    ASSERT_NE(moved, nullptr);
+    ASSERT_EQ(moved, ws.get_buffer(1, 512, other.get_stream()));
+    ASSERT_EQ(b[0], ws.get_buffer(0, 256, stream));
+    ASSERT_EQ(big, ws.get_buffer(2, 768, stream));
+    other.wait();
+  }
+
+  ws.release();
+  res.wait();
+}
+
+//
+// Sorts of pairs use all three slots and scans the first, running them one
+// after another in one workspace gives the same results as without one.
+//
+template <typename Workspace, typename ExecPolicy, typename Res>
+void WorkspaceAlgorithmsTestImpl(int N)
+{
+  Res res = Res::get_default();
+
+  std::vector<int> keys(N);
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<int>((7919LL * i) % N);
+    vals[i] = 3 * keys[i] + 1;
+  }
+  std::vector<int> scan_in(N);
+  for (int i = 0; i < N; ++i) {
+    scan_in[i] = (i % 5) - 2;
+  }
+
+  int* d_keys = res.template allocate<int>(N);
+  int* d_vals = res.template allocate<int>(N);
+  int* d_in   = res.template allocate<int>(N);
+  int* d_out  = res.template allocate<int>(N);
+
+  std::vector<int> ref_scan(N);
+  std::partial_sum(scan_in.begin(), scan_in.end(), ref_scan.begin());
+
+  {
+    Workspace ws;
+
+    for (int rep = 0; rep < 3; ++rep) {
+      res.memcpy(d_keys, keys.data(), sizeof(int) * N);
+      res.memcpy(d_vals, vals.data(), sizeof(int) * N);
+      res.memcpy(d_in, scan_in.data(), sizeof(int) * N);
+
+      RAJA::sort_pairs<ExecPolicy>(res,
+                                   RAJA::make_span(d_keys, N),
+                                   RAJA::make_span(d_vals, N));
+      RAJA::inclusive_scan<ExecPolicy>(res,
+                                       RAJA::make_span(static_cast<const int*>(d_in), N),
+                                       RAJA::make_span(d_out, N));
+
+      std::vector<int> out_keys(N);
+      std::vector<int> out_vals(N);
+      std::vector<int> out_scan(N);
+      res.memcpy(out_keys.data(), d_keys, sizeof(int) * N);
+      res.memcpy(out_vals.data(), d_vals, sizeof(int) * N);
+      res.memcpy(out_scan.data(), d_out, sizeof(int) * N);
+      res.wait();
+
+      for (int i = 0; i < N; ++i) {
+        ASSERT_EQ(i, out_keys[i]);
+        ASSERT_EQ(3 * i + 1, out_vals[i]);
+        ASSERT_EQ(ref_scan[i], out_scan[i]);
+      }
+    }
+  }
+
+  res.deallocate(d_keys);
+  res.deallocate(d_vals);
+  res.deallocate(d_in);
+  res.deallocate(d_out);
+}
+
+//
+// In-place scans give the same results as the sequential scans across the
+// tile boundaries of the look-back scan, and the storage_bytes reported for
+// the largest length is enough for all of them, once reserved no scan
+// replaces the buffer.
+//
+template <typename Workspace,
+          typename ExecPolicy,
+          typename Res,
+          typename StorageBytes>
+void WorkspaceInplaceScanTestImpl(int tile_size, StorageBytes storage_bytes)
+{
+  Res res = Res::get_default();
+  auto stream = res.get_stream();
+
+  const int lens[] = {1, tile_size - 1, tile_size, tile_size + 1,
+                      2 * tile_size, 64 * tile_size + 3};
+  const int max_len = 64 * tile_size + 3;
+
+  ASSERT_EQ(storage_bytes(1), storage_bytes(tile_size));
+  ASSERT_LT(storage_bytes(tile_size), storage_bytes(tile_size + 1));
+  ASSERT_LE(storage_bytes(tile_size + 1), storage_bytes(max_len));
+
+  int* d_x = res.template allocate<int>(max_len);
+
+  {
+    Workspace ws;
+    ws.reserve(storage_bytes(max_len), stream);
+    void* reserved = ws.get_buffer(0, 1, stream);
+    ASSERT_NE(reserved, nullptr);
+
+    for (int N : lens) {
+      std::vector<int> in(N);
+      for (int i = 0; i < N; ++i) {
+        in[i] = (i % 7) - 3;
+      }
+      std::vector<int> ref_inc(N);
+      std::partial_sum(in.begin(), in.end(), ref_inc.begin());
+      std::vector<int> out(N);
+
+      res.memcpy(d_x, in.data(), sizeof(int) * N);
+      RAJA::inclusive_scan_inplace<ExecPolicy>(res, RAJA::make_span(d_x, N));
+      res.memcpy(out.data(), d_x, sizeof(int) * N);
+      res.wait();
+      for (int i = 0; i < N; ++i) {
+        ASSERT_EQ(ref_inc[i], out[i]) << "N " << N << " index " << i;
+      }
+
+      res.memcpy(d_x, in.data(), sizeof(int) * N);
+      RAJA::exclusive_scan_inplace<ExecPolicy>(res,
+                                               RAJA::make_span(d_x, N),
+                                               RAJA::operators::plus<int>{},
+                                               5);
+      res.memcpy(out.data(), d_x, sizeof(int) * N);
+      res.wait();
+      for (int i = 0; i < N; ++i) {
+        ASSERT_EQ(5 + ref_inc[i] - in[i], out[i]) << "N " << N << " index " << i;
+      }
+
+      ASSERT_EQ(reserved, ws.get_buffer(0, 1, stream));
+    }
+  }
+
+  res.deallocate(d_x);
+}
+
+//
+// A value of NumDoubles doubles, large enough that the look-back scan tiles
+// of the largest block size hold one value per thread or do not fit at all.
+//
+template <size_t NumDoubles>
+struct ScanValue {
+  double v[NumDoubles];
+};
+
+template <size_t NumDoubles>
+RAJA_HOST_DEVICE ScanValue<NumDoubles> operator+(
+    ScanValue<NumDoubles> const& lhs,
+    ScanValue<NumDoubles> const& rhs)
+{
+  ScanValue<NumDoubles> sum;
+  for (size_t k = 0; k < NumDoubles; ++k) {
+    sum.v[k] = lhs.v[k] + rhs.v[k];
+  }
+  return sum;
+}
+
+//
+// In-place scans of large values compile and give the sequential results
+// at any block size, whether they run the look-back scan or fall back to
+// the vendor library.
+//
+template <typename ExecPolicy, typename Res, typename T>
+void WorkspaceLargeTypeScanTestImpl(int len)
+{
+  Res res = Res::get_default();
+
+  std::vector<T> in(len);
+  for (int i = 0; i < len; ++i) {
+    for (size_t k = 0; k < sizeof(T) / sizeof(double); ++k) {
+      in[i].v[k] = static_cast<double>((i % 7) - 3 + static_cast<int>(k));
+    }
+  }
+  std::vector<T> ref_inc(len);
+  std::partial_sum(in.begin(), in.end(), ref_inc.begin());
+  std::vector<T> out(len);
+
+  T* d_x = res.template allocate<T>(len);
+
+  res.memcpy(d_x, in.data(), sizeof(T) * len);
+  RAJA::inclusive_scan_inplace<ExecPolicy>(res, RAJA::make_span(d_x, len));
+  res.memcpy(out.data(), d_x, sizeof(T) * len);
+  res.wait();
+  for (int i = 0; i < len; ++i) {
+    for (size_t k = 0; k < sizeof(T) / sizeof(double); ++k) {
+      ASSERT_EQ(ref_inc[i].v[k], out[i].v[k]) << "index " << i;
+    }
+  }
+
+  res.memcpy(d_x, in.data(), sizeof(T) * len);
+  RAJA::exclusive_scan_inplace<ExecPolicy>(res, RAJA::make_span(d_x, len));
+  res.memcpy(out.data(), d_x, sizeof(T) * len);
+  res.wait();
+  for (int i = 0; i < len; ++i) {
+    for (size_t k = 0; k < sizeof(T) / sizeof(double); ++k) {
+      ASSERT_EQ(ref_inc[i].v[k] - in[i].v[k], out[i].v[k]) << "index " << i;
+    }
+  }
+
+  res.deallocate(d_x);
+}
+
+#endif  //__TEST_ALGORITHM_WORKSPACE__
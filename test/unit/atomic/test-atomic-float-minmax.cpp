@@ -0,0 +1,190 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for GPU atomic min and max of floating
+/// point values, which use the integer atomics on their bits.
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+
+using float_minmax_types =
+    ::testing::Types<
+#if defined(RAJA_ENABLE_CUDA)
+                      std::tuple<float, RAJA::cuda_atomic, RAJA::cuda_exec<256>,
+                                 camp::resources::Cuda>,
+                      std::tuple<double, RAJA::cuda_atomic, RAJA::cuda_exec<256>,
+                                 camp::resources::Cuda>
+#endif
+#if defined(RAJA_ENABLE_CUDA) && defined(RAJA_ENABLE_HIP)
+                      ,
+#endif
+#if defined(RAJA_ENABLE_HIP)
+                      std::tuple<float, RAJA::hip_atomic, RAJA::hip_exec<256>,
+                                 camp::resources::Hip>,
+                      std::tuple<double, RAJA::hip_atomic, RAJA::hip_exec<256>,
+                                 camp::resources::Hip>
+#endif
+                    >;
+
+template <typename T>
+class AtomicFloatMinMaxUnitTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( AtomicFloatMinMaxUnitTest );
+
+// values of both signs, with a negative zero every 101 indices
+template <typename T>
+RAJA_HOST_DEVICE T floatMinMaxValue(int i, int N)
+{
+  return (i % 101 == 0) ? -T(0)
+                        : T(static_cast<int>((7919LL * i) % N) - N / 2) * T(0.25);
+}
+
+//
+// Every pair of an initial and an operand value of negative, negative
+// zero, zero and positive values, the infinities among them, in its own
+// address, so that each sign combination of the fast paths is taken.  The
+// old values and the results must be those of std::min and std::max, with
+// the zeros comparing equal.
+//
+GPU_TYPED_TEST_P( AtomicFloatMinMaxUnitTest, SignPairs )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+  using ExecPolicy = typename std::tuple_element<2, TypeParam>::type;
+  using Res = typename std::tuple_element<3, TypeParam>::type;
+
+  const T inf = std::numeric_limits<T>::infinity();
+  const std::vector<T> vals{-inf, T(-3.5), T(-0.25), -T(0), T(0),
+                            T(0.25), T(2.0), T(3.5), inf};
+  const int V = static_cast<int>(vals.size());
+  const int P = V * V;
+
+  std::vector<T> init(P), operand(P);
+  for (int a = 0; a < V; ++a) {
+    for (int b = 0; b < V; ++b) {
+      init[a * V + b] = vals[a];
+      operand[a * V + b] = vals[b];
+    }
+  }
+
+  Res res = Res::get_default();
+  T* d_operand = res.template allocate<T>(P);
+  T* d_min = res.template allocate<T>(P);
+  T* d_max = res.template allocate<T>(P);
+  T* d_old_min = res.template allocate<T>(P);
+  T* d_old_max = res.template allocate<T>(P);
+
+  res.memcpy(d_operand, operand.data(), sizeof(T) * P);
+  res.memcpy(d_min, init.data(), sizeof(T) * P);
+  res.memcpy(d_max, init.data(), sizeof(T) * P);
+
+  RAJA::forall<ExecPolicy>(res, RAJA::TypedRangeSegment<int>(0, P),
+      [=] RAJA_HOST_DEVICE (int i) {
+        d_old_min[i] = RAJA::atomicMin<AtomicPolicy>(d_min + i, d_operand[i]);
+        d_old_max[i] = RAJA::atomicMax<AtomicPolicy>(d_max + i, d_operand[i]);
+      });
+
+  std::vector<T> min(P), max(P), old_min(P), old_max(P);
+  res.memcpy(min.data(), d_min, sizeof(T) * P);
+  res.memcpy(max.data(), d_max, sizeof(T) * P);
+  res.memcpy(old_min.data(), d_old_min, sizeof(T) * P);
+  res.memcpy(old_max.data(), d_old_max, sizeof(T) * P);
+  res.wait();
+
+  for (int i = 0; i < P; ++i) {
+    ASSERT_EQ( init[i], old_min[i] ) << init[i] << " min " << operand[i];
+    ASSERT_EQ( init[i], old_max[i] ) << init[i] << " max " << operand[i];
+    ASSERT_EQ( std::min(init[i], operand[i]), min[i] )
+        << init[i] << " min " << operand[i];
+    ASSERT_EQ( std::max(init[i], operand[i]), max[i] )
+        << init[i] << " max " << operand[i];
+  }
+
+  res.deallocate(d_operand);
+  res.deallocate(d_min);
+  res.deallocate(d_max);
+  res.deallocate(d_old_min);
+  res.deallocate(d_old_max);
+}
+
+//
+// Many threads of values of both signs contend for one address and for a
+// few addresses, starting from a positive, a negative and a zero value.
+//
+GPU_TYPED_TEST_P( AtomicFloatMinMaxUnitTest, Contended )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+  using ExecPolicy = typename std::tuple_element<2, TypeParam>::type;
+  using Res = typename std::tuple_element<3, TypeParam>::type;
+
+  constexpr int N = 10007;
+  constexpr int max_targets = 13;
+
+  Res res = Res::get_default();
+  T* d_min = res.template allocate<T>(max_targets);
+  T* d_max = res.template allocate<T>(max_targets);
+
+  for (int targets : {1, max_targets}) {
+    for (T start : {T(1.0e6), T(-1.0e6), T(0)}) {
+
+      std::vector<T> ref_min(targets, start), ref_max(targets, start);
+      for (int i = 0; i < N; ++i) {
+        const T v = floatMinMaxValue<T>(i, N);
+        ref_min[i % targets] = std::min(ref_min[i % targets], v);
+        ref_max[i % targets] = std::max(ref_max[i % targets], v);
+      }
+
+      std::vector<T> starts(targets, start);
+      res.memcpy(d_min, starts.data(), sizeof(T) * targets);
+      res.memcpy(d_max, starts.data(), sizeof(T) * targets);
+
+      RAJA::forall<ExecPolicy>(res, RAJA::TypedRangeSegment<int>(0, N),
+          [=] RAJA_HOST_DEVICE (int i) {
+            const T v = floatMinMaxValue<T>(i, N);
+            RAJA::atomicMin<AtomicPolicy>(d_min + i % targets, v);
+            RAJA::atomicMax<AtomicPolicy>(d_max + i % targets, v);
+          });
+
+      std::vector<T> min(targets), max(targets);
+      res.memcpy(min.data(), d_min, sizeof(T) * targets);
+      res.memcpy(max.data(), d_max, sizeof(T) * targets);
+      res.wait();
+
+      for (int t = 0; t < targets; ++t) {
+        ASSERT_EQ( ref_min[t], min[t] ) << "targets " << targets
+                                        << " start " << start;
+        ASSERT_EQ( ref_max[t], max[t] ) << "targets " << targets
+                                        << " start " << start;
+      }
+    }
+  }
+
+  res.deallocate(d_min);
+  res.deallocate(d_max);
+}
+
+REGISTER_TYPED_TEST_SUITE_P( AtomicFloatMinMaxUnitTest,
+                             SignPairs,
+                             Contended );
+
+INSTANTIATE_TYPED_TEST_SUITE_P( AtomicFloatMinMaxUnitTests,
+                                AtomicFloatMinMaxUnitTest,
+                                float_minmax_types );
+
+#endif
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::ShardedCounter
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+using sharded_counter_types =
+    ::testing::Types<
+                      std::tuple<int, RAJA::auto_atomic>,
+                      std::tuple<unsigned long long int, RAJA::seq_atomic>,
+                      std::tuple<double, RAJA::auto_atomic>
+#if defined(RAJA_ENABLE_OPENMP)
+                      ,
+                      std::tuple<long, RAJA::omp_atomic>
+#endif
+                    >;
+
+template <typename T>
+class ShardedCounterUnitTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( ShardedCounterUnitTest );
+
+TYPED_TEST_P( ShardedCounterUnitTest, SequentialCounts )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  RAJA::ShardedCounter<T> counter((T)5, 3);
+  ASSERT_EQ( counter.num_shards(), 3 );
+  ASSERT_EQ( counter.get(), (T)5 );
+
+  RAJA::atomicAdd<AtomicPolicy>(counter, (T)4);
+  RAJA::atomicInc<AtomicPolicy>(counter);
+  RAJA::atomicSub<AtomicPolicy>(counter, (T)2);
+  RAJA::atomicDec<AtomicPolicy>(counter);
+  ASSERT_EQ( counter.get(), (T)7 );
+
+  counter.reset((T)1);
+  ASSERT_EQ( static_cast<T>(counter), (T)1 );
+}
+
+TYPED_TEST_P( ShardedCounterUnitTest, ForallCounts )
+{
+  using T = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  constexpr int N = 10000;
+
+  RAJA::ShardedCounter<T> counter((T)0);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    if (i % 2 == 0) {
+      RAJA::atomicInc<AtomicPolicy>(counter);
+    }
+  });
+  ASSERT_EQ( counter.get(), (T)(N / 2) );
+
+#if defined(RAJA_ENABLE_OPENMP)
+  counter.reset();
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                            [=](int i) {
+    RAJA::atomicAdd<AtomicPolicy>(counter, (T)(i % 3));
+  });
+  T expected = (T)0;
+  for (int i = 0; i < N; ++i) {
+    expected += (T)(i % 3);
+  }
+  ASSERT_EQ( counter.get(), expected );
+#endif
+}
+
+REGISTER_TYPED_TEST_SUITE_P( ShardedCounterUnitTest,
+                             SequentialCounts,
+                             ForallCounts );
+
+INSTANTIATE_TYPED_TEST_SUITE_P( ShardedCounterUnitTests,
+                                ShardedCounterUnitTest,
+                                sharded_counter_types );
@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for atomicCAS of 16 byte values
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+struct alignas(16) ValueLoc {
+  double value;
+  long long index;
+};
+
+static bool same(ValueLoc a, ValueLoc b)
+{
+  return a.value == b.value && a.index == b.index;
+}
+
+using wide_cas_policies =
+    ::testing::Types<
+                      RAJA::builtin_atomic
+#if defined(RAJA_ENABLE_OPENMP)
+                      ,
+                      RAJA::omp_atomic
+#endif
+                    >;
+
+template <typename T>
+class WideCASUnitTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( WideCASUnitTest );
+
+TYPED_TEST_P( WideCASUnitTest, CompareAndSwap )
+{
+  using AtomicPolicy = TypeParam;
+
+  ValueLoc loc{2.0, 7};
+
+  ValueLoc old = RAJA::atomicCAS<AtomicPolicy>(
+      &loc, ValueLoc{2.0, 7}, ValueLoc{1.0, 3});
+  ASSERT_TRUE( same(old, ValueLoc{2.0, 7}) );
+  ASSERT_TRUE( same(loc, ValueLoc{1.0, 3}) );
+
+  // same value with another index does not compare equal
+  old = RAJA::atomicCAS<AtomicPolicy>(
+      &loc, ValueLoc{1.0, 4}, ValueLoc{0.0, 0});
+  ASSERT_TRUE( same(old, ValueLoc{1.0, 3}) );
+  ASSERT_TRUE( same(loc, ValueLoc{1.0, 3}) );
+}
+
+TYPED_TEST_P( WideCASUnitTest, ForallMinLoc )
+{
+  using AtomicPolicy = TypeParam;
+
+  constexpr int N = 10000;
+
+  ValueLoc loc{1.0e30, -1};
+  ValueLoc* loc_ptr = &loc;
+
+  auto min_loc = [=](int i) {
+    const ValueLoc mine{(double)((i * 7919) % N), i};
+    ValueLoc old = *loc_ptr;
+    while (mine.value < old.value ||
+           (mine.value == old.value && mine.index < old.index)) {
+      ValueLoc readback = RAJA::atomicCAS<AtomicPolicy>(loc_ptr, old, mine);
+      if (same(readback, old)) break;
+      old = readback;
+    }
+  };
+
+#if defined(RAJA_ENABLE_OPENMP)
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(1, N), min_loc);
+#else
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(1, N), min_loc);
+#endif
+
+  ValueLoc expected{1.0e30, -1};
+  for (int i = 1; i < N; ++i) {
+    const double value = (double)((i * 7919) % N);
+    if (value < expected.value) {
+      expected = ValueLoc{value, i};
+    }
+  }
+  ASSERT_TRUE( same(loc, expected) );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( WideCASUnitTest,
+                             CompareAndSwap,
+                             ForallMinLoc );
+
+INSTANTIATE_TYPED_TEST_SUITE_P( WideCASUnitTests,
+                                WideCASUnitTest,
+                                wide_cas_policies );
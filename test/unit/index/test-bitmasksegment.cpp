@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BitMaskSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include <cstdint>
+#include <vector>
+
+template<typename T>
+class BitMaskSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(BitMaskSegmentUnitTest, UnitIndexTypes);
+
+
+TYPED_TEST(BitMaskSegmentUnitTest, Constructors)
+{
+  std::vector<std::uint32_t> mask{0x5u, 0x80000000u};
+
+  RAJA::TypedBitMaskSegment<TypeParam> seg1(&mask[0], 10, 64);
+  RAJA::TypedBitMaskSegment<TypeParam> copied(seg1);
+
+  ASSERT_EQ(seg1, copied);
+
+  RAJA::TypedBitMaskSegment<TypeParam> moved(std::move(seg1));
+
+  ASSERT_EQ(moved, copied);
+
+  RAJA::TypedBitMaskSegment<TypeParam> empty(&mask[0], 10, -3);
+
+  ASSERT_EQ(0, empty.size());
+  ASSERT_EQ(0, empty.getNumWords());
+  ASSERT_NE(empty, copied);
+}
+
+TYPED_TEST(BitMaskSegmentUnitTest, Iterators)
+{
+  std::vector<std::uint32_t> mask{0x5u, 0x0u, 0x80000001u, 0xffffffffu};
+
+  //
+  // Bits past the size of the mask (here bits 31 of word 2 and word 3)
+  // are ignored.
+  //
+  RAJA::TypedBitMaskSegment<TypeParam> seg(&mask[0], 10, 95);
+
+  ASSERT_EQ(95, seg.size());
+  ASSERT_EQ(3, seg.getNumWords());
+  ASSERT_EQ(3, seg.count());
+
+  std::vector<TypeParam> idx;
+  for (auto i : seg) {
+    idx.push_back(i);
+  }
+
+  std::vector<TypeParam> expected{TypeParam(10), TypeParam(12), TypeParam(74)};
+  ASSERT_EQ(idx, expected);
+
+  ASSERT_TRUE(seg.test(2));
+  ASSERT_FALSE(seg.test(3));
+}
+
+TYPED_TEST(BitMaskSegmentUnitTest, Swaps)
+{
+  std::vector<std::uint64_t> mask{0x3u, 0x10u};
+
+  RAJA::TypedBitMaskSegment<TypeParam, std::uint64_t> seg1(&mask[0], 0, 64);
+  RAJA::TypedBitMaskSegment<TypeParam, std::uint64_t> seg2(&mask[1], 7, 64);
+  auto seg3 = seg1;
+  auto seg4 = seg2;
+
+  seg1.swap(seg2);
+  ASSERT_EQ(seg3, seg2);
+  ASSERT_EQ(seg4, seg1);
+
+  std::swap(seg1, seg2);
+  ASSERT_EQ(seg3, seg1);
+  ASSERT_EQ(seg4, seg2);
+
+  ASSERT_EQ(*seg2.begin(), TypeParam(11));
+}
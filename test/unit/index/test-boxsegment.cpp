@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BoxSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include <array>
+#include <vector>
+
+template<typename T>
+class BoxSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(BoxSegmentUnitTest, UnitIndexTypes);
+
+
+TYPED_TEST(BoxSegmentUnitTest, Constructors)
+{
+  RAJA::Layout<2> layout(6, 10);
+
+  RAJA::TypedBoxSegment<2, TypeParam> box1(layout, {{1, 2}}, {{4, 7}});
+  RAJA::TypedBoxSegment<2, TypeParam> box2(12, {{3, 5}}, {{10, 1}});
+
+  ASSERT_EQ(box1, box2);
+
+  RAJA::TypedBoxSegment<2, TypeParam> copied(box1);
+
+  ASSERT_EQ(copied, box1);
+
+  RAJA::TypedBoxSegment<2, TypeParam> moved(std::move(box1));
+
+  ASSERT_EQ(moved, copied);
+
+  RAJA::TypedBoxSegment<2, TypeParam> empty1(0, {{0, 5}}, {{10, 1}});
+  RAJA::TypedBoxSegment<2, TypeParam> empty2(layout, {{2, 2}}, {{4, 2}});
+
+  ASSERT_EQ(0, empty1.size());
+  ASSERT_EQ(0, empty1.getNumRuns());
+  ASSERT_EQ(empty1, empty2);
+  ASSERT_NE(empty1, box2);
+}
+
+TYPED_TEST(BoxSegmentUnitTest, Swaps)
+{
+  RAJA::TypedBoxSegment<2, TypeParam> box1(0, {{2, 3}}, {{10, 1}});
+  RAJA::TypedBoxSegment<2, TypeParam> box2(5, {{4, 2}}, {{20, 2}});
+  auto box3 = RAJA::TypedBoxSegment<2, TypeParam>(box1);
+  auto box4 = RAJA::TypedBoxSegment<2, TypeParam>(box2);
+
+  box1.swap(box2);
+
+  ASSERT_EQ(box2, box3);
+  ASSERT_EQ(box1, box4);
+
+  std::swap(box1, box2);
+
+  ASSERT_EQ(box1, box3);
+  ASSERT_EQ(box2, box4);
+}
+
+TYPED_TEST(BoxSegmentUnitTest, Iterators)
+{
+  RAJA::TypedBoxSegment<3, TypeParam> box(1, {{2, 2, 3}}, {{40, 10, 1}});
+
+  std::vector<TypeParam> idx{1, 2, 3, 11, 12, 13, 41, 42, 43, 51, 52, 53};
+
+  ASSERT_EQ(12, box.size());
+  ASSERT_EQ(TypeParam(1), *box.begin());
+  ASSERT_EQ(TypeParam(53), *(box.end()-1));
+
+  for (size_t i = 0; i < idx.size(); ++i) {
+    ASSERT_EQ(idx[i], box.begin()[i]);
+  }
+}
+
+TYPED_TEST(BoxSegmentUnitTest, Runs)
+{
+  RAJA::TypedBoxSegment<2, TypeParam> box(3, {{3, 4}}, {{10, 1}});
+
+  ASSERT_EQ(3, box.getNumRuns());
+  ASSERT_TRUE(box.hasContiguousRuns());
+  ASSERT_EQ(RAJA::TypedRangeSegment<TypeParam>(3, 7), box.getContiguousRun(0));
+  ASSERT_EQ(RAJA::TypedRangeSegment<TypeParam>(23, 27), box.getContiguousRun(2));
+
+  RAJA::TypedBoxSegment<2, TypeParam> strided(3, {{2, 4}}, {{20, 2}});
+
+  ASSERT_FALSE(strided.hasContiguousRuns());
+  ASSERT_EQ(RAJA::TypedRangeStrideSegment<TypeParam>(23, 31, 2),
+            strided.getRun(1));
+}
+
+TEST(BoxSegmentUnitTest, PermutedLayout)
+{
+  RAJA::Layout<3> layout =
+      RAJA::make_permuted_layout({{4, 5, 6}},
+                                 RAJA::as_array<RAJA::PERM_KJI>::get());
+
+  RAJA::BoxSegment<3> box(layout, {{1, 1, 1}}, {{3, 4, 5}});
+
+  // the last dimension of the box is the one with stride 1
+  ASSERT_EQ(1, box.getStride(2));
+  ASSERT_EQ(2, box.getExtent(2));
+  ASSERT_EQ(layout(1, 1, 1), *box.begin());
+  ASSERT_EQ(layout(2, 1, 1), box.begin()[1]);
+  ASSERT_EQ(24, box.size());
+}
@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for DeltaListSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+template<typename T>
+class DeltaListSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(DeltaListSegmentUnitTest, UnitIndexTypes);
+
+//
+// Resource object used to construct delta list segment objects with data
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+
+TYPED_TEST(DeltaListSegmentUnitTest, Constructors)
+{
+  std::vector<TypeParam> idx;
+  for (TypeParam i = 0; i < 100; i += 3){
+    idx.push_back(i);
+  }
+
+  RAJA::TypedDeltaListSegment<TypeParam> list1( &idx[0], idx.size(), host_res);
+  RAJA::TypedDeltaListSegment<TypeParam> copied(list1);
+
+  ASSERT_EQ(list1, copied);
+
+  RAJA::TypedDeltaListSegment<TypeParam> moved(std::move(list1));
+
+  ASSERT_EQ(moved, copied);
+
+  RAJA::TypedDeltaListSegment<TypeParam> container(idx, host_res);
+
+  ASSERT_EQ(moved, container);
+  ASSERT_EQ(container.indicesEqual( &idx[0], idx.size() ), true);
+}
+
+TYPED_TEST(DeltaListSegmentUnitTest, Swaps)
+{
+  std::vector<TypeParam> idx1{0, 1, 2, 4};
+  std::vector<TypeParam> idx2{5, 7, 8};
+
+  RAJA::TypedDeltaListSegment<TypeParam> list1( idx1, host_res );
+  RAJA::TypedDeltaListSegment<TypeParam> list2( idx2, host_res );
+  auto list3 = RAJA::TypedDeltaListSegment<TypeParam>(list1);
+  auto list4 = RAJA::TypedDeltaListSegment<TypeParam>(list2);
+
+  list1.swap(list2);
+
+  ASSERT_EQ(list2, list3);
+  ASSERT_EQ(list1, list4);
+
+  std::swap(list1, list2);
+
+  ASSERT_EQ(list1, list3);
+  ASSERT_EQ(list2, list4);
+}
+
+TYPED_TEST(DeltaListSegmentUnitTest, Encoding)
+{
+  using segment = RAJA::TypedDeltaListSegment<RAJA::Index_type, unsigned char>;
+
+  std::vector<RAJA::Index_type> idx{100, 90, 300, 250};
+
+  ASSERT_EQ(segment::canEncode( &idx[0], idx.size() ), true);
+
+  idx[0] = 400;
+
+  ASSERT_EQ(segment::canEncode( &idx[0], idx.size() ), false);
+}
+
+TYPED_TEST(DeltaListSegmentUnitTest, Iterators)
+{
+  std::vector<TypeParam> idx{5, 3, 1, 2};
+  RAJA::TypedDeltaListSegment<TypeParam> list( idx, host_res );
+
+  ASSERT_EQ(TypeParam(5), *list.begin());
+  ASSERT_EQ(TypeParam(2), *(list.end()-1));
+  ASSERT_EQ(TypeParam(1), list.begin()[2]);
+
+  ASSERT_EQ(4, list.size());
+}
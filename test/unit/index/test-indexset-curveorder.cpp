@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for ordering points and list segment
+/// indices along space-filling curves
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "camp/resource.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+//
+// Resource object used to construct list segment objects with indices
+// living in host (CPU) memory.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+TEST(IndexSetCurveOrderUnitTest, Hilbert2D)
+{
+  constexpr int n = 16;
+
+  //
+  // Point p is at grid position ((p * 37) % (n*n)) so point numbering is
+  // unrelated to position.
+  //
+  std::vector<double> coords;
+  for (int p = 0; p < n * n; ++p) {
+    const int g = (p * 37) % (n * n);
+    coords.push_back(0.5 * (g / n) - 2.0);
+    coords.push_back(0.5 * (g % n) + 1.0);
+  }
+
+  std::vector<RAJA::Index_type> order;
+  RAJA::getSpaceFillingCurveOrder<2>(order, &coords[0], n * n);
+
+  ASSERT_EQ(order.size(), static_cast<size_t>(n * n));
+
+  //
+  // Consecutive cells of the Hilbert curve share a face.
+  //
+  for (int k = 1; k < n * n; ++k) {
+    const int a = (order[k - 1] * 37) % (n * n);
+    const int b = (order[k] * 37) % (n * n);
+    ASSERT_EQ(std::abs(a / n - b / n) + std::abs(a % n - b % n), 1);
+  }
+}
+
+TEST(IndexSetCurveOrderUnitTest, Hilbert3D)
+{
+  constexpr int n = 8;
+
+  std::vector<float> coords;
+  for (int p = 0; p < n * n * n; ++p) {
+    coords.push_back(static_cast<float>(p / (n * n)));
+    coords.push_back(static_cast<float>((p / n) % n));
+    coords.push_back(static_cast<float>(p % n));
+  }
+
+  std::vector<int> order;
+  RAJA::getSpaceFillingCurveOrder<3>(order, &coords[0], n * n * n);
+
+  ASSERT_EQ(order.size(), static_cast<size_t>(n * n * n));
+
+  std::vector<int> count(n * n * n, 0);
+  for (int k = 0; k < n * n * n; ++k) {
+    count[order[k]] += 1;
+    if (k > 0) {
+      const int a = order[k - 1];
+      const int b = order[k];
+      ASSERT_EQ(std::abs(a / (n * n) - b / (n * n)) +
+                    std::abs((a / n) % n - (b / n) % n) +
+                    std::abs(a % n - b % n),
+                1);
+    }
+  }
+  for (int p = 0; p < n * n * n; ++p) {
+    ASSERT_EQ(count[p], 1);
+  }
+}
+
+TEST(IndexSetCurveOrderUnitTest, Morton3D)
+{
+  //
+  // Morton order of a 2x2x2 grid numbered with the last coordinate
+  // fastest is the numbering itself.
+  //
+  std::vector<double> coords;
+  for (int p = 0; p < 8; ++p) {
+    coords.push_back(p / 4);
+    coords.push_back((p / 2) % 2);
+    coords.push_back(p % 2);
+  }
+
+  std::vector<int> order;
+  RAJA::getSpaceFillingCurveOrder<3>(
+      order, &coords[0], 8, RAJA::SpaceFillingCurve::Morton);
+
+  for (int p = 0; p < 8; ++p) {
+    ASSERT_EQ(order[p], p);
+  }
+}
+
+TEST(IndexSetCurveOrderUnitTest, ListSegment)
+{
+  constexpr int n = 8;
+
+  std::vector<double> coords;
+  for (int i = 0; i < n * n; ++i) {
+    coords.push_back(i / n);
+    coords.push_back(i % n);
+  }
+
+  std::vector<int> idx{63, 0, 9, 1, 8, 7, 56};
+  RAJA::TypedListSegment<int> seg(&idx[0], idx.size(), host_res);
+
+  std::vector<int> ordered;
+  std::vector<RAJA::Index_type> perm;
+  RAJA::getIndicesSpaceFillingCurveOrder<2>(ordered, perm, seg, &coords[0]);
+
+  std::vector<int> expected{0, 1, 9, 8, 7, 63, 56};
+  ASSERT_EQ(ordered, expected);
+
+  ASSERT_EQ(perm.size(), idx.size());
+  for (size_t k = 0; k < perm.size(); ++k) {
+    ASSERT_EQ(idx[perm[k]], ordered[k]);
+  }
+}
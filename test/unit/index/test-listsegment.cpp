@@ -100,3 +100,20 @@ TYPED_TEST(ListSegmentUnitTest, Iterators)
   ASSERT_EQ(4, list.size());
 }
 
+
+TYPED_TEST(ListSegmentUnitTest, Ownership)
+{
+  std::vector<TypeParam> idx{5,3,1,2};
+
+  RAJA::TypedListSegment<TypeParam> unowned( &idx[0], idx.size(), host_res,
+                                             RAJA::Unowned );
+  ASSERT_EQ(&idx[0], &(*unowned.begin()));
+  ASSERT_EQ(4, unowned.size());
+
+  RAJA::TypedListSegment<TypeParam> async( &idx[0], idx.size(), host_res,
+                                           RAJA::Owned, RAJA::CopyAsync );
+  host_res.wait();
+
+  ASSERT_NE(&idx[0], &(*async.begin()));
+  ASSERT_EQ(async.indicesEqual( &idx[0], idx.size() ), true);
+}
@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for TypedRaggedSegment
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+namespace
+{
+
+// rows {1, 2}, {}, {0}, {0, 1, 2, 3}, {3}
+const std::vector<int> offsets{0, 2, 2, 3, 7, 8};
+const std::vector<int> indices{1, 2, 0, 0, 1, 2, 3, 3};
+
+}  // namespace
+
+TEST(RaggedSegmentUnitTest, Rows)
+{
+  RAJA::TypedRaggedSegment<int> seg(offsets.data(), indices.data(), 5, 8);
+
+  ASSERT_EQ(seg.num_rows(), 5);
+  ASSERT_EQ(seg.size(), 8);
+  ASSERT_EQ(*seg.begin(), 1);
+  ASSERT_EQ(*(seg.end() - 1), 3);
+
+  ASSERT_EQ(seg.row_size(1), 0);
+  ASSERT_EQ(seg.row_size(3), 4);
+  ASSERT_EQ(*seg.row(3).begin(), 3);
+  ASSERT_EQ(*seg.row(3).end(), 7);
+
+  std::vector<int> nbrs;
+  for (int k : seg.row(3)) {
+    nbrs.push_back(seg[k]);
+  }
+  ASSERT_EQ(nbrs, (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST(RaggedSegmentUnitTest, PartitionRows)
+{
+  RAJA::TypedRaggedSegment<int> seg(offsets.data(), indices.data(), 5, 8);
+
+  // the parts cover the rows in order
+  for (RAJA::Index_type num_parts : {1, 2, 3, 4, 8, 16}) {
+    RAJA::Index_type next = 0;
+    for (RAJA::Index_type p = 0; p < num_parts; ++p) {
+      auto rows = seg.partition_rows(p, num_parts);
+      ASSERT_EQ(*rows.begin(), next);
+      next = *rows.end();
+    }
+    ASSERT_EQ(next, 5);
+  }
+
+  // row 3 begins before position 4, half of nnz, so part 1 begins at row 4
+  ASSERT_EQ(*seg.partition_rows(0, 2).end(), 4);
+  ASSERT_EQ(*seg.partition_rows(1, 2).begin(), 4);
+}
+
+TEST(RaggedSegmentUnitTest, Forall)
+{
+  RAJA::TypedRaggedSegment<int> seg(offsets.data(), indices.data(), 5, 8);
+
+  std::vector<int> visited;
+  RAJA::forall<RAJA::seq_exec>(seg, [&](int n) { visited.push_back(n); });
+  ASSERT_EQ(visited, indices);
+}
+
+TEST(RaggedSegmentUnitTest, KernelForRagged)
+{
+  RAJA::TypedRaggedSegment<int> seg(offsets.data(), indices.data(), 5, 8);
+
+  using pol = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::loop_exec,
+        RAJA::statement::ForRagged<1, 0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  std::vector<int> pairs;
+  RAJA::kernel<pol>(RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, 5), seg),
+                    [&](int e, int n) { pairs.push_back(10 * e + n); });
+
+  ASSERT_EQ(pairs, (std::vector<int>{1, 2, 20, 30, 31, 32, 33, 43}));
+}
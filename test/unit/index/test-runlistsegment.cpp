@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for RunListSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+template<typename T>
+class RunListSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(RunListSegmentUnitTest, UnitIndexTypes);
+
+//
+// Resource object used to construct run list segment objects with runs
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+
+TYPED_TEST(RunListSegmentUnitTest, Constructors)
+{
+  std::vector<TypeParam> idx{0, 1, 2, 5, 6, 9};
+
+  RAJA::TypedRunListSegment<TypeParam> list1( &idx[0], idx.size(), host_res);
+  RAJA::TypedRunListSegment<TypeParam> copied(list1);
+
+  ASSERT_EQ(list1, copied);
+
+  RAJA::TypedRunListSegment<TypeParam> moved(std::move(list1));
+
+  ASSERT_EQ(moved, copied);
+
+  RAJA::TypedRunListSegment<TypeParam> container(idx, host_res);
+
+  ASSERT_EQ(moved, container);
+
+  std::vector<TypeParam> starts{0, 5, 9};
+  std::vector<RAJA::Index_type> lengths{3, 2, 1};
+  RAJA::TypedRunListSegment<TypeParam> runs( &starts[0], &lengths[0],
+                                             starts.size(), host_res );
+
+  ASSERT_EQ(runs, container);
+}
+
+TYPED_TEST(RunListSegmentUnitTest, Swaps)
+{
+  std::vector<TypeParam> idx1{0, 1, 2, 4};
+  std::vector<TypeParam> idx2{5, 7, 8};
+
+  RAJA::TypedRunListSegment<TypeParam> list1( idx1, host_res );
+  RAJA::TypedRunListSegment<TypeParam> list2( idx2, host_res );
+  auto list3 = RAJA::TypedRunListSegment<TypeParam>(list1);
+  auto list4 = RAJA::TypedRunListSegment<TypeParam>(list2);
+
+  list1.swap(list2);
+
+  ASSERT_EQ(list2, list3);
+  ASSERT_EQ(list1, list4);
+
+  std::swap(list1, list2);
+
+  ASSERT_EQ(list1, list3);
+  ASSERT_EQ(list2, list4);
+}
+
+TYPED_TEST(RunListSegmentUnitTest, Runs)
+{
+  std::vector<TypeParam> idx{3, 4, 5, 6, 1, 2, 10};
+  RAJA::TypedRunListSegment<TypeParam> list( idx, host_res );
+
+  ASSERT_EQ(3, list.getNumRuns());
+  ASSERT_EQ(RAJA::TypedRangeSegment<TypeParam>(3, 7), list.getRun(0));
+  ASSERT_EQ(RAJA::TypedRangeSegment<TypeParam>(1, 3), list.getRun(1));
+  ASSERT_EQ(RAJA::TypedRangeSegment<TypeParam>(10, 11), list.getRun(2));
+
+  ASSERT_EQ(list.indicesEqual( &idx[0], idx.size() ), true);
+
+  idx[5] = 7;
+
+  ASSERT_EQ(list.indicesEqual( &idx[0], idx.size() ), false);
+}
+
+TYPED_TEST(RunListSegmentUnitTest, Iterators)
+{
+  std::vector<TypeParam> idx{5, 6, 7, 1, 2};
+  RAJA::TypedRunListSegment<TypeParam> list( idx, host_res );
+
+  ASSERT_EQ(TypeParam(5), *list.begin());
+  ASSERT_EQ(TypeParam(2), *(list.end()-1));
+  ASSERT_EQ(TypeParam(1), list.begin()[3]);
+
+  ASSERT_EQ(5, list.size());
+
+  std::vector<TypeParam> empty;
+  RAJA::TypedRunListSegment<TypeParam> none( empty, host_res );
+
+  ASSERT_EQ(0, none.size());
+  ASSERT_EQ(0, none.getNumRuns());
+  ASSERT_EQ(none.begin(), none.end());
+}
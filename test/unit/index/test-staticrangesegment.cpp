@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for TypedStaticRangeSegment
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+TEST(StaticRangeSegmentUnitTest, Iterable)
+{
+  constexpr RAJA::TypedStaticRangeSegment<int, 2, 7> seg{};
+
+  static_assert(seg.size() == 5, "size is known at compile time");
+  ASSERT_EQ(*seg.begin(), 2);
+  ASSERT_EQ(*(seg.end() - 1), 6);
+
+  std::vector<int> visited;
+  RAJA::static_for_each(seg, [&](int i) { visited.push_back(i); });
+  ASSERT_EQ(visited, (std::vector<int>{2, 3, 4, 5, 6}));
+
+  int count = 0;
+  for (auto i : RAJA::static_range<0, 0>{}) {
+    count += static_cast<int>(i) + 1;
+  }
+  ASSERT_EQ(count, 0);
+}
+
+TEST(StaticRangeSegmentUnitTest, Forall)
+{
+  std::vector<RAJA::Index_type> visited;
+  RAJA::forall<RAJA::seq_exec>(RAJA::static_range<0, 8>{},
+                               [&](RAJA::Index_type i) {
+                                 visited.push_back(i);
+                               });
+  ASSERT_EQ(visited.size(), 8u);
+  for (RAJA::Index_type i = 0; i < 8; ++i) {
+    ASSERT_EQ(visited[i], i);
+  }
+
+  // other policies run it as a plain range
+  RAJA::ReduceSum<RAJA::seq_reduce, int> sum(0);
+  RAJA::forall<RAJA::simd_exec>(RAJA::TypedStaticRangeSegment<int, 1, 4>{},
+                                [=](int i) { sum += i; });
+  ASSERT_EQ(sum.get(), 6);
+}
+
+TEST(StaticRangeSegmentUnitTest, Kernel)
+{
+  using pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  std::vector<int> visited;
+  RAJA::kernel<pol>(
+      RAJA::make_tuple(RAJA::TypedStaticRangeSegment<int, 0, 3>{},
+                       RAJA::TypedRangeSegment<int>(0, 2)),
+      [&](int d, int e) { visited.push_back(10 * e + d); });
+
+  ASSERT_EQ(visited, (std::vector<int>{0, 1, 2, 10, 11, 12}));
+}
+
+TEST(StaticRangeSegmentUnitTest, Launch)
+{
+  using launch_pol = RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>;
+  using loop_pol = RAJA::expt::LoopPolicy<RAJA::seq_exec>;
+
+  std::vector<int> visited;
+  std::vector<int> icounts;
+  RAJA::expt::launch<launch_pol>(
+      RAJA::expt::HOST,
+      RAJA::expt::Grid(RAJA::expt::Teams(1), RAJA::expt::Threads(1)),
+      [&](RAJA::expt::LaunchContext ctx) {
+        RAJA::expt::loop<loop_pol>(ctx,
+                                   RAJA::TypedStaticRangeSegment<int, 4, 8>{},
+                                   [&](int i) { visited.push_back(i); });
+        RAJA::expt::loop_icount<loop_pol>(
+            ctx,
+            RAJA::TypedStaticRangeSegment<int, 4, 8>{},
+            [&](int, int icount) { icounts.push_back(icount); });
+      });
+
+  ASSERT_EQ(visited, (std::vector<int>{4, 5, 6, 7}));
+  ASSERT_EQ(icounts, (std::vector<int>{0, 1, 2, 3}));
+}
@@ -0,0 +1,54 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the arguments of cuda RAJA::kernel
+/// launches.
+///
+
+#include "tests/test-loop-data-args.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+TEST(CudaLoopDataArgsTest, Types)
+{
+  LoopDataArgsTypesTestImpl<camp::resources::Cuda>();
+}
+
+TEST(CudaLoopDataArgsTest, KernelParams)
+{
+  KernelParamsTestImpl<RAJA::statement::CudaKernel,
+                       RAJA::cuda_block_x_loop,
+                       RAJA::cuda_thread_x_loop,
+                       RAJA::cuda_reduce,
+                       camp::resources::Cuda>();
+}
+
+TEST(CudaLoopDataArgsTest, KernelParamsFixedAsync)
+{
+  KernelParamsTestImpl<RAJA::statement::CudaKernelAsync,
+                       RAJA::cuda_block_x_direct,
+                       RAJA::cuda_thread_x_loop,
+                       RAJA::cuda_reduce_atomic,
+                       camp::resources::Cuda>();
+}
+
+TEST(CudaLoopDataArgsTest, KernelManySegments)
+{
+  KernelManySegmentsTestImpl<RAJA::statement::CudaKernel,
+                             RAJA::cuda_block_x_loop,
+                             RAJA::cuda_thread_x_loop,
+                             camp::resources::Cuda>();
+}
+
+TEST(CudaLoopDataArgsTest, KernelOccManySegments)
+{
+  KernelManySegmentsTestImpl<RAJA::statement::CudaKernelOcc,
+                             RAJA::cuda_block_x_loop,
+                             RAJA::cuda_thread_x_loop,
+                             camp::resources::Cuda>();
+}
+#endif
@@ -0,0 +1,54 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the arguments of hip RAJA::kernel
+/// launches.
+///
+
+#include "tests/test-loop-data-args.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+TEST(HipLoopDataArgsTest, Types)
+{
+  LoopDataArgsTypesTestImpl<camp::resources::Hip>();
+}
+
+TEST(HipLoopDataArgsTest, KernelParams)
+{
+  KernelParamsTestImpl<RAJA::statement::HipKernel,
+                       RAJA::hip_block_x_loop,
+                       RAJA::hip_thread_x_loop,
+                       RAJA::hip_reduce,
+                       camp::resources::Hip>();
+}
+
+TEST(HipLoopDataArgsTest, KernelParamsFixedAsync)
+{
+  KernelParamsTestImpl<RAJA::statement::HipKernelAsync,
+                       RAJA::hip_block_x_direct,
+                       RAJA::hip_thread_x_loop,
+                       RAJA::hip_reduce_atomic,
+                       camp::resources::Hip>();
+}
+
+TEST(HipLoopDataArgsTest, KernelManySegments)
+{
+  KernelManySegmentsTestImpl<RAJA::statement::HipKernel,
+                             RAJA::hip_block_x_loop,
+                             RAJA::hip_thread_x_loop,
+                             camp::resources::Hip>();
+}
+
+TEST(HipLoopDataArgsTest, KernelOccManySegments)
+{
+  KernelManySegmentsTestImpl<RAJA::statement::HipKernelOcc,
+                             RAJA::hip_block_x_loop,
+                             RAJA::hip_thread_x_loop,
+                             camp::resources::Hip>();
+}
+#endif
@@ -63,3 +63,48 @@ TEST(RAJAVecUnitTest, basic_test)
   ASSERT_EQ(c.data() + c.size(), c.end());
   ASSERT_EQ(c.data(), c.begin());
 }
+
+TEST(RAJAVecUnitTest, inline_storage_test)
+{
+  using vec_type = RAJA::RAJAVec<int, std::allocator<int>, 4>;
+
+  vec_type a;
+  ASSERT_EQ(4lu, a.capacity());
+  for (int i = 0; i < 4; ++i)
+    a.push_back(i);
+  ASSERT_EQ(4lu, a.capacity());
+
+  // moving an inline vector moves its items
+  vec_type b(std::move(a));
+  ASSERT_EQ(0lu, a.size());
+  ASSERT_EQ(4lu, b.size());
+  ASSERT_EQ(3, b[3]);
+
+  // growing past the inline storage allocates and keeps the items
+  for (int i = 4; i < 100; ++i)
+    b.push_back(i);
+  ASSERT_LT(4lu, b.capacity());
+  for (int i = 0; i < 100; ++i)
+    ASSERT_EQ(i, b[i]);
+
+  // swap an allocated and an inline vector
+  a.push_back(-1);
+  a.swap(b);
+  ASSERT_EQ(100lu, a.size());
+  ASSERT_EQ(1lu, b.size());
+  ASSERT_EQ(-1, b[0]);
+  ASSERT_EQ(99, a[99]);
+
+  // shrinking returns to the inline storage
+  a.resize(2);
+  a.shrink_to_fit();
+  ASSERT_EQ(4lu, a.capacity());
+  ASSERT_EQ(1, a[1]);
+
+  vec_type c;
+  c = a;
+  ASSERT_EQ(2lu, c.size());
+  c = std::move(b);
+  ASSERT_EQ(1lu, c.size());
+  ASSERT_EQ(-1, c[0]);
+}
@@ -0,0 +1,226 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for the LoopDataArgs that RAJA::kernel
+/// passes to GPU kernels in place of the whole LoopData.
+///
+
+#ifndef __TEST_LOOP_DATA_ARGS__
+#define __TEST_LOOP_DATA_ARGS__
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <type_traits>
+#include <vector>
+
+//
+// The arguments hold the segments, params and bodies of a LoopData, and
+// the data made from them in the kernel has the same segments, params and
+// bodies, with a DeviceLoopResource in place of the launch resource.
+//
+template <typename Res>
+void LoopDataArgsTypesTestImpl()
+{
+  using segments_t = RAJA::tuple<RAJA::TypedRangeSegment<int>,
+                                 RAJA::TypedRangeStrideSegment<int>>;
+  using params_t = RAJA::tuple<double, int>;
+
+  auto body = [](int i, int j) { return 10 * i + j; };
+  using body_t = decltype(body);
+
+  using data_t = RAJA::internal::LoopData<segments_t, params_t, Res, body_t>;
+  using args_t = RAJA::internal::LoopDataArgs<data_t>;
+  using device_data_t = typename args_t::data_t;
+
+  static_assert(std::is_same<device_data_t,
+                             RAJA::internal::LoopData<
+                                 segments_t, params_t,
+                                 RAJA::internal::DeviceLoopResource,
+                                 body_t>>::value,
+                "the kernel data has the segments, params and bodies of the "
+                "host data and a device resource");
+
+  // the offsets, vector sizes and launch resource stay on the host
+  ASSERT_LT(sizeof(args_t), sizeof(data_t));
+
+  Res res = Res::get_default();
+  data_t data(segments_t(RAJA::TypedRangeSegment<int>(3, 17),
+                         RAJA::TypedRangeStrideSegment<int>(40, 2, -3)),
+              params_t(2.5, 7),
+              res,
+              body);
+
+  args_t args(data);
+  device_data_t device_data(args);
+
+  ASSERT_EQ(3, *camp::get<0>(device_data.segment_tuple).begin());
+  ASSERT_EQ(14, camp::get<0>(device_data.segment_tuple).size());
+  ASSERT_EQ(40, *camp::get<1>(device_data.segment_tuple).begin());
+  ASSERT_EQ(camp::get<1>(data.segment_tuple).size(),
+            camp::get<1>(device_data.segment_tuple).size());
+  ASSERT_EQ(2.5, camp::get<0>(device_data.param_tuple));
+  ASSERT_EQ(7, camp::get<1>(device_data.param_tuple));
+  ASSERT_EQ(42, camp::get<0>(device_data.bodies)(4, 2));
+}
+
+//
+// A matrix product with range and strided column segments, a dot product
+// param initialized, accumulated and stored by three lambdas, an inner
+// loop count in a second param, and reducers of the stored values.  The
+// results are checked against a sequential loop.
+//
+template <template <typename...> class DeviceKernel,
+          typename BlockPolicy,
+          typename ThreadPolicy,
+          typename ReducePolicy,
+          typename Res>
+void KernelParamsTestImpl()
+{
+  using Pol = RAJA::KernelPolicy<
+      DeviceKernel<
+        RAJA::statement::For<0, BlockPolicy,
+          RAJA::statement::For<1, ThreadPolicy,
+            RAJA::statement::Lambda<0, RAJA::Params<0>>,
+            RAJA::statement::ForICount<2, RAJA::statement::Param<1>, RAJA::seq_exec,
+              RAJA::statement::Lambda<1, RAJA::Segs<0, 1, 2>, RAJA::Params<0, 1>>
+            >,
+            RAJA::statement::Lambda<2, RAJA::Segs<0, 1>, RAJA::Params<0>>
+          >
+        >
+      >
+    >;
+
+  constexpr int R = 37;
+  constexpr int C = 300;
+  constexpr int K = 11;
+
+  Res res = Res::get_default();
+
+  std::vector<double> A(R * K), B(K * C);
+  for (int i = 0; i < R * K; ++i) A[i] = (i % 7) - 3;
+  for (int i = 0; i < K * C; ++i) B[i] = (i % 5) - 2;
+
+  double* d_A = res.template allocate<double>(R * K);
+  double* d_B = res.template allocate<double>(K * C);
+  double* d_out = res.template allocate<double>(R * C);
+  int* d_bad_count = res.template allocate<int>(1);
+  res.memcpy(d_A, A.data(), sizeof(double) * R * K);
+  res.memcpy(d_B, B.data(), sizeof(double) * K * C);
+  res.memset(d_bad_count, 0, sizeof(int));
+
+  RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+  RAJA::ReduceMax<ReducePolicy, double> max(-1.0e30);
+
+  // every second column, from the last
+  RAJA::kernel_param_resource<Pol>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, R),
+                       RAJA::TypedRangeStrideSegment<int>(2 * C - 1, -1, -2),
+                       RAJA::TypedRangeSegment<int>(0, K)),
+      RAJA::make_tuple(0.0, 0),
+      res,
+      [=] RAJA_HOST_DEVICE (double& dot) { dot = 0.0; },
+      [=] RAJA_HOST_DEVICE (int r, int c2, int k, double& dot, int& kc) {
+        if (kc != k) {
+          RAJA::atomicAdd<RAJA::auto_atomic>(d_bad_count, 1);
+        }
+        dot += d_A[r * K + k] * d_B[k * C + c2 / 2];
+      },
+      [=] RAJA_HOST_DEVICE (int r, int c2, double& dot) {
+        d_out[r * C + c2 / 2] = dot;
+        sum += dot;
+        max.max(dot);
+      });
+
+  std::vector<double> out(R * C);
+  int bad_count = -1;
+  res.memcpy(out.data(), d_out, sizeof(double) * R * C);
+  res.memcpy(&bad_count, d_bad_count, sizeof(int));
+  res.wait();
+
+  ASSERT_EQ(0, bad_count);
+
+  double ref_sum = 0.0;
+  double ref_max = -1.0e30;
+  for (int r = 0; r < R; ++r) {
+    for (int c = 0; c < C; ++c) {
+      double dot = 0.0;
+      for (int k = 0; k < K; ++k) {
+        dot += A[r * K + k] * B[k * C + c];
+      }
+      ASSERT_EQ(dot, out[r * C + c]) << "r " << r << " c " << c;
+      ref_sum += dot;
+      ref_max = dot > ref_max ? dot : ref_max;
+    }
+  }
+  ASSERT_EQ(ref_sum, sum.get());
+  ASSERT_EQ(ref_max, max.get());
+
+  res.deallocate(d_A);
+  res.deallocate(d_B);
+  res.deallocate(d_out);
+  res.deallocate(d_bad_count);
+}
+
+//
+// A nest of five segments, every combination of indices is visited once.
+//
+template <template <typename...> class DeviceKernel,
+          typename BlockPolicy,
+          typename ThreadPolicy,
+          typename Res>
+void KernelManySegmentsTestImpl()
+{
+  using Pol = RAJA::KernelPolicy<
+      DeviceKernel<
+        RAJA::statement::For<0, BlockPolicy,
+          RAJA::statement::For<1, ThreadPolicy,
+            RAJA::statement::For<2, RAJA::seq_exec,
+              RAJA::statement::For<3, RAJA::seq_exec,
+                RAJA::statement::For<4, RAJA::seq_exec,
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >
+      >
+    >;
+
+  constexpr int N0 = 3, N1 = 65, N2 = 5, N3 = 6, N4 = 7;
+  constexpr int N = N0 * N1 * N2 * N3 * N4;
+
+  Res res = Res::get_default();
+
+  int* d_count = res.template allocate<int>(N);
+  res.memset(d_count, 0, sizeof(int) * N);
+
+  RAJA::kernel_resource<Pol>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N0),
+                       RAJA::TypedRangeSegment<int>(0, N1),
+                       RAJA::TypedRangeStrideSegment<int>(0, 2 * N2, 2),
+                       RAJA::TypedRangeSegment<int>(10, 10 + N3),
+                       RAJA::TypedRangeStrideSegment<int>(N4 - 1, -1, -1)),
+      res,
+      [=] RAJA_HOST_DEVICE (int i0, int i1, int i2, int i3, int i4) {
+        const int idx = (((i0 * N1 + i1) * N2 + i2 / 2) * N3 + (i3 - 10)) * N4 + i4;
+        RAJA::atomicAdd<RAJA::auto_atomic>(d_count + idx, 1);
+      });
+
+  std::vector<int> count(N);
+  res.memcpy(count.data(), d_count, sizeof(int) * N);
+  res.wait();
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(1, count[i]) << "index " << i;
+  }
+
+  res.deallocate(d_count);
+}
+
+#endif  //__TEST_LOOP_DATA_ARGS__
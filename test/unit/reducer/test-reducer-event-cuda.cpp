@@ -0,0 +1,28 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for cuda reducer events.
+///
+
+#include "tests/test-reducer-event.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+TEST(CudaReducerEventTest, ReadyBeforeAndAfterWait)
+{
+  ReducerEventReadyTestImpl<RAJA::cuda_exec_async<256>,
+                            RAJA::cuda_reduce,
+                            camp::resources::Cuda>(1000);
+}
+
+TEST(CudaReducerEventTest, GetIgnoresLaterWork)
+{
+  ReducerEventLaterWorkTestImpl<RAJA::cuda_exec_async<256>,
+                                RAJA::cuda_reduce,
+                                camp::resources::Cuda>(1000);
+}
+#endif
@@ -0,0 +1,28 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for hip reducer events.
+///
+
+#include "tests/test-reducer-event.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+TEST(HipReducerEventTest, ReadyBeforeAndAfterWait)
+{
+  ReducerEventReadyTestImpl<RAJA::hip_exec_async<256>,
+                            RAJA::hip_reduce,
+                            camp::resources::Hip>(1000);
+}
+
+TEST(HipReducerEventTest, GetIgnoresLaterWork)
+{
+  ReducerEventLaterWorkTestImpl<RAJA::hip_exec_async<256>,
+                                RAJA::hip_reduce,
+                                camp::resources::Hip>(1000);
+}
+#endif
@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the locations of openmp MinLoc and
+/// MaxLoc reductions with ties and values equal to the identity.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+//
+// MinLoc and MaxLoc over values with a static schedule give the value and
+// location of a sequential loop, where ties keep the first location and
+// values equal to the identity do not replace the initial location.
+//
+template <typename T>
+void ReducerLocTestImpl(std::vector<T> const& vals, T min_init, T max_init)
+{
+  const int N = static_cast<int>(vals.size());
+  T const* data = vals.data();
+
+  RAJA::ReduceMinLoc<RAJA::seq_reduce, T> seq_minloc(min_init, -1);
+  RAJA::ReduceMaxLoc<RAJA::seq_reduce, T> seq_maxloc(max_init, -1);
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                               [=](int i) {
+                                 seq_minloc.minloc(data[i], i);
+                                 seq_maxloc.maxloc(data[i], i);
+                               });
+
+  RAJA::ReduceMinLoc<RAJA::omp_reduce, T> minloc(min_init, -1);
+  RAJA::ReduceMaxLoc<RAJA::omp_reduce, T> maxloc(max_init, -1);
+  RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+      RAJA::TypedRangeSegment<int>(0, N),
+      [=](int i) {
+        minloc.minloc(data[i], i);
+        maxloc.maxloc(data[i], i);
+      });
+
+  ASSERT_EQ(seq_minloc.get(), minloc.get()) << "N " << N;
+  ASSERT_EQ(seq_minloc.getLoc(), minloc.getLoc()) << "N " << N;
+  ASSERT_EQ(seq_maxloc.get(), maxloc.get()) << "N " << N;
+  ASSERT_EQ(seq_maxloc.getLoc(), maxloc.getLoc()) << "N " << N;
+}
+
+TEST(OpenMPReducerLocTest, Ties)
+{
+  // the minimum and maximum repeat in the part of every thread
+  const int N = 4000;
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = (i % 97 == 40) ? -7 : (i % 13);
+  }
+  ReducerLocTestImpl<int>(vals, 1 << 30, -(1 << 30));
+
+  RAJA::ReduceMinLoc<RAJA::omp_reduce, int> minloc(1 << 30, -1);
+  RAJA::ReduceMaxLoc<RAJA::omp_reduce, int> maxloc(-(1 << 30), -1);
+  int const* data = vals.data();
+  RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+      RAJA::TypedRangeSegment<int>(0, N),
+      [=](int i) {
+        minloc.minloc(data[i], i);
+        maxloc.maxloc(data[i], i);
+      });
+  ASSERT_EQ(-7, minloc.get());
+  ASSERT_EQ(40, minloc.getLoc());
+  ASSERT_EQ(12, maxloc.get());
+  ASSERT_EQ(12, maxloc.getLoc());
+}
+
+TEST(OpenMPReducerLocTest, IdentityValues)
+{
+  const int N = 4000;
+  const double dmax = std::numeric_limits<double>::max();
+  const double dlow = std::numeric_limits<double>::lowest();
+
+  // every value equals the identity of the reduction
+  ReducerLocTestImpl<double>(std::vector<double>(N, dmax), dmax, dmax);
+  ReducerLocTestImpl<double>(std::vector<double>(N, dlow), dlow, dlow);
+
+  // values equal to the identity in every part, with ties of real values
+  // in some of them
+  std::vector<double> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = (i % 2 == 0) ? dmax : dlow;
+    if (i % 1000 == 501) {
+      vals[i] = 3.0;
+    }
+  }
+  ReducerLocTestImpl<double>(vals, dmax, dlow);
+  ReducerLocTestImpl<double>(vals, 5.0, 1.0);
+}
+
+#endif
@@ -0,0 +1,30 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for cuda reductions in launches of one block.
+///
+
+#include "tests/test-reducer-single-block.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+TEST(CudaReducerSingleBlockTest, Reduce)
+{
+  ReducerSingleBlockTestImpl<RAJA::cuda_exec<256>,
+                             RAJA::cuda_reduce,
+                             RAJA::cuda::device_mempool_type,
+                             RAJA::cuda::device_zeroed_mempool_type>(256);
+}
+
+TEST(CudaReducerSingleBlockTest, ReduceAtomic)
+{
+  ReducerSingleBlockTestImpl<RAJA::cuda_exec<256>,
+                             RAJA::cuda_reduce_atomic,
+                             RAJA::cuda::device_mempool_type,
+                             RAJA::cuda::device_zeroed_mempool_type>(256);
+}
+#endif
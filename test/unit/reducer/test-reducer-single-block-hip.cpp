@@ -0,0 +1,30 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for hip reductions in launches of one block.
+///
+
+#include "tests/test-reducer-single-block.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+TEST(HipReducerSingleBlockTest, Reduce)
+{
+  ReducerSingleBlockTestImpl<RAJA::hip_exec<256>,
+                             RAJA::hip_reduce,
+                             RAJA::hip::device_mempool_type,
+                             RAJA::hip::device_zeroed_mempool_type>(256);
+}
+
+TEST(HipReducerSingleBlockTest, ReduceAtomic)
+{
+  ReducerSingleBlockTestImpl<RAJA::hip_exec<256>,
+                             RAJA::hip_reduce_atomic,
+                             RAJA::hip::device_mempool_type,
+                             RAJA::hip::device_zeroed_mempool_type>(256);
+}
+#endif
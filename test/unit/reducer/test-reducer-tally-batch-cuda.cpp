@@ -0,0 +1,26 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for batched cuda reducer result slots.
+///
+
+#include "tests/test-reducer-tally-batch.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+TEST(CudaTallyBatchTest, MixedSizeSlots)
+{
+  TallyBatchSlotsTestImpl<RAJA::cuda::detail::PinnedTallyBatch>();
+}
+
+TEST(CudaTallyBatchTest, MixedSizeReducers)
+{
+  TallyBatchReducersTestImpl<RAJA::cuda::ReduceTallyBatch,
+                             RAJA::cuda_exec<256>,
+                             RAJA::cuda_reduce>();
+}
+#endif
@@ -0,0 +1,26 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for batched hip reducer result slots.
+///
+
+#include "tests/test-reducer-tally-batch.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+TEST(HipTallyBatchTest, MixedSizeSlots)
+{
+  TallyBatchSlotsTestImpl<RAJA::hip::detail::PinnedTallyBatch>();
+}
+
+TEST(HipTallyBatchTest, MixedSizeReducers)
+{
+  TallyBatchReducersTestImpl<RAJA::hip::ReduceTallyBatch,
+                             RAJA::hip_exec<256>,
+                             RAJA::hip_reduce>();
+}
+#endif
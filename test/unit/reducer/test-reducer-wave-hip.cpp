@@ -0,0 +1,155 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for hip reductions across the waves of a
+/// block, with the default and other block sizes.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <type_traits>
+
+#if defined(RAJA_ENABLE_HIP)
+
+// distinct values for every index below 10007
+RAJA_HOST_DEVICE inline int waveValue(int i)
+{
+  return static_cast<int>((7919LL * i) % 10007) - 5000;
+}
+
+//
+// Sum, Min, Max, MinLoc and MaxLoc of int and double over lengths that
+// fill part of a wave, a whole wave, part of the last wave of a block and
+// many blocks give the results of a sequential loop.
+//
+template <typename ExecPolicy>
+void ReducerWaveTestImpl(int block_size)
+{
+  const int lens[] = {1, 15, 16, 17, 63, 64, 65, block_size - 1, block_size,
+                      block_size + 1, 3 * block_size + 40, 10000};
+
+  for (int N : lens) {
+    long long ref_sum = 0;
+    int ref_min = waveValue(0);
+    int ref_max = waveValue(0);
+    int ref_minloc = 0;
+    int ref_maxloc = 0;
+    for (int i = 0; i < N; ++i) {
+      const int v = waveValue(i);
+      ref_sum += v;
+      if (v < ref_min) {
+        ref_min = v;
+        ref_minloc = i;
+      }
+      if (v > ref_max) {
+        ref_max = v;
+        ref_maxloc = i;
+      }
+    }
+
+    RAJA::ReduceSum<RAJA::hip_reduce, long long> sum(0);
+    RAJA::ReduceSum<RAJA::hip_reduce, double> dsum(0.0);
+    RAJA::ReduceMin<RAJA::hip_reduce, int> min(1 << 30);
+    RAJA::ReduceMax<RAJA::hip_reduce, double> max(-1.0e9);
+    RAJA::ReduceMinLoc<RAJA::hip_reduce, int> minloc(1 << 30, -1);
+    RAJA::ReduceMaxLoc<RAJA::hip_reduce, double> maxloc(-1.0e9, -1);
+
+    RAJA::forall<ExecPolicy>(RAJA::TypedRangeSegment<int>(0, N),
+                             [=] RAJA_HOST_DEVICE(int i) {
+                               const int v = waveValue(i);
+                               sum += v;
+                               dsum += 0.5 * v;
+                               min.min(v);
+                               max.max(v);
+                               minloc.minloc(v, i);
+                               maxloc.maxloc(v, i);
+                             });
+
+    ASSERT_EQ(ref_sum, sum.get()) << "N " << N;
+    ASSERT_EQ(0.5 * ref_sum, dsum.get()) << "N " << N;
+    ASSERT_EQ(ref_min, min.get()) << "N " << N;
+    ASSERT_EQ(double(ref_max), max.get()) << "N " << N;
+    ASSERT_EQ(ref_min, minloc.get()) << "N " << N;
+    ASSERT_EQ(ref_minloc, minloc.getLoc()) << "N " << N;
+    ASSERT_EQ(double(ref_max), maxloc.get()) << "N " << N;
+    ASSERT_EQ(ref_maxloc, maxloc.getLoc()) << "N " << N;
+  }
+}
+
+TEST(HipReducerWaveTest, DefaultBlockSize)
+{
+  static_assert(std::is_same<RAJA::hip_exec<>,
+                             RAJA::hip_exec<RAJA::policy::hip::DEFAULT_BLOCK_SIZE>>::value,
+                "hip_exec<> uses the default block size");
+  ReducerWaveTestImpl<RAJA::hip_exec<>>(RAJA::policy::hip::DEFAULT_BLOCK_SIZE);
+  ReducerWaveTestImpl<RAJA::hip_exec_async<>>(RAJA::policy::hip::DEFAULT_BLOCK_SIZE);
+}
+
+TEST(HipReducerWaveTest, OneWaveBlocks)
+{
+  ReducerWaveTestImpl<RAJA::hip_exec<64>>(64);
+}
+
+TEST(HipReducerWaveTest, PartialWaveBlocks)
+{
+  // blocks that are not whole waves take the shuffle path
+  ReducerWaveTestImpl<RAJA::hip_exec<96>>(96);
+}
+
+TEST(HipReducerWaveTest, FullRowOfWaves)
+{
+  // the 16 waves of the largest block fill a row in the second stage
+  ReducerWaveTestImpl<RAJA::hip_exec<1024>>(1024);
+}
+
+//
+// A kernel launch with the thread count chosen at runtime uses blocks of
+// the default size, its reductions over rows of partial waves give the
+// results of a sequential loop.
+//
+TEST(HipReducerWaveTest, KernelRuntimeThreads)
+{
+  using KernelPolicy = RAJA::KernelPolicy<
+      RAJA::statement::HipKernelExp<4, 0,
+          RAJA::statement::For<0, RAJA::hip_block_x_loop,
+              RAJA::statement::For<1, RAJA::hip_thread_x_loop,
+                  RAJA::statement::Lambda<0>>>>>;
+
+  const int rows = 9;
+  const int cols[] = {1, 63, 65, 300};
+
+  for (int C : cols) {
+    long long ref_sum = 0;
+    int ref_max = waveValue(0);
+    for (int r = 0; r < rows; ++r) {
+      for (int c = 0; c < C; ++c) {
+        const int v = waveValue(r * C + c);
+        ref_sum += v;
+        ref_max = v > ref_max ? v : ref_max;
+      }
+    }
+
+    RAJA::ReduceSum<RAJA::hip_reduce, long long> sum(0);
+    RAJA::ReduceMax<RAJA::hip_reduce, int> max(-(1 << 30));
+
+    RAJA::kernel<KernelPolicy>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, rows),
+                         RAJA::TypedRangeSegment<int>(0, C)),
+        [=] RAJA_HOST_DEVICE(int r, int c) {
+          const int v = waveValue(r * C + c);
+          sum += v;
+          max.max(v);
+        });
+
+    ASSERT_EQ(ref_sum, sum.get()) << "cols " << C;
+    ASSERT_EQ(ref_max, max.get()) << "cols " << C;
+  }
+}
+
+#endif
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for the events and ready queries of GPU
+/// reducers.
+///
+
+#ifndef __TEST_REDUCER_EVENT__
+#define __TEST_REDUCER_EVENT__
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+//
+// The kernels below are held by a flag in pinned memory so the reducers can
+// be queried while the work they wait for is known to be incomplete.
+//
+template <typename Res>
+int* allocateEventFlag(Res& res)
+{
+  int* flag =
+      res.template allocate<int>(1, camp::resources::MemoryAccess::Pinned);
+  *static_cast<volatile int*>(flag) = 0;
+  return flag;
+}
+
+inline void releaseEventFlag(int* flag)
+{
+  *static_cast<volatile int*>(flag) = 1;
+}
+
+//
+// ready() is false until the work using the reducer completes, before and
+// after get_event(), and true once the event was waited on.
+//
+template <typename ExecPolicy, typename ReducePolicy, typename Res>
+void ReducerEventReadyTestImpl(int N)
+{
+  Res res = Res::get_default();
+  int* flag = allocateEventFlag(res);
+
+  RAJA::ReduceSum<ReducePolicy, int> sum(0);
+  ASSERT_TRUE(sum.ready());
+
+  RAJA::forall<ExecPolicy>(res,
+                           RAJA::TypedRangeSegment<int>(0, N),
+                           [=] RAJA_HOST_DEVICE(int i) {
+                             if (i == 0) {
+                               while (*static_cast<volatile int*>(flag) == 0) {
+                               }
+                             }
+                             sum += i;
+                           });
+
+  ASSERT_FALSE(sum.ready());
+
+  RAJA::resources::Event e = sum.get_event();
+  ASSERT_FALSE(e.check());
+  ASSERT_FALSE(sum.ready());
+
+  releaseEventFlag(flag);
+  e.wait();
+
+  ASSERT_TRUE(e.check());
+  ASSERT_TRUE(sum.ready());
+  ASSERT_EQ(N * (N - 1) / 2, sum.get());
+  ASSERT_TRUE(sum.ready());
+
+  res.wait();
+  res.deallocate(flag, camp::resources::MemoryAccess::Pinned);
+}
+
+//
+// After get_event() the value is read without waiting for work launched
+// later on the same resource, here a kernel that cannot finish before the
+// value is read.
+//
+template <typename ExecPolicy, typename ReducePolicy, typename Res>
+void ReducerEventLaterWorkTestImpl(int N)
+{
+  Res res = Res::get_default();
+  int* flag = allocateEventFlag(res);
+
+  RAJA::ReduceSum<ReducePolicy, int> sum(0);
+
+  RAJA::forall<ExecPolicy>(res,
+                           RAJA::TypedRangeSegment<int>(0, N),
+                           [=] RAJA_HOST_DEVICE(int i) { sum += 2 * i; });
+
+  RAJA::resources::Event e = sum.get_event();
+
+  RAJA::forall<ExecPolicy>(res,
+                           RAJA::TypedRangeSegment<int>(0, 1),
+                           [=] RAJA_HOST_DEVICE(int) {
+                             while (*static_cast<volatile int*>(flag) == 0) {
+                             }
+                           });
+
+  e.wait();
+  ASSERT_TRUE(sum.ready());
+  ASSERT_EQ(N * (N - 1), sum.get());
+
+  // the later kernel is still held
+  ASSERT_FALSE(res.get_event().check());
+
+  releaseEventFlag(flag);
+  res.wait();
+  res.deallocate(flag, camp::resources::MemoryAccess::Pinned);
+}
+
+#endif  //__TEST_REDUCER_EVENT__
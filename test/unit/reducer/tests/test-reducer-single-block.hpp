@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for GPU reductions in launches of one block.
+///
+
+#ifndef __TEST_REDUCER_SINGLE_BLOCK__
+#define __TEST_REDUCER_SINGLE_BLOCK__
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstddef>
+
+// distinct values for every index below 10007
+RAJA_HOST_DEVICE inline int singleBlockValue(int i)
+{
+  return static_cast<int>((7919LL * i) % 10007) - 5000;
+}
+
+//
+// Reductions give the same result whether the launch has one block, which
+// reduces in the block and allocates no device memory, or more blocks.
+// Lengths of one block, one block and one value, and many blocks are
+// reduced, and one reducer is used by launches of both kinds.
+//
+template <typename ExecPolicy,
+          typename ReducePolicy,
+          typename DevicePool,
+          typename ZeroedPool>
+void ReducerSingleBlockTestImpl(int block_size)
+{
+  const int lens[] = {1, 31, block_size - 1, block_size, block_size + 1,
+                      10000};
+
+  DevicePool& device_pool = DevicePool::getInstance();
+  ZeroedPool& zeroed_pool = ZeroedPool::getInstance();
+
+  for (int N : lens) {
+    long long ref_sum = 0;
+    int ref_min = singleBlockValue(0);
+    int ref_max = singleBlockValue(0);
+    int ref_minloc = 0;
+    int ref_maxloc = 0;
+    for (int i = 0; i < N; ++i) {
+      const int v = singleBlockValue(i);
+      ref_sum += v;
+      if (v < ref_min) {
+        ref_min = v;
+        ref_minloc = i;
+      }
+      if (v > ref_max) {
+        ref_max = v;
+        ref_maxloc = i;
+      }
+    }
+
+    const size_t device_in_use = device_pool.get_stats().bytes_in_use;
+    const size_t zeroed_in_use = zeroed_pool.get_stats().bytes_in_use;
+    device_pool.reset_peak_bytes_in_use();
+    zeroed_pool.reset_peak_bytes_in_use();
+
+    RAJA::ReduceSum<ReducePolicy, long long> sum(0);
+    RAJA::ReduceMin<ReducePolicy, int> min(1 << 30);
+    RAJA::ReduceMax<ReducePolicy, int> max(-(1 << 30));
+    RAJA::ReduceMinLoc<ReducePolicy, int> minloc(1 << 30, -1);
+    RAJA::ReduceMaxLoc<ReducePolicy, double> maxloc(-1.0e9, -1);
+
+    RAJA::forall<ExecPolicy>(RAJA::TypedRangeSegment<int>(0, N),
+                             [=] RAJA_HOST_DEVICE(int i) {
+                               const int v = singleBlockValue(i);
+                               sum += v;
+                               min.min(v);
+                               max.max(v);
+                               minloc.minloc(v, i);
+                               maxloc.maxloc(static_cast<double>(v), i);
+                             });
+
+    ASSERT_EQ(ref_sum, sum.get()) << "N " << N;
+    ASSERT_EQ(ref_min, min.get()) << "N " << N;
+    ASSERT_EQ(ref_max, max.get()) << "N " << N;
+    ASSERT_EQ(ref_min, minloc.get()) << "N " << N;
+    ASSERT_EQ(ref_minloc, minloc.getLoc()) << "N " << N;
+    ASSERT_EQ(static_cast<double>(ref_max), maxloc.get()) << "N " << N;
+    ASSERT_EQ(ref_maxloc, maxloc.getLoc()) << "N " << N;
+
+    if (N <= block_size) {
+      ASSERT_EQ(device_in_use, device_pool.get_stats().peak_bytes_in_use)
+          << "N " << N;
+      ASSERT_EQ(zeroed_in_use, zeroed_pool.get_stats().peak_bytes_in_use)
+          << "N " << N;
+    }
+  }
+
+  // one reducer used by a launch of one block and a launch of many
+  RAJA::ReduceSum<ReducePolicy, long long> sum(0);
+  RAJA::ReduceMinLoc<ReducePolicy, int> minloc(1 << 30, -1);
+  for (int N : {block_size, 10000, 1}) {
+    RAJA::forall<ExecPolicy>(RAJA::TypedRangeSegment<int>(0, N),
+                             [=] RAJA_HOST_DEVICE(int i) {
+                               sum += 1;
+                               minloc.minloc(singleBlockValue(i), i);
+                             });
+  }
+  long long ref_sum = block_size + 10000 + 1;
+  int ref_min = singleBlockValue(0);
+  int ref_minloc = 0;
+  for (int i = 0; i < 10000; ++i) {
+    if (singleBlockValue(i) < ref_min) {
+      ref_min = singleBlockValue(i);
+      ref_minloc = i;
+    }
+  }
+  ASSERT_EQ(ref_sum, sum.get());
+  ASSERT_EQ(ref_min, minloc.get());
+  ASSERT_EQ(ref_minloc, minloc.getLoc());
+}
+
+#endif  //__TEST_REDUCER_SINGLE_BLOCK__
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for the batched pinned result slots of
+/// GPU reducers.
+///
+
+#ifndef __TEST_REDUCER_TALLY_BATCH__
+#define __TEST_REDUCER_TALLY_BATCH__
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+//
+// Slots of mixed sizes are aligned, do not overlap, and released slots are
+// reused by later allocations of the same size class only.
+//
+template <typename Batch>
+void TallyBatchSlotsTestImpl()
+{
+  const size_t align = Batch::slot_alignment;
+  const size_t sizes[] = {1, 8, 12, 24, 40, 100, 3 * align + 1};
+
+  Batch batch;
+
+  std::vector<char*> ptrs;
+  std::vector<size_t> lens;
+  for (int rep = 0; rep < 64; ++rep) {
+    for (size_t n : sizes) {
+      char* p = static_cast<char*>(batch.allocate(n));
+      ASSERT_NE(p, nullptr);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(p) % align, 0u);
+      ptrs.push_back(p);
+      lens.push_back(n);
+    }
+  }
+
+  // live slots do not overlap
+  for (size_t i = 0; i < ptrs.size(); ++i) {
+    for (size_t j = i + 1; j < ptrs.size(); ++j) {
+      ASSERT_TRUE(ptrs[i] + lens[i] <= ptrs[j] || ptrs[j] + lens[j] <= ptrs[i]);
+    }
+  }
+
+  // a slot larger than a chunk gets a chunk of its own
+  char* big = static_cast<char*>(batch.allocate(2 * Batch::chunk_bytes + 8));
+  ASSERT_NE(big, nullptr);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(big) % align, 0u);
+
+  // released slots are handed out again for the same size
+  std::set<char*> released;
+  for (size_t i = 0; i < ptrs.size(); i += 2) {
+    batch.deallocate(ptrs[i], lens[i]);
+    released.insert(ptrs[i]);
+  }
+  for (size_t i = 0; i < ptrs.size(); i += 2) {
+    char* p = static_cast<char*>(batch.allocate(lens[i]));
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(p) % align, 0u);
+    ASSERT_EQ(released.count(p), 1u);
+    released.erase(p);
+  }
+  ASSERT_TRUE(released.empty());
+
+  // a size that was never released gets a fresh slot
+  batch.deallocate(ptrs[1], lens[1]);
+  char* fresh = static_cast<char*>(batch.allocate(5 * align));
+  ASSERT_NE(fresh, ptrs[1]);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(fresh) % align, 0u);
+}
+
+//
+// Reducers of mixed value sizes made in a batch give the right results, and
+// reducers made after others are destroyed reuse their slots.
+//
+template <typename TallyBatch, typename ExecPolicy, typename ReducePolicy>
+void TallyBatchReducersTestImpl()
+{
+  constexpr int N = 1000;
+
+  for (int rep = 0; rep < 3; ++rep) {
+    TallyBatch scope;
+
+    RAJA::ReduceSum<ReducePolicy, int> sum(0);
+    RAJA::ReduceMin<ReducePolicy, double> min(1.0e9);
+    RAJA::ReduceMaxLoc<ReducePolicy, double> maxloc(-1.0e9, -1);
+    RAJA::ReduceSum<ReducePolicy, long long> lsum(0);
+
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N),
+      [=] RAJA_HOST_DEVICE (int i) {
+        sum += 1;
+        min.min(static_cast<double>(i) - 10.0);
+        maxloc.maxloc(static_cast<double>(i % 97), i);
+        lsum += static_cast<long long>(i);
+    });
+
+    scope.synchronize();
+
+    ASSERT_EQ(sum.get(), N);
+    ASSERT_EQ(min.get(), -10.0);
+    ASSERT_EQ(maxloc.get(), 96.0);
+    ASSERT_EQ(maxloc.getLoc(), 96);
+    ASSERT_EQ(lsum.get(), static_cast<long long>(N) * (N - 1) / 2);
+  }
+}
+
+#endif  //__TEST_REDUCER_TALLY_BATCH__
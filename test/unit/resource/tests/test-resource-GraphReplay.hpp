@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//
+// This test No-Ops in all cases except for when using cuda or hip execution
+// policies.
+
+#ifndef __TEST_RESOURCE_GRAPH_REPLAY_HPP__
+#define __TEST_RESOURCE_GRAPH_REPLAY_HPP__
+
+#include "RAJA_test-base.hpp"
+
+template <typename WORKING_RES, typename EXEC_POL>
+void ResourceGraphReplayTestRun()
+{
+  constexpr int ARRAY_SIZE{1000};
+  constexpr int NUM_REPLAYS{3};
+  using namespace RAJA;
+
+  WORKING_RES dev;
+  resources::Host host;
+
+  int* d_a = dev.template allocate<int>(ARRAY_SIZE);
+  int* d_b = dev.template allocate<int>(ARRAY_SIZE);
+  int* h_a = host.allocate<int>(ARRAY_SIZE);
+  int* h_b = host.allocate<int>(ARRAY_SIZE);
+
+  forall<EXEC_POL>(dev, RangeSegment(0, ARRAY_SIZE),
+    [=] RAJA_HOST_DEVICE (int i) {
+      d_a[i] = i;
+      d_b[i] = 0;
+    }
+  );
+  dev.wait();
+
+  expt::GraphRecorder<WORKING_RES> rec(dev);
+
+  forall<EXEC_POL>(dev, RangeSegment(0, ARRAY_SIZE),
+    [=] RAJA_HOST_DEVICE (int i) {
+      d_a[i] += 1;
+    }
+  );
+  forall<EXEC_POL>(dev, RangeSegment(0, ARRAY_SIZE),
+    [=] RAJA_HOST_DEVICE (int i) {
+      d_b[i] = 2 * d_a[i];
+    }
+  );
+
+  auto graph = rec.instantiate();
+
+  for (int r = 0; r < NUM_REPLAYS; ++r) {
+    graph.launch();
+  }
+  dev.wait();
+
+  dev.memcpy(h_a, d_a, sizeof(int) * ARRAY_SIZE);
+  dev.memcpy(h_b, d_b, sizeof(int) * ARRAY_SIZE);
+  dev.wait();
+
+  for (int i = 0; i < ARRAY_SIZE; ++i) {
+    ASSERT_EQ(h_a[i], i + NUM_REPLAYS);
+    ASSERT_EQ(h_b[i], 2 * (i + NUM_REPLAYS));
+  }
+
+  dev.deallocate(d_a);
+  dev.deallocate(d_b);
+  host.deallocate(h_a);
+  host.deallocate(h_b);
+}
+
+template <typename WORKING_RES, typename EXEC_POL>
+void ResourceGraphReplayTestImpl(EXEC_POL&&) {}
+
+#if defined(RAJA_ENABLE_CUDA)
+template <typename WORKING_RES, size_t BLOCK_SIZE, bool Async>
+void ResourceGraphReplayTestImpl(RAJA::cuda_exec<BLOCK_SIZE, Async>&&)
+{
+  ResourceGraphReplayTestRun<WORKING_RES, RAJA::cuda_exec<BLOCK_SIZE, true>>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+template <typename WORKING_RES, size_t BLOCK_SIZE, bool Async>
+void ResourceGraphReplayTestImpl(RAJA::hip_exec<BLOCK_SIZE, Async>&&)
+{
+  ResourceGraphReplayTestRun<WORKING_RES, RAJA::hip_exec<BLOCK_SIZE, true>>();
+}
+#endif
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ResourceGraphReplayTestCall()
+{
+  ResourceGraphReplayTestImpl<WORKING_RES>(EXEC_POLICY());
+}
+
+TYPED_TEST_SUITE_P(ResourceGraphReplayTest);
+template <typename T>
+class ResourceGraphReplayTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ResourceGraphReplayTest, ResourceGraphReplay)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ResourceGraphReplayTestCall<WORKING_RES, EXEC_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ResourceGraphReplayTest,
+                            ResourceGraphReplay);
+
+#endif  // __TEST_RESOURCE_GRAPH_REPLAY_HPP__
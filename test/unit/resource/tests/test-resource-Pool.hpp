@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_RESOURCE_POOL_HPP__
+#define __TEST_RESOURCE_POOL_HPP__
+
+#include "RAJA_test-base.hpp"
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ResourcePoolTestImpl()
+{
+  constexpr std::size_t ARRAY_SIZE{10000};
+  constexpr int NUM_CHUNKS{8};
+  constexpr int CHUNK_SIZE{ARRAY_SIZE / NUM_CHUNKS};
+  using namespace RAJA;
+
+  resources::ResourcePool<WORKING_RES> pool(3);
+  ASSERT_EQ(pool.size(), 3u);
+
+  WORKING_RES dev;
+  resources::Host host;
+
+  int* d_array = resources::Resource{dev}.allocate<int>(ARRAY_SIZE);
+  int* h_array = host.allocate<int>(ARRAY_SIZE);
+
+  // each chunk is written and then doubled on the resource of its key
+  for (int c = 0; c < NUM_CHUNKS; ++c) {
+    forall<EXEC_POLICY>(pool.get(c),
+      RangeSegment(c*CHUNK_SIZE, (c+1)*CHUNK_SIZE),
+      [=] RAJA_HOST_DEVICE (int i) {
+        d_array[i] = i;
+      }
+    );
+  }
+
+  for (int c = 0; c < NUM_CHUNKS; ++c) {
+    forall<EXEC_POLICY>(pool.get(c),
+      RangeSegment(c*CHUNK_SIZE, (c+1)*CHUNK_SIZE),
+      [=] RAJA_HOST_DEVICE (int i) {
+        d_array[i] *= 2;
+      }
+    );
+  }
+
+  pool.join(dev);
+
+  // round-robin resources for independent work
+  forall<EXEC_POLICY>(pool.get(), RangeSegment(0, 1),
+    [=] RAJA_HOST_DEVICE (int) { }
+  );
+  forall<EXEC_POLICY>(pool.get(), RangeSegment(0, 1),
+    [=] RAJA_HOST_DEVICE (int) { }
+  );
+
+  dev.memcpy(h_array, d_array, sizeof(int) * ARRAY_SIZE);
+
+  dev.wait();
+  pool.wait();
+
+  forall<policy::sequential::seq_exec>(host, RangeSegment(0,ARRAY_SIZE),
+    [=] (int i) {
+      ASSERT_EQ(h_array[i], 2*i);
+    }
+  );
+
+  dev.deallocate(d_array);
+  host.deallocate(h_array);
+}
+
+TYPED_TEST_SUITE_P(ResourcePoolTest);
+template <typename T>
+class ResourcePoolTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ResourcePoolTest, ResourcePool)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ResourcePoolTestImpl<WORKING_RES, EXEC_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ResourcePoolTest,
+                            ResourcePool);
+
+#endif  // __TEST_RESOURCE_POOL_HPP__
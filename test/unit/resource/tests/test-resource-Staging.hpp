@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_RESOURCE_STAGING_HPP__
+#define __TEST_RESOURCE_STAGING_HPP__
+
+#include "RAJA_test-base.hpp"
+
+// a functor, since device lambdas may not be defined in a lambda
+template <typename WORKING_RES, typename EXEC_POLICY>
+struct StagingTestBody
+{
+  int* d_array;
+
+  void operator()(WORKING_RES res, int* chunk,
+                  std::size_t begin, std::size_t len) const
+  {
+    int* out = d_array + begin;
+    RAJA::forall<EXEC_POLICY>(res, RAJA::RangeSegment(0, len),
+      [=] RAJA_HOST_DEVICE (int i) {
+        out[i] = 2 * chunk[i];
+      }
+    );
+  }
+};
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ResourceStagingTestImpl()
+{
+  // not a multiple of the chunk size, so the last chunk is partial
+  constexpr std::size_t ARRAY_SIZE{10007};
+  constexpr std::size_t CHUNK_SIZE{1000};
+  using namespace RAJA;
+
+  WORKING_RES copy_res;
+  WORKING_RES compute_res;
+  resources::Host host;
+
+  int* h_src   = host.allocate<int>(ARRAY_SIZE);
+  int* h_array = host.allocate<int>(ARRAY_SIZE);
+  int* d_array = resources::Resource{compute_res}.allocate<int>(ARRAY_SIZE);
+
+  for (std::size_t i = 0; i < ARRAY_SIZE; ++i) {
+    h_src[i] = static_cast<int>(i);
+  }
+
+  {
+    StagingPipeline<WORKING_RES, int> pipeline(copy_res, compute_res,
+                                               CHUNK_SIZE);
+    ASSERT_EQ(pipeline.chunk_size(), CHUNK_SIZE);
+
+    resources::Event e = pipeline.run(h_src, ARRAY_SIZE,
+        StagingTestBody<WORKING_RES, EXEC_POLICY>{d_array});
+
+    // the source is staged, so it may be overwritten before the work ends
+    for (std::size_t i = 0; i < ARRAY_SIZE; ++i) {
+      h_src[i] = -1;
+    }
+
+    e.wait();
+  }
+
+  copy_async(compute_res, h_array, d_array, sizeof(int) * ARRAY_SIZE);
+
+  compute_res.wait();
+
+  forall<policy::sequential::seq_exec>(host, RangeSegment(0,ARRAY_SIZE),
+    [=] (int i) {
+      ASSERT_EQ(h_array[i], 2*i);
+    }
+  );
+
+  compute_res.deallocate(d_array);
+  host.deallocate(h_array);
+  host.deallocate(h_src);
+}
+
+TYPED_TEST_SUITE_P(ResourceStagingTest);
+template <typename T>
+class ResourceStagingTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ResourceStagingTest, ResourceStaging)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ResourceStagingTestImpl<WORKING_RES, EXEC_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ResourceStagingTest,
+                            ResourceStaging);
+
+#endif  // __TEST_RESOURCE_STAGING_HPP__
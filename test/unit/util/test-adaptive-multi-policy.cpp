@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for AdaptiveSelector
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+TEST(AdaptiveSelectorUnitTest, PicksFastestPerBucket)
+{
+  const int warmup = 2;
+  const long reprobe_interval = 10;
+  RAJA::expt::AdaptiveSelector sel(3, warmup, 0.5, reprobe_interval);
+
+  // policy 1 is fastest for small sizes, policy 2 for large ones
+  auto time_of = [](size_t policy, size_t n) {
+    if (n < 1024) {
+      return policy == 1 ? 1.0 : 2.0;
+    }
+    return policy == 2 ? 1.0 : 2.0;
+  };
+
+  for (size_t n : {size_t(100), size_t(100000)}) {
+    for (int w = 0; w < 3 * warmup; ++w) {
+      auto s = sel.select(n);
+      ASSERT_TRUE(s.timed);
+      sel.record(s, time_of(s.index, n));
+    }
+  }
+
+  ASSERT_EQ(sel.best(100), 1u);
+  ASSERT_EQ(sel.best(100000), 2u);
+  ASSERT_EQ(sel.average(2, 100000), 1.0);
+
+  // the copy shares the timings, and probes another policy now and then
+  RAJA::expt::AdaptiveSelector copy = sel;
+  int probes = 0;
+  for (long c = 0; c < 5 * reprobe_interval; ++c) {
+    auto s = copy.select(100);
+    if (s.timed) {
+      ASSERT_NE(s.index, 1u);
+      ++probes;
+      copy.record(s, time_of(s.index, 100));
+    } else {
+      ASSERT_EQ(s.index, 1u);
+    }
+  }
+  ASSERT_EQ(probes, 5);
+  ASSERT_EQ(sel.best(100), 1u);
+}
+
+TEST(AdaptiveSelectorUnitTest, Forall)
+{
+  auto mp = RAJA::make_adaptive_multi_policy<RAJA::seq_exec,
+#if defined(RAJA_ENABLE_OPENMP)
+                                             RAJA::omp_parallel_for_exec,
+#endif
+                                             RAJA::simd_exec>(2, 0.25, 7);
+
+  const int N = 4096;
+  std::vector<int> a(N, 0);
+  int* a_ptr = a.data();
+
+  const int num_runs = 50;
+  for (int run = 0; run < num_runs; ++run) {
+    RAJA::forall(mp, RAJA::TypedRangeSegment<int>(0, N),
+                 [=](int i) { a_ptr[i] += 1; });
+  }
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], num_runs);
+  }
+}
@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for compensated_sum
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/CompensatedSum.hpp"
+#include "RAJA/util/ReproducibleSum.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+template <typename T>
+class CompensatedSumUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(CompensatedSumUnitTest);
+
+TYPED_TEST_P(CompensatedSumUnitTest, SmallTerms)
+{
+  using sum_type = RAJA::reduce::compensated_sum<TypeParam>;
+  using limits = std::numeric_limits<TypeParam>;
+
+  // each small term is lost when added to the large one in plain arithmetic
+  const TypeParam big = std::ldexp(TypeParam(1), limits::digits);
+  const int n = 1000;
+
+  sum_type sum(big);
+  TypeParam naive = big;
+  for (int i = 0; i < n; ++i) {
+    sum += TypeParam(1) / TypeParam(2);
+    naive += TypeParam(1) / TypeParam(2);
+  }
+  ASSERT_EQ(naive, big);
+  ASSERT_EQ(sum.value(), big + TypeParam(n / 2));
+
+  // a large term cancelling the running sum keeps the small ones
+  sum_type cancel;
+  cancel += TypeParam(1);
+  cancel += big;
+  cancel += -big;
+  ASSERT_EQ(cancel.value(), TypeParam(1));
+}
+
+TYPED_TEST_P(CompensatedSumUnitTest, Combine)
+{
+  using sum_type = RAJA::reduce::compensated_sum<TypeParam>;
+  using exact_type = RAJA::reduce::reproducible_sum<TypeParam>;
+
+  std::mt19937 gen(2022);
+  std::uniform_real_distribution<TypeParam> mantissa(-1, 1);
+  std::uniform_int_distribution<int> exponent(-20, 20);
+
+  std::vector<TypeParam> values(100003);
+  exact_type exact;
+  for (TypeParam& v : values) {
+    v = std::ldexp(mantissa(gen), exponent(gen));
+    exact += v;
+  }
+  const TypeParam expected = exact.value();
+
+  TypeParam naive = 0;
+  for (TypeParam v : values) {
+    naive += v;
+  }
+
+  for (int parts : {1, 3, 64}) {
+    std::vector<sum_type> partial(parts);
+    for (size_t i = 0; i < values.size(); ++i) {
+      partial[i % parts] += values[i];
+    }
+
+    sum_type total;
+    for (int p = 0; p < parts; ++p) {
+      total = total + partial[p];
+    }
+
+    const TypeParam err = std::abs(total.value() - expected);
+    ASSERT_LE(err, std::abs(naive - expected));
+    ASSERT_LE(err,
+              4 * std::numeric_limits<TypeParam>::epsilon() *
+                  std::abs(expected));
+  }
+}
+
+TYPED_TEST_P(CompensatedSumUnitTest, Identity)
+{
+  using sum_type = RAJA::reduce::compensated_sum<TypeParam>;
+
+  sum_type zero{0};
+  ASSERT_EQ(zero.value(), TypeParam(0));
+  ASSERT_TRUE(zero == sum_type());
+
+  sum_type val(TypeParam(3));
+  ASSERT_TRUE(val + zero == val);
+  ASSERT_TRUE(val != zero);
+  ASSERT_EQ(static_cast<TypeParam>(val), TypeParam(3));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompensatedSumUnitTest,
+                            SmallTerms,
+                            Combine,
+                            Identity);
+
+using CompensatedSumTypes = ::testing::Types<float, double>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(CompensatedSumUnitTests,
+                               CompensatedSumUnitTest,
+                               CompensatedSumTypes);
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for ConcurrentHashMap
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+using hash_map_policies =
+    ::testing::Types<
+                      std::tuple<RAJA::seq_exec, RAJA::seq_atomic>
+#if defined(RAJA_ENABLE_OPENMP)
+                      ,
+                      std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_atomic>
+#endif
+                    >;
+
+template <typename T>
+class ConcurrentHashMapUnitTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( ConcurrentHashMapUnitTest );
+
+TYPED_TEST_P( ConcurrentHashMapUnitTest, InsertFind )
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+  using map_type = RAJA::ConcurrentHashMap<long, int, ExecPolicy, AtomicPolicy>;
+
+  constexpr int N = 10000;
+  constexpr long num_keys = 1000;
+
+  map_type map(3000);
+  ASSERT_EQ( map.capacity(), (size_t)4096 );
+  ASSERT_EQ( map.size(), (size_t)0 );
+
+  auto view = map.view();
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+    view.insert((i * 7919L) % num_keys, (int)((i * 7919L) % num_keys) + 1);
+  });
+  ASSERT_EQ( map.size(), (size_t)num_keys );
+
+  for (long k = 0; k < num_keys; ++k) {
+    const size_t slot = view.find(k);
+    ASSERT_NE( slot, map_type::npos );
+    ASSERT_EQ( view.key_at(slot), k );
+    ASSERT_EQ( view.value_at(slot), (int)k + 1 );
+  }
+  ASSERT_FALSE( view.contains(num_keys) );
+
+  // a key already in the map keeps its value
+  ASSERT_EQ( view.insert(5, -1), view.find(5) );
+  ASSERT_EQ( view.value_at(view.find(5)), 6 );
+
+  map.clear();
+  ASSERT_EQ( map.size(), (size_t)0 );
+  ASSERT_FALSE( map.view().contains(5) );
+}
+
+TYPED_TEST_P( ConcurrentHashMapUnitTest, InsertOrAdd )
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+  using map_type =
+      RAJA::ConcurrentHashMap<unsigned, long, ExecPolicy, AtomicPolicy>;
+
+  constexpr int N = 10000;
+
+  map_type map(64);
+  auto view = map.view();
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+    view.insert_or_add((unsigned)(i % 10), (long)i);
+  });
+  ASSERT_EQ( map.size(), (size_t)10 );
+
+  for (unsigned k = 0; k < 10; ++k) {
+    long expected = 0;
+    for (int i = (int)k; i < N; i += 10) {
+      expected += i;
+    }
+    ASSERT_EQ( view.value_at(view.find(k)), expected );
+  }
+}
+
+TYPED_TEST_P( ConcurrentHashMapUnitTest, FullAndRehash )
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using AtomicPolicy = typename std::tuple_element<1, TypeParam>::type;
+  using map_type = RAJA::ConcurrentHashMap<int, int, ExecPolicy, AtomicPolicy>;
+
+  map_type map(4, -1);
+  auto view = map.view();
+  for (int k = 0; k < 4; ++k) {
+    ASSERT_NE( view.insert(k, 10 * k), map_type::npos );
+  }
+  ASSERT_EQ( view.insert(4, 40), map_type::npos );
+
+  ASSERT_TRUE( map.reserve(1000) );
+  ASSERT_GE( (double)map.capacity() * map_type::max_load_factor, 1004.0 );
+  ASSERT_FALSE( map.reserve(10) );
+  ASSERT_EQ( map.size(), (size_t)4 );
+
+  view = map.view();
+  for (int k = 0; k < 4; ++k) {
+    ASSERT_EQ( view.value_at(view.find(k)), 10 * k );
+  }
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(4, 1004), [=](int k) {
+    view.insert(k, 10 * k);
+  });
+  ASSERT_EQ( map.size(), (size_t)1004 );
+  ASSERT_EQ( view.value_at(view.find(1003)), 10030 );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( ConcurrentHashMapUnitTest,
+                             InsertFind,
+                             InsertOrAdd,
+                             FullAndRehash );
+
+INSTANTIATE_TYPED_TEST_SUITE_P( ConcurrentHashMapUnitTests,
+                                ConcurrentHashMapUnitTest,
+                                hash_map_policies );
@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the coroutine awaitables
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#if defined(RAJA_HAS_COROUTINES)
+
+#include <memory>
+
+// coroutine that runs on creation and is never awaited itself
+struct test_task {
+  struct promise_type {
+    test_task get_return_object() { return {}; }
+    std::suspend_never initial_suspend() { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+// event that completes when its flag is set
+struct flag_event {
+  std::shared_ptr<bool> flag;
+
+  bool check() const { return *flag; }
+  void wait() const {}
+};
+
+test_task wait_on(RAJA::resources::Event e,
+                  RAJA::expt::EventPoller& poller,
+                  int& stage)
+{
+  stage = 1;
+  co_await RAJA::expt::when_done(e, poller);
+  stage = 2;
+}
+
+test_task sum_on_host(RAJA::expt::EventPoller& poller, int N, long& result)
+{
+  RAJA::resources::Host res = RAJA::resources::Host::get_default();
+  RAJA::ReduceSum<RAJA::seq_reduce, long> sum(0);
+
+  co_await RAJA::expt::when_done(
+      RAJA::forall<RAJA::seq_exec>(res,
+                                   RAJA::TypedRangeSegment<int>(0, N),
+                                   [=](int i) { sum += i; }),
+      poller);
+
+  result = co_await RAJA::expt::when_ready(sum, poller);
+}
+
+TEST(CoroutineUnitTest, SuspendsUntilEventIsDone)
+{
+  RAJA::expt::EventPoller poller;
+  auto flag = std::make_shared<bool>(false);
+  int stage = 0;
+
+  wait_on(RAJA::resources::Event{flag_event{flag}}, poller, stage);
+
+  ASSERT_EQ(stage, 1);
+  ASSERT_EQ(poller.pending(), 1u);
+  ASSERT_EQ(poller.poll(), 0u);
+  ASSERT_EQ(stage, 1);
+
+  *flag = true;
+
+  ASSERT_EQ(poller.poll(), 1u);
+  ASSERT_EQ(stage, 2);
+  ASSERT_EQ(poller.pending(), 0u);
+}
+
+TEST(CoroutineUnitTest, HostPatternAndReducer)
+{
+  RAJA::expt::EventPoller poller;
+  const int N = 1000;
+  long result = -1;
+
+  sum_on_host(poller, N, result);
+  poller.drain();
+
+  ASSERT_EQ(poller.pending(), 0u);
+  ASSERT_EQ(result, long(N) * (N - 1) / 2);
+}
+
+#endif
@@ -0,0 +1,165 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for DeferredGraph
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+using RAJA::expt::Access;
+using RAJA::expt::AccessPattern;
+
+TEST(DeferredGraphUnitTest, FusesPointwiseLoops)
+{
+  const int N = 1000;
+  std::vector<double> x(N, 1.0), tmp(N, 0.0), y(N, 0.0);
+  double* x_ptr = x.data();
+  double* tmp_ptr = tmp.data();
+  double* y_ptr = y.data();
+  const auto pw = AccessPattern::pointwise;
+
+  RAJA::expt::DeferredGraph<RAJA::resources::Host> graph;
+  RAJA::TypedRangeSegment<int> range(0, N);
+
+  graph.forall<RAJA::seq_exec>(range,
+                               Access().reads(x_ptr, N, pw).writes(tmp_ptr, N, pw),
+                               [=](int i) { tmp_ptr[i] = 2.0 * x_ptr[i] + i; });
+  graph.forall<RAJA::seq_exec>(range,
+                               Access().reads(tmp_ptr, N, pw).writes(y_ptr, N, pw),
+                               [=](int i) { y_ptr[i] = tmp_ptr[i] + 1.0; });
+
+  // nothing runs until the graph is flushed
+  ASSERT_EQ(graph.size(), 2u);
+  ASSERT_EQ(y[N - 1], 0.0);
+
+  graph.flush();
+
+  ASSERT_EQ(graph.size(), 0u);
+  ASSERT_EQ(graph.last_flush().recorded, 2u);
+  ASSERT_EQ(graph.last_flush().fused, 1u);
+  ASSERT_EQ(graph.last_flush().launched, 1u);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(y[i], 3.0 + i);
+  }
+}
+
+TEST(DeferredGraphUnitTest, KeepsNonPointwiseDependences)
+{
+  const int N = 100;
+  std::vector<int> a(N, 0), b(N, 0);
+  int* a_ptr = a.data();
+  int* b_ptr = b.data();
+
+  RAJA::expt::DeferredGraph<RAJA::resources::Host> graph;
+  RAJA::TypedRangeSegment<int> range(0, N);
+
+  graph.forall<RAJA::seq_exec>(range,
+                               Access().writes(a_ptr, N),
+                               [=](int i) { a_ptr[i] = i; });
+  // reads a neighbor, so it must wait for the whole first loop
+  graph.forall<RAJA::seq_exec>(range,
+                               Access().reads(a_ptr, N).writes(b_ptr, N),
+                               [=](int i) { b_ptr[i] = a_ptr[(i + 1) % N]; });
+  graph.flush();
+
+  ASSERT_EQ(graph.last_flush().fused, 0u);
+  ASSERT_EQ(graph.last_flush().launched, 2u);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(b[i], (i + 1) % N);
+  }
+}
+
+TEST(DeferredGraphUnitTest, DropsDeadTemporaries)
+{
+  const int N = 100;
+  std::vector<int> tmp(N, 0), out(N, 0);
+  int* tmp_ptr = tmp.data();
+  int* out_ptr = out.data();
+
+  RAJA::expt::DeferredGraph<RAJA::resources::Host> graph;
+  RAJA::TypedRangeSegment<int> range(0, N);
+
+  graph.temporary(tmp_ptr, N);
+  graph.forall<RAJA::seq_exec>(range,
+                               Access().writes(tmp_ptr, N),
+                               [=](int i) { tmp_ptr[i] = 7; });
+  graph.forall<RAJA::loop_exec>(range,
+                                Access().writes(out_ptr, N),
+                                [=](int i) { out_ptr[i] = i; });
+  graph.flush();
+
+  ASSERT_EQ(graph.last_flush().dropped, 1u);
+  ASSERT_EQ(tmp[0], 0);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(out[i], i);
+  }
+}
+
+TEST(DeferredGraphUnitTest, UnknownAccessesAreOrdered)
+{
+  const int N = 100;
+  std::vector<int> a(N, 0);
+  int* a_ptr = a.data();
+  int sum = 0;
+  int* sum_ptr = &sum;
+
+  {
+    RAJA::expt::DeferredGraph<RAJA::resources::Host> graph;
+    RAJA::TypedRangeSegment<int> range(0, N);
+
+    graph.forall<RAJA::seq_exec>(range, [=](int i) { a_ptr[i] = 1; });
+    graph.forall<RAJA::seq_exec>(range, [=](int i) { *sum_ptr += a_ptr[i]; });
+
+    // still recorded, the graph runs them when destroyed
+    ASSERT_EQ(sum, 0);
+  }
+
+  ASSERT_EQ(sum, N);
+}
+
+TEST(DeferredGraphUnitTest, IndependentLoopsAndKernels)
+{
+  const int N = 64;
+  std::vector<int> a(N, 0), b(N, 0), c(N * N, 0);
+  int* a_ptr = a.data();
+  int* b_ptr = b.data();
+  int* c_ptr = c.data();
+
+  RAJA::expt::DeferredGraph<RAJA::resources::Host> graph;
+
+  graph.forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                               Access().writes(a_ptr, N),
+                               [=](int i) { a_ptr[i] = i; });
+  graph.forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(1, N),
+                               Access().writes(b_ptr, N),
+                               [=](int i) { b_ptr[i] = 2 * i; });
+
+  using KernelPol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  graph.kernel<KernelPol>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N),
+                       RAJA::TypedRangeSegment<int>(0, N)),
+      Access().reads(a_ptr, N).reads(b_ptr, N).writes(c_ptr, N * N),
+      [=](int i, int j) { c_ptr[i + N * j] = a_ptr[i] + b_ptr[j]; });
+
+  graph.flush();
+
+  ASSERT_EQ(graph.last_flush().launched, 3u);
+  for (int j = 0; j < N; ++j) {
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(c[i + N * j], i + 2 * j);
+    }
+  }
+}
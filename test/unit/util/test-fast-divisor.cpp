@@ -0,0 +1,73 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for FastDivisor
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/FastDivisor.hpp"
+
+#include <limits>
+#include <random>
+
+template <typename T>
+class FastDivisorUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(FastDivisorUnitTest);
+
+TYPED_TEST_P(FastDivisorUnitTest, SmallValues)
+{
+  for (TypeParam d = 1; d < 300; ++d) {
+    RAJA::FastDivisor<TypeParam> div(d);
+    ASSERT_EQ(div.divisor(), d);
+    for (TypeParam n = 0; n < 1000; ++n) {
+      ASSERT_EQ(div.div(n), n / d);
+      ASSERT_EQ(div.mod(n), n % d);
+    }
+  }
+}
+
+TYPED_TEST_P(FastDivisorUnitTest, LargeValues)
+{
+  using limits = std::numeric_limits<TypeParam>;
+  std::mt19937_64 gen(7);
+
+  const TypeParam max = limits::max();
+  for (int i = 0; i < 100000; ++i) {
+    const int shift = static_cast<int>(gen() % limits::digits);
+    TypeParam d = static_cast<TypeParam>(static_cast<TypeParam>(gen() & max) >> shift);
+    if (d < 1) {
+      d = 1;
+    }
+    const TypeParam n = static_cast<TypeParam>(gen() & max);
+
+    RAJA::FastDivisor<TypeParam> div(d);
+    ASSERT_EQ(div.div(n), n / d);
+    ASSERT_EQ(div.mod(n), n % d);
+    ASSERT_EQ(div.div(max), max / d);
+  }
+
+  RAJA::FastDivisor<TypeParam> div(max);
+  ASSERT_EQ(div.div(max), TypeParam(1));
+  ASSERT_EQ(div.div(max - 1), TypeParam(0));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(FastDivisorUnitTest, SmallValues, LargeValues);
+
+using FastDivisorTypes = ::testing::Types<int,
+                                          unsigned int,
+                                          long,
+                                          long long,
+                                          unsigned long long>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(FastDivisorUnitTests,
+                               FastDivisorUnitTest,
+                               FastDivisorTypes);
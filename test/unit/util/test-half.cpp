@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for half_t and bfloat16_t
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/half.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+TEST(HalfUnitTest, RoundTrip)
+{
+  for (std::uint32_t b = 0; b < 0x10000u; ++b) {
+    const std::uint16_t bits = static_cast<std::uint16_t>(b);
+    const float f = RAJA::expt::half_t::from_bits(bits);
+    if (std::isnan(f)) {
+      ASSERT_TRUE(std::isnan(float(RAJA::expt::half_t(f))));
+    } else {
+      ASSERT_EQ(RAJA::expt::half_t(f).bits, bits);
+    }
+  }
+}
+
+TEST(HalfUnitTest, Values)
+{
+  using RAJA::expt::half_t;
+  ASSERT_EQ(half_t(1.0f).bits, 0x3c00);
+  ASSERT_EQ(half_t(-2.0f).bits, 0xc000);
+  ASSERT_EQ(half_t(65504.0f).bits, 0x7bff);
+  ASSERT_EQ(half_t(65520.0f).bits, 0x7c00);
+  ASSERT_EQ(half_t(std::numeric_limits<float>::infinity()).bits, 0x7c00);
+  // smallest subnormal, and the values rounding to it or to zero
+  ASSERT_EQ(half_t(std::ldexp(1.0f, -24)).bits, 0x0001);
+  ASSERT_EQ(half_t(std::ldexp(1.5f, -25)).bits, 0x0001);
+  ASSERT_EQ(half_t(std::ldexp(1.0f, -25)).bits, 0x0000);
+  // ties round to even
+  ASSERT_EQ(half_t(1.0f + std::ldexp(1.0f, -11)).bits, 0x3c00);
+  ASSERT_EQ(half_t(1.0f + 3.0f * std::ldexp(1.0f, -11)).bits, 0x3c02);
+  ASSERT_FLOAT_EQ(float(half_t(0.1f)), 0.0999755859375f);
+}
+
+TEST(Bfloat16UnitTest, RoundTrip)
+{
+  for (std::uint32_t b = 0; b < 0x10000u; ++b) {
+    const std::uint16_t bits = static_cast<std::uint16_t>(b);
+    const float f = RAJA::expt::bfloat16_t::from_bits(bits);
+    if (std::isnan(f)) {
+      ASSERT_TRUE(std::isnan(float(RAJA::expt::bfloat16_t(f))));
+    } else {
+      ASSERT_EQ(RAJA::expt::bfloat16_t(f).bits, bits);
+    }
+  }
+}
+
+TEST(Bfloat16UnitTest, Values)
+{
+  using RAJA::expt::bfloat16_t;
+  ASSERT_EQ(bfloat16_t(1.0f).bits, 0x3f80);
+  ASSERT_EQ(bfloat16_t(-2.0f).bits, 0xc000);
+  // ties round to even
+  ASSERT_EQ(bfloat16_t(1.0f + std::ldexp(1.0f, -8)).bits, 0x3f80);
+  ASSERT_EQ(bfloat16_t(1.0f + 3.0f * std::ldexp(1.0f, -8)).bits, 0x3f82);
+  ASSERT_EQ(bfloat16_t(std::numeric_limits<float>::max()).bits, 0x7f80);
+  ASSERT_TRUE(std::isnan(float(
+      bfloat16_t(std::numeric_limits<float>::quiet_NaN()))));
+}
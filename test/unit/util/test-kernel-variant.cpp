@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for kernel and launch policy variants
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+// Row major and column major traversals, told apart by the order of indices
+using VariantPolicies = camp::list<
+  RAJA::KernelPolicy<
+    RAJA::statement::For<1, RAJA::seq_exec,
+      RAJA::statement::For<0, RAJA::seq_exec,
+        RAJA::statement::Lambda<0>
+      >
+    >
+  >,
+  RAJA::KernelPolicy<
+    RAJA::statement::For<0, RAJA::seq_exec,
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::Lambda<0>
+      >
+    >
+  >
+>;
+
+static std::vector<int> run_variant(int variant)
+{
+  std::vector<int> order;
+  RAJA::expt::kernel_variant<VariantPolicies>(
+      variant,
+      RAJA::make_tuple(RAJA::RangeSegment(0, 3), RAJA::RangeSegment(0, 2)),
+      [&](int i, int j) { order.push_back(10 * j + i); });
+  return order;
+}
+
+TEST(KernelVariantUnitTest, SelectsByIndex)
+{
+  ASSERT_EQ(run_variant(0), (std::vector<int>{0, 1, 2, 10, 11, 12}));
+  ASSERT_EQ(run_variant(1), (std::vector<int>{0, 10, 1, 11, 2, 12}));
+}
+
+TEST(KernelVariantUnitTest, OutOfRange)
+{
+  ASSERT_ANY_THROW(run_variant(2));
+}
+
+TEST(KernelVariantUnitTest, Tuned)
+{
+  RAJA::expt::TileTuningCache cache;
+
+  int sum = 0;
+  for (int run = 0; run < 3; ++run) {
+    ASSERT_EQ(cache.find("sum#variant:3x2") != nullptr, run >= 2);
+
+    RAJA::expt::kernel_variant_tuned<VariantPolicies>(
+        cache,
+        "sum",
+        RAJA::make_tuple(RAJA::RangeSegment(0, 3), RAJA::RangeSegment(0, 2)),
+        [&](int i, int j) { sum += 10 * j + i; });
+  }
+
+  ASSERT_EQ(sum, 3 * 36);
+  ASSERT_EQ(cache.size(), 1u);
+}
+
+TEST(KernelVariantUnitTest, Launch)
+{
+  using LaunchPolicies =
+      camp::list<RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>,
+                 RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>>;
+  using loop_pol = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+  RAJA::resources::Resource res{RAJA::resources::Host()};
+
+  for (int variant = 0; variant < 2; ++variant) {
+    int count = 0;
+    RAJA::expt::launch_variant<LaunchPolicies>(
+        variant,
+        res,
+        RAJA::expt::Grid(RAJA::expt::Teams(1), RAJA::expt::Threads(4)),
+        [&](RAJA::expt::LaunchContext ctx) {
+          RAJA::expt::loop<loop_pol>(ctx, RAJA::RangeSegment(0, 4), [&](int) {
+            ++count;
+          });
+        });
+    ASSERT_EQ(count, 4);
+  }
+
+  ASSERT_ANY_THROW(RAJA::expt::launch_variant<LaunchPolicies>(
+      2,
+      res,
+      RAJA::expt::Grid(),
+      [&](RAJA::expt::LaunchContext) {}));
+}
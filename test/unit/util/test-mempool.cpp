@@ -0,0 +1,732 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+using arena_type = RAJA::basic_mempool::detail::MemoryArena;
+using pool_type =
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+
+static bool is_aligned(const void* ptr, size_t alignment)
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(MemPoolUnitTest, SizeClassArenaSmallBlocks)
+{
+  const size_t size = 4ull * 1024ull * 1024ull;
+  void* mem = std::malloc(size);
+
+  {
+    arena_type arena(mem, size, true);
+    ASSERT_TRUE(arena.uses_size_classes());
+    ASSERT_TRUE(arena.unused());
+
+    std::vector<void*> ptrs;
+    std::set<void*> unique_ptrs;
+    for (size_t i = 0; i < 10000; ++i) {
+      size_t nbytes = 1 + (i % 200);
+      void* ptr = arena.get(nbytes, 8);
+      ASSERT_NE(ptr, nullptr);
+      ASSERT_TRUE(is_aligned(ptr, 8));
+      ptrs.push_back(ptr);
+      unique_ptrs.insert(ptr);
+    }
+    ASSERT_EQ(unique_ptrs.size(), ptrs.size());
+    ASSERT_FALSE(arena.unused());
+
+    // blocks are reused after being given back
+    void* last = ptrs.back();
+    ASSERT_TRUE(arena.give(last));
+    ptrs.pop_back();
+    void* again = arena.get(1 + (9999 % 200), 8);
+    ASSERT_EQ(again, last);
+    ptrs.push_back(again);
+
+    for (void* ptr : ptrs) {
+      ASSERT_TRUE(arena.give(ptr));
+    }
+    ASSERT_TRUE(arena.unused());
+
+    // pointers outside of the arena are rejected
+    int on_stack;
+    ASSERT_FALSE(arena.give(&on_stack));
+  }
+
+  std::free(mem);
+}
+
+TEST(MemPoolUnitTest, SizeClassArenaAlignment)
+{
+  const size_t size = 4ull * 1024ull * 1024ull;
+  void* mem = std::malloc(size);
+
+  {
+    arena_type arena(mem, size, true);
+
+    for (size_t alignment = 1; alignment <= 8192; alignment *= 2) {
+      void* ptr = arena.get(24, alignment);
+      ASSERT_NE(ptr, nullptr);
+      ASSERT_TRUE(is_aligned(ptr, alignment));
+      ASSERT_TRUE(arena.give(ptr));
+    }
+    ASSERT_TRUE(arena.unused());
+  }
+
+  std::free(mem);
+}
+
+TEST(MemPoolUnitTest, SizeClassArenaMixedSizes)
+{
+  const size_t size = 4ull * 1024ull * 1024ull;
+  void* mem = std::malloc(size);
+
+  {
+    arena_type arena(mem, size, true);
+
+    // small blocks and large chunks must not overlap
+    char* large = static_cast<char*>(arena.get(1024 * 1024, 64));
+    char* small = static_cast<char*>(arena.get(64, 64));
+    char* large2 = static_cast<char*>(arena.get(512 * 1024, 256));
+    ASSERT_NE(large, nullptr);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large2, nullptr);
+    ASSERT_TRUE(small + 64 <= large || large + 1024 * 1024 <= small);
+    ASSERT_TRUE(small + 64 <= large2 || large2 + 512 * 1024 <= small);
+
+    ASSERT_TRUE(arena.give(small));
+    ASSERT_TRUE(arena.give(large));
+    ASSERT_TRUE(arena.give(large2));
+    ASSERT_TRUE(arena.unused());
+  }
+
+  std::free(mem);
+}
+
+TEST(MemPoolUnitTest, MapArena)
+{
+  const size_t size = 1024ull * 1024ull;
+  void* mem = std::malloc(size);
+
+  {
+    arena_type arena(mem, size);
+    ASSERT_FALSE(arena.uses_size_classes());
+
+    void* a = arena.get(16, 16);
+    void* b = arena.get(16, 16);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(a, b);
+    ASSERT_FALSE(arena.unused());
+    ASSERT_TRUE(arena.give(a));
+    ASSERT_TRUE(arena.give(b));
+    ASSERT_TRUE(arena.unused());
+
+    ASSERT_EQ(arena.get(2 * size, 16), nullptr);
+  }
+
+  std::free(mem);
+}
+
+TEST(MemPoolUnitTest, PoolMallocFree)
+{
+  pool_type pool;
+  // size classes are opt in
+  ASSERT_FALSE(pool.size_classes());
+
+  for (bool size_classes : {true, false}) {
+    pool.size_classes(size_classes);
+
+    std::vector<double*> ptrs;
+    for (size_t i = 1; i < 1000; i += 7) {
+      double* ptr = pool.malloc<double>(i);
+      ASSERT_NE(ptr, nullptr);
+      ASSERT_TRUE(is_aligned(ptr, alignof(double)));
+      for (size_t j = 0; j < i; ++j) {
+        ptr[j] = static_cast<double>(j);
+      }
+      ptrs.push_back(ptr);
+    }
+
+    for (double* ptr : ptrs) {
+      pool.free(ptr);
+    }
+  }
+
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, ThreadCacheMallocFree)
+{
+  pool_type pool;
+  pool.size_classes(true);
+  ASSERT_FALSE(pool.thread_caches());
+  pool.thread_caches(true);
+  ASSERT_TRUE(pool.thread_caches());
+
+  // small blocks freed by this thread are reused by this thread
+  int* first = pool.malloc<int>(4);
+  ASSERT_NE(first, nullptr);
+  pool.free(first);
+  std::set<int*> seen;
+  for (size_t i = 0; i < 100; ++i) {
+    int* ptr = pool.malloc<int>(4);
+    ASSERT_NE(ptr, nullptr);
+    seen.insert(ptr);
+    pool.free(ptr);
+  }
+  using cache_type = RAJA::basic_mempool::detail::ThreadCache;
+  ASSERT_LE(seen.size(),
+            size_t(cache_type::refill_size + cache_type::pending_size));
+
+  // large blocks bypass the magazines
+  std::vector<char*> ptrs;
+  for (size_t i = 0; i < 100; ++i) {
+    char* small = pool.malloc<char>(1 + i);
+    char* large = pool.malloc<char>(64 * 1024 + i);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+    small[0] = 'a';
+    large[64 * 1024 + i - 1] = 'b';
+    ptrs.push_back(small);
+    ptrs.push_back(large);
+  }
+  for (char* ptr : ptrs) {
+    pool.free(ptr);
+  }
+
+  pool.thread_caches(false);
+  ASSERT_FALSE(pool.thread_caches());
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, ThreadCacheDefaultSettings)
+{
+  pool_type pool;
+  ASSERT_FALSE(pool.size_classes());
+  pool.thread_caches(true);
+  ASSERT_TRUE(pool.size_classes());
+
+  // the first miss refills the magazine, later frees are cached again
+  int* first = pool.malloc<int>(4);
+  ASSERT_NE(first, nullptr);
+  pool.free(first);
+  const size_t bytes_in_use = pool.get_stats().bytes_in_use;
+
+  std::set<int*> seen;
+  for (size_t i = 0; i < 100; ++i) {
+    int* ptr = pool.malloc<int>(4);
+    ASSERT_NE(ptr, nullptr);
+    seen.insert(ptr);
+    pool.free(ptr);
+  }
+  using cache_type = RAJA::basic_mempool::detail::ThreadCache;
+  ASSERT_LE(seen.size(),
+            size_t(cache_type::refill_size + cache_type::pending_size));
+
+  RAJA::basic_mempool::MemPoolStats stats = pool.get_stats();
+  ASSERT_EQ(stats.bytes_in_use, bytes_in_use);
+  ASSERT_GT(stats.bytes_cached, size_t(0));
+
+  pool.thread_caches(false);
+  ASSERT_EQ(pool.get_stats().bytes_in_use, size_t(0));
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, ThreadCacheArenaWithoutSizeClasses)
+{
+  pool_type pool;
+
+  // an arena allocated before the caches are enabled has no slabs
+  int* warm = pool.malloc<int>(1);
+  ASSERT_NE(warm, nullptr);
+  pool.thread_caches(true);
+
+  // blocks from it are handed out alone, not refilled into the magazine
+  int* ptr = pool.malloc<int>(4);
+  ASSERT_NE(ptr, nullptr);
+  ASSERT_EQ(pool.get_stats().bytes_cached, size_t(0));
+
+  pool.free(ptr);
+  pool.free(warm);
+  pool.thread_caches(false);
+  RAJA::basic_mempool::MemPoolStats stats = pool.get_stats();
+  ASSERT_EQ(stats.bytes_cached, size_t(0));
+  ASSERT_EQ(stats.bytes_in_use, size_t(0));
+  pool.free_chunks();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(MemPoolUnitTest, ThreadCacheOpenMP)
+{
+  pool_type pool;
+  pool.thread_caches(true);
+
+  int errors = 0;
+
+#pragma omp parallel reduction(+ : errors)
+  {
+    std::vector<long*> ptrs;
+    for (int iter = 0; iter < 50; ++iter) {
+      for (long i = 1; i < 64; ++i) {
+        long* ptr = pool.malloc<long>(i);
+        if (ptr == nullptr) {
+          ++errors;
+          continue;
+        }
+        ptr[0] = i;
+        ptr[i - 1] = i;
+        ptrs.push_back(ptr);
+      }
+      for (long* ptr : ptrs) {
+        long n = ptr[0];
+        if (ptr[n - 1] != n) {
+          ++errors;
+        }
+        pool.free(ptr);
+      }
+      ptrs.clear();
+    }
+  }
+
+  ASSERT_EQ(errors, 0);
+
+  pool.free_chunks();
+}
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(MemPoolUnitTest, ThreadCacheToggleOpenMP)
+{
+  pool_type pool;
+
+  int errors = 0;
+
+#pragma omp parallel reduction(+ : errors)
+  {
+    std::vector<int*> ptrs;
+    for (int iter = 0; iter < 200; ++iter) {
+#pragma omp master
+      pool.thread_caches(iter % 2 == 0);
+
+      for (size_t i = 1; i < 32; ++i) {
+        int* ptr = pool.malloc<int>(i);
+        if (ptr == nullptr) {
+          ++errors;
+          continue;
+        }
+        ptr[i - 1] = iter;
+        ptrs.push_back(ptr);
+      }
+      for (int* ptr : ptrs) {
+        pool.free(ptr);
+      }
+      ptrs.clear();
+    }
+  }
+
+  ASSERT_EQ(errors, 0);
+
+  // frees racing with the last disable must not leave blocks parked
+  pool.thread_caches(false);
+  RAJA::basic_mempool::MemPoolStats stats = pool.get_stats();
+  ASSERT_EQ(stats.bytes_cached, size_t(0));
+  ASSERT_EQ(stats.bytes_in_use, size_t(0));
+
+  pool.free_chunks();
+}
+#endif
+
+// allocator with fake streams and events to test stream ordered frees
+struct stream_test_allocator : RAJA::basic_mempool::generic_allocator {
+  using stream_type = int;
+  using event_type = size_t;
+
+  static std::vector<bool>& events()
+  {
+    static std::vector<bool> s_events;
+    return s_events;
+  }
+
+  event_type create_event()
+  {
+    events().push_back(false);
+    return events().size() - 1;
+  }
+  void destroy_event(event_type) {}
+  void record_event(event_type event, stream_type) { events()[event] = false; }
+  bool event_complete(event_type event) { return events()[event]; }
+  void synchronize_event(event_type event) { events()[event] = true; }
+};
+
+TEST(MemPoolUnitTest, StreamOrderedFree)
+{
+  using stream_pool_type = RAJA::basic_mempool::MemPool<stream_test_allocator>;
+
+  for (size_t n : {size_t(8), size_t(100000)}) {
+    // a fresh pool so the blocks from the last size do not move a
+    stream_pool_type pool;
+
+    double* a = pool.stream_malloc<double>(n, 1);
+    ASSERT_NE(a, nullptr);
+    pool.stream_free(a, 1);
+
+    // reused right away on the same stream
+    double* b = pool.stream_malloc<double>(n, 1);
+    ASSERT_EQ(a, b);
+    pool.stream_free(b, 1);
+
+    // not given to another stream or to unordered mallocs before completion
+    double* c = pool.stream_malloc<double>(n, 2);
+    double* d = pool.malloc<double>(n);
+    ASSERT_NE(c, nullptr);
+    ASSERT_NE(d, nullptr);
+    ASSERT_NE(c, a);
+    ASSERT_NE(d, a);
+    pool.free(d);
+    pool.stream_free(c, 2);
+
+    // available to everyone once the work on the stream completes
+    for (size_t e = 0; e < stream_test_allocator::events().size(); ++e) {
+      stream_test_allocator::events()[e] = true;
+    }
+    std::set<double*> ptrs;
+    for (int i = 0; i < 3; ++i) {
+      double* e = pool.stream_malloc<double>(n, 3);
+      ASSERT_NE(e, nullptr);
+      ptrs.insert(e);
+    }
+    ASSERT_EQ(ptrs.count(a), size_t(1));
+    for (double* e : ptrs) {
+      pool.stream_free(e, 3);
+    }
+
+    pool.free_chunks();
+  }
+}
+
+TEST(MemPoolUnitTest, Stats)
+{
+  for (bool size_classes : {false, true}) {
+    pool_type pool;
+    pool.size_classes(size_classes);
+    // small blocks are rounded up to their size class when enabled
+    const size_t small_bytes = size_classes ? 16 : 10;
+
+    pool.arena_size(1024 * 1024);
+
+    RAJA::basic_mempool::MemPoolStats stats = pool.get_stats();
+    ASSERT_EQ(stats.num_arenas, size_t(0));
+    ASSERT_EQ(stats.bytes_reserved, size_t(0));
+    ASSERT_EQ(stats.bytes_in_use, size_t(0));
+
+    char* small = pool.malloc<char>(10);
+    char* large = pool.malloc<char>(100000);
+    char* huge = pool.malloc<char>(2 * 1024 * 1024);
+
+    stats = pool.get_stats();
+    ASSERT_EQ(stats.num_arenas, size_t(2));
+    ASSERT_GE(stats.bytes_reserved, size_t(3 * 1024 * 1024));
+    ASSERT_EQ(stats.bytes_in_use,
+              size_t(small_bytes + 100000 + 2 * 1024 * 1024));
+    ASSERT_EQ(stats.num_allocations, size_t(3));
+    ASSERT_EQ(stats.peak_bytes_in_use, stats.bytes_in_use);
+    ASSERT_EQ(stats.bytes_cached, size_t(0));
+    ASSERT_GT(stats.bytes_free, size_t(0));
+    ASSERT_LE(stats.largest_free_block, stats.bytes_free);
+    size_t num_free_blocks = 0;
+    for (size_t bin = 0; bin < stats.num_histogram_bins; ++bin) {
+      num_free_blocks += stats.free_block_histogram[bin];
+    }
+    ASSERT_GT(num_free_blocks, size_t(0));
+    ASSERT_GE(stats.fragmentation(), 0.0);
+    ASSERT_LT(stats.fragmentation(), 1.0);
+
+    pool.free(huge);
+    stats = pool.get_stats();
+    ASSERT_EQ(stats.bytes_in_use, size_t(small_bytes + 100000));
+    ASSERT_EQ(stats.peak_bytes_in_use,
+              size_t(small_bytes + 100000 + 2 * 1024 * 1024));
+
+    pool.reset_peak_bytes_in_use();
+    ASSERT_EQ(pool.get_stats().peak_bytes_in_use,
+              size_t(small_bytes + 100000));
+
+    // only the arena that held huge is empty
+    ASSERT_GE(pool.free_unused_chunks(), size_t(2 * 1024 * 1024));
+    stats = pool.get_stats();
+    ASSERT_EQ(stats.num_arenas, size_t(1));
+    ASSERT_EQ(stats.num_allocations, size_t(2));
+
+    pool.free(small);
+    pool.free(large);
+    ASSERT_GT(pool.free_unused_chunks(), size_t(0));
+    stats = pool.get_stats();
+    ASSERT_EQ(stats.num_arenas, size_t(0));
+    ASSERT_EQ(stats.bytes_in_use, size_t(0));
+  }
+}
+
+TEST(MemPoolUnitTest, StatsThreadCache)
+{
+  pool_type pool;
+  pool.size_classes(true);
+  pool.thread_caches(true);
+
+  int* ptr = pool.malloc<int>(1);
+  pool.free(ptr);
+
+  RAJA::basic_mempool::MemPoolStats stats = pool.get_stats();
+  ASSERT_GT(stats.bytes_cached, size_t(0));
+  ASSERT_EQ(stats.bytes_cached, stats.bytes_in_use);
+
+  // cached blocks do not keep arenas alive
+  ASSERT_GT(pool.free_unused_chunks(), size_t(0));
+  ASSERT_EQ(pool.get_stats().num_arenas, size_t(0));
+}
+
+TEST(MemPoolUnitTest, StatsThreadCacheDisable)
+{
+  pool_type pool;
+  pool.size_classes(true);
+  pool.thread_caches(true);
+
+  int* ptr = pool.malloc<int>(1);
+  pool.free(ptr);
+  ASSERT_GT(pool.get_stats().bytes_cached, size_t(0));
+
+  // disabling drains the caches and later frees go straight to the arenas
+  pool.thread_caches(false);
+  ASSERT_EQ(pool.get_stats().bytes_cached, size_t(0));
+
+  ptr = pool.malloc<int>(1);
+  pool.free(ptr);
+  RAJA::basic_mempool::MemPoolStats stats = pool.get_stats();
+  ASSERT_EQ(stats.bytes_cached, size_t(0));
+  ASSERT_EQ(stats.bytes_in_use, size_t(0));
+}
+
+TEST(MemPoolUnitTest, HugePageAllocator)
+{
+  using allocator_type = RAJA::basic_mempool::huge_page_allocator;
+  using backing = allocator_type::backing;
+
+  allocator_type alloc;
+  const size_t size = 3ull * 1024ull * 1024ull + 17ull;
+
+  char* ptr = static_cast<char*>(alloc.malloc(size));
+  ASSERT_NE(ptr, nullptr);
+  ptr[0] = 1;
+  ptr[size - 1] = 2;
+
+  backing kind = alloc.backing_of(ptr);
+  if (kind != backing::malloc) {
+    ASSERT_TRUE(is_aligned(ptr, allocator_type::huge_page_bytes()));
+  }
+
+  ASSERT_TRUE(alloc.free(ptr));
+  ASSERT_FALSE(alloc.free(ptr));
+
+  using huge_pool_type = RAJA::basic_mempool::MemPool<allocator_type>;
+  huge_pool_type& pool = huge_pool_type::getInstance();
+
+  double* d = pool.malloc<double>(1000);
+  ASSERT_NE(d, nullptr);
+  d[999] = 1.0;
+  pool.free(d);
+
+  ASSERT_EQ(pool.get_stats().bytes_in_use, 0u);
+  pool.free_chunks();
+}
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+//
+// The stream ordered allocators hand out memory that is usable right away
+// on any stream, zeroed for the zeroed allocator, and the release threshold
+// set for the device pool is the one applied on the next allocation.
+//
+template <typename Base,
+          typename Allocator,
+          typename ZeroedAllocator,
+          typename Memcpy,
+          typename GetThreshold>
+void DeviceAsyncAllocatorTestImpl(Memcpy memcpy_to_host,
+                                  GetThreshold device_threshold)
+{
+  const size_t size = 1024ull * 1024ull + 3ull;
+
+  const uint64_t previous = Base::release_threshold(8ull * size);
+  ASSERT_EQ(Base::release_threshold(), 8ull * size);
+
+  {
+    ZeroedAllocator alloc;
+    char* ptr = static_cast<char*>(alloc.malloc(size));
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(device_threshold(), 8ull * size);
+
+    std::vector<char> host(size, 1);
+    memcpy_to_host(host.data(), ptr, size);
+    for (size_t i = 0; i < size; ++i) {
+      ASSERT_EQ(host[i], 0) << "at byte " << i;
+    }
+    ASSERT_TRUE(alloc.free(ptr));
+  }
+
+  {
+    Allocator alloc;
+    void* a = alloc.malloc(size);
+    void* b = alloc.malloc(size);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(a, b);
+    ASSERT_TRUE(alloc.free(a));
+    ASSERT_TRUE(alloc.free(b));
+  }
+
+  // arenas are given back and taken from the device pool again
+  using async_pool_type = RAJA::basic_mempool::MemPool<Allocator>;
+  async_pool_type& pool = async_pool_type::getInstance();
+  for (int rep = 0; rep < 3; ++rep) {
+    double* d = pool.template malloc<double>(1000 * (rep + 1));
+    ASSERT_NE(d, nullptr);
+    pool.free(d);
+    ASSERT_EQ(pool.get_stats().bytes_in_use, 0u);
+    pool.free_chunks();
+  }
+
+  Base::release_threshold(previous);
+  ASSERT_EQ(Base::release_threshold(), previous);
+}
+#endif
+
+#if defined(RAJA_ENABLE_CUDA) && CUDART_VERSION >= 11020
+TEST(MemPoolUnitTest, CudaDeviceAsyncAllocator)
+{
+  DeviceAsyncAllocatorTestImpl<RAJA::cuda::DeviceAsyncAllocatorBase,
+                               RAJA::cuda::DeviceAsyncAllocator,
+                               RAJA::cuda::DeviceZeroedAsyncAllocator>(
+      [](void* dst, const void* src, size_t nbytes) {
+        cudaErrchk(cudaMemcpy(dst, src, nbytes, cudaMemcpyDeviceToHost));
+      },
+      []() {
+        int device;
+        cudaErrchk(cudaGetDevice(&device));
+        cudaMemPool_t pool;
+        cudaErrchk(cudaDeviceGetDefaultMemPool(&pool, device));
+        uint64_t threshold = 0;
+        cudaErrchk(cudaMemPoolGetAttribute(
+            pool, cudaMemPoolAttrReleaseThreshold, &threshold));
+        return threshold;
+      });
+}
+#endif
+
+#if defined(RAJA_ENABLE_HIP) && \
+    ((HIP_VERSION_MAJOR > 5) || \
+     (HIP_VERSION_MAJOR == 5 && HIP_VERSION_MINOR >= 2))
+TEST(MemPoolUnitTest, HipDeviceAsyncAllocator)
+{
+  DeviceAsyncAllocatorTestImpl<RAJA::hip::DeviceAsyncAllocatorBase,
+                               RAJA::hip::DeviceAsyncAllocator,
+                               RAJA::hip::DeviceZeroedAsyncAllocator>(
+      [](void* dst, const void* src, size_t nbytes) {
+        hipErrchk(hipMemcpy(dst, src, nbytes, hipMemcpyDeviceToHost));
+      },
+      []() {
+        int device;
+        hipErrchk(hipGetDevice(&device));
+        hipMemPool_t pool;
+        hipErrchk(hipDeviceGetDefaultMemPool(&pool, device));
+        uint64_t threshold = 0;
+        hipErrchk(hipMemPoolGetAttribute(
+            pool, hipMemPoolAttrReleaseThreshold, &threshold));
+        return threshold;
+      });
+}
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+//
+// First touch allocations are page aligned and zeroed, and each thread
+// touched the contiguous pages a static schedule gives it, which is the
+// split of omp_parallel_for_static_exec over the same pages.
+//
+TEST(MemPoolUnitTest, OmpFirstTouchAllocator)
+{
+  using allocator_type = RAJA::omp::FirstTouchAllocator;
+  const size_t page_bytes = RAJA::omp::detail::page_size();
+
+  const size_t sizes[] = {1, page_bytes - 1, page_bytes, 10 * page_bytes + 7,
+                          257 * page_bytes};
+
+  for (size_t nbytes : sizes) {
+    allocator_type alloc;
+    char* ptr = static_cast<char*>(alloc.malloc(nbytes));
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_TRUE(is_aligned(ptr, page_bytes));
+    for (size_t i = 0; i < nbytes; ++i) {
+      ASSERT_EQ(ptr[i], 0) << "at byte " << i;
+    }
+
+    const int num_pages = static_cast<int>((nbytes + page_bytes - 1) /
+                                           page_bytes);
+    std::vector<int> owner(num_pages, -1);
+    int* owner_ptr = owner.data();
+    RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+        RAJA::TypedRangeSegment<int>(0, num_pages),
+        [=](int p) { owner_ptr[p] = omp_get_thread_num(); });
+
+    const auto& placement = alloc.placement();
+    ASSERT_EQ(static_cast<size_t>(omp_get_max_threads()), placement.size());
+
+    size_t covered = 0;
+    for (size_t t = 0; t < placement.size(); ++t) {
+      const RAJA::omp::FirstTouchPlacement& tp = placement[t];
+      ASSERT_EQ(static_cast<int>(t), tp.thread);
+      ASSERT_LE(tp.begin, tp.end);
+      ASSERT_LE(tp.end, nbytes);
+      if (tp.begin == tp.end) {
+        continue;
+      }
+      // ranges follow each other in thread order
+      ASSERT_EQ(covered, tp.begin);
+      ASSERT_EQ(0u, tp.begin % page_bytes);
+      covered = tp.end;
+      for (size_t b = tp.begin; b < tp.end; b += page_bytes) {
+        ASSERT_EQ(tp.thread, owner[b / page_bytes]) << "at byte " << b;
+      }
+      ASSERT_GE(tp.cpu, -1);
+      ASSERT_GE(tp.numa_node, -1);
+    }
+    ASSERT_EQ(nbytes, covered);
+
+    ASSERT_TRUE(alloc.free(ptr));
+  }
+
+  using first_touch_pool_type = RAJA::basic_mempool::MemPool<allocator_type>;
+  first_touch_pool_type& pool = first_touch_pool_type::getInstance();
+
+  double* d = pool.malloc<double>(100000);
+  ASSERT_NE(d, nullptr);
+  d[0] = 1.0;
+  d[99999] = 2.0;
+  pool.free(d);
+
+  ASSERT_EQ(pool.get_stats().bytes_in_use, 0u);
+  pool.free_chunks();
+}
+#endif
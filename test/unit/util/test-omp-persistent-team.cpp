@@ -0,0 +1,72 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for OmpPersistentTeam
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <vector>
+
+TEST(OmpPersistentTeamUnitTest, Foralls)
+{
+  const int N = 1000;
+  const int num_steps = 50;
+  std::vector<int> a(N, 0);
+  int* a_ptr = a.data();
+
+  RAJA::expt::OmpPersistentTeam team;
+
+  ASSERT_EQ(RAJA::expt::OmpPersistentTeam::current(), &team);
+  ASSERT_GE(team.num_threads(), 1);
+
+  for (int step = 0; step < num_steps; ++step) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::TypedRangeSegment<int>(0, N), [=](int i) { a_ptr[i] += i; });
+
+    RAJA::ReduceSum<RAJA::omp_reduce, long> sum(0);
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::TypedRangeSegment<int>(0, N), [=](int i) { sum += a_ptr[i]; });
+
+    ASSERT_EQ(sum.get(), long(step + 1) * N * (N - 1) / 2);
+  }
+}
+
+TEST(OmpPersistentTeamUnitTest, Regions)
+{
+  const int N = 1000;
+  std::vector<int> a(N, 0);
+  std::vector<int> b(N, 0);
+  int* a_ptr = a.data();
+  int* b_ptr = b.data();
+
+  RAJA::expt::OmpPersistentTeam outer;
+  {
+    RAJA::expt::OmpPersistentTeam inner(2, 0);
+    ASSERT_EQ(RAJA::expt::OmpPersistentTeam::current(), &inner);
+
+    RAJA::region<RAJA::omp_parallel_region>([=]() {
+      RAJA::forall<RAJA::omp_for_nowait_static_exec<>>(
+          RAJA::TypedRangeSegment<int>(0, N), [=](int i) { a_ptr[i] = i; });
+      RAJA::forall<RAJA::omp_for_nowait_static_exec<>>(
+          RAJA::TypedRangeSegment<int>(0, N),
+          [=](int i) { b_ptr[i] = a_ptr[i] + 1; });
+    });
+  }
+  ASSERT_EQ(RAJA::expt::OmpPersistentTeam::current(), &outer);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(b[i], i + 1);
+  }
+}
+
+#endif
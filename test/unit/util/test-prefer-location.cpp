@@ -0,0 +1,221 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for managed memory preferred locations
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+//
+// A registered range is prefetched before the next launch only, again after
+// it is marked as touched on the host, never when it prefers the host, and
+// not at all once forgotten. The launches read and write the range to check
+// the prefetch does not change its values.
+//
+template <typename Backend>
+void PreferLocationTestImpl()
+{
+  using exec_policy = typename Backend::exec_policy;
+  using Res = typename Backend::resource;
+
+  const int N = 1 << 16;
+  const size_t nbytes = N * sizeof(double);
+
+  Res res = Res::get_default();
+  double* x =
+      res.template allocate<double>(N, camp::resources::MemoryAccess::Managed);
+  for (int i = 0; i < N; ++i) {
+    x[i] = i;
+  }
+
+  auto increment = [&]() {
+    RAJA::forall<exec_policy>(res,
+                              RAJA::TypedRangeSegment<int>(0, N),
+                              [=] RAJA_HOST_DEVICE(int i) { x[i] += 1.0; });
+    res.wait();
+  };
+
+  const size_t pending = Backend::pending();
+  const int device = Backend::current_device();
+
+  Backend::prefer_location(x, nbytes);
+  ASSERT_EQ(pending + 1, Backend::pending());
+  ASSERT_EQ(device, Backend::preferred_location(x, nbytes));
+
+  // registering the same range again replaces it
+  Backend::prefer_location(x, nbytes);
+  ASSERT_EQ(pending + 1, Backend::pending());
+
+  increment();
+  ASSERT_EQ(pending, Backend::pending());
+  ASSERT_EQ(device, Backend::last_prefetch_location(x, nbytes));
+
+  // prefetched once only
+  increment();
+  ASSERT_EQ(pending, Backend::pending());
+
+  for (int i = 0; i < N; ++i) {
+    x[i] += 1.0;
+  }
+  Backend::mark_host_touched(x);
+  ASSERT_EQ(pending + 1, Backend::pending());
+  Backend::mark_host_touched(x);
+  ASSERT_EQ(pending + 1, Backend::pending());
+
+  increment();
+  ASSERT_EQ(pending, Backend::pending());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(static_cast<double>(i + 4), x[i]);
+  }
+
+  // ranges that prefer the host are not prefetched
+  Backend::prefer_location(x, nbytes, Backend::cpu_device_id());
+  ASSERT_EQ(pending, Backend::pending());
+  ASSERT_EQ(Backend::cpu_device_id(), Backend::preferred_location(x, nbytes));
+  Backend::mark_host_touched(x);
+  ASSERT_EQ(pending, Backend::pending());
+
+  // views register the memory they reference
+  RAJA::View<double, RAJA::Layout<2>> view(x, N / 4, 4);
+  Backend::prefer_location(view, device);
+  ASSERT_EQ(pending + 1, Backend::pending());
+  ASSERT_EQ(device, Backend::preferred_location(x, nbytes));
+
+  Backend::forget_location(x);
+  ASSERT_EQ(pending, Backend::pending());
+  ASSERT_EQ(Backend::invalid_device_id(), Backend::preferred_location(x, nbytes));
+  Backend::mark_host_touched(x);
+  ASSERT_EQ(pending, Backend::pending());
+
+  increment();
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(static_cast<double>(i + 5), x[i]);
+  }
+
+  res.deallocate(x, camp::resources::MemoryAccess::Managed);
+}
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+struct CudaPreferLocation {
+  using exec_policy = RAJA::cuda_exec<256>;
+  using resource = camp::resources::Cuda;
+
+  static size_t pending()
+  {
+    return RAJA::cuda::detail::g_num_pending_prefetches.load();
+  }
+  static int current_device()
+  {
+    int device;
+    cudaErrchk(cudaGetDevice(&device));
+    return device;
+  }
+  static int cpu_device_id() { return cudaCpuDeviceId; }
+  static int invalid_device_id() { return cudaInvalidDeviceId; }
+  static int range_attribute(const void* ptr,
+                             size_t nbytes,
+                             cudaMemRangeAttribute attr)
+  {
+    int location = 0;
+    cudaErrchk(cudaMemRangeGetAttribute(
+        &location, sizeof(location), attr, ptr, nbytes));
+    return location;
+  }
+  static int preferred_location(const void* ptr, size_t nbytes)
+  {
+    return range_attribute(
+        ptr, nbytes, cudaMemRangeAttributePreferredLocation);
+  }
+  static int last_prefetch_location(const void* ptr, size_t nbytes)
+  {
+    return range_attribute(
+        ptr, nbytes, cudaMemRangeAttributeLastPrefetchLocation);
+  }
+  template <typename... Args>
+  static void prefer_location(Args&&... args)
+  {
+    RAJA::cuda::prefer_location(std::forward<Args>(args)...);
+  }
+  static void mark_host_touched(const void* ptr)
+  {
+    RAJA::cuda::mark_host_touched(ptr);
+  }
+  static void forget_location(const void* ptr)
+  {
+    RAJA::cuda::forget_location(ptr);
+  }
+};
+
+TEST(PreferLocationUnitTest, Cuda)
+{
+  PreferLocationTestImpl<CudaPreferLocation>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+struct HipPreferLocation {
+  using exec_policy = RAJA::hip_exec<256>;
+  using resource = camp::resources::Hip;
+
+  static size_t pending()
+  {
+    return RAJA::hip::detail::g_num_pending_prefetches.load();
+  }
+  static int current_device()
+  {
+    int device;
+    hipErrchk(hipGetDevice(&device));
+    return device;
+  }
+  static int cpu_device_id() { return hipCpuDeviceId; }
+  static int invalid_device_id() { return hipInvalidDeviceId; }
+  static int range_attribute(const void* ptr,
+                             size_t nbytes,
+                             hipMemRangeAttribute attr)
+  {
+    int location = 0;
+    hipErrchk(hipMemRangeGetAttribute(
+        &location, sizeof(location), attr, ptr, nbytes));
+    return location;
+  }
+  static int preferred_location(const void* ptr, size_t nbytes)
+  {
+    return range_attribute(
+        ptr, nbytes, hipMemRangeAttributePreferredLocation);
+  }
+  static int last_prefetch_location(const void* ptr, size_t nbytes)
+  {
+    return range_attribute(
+        ptr, nbytes, hipMemRangeAttributeLastPrefetchLocation);
+  }
+  template <typename... Args>
+  static void prefer_location(Args&&... args)
+  {
+    RAJA::hip::prefer_location(std::forward<Args>(args)...);
+  }
+  static void mark_host_touched(const void* ptr)
+  {
+    RAJA::hip::mark_host_touched(ptr);
+  }
+  static void forget_location(const void* ptr)
+  {
+    RAJA::hip::forget_location(ptr);
+  }
+};
+
+TEST(PreferLocationUnitTest, Hip)
+{
+  PreferLocationTestImpl<HipPreferLocation>();
+}
+#endif
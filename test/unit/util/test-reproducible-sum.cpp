@@ -0,0 +1,138 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for reproducible_sum
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/ReproducibleSum.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+template <typename T>
+class ReproducibleSumUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(ReproducibleSumUnitTest);
+
+template <typename T>
+static bool same_bits(T a, T b)
+{
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+TYPED_TEST_P(ReproducibleSumUnitTest, Exact)
+{
+  using sum_type = RAJA::reduce::reproducible_sum<TypeParam>;
+  using limits = std::numeric_limits<TypeParam>;
+
+  sum_type sum;
+  ASSERT_EQ(sum.value(), TypeParam(0));
+
+  // cancellation that loses the small term in ordinary arithmetic
+  const TypeParam big = std::ldexp(TypeParam(1), limits::digits + 4);
+  sum += big;
+  sum += TypeParam(1);
+  sum += -big;
+  ASSERT_EQ(sum.value(), TypeParam(1));
+
+  sum += -TypeParam(3);
+  ASSERT_EQ(sum.value(), TypeParam(-2));
+
+  sum_type extremes;
+  extremes += limits::max();
+  extremes += limits::denorm_min();
+  extremes += -limits::max();
+  ASSERT_EQ(extremes.value(), limits::denorm_min());
+
+  ASSERT_TRUE(sum_type(TypeParam(2)) == sum_type(TypeParam(1)) +
+                                            sum_type(TypeParam(1)));
+  ASSERT_TRUE(sum_type(TypeParam(2)) != sum_type(TypeParam(1)));
+}
+
+TYPED_TEST_P(ReproducibleSumUnitTest, OrderIndependent)
+{
+  using sum_type = RAJA::reduce::reproducible_sum<TypeParam>;
+
+  std::mt19937 gen(12345);
+  std::uniform_real_distribution<TypeParam> mantissa(-1, 1);
+  std::uniform_int_distribution<int> exponent(-40, 40);
+
+  std::vector<TypeParam> values(10007);
+  for (TypeParam& v : values) {
+    v = std::ldexp(mantissa(gen), exponent(gen));
+  }
+
+  sum_type forward;
+  for (TypeParam v : values) {
+    forward += v;
+  }
+  const TypeParam expected = forward.value();
+
+  for (int parts : {2, 7, 64, 1000}) {
+    std::shuffle(values.begin(), values.end(), gen);
+
+    std::vector<sum_type> partial(parts);
+    for (size_t i = 0; i < values.size(); ++i) {
+      partial[i % parts] += values[i];
+    }
+
+    // combine as an unbalanced tree
+    sum_type total;
+    for (int p = parts - 1; p >= 0; --p) {
+      total = partial[p] + total;
+    }
+
+    ASSERT_TRUE(same_bits(total.value(), expected));
+    ASSERT_TRUE(total == forward);
+  }
+}
+
+TYPED_TEST_P(ReproducibleSumUnitTest, Special)
+{
+  using sum_type = RAJA::reduce::reproducible_sum<TypeParam>;
+  using limits = std::numeric_limits<TypeParam>;
+
+  sum_type pos;
+  pos += TypeParam(1);
+  pos += limits::infinity();
+  ASSERT_EQ(pos.value(), limits::infinity());
+
+  sum_type neg;
+  neg += -limits::infinity();
+  ASSERT_EQ(neg.value(), -limits::infinity());
+
+  ASSERT_TRUE(std::isnan((pos + neg).value()));
+
+  sum_type nan;
+  nan += limits::quiet_NaN();
+  ASSERT_TRUE(std::isnan(nan.value()));
+
+  sum_type overflow;
+  overflow += limits::max();
+  overflow += limits::max();
+  ASSERT_EQ(overflow.value(), limits::infinity());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ReproducibleSumUnitTest,
+                            Exact,
+                            OrderIndependent,
+                            Special);
+
+using ReproducibleSumTypes = ::testing::Types<float, double>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(ReproducibleSumUnitTests,
+                               ReproducibleSumUnitTest,
+                               ReproducibleSumTypes);
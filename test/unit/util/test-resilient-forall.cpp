@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for resilient_forall
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+#include <vector>
+
+TEST(ResilientForallUnitTest, ReplaysFromSnapshot)
+{
+  const int N = 1000;
+  std::vector<int> a(N, 1);
+  int* a_ptr = a.data();
+
+  RAJA::resources::Host res = RAJA::resources::Host::get_default();
+  RAJA::expt::SnapshotPool<RAJA::resources::Host> pool(res, 2);
+
+  // the first run is reported as hit by a soft error
+  int runs = 0;
+  auto check = [&]() { return ++runs == 1; };
+
+  // not idempotent, so a replay without the snapshot would double it
+  RAJA::expt::resilient_forall<RAJA::seq_exec>(
+      pool,
+      RAJA::expt::WriteSet(a_ptr, N),
+      RAJA::TypedRangeSegment<int>(0, N),
+      [=](int i) { a_ptr[i] += i; },
+      check);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], 1 + i);
+  }
+
+#if defined(RAJA_ENABLE_FT)
+  ASSERT_EQ(runs, 2);
+  ASSERT_EQ(pool.replays(), 1);
+
+  // errors that remain after max_replays are not hidden
+  auto always = []() { return true; };
+  ASSERT_THROW(RAJA::expt::resilient_forall<RAJA::seq_exec>(
+                   pool,
+                   RAJA::expt::WriteSet(a_ptr, N),
+                   RAJA::TypedRangeSegment<int>(0, N),
+                   [=](int i) { a_ptr[i] = 0; },
+                   always),
+               std::runtime_error);
+
+  RAJA::expt::soft_error_flag() = 1;
+  ASSERT_TRUE(RAJA::expt::soft_error_detected{}());
+  ASSERT_FALSE(RAJA::expt::soft_error_detected{}());
+#else
+  ASSERT_EQ(runs, 0);
+  ASSERT_EQ(pool.replays(), 0);
+#endif
+}
@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for tensor_stats counters
+///
+
+#ifndef RAJA_ENABLE_VECTOR_STATS
+#define RAJA_ENABLE_VECTOR_STATS
+#endif
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/pattern/tensor/stats.hpp"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ts = RAJA::expt::tensor_stats;
+
+TEST(TensorStatsUnitTest, CountsAcrossThreads)
+{
+  ts::reset();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([]() {
+      for (int i = 0; i < 1000; ++i) {
+        RAJA_TENSOR_STATS_INC(num_vector_load_packed);
+      }
+      RAJA_TENSOR_STATS_INC(num_vector_gather);
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  RAJA_TENSOR_STATS_INC(num_vector_load_packed);
+
+  // exited threads are kept in the total
+  ts::counts c = ts::read();
+  ASSERT_EQ(c[ts::num_vector_load_packed], 4001);
+  ASSERT_EQ(c[ts::num_vector_gather], 4);
+  ASSERT_EQ(c[ts::num_vector_store_packed], 0);
+
+  ts::reset();
+  ASSERT_EQ(ts::read()[ts::num_vector_load_packed], 0);
+}
+
+TEST(TensorStatsUnitTest, KernelScope)
+{
+  ts::reset();
+  ts::reset_kernel_report();
+
+  RAJA_TENSOR_STATS_INC(num_vector_add);
+  {
+    ts::kernel_scope scope("k");
+    RAJA_TENSOR_STATS_INC(num_matrix_load_strided);
+    RAJA_TENSOR_STATS_INC(num_matrix_load_packed);
+    ASSERT_EQ(scope.elapsed()[ts::num_matrix_load_strided], 1);
+    ASSERT_EQ(scope.elapsed()[ts::num_vector_add], 0);
+  }
+  {
+    ts::kernel_scope scope("k");
+    RAJA_TENSOR_STATS_INC(num_matrix_load_strided);
+  }
+
+  ASSERT_STREQ(ts::counter_name(ts::num_matrix_load_strided),
+               "num_matrix_load_strided");
+
+  FILE *f = tmpfile();
+  ASSERT_NE(f, nullptr);
+  ts::print_kernel_report(f);
+  std::string report;
+  rewind(f);
+  for (int ch = fgetc(f); ch != EOF; ch = fgetc(f)) {
+    report.push_back(static_cast<char>(ch));
+  }
+  fclose(f);
+  ASSERT_NE(report.find("Statistics for k:"), std::string::npos);
+  ASSERT_NE(report.find("num_matrix_load_strided"), std::string::npos);
+  ASSERT_NE(report.find("matrix loads:   3, 66% strided"), std::string::npos);
+  ASSERT_EQ(report.find("num_vector_add"), std::string::npos);
+
+  ts::reset_kernel_report();
+}
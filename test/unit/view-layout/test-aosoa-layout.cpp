@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(AoSoALayoutUnitTest, Offsets)
+{
+  /*
+   * 10 elements with 3 fields, in tiles of 4 elements:
+   *
+   * tile 0: f0 e0..e3, f1 e0..e3, f2 e0..e3
+   * tile 1: f0 e4..e7, ...
+   * tile 2: f0 e8 e9 (padding), ...
+   */
+  const RAJA::AoSoALayout<4> layout(10, 3);
+
+  ASSERT_EQ(3, layout.num_tiles());
+  ASSERT_EQ(36, layout.size());
+
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(1, 0));
+  ASSERT_EQ(9, layout(1, 2));
+  ASSERT_EQ(12, layout(4, 0));
+  ASSERT_EQ(17, layout(5, 1));
+  ASSERT_EQ(33, layout(9, 2));
+
+  // Check the inverse, and that the tile layout addresses the same storage
+  auto tiles = layout.tile_layout();
+  for (int i = 0; i < 10; ++i) {
+    for (int f = 0; f < 3; ++f) {
+      int lin = layout(i, f);
+      ASSERT_EQ(lin, tiles(i / 4, f, i % 4));
+
+      int i2, f2;
+      layout.toIndices(lin, i2, f2);
+      ASSERT_EQ(i, i2);
+      ASSERT_EQ(f, f2);
+    }
+  }
+}
+
+TEST(AoSoALayoutUnitTest, View)
+{
+  using layout_t = RAJA::AoSoALayout<8>;
+
+  const int N = 21;
+  const int F = 5;
+  layout_t layout(N, F);
+
+  std::vector<double> data(layout.size(), -1.0);
+  RAJA::View<double, layout_t> x(data.data(), N, F);
+
+  for (int i = 0; i < N; ++i) {
+    for (int f = 0; f < F; ++f) {
+      x(i, f) = 100 * i + f;
+    }
+  }
+
+  // Each field of a tile is contiguous
+  for (int i = 0; i < N; ++i) {
+    for (int f = 0; f < F; ++f) {
+      ASSERT_EQ(double(100 * i + f), data[(i / 8) * 8 * F + f * 8 + i % 8]);
+    }
+  }
+
+  auto x_tiles = RAJA::make_aosoa_tile_view(x);
+  for (int i = 0; i < N; ++i) {
+    for (int f = 0; f < F; ++f) {
+      ASSERT_EQ(x(i, f), x_tiles(i / 8, f, i % 8));
+    }
+  }
+}
+
+TEST(AoSoALayoutUnitTest, TensorTiles)
+{
+  using vector_t = RAJA::expt::VectorRegister<double>;
+  using idx_t = RAJA::expt::VectorIndex<int, vector_t>;
+  using layout_t = RAJA::AoSoALayout<vector_t::s_num_elem>;
+
+  const int N = 3 * vector_t::s_num_elem + 1;
+  const int F = 3;
+  layout_t layout(N, F);
+
+  std::vector<double> data(layout.size(), 0.0);
+  RAJA::View<double, layout_t> x(data.data(), N, F);
+
+  for (int i = 0; i < N; ++i) {
+    for (int f = 0; f < F; ++f) {
+      x(i, f) = i + f;
+    }
+  }
+
+  // field 2 = field 0 * field 1, one packed load per field and tile
+  auto x_tiles = RAJA::make_aosoa_tile_view(x);
+  auto all = idx_t::all();
+  for (int t = 0; t < layout.num_tiles(); ++t) {
+    x_tiles(t, 2, all) = x_tiles(t, 0, all) * x_tiles(t, 1, all);
+  }
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(double(i * (i + 1)), x(i, 2));
+  }
+}
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_unit-test-types.hpp"
+
+#include <stdexcept>
+
+RAJA_INDEX_VALUE(TIX, "TIX");
+RAJA_INDEX_VALUE(TIY, "TIY");
+
+// Unchecked layouts are not changed
+static_assert(std::is_same<RAJA::CheckedLayoutIf<false, RAJA::Layout<2>>,
+                           RAJA::Layout<2>>::value,
+              "CheckedLayoutIf<false> must be the layout itself");
+static_assert(sizeof(RAJA::CheckedLayout<RAJA::Layout<2>>) ==
+                  sizeof(RAJA::Layout<2>),
+              "CheckedLayout must not add state");
+
+template<typename T>
+class CheckedLayoutUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(CheckedLayoutUnitTest, UnitIntFloatTypes);
+
+TYPED_TEST(CheckedLayoutUnitTest, InBounds)
+{
+  const int N = 3;
+  const int M = 4;
+
+  TypeParam data[N*M];
+
+  RAJA::CheckedView<TypeParam, RAJA::Layout<2>> A(data, N, M);
+  RAJA::View<TypeParam, RAJA::Layout<2>> B(data, N, M);
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      A(i, j) = static_cast<TypeParam>(i * M + j);
+    }
+  }
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(B(i, j), A(i, j));
+      ASSERT_EQ(static_cast<TypeParam>(i * M + j), data[i * M + j]);
+    }
+  }
+}
+
+TYPED_TEST(CheckedLayoutUnitTest, Typed)
+{
+  const int N = 3;
+  const int M = 4;
+
+  TypeParam data[N*M];
+
+  RAJA::TypedCheckedView<TypeParam, RAJA::Layout<2>, TIX, TIY> A(data, N, M);
+
+  A(TIX{2}, TIY{3}) = static_cast<TypeParam>(5);
+  ASSERT_EQ(static_cast<TypeParam>(5), data[2 * M + 3]);
+}
+
+#if !defined(RAJA_ENABLE_TARGET_OPENMP)
+TYPED_TEST(CheckedLayoutUnitTest, OutOfBounds)
+{
+  const int N = 3;
+  const int M = 4;
+
+  TypeParam data[N*M];
+
+  RAJA::CheckedView<TypeParam, RAJA::Layout<2>> A(data, N, M);
+
+  EXPECT_THROW( (A(N, 0) = (TypeParam)0), std::runtime_error );
+  EXPECT_THROW( (A(0, M) = (TypeParam)0), std::runtime_error );
+  EXPECT_THROW( (A(-1, 0) = (TypeParam)0), std::runtime_error );
+}
+
+TYPED_TEST(CheckedLayoutUnitTest, Shift)
+{
+  const int N = 3;
+  const int M = 4;
+
+  TypeParam data[N*M];
+
+  RAJA::CheckedView<TypeParam, RAJA::Layout<2>> A(data, N, M);
+  auto Ashift = A.shift({{2, 2}});
+
+  Ashift(2, 2) = static_cast<TypeParam>(7);
+  ASSERT_EQ(static_cast<TypeParam>(7), data[0]);
+
+  EXPECT_THROW( (Ashift(0, 2) = (TypeParam)0), std::runtime_error );
+  EXPECT_THROW( (Ashift(2, 2 + M) = (TypeParam)0), std::runtime_error );
+}
+#endif
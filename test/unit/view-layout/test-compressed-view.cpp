@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdint>
+
+RAJA_INDEX_VALUE(TIX, "TIX");
+RAJA_INDEX_VALUE(TIY, "TIY");
+
+TEST(CompressedViewUnitTest, FloatStorage)
+{
+  const int N = 5;
+  const int M = 7;
+
+  float data[N*M];
+
+  using view_t = RAJA::CompressedView<double, float, RAJA::Layout<2>>;
+  view_t A(data, N, M);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N), [=](int i){
+    RAJA::forall<RAJA::simd_exec>(RAJA::TypedRangeSegment<int>(0, M), [=](int j){
+      A(i, j) = 0.25 * (i * M + j);
+      A(i, j) += 1.0;
+    });
+  });
+
+  for (int k = 0; k < N*M; ++k) {
+    ASSERT_EQ(static_cast<float>(0.25 * k + 1.0), data[k]);
+  }
+
+  // reads convert to the value type
+  double a = A(2, 3);
+  ASSERT_EQ(static_cast<double>(data[2*M + 3]), a);
+
+  // assignment between accesses copies values
+  A(0, 0) = A(1, 1);
+  ASSERT_EQ(data[M + 1], data[0]);
+
+  /*
+   * Should be able to construct a const View from a non-const View
+   */
+  RAJA::CompressedView<double const, float, RAJA::Layout<2>> const_view(A);
+  ASSERT_EQ(a, const_view(2, 3));
+  ASSERT_EQ(data, const_view.get_data().get());
+}
+
+TEST(CompressedViewUnitTest, HalfStorage)
+{
+  const int N = 16;
+
+  RAJA::expt::half_t data[N];
+
+  RAJA::CompressedView<double, RAJA::expt::half_t, RAJA::Layout<1>> A(data, N);
+
+  for (int i = 0; i < N; ++i) {
+    A(i) = 1.0 / (i + 1);
+  }
+
+  for (int i = 0; i < N; ++i) {
+    // 11 significant bits
+    ASSERT_NEAR(1.0 / (i + 1), A(i), 1.0 / (i + 1) / 2048.0);
+  }
+
+  A(0) = 0.5;
+  ASSERT_EQ(0x3800, data[0].bits);
+}
+
+TEST(CompressedViewUnitTest, FixedPointStorage)
+{
+  using q15_t = RAJA::fixed_point_t<std::int16_t, 15>;
+
+  q15_t data[4];
+
+  RAJA::CompressedView<double, q15_t, RAJA::Layout<1>> A(data, 4);
+
+  A(0) = 0.5;
+  A(1) = -0.25;
+  A(2) = 2.0;    // saturates
+  A(3) = -2.0;   // saturates
+
+  ASSERT_EQ(16384, data[0].bits);
+  ASSERT_EQ(-8192, data[1].bits);
+  ASSERT_EQ(32767, data[2].bits);
+  ASSERT_EQ(-32768, data[3].bits);
+
+  ASSERT_EQ(0.5, A(0));
+  ASSERT_EQ(-0.25, A(1));
+  ASSERT_EQ(-1.0, A(3));
+}
+
+TEST(CompressedViewUnitTest, Typed)
+{
+  const int N = 3;
+  const int M = 4;
+
+  float data[N*M];
+
+  RAJA::TypedCompressedView<double, float, RAJA::Layout<2>, TIX, TIY> A(data, N, M);
+
+  A(TIX{2}, TIY{3}) = 1.5;
+  ASSERT_EQ(1.5f, data[2*M + 3]);
+  ASSERT_EQ(1.5, A(TIX{2}, TIY{3}));
+}
@@ -322,3 +322,56 @@ TYPED_TEST(MultiViewUnitTest, Shift2D)
   delete[] a0;
   delete[] b0;
 }
+
+TYPED_TEST(MultiViewUnitTest, FixedMultiView)
+{
+  const int Nx = 3;
+  const int Ny = 5;
+  const int N  = Nx*Ny;
+  TypeParam *b = new TypeParam[N];
+  TypeParam *c = new TypeParam[N];
+  TypeParam *d = new TypeParam[N];
+  TypeParam *a[3];
+
+  a[0] = b;
+  a[1] = c;
+  a[2] = d;
+
+  for(int i=0; i<N; ++i)
+  {
+    a[0][i] = static_cast<TypeParam>(i);
+    a[1][i] = static_cast<TypeParam>(i)+1;
+    a[2][i] = static_cast<TypeParam>(i)+2;
+  }
+
+  RAJA::FixedMultiView<TypeParam, RAJA::Layout<2>, 3> fixed_view(a,Ny,Nx);
+  RAJA::FixedMultiView<TypeParam, RAJA::Layout<2>, 3, 1> fixed_view1p(a,Ny,Nx);
+
+  // the pointers are copied, and not read from a afterwards
+  a[0] = nullptr;
+
+  for(int p=0; p<3; ++p) {
+    for(int j=0; j<Ny; ++j) {
+      for(int i=0; i<Nx; ++i) {
+        ASSERT_EQ(static_cast<TypeParam>(j*Nx+i+p), fixed_view(p,j,i));
+        ASSERT_EQ(static_cast<TypeParam>(j*Nx+i+p), fixed_view1p(j,p,i));
+      }
+    }
+  }
+
+  fixed_view(2,1,1) = static_cast<TypeParam>(42);
+  ASSERT_EQ(static_cast<TypeParam>(42), d[Nx+1]);
+
+  // construct a const FixedMultiView from a non-const FixedMultiView
+  RAJA::FixedMultiView<TypeParam const, RAJA::Layout<2>, 3> const_view(fixed_view);
+  ASSERT_EQ(static_cast<TypeParam>(42), const_view(2,1,1));
+  ASSERT_EQ(b, const_view.data[0]);
+
+#if !defined(RAJA_ENABLE_TARGET_OPENMP)
+  EXPECT_THROW( (fixed_view(3,0,0) = (TypeParam)0), std::runtime_error );
+#endif
+
+  delete[] b;
+  delete[] c;
+  delete[] d;
+}
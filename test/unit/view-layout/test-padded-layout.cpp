@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+TEST(PaddedLayoutUnitTest, Strides)
+{
+  const auto layout = RAJA::make_padded_layout<2>({{4, 6}}, {{0, 1}});
+
+  ASSERT_EQ(7, layout.strides[0]);
+  ASSERT_EQ(1, layout.strides[1]);
+  ASSERT_EQ(24, layout.size());
+  ASSERT_EQ(27, RAJA::layout_storage_size(layout));
+
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      ASSERT_EQ(i * 7 + j, layout(i, j));
+
+      int ii = -1, jj = -1;
+      layout.toIndices(layout(i, j), ii, jj);
+      ASSERT_EQ(i, ii);
+      ASSERT_EQ(j, jj);
+    }
+  }
+}
+
+TEST(PaddedLayoutUnitTest, Permuted)
+{
+  const auto layout =
+      RAJA::make_padded_layout({{3, 5}},
+                               {{2, 0}},
+                               RAJA::as_array<RAJA::PERM_JI>::get());
+
+  ASSERT_EQ(1, layout.strides[0]);
+  ASSERT_EQ(5, layout.strides[1]);
+  ASSERT_EQ(23, RAJA::layout_storage_size(layout));
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      int ii = -1, jj = -1;
+      layout.toIndices(layout(i, j), ii, jj);
+      ASSERT_EQ(i, ii);
+      ASSERT_EQ(j, jj);
+    }
+  }
+}
+
+TEST(PaddedLayoutUnitTest, ConflictFree)
+{
+  // cache with 512 values per way, rows aligned to 8 values
+  const auto cpu =
+      RAJA::make_conflict_free_layout({{1024, 1024}},
+                                      RAJA::as_array<RAJA::PERM_IJ>::get(),
+                                      512, 8);
+  ASSERT_EQ(1032, cpu.strides[0]);
+  ASSERT_EQ(1, cpu.strides[1]);
+
+  // 32 shared memory banks, dimension 0 stride one
+  const auto gpu =
+      RAJA::make_conflict_free_layout({{32, 32, 32}},
+                                      RAJA::as_array<RAJA::PERM_KJI>::get(),
+                                      32);
+  ASSERT_EQ(1, gpu.strides[0]);
+  ASSERT_EQ(33, gpu.strides[1]);
+  ASSERT_EQ(33 * 33, gpu.strides[2]);
+
+  for (int i = 0; i < 32; ++i) {
+    for (int j = 0; j < 32; ++j) {
+      for (int k = 0; k < 32; ++k) {
+        int ii = -1, jj = -1, kk = -1;
+        gpu.toIndices(gpu(i, j, k), ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+      }
+    }
+  }
+
+  // sizes that do not conflict are not padded
+  const auto dense =
+      RAJA::make_conflict_free_layout({{8, 7}},
+                                      RAJA::as_array<RAJA::PERM_IJ>::get(),
+                                      32);
+  ASSERT_EQ(7, dense.strides[0]);
+  ASSERT_EQ(56, RAJA::layout_storage_size(dense));
+}
+
+TEST(PaddedLayoutUnitTest, Static)
+{
+  using layout = RAJA::PaddedStaticLayout<RAJA::PERM_IJ, camp::idx_seq<0, 1>, 32, 32>;
+
+  ASSERT_EQ(32 * 33, layout::size());
+  ASSERT_EQ(33, layout::s_oper(1, 0));
+  ASSERT_EQ(1, layout::s_oper(0, 1));
+  ASSERT_EQ(1, layout::stride_one_dim);
+
+  using perm_layout = RAJA::PaddedStaticLayout<RAJA::PERM_JI, camp::idx_seq<1, 0>, 4, 8>;
+
+  ASSERT_EQ(40, perm_layout::size());
+  ASSERT_EQ(5, perm_layout::s_oper(0, 1));
+  ASSERT_EQ(1, perm_layout::s_oper(1, 0));
+}
+
+TEST(PaddedLayoutUnitTest, LocalArray)
+{
+  using tile_t = RAJA::PaddedLocalArray<int, RAJA::Perm<0, 1>,
+                                        RAJA::SizeList<4, 4>,
+                                        RAJA::SizeList<0, 1>>;
+
+  tile_t tile;
+  ASSERT_EQ(20, tile.size());
+
+  int data[20];
+  tile.set_data(&data[0]);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      tile(i, j) = i * 4 + j;
+    }
+  }
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_EQ(i * 4 + j, data[i * 5 + j]);
+    }
+  }
+}
@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_unit-test-types.hpp"
+
+RAJA_INDEX_VALUE(TIX, "TIX");
+RAJA_INDEX_VALUE(TIY, "TIY");
+
+template<typename T>
+class RestrictViewUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(RestrictViewUnitTest, UnitIntFloatTypes);
+
+TYPED_TEST(RestrictViewUnitTest, Constructors)
+{
+  using layout = RAJA::Layout<1>;
+
+  const TypeParam val = 2;
+
+  TypeParam data[10];
+  data[0] = val;
+
+  RAJA::RestrictView<TypeParam, layout> view(data, layout(10));
+  ASSERT_EQ(val, view(0));
+  ASSERT_EQ(data, view.get_data().get());
+
+  /*
+   * Should be able to construct a const View from a non-const View
+   */
+  RAJA::RestrictView<TypeParam const, layout> const_view(view);
+  ASSERT_EQ(val, const_view(0));
+}
+
+TYPED_TEST(RestrictViewUnitTest, AlignedAccess)
+{
+  const int N = 13;
+  const int M = 7;
+
+  TypeParam *a = RAJA::allocate_aligned_type<TypeParam>(RAJA::DATA_ALIGN, N*M*sizeof(TypeParam));
+  TypeParam *b = RAJA::allocate_aligned_type<TypeParam>(RAJA::DATA_ALIGN, N*M*sizeof(TypeParam));
+
+  using view_t = RAJA::RestrictView<TypeParam, RAJA::Layout<2>, RAJA::DATA_ALIGN>;
+  view_t A(a, N, M);
+  view_t B(b, N, M);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N), [=](int i){
+    RAJA::forall<RAJA::simd_exec>(RAJA::TypedRangeSegment<int>(0, M), [=](int j){
+      A(i, j) = static_cast<TypeParam>(i + j);
+      B(i, j) = 2 * A(i, j);
+    });
+  });
+
+  for (int k = 0; k < N*M; ++k) {
+    ASSERT_EQ(static_cast<TypeParam>(2 * (k / M + k % M)), b[k]);
+  }
+
+  RAJA::free_aligned(a);
+  RAJA::free_aligned(b);
+}
+
+TYPED_TEST(RestrictViewUnitTest, Typed)
+{
+  TypeParam data[6];
+
+  RAJA::TypedRestrictView<TypeParam, RAJA::Layout<2>, alignof(TypeParam), TIX, TIY> view(data, 2, 3);
+
+  for (int x = 0; x < 2; ++x) {
+    for (int y = 0; y < 3; ++y) {
+      view(TIX{x}, TIY{y}) = static_cast<TypeParam>(x * 3 + y);
+    }
+  }
+
+  for (int k = 0; k < 6; ++k) {
+    ASSERT_EQ(static_cast<TypeParam>(k), data[k]);
+  }
+}
@@ -0,0 +1,90 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdint>
+
+RAJA_INDEX_VALUE(TIX, "TIX");
+RAJA_INDEX_VALUE(TIY, "TIY");
+
+TEST(StreamingViewUnitTest, DoubleStores)
+{
+  const int N = 5;
+  const int M = 7;
+
+  double data[N*M];
+
+  using view_t = RAJA::StreamingView<double, RAJA::Layout<2>>;
+  view_t A(data, N, M);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N), [=](int i){
+    RAJA::forall<RAJA::simd_exec>(RAJA::TypedRangeSegment<int>(0, M), [=](int j){
+      A(i, j) = 0.5 * (i * M + j);
+    });
+  });
+
+  for (int k = 0; k < N*M; ++k) {
+    ASSERT_EQ(0.5 * k, data[k]);
+  }
+
+  // reads are normal loads
+  double a = A(2, 3);
+  ASSERT_EQ(data[2*M + 3], a);
+
+  // assignment between accesses copies values
+  A(0, 0) = A(1, 1);
+  ASSERT_EQ(data[M + 1], data[0]);
+
+  /*
+   * Should be able to construct a const View from a non-const View
+   */
+  RAJA::StreamingView<double const, RAJA::Layout<2>> const_view(A);
+  ASSERT_EQ(a, const_view(2, 3));
+  ASSERT_EQ(data, const_view.get_data().get());
+}
+
+TEST(StreamingViewUnitTest, OtherTypes)
+{
+  const int N = 16;
+
+  std::int32_t ints[N];
+  float floats[N];
+  std::int16_t shorts[N];
+
+  RAJA::StreamingView<std::int32_t, RAJA::Layout<1>> I(ints, N);
+  RAJA::StreamingView<float, RAJA::Layout<1>> F(floats, N);
+  // not streamed, but stored normally
+  RAJA::StreamingView<std::int16_t, RAJA::Layout<1>> S(shorts, N);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N), [=](int i){
+    I(i) = 3 * i;
+    F(i) = 0.25f * i;
+    S(i) = static_cast<std::int16_t>(-i);
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(3 * i, ints[i]);
+    ASSERT_EQ(0.25f * i, floats[i]);
+    ASSERT_EQ(-i, shorts[i]);
+  }
+}
+
+TEST(StreamingViewUnitTest, TypedView)
+{
+  const int N = 4;
+  const int M = 3;
+
+  long data[N*M];
+
+  RAJA::TypedStreamingView<long, RAJA::Layout<2>, TIX, TIY> A(data, N, M);
+
+  A(TIX{2}, TIY{1}) = 42;
+
+  ASSERT_EQ(42, data[2*M + 1]);
+  ASSERT_EQ(42, A(TIX{2}, TIY{1}));
+}
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_unit-test-types.hpp"
+
+template<typename T>
+class SubViewUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(SubViewUnitTest, UnitIntFloatTypes);
+
+TYPED_TEST(SubViewUnitTest, SubView)
+{
+  const int Nx = 6;
+  const int Ny = 7;
+  const int Nz = 8;
+
+  TypeParam data[Nx*Ny*Nz];
+  for (int k = 0; k < Nx*Ny*Nz; ++k) {
+    data[k] = static_cast<TypeParam>(k);
+  }
+
+  RAJA::View<TypeParam, RAJA::Layout<3>> A(data, Nx, Ny, Nz);
+
+  auto B = A.sub_view({{1, 2, 3}}, {{4, 6, 8}});
+
+  ASSERT_EQ(3, B.get_layout().template get_dim_size<0>());
+  ASSERT_EQ(4, B.get_layout().template get_dim_size<1>());
+  ASSERT_EQ(5, B.get_layout().template get_dim_size<2>());
+  ASSERT_EQ(&A(1, 2, 3), B.get_data());
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      for (int k = 0; k < 5; ++k) {
+        ASSERT_EQ(A(i+1, j+2, k+3), B(i, j, k));
+
+        RAJA::Index_type ii, jj, kk;
+        B.get_layout().toIndices(B.get_layout()(i, j, k), ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+      }
+    }
+  }
+
+  B(0, 0, 0) = static_cast<TypeParam>(-1);
+  ASSERT_EQ(static_cast<TypeParam>(-1), A(1, 2, 3));
+}
+
+TYPED_TEST(SubViewUnitTest, Interior)
+{
+  const int N = 10;
+  const int G = 2;
+
+  TypeParam data[(N+2*G)*(N+2*G)];
+  for (int k = 0; k < (N+2*G)*(N+2*G); ++k) {
+    data[k] = static_cast<TypeParam>(k);
+  }
+
+  // patch with ghost zones, indexed from -G
+  RAJA::View<TypeParam, RAJA::OffsetLayout<2>> A(
+      data, RAJA::make_offset_layout<2>({{-G, -G}}, {{N+G, N+G}}));
+
+  auto I = A.interior({{G, G}});
+
+  ASSERT_EQ(N, I.get_layout().template get_dim_size<0>());
+  ASSERT_EQ(N, I.get_layout().template get_dim_size<1>());
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < N; ++j) {
+      ASSERT_EQ(A(i, j), I(i, j));
+    }
+  }
+}
+
+TYPED_TEST(SubViewUnitTest, Slab)
+{
+  const int Nx = 5;
+  const int Ny = 4;
+
+  TypeParam data[Nx*Ny];
+  for (int k = 0; k < Nx*Ny; ++k) {
+    data[k] = static_cast<TypeParam>(k);
+  }
+
+  RAJA::View<TypeParam, RAJA::Layout<2>> A(data, Nx, Ny);
+
+  // the last row, and the last column
+  auto row = A.slab(0, Nx-1, Nx);
+  auto col = A.slab(1, Ny-1, Ny);
+
+  ASSERT_EQ(1, row.get_layout().template get_dim_size<0>());
+  ASSERT_EQ(Ny, row.get_layout().template get_dim_size<1>());
+  ASSERT_EQ(Nx, col.get_layout().template get_dim_size<0>());
+  ASSERT_EQ(1, col.get_layout().template get_dim_size<1>());
+
+  for (int j = 0; j < Ny; ++j) {
+    ASSERT_EQ(A(Nx-1, j), row(0, j));
+  }
+  for (int i = 0; i < Nx; ++i) {
+    ASSERT_EQ(A(i, Ny-1), col(i, 0));
+  }
+}
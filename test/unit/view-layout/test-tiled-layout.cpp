@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_unit-test-types.hpp"
+
+#include <vector>
+
+template <typename LAYOUT>
+void checkTiledLayout3(LAYOUT const &layout, int nx, int ny, int nz)
+{
+  std::vector<int> count(layout.size(), 0);
+
+  for (int i = 0; i < nx; ++i) {
+    for (int j = 0; j < ny; ++j) {
+      for (int k = 0; k < nz; ++k) {
+        auto lin = layout(i, j, k);
+        ASSERT_LE(0, lin);
+        ASSERT_LT(lin, layout.size());
+        ++count[lin];
+
+        int ii = -1, jj = -1, kk = -1;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+      }
+    }
+  }
+
+  for (int c : count) {
+    ASSERT_LE(c, 1);
+  }
+}
+
+TEST(TiledLayoutUnitTest, Offsets)
+{
+  RAJA::TiledLayout<2, 2> layout(4, 4);
+
+  ASSERT_EQ(16, layout.size());
+  ASSERT_EQ(4, layout.num_tiles());
+
+  // tile (0,0)
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(2, layout(1, 0));
+  ASSERT_EQ(3, layout(1, 1));
+  // tile (0,1)
+  ASSERT_EQ(4, layout(0, 2));
+  // tile (1,0)
+  ASSERT_EQ(8, layout(2, 0));
+  ASSERT_EQ(15, layout(3, 3));
+}
+
+TEST(TiledLayoutUnitTest, Morton)
+{
+  RAJA::MortonTiledLayout<2, 4> layout(4, 4);
+
+  // Z order inside the tile
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(2, layout(1, 0));
+  ASSERT_EQ(3, layout(1, 1));
+  ASSERT_EQ(4, layout(0, 2));
+  ASSERT_EQ(8, layout(2, 0));
+  ASSERT_EQ(12, layout(2, 2));
+  ASSERT_EQ(15, layout(3, 3));
+}
+
+TEST(TiledLayoutUnitTest, PartialTiles)
+{
+  RAJA::TiledLayout<3, 4> layout(10, 7, 5);
+  ASSERT_EQ(3 * 2 * 2, layout.num_tiles());
+  ASSERT_EQ(3 * 2 * 2 * 64, layout.size());
+  checkTiledLayout3(layout, 10, 7, 5);
+
+  RAJA::MortonTiledLayout<3, 4> morton(10, 7, 5);
+  ASSERT_EQ(layout.size(), morton.size());
+  checkTiledLayout3(morton, 10, 7, 5);
+}
+
+template<typename T>
+class TiledLayoutViewUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(TiledLayoutViewUnitTest, UnitIntFloatTypes);
+
+TYPED_TEST(TiledLayoutViewUnitTest, KernelTiles)
+{
+  const int N = 12;
+  using layout_t = RAJA::TiledLayout<2, 4>;
+
+  layout_t layout(N, N);
+  std::vector<TypeParam> data(layout.size(), TypeParam(0));
+  RAJA::View<TypeParam, layout_t> view(data.data(), layout);
+
+  //
+  // Tile statements aligned to the storage tiles visit each tile as one
+  // contiguous block of the storage
+  //
+  using POLICY =
+    RAJA::KernelPolicy<
+      RAJA::statement::Tile<0, RAJA::tile_fixed<layout_t::tile_size>, RAJA::seq_exec,
+        RAJA::statement::Tile<1, RAJA::tile_fixed<layout_t::tile_size>, RAJA::seq_exec,
+          RAJA::statement::For<0, RAJA::seq_exec,
+            RAJA::statement::For<1, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+
+  int visited = 0;
+  int *visited_ptr = &visited;
+  RAJA::kernel<POLICY>(
+    RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N),
+                     RAJA::TypedRangeSegment<int>(0, N)),
+    [=](int i, int j) {
+      view(i, j) = static_cast<TypeParam>(*visited_ptr);
+      ++(*visited_ptr);
+    });
+
+  for (int lin = 0; lin < N * N; ++lin) {
+    ASSERT_EQ(static_cast<TypeParam>(lin), data[lin]);
+  }
+}
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_unit-test-types.hpp"
+
+RAJA_INDEX_VALUE(TIX, "TIX");
+RAJA_INDEX_VALUE(TIY, "TIY");
+RAJA_INDEX_VALUE(TIZ, "TIZ");
+
+template<typename T>
+class ViewDimIteratorUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(ViewDimIteratorUnitTest, UnitIntFloatTypes);
+
+TYPED_TEST(ViewDimIteratorUnitTest, Layout)
+{
+  TypeParam data[2*3*4];
+  for (int k = 0; k < 2*3*4; ++k) {
+    data[k] = static_cast<TypeParam>(k);
+  }
+
+  RAJA::View<TypeParam, RAJA::Layout<3, RAJA::Index_type, 2>> view(data, 2, 3, 4);
+
+  auto iz = view.template dim_iterator<2>(1, 2, 0);
+  auto iy = view.template dim_iterator<1>(1, 0, 3);
+  static_assert(decltype(iz)::stride_one, "dimension 2 is stride one");
+  static_assert(!decltype(iy)::stride_one, "dimension 1 is not stride one");
+
+  for (int z = 0; z < 4; ++z) {
+    ASSERT_EQ(view(1, 2, z), iz[z]);
+  }
+  for (int y = 0; y < 3; ++y) {
+    ASSERT_EQ(view(1, y, 3), iy[y]);
+  }
+
+  // iterate, and write through the iterator
+  auto end = iy + 3;
+  ASSERT_EQ(3, end - iy);
+  int y = 0;
+  for (auto it = iy; it != end; ++it, ++y) {
+    *it = static_cast<TypeParam>(100 + y);
+  }
+  for (y = 0; y < 3; ++y) {
+    ASSERT_EQ(static_cast<TypeParam>(100 + y), view(1, y, 3));
+  }
+}
+
+TYPED_TEST(ViewDimIteratorUnitTest, PermutedOffsetLayout)
+{
+  TypeParam data[3*5];
+  for (int k = 0; k < 3*5; ++k) {
+    data[k] = static_cast<TypeParam>(k);
+  }
+
+  auto layout = RAJA::make_permuted_offset_layout<2>({{-1, 2}}, {{2, 7}},
+                                                     RAJA::as_array<RAJA::PERM_JI>::get());
+  RAJA::View<TypeParam, decltype(layout)> view(data, layout);
+
+  // dimension 0 is stride one after the permutation, but not at compile time
+  auto ix = view.template dim_iterator<0>(-1, 4);
+  for (int x = -1; x < 2; ++x) {
+    ASSERT_EQ(view(x, 4), ix[x + 1]);
+  }
+
+  auto iy = view.template dim_iterator<1>(1, 2);
+  for (int y = 2; y < 7; ++y) {
+    ASSERT_EQ(view(1, y), *iy++);
+  }
+}
+
+TYPED_TEST(ViewDimIteratorUnitTest, StaticLayout)
+{
+  TypeParam data[3*4];
+  for (int k = 0; k < 3*4; ++k) {
+    data[k] = static_cast<TypeParam>(k);
+  }
+
+  using layout = RAJA::StaticLayout<RAJA::PERM_IJ, 3, 4>;
+  RAJA::View<TypeParam, layout> view(data);
+
+  auto ij = view.template dim_iterator<1>(2, 0);
+  static_assert(decltype(ij)::stride_one, "dimension 1 is stride one");
+  for (int j = 0; j < 4; ++j) {
+    ASSERT_EQ(view(2, j), ij[j]);
+  }
+
+  auto ii = view.template dim_iterator<0>(0, 3);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(view(i, 3), ii[i]);
+  }
+}
+
+TYPED_TEST(ViewDimIteratorUnitTest, TypedView)
+{
+  TypeParam data[2*3*4];
+  for (int k = 0; k < 2*3*4; ++k) {
+    data[k] = static_cast<TypeParam>(k);
+  }
+
+  RAJA::TypedView<TypeParam, RAJA::Layout<3, RAJA::Index_type, 2>, TIX, TIY, TIZ>
+      view(data, 2, 3, 4);
+
+  auto iz = view.template dim_iterator<2>(TIX{1}, TIY{1}, TIZ{0});
+  for (int z = 0; z < 4; ++z) {
+    ASSERT_EQ(view(TIX{1}, TIY{1}, TIZ{z}), iz[TIZ{z}]);
+  }
+}
@@ -51,6 +51,10 @@ void testWorkGroupEnqueueMultiple(RAJA::xargs<Args...>, bool do_instantiate, siz
     // test_empty(pool);
     ASSERT_EQ(pool.num_loops(), (size_t)0);
     ASSERT_EQ(pool.storage_bytes(), (size_t)0);
+    ASSERT_EQ(pool.peak_num_loops(), (size_t)0);
+    ASSERT_EQ(pool.num_reallocations(), (size_t)0);
+
+    size_t num_reallocations = 0;
 
     for (size_t i = 0; i < rep; ++i) {
 
@@ -61,6 +65,14 @@ void testWorkGroupEnqueueMultiple(RAJA::xargs<Args...>, bool do_instantiate, siz
 
         ASSERT_EQ(pool.num_loops(), (size_t)num);
         ASSERT_GE(pool.storage_bytes(), num*sizeof(callable));
+        ASSERT_EQ(pool.peak_num_loops(), (size_t)num);
+        ASSERT_GE(pool.peak_storage_bytes(), pool.storage_bytes());
+
+        // sizes are auto-reserved after the first instantiate
+        if (do_instantiate && i > 0) {
+          ASSERT_EQ(pool.num_reallocations(), num_reallocations);
+        }
+        num_reallocations = pool.num_reallocations();
       }
 
       if (do_instantiate) {
@@ -71,6 +83,9 @@ void testWorkGroupEnqueueMultiple(RAJA::xargs<Args...>, bool do_instantiate, siz
 
       ASSERT_EQ(pool.num_loops(), (size_t)0);
       ASSERT_EQ(pool.storage_bytes(), (size_t)0);
+      if (do_instantiate) {
+        ASSERT_EQ(pool.num_reallocations(), num_reallocations);
+      }
     }
   }
 